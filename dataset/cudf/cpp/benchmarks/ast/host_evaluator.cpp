@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmarks/common/generate_input.hpp>
+
+#include <cudf/ast/detail/host_evaluator.hpp>
+#include <cudf/ast/expressions.hpp>
+#include <cudf/interop.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/default_stream.hpp>
+
+#include <nanoarrow/nanoarrow.hpp>
+#include <nanoarrow/nanoarrow_device.h>
+#include <nvbench/nvbench.cuh>
+
+#include <vector>
+
+template <typename key_type>
+static void BM_ast_host_evaluator(nvbench::state& state)
+{
+  auto const num_rows         = static_cast<cudf::size_type>(state.get_int64("num_rows"));
+  auto const null_probability = state.get_float64("null_probability");
+  auto const vectorized       = state.get_int64("vectorized") != 0;
+
+  data_profile profile;
+  profile.set_null_probability(null_probability);
+  auto const source_table = create_random_table(
+    cycle_dtypes({cudf::type_to_id<key_type>()}, 3), row_count{num_rows}, profile);
+  auto const table = source_table->view();
+
+  auto const stream   = cudf::get_default_stream();
+  auto const metadata = std::vector<cudf::column_metadata>(table.num_columns());
+  auto const schema   = cudf::to_arrow_schema(table, metadata);
+  auto const input    = cudf::to_arrow_host(table, stream);
+
+  // (a + b) * c < a * 2
+  auto two       = cudf::numeric_scalar<key_type>(2);
+  auto col_ref_0 = cudf::ast::column_reference(0);
+  auto col_ref_1 = cudf::ast::column_reference(1);
+  auto col_ref_2 = cudf::ast::column_reference(2);
+  auto lit_two   = cudf::ast::literal(two);
+  auto sum       = cudf::ast::operation(cudf::ast::ast_operator::ADD, col_ref_0, col_ref_1);
+  auto product   = cudf::ast::operation(cudf::ast::ast_operator::MUL, sum, col_ref_2);
+  auto doubled   = cudf::ast::operation(cudf::ast::ast_operator::MUL, col_ref_0, lit_two);
+  auto less      = cudf::ast::operation(cudf::ast::ast_operator::LESS, product, doubled);
+
+  state.add_element_count(num_rows, "rows");
+  state.add_global_memory_reads<key_type>(static_cast<std::size_t>(num_rows) * 3);
+  state.add_global_memory_writes<bool>(num_rows);
+
+  // The host copy of the table is made once, so only the evaluation itself is timed
+  state.exec(nvbench::exec_tag::sync, [&](nvbench::launch&) {
+    cudf::ast::detail::compute_column_host(less, schema.get(), &input->array, vectorized, stream);
+  });
+}
+
+#define AST_HOST_EVALUATOR_BENCHMARK_DEFINE(name, key_type)                         \
+  static void name(::nvbench::state& st) { ::BM_ast_host_evaluator<key_type>(st); } \
+  NVBENCH_BENCH(name)                                                               \
+    .set_name(#name)                                                                \
+    .add_int64_axis("num_rows", {100'000, 1'000'000, 10'000'000})                   \
+    .add_float64_axis("null_probability", {0, 0.5})                                 \
+    .add_int64_axis("vectorized", {0, 1})
+
+AST_HOST_EVALUATOR_BENCHMARK_DEFINE(ast_host_evaluator_int32, int32_t);
+
+AST_HOST_EVALUATOR_BENCHMARK_DEFINE(ast_host_evaluator_float64, double);
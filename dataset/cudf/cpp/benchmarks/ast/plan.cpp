@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmarks/common/generate_input.hpp>
+
+#include <cudf/ast/detail/expression_parser.hpp>
+#include <cudf/ast/expressions.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/transform.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/memory_resource.hpp>
+
+#include <nvbench/nvbench.cuh>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief A filter of the form used by generated queries, where every clause recomputes the same
+ * derived value and compares it to a constant expression:
+ *
+ * `(a * b + c > 0 * 2) && (a * b + c > 1 * 2) && ... && (a * b + c > (clauses - 1) * 2)`
+ */
+struct generated_filter {
+  std::vector<std::unique_ptr<cudf::numeric_scalar<int32_t>>> scalars;
+  cudf::ast::tree tree;
+
+  explicit generated_filter(cudf::size_type clauses)
+  {
+    using op = cudf::ast::ast_operator;
+
+    auto const& a   = tree.push(cudf::ast::column_reference(0));
+    auto const& b   = tree.push(cudf::ast::column_reference(1));
+    auto const& c   = tree.push(cudf::ast::column_reference(2));
+    auto const& two = push_literal(2);
+    cudf::ast::expression const* conjunction{};
+    for (cudf::size_type i = 0; i < clauses; ++i) {
+      // Each clause is built from scratch, as a query front end would
+      auto const& product   = tree.push(cudf::ast::operation(op::MUL, a, b));
+      auto const& value     = tree.push(cudf::ast::operation(op::ADD, product, c));
+      auto const& threshold = tree.push(cudf::ast::operation(op::MUL, push_literal(i), two));
+      auto const& clause    = tree.push(cudf::ast::operation(op::GREATER, value, threshold));
+      if (conjunction == nullptr) {
+        conjunction = &clause;
+      } else {
+        conjunction = &tree.push(cudf::ast::operation(op::LOGICAL_AND, *conjunction, clause));
+      }
+    }
+  }
+
+  /// Returns the conjunction of all clauses, which is the last expression pushed
+  [[nodiscard]] cudf::ast::expression const& root() const { return tree.back(); }
+
+ private:
+  cudf::ast::expression const& push_literal(int32_t value)
+  {
+    scalars.push_back(std::make_unique<cudf::numeric_scalar<int32_t>>(value));
+    return tree.push(cudf::ast::literal(*scalars.back()));
+  }
+};
+
+}  // namespace
+
+static void BM_ast_plan_transform(nvbench::state& state)
+{
+  auto const num_rows = static_cast<cudf::size_type>(state.get_int64("num_rows"));
+  auto const clauses  = static_cast<cudf::size_type>(state.get_int64("clauses"));
+
+  auto const source_table = create_sequence_table(
+    cycle_dtypes({cudf::type_id::INT32}, 3), row_count{num_rows}, std::nullopt);
+  auto const table  = source_table->view();
+  auto const filter = generated_filter{clauses};
+
+  // Report the size of the plan with and without optimization
+  auto const stream = cudf::get_default_stream();
+  auto const mr     = cudf::get_current_device_resource_ref();
+  for (bool optimize : {false, true}) {
+    auto const parser =
+      cudf::ast::detail::expression_parser{filter.root(), table, false, stream, mr, optimize};
+    auto const plan   = parser.host_expression_data();
+    auto const prefix = std::string{optimize ? "" : "unoptimized_"};
+    state.add_element_count(plan.operators.size(), prefix + "operators");
+    state.add_element_count(plan.num_intermediates, prefix + "intermediates");
+  }
+
+  state.add_global_memory_reads<int32_t>(static_cast<std::size_t>(num_rows) * 3);
+  state.add_global_memory_writes<bool>(num_rows);
+
+  state.exec(nvbench::exec_tag::sync,
+             [&](nvbench::launch&) { cudf::compute_column(table, filter.root()); });
+}
+
+static void BM_ast_plan_parse(nvbench::state& state)
+{
+  auto const clauses  = static_cast<cudf::size_type>(state.get_int64("clauses"));
+  auto const optimize = state.get_int64("optimize") != 0;
+
+  auto const source_table = create_sequence_table(
+    cycle_dtypes({cudf::type_id::INT32}, 3), row_count{1}, std::nullopt);
+  auto const table  = source_table->view();
+  auto const filter = generated_filter{clauses};
+
+  auto const stream = cudf::get_default_stream();
+  auto const mr     = cudf::get_current_device_resource_ref();
+  state.set_cuda_stream(nvbench::make_cuda_stream_view(stream.value()));
+  state.exec(nvbench::exec_tag::sync, [&](nvbench::launch&) {
+    cudf::ast::detail::expression_parser{filter.root(), table, false, stream, mr, optimize};
+  });
+}
+
+NVBENCH_BENCH(BM_ast_plan_transform)
+  .set_name("ast_plan_transform")
+  .add_int64_axis("clauses", {1, 4, 16})
+  .add_int64_axis("num_rows", {1'000'000, 10'000'000, 100'000'000});
+
+NVBENCH_BENCH(BM_ast_plan_parse)
+  .set_name("ast_plan_parse")
+  .add_int64_axis("clauses", {4, 16, 64})
+  .add_int64_axis("optimize", {0, 1});
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/timezone.hpp>
+
+#include <nvbench/nvbench.cuh>
+
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+std::vector<std::string> const timezone_names{"America/Los_Angeles",
+                                              "America/New_York",
+                                              "America/Sao_Paulo",
+                                              "Europe/London",
+                                              "Europe/Berlin",
+                                              "Africa/Cairo",
+                                              "Asia/Kolkata",
+                                              "Asia/Tokyo",
+                                              "Australia/Sydney",
+                                              "Pacific/Auckland",
+                                              "Pacific/Apia",
+                                              "Africa/Casablanca",
+                                              "Asia/Tehran",
+                                              "America/Santiago",
+                                              "Europe/Moscow",
+                                              "Asia/Jerusalem"};
+
+}  // namespace
+
+void BM_host_timezone_conversion(nvbench::state& state)
+{
+  auto const num_rows  = static_cast<std::size_t>(state.get_int64("num_rows"));
+  auto const direction = state.get_string("direction");
+
+  auto const table = cudf::detail::make_host_timezone_table(std::nullopt, "America/Los_Angeles");
+
+  // Timestamps from 1900 to 2200, covering both the file entries and the solar cycle
+  std::mt19937_64 engine{42};
+  std::uniform_int_distribution<int64_t> distribution(-2'208'988'800, 7'258'118'400);
+  std::vector<int64_t> timestamps(num_rows);
+  for (auto& ts : timestamps) {
+    ts = distribution(engine);
+  }
+  std::vector<int64_t> output(num_rows);
+
+  state.add_element_count(num_rows, "num_rows");
+  state.add_global_memory_reads<int64_t>(num_rows);
+  state.add_global_memory_writes<int64_t>(num_rows);
+
+  state.exec(nvbench::exec_tag::sync, [&](nvbench::launch&) {
+    if (direction == "to_local") {
+      table.to_local(timestamps, output);
+    } else {
+      table.to_utc(timestamps, output);
+    }
+  });
+}
+
+void BM_host_timezone_preload(nvbench::state& state)
+{
+  auto const num_timezones = static_cast<std::size_t>(state.get_int64("num_timezones"));
+  std::vector<std::string> const names(timezone_names.begin(),
+                                       timezone_names.begin() + num_timezones);
+
+  state.add_element_count(num_timezones, "num_timezones");
+  state.exec(nvbench::exec_tag::sync, [&](nvbench::launch&) {
+    auto const tables = cudf::detail::make_host_timezone_tables(std::nullopt, names);
+  });
+}
+
+NVBENCH_BENCH(BM_host_timezone_conversion)
+  .set_name("host_timezone_conversion")
+  .add_int64_power_of_two_axis("num_rows", {20, 24})
+  .add_string_axis("direction", {"to_local", "to_utc"});
+
+NVBENCH_BENCH(BM_host_timezone_preload)
+  .set_name("host_timezone_preload")
+  .add_int64_axis("num_timezones", {1, 4, 16});
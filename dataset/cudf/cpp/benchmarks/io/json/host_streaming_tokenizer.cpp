@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "io/json/host_streaming_tokenizer.hpp"
+
+#include <cudf/utilities/span.hpp>
+
+#include <nvbench/nvbench.cuh>
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr int num_fields = 32;
+
+std::string field_name(int field) { return "field_" + std::to_string(field); }
+
+/**
+ * @brief Generates JSON Lines records with numbers, strings, lists and structs in turn.
+ */
+std::string generate_json_lines(std::size_t size)
+{
+  std::mt19937 engine{42};
+  std::uniform_int_distribution<int> numbers(-1'000'000, 1'000'000);
+  std::string input;
+  input.reserve(size + 4096);
+  while (input.size() < size) {
+    input += '{';
+    for (int field = 0; field < num_fields; ++field) {
+      if (field > 0) { input += ", "; }
+      input += "\"" + field_name(field) + "\": ";
+      auto const value = std::to_string(numbers(engine));
+      switch (field % 4) {
+        case 0: input += value; break;
+        case 1: input += "\"text, with \\\"quotes\\\" and {brackets} " + value + "\""; break;
+        case 2: input += "[" + value + ", " + value + ", \"" + value + "\"]"; break;
+        default: input += "{\"id\": " + value + ", \"tags\": [\"a\", \"b\"], \"ok\": true}";
+      }
+    }
+    input += "}\n";
+  }
+  return input;
+}
+
+}  // namespace
+
+void BM_host_streaming_tokenizer(nvbench::state& state)
+{
+  auto const data_size     = static_cast<std::size_t>(state.get_int64("data_size"));
+  auto const num_projected = static_cast<int>(state.get_int64("num_projected"));
+  auto const window_size   = static_cast<std::size_t>(state.get_int64("window_size"));
+
+  // Projected fields are spread evenly up to the last field, so that whole records are read
+  std::vector<std::vector<std::string>> projection;
+  auto const stride = num_fields / num_projected;
+  for (int i = 1; i <= num_projected; ++i) {
+    projection.push_back({field_name(i * stride - 1)});
+  }
+
+  auto const input = generate_json_lines(data_size);
+
+  state.add_element_count(input.size(), "bytes");
+  state.add_global_memory_reads<char>(input.size());
+
+  state.exec(nvbench::exec_tag::sync, [&](nvbench::launch&) {
+    cudf::io::json::detail::host_streaming_tokenizer tokenizer(projection);
+    for (std::size_t pos = 0; pos < input.size(); pos += window_size) {
+      auto const size = std::min(window_size, input.size() - pos);
+      tokenizer.append(cudf::host_span<char const>{input.data() + pos, size});
+      tokenizer.take_completed_records();
+    }
+    tokenizer.finish();
+    tokenizer.take_completed_records();
+  });
+}
+
+NVBENCH_BENCH(BM_host_streaming_tokenizer)
+  .set_name("json_host_streaming_tokenizer")
+  .add_int64_power_of_two_axis("data_size", {28})
+  .add_int64_axis("num_projected", {1, 4, 32})
+  .add_int64_power_of_two_axis("window_size", {16, 24});
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "io/parquet/arrow_schema_writer.hpp"
+#include "io/utilities/base64_utilities.hpp"
+
+#include <benchmarks/common/generate_input.hpp>
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/io/cuio_common.hpp>
+
+#include <cudf/detail/utilities/linked_column.hpp>
+#include <cudf/io/parquet.hpp>
+#include <cudf/utilities/default_stream.hpp>
+
+#include <nvbench/nvbench.cuh>
+
+#include <string>
+
+namespace {
+
+/**
+ * @brief Creates a single-row table with a wide schema that includes duration columns, whose
+ * types are recovered from the arrow schema when reading
+ */
+std::unique_ptr<cudf::table> create_wide_table(cudf::size_type num_columns)
+{
+  return create_random_table(cycle_dtypes({cudf::type_id::INT32,
+                                           cudf::type_id::FLOAT64,
+                                           cudf::type_id::DURATION_MILLISECONDS,
+                                           cudf::type_id::STRING},
+                                          num_columns),
+                             row_count{1});
+}
+
+}  // namespace
+
+void BM_parquet_arrow_schema_decode(nvbench::state& state)
+{
+  auto const num_columns = static_cast<cudf::size_type>(state.get_int64("num_columns"));
+  auto const table       = create_wide_table(num_columns);
+
+  auto const encoded_schema = cudf::io::parquet::detail::construct_arrow_schema_ipc_message(
+    cudf::detail::table_to_linked_columns(table->view()),
+    cudf::io::table_input_metadata{table->view()},
+    cudf::io::detail::single_write_mode::YES,
+    false);
+
+  state.add_element_count(encoded_schema.size(), "encoded_bytes");
+  state.add_global_memory_reads<char>(encoded_schema.size());
+
+  state.exec(nvbench::exec_tag::sync, [&](nvbench::launch&) {
+    auto const decoded = cudf::io::detail::base64_decode(encoded_schema);
+  });
+}
+
+void BM_parquet_read_wide_arrow_schema(nvbench::state& state)
+{
+  auto const num_columns = static_cast<cudf::size_type>(state.get_int64("num_columns"));
+  auto const table       = create_wide_table(num_columns);
+
+  cuio_source_sink_pair source_sink(io_type::HOST_BUFFER);
+  cudf::io::parquet_writer_options const write_opts =
+    cudf::io::parquet_writer_options::builder(source_sink.make_sink_info(), table->view())
+      .write_arrow_schema(true);
+  cudf::io::write_parquet(write_opts);
+
+  // Every read after the first one finds the arrow schema of the file in the cache, as when
+  // reading many files of one dataset
+  cudf::io::parquet_reader_options const read_opts =
+    cudf::io::parquet_reader_options::builder(source_sink.make_source_info())
+      .use_arrow_schema(true);
+
+  state.add_element_count(num_columns, "num_columns");
+  state.set_cuda_stream(nvbench::make_cuda_stream_view(cudf::get_default_stream().value()));
+  state.exec(nvbench::exec_tag::sync, [&](nvbench::launch&) { cudf::io::read_parquet(read_opts); });
+}
+
+NVBENCH_BENCH(BM_parquet_arrow_schema_decode)
+  .set_name("parquet_arrow_schema_decode")
+  .add_int64_axis("num_columns", {1'000, 10'000});
+
+NVBENCH_BENCH(BM_parquet_read_wide_arrow_schema)
+  .set_name("parquet_read_wide_arrow_schema")
+  .add_int64_axis("num_columns", {1'000, 10'000});
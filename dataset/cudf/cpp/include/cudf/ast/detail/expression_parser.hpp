@@ -26,8 +26,12 @@
 #include <thrust/scan.h>
 
 #include <functional>
+#include <map>
+#include <memory>
 #include <numeric>
 #include <optional>
+#include <tuple>
+#include <vector>
 
 namespace CUDF_EXPORT cudf {
 namespace ast::detail {
@@ -94,6 +98,21 @@ struct expression_device_view {
   cudf::size_type num_intermediates;
 };
 
+/**
+ * @brief The host-side counterpart of `expression_device_view`.
+ *
+ * Exposes the plan built by an `expression_parser` so that it can be inspected without launching
+ * any kernels.
+ */
+struct expression_host_view {
+  host_span<detail::device_data_reference const> data_references;
+  host_span<generic_scalar_device_view const> literals;
+  host_span<ast_operator const> operators;
+  host_span<cudf::size_type const> operator_arities;
+  host_span<cudf::size_type const> operator_source_indices;
+  cudf::size_type num_intermediates;
+};
+
 /**
  * @brief The expression_parser traverses an expression and converts it into a form suitable for
  * execution on the device.
@@ -101,10 +120,19 @@ struct expression_device_view {
  * This class is part of a "visitor" pattern with the `expression` class.
  *
  * This class does pre-processing work on the host, validating operators and operand data types. It
- * traverses downward from a root expression in a depth-first fashion, capturing information about
- * the expressions and constructing vectors of information that are later used by the device for
- * evaluating the abstract syntax tree as a "linear" list of operators whose input dependencies are
- * resolved into intermediate data storage in shared memory.
+ * traverses downward from a root expression in a depth-first fashion, building a graph of plan
+ * nodes, and then linearizes that graph into vectors of information that are later used by the
+ * device for evaluating the abstract syntax tree as a "linear" list of operators whose input
+ * dependencies are resolved into intermediate data storage in shared memory.
+ *
+ * Unless disabled, the following optimizations are applied while the graph is built:
+ * - Constant folding: operations on valid numeric literals are evaluated once on the host and
+ *   replaced by a literal.
+ * - Common subexpression elimination: structurally identical subexpressions (up to the order of
+ *   the operands of commutative operators) become a single node, which is evaluated once per row
+ *   and kept in an intermediate until its last use.
+ * - Boolean simplification: logical operators with a literal operand, idempotent logical
+ *   operators and double negations are reduced to one of their operands.
  */
 class expression_parser {
  public:
@@ -114,20 +142,27 @@ class expression_parser {
    * @param expr The expression to create an evaluable expression_parser for.
    * @param left The left table used for evaluating the abstract syntax tree.
    * @param right The right table used for evaluating the abstract syntax tree.
+   * @param has_nulls Whether the expression may evaluate to null
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the plan and any folded literals
+   * @param optimize Whether to optimize the plan before it is generated
    */
   expression_parser(expression const& expr,
                     cudf::table_view const& left,
                     std::optional<std::reference_wrapper<cudf::table_view const>> right,
                     bool has_nulls,
                     rmm::cuda_stream_view stream,
-                    rmm::device_async_resource_ref mr)
+                    rmm::device_async_resource_ref mr,
+                    bool optimize = true)
     : _left{left},
       _right{right},
-      _expression_count{0},
       _intermediate_counter{},
-      _has_nulls(has_nulls)
+      _has_nulls(has_nulls),
+      _optimize(optimize),
+      _stream{stream},
+      _mr{mr}
   {
-    expr.accept(*this);
+    generate_plan(expr.accept(*this));
     move_to_device(stream, mr);
   }
 
@@ -136,13 +171,18 @@ class expression_parser {
    *
    * @param expr The expression to create an evaluable expression_parser for.
    * @param table The table used for evaluating the abstract syntax tree.
+   * @param has_nulls Whether the expression may evaluate to null
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the plan and any folded literals
+   * @param optimize Whether to optimize the plan before it is generated
    */
   expression_parser(expression const& expr,
                     cudf::table_view const& table,
                     bool has_nulls,
                     rmm::cuda_stream_view stream,
-                    rmm::device_async_resource_ref mr)
-    : expression_parser(expr, table, {}, has_nulls, stream, mr)
+                    rmm::device_async_resource_ref mr,
+                    bool optimize = true)
+    : expression_parser(expr, table, {}, has_nulls, stream, mr, optimize)
   {
   }
 
@@ -153,11 +193,18 @@ class expression_parser {
    */
   [[nodiscard]] cudf::data_type output_type() const;
 
+  /**
+   * @brief Get a host-side view of the generated plan.
+   *
+   * @return The plan, valid for the lifetime of this parser
+   */
+  [[nodiscard]] expression_host_view host_expression_data() const;
+
   /**
    * @brief Visit a literal expression.
    *
    * @param expr Literal expression.
-   * @return cudf::size_type Index of device data reference for the expression.
+   * @return cudf::size_type Index of the plan node for the expression.
    */
   cudf::size_type visit(literal const& expr);
 
@@ -165,7 +212,7 @@ class expression_parser {
    * @brief Visit a column reference expression.
    *
    * @param expr Column reference expression.
-   * @return cudf::size_type Index of device data reference for the expression.
+   * @return cudf::size_type Index of the plan node for the expression.
    */
   cudf::size_type visit(column_reference const& expr);
 
@@ -173,7 +220,7 @@ class expression_parser {
    * @brief Visit an expression expression.
    *
    * @param expr Expression expression.
-   * @return cudf::size_type Index of device data reference for the expression.
+   * @return cudf::size_type Index of the plan node for the expression.
    */
   cudf::size_type visit(operation const& expr);
 
@@ -181,7 +228,7 @@ class expression_parser {
    * @brief Visit a column name reference expression.
    *
    * @param expr Column name reference expression.
-   * @return cudf::size_type Index of device data reference for the expression.
+   * @return cudf::size_type Index of the plan node for the expression.
    */
   cudf::size_type visit(column_name_reference const& expr);
   /**
@@ -307,6 +354,26 @@ class expression_parser {
       device_expression_data.num_intermediates);
   }
 
+  /**
+   * @brief A node of the expression graph built by visiting the expression.
+   *
+   * Nodes refer to their operands by index, so with common subexpression elimination a node may
+   * be the operand of several others.
+   */
+  struct plan_node {
+    enum class node_type { LITERAL, COLUMN, OPERATION };
+    node_type type;
+    cudf::data_type data_type;
+    ast_operator op{ast_operator::IDENTITY};  ///< The operator of an OPERATION node
+    std::vector<cudf::size_type> operands{};  ///< The operand nodes of an OPERATION node
+    cudf::size_type index{};  ///< The literal index of a LITERAL or column index of a COLUMN node
+    table_reference table_source{table_reference::LEFT};  ///< The table of a COLUMN node
+  };
+
+  /// Key identifying structurally identical nodes: type, operator or table, and two operands or
+  /// indices
+  using plan_node_key = std::tuple<int, int, cudf::size_type, cudf::size_type>;
+
   /**
    * @brief Helper function for recursive traversal of expressions.
    *
@@ -318,11 +385,102 @@ class expression_parser {
    *
    * @param  operands  The operands to visit.
    *
-   * @return The indices of the operands stored in the data references.
+   * @return The indices of the plan nodes of the operands.
    */
   std::vector<cudf::size_type> visit_operands(
     cudf::host_span<std::reference_wrapper<cudf::ast::expression const> const> operands);
 
+  /**
+   * @brief Add a node to the expression graph.
+   *
+   * When optimizing, returns the index of an existing identical node instead.
+   *
+   * @param  node  The node to add.
+   *
+   * @return The index of the node.
+   */
+  cudf::size_type add_node(plan_node node);
+
+  /**
+   * @brief Add a literal node for a scalar.
+   *
+   * @param  value  The device view of the scalar.
+   * @param  scalar  The scalar, which must outlive this parser.
+   *
+   * @return The index of the node.
+   */
+  cudf::size_type add_literal(generic_scalar_device_view value, cudf::scalar const& scalar);
+
+  /**
+   * @brief Evaluate an operation on the host if all of its operands are valid literals.
+   *
+   * @param  op  The operator.
+   * @param  operands  The operand nodes.
+   * @param  data_type  The result type of the operation.
+   *
+   * @return The index of a literal node holding the result, or `std::nullopt` if the operation
+   * cannot be folded.
+   */
+  std::optional<cudf::size_type> fold_constants(ast_operator op,
+                                                std::vector<cudf::size_type> const& operands,
+                                                cudf::data_type data_type);
+
+  /**
+   * @brief Reduce a logical operation to one of its operands where that preserves its result,
+   * including null handling.
+   *
+   * @param  op  The operator.
+   * @param  operands  The operand nodes.
+   *
+   * @return The index of the node equivalent to the operation, or `std::nullopt`.
+   */
+  std::optional<cudf::size_type> simplify_boolean(ast_operator op,
+                                                  std::vector<cudf::size_type> const& operands);
+
+  /**
+   * @brief Get the value of a node if it is a valid boolean literal.
+   *
+   * @param  node  The node index.
+   *
+   * @return The value, or `std::nullopt` if the node is not a valid boolean literal.
+   */
+  std::optional<bool> boolean_literal_value(cudf::size_type node) const;
+
+  /**
+   * @brief Linearize the expression graph rooted at `root` into the plan vectors.
+   *
+   * Each node reachable from the root is emitted once, in depth-first order. The intermediate of
+   * an operation is given back once all of the operations that use it have been emitted.
+   *
+   * @param  root  The index of the root node.
+   */
+  void generate_plan(cudf::size_type root);
+
+  /**
+   * @brief Emit a node and, recursively, its operands.
+   *
+   * @param  node  The index of the node to emit.
+   * @param  is_root  Whether the node is the root, whose output is the output column.
+   * @param  remaining_uses  The number of not yet emitted uses of each node.
+   * @param  emitted  The data reference index of each node that has been emitted.
+   *
+   * @return The index of the data reference holding the node's value.
+   */
+  cudf::size_type emit(cudf::size_type node,
+                       bool is_root,
+                       std::vector<cudf::size_type>& remaining_uses,
+                       std::vector<std::optional<cudf::size_type>>& emitted);
+
+  /**
+   * @brief Emit an operation node after its operands.
+   *
+   * @copydetails emit
+   */
+  cudf::size_type emit_operation(plan_node const& node,
+                                 bool is_root,
+                                 std::vector<cudf::size_type>& remaining_uses,
+                                 std::vector<std::optional<cudf::size_type>>& emitted);
+
   /**
    * @brief Add a data reference to the internal list.
    *
@@ -338,9 +496,16 @@ class expression_parser {
 
   cudf::table_view const& _left;
   std::optional<std::reference_wrapper<cudf::table_view const>> _right;
-  cudf::size_type _expression_count;
   intermediate_counter _intermediate_counter;
   bool _has_nulls;
+  bool _optimize;
+  rmm::cuda_stream_view _stream;
+  rmm::device_async_resource_ref _mr;
+  std::vector<plan_node> _nodes;
+  std::map<plan_node_key, cudf::size_type> _node_lookup;
+  std::vector<generic_scalar_device_view> _literal_values;  ///< Indexed by LITERAL node index
+  std::vector<cudf::scalar const*> _literal_scalars;        ///< Indexed by LITERAL node index
+  std::vector<std::unique_ptr<cudf::scalar>> _folded_scalars;  ///< Owned results of folding
   std::vector<detail::device_data_reference> _data_references;
   std::vector<ast_operator> _operators;
   std::vector<cudf::size_type> _operator_arities;
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/ast/expressions.hpp>
+#include <cudf/interop.hpp>
+#include <cudf/utilities/default_stream.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <utility>
+
+struct ArrowSchema;
+struct ArrowArray;
+
+namespace CUDF_EXPORT cudf {
+namespace ast::detail {
+
+/**
+ * @brief Compute a new column by evaluating an expression tree on host Arrow data.
+ *
+ * This is the host counterpart of `cudf::compute_column` for small inputs, such as column
+ * statistics, where a round trip through device memory would dominate the cost of evaluating the
+ * expression. The expression is evaluated one operator at a time over whole columns using the
+ * same operator definitions and null semantics as the device evaluator.
+ *
+ * With `vectorized` set, operators that return null whenever an operand is null compute the null
+ * mask of their result 64 rows at a time and apply the operator to every row in a branch-free loop
+ * that the compiler vectorizes. Otherwise each row is evaluated on its own exactly as on the
+ * device, which serves as the reference implementation.
+ *
+ * Only fixed-width columns of numeric, boolean, timestamp and duration types are supported.
+ * Integer division and modulo by zero, which are undefined on the device, produce null instead of
+ * trapping.
+ *
+ * @throws std::invalid_argument if `schema` or `input` is null
+ * @throws cudf::data_type_error if `schema` is not a struct or a referenced column has an
+ * unsupported type
+ * @throws cudf::logic_error if the expression references the right table, uses column names or
+ * applies an operator to invalid types
+ *
+ * @param expr The expression to evaluate
+ * @param schema `ArrowSchema` of a struct whose children describe the columns of the table
+ * @param input Struct `ArrowArray` in host memory whose children are the columns of the table
+ * @param vectorized Whether to use the vectorized evaluation path
+ * @param stream CUDA stream used to read the values of literals
+ * @return The `ArrowSchema` of the result and the result as an `ArrowDeviceArray` on the CPU
+ */
+std::pair<unique_schema_t, unique_device_array_t> compute_column_host(
+  expression const& expr,
+  ArrowSchema const* schema,
+  ArrowArray const* input,
+  bool vectorized              = true,
+  rmm::cuda_stream_view stream = cudf::get_default_stream());
+
+}  // namespace ast::detail
+}  // namespace CUDF_EXPORT cudf
@@ -754,7 +754,12 @@ struct operator_functor<ast_operator::BIT_INVERT, false> {
   template <typename InputT>
   __device__ inline auto operator()(InputT input) const noexcept -> decltype(~input)
   {
-    return ~input;
+    // Promote booleans explicitly, since host compilers warn about `~` on a bool
+    if constexpr (cuda::std::is_same_v<InputT, bool>) {
+      return ~static_cast<int>(input);
+    } else {
+      return ~input;
+    }
   }
 };
 
@@ -317,6 +317,13 @@ class literal : public expression {
    */
   [[nodiscard]] generic_scalar_device_view get_value() const { return value; }
 
+  /**
+   * @brief Get the underlying scalar.
+   *
+   * @return The scalar this literal refers to
+   */
+  [[nodiscard]] cudf::scalar const& get_scalar() const { return scalar; }
+
   /**
    * @copydoc expression::accept
    */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023-2024, NVIDIA CORPORATION.
+ * Copyright (c) 2023-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -19,9 +19,17 @@
 #include <cudf/utilities/default_stream.hpp>
 #include <cudf/utilities/export.hpp>
 #include <cudf/utilities/memory_resource.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
 namespace CUDF_EXPORT cudf {
 namespace detail {
 
@@ -36,5 +44,108 @@ std::unique_ptr<table> make_timezone_transition_table(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = cudf::get_current_device_resource_ref());
 
+/**
+ * @brief Transition table of a timezone in host memory, for converting timestamps on the host.
+ *
+ * Gives the same UT offsets as the lookup of a device transition table in `get_ut_offset`. The
+ * file entries and the solar cycle entries are laid out on a single sorted timeline, with the
+ * cycle entries after the file entries, so that a timestamp is located by its position on the
+ * timeline alone. The timeline is divided into buckets of a power-of-two number of seconds, as
+ * wide as possible while each bucket holds at most `bucket_capacity` transitions, and each bucket
+ * holds the index of the last transition at or before its start. A lookup finds the bucket with a
+ * shift and compares the position with a fixed number of transitions, without a binary search and
+ * without branches, so that arrays of timestamps are converted in loops the compiler can
+ * vectorize. Positions before the first bucket or in the rare buckets with more transitions are
+ * searched for.
+ */
+class host_timezone_table {
+ public:
+  /**
+   * @brief Constructs a host table from the columns of a transition table.
+   *
+   * @throws cudf::logic_error if the entries do not form a transition table
+   *
+   * @param transition_times Transition times in seconds, in the layout of the first column of the
+   * table returned by `make_timezone_transition_table`; empty for UTC
+   * @param offsets UT offsets in seconds, in the layout of the second column of the table
+   */
+  host_timezone_table(host_span<int64_t const> transition_times, host_span<int64_t const> offsets);
+
+  /**
+   * @brief Returns the UT offset of a timestamp, in seconds.
+   *
+   * @param timestamp UTC timestamp in seconds
+   * @return Offset to add to the timestamp to get the local time
+   */
+  [[nodiscard]] int64_t ut_offset(int64_t timestamp) const;
+
+  /**
+   * @brief Converts UTC timestamps to local time.
+   *
+   * @throws cudf::logic_error if the output does not have the size of the input
+   *
+   * @param timestamps UTC timestamps in seconds
+   * @param output Local timestamps in seconds; may be the same as the input
+   */
+  void to_local(host_span<int64_t const> timestamps, host_span<int64_t> output) const;
+
+  /**
+   * @brief Converts local timestamps to UTC.
+   *
+   * The offset is looked up at the local time, and looked up again at the UTC time it gives.
+   * Converting back to local time gives the original timestamp, except for local times that are
+   * skipped by a transition.
+   *
+   * @throws cudf::logic_error if the output does not have the size of the input
+   *
+   * @param timestamps Local timestamps in seconds
+   * @param output UTC timestamps in seconds; may be the same as the input
+   */
+  void to_utc(host_span<int64_t const> timestamps, host_span<int64_t> output) const;
+
+ private:
+  /// Number of transitions a lookup compares a position with
+  static constexpr int32_t bucket_capacity = 4;
+  /// Widest bucket, about 34 years
+  static constexpr int32_t max_bucket_shift = 30;
+  /// Narrowest bucket, about 4.5 days
+  static constexpr int32_t min_bucket_shift = 18;
+  static constexpr int64_t max_bucket_count = 1 << 16;
+
+  void build_buckets();
+  [[nodiscard]] int32_t search(int64_t position) const;
+  void lookup_offsets(int64_t const* timestamps, std::size_t size, int32_t* offsets) const;
+
+  std::vector<int64_t> _times;    ///< Positions of the transitions, followed by padding
+  std::vector<int32_t> _offsets;  ///< UT offset from each transition on
+  /// Timestamps after the last file entry are projected into the cycle
+  int64_t _last_file_time{std::numeric_limits<int64_t>::max()};
+  int64_t _cycle_base{};               ///< Position of the start of the cycle on the timeline
+  int64_t _bucket_begin{};             ///< Position of the start of the first bucket
+  int32_t _bucket_shift{};             ///< Base 2 logarithm of the width of the buckets
+  std::vector<int32_t> _bucket_first;  ///< Last transition at or before the start of each bucket,
+                                       ///< or -1 if the bucket holds too many transitions
+};
+
+/**
+ * @brief Reads the TZif file of a timezone into a host transition table.
+ *
+ * @param tzif_dir The directory where the TZif files are located
+ * @param timezone_name Standard timezone name (for example, "America/Los_Angeles")
+ * @return The host transition table for the given timezone
+ */
+host_timezone_table make_host_timezone_table(std::optional<std::string_view> tzif_dir,
+                                             std::string_view timezone_name);
+
+/**
+ * @brief Reads the TZif files of a set of timezones into host transition tables in parallel.
+ *
+ * @param tzif_dir The directory where the TZif files are located
+ * @param timezone_names Standard timezone names
+ * @return The host transition tables, in the order of the names
+ */
+std::vector<host_timezone_table> make_host_timezone_tables(
+  std::optional<std::string_view> tzif_dir, host_span<std::string const> timezone_names);
+
 }  // namespace detail
 }  // namespace CUDF_EXPORT cudf
@@ -16,21 +16,218 @@
 #include <cudf/ast/detail/expression_parser.hpp>
 #include <cudf/ast/detail/operators.hpp>
 #include <cudf/ast/expressions.hpp>
+#include <cudf/scalar/scalar.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
 
 #include <thrust/iterator/transform_iterator.h>
 
 #include <algorithm>
+#include <cmath>
+#include <cstdlib>
 #include <functional>
 #include <iterator>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
 
 namespace cudf {
 
 namespace ast {
 
 namespace detail {
+namespace {
+
+/**
+ * @brief Returns true if the result of `op` does not depend on the order of its operands.
+ */
+bool is_commutative(ast_operator op)
+{
+  switch (op) {
+    case ast_operator::ADD:
+    case ast_operator::MUL:
+    case ast_operator::EQUAL:
+    case ast_operator::NULL_EQUAL:
+    case ast_operator::NOT_EQUAL:
+    case ast_operator::BITWISE_AND:
+    case ast_operator::BITWISE_OR:
+    case ast_operator::BITWISE_XOR:
+    case ast_operator::LOGICAL_AND:
+    case ast_operator::NULL_LOGICAL_AND:
+    case ast_operator::LOGICAL_OR:
+    case ast_operator::NULL_LOGICAL_OR: return true;
+    default: return false;
+  }
+}
+
+/**
+ * @brief The result of folding an operation: a scalar and its device view, or neither if the
+ * operation could not be folded.
+ */
+struct folded_literal {
+  std::unique_ptr<cudf::scalar> scalar;
+  std::optional<generic_scalar_device_view> value;
+};
+
+template <typename T>
+folded_literal make_folded_literal(T value,
+                                   rmm::cuda_stream_view stream,
+                                   rmm::device_async_resource_ref mr)
+{
+  auto scalar     = std::make_unique<cudf::numeric_scalar<T>>(value, true, stream, mr);
+  auto const view = generic_scalar_device_view{*scalar};
+  return folded_literal{std::move(scalar), view};
+}
+
+/**
+ * @brief Applies `f` to `lhs` and `rhs` as unsigned integers of the same width, so that integer
+ * overflow wraps around as it does on the device rather than being undefined on the host.
+ */
+template <typename Result, typename F>
+Result wrapping(Result lhs, Result rhs, F f)
+{
+  using Unsigned = std::make_unsigned_t<Result>;
+  return static_cast<Result>(f(static_cast<Unsigned>(lhs), static_cast<Unsigned>(rhs)));
+}
+
+/**
+ * @brief Evaluates operators on the host with the same semantics as `operator_functor`.
+ *
+ * Only operators whose host and device results are bit-identical are folded; in particular
+ * transcendental functions, whose accuracy differs between the host and device math libraries,
+ * and integer operations whose result is undefined (division by zero, overflowing division) are
+ * left to the device. Results whose type differs from the type of the operation are discarded by
+ * the caller.
+ */
+struct fold_constants_fn {
+  template <typename T>
+  folded_literal operator()(ast_operator op,
+                            std::vector<cudf::scalar const*> const& operands,
+                            rmm::cuda_stream_view stream,
+                            rmm::device_async_resource_ref mr) const
+  {
+    if constexpr (!std::is_arithmetic_v<T>) {
+      return folded_literal{};
+    } else {
+      auto const value = [&](std::size_t i) {
+        return static_cast<cudf::numeric_scalar<T> const*>(operands[i])->value(stream);
+      };
+      auto const make = [&](auto result) { return make_folded_literal(result, stream, mr); };
+      return operands.size() == 1 ? fold_unary(op, value(0), make)
+                                  : fold_binary(op, value(0), value(1), make);
+    }
+  }
+
+  template <typename T, typename Make>
+  static folded_literal fold_unary(ast_operator op, T input, Make const& make)
+  {
+    switch (op) {
+      case ast_operator::IDENTITY: return make(input);
+      case ast_operator::NOT: return make(!input);
+      case ast_operator::CAST_TO_FLOAT64: return make(static_cast<double>(input));
+      default: break;
+    }
+    if constexpr (std::is_integral_v<T>) {
+      switch (op) {
+        case ast_operator::BIT_INVERT:
+          if constexpr (std::is_same_v<T, bool>) {
+            return folded_literal{};
+          } else {
+            return make(~input);
+          }
+        case ast_operator::CAST_TO_INT64: return make(static_cast<int64_t>(input));
+        case ast_operator::CAST_TO_UINT64: return make(static_cast<uint64_t>(input));
+        case ast_operator::ABS:
+          if constexpr (std::is_signed_v<T>) {
+            if (input == std::numeric_limits<T>::min()) { return folded_literal{}; }
+            return make(std::abs(input));
+          } else {
+            return make(input);
+          }
+        default: return folded_literal{};
+      }
+    } else {
+      switch (op) {
+        case ast_operator::ABS: return make(std::abs(input));
+        case ast_operator::CEIL: return make(std::ceil(input));
+        case ast_operator::FLOOR: return make(std::floor(input));
+        default: return folded_literal{};
+      }
+    }
+  }
+
+  template <typename T, typename Make>
+  static folded_literal fold_binary(ast_operator op, T lhs, T rhs, Make const& make)
+  {
+    // The type of the built-in arithmetic operators after integral promotion
+    using Result = decltype(lhs + rhs);
+
+    auto const arithmetic = [&](auto f) {
+      if constexpr (std::is_integral_v<T>) {
+        return make(wrapping<Result>(lhs, rhs, f));
+      } else {
+        return make(f(lhs, rhs));
+      }
+    };
+    auto const is_defined_division = [&]() {
+      if constexpr (std::is_integral_v<T>) {
+        if (rhs == 0) { return false; }
+        if constexpr (std::is_signed_v<T>) {
+          return !(lhs == std::numeric_limits<T>::min() && rhs == T{-1});
+        }
+      }
+      return true;
+    }();
+
+    switch (op) {
+      case ast_operator::ADD: return arithmetic(std::plus<>{});
+      case ast_operator::SUB: return arithmetic(std::minus<>{});
+      case ast_operator::MUL: return arithmetic(std::multiplies<>{});
+      case ast_operator::DIV:
+        if (!is_defined_division) { return folded_literal{}; }
+        return make(static_cast<Result>(lhs) / static_cast<Result>(rhs));
+      case ast_operator::TRUE_DIV:
+        return make(static_cast<double>(lhs) / static_cast<double>(rhs));
+      case ast_operator::FLOOR_DIV:
+        return make(std::floor(static_cast<double>(lhs) / static_cast<double>(rhs)));
+      case ast_operator::EQUAL:
+      case ast_operator::NULL_EQUAL: return make(lhs == rhs);
+      case ast_operator::NOT_EQUAL: return make(lhs != rhs);
+      case ast_operator::LESS: return make(lhs < rhs);
+      case ast_operator::GREATER: return make(lhs > rhs);
+      case ast_operator::LESS_EQUAL: return make(lhs <= rhs);
+      case ast_operator::GREATER_EQUAL: return make(lhs >= rhs);
+      case ast_operator::LOGICAL_AND:
+      case ast_operator::NULL_LOGICAL_AND: return make(lhs && rhs);
+      case ast_operator::LOGICAL_OR:
+      case ast_operator::NULL_LOGICAL_OR: return make(lhs || rhs);
+      default: break;
+    }
+    if constexpr (std::is_integral_v<T>) {
+      switch (op) {
+        case ast_operator::MOD:
+          if (!is_defined_division) { return folded_literal{}; }
+          return make(lhs % rhs);
+        case ast_operator::BITWISE_AND: return make(lhs & rhs);
+        case ast_operator::BITWISE_OR: return make(lhs | rhs);
+        case ast_operator::BITWISE_XOR: return make(lhs ^ rhs);
+        default: return folded_literal{};
+      }
+    } else {
+      switch (op) {
+        case ast_operator::MOD: return make(std::fmod(lhs, rhs));
+        case ast_operator::PYMOD: return make(std::fmod(std::fmod(lhs, rhs) + rhs, rhs));
+        default: return folded_literal{};
+      }
+    }
+  }
+};
+
+}  // namespace
 
 device_data_reference::device_data_reference(device_data_reference_type reference_type,
                                              cudf::data_type data_type,
@@ -82,62 +279,40 @@ cudf::size_type expression_parser::intermediate_counter::find_first_missing() co
 
 cudf::size_type expression_parser::visit(literal const& expr)
 {
-  if (_expression_count == 0) {
-    // Handle the trivial case of a literal as the entire expression.
-    return visit(operation(ast_operator::IDENTITY, expr));
-  } else {
-    _expression_count++;                                           // Increment the expression index
-    auto const data_type     = expr.get_data_type();               // Resolve expression type
-    auto device_view         = expr.get_value();                   // Construct a scalar device view
-    auto const literal_index = cudf::size_type(_literals.size());  // Push literal
-    _literals.push_back(device_view);
-    auto const source = detail::device_data_reference(detail::device_data_reference_type::LITERAL,
-                                                      data_type,
-                                                      literal_index);  // Push data reference
-    return add_data_reference(source);
-  }
+  return add_literal(expr.get_value(), expr.get_scalar());
 }
 
 cudf::size_type expression_parser::visit(column_reference const& expr)
 {
-  if (_expression_count == 0) {
-    // Handle the trivial case of a column reference as the entire expression.
-    return visit(operation(ast_operator::IDENTITY, expr));
+  // Resolve expression type
+  cudf::data_type data_type;
+  if (expr.get_table_source() == table_reference::LEFT) {
+    data_type = expr.get_data_type(_left);
   } else {
-    // Increment the expression index
-    _expression_count++;
-    // Resolve expression type
-    cudf::data_type data_type;
-    if (expr.get_table_source() == table_reference::LEFT) {
-      data_type = expr.get_data_type(_left);
+    if (_right.has_value()) {
+      data_type = expr.get_data_type(*_right);
     } else {
-      if (_right.has_value()) {
-        data_type = expr.get_data_type(*_right);
-      } else {
-        CUDF_FAIL(
-          "Your expression contains a reference to the RIGHT table even though it will only be "
-          "evaluated on a single table (by convention, the LEFT table).");
-      }
+      CUDF_FAIL(
+        "Your expression contains a reference to the RIGHT table even though it will only be "
+        "evaluated on a single table (by convention, the LEFT table).");
     }
-    // Push data reference
-    auto const source = detail::device_data_reference(detail::device_data_reference_type::COLUMN,
-                                                      data_type,
-                                                      expr.get_column_index(),
-                                                      expr.get_table_source());
-    return add_data_reference(source);
   }
+  return add_node(plan_node{plan_node::node_type::COLUMN,
+                            data_type,
+                            ast_operator::IDENTITY,
+                            {},
+                            expr.get_column_index(),
+                            expr.get_table_source()});
 }
 
 cudf::size_type expression_parser::visit(operation const& expr)
 {
-  // Increment the expression index
-  auto const expression_index = _expression_count++;
   // Visit children (operands) of this expression
-  auto const operand_data_ref_indices = visit_operands(expr.get_operands());
+  auto const operands = visit_operands(expr.get_operands());
   // Resolve operand types
-  auto data_ref = [this](auto const& index) { return _data_references[index].data_type; };
-  auto begin    = thrust::make_transform_iterator(operand_data_ref_indices.cbegin(), data_ref);
-  auto end      = begin + operand_data_ref_indices.size();
+  auto node_data_type = [this](auto const& index) { return _nodes[index].data_type; };
+  auto begin          = thrust::make_transform_iterator(operands.cbegin(), node_data_type);
+  auto end            = begin + operands.size();
   auto const operand_types = std::vector<cudf::data_type>(begin, end);
 
   // Validate types of operand data references match
@@ -146,49 +321,15 @@ cudf::size_type expression_parser::visit(operation const& expr)
     CUDF_FAIL("An AST expression was provided non-matching operand types.");
   }
 
-  // Give back intermediate storage locations that are consumed by this operation
-  std::for_each(
-    operand_data_ref_indices.cbegin(),
-    operand_data_ref_indices.cend(),
-    [this](auto const& data_reference_index) {
-      auto const operand_source = _data_references[data_reference_index];
-      if (operand_source.reference_type == detail::device_data_reference_type::INTERMEDIATE) {
-        auto const intermediate_index = operand_source.data_index;
-        _intermediate_counter.give(intermediate_index);
-      }
-    });
   // Resolve expression type
   auto const op        = expr.get_operator();
   auto const data_type = cudf::ast::detail::ast_operator_return_type(op, operand_types);
-  _operators.push_back(op);
-  _operator_arities.push_back(cudf::ast::detail::ast_operator_arity(op));
-  // Push data reference
-  auto const output = [&]() {
-    if (expression_index == 0) {
-      // This expression is the root. Output should be directed to the output column.
-      return detail::device_data_reference(
-        detail::device_data_reference_type::COLUMN, data_type, 0, table_reference::OUTPUT);
-    } else {
-      // This expression is not the root. Output is an intermediate value.
-      // Ensure that the output type is fixed width and fits in the intermediate storage.
-      if (!cudf::is_fixed_width(data_type)) {
-        CUDF_FAIL(
-          "The output data type is not a fixed-width type but must be stored in an intermediate.");
-      } else if (cudf::size_of(data_type) > (_has_nulls ? sizeof(IntermediateDataType<true>)
-                                                        : sizeof(IntermediateDataType<false>))) {
-        CUDF_FAIL("The output data type is too large to be stored in an intermediate.");
-      }
-      return detail::device_data_reference(
-        detail::device_data_reference_type::INTERMEDIATE, data_type, _intermediate_counter.take());
-    }
-  }();
-  auto const index = add_data_reference(output);
-  // Insert source indices from all operands (sources) and this operator (destination)
-  _operator_source_indices.insert(_operator_source_indices.end(),
-                                  operand_data_ref_indices.cbegin(),
-                                  operand_data_ref_indices.cend());
-  _operator_source_indices.push_back(index);
-  return index;
+
+  if (_optimize) {
+    if (auto const folded = fold_constants(op, operands, data_type)) { return *folded; }
+    if (auto const simplified = simplify_boolean(op, operands)) { return *simplified; }
+  }
+  return add_node(plan_node{plan_node::node_type::OPERATION, data_type, op, operands});
 }
 
 // TODO: Eliminate column name references from expression_parser because
@@ -207,15 +348,269 @@ cudf::data_type expression_parser::output_type() const
                                   : _data_references.back().data_type;
 }
 
+expression_host_view expression_parser::host_expression_data() const
+{
+  return expression_host_view{_data_references,
+                              _literals,
+                              _operators,
+                              _operator_arities,
+                              _operator_source_indices,
+                              _intermediate_counter.get_max_used()};
+}
+
 std::vector<cudf::size_type> expression_parser::visit_operands(
   cudf::host_span<std::reference_wrapper<expression const> const> operands)
 {
-  auto operand_data_reference_indices = std::vector<cudf::size_type>();
+  auto operand_node_indices = std::vector<cudf::size_type>();
   for (auto const& operand : operands) {
-    auto const operand_data_reference_index = operand.get().accept(*this);
-    operand_data_reference_indices.push_back(operand_data_reference_index);
+    auto const operand_node_index = operand.get().accept(*this);
+    operand_node_indices.push_back(operand_node_index);
   }
-  return operand_data_reference_indices;
+  return operand_node_indices;
+}
+
+cudf::size_type expression_parser::add_node(plan_node node)
+{
+  if (_optimize) {
+    // Order the operands of commutative operators so that e.g. `a * b` and `b * a` are identical
+    if (node.operands.size() == 2 && is_commutative(node.op) &&
+        node.operands[1] < node.operands[0]) {
+      std::swap(node.operands[0], node.operands[1]);
+    }
+    auto const key = [&]() -> plan_node_key {
+      switch (node.type) {
+        case plan_node::node_type::LITERAL:
+          return {static_cast<int>(node.type), 0, node.index, 0};
+        case plan_node::node_type::COLUMN:
+          return {static_cast<int>(node.type),
+                  static_cast<int>(node.table_source),
+                  node.index,
+                  0};
+        default:
+          return {static_cast<int>(node.type),
+                  static_cast<int>(node.op),
+                  node.operands[0],
+                  node.operands.size() > 1 ? node.operands[1] : -1};
+      }
+    }();
+    // If an identical node already exists, return its index.
+    auto const [it, inserted] =
+      _node_lookup.try_emplace(key, static_cast<cudf::size_type>(_nodes.size()));
+    if (!inserted) { return it->second; }
+  }
+  _nodes.push_back(std::move(node));
+  return _nodes.size() - 1;
+}
+
+cudf::size_type expression_parser::add_literal(generic_scalar_device_view value,
+                                               cudf::scalar const& scalar)
+{
+  // The same scalar may be referenced by several literal expressions
+  auto const it    = std::find(_literal_scalars.cbegin(), _literal_scalars.cend(), &scalar);
+  auto const index = [&]() {
+    if (_optimize && it != _literal_scalars.cend()) {
+      return static_cast<cudf::size_type>(std::distance(_literal_scalars.cbegin(), it));
+    }
+    _literal_values.push_back(value);
+    _literal_scalars.push_back(&scalar);
+    return static_cast<cudf::size_type>(_literal_scalars.size() - 1);
+  }();
+  return add_node(
+    plan_node{plan_node::node_type::LITERAL, value.type(), ast_operator::IDENTITY, {}, index});
+}
+
+std::optional<cudf::size_type> expression_parser::fold_constants(
+  ast_operator op, std::vector<cudf::size_type> const& operands, cudf::data_type data_type)
+{
+  auto const is_literal = [this](auto index) {
+    return _nodes[index].type == plan_node::node_type::LITERAL;
+  };
+  if (!std::all_of(operands.cbegin(), operands.cend(), is_literal)) { return std::nullopt; }
+
+  auto scalars = std::vector<cudf::scalar const*>();
+  for (auto const index : operands) {
+    scalars.push_back(_literal_scalars[_nodes[index].index]);
+  }
+
+  auto folded = [&]() {
+    if (op == ast_operator::IS_NULL) {
+      return make_folded_literal(!scalars.front()->is_valid(_stream), _stream, _mr);
+    }
+    // Operations on nulls are left to the device, which implements the null semantics of each
+    // operator.
+    auto const is_valid = [this](auto const* scalar) { return scalar->is_valid(_stream); };
+    if (!std::all_of(scalars.cbegin(), scalars.cend(), is_valid)) { return folded_literal{}; }
+    return cudf::type_dispatcher(
+      scalars.front()->type(), fold_constants_fn{}, op, scalars, _stream, _mr);
+  }();
+  if (!folded.value.has_value() || folded.scalar->type() != data_type) { return std::nullopt; }
+
+  auto const& scalar = *folded.scalar;
+  _folded_scalars.push_back(std::move(folded.scalar));
+  return add_literal(*folded.value, scalar);
+}
+
+std::optional<cudf::size_type> expression_parser::simplify_boolean(
+  ast_operator op, std::vector<cudf::size_type> const& operands)
+{
+  auto const is_boolean = [this](auto index) {
+    return _nodes[index].data_type.id() == cudf::type_id::BOOL8;
+  };
+
+  if (op == ast_operator::NOT) {
+    // NOT(NOT(x)) is x
+    auto const& operand = _nodes[operands.front()];
+    if (operand.type == plan_node::node_type::OPERATION && operand.op == ast_operator::NOT &&
+        is_boolean(operand.operands.front())) {
+      return operand.operands.front();
+    }
+    return std::nullopt;
+  }
+
+  auto const is_and = op == ast_operator::LOGICAL_AND || op == ast_operator::NULL_LOGICAL_AND;
+  auto const is_or  = op == ast_operator::LOGICAL_OR || op == ast_operator::NULL_LOGICAL_OR;
+  if (!(is_and || is_or) || !is_boolean(operands.front())) { return std::nullopt; }
+
+  // x AND x and x OR x are x, including when x is null
+  if (operands[0] == operands[1]) { return operands[0]; }
+
+  auto const null_aware =
+    op == ast_operator::NULL_LOGICAL_AND || op == ast_operator::NULL_LOGICAL_OR;
+  for (std::size_t i = 0; i < operands.size(); ++i) {
+    auto const value = boolean_literal_value(operands[i]);
+    if (!value.has_value()) { continue; }
+    // true is the identity of AND and false is the identity of OR
+    if (*value == is_and) { return operands[1 - i]; }
+    // false annihilates AND and true annihilates OR, except where a null operand makes the
+    // result null
+    if (null_aware || !_has_nulls) { return operands[i]; }
+  }
+  return std::nullopt;
+}
+
+std::optional<bool> expression_parser::boolean_literal_value(cudf::size_type node) const
+{
+  auto const& literal_node = _nodes[node];
+  if (literal_node.type != plan_node::node_type::LITERAL ||
+      literal_node.data_type.id() != cudf::type_id::BOOL8) {
+    return std::nullopt;
+  }
+  auto const* scalar = _literal_scalars[literal_node.index];
+  if (!scalar->is_valid(_stream)) { return std::nullopt; }
+  return static_cast<cudf::numeric_scalar<bool> const*>(scalar)->value(_stream);
+}
+
+void expression_parser::generate_plan(cudf::size_type root)
+{
+  // The last operator of a plan writes to the output column, so a root that is a literal or a
+  // column reference is wrapped in an identity operation.
+  if (_nodes[root].type != plan_node::node_type::OPERATION) {
+    auto const data_type =
+      cudf::ast::detail::ast_operator_return_type(ast_operator::IDENTITY, {_nodes[root].data_type});
+    root = add_node(
+      plan_node{plan_node::node_type::OPERATION, data_type, ast_operator::IDENTITY, {root}});
+  }
+
+  // Count the uses of each node by the operations reachable from the root
+  auto remaining_uses = std::vector<cudf::size_type>(_nodes.size(), 0);
+  auto visited        = std::vector<bool>(_nodes.size(), false);
+  auto pending        = std::vector<cudf::size_type>{root};
+  visited[root]       = true;
+  while (!pending.empty()) {
+    auto const node = pending.back();
+    pending.pop_back();
+    for (auto const operand : _nodes[node].operands) {
+      ++remaining_uses[operand];
+      if (!visited[operand]) {
+        visited[operand] = true;
+        pending.push_back(operand);
+      }
+    }
+  }
+
+  auto emitted = std::vector<std::optional<cudf::size_type>>(_nodes.size());
+  emit(root, true, remaining_uses, emitted);
+}
+
+cudf::size_type expression_parser::emit(cudf::size_type node,
+                                        bool is_root,
+                                        std::vector<cudf::size_type>& remaining_uses,
+                                        std::vector<std::optional<cudf::size_type>>& emitted)
+{
+  if (emitted[node].has_value()) { return *emitted[node]; }
+  auto const& plan = _nodes[node];
+
+  auto const index = [&]() {
+    switch (plan.type) {
+      case plan_node::node_type::LITERAL: {
+        auto const literal_index = cudf::size_type(_literals.size());  // Push literal
+        _literals.push_back(_literal_values[plan.index]);
+        return add_data_reference(detail::device_data_reference(
+          detail::device_data_reference_type::LITERAL, plan.data_type, literal_index));
+      }
+      case plan_node::node_type::COLUMN:
+        return add_data_reference(
+          detail::device_data_reference(detail::device_data_reference_type::COLUMN,
+                                        plan.data_type,
+                                        plan.index,
+                                        plan.table_source));
+      default: return emit_operation(plan, is_root, remaining_uses, emitted);
+    }
+  }();
+  emitted[node] = index;
+  return index;
+}
+
+cudf::size_type expression_parser::emit_operation(
+  plan_node const& plan,
+  bool is_root,
+  std::vector<cudf::size_type>& remaining_uses,
+  std::vector<std::optional<cudf::size_type>>& emitted)
+{
+  // Emit the operands of this operation
+  auto sources = std::vector<cudf::size_type>();
+  for (auto const operand : plan.operands) {
+    sources.push_back(emit(operand, false, remaining_uses, emitted));
+  }
+
+  // Give back intermediate storage locations whose last use is this operation
+  for (std::size_t i = 0; i < plan.operands.size(); ++i) {
+    auto const operand_source = _data_references[sources[i]];
+    if (--remaining_uses[plan.operands[i]] == 0 &&
+        operand_source.reference_type == detail::device_data_reference_type::INTERMEDIATE) {
+      _intermediate_counter.give(operand_source.data_index);
+    }
+  }
+
+  auto const data_type = plan.data_type;
+  _operators.push_back(plan.op);
+  _operator_arities.push_back(cudf::ast::detail::ast_operator_arity(plan.op));
+  // Push data reference
+  auto const output = [&]() {
+    if (is_root) {
+      // This expression is the root. Output should be directed to the output column.
+      return detail::device_data_reference(
+        detail::device_data_reference_type::COLUMN, data_type, 0, table_reference::OUTPUT);
+    } else {
+      // This expression is not the root. Output is an intermediate value.
+      // Ensure that the output type is fixed width and fits in the intermediate storage.
+      if (!cudf::is_fixed_width(data_type)) {
+        CUDF_FAIL(
+          "The output data type is not a fixed-width type but must be stored in an intermediate.");
+      } else if (cudf::size_of(data_type) > (_has_nulls ? sizeof(IntermediateDataType<true>)
+                                                        : sizeof(IntermediateDataType<false>))) {
+        CUDF_FAIL("The output data type is too large to be stored in an intermediate.");
+      }
+      return detail::device_data_reference(
+        detail::device_data_reference_type::INTERMEDIATE, data_type, _intermediate_counter.take());
+    }
+  }();
+  auto const index = add_data_reference(output);
+  // Insert source indices from all operands (sources) and this operator (destination)
+  _operator_source_indices.insert(
+    _operator_source_indices.end(), sources.cbegin(), sources.cend());
+  _operator_source_indices.push_back(index);
+  return index;
 }
 
 cudf::size_type expression_parser::add_data_reference(detail::device_data_reference data_ref)
@@ -0,0 +1,694 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "interop/arrow_utilities.hpp"
+
+#include <cudf/ast/detail/expression_transformer.hpp>
+#include <cudf/ast/detail/host_evaluator.hpp>
+#include <cudf/ast/detail/operators.cuh>
+#include <cudf/ast/expressions.hpp>
+#include <cudf/interop.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <cuda/std/optional>
+#include <cuda/std/type_traits>
+#include <nanoarrow/nanoarrow.h>
+#include <nanoarrow/nanoarrow.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace ast {
+namespace detail {
+namespace {
+
+constexpr int64_t bits_per_word = 64;
+
+constexpr int64_t num_words(int64_t num_bits)
+{
+  return (num_bits + bits_per_word - 1) / bits_per_word;
+}
+
+/**
+ * @brief A column of operands or results of the host evaluator.
+ *
+ * Literals are stored as columns of a single row that are broadcast to every row of the table.
+ * Data is either borrowed from the input `ArrowArray` or owned by the column, and booleans are
+ * always unpacked to one byte per row. The null mask is empty if every row is valid, and its bits
+ * past the last row are always zero.
+ */
+struct host_column {
+  cudf::data_type type{cudf::type_id::EMPTY};
+  int64_t size{};
+  bool is_scalar{};
+  void const* data{};
+  std::vector<uint64_t> null_mask;
+  std::vector<uint64_t> storage;
+
+  host_column() = default;
+  host_column(host_column const&)            = delete;
+  host_column& operator=(host_column const&) = delete;
+  host_column(host_column&&)                 = default;
+  host_column& operator=(host_column&&)      = default;
+
+  /// Allocates owned storage for `num_elements` values of type `T` and returns a pointer to it
+  template <typename T>
+  T* allocate(int64_t num_elements)
+  {
+    storage.resize((num_elements * sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t));
+    data = storage.data();
+    return reinterpret_cast<T*>(storage.data());
+  }
+
+  template <typename T>
+  [[nodiscard]] T const* begin() const
+  {
+    return static_cast<T const*>(data);
+  }
+
+  template <typename T>
+  [[nodiscard]] T element(int64_t row) const
+  {
+    return begin<T>()[is_scalar ? 0 : row];
+  }
+
+  [[nodiscard]] bool nullable() const { return !null_mask.empty(); }
+
+  [[nodiscard]] bool is_valid(int64_t row) const
+  {
+    if (null_mask.empty()) { return true; }
+    auto const bit = is_scalar ? 0 : row;
+    return (null_mask[bit / bits_per_word] >> (bit % bits_per_word)) & 1;
+  }
+};
+
+using host_column_ptr = std::shared_ptr<host_column const>;
+
+/**
+ * @brief Copies `size` bits starting at bit `offset` of `bits` into 64-bit words.
+ */
+std::vector<uint64_t> copy_bits(uint8_t const* bits, int64_t offset, int64_t size)
+{
+  auto words           = std::vector<uint64_t>(num_words(size));
+  auto const out_bytes = reinterpret_cast<uint8_t*>(words.data());
+  auto const first     = bits + offset / 8;
+  auto const shift     = offset % 8;
+  auto const num_bytes = (shift + size + 7) / 8;
+  for (int64_t i = 0; i < (size + 7) / 8; ++i) {
+    auto const lo = static_cast<unsigned>(first[i]) >> shift;
+    auto const hi =
+      (shift != 0 && i + 1 < num_bytes) ? static_cast<unsigned>(first[i + 1]) << (8 - shift) : 0u;
+    out_bytes[i]  = static_cast<uint8_t>(lo | hi);
+  }
+  if (size % bits_per_word != 0) { words.back() &= (uint64_t{1} << (size % bits_per_word)) - 1; }
+  return words;
+}
+
+/**
+ * @brief Integer division and modulo are undefined for a zero divisor and overflow for the
+ * smallest signed value divided by -1. The device produces an unspecified value, but the host
+ * would trap, so these rows are null in the result of the host evaluator.
+ */
+template <ast_operator op, typename T>
+constexpr bool may_trap =
+  (op == ast_operator::DIV || op == ast_operator::MOD || op == ast_operator::PYMOD) &&
+  !std::is_floating_point_v<T>;
+
+template <typename T>
+bool traps(T lhs, T rhs)
+{
+  if constexpr (cudf::is_duration<T>()) {
+    return traps(lhs.count(), rhs.count());
+  } else {
+    if (rhs == T{0}) { return true; }
+    // Narrower types are promoted to int, for which the quotient is representable
+    if constexpr (std::is_signed_v<T> && sizeof(T) >= sizeof(int)) {
+      return lhs == std::numeric_limits<T>::min() && rhs == T{-1};
+    }
+    return false;
+  }
+}
+
+/**
+ * @brief Returns true if the result of `op` is null exactly when any of its operands is null.
+ */
+bool propagates_nulls(ast_operator op)
+{
+  switch (op) {
+    case ast_operator::IS_NULL:
+    case ast_operator::NULL_EQUAL:
+    case ast_operator::NULL_LOGICAL_AND:
+    case ast_operator::NULL_LOGICAL_OR: return false;
+    default: return true;
+  }
+}
+
+/**
+ * @brief Returns the null mask of a result whose rows are null if a row of any operand is null.
+ */
+std::vector<uint64_t> propagate_null_masks(std::vector<host_column const*> const& operands,
+                                           int64_t size)
+{
+  std::vector<uint64_t> result;
+  for (auto const& operand : operands) {
+    if (!operand->nullable()) { continue; }
+    if (operand->is_scalar) {
+      // A null literal makes every row null
+      if (!operand->is_valid(0)) { return std::vector<uint64_t>(num_words(size), 0); }
+      continue;
+    }
+    if (result.empty()) {
+      result = operand->null_mask;
+    } else {
+      std::transform(result.begin(),
+                     result.end(),
+                     operand->null_mask.begin(),
+                     result.begin(),
+                     std::bit_and<>{});
+    }
+  }
+  return result;
+}
+
+/**
+ * @brief Returns the null mask with every one of `size` rows valid.
+ */
+std::vector<uint64_t> all_valid_mask(int64_t size)
+{
+  auto mask = std::vector<uint64_t>(num_words(size), ~uint64_t{0});
+  if (size % bits_per_word != 0) { mask.back() = (uint64_t{1} << (size % bits_per_word)) - 1; }
+  return mask;
+}
+
+/**
+ * @brief Applies `Op` to every row of the operands.
+ *
+ * Null rows are computed as well and masked out by the caller, which leaves a loop without
+ * branches that the compiler vectorizes. Whether each operand is a broadcast literal is a template
+ * parameter so that the inner loop only contains unit-stride loads.
+ */
+template <typename Op, typename Out, typename T, bool lhs_scalar, bool rhs_scalar>
+void transform_rows(T const* lhs, T const* rhs, Out* out, int64_t size)
+{
+  for (int64_t i = 0; i < size; ++i) {
+    out[i] = Op{}(lhs[lhs_scalar ? 0 : i], rhs[rhs_scalar ? 0 : i]);
+  }
+}
+
+template <typename Op, typename Out, typename T>
+void transform_rows(T const* input, Out* out, int64_t size)
+{
+  for (int64_t i = 0; i < size; ++i) {
+    out[i] = Op{}(input[i]);
+  }
+}
+
+/**
+ * @brief Evaluates a binary operator.
+ *
+ * The vectorized path combines the null masks of the operands a word at a time and applies the
+ * non-nullable operator to every row. The reference path applies the nullable operator to each
+ * row exactly as the device evaluator does, and is always used for operators with their own null
+ * semantics.
+ */
+struct binary_fn {
+  template <typename T, ast_operator op>
+  void operator()(host_column const& lhs,
+                  host_column const& rhs,
+                  int64_t size,
+                  bool vectorized,
+                  host_column& out) const
+    requires(is_valid_binary_op<operator_functor<op, false>, T, T> && is_rep_layout_compatible<T>())
+  {
+    using Op  = operator_functor<op, false>;
+    using Out = cuda::std::invoke_result_t<Op, T, T>;
+
+    out.type      = cudf::data_type{cudf::type_to_id<Out>()};
+    out.size      = size;
+    out.is_scalar = lhs.is_scalar && rhs.is_scalar;
+    auto* data    = out.allocate<Out>(size);
+
+    if (vectorized && propagates_nulls(op)) {
+      out.null_mask = propagate_null_masks({&lhs, &rhs}, size);
+      if constexpr (may_trap<op, T>) {
+        evaluate_trapping<Op, Out, T>(lhs, rhs, size, data, out.null_mask);
+      } else if (lhs.is_scalar && !rhs.is_scalar) {
+        transform_rows<Op, Out, T, true, false>(lhs.begin<T>(), rhs.begin<T>(), data, size);
+      } else if (!lhs.is_scalar && rhs.is_scalar) {
+        transform_rows<Op, Out, T, false, true>(lhs.begin<T>(), rhs.begin<T>(), data, size);
+      } else {
+        transform_rows<Op, Out, T, false, false>(lhs.begin<T>(), rhs.begin<T>(), data, size);
+      }
+      return;
+    }
+
+    using NullableOp = operator_functor<op, true>;
+    out.null_mask    = std::vector<uint64_t>(num_words(size), 0);
+    for (int64_t i = 0; i < size; ++i) {
+      auto const l = lhs.is_valid(i) ? cuda::std::optional<T>{lhs.element<T>(i)}
+                                     : cuda::std::optional<T>{};
+      auto const r = rhs.is_valid(i) ? cuda::std::optional<T>{rhs.element<T>(i)}
+                                     : cuda::std::optional<T>{};
+      if constexpr (may_trap<op, T>) {
+        if (l.has_value() && r.has_value() && traps(*l, *r)) { continue; }
+      }
+      auto const result = NullableOp{}(l, r);
+      if (result.has_value()) {
+        data[i] = *result;
+        out.null_mask[i / bits_per_word] |= uint64_t{1} << (i % bits_per_word);
+      }
+    }
+  }
+
+  template <typename T, ast_operator op>
+  void operator()(host_column const&, host_column const&, int64_t, bool, host_column&) const
+    requires(!(is_valid_binary_op<operator_functor<op, false>, T, T> &&
+               is_rep_layout_compatible<T>()))
+  {
+    CUDF_FAIL("Invalid binary operation.");
+  }
+
+ private:
+  /// Applies `Op` to the valid rows of the operands, nullifying the rows that would trap
+  template <typename Op, typename Out, typename T>
+  static void evaluate_trapping(host_column const& lhs,
+                                host_column const& rhs,
+                                int64_t size,
+                                Out* data,
+                                std::vector<uint64_t>& null_mask)
+  {
+    if (null_mask.empty()) { null_mask = all_valid_mask(size); }
+    for (int64_t word = 0; word < num_words(size); ++word) {
+      auto const end = std::min(size, (word + 1) * bits_per_word);
+      for (auto i = word * bits_per_word; i < end; ++i) {
+        auto const bit = uint64_t{1} << (i % bits_per_word);
+        if (!(null_mask[word] & bit)) { continue; }
+        auto const l = lhs.element<T>(i);
+        auto const r = rhs.element<T>(i);
+        if (traps(l, r)) {
+          null_mask[word] &= ~bit;
+        } else {
+          data[i] = Op{}(l, r);
+        }
+      }
+    }
+  }
+};
+
+/**
+ * @brief Evaluates a unary operator. See `binary_fn` for the evaluation paths.
+ */
+struct unary_fn {
+  template <typename T, ast_operator op>
+  void operator()(host_column const& input, int64_t size, bool vectorized, host_column& out) const
+    requires(is_valid_unary_op<operator_functor<op, false>, T> && is_rep_layout_compatible<T>())
+  {
+    using Op  = operator_functor<op, false>;
+    using Out = cuda::std::invoke_result_t<Op, T>;
+
+    out.type      = cudf::data_type{cudf::type_to_id<Out>()};
+    out.is_scalar = input.is_scalar;
+    out.size      = input.is_scalar ? 1 : size;
+    auto* data    = out.allocate<Out>(out.size);
+
+    if (vectorized && propagates_nulls(op)) {
+      out.null_mask = input.null_mask;
+      transform_rows<Op, Out, T>(input.begin<T>(), data, out.size);
+      return;
+    }
+
+    using NullableOp = operator_functor<op, true>;
+    out.null_mask    = std::vector<uint64_t>(num_words(out.size), 0);
+    for (int64_t i = 0; i < out.size; ++i) {
+      auto const value  = input.is_valid(i) ? cuda::std::optional<T>{input.element<T>(i)}
+                                            : cuda::std::optional<T>{};
+      auto const result = NullableOp{}(value);
+      auto const valid  = [&] {
+        // IS_NULL is never null
+        if constexpr (std::is_same_v<std::remove_cv_t<decltype(result)>, bool>) {
+          data[i] = result;
+          return true;
+        } else {
+          if (result.has_value()) { data[i] = *result; }
+          return result.has_value();
+        }
+      }();
+      if (valid) { out.null_mask[i / bits_per_word] |= uint64_t{1} << (i % bits_per_word); }
+    }
+  }
+
+  template <typename T, ast_operator op>
+  void operator()(host_column const&, int64_t, bool, host_column&) const
+    requires(!(is_valid_unary_op<operator_functor<op, false>, T> && is_rep_layout_compatible<T>()))
+  {
+    CUDF_FAIL("Invalid unary operation.");
+  }
+};
+
+/**
+ * @brief Dispatches a runtime operator to `F::operator()<T, op>`.
+ */
+template <typename F>
+struct operator_dispatch_fn {
+  template <typename T, typename... Args>
+  void operator()(ast_operator op, Args&&... args) const
+  {
+    ast_operator_dispatcher(op, dispatch_op<T>{}, std::forward<Args>(args)...);
+  }
+
+ private:
+  template <typename T>
+  struct dispatch_op {
+    template <ast_operator op, typename... Args>
+    void operator()(Args&&... args) const
+    {
+      F{}.template operator()<T, op>(std::forward<Args>(args)...);
+    }
+  };
+};
+
+/**
+ * @brief Reads the value of a literal into a column of a single row.
+ */
+struct literal_fn {
+  template <typename T>
+  void operator()(cudf::scalar const& scalar, rmm::cuda_stream_view stream, host_column& out) const
+    requires(is_rep_layout_compatible<T>())
+  {
+    auto const& typed = static_cast<cudf::scalar_type_t<T> const&>(scalar);
+    out.type          = scalar.type();
+    out.size          = 1;
+    out.is_scalar     = true;
+
+    *out.allocate<T>(1) = typed.value(stream);
+    if (!typed.is_valid(stream)) { out.null_mask = {0}; }
+  }
+
+  template <typename T>
+  void operator()(cudf::scalar const&, rmm::cuda_stream_view, host_column&) const
+    requires(!is_rep_layout_compatible<T>())
+  {
+    CUDF_FAIL("Unsupported literal type for host evaluation", cudf::data_type_error);
+  }
+};
+
+/**
+ * @brief Evaluates an expression tree bottom up, one operator at a time over whole columns.
+ */
+class host_evaluator final : public expression_transformer {
+ public:
+  host_evaluator(ArrowSchema const* schema,
+                 ArrowArray const* input,
+                 bool vectorized,
+                 rmm::cuda_stream_view stream)
+    : _schema{schema},
+      _input{input},
+      _vectorized{vectorized},
+      _stream{stream},
+      _columns(input->n_children)
+  {
+  }
+
+  std::reference_wrapper<expression const> visit(literal const& expr) override
+  {
+    auto result = std::make_shared<host_column>();
+    type_dispatcher(expr.get_data_type(), literal_fn{}, expr.get_scalar(), _stream, *result);
+    _results.push_back(std::move(result));
+    return expr;
+  }
+
+  std::reference_wrapper<expression const> visit(column_reference const& expr) override
+  {
+    CUDF_EXPECTS(expr.get_table_source() == table_reference::LEFT,
+                 "Your expression contains a reference to the RIGHT table even though it will only "
+                 "be evaluated on a single table (by convention, the LEFT table).");
+    auto const index = expr.get_column_index();
+    CUDF_EXPECTS(index >= 0 && index < static_cast<cudf::size_type>(_columns.size()),
+                 "Column index out of range",
+                 std::out_of_range);
+    if (!_columns[index]) { _columns[index] = read_column(index); }
+    _results.push_back(_columns[index]);
+    return expr;
+  }
+
+  std::reference_wrapper<expression const> visit(operation const& expr) override
+  {
+    auto const& operands = expr.get_operands();
+    for (auto const& operand : operands) {
+      operand.get().accept(*this);
+    }
+    auto const first = _results.end() - operands.size();
+    auto const args  = std::vector<host_column_ptr>(first, _results.end());
+    _results.erase(first, _results.end());
+
+    CUDF_EXPECTS(std::all_of(args.begin(),
+                             args.end(),
+                             [&](auto const& arg) { return arg->type == args.front()->type; }),
+                 "An AST expression was provided non-matching operand types.");
+
+    auto const type = args.front()->type;
+    auto const op   = expr.get_operator();
+    auto result     = std::make_shared<host_column>();
+    if (args.size() == 1) {
+      type_dispatcher(
+        type, operator_dispatch_fn<unary_fn>{}, op, *args[0], num_rows(), _vectorized, *result);
+    } else {
+      type_dispatcher(type,
+                      operator_dispatch_fn<binary_fn>{},
+                      op,
+                      *args[0],
+                      *args[1],
+                      args[0]->is_scalar && args[1]->is_scalar ? 1 : num_rows(),
+                      _vectorized,
+                      *result);
+    }
+    _results.push_back(std::move(result));
+    return expr;
+  }
+
+  std::reference_wrapper<expression const> visit(column_name_reference const&) override
+  {
+    CUDF_FAIL("Column name references are not supported in the AST expression parser.");
+  }
+
+  [[nodiscard]] int64_t num_rows() const { return _input->length; }
+
+  /// Returns the result of the last expression visited
+  [[nodiscard]] host_column_ptr result() const { return _results.back(); }
+
+ private:
+  host_column_ptr read_column(cudf::size_type index) const
+  {
+    auto const* schema = _schema->children[index];
+    auto const* array  = _input->children[index];
+
+    ArrowSchemaView view;
+    NANOARROW_THROW_NOT_OK(ArrowSchemaViewInit(&view, schema, nullptr));
+    auto const type = cudf::detail::arrow_to_cudf_type(&view);
+    CUDF_EXPECTS(cudf::is_rep_layout_compatible(type),
+                 "Unsupported column type for host evaluation",
+                 cudf::data_type_error);
+
+    auto column       = std::make_shared<host_column>();
+    column->type      = type;
+    column->size      = num_rows();
+    auto const offset = _input->offset + array->offset;
+
+    auto const* validity =
+      static_cast<uint8_t const*>(array->buffers[cudf::detail::validity_buffer_idx]);
+    if (validity != nullptr && array->null_count != 0) {
+      column->null_mask = copy_bits(validity, offset, num_rows());
+    }
+
+    auto const* data = array->buffers[cudf::detail::fixed_width_data_buffer_idx];
+    if (type.id() == cudf::type_id::BOOL8) {
+      auto const* bits = static_cast<uint8_t const*>(data);
+      auto* values     = column->allocate<bool>(num_rows());
+      for (int64_t i = 0; i < num_rows(); ++i) {
+        values[i] = ArrowBitGet(bits, offset + i);
+      }
+    } else {
+      column->data = static_cast<uint8_t const*>(data) + offset * cudf::size_of(type);
+    }
+    return column;
+  }
+
+  ArrowSchema const* _schema;
+  ArrowArray const* _input;
+  bool _vectorized;
+  rmm::cuda_stream_view _stream;
+  std::vector<host_column_ptr> _columns;  ///< Input columns, read on first reference
+  std::vector<host_column_ptr> _results;  ///< Results of the operands of the current operation
+};
+
+int set_schema_type(ArrowSchema* out, cudf::type_id id)
+{
+  switch (id) {
+    case cudf::type_id::TIMESTAMP_SECONDS:
+      return ArrowSchemaSetTypeDateTime(
+        out, NANOARROW_TYPE_TIMESTAMP, NANOARROW_TIME_UNIT_SECOND, nullptr);
+    case cudf::type_id::TIMESTAMP_MILLISECONDS:
+      return ArrowSchemaSetTypeDateTime(
+        out, NANOARROW_TYPE_TIMESTAMP, NANOARROW_TIME_UNIT_MILLI, nullptr);
+    case cudf::type_id::TIMESTAMP_MICROSECONDS:
+      return ArrowSchemaSetTypeDateTime(
+        out, NANOARROW_TYPE_TIMESTAMP, NANOARROW_TIME_UNIT_MICRO, nullptr);
+    case cudf::type_id::TIMESTAMP_NANOSECONDS:
+      return ArrowSchemaSetTypeDateTime(
+        out, NANOARROW_TYPE_TIMESTAMP, NANOARROW_TIME_UNIT_NANO, nullptr);
+    case cudf::type_id::DURATION_SECONDS:
+      return ArrowSchemaSetTypeDateTime(
+        out, NANOARROW_TYPE_DURATION, NANOARROW_TIME_UNIT_SECOND, nullptr);
+    case cudf::type_id::DURATION_MILLISECONDS:
+      return ArrowSchemaSetTypeDateTime(
+        out, NANOARROW_TYPE_DURATION, NANOARROW_TIME_UNIT_MILLI, nullptr);
+    case cudf::type_id::DURATION_MICROSECONDS:
+      return ArrowSchemaSetTypeDateTime(
+        out, NANOARROW_TYPE_DURATION, NANOARROW_TIME_UNIT_MICRO, nullptr);
+    case cudf::type_id::DURATION_NANOSECONDS:
+      return ArrowSchemaSetTypeDateTime(
+        out, NANOARROW_TYPE_DURATION, NANOARROW_TIME_UNIT_NANO, nullptr);
+    default: return ArrowSchemaSetType(out, cudf::detail::id_to_arrow_type(id));
+  }
+}
+
+unique_schema_t make_schema(cudf::data_type type)
+{
+  nanoarrow::UniqueSchema schema;
+  ArrowSchemaInit(schema.get());
+  NANOARROW_THROW_NOT_OK(set_schema_type(schema.get(), type.id()));
+
+  unique_schema_t out(new ArrowSchema, [](ArrowSchema* schema) {
+    if (schema->release != nullptr) { ArrowSchemaRelease(schema); }
+    delete schema;
+  });
+  schema.move(out.get());
+  return out;
+}
+
+/**
+ * @brief Copies a result into an `ArrowArray` of `num_rows` rows, broadcasting a literal result.
+ */
+unique_device_array_t make_array(host_column const& column, int64_t num_rows)
+{
+  nanoarrow::UniqueArray array;
+  NANOARROW_THROW_NOT_OK(
+    ArrowArrayInitFromType(array.get(), cudf::detail::id_to_arrow_storage_type(column.type.id())));
+  array->length = num_rows;
+
+  auto const is_valid = [&](int64_t row) { return column.is_valid(column.is_scalar ? 0 : row); };
+  if (column.nullable()) {
+    auto* bitmap = ArrowArrayValidityBitmap(array.get());
+    NANOARROW_THROW_NOT_OK(ArrowBitmapResize(bitmap, num_rows, 0));
+    if (column.is_scalar) {
+      std::memset(bitmap->buffer.data, is_valid(0) ? 0xff : 0, bitmap->buffer.size_bytes);
+      array->null_count = is_valid(0) ? 0 : num_rows;
+    } else {
+      std::memcpy(bitmap->buffer.data, column.null_mask.data(), bitmap->buffer.size_bytes);
+      auto const valid_count =
+        std::transform_reduce(column.null_mask.begin(),
+                              column.null_mask.end(),
+                              int64_t{0},
+                              std::plus<>{},
+                              [](uint64_t word) { return std::popcount(word); });
+      array->null_count = num_rows - valid_count;
+    }
+  }
+
+  auto* buffer = ArrowArrayBuffer(array.get(), cudf::detail::fixed_width_data_buffer_idx);
+  if (column.type.id() == cudf::type_id::BOOL8) {
+    NANOARROW_THROW_NOT_OK(ArrowBufferResize(buffer, (num_rows + 7) / 8, 0));
+    std::memset(buffer->data, 0, buffer->size_bytes);
+    for (int64_t i = 0; i < num_rows; ++i) {
+      if (column.element<bool>(i)) { ArrowBitSet(buffer->data, i); }
+    }
+  } else {
+    auto const element_size = cudf::size_of(column.type);
+    NANOARROW_THROW_NOT_OK(ArrowBufferResize(buffer, num_rows * element_size, 0));
+    if (column.is_scalar) {
+      for (int64_t i = 0; i < num_rows; ++i) {
+        std::memcpy(buffer->data + i * element_size, column.data, element_size);
+      }
+    } else if (num_rows > 0) {
+      std::memcpy(buffer->data, column.data, num_rows * element_size);
+    }
+  }
+
+  ArrowError error;
+  if (ArrowArrayFinishBuildingDefault(array.get(), &error) != NANOARROW_OK) {
+    CUDF_FAIL("failed to build host evaluator result: " + std::string{error.message});
+  }
+
+  unique_device_array_t result(new ArrowDeviceArray, [](ArrowDeviceArray* arr) {
+    if (arr->array.release != nullptr) { ArrowArrayRelease(&arr->array); }
+    delete arr;
+  });
+  result->device_id   = -1;
+  result->device_type = ARROW_DEVICE_CPU;
+  result->sync_event  = nullptr;
+  ArrowArrayMove(array.get(), &result->array);
+  return result;
+}
+
+}  // namespace
+
+std::pair<unique_schema_t, unique_device_array_t> compute_column_host(
+  expression const& expr,
+  ArrowSchema const* schema,
+  ArrowArray const* input,
+  bool vectorized,
+  rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(schema != nullptr && input != nullptr,
+               "input ArrowSchema and ArrowArray must not be NULL",
+               std::invalid_argument);
+
+  ArrowSchemaView view;
+  NANOARROW_THROW_NOT_OK(ArrowSchemaViewInit(&view, schema, nullptr));
+  CUDF_EXPECTS(view.type == NANOARROW_TYPE_STRUCT,
+               "The input to the host evaluator must be a struct of columns",
+               cudf::data_type_error);
+  CUDF_EXPECTS(schema->n_children == input->n_children,
+               "The input ArrowSchema and ArrowArray have different numbers of columns");
+
+  auto evaluator = host_evaluator{schema, input, vectorized, stream};
+  expr.accept(evaluator);
+  auto const result = evaluator.result();
+  return {make_schema(result->type), make_array(*result, evaluator.num_rows())};
+}
+
+}  // namespace detail
+}  // namespace ast
+}  // namespace cudf
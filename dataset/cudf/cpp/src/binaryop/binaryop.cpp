@@ -157,8 +157,10 @@ void binary_operation(mutable_column_view& out,
                                            cudf::type_to_name(rhs.type()),
                                            std::string("cudf::binops::jit::UserDefinedOp"));
 
-  cudf::jit::get_program_cache(*binaryop_jit_kernel_cu_jit)
-    .get_kernel(kernel_name, {}, {{"binaryop/jit/operation-udf.hpp", cuda_source}}, {"-arch=sm_."})
+  cudf::jit::get_kernel(*binaryop_jit_kernel_cu_jit,
+                        kernel_name,
+                        {{"binaryop/jit/operation-udf.hpp", cuda_source}},
+                        {"-arch=sm_."})
     ->configure_1d_max_occupancy(0, 0, nullptr, stream.value())
     ->launch(out.size(),
              cudf::jit::get_data_ptr(out),
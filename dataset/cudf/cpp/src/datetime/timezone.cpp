@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2024, NVIDIA CORPORATION.
+ * Copyright (c) 2018-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -15,12 +15,17 @@
  */
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/timezone.hpp>
+#include <cudf/detail/utilities/host_worker_pool.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/table/table.hpp>
 
 #include <algorithm>
+#include <array>
+#include <cstdlib>
 #include <filesystem>
 #include <fstream>
+#include <future>
+#include <limits>
 
 namespace cudf {
 
@@ -374,27 +379,26 @@ static int64_t get_transition_time(dst_transition_s const& trans, int year)
   return trans.time + cuda::std::chrono::duration_cast<duration_s>(duration_D{day}).count();
 }
 
-}  // namespace
-
-std::unique_ptr<table> make_timezone_transition_table(std::optional<std::string_view> tzif_dir,
-                                                      std::string_view timezone_name,
-                                                      rmm::cuda_stream_view stream,
-                                                      rmm::device_async_resource_ref mr)
-{
-  CUDF_FUNC_RANGE();
-  return detail::make_timezone_transition_table(tzif_dir, timezone_name, stream, mr);
-}
-
-namespace detail {
+/**
+ * @brief Transition times and offsets of a timezone, in the layout of the columns of the
+ * transition table.
+ */
+struct transition_table {
+  std::vector<timestamp_s::rep> transition_times;
+  std::vector<duration_s::rep> offsets;
+};
 
-std::unique_ptr<table> make_timezone_transition_table(std::optional<std::string_view> tzif_dir,
-                                                      std::string_view timezone_name,
-                                                      rmm::cuda_stream_view stream,
-                                                      rmm::device_async_resource_ref mr)
+/**
+ * @brief Reads the TZif file of a timezone and generates the entries of its transition table.
+ *
+ * @return The entries of the transition table, or no entries if the table would be a no-op
+ */
+transition_table read_transition_table(std::optional<std::string_view> tzif_dir,
+                                       std::string_view timezone_name)
 {
   if (timezone_name == "UTC" || timezone_name.empty()) {
     // Return an empty table for UTC
-    return std::make_unique<cudf::table>();
+    return {};
   }
 
   timezone_file const tzf(tzif_dir, timezone_name);
@@ -425,7 +429,7 @@ std::unique_ptr<table> make_timezone_transition_table(std::optional<std::string_
     if (tzf.typecnt() == 0 || tzf.ttype[0].utcoff == 0) {
       // No transitions, offset is zero; Table would be a no-op.
       // Return an empty table to speed up parsing.
-      return std::make_unique<cudf::table>();
+      return {};
     }
     // No transitions to use for the time/offset - use the first offset and apply to all timestamps
     transition_times[0] = std::numeric_limits<int64_t>::max();
@@ -482,6 +486,39 @@ std::unique_ptr<table> make_timezone_transition_table(std::optional<std::string_
   CUDF_EXPECTS(transition_times.size() == offsets.size(),
                "Error reading TZif file for timezone " + std::string{timezone_name});
 
+  return {std::move(transition_times), std::move(offsets)};
+}
+
+// Length of the solar cycle in seconds, as used by the device lookup to project timestamps
+constexpr int64_t solar_cycle_s = cuda::std::chrono::duration_cast<duration_s>(
+                                    duration_D{365 * solar_cycle_years + solar_cycle_years / 4 -
+                                               (solar_cycle_years / 100 - solar_cycle_years / 400)})
+                                    .count();
+
+// Number of timestamps converted at a time, with their offsets kept on the stack
+constexpr std::size_t conversion_batch_size = 1024;
+
+}  // namespace
+
+std::unique_ptr<table> make_timezone_transition_table(std::optional<std::string_view> tzif_dir,
+                                                      std::string_view timezone_name,
+                                                      rmm::cuda_stream_view stream,
+                                                      rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::make_timezone_transition_table(tzif_dir, timezone_name, stream, mr);
+}
+
+namespace detail {
+
+std::unique_ptr<table> make_timezone_transition_table(std::optional<std::string_view> tzif_dir,
+                                                      std::string_view timezone_name,
+                                                      rmm::cuda_stream_view stream,
+                                                      rmm::device_async_resource_ref mr)
+{
+  auto const [transition_times, offsets] = read_transition_table(tzif_dir, timezone_name);
+  if (transition_times.empty()) { return std::make_unique<cudf::table>(); }
+
   auto ttimes_typed = make_empty_host_vector<timestamp_s>(transition_times.size(), stream);
   std::transform(transition_times.cbegin(),
                  transition_times.cend(),
@@ -507,5 +544,221 @@ std::unique_ptr<table> make_timezone_transition_table(std::optional<std::string_
   return std::make_unique<cudf::table>(std::move(tz_table_columns));
 }
 
+host_timezone_table::host_timezone_table(host_span<int64_t const> transition_times,
+                                         host_span<int64_t const> offsets)
+{
+  CUDF_EXPECTS(transition_times.size() == offsets.size(),
+               "Transition times and offsets must have the same size");
+  CUDF_EXPECTS(transition_times.empty() || transition_times.size() > solar_cycle_entry_count,
+               "Transition table must include the solar cycle entries");
+
+  // The first entry applies to all timestamps before the first transition of the file
+  _times.push_back(std::numeric_limits<int64_t>::min());
+  _offsets.push_back(offsets.empty() ? 0 : static_cast<int32_t>(offsets.front()));
+  auto const file_entry_end =
+    transition_times.empty() ? 0 : transition_times.size() - solar_cycle_entry_count;
+
+  // A table without transitions in the file applies its first offset to all timestamps
+  auto const has_transitions =
+    file_entry_end > 0 && transition_times.front() != std::numeric_limits<int64_t>::max();
+  if (has_transitions) {
+    _times.insert(
+      _times.end(), transition_times.begin() + 1, transition_times.begin() + file_entry_end);
+    _offsets.insert(_offsets.end(), offsets.begin() + 1, offsets.begin() + file_entry_end);
+    _last_file_time = transition_times[file_entry_end - 1];
+
+    // Cycle entries follow the file entries on the timeline, after an entry that covers the
+    // projected timestamps before the first cycle transition
+    auto const first_cycle_time = transition_times[file_entry_end];
+    CUDF_EXPECTS(_last_file_time < std::numeric_limits<int64_t>::max() / 2 &&
+                   std::abs(first_cycle_time) < solar_cycle_s,
+                 "Transition times of the timezone are out of range");
+    _cycle_base = _last_file_time + 1 + std::max<int64_t>(0, -first_cycle_time);
+    _times.push_back(_last_file_time + 1);
+    _offsets.push_back(static_cast<int32_t>(offsets[file_entry_end]));
+    for (auto i = file_entry_end; i < transition_times.size(); ++i) {
+      _times.push_back(transition_times[i] + _cycle_base);
+      _offsets.push_back(static_cast<int32_t>(offsets[i]));
+    }
+    CUDF_EXPECTS(std::is_sorted(_times.begin(), _times.end()),
+                 "Transition times of the timezone are not in order");
+  }
+
+  build_buckets();
+
+  // Padding lets a lookup compare with a whole bucket of transitions past the last one
+  _times.insert(_times.end(), bucket_capacity, std::numeric_limits<int64_t>::max());
+  auto const last_offset = _offsets.back();
+  _offsets.insert(_offsets.end(), bucket_capacity, last_offset);
+}
+
+void host_timezone_table::build_buckets()
+{
+  if (_times.size() == 1) {
+    // A single bucket that covers the whole timeline
+    _bucket_begin = std::numeric_limits<int64_t>::min();
+    _bucket_shift = 63;
+    _bucket_first = {0};
+    return;
+  }
+
+  // Use the widest buckets that hold few enough transitions, to keep the index small
+  auto const last_index = static_cast<int32_t>(_times.size() - 1);
+  auto const end        = _times.back();
+  for (_bucket_shift = max_bucket_shift;; --_bucket_shift) {
+    // Bucket 0 starts right before the first transition, unless the timeline is too long to be
+    // covered by `max_bucket_count` buckets
+    _bucket_begin = std::max(_times[1] - 1, end - ((max_bucket_count - 1) << _bucket_shift));
+    auto const num_buckets = ((end - _bucket_begin) >> _bucket_shift) + 1;
+
+    _bucket_first.resize(num_buckets);
+    int32_t index = 0;
+    for (int64_t bucket = 0; bucket < num_buckets; ++bucket) {
+      auto const bucket_start = _bucket_begin + (bucket << _bucket_shift);
+      while (index < last_index && _times[index + 1] <= bucket_start) {
+        ++index;
+      }
+      _bucket_first[bucket] = index;
+    }
+
+    // Buckets with too many transitions are marked to be searched instead
+    bool all_fit = true;
+    for (int64_t bucket = 0; bucket < num_buckets; ++bucket) {
+      auto const next = bucket + 1 < num_buckets ? _bucket_first[bucket + 1] : last_index;
+      if (next - _bucket_first[bucket] > bucket_capacity) {
+        _bucket_first[bucket] = -1;
+        all_fit               = false;
+      }
+    }
+    if (all_fit || _bucket_shift == min_bucket_shift) { return; }
+  }
+}
+
+int32_t host_timezone_table::search(int64_t position) const
+{
+  auto const end = _times.end() - bucket_capacity;
+  return static_cast<int32_t>(std::upper_bound(_times.begin() + 1, end, position) -
+                              _times.begin() - 1);
+}
+
+void host_timezone_table::lookup_offsets(int64_t const* timestamps,
+                                         std::size_t size,
+                                         int32_t* offsets) const
+{
+  auto const times        = _times.data();
+  auto const bucket_first = _bucket_first.data();
+  auto const last_bucket  = static_cast<uint64_t>(_bucket_first.size() - 1);
+
+  // Position of a timestamp on the timeline, with timestamps past the file entries projected into
+  // the cycle
+  auto const position = [&](int64_t timestamp) {
+    auto projected = timestamp % solar_cycle_s;
+    projected += projected < 0 ? solar_cycle_s : 0;
+    return timestamp > _last_file_time ? projected + _cycle_base : timestamp;
+  };
+  // Index of the first transition of the bucket of a position; positions before the first bucket
+  // are clamped to the last one and need to be searched for
+  auto const bucket_first_index = [&](int64_t pos) {
+    auto const bucket = std::min(
+      (static_cast<uint64_t>(pos) - static_cast<uint64_t>(_bucket_begin)) >> _bucket_shift,
+      last_bucket);
+    return bucket_first[bucket];
+  };
+
+  // Branch-free lookup of the bucket of each timestamp, followed by a fixed number of comparisons
+  // with the transitions in the bucket
+  bool any_searched = false;
+  for (std::size_t i = 0; i < size; ++i) {
+    auto const pos   = position(timestamps[i]);
+    auto const first = bucket_first_index(pos);
+    auto const base  = std::max(first, 0);
+    auto index       = base;
+    for (int32_t k = 1; k <= bucket_capacity; ++k) {
+      index += times[base + k] <= pos;
+    }
+    offsets[i] = _offsets[index];
+    any_searched |= (pos < _bucket_begin) | (first < 0);
+  }
+  if (!any_searched) { return; }
+
+  // Timestamps before the buckets or in crowded buckets are rare, and are searched for instead
+  for (std::size_t i = 0; i < size; ++i) {
+    auto const pos = position(timestamps[i]);
+    if (pos < _bucket_begin || bucket_first_index(pos) < 0) { offsets[i] = _offsets[search(pos)]; }
+  }
+}
+
+int64_t host_timezone_table::ut_offset(int64_t timestamp) const
+{
+  int32_t offset{};
+  lookup_offsets(&timestamp, 1, &offset);
+  return offset;
+}
+
+void host_timezone_table::to_local(host_span<int64_t const> timestamps,
+                                   host_span<int64_t> output) const
+{
+  CUDF_EXPECTS(timestamps.size() == output.size(), "Output must have the size of the input");
+  std::array<int32_t, conversion_batch_size> offsets;
+  for (std::size_t begin = 0; begin < timestamps.size(); begin += conversion_batch_size) {
+    auto const size = std::min(conversion_batch_size, timestamps.size() - begin);
+    lookup_offsets(timestamps.data() + begin, size, offsets.data());
+    for (std::size_t i = 0; i < size; ++i) {
+      output[begin + i] = timestamps[begin + i] + offsets[i];
+    }
+  }
+}
+
+void host_timezone_table::to_utc(host_span<int64_t const> timestamps,
+                                 host_span<int64_t> output) const
+{
+  CUDF_EXPECTS(timestamps.size() == output.size(), "Output must have the size of the input");
+  std::array<int32_t, conversion_batch_size> offsets;
+  std::array<int64_t, conversion_batch_size> guesses;
+  for (std::size_t begin = 0; begin < timestamps.size(); begin += conversion_batch_size) {
+    auto const size  = std::min(conversion_batch_size, timestamps.size() - begin);
+    auto const input = timestamps.data() + begin;
+    // The offset at the local time itself is correct unless a transition lies within one offset
+    // of it, so it is looked up again at the instant it gives
+    lookup_offsets(input, size, offsets.data());
+    for (std::size_t i = 0; i < size; ++i) {
+      guesses[i] = input[i] - offsets[i];
+    }
+    lookup_offsets(guesses.data(), size, offsets.data());
+    for (std::size_t i = 0; i < size; ++i) {
+      output[begin + i] = input[i] - offsets[i];
+    }
+  }
+}
+
+host_timezone_table make_host_timezone_table(std::optional<std::string_view> tzif_dir,
+                                             std::string_view timezone_name)
+{
+  auto const [transition_times, offsets] = read_transition_table(tzif_dir, timezone_name);
+  return host_timezone_table{transition_times, offsets};
+}
+
+std::vector<host_timezone_table> make_host_timezone_tables(
+  std::optional<std::string_view> tzif_dir, host_span<std::string const> timezone_names)
+{
+  // Avoid using the thread pool for a single timezone
+  if (timezone_names.size() == 1) {
+    return {make_host_timezone_table(tzif_dir, timezone_names.front())};
+  }
+
+  std::vector<std::future<host_timezone_table>> tasks;
+  tasks.reserve(timezone_names.size());
+  for (auto const& timezone_name : timezone_names) {
+    tasks.emplace_back(cudf::detail::host_worker_pool().submit_task(
+      [tzif_dir, &timezone_name] { return make_host_timezone_table(tzif_dir, timezone_name); }));
+  }
+  std::vector<host_timezone_table> tables;
+  tables.reserve(timezone_names.size());
+  std::transform(tasks.begin(), tasks.end(), std::back_inserter(tables), [](auto& task) {
+    return std::move(task).get();
+  });
+  return tables;
+}
+
 }  // namespace detail
 }  // namespace cudf
@@ -0,0 +1,550 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "host_streaming_tokenizer.hpp"
+
+#include <cudf/utilities/error.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <stdexcept>
+
+namespace cudf::io::json::detail {
+namespace {
+
+constexpr uint64_t low_bytes  = 0x0101'0101'0101'0101ULL;
+constexpr uint64_t low_7_bits = 0x7F7F'7F7F'7F7F'7F7FULL;
+
+/**
+ * @brief Returns a word with the high bit of each byte set if the byte equals `symbol`.
+ */
+constexpr uint64_t equal_bytes(uint64_t word, char symbol)
+{
+  auto const x = word ^ (low_bytes * static_cast<uint8_t>(symbol));
+  return ~(((x & low_7_bits) + low_7_bits) | x | low_7_bits);
+}
+
+/**
+ * @brief Gathers the high bit of each byte of a word into the low byte, first byte first.
+ */
+constexpr uint64_t gather_high_bits(uint64_t word)
+{
+  return (((word >> 7) & low_bytes) * 0x0102'0408'1020'4080ULL) >> 56;
+}
+
+/**
+ * @brief Returns the bits that are preceded by an odd number of set bits, including themselves.
+ */
+constexpr uint64_t prefix_xor(uint64_t bits)
+{
+  bits ^= bits << 1;
+  bits ^= bits << 2;
+  bits ^= bits << 4;
+  bits ^= bits << 8;
+  bits ^= bits << 16;
+  bits ^= bits << 32;
+  return bits;
+}
+
+/**
+ * @brief Returns the characters escaped by a backslash, given the positions of the backslashes.
+ *
+ * A character is escaped if it follows an odd-length run of backslashes. Runs starting at even
+ * and odd positions are told apart by the carry of an addition, as in simdjson.
+ *
+ * @param backslashes Positions of backslashes in the block
+ * @param carry Whether the first character of the block is escaped, updated for the next block
+ */
+constexpr uint64_t find_escaped(uint64_t backslashes, uint64_t& carry)
+{
+  constexpr uint64_t even_bits = 0x5555'5555'5555'5555ULL;
+  backslashes &= ~carry;
+  auto const follows_escape = (backslashes << 1) | carry;
+  auto const odd_starts     = backslashes & ~even_bits & ~follows_escape;
+  auto const even_sequences = odd_starts + backslashes;
+  carry                     = even_sequences < odd_starts ? 1 : 0;
+  return (even_bits ^ (even_sequences << 1)) & follows_escape;
+}
+
+/**
+ * @brief Appends the UTF-8 encoding of a code point.
+ */
+void append_utf8(std::string& out, uint32_t code_point)
+{
+  if (code_point < 0x80) {
+    out += static_cast<char>(code_point);
+  } else if (code_point < 0x800) {
+    out += static_cast<char>(0xC0 | (code_point >> 6));
+    out += static_cast<char>(0x80 | (code_point & 0x3F));
+  } else if (code_point < 0x1'0000) {
+    out += static_cast<char>(0xE0 | (code_point >> 12));
+    out += static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+    out += static_cast<char>(0x80 | (code_point & 0x3F));
+  } else {
+    out += static_cast<char>(0xF0 | (code_point >> 18));
+    out += static_cast<char>(0x80 | ((code_point >> 12) & 0x3F));
+    out += static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+    out += static_cast<char>(0x80 | (code_point & 0x3F));
+  }
+}
+
+/**
+ * @brief Parses the four hexadecimal digits of a `\u` escape, or returns -1 if they are invalid.
+ */
+int32_t parse_hex4(std::string_view str, std::size_t pos)
+{
+  if (pos + 4 > str.size()) { return -1; }
+  int32_t value = 0;
+  for (auto i = pos; i < pos + 4; ++i) {
+    auto const c = str[i];
+    auto const digit = c >= '0' && c <= '9'   ? c - '0'
+                       : c >= 'a' && c <= 'f' ? c - 'a' + 10
+                       : c >= 'A' && c <= 'F' ? c - 'A' + 10
+                                              : -1;
+    if (digit < 0) { return -1; }
+    value = value * 16 + digit;
+  }
+  return value;
+}
+
+/**
+ * @brief Replaces the escape sequences of a field name by the characters they stand for.
+ *
+ * Invalid escape sequences are kept as they are.
+ */
+std::string unescape(std::string_view name)
+{
+  std::string out;
+  out.reserve(name.size());
+  for (std::size_t i = 0; i < name.size(); ++i) {
+    if (name[i] != '\\' || i + 1 == name.size()) {
+      out += name[i];
+      continue;
+    }
+    switch (name[i + 1]) {
+      case '"':
+      case '\\':
+      case '/': out += name[i + 1]; break;
+      case 'b': out += '\b'; break;
+      case 'f': out += '\f'; break;
+      case 'n': out += '\n'; break;
+      case 'r': out += '\r'; break;
+      case 't': out += '\t'; break;
+      case 'u': {
+        auto code_point = parse_hex4(name, i + 2);
+        if (code_point < 0) {
+          out += name[i];
+          continue;
+        }
+        i += 4;
+        // A high surrogate combines with an immediately following low surrogate
+        if (code_point >= 0xD800 && code_point < 0xDC00 && i + 3 < name.size() &&
+            name[i + 2] == '\\' && name[i + 3] == 'u') {
+          auto const low = parse_hex4(name, i + 4);
+          if (low >= 0xDC00 && low < 0xE000) {
+            code_point = 0x1'0000 + ((code_point - 0xD800) << 10) + (low - 0xDC00);
+            i += 6;
+          }
+        }
+        append_utf8(out, static_cast<uint32_t>(code_point));
+        break;
+      }
+      default: out += name[i]; continue;
+    }
+    ++i;
+  }
+  return out;
+}
+
+}  // namespace
+
+host_streaming_tokenizer::host_streaming_tokenizer(
+  std::vector<std::vector<std::string>> const& projection, bool recover_with_null)
+  : _trie(1),
+    _tapes(projection.size()),
+    _num_fields{static_cast<size_type>(projection.size())},
+    _recover_with_null{recover_with_null}
+{
+  for (size_type field = 0; field < _num_fields; ++field) {
+    auto const& path = projection[field];
+    CUDF_EXPECTS(not path.empty(), "Projected field paths cannot be empty", std::invalid_argument);
+    int32_t node = 0;
+    for (auto const& name : path) {
+      CUDF_EXPECTS(_trie[node].field < 0,
+                   "A projected field cannot be nested within another projected field",
+                   std::invalid_argument);
+      auto const child = _trie[node].children.find(name);
+      if (child != _trie[node].children.end()) {
+        node = child->second;
+      } else {
+        auto const next = static_cast<int32_t>(_trie.size());
+        _trie[node].children.emplace(name, next);
+        _trie[node].name_lengths |= uint64_t{1} << std::min<std::size_t>(name.size(), 63);
+        _trie.emplace_back();
+        node = next;
+      }
+    }
+    CUDF_EXPECTS(_trie[node].field < 0 and _trie[node].children.empty(),
+                 "A projected field cannot be repeated or contain another projected field",
+                 std::invalid_argument);
+    _trie[node].field = field;
+  }
+}
+
+void host_streaming_tokenizer::append(host_span<char const> window)
+{
+  CUDF_EXPECTS(not _finished, "Cannot append input after the tokenizer has finished");
+  auto data      = window.data();
+  auto remaining = static_cast<int64_t>(window.size());
+  if (_num_pending > 0) {
+    auto const count = std::min(block_size - _num_pending, remaining);
+    std::memcpy(_pending.data() + _num_pending, data, count);
+    _num_pending += count;
+    data += count;
+    remaining -= count;
+    if (_num_pending < block_size) { return; }
+    process_block(_pending.data());
+    _num_pending = 0;
+  }
+  // Whole blocks are read in place
+  for (; remaining >= block_size; data += block_size, remaining -= block_size) {
+    process_block(data);
+  }
+  std::memcpy(_pending.data(), data, remaining);
+  _num_pending = remaining;
+}
+
+void host_streaming_tokenizer::finish()
+{
+  CUDF_EXPECTS(not _finished, "The tokenizer has already finished");
+  // A newline after the last input completes the last record, whether or not the input ends with
+  // one, since empty lines are ignored
+  std::fill(_pending.begin() + _num_pending, _pending.end(), ' ');
+  _pending[_num_pending] = '\n';
+  process_block(_pending.data());
+  _num_pending = 0;
+  _finished    = true;
+}
+
+size_type host_streaming_tokenizer::num_completed_records() const { return _num_completed; }
+
+std::vector<field_tape> host_streaming_tokenizer::take_completed_records()
+{
+  std::vector<field_tape> completed(_tapes.size());
+  for (std::size_t field = 0; field < _tapes.size(); ++field) {
+    std::swap(completed[field], _tapes[field]);
+    // The entries of the open record stay behind
+    if (_in_record) {
+      _tapes[field].offsets.push_back(completed[field].offsets.back());
+      _tapes[field].lengths.push_back(completed[field].lengths.back());
+      completed[field].offsets.pop_back();
+      completed[field].lengths.pop_back();
+    }
+  }
+  _num_completed = 0;
+  return completed;
+}
+
+host_streaming_tokenizer::block_masks host_streaming_tokenizer::classify(char const* block,
+                                                                           uint64_t valid)
+{
+  uint64_t quotes = 0, backslashes = 0, newlines = 0, whitespace = 0, operators = 0, brackets = 0;
+  for (int i = 0; i < 8; ++i) {
+    uint64_t word;
+    std::memcpy(&word, block + i * 8, sizeof(word));
+    auto const newline = equal_bytes(word, '\n');
+    // Setting bit 5 maps '[' to '{' and ']' to '}' without mapping any other byte to either
+    auto const folded  = word | (low_bytes * 0x20);
+    auto const bracket = equal_bytes(folded, '{') | equal_bytes(folded, '}');
+    auto const shift   = i * 8;
+    quotes |= gather_high_bits(equal_bytes(word, '"')) << shift;
+    backslashes |= gather_high_bits(equal_bytes(word, '\\')) << shift;
+    newlines |= gather_high_bits(newline) << shift;
+    whitespace |= gather_high_bits(newline | equal_bytes(word, ' ') | equal_bytes(word, '\t') |
+                                   equal_bytes(word, '\r'))
+                  << shift;
+    brackets |= gather_high_bits(bracket) << shift;
+    operators |=
+      gather_high_bits(bracket | equal_bytes(word, ':') | equal_bytes(word, ',')) << shift;
+  }
+  // Bytes before `valid` were processed already, and are treated as whitespace
+  whitespace |= ~valid;
+
+  block_masks masks{};
+  masks.quotes    = quotes & valid & ~find_escaped(backslashes & valid, _escaped_carry);
+  masks.in_string = prefix_xor(masks.quotes) ^ _in_string_carry;
+  // All ones if the block ends within a string
+  _in_string_carry = static_cast<uint64_t>(static_cast<int64_t>(masks.in_string) >> 63);
+  masks.newlines  = newlines & valid;
+  masks.operators = operators & valid & ~masks.in_string;
+  masks.brackets  = brackets & valid & ~masks.in_string;
+
+  // Numbers and literals are runs of any other bytes outside strings
+  auto const scalar_bytes = ~(whitespace | operators | masks.quotes | masks.in_string);
+  auto const follows      = (scalar_bytes << 1) | _scalar_carry;
+  masks.scalars           = scalar_bytes & ~follows;
+  masks.scalar_ends       = ~scalar_bytes & follows;
+  _scalar_carry           = scalar_bytes >> 63;
+  return masks;
+}
+
+void host_streaming_tokenizer::process_block(char const* block)
+{
+  _block     = block;
+  auto valid = ~uint64_t{0};
+  while (true) {
+    auto const masks = classify(block, valid);
+    // A newline inside a string ends the record all the same, so the rest of the block is
+    // classified again from there on
+    auto const broken = masks.newlines & masks.in_string;
+    auto remaining =
+      broken == 0 ? valid : valid & ~((~uint64_t{1}) << std::countr_zero(broken));
+    while (true) {
+      auto const events = remaining & (_mode == scan_mode::ALL
+                                         ? masks.quotes | masks.operators | masks.scalars |
+                                             masks.scalar_ends | masks.newlines
+                                       : _mode == scan_mode::BRACKETS
+                                         ? masks.brackets | masks.newlines
+                                         : masks.newlines);
+      if (events == 0) { break; }
+      auto const pos = std::countr_zero(events);
+      remaining &= (~uint64_t{1}) << pos;
+      visit(masks, pos);
+    }
+    if (broken == 0) { break; }
+    valid            = (~uint64_t{1}) << std::countr_zero(broken);
+    _escaped_carry   = 0;
+    _in_string_carry = 0;
+    _scalar_carry    = 0;
+  }
+  // Field names may span blocks
+  if (_in_key) {
+    auto const begin = _key_offset - _block_offset;
+    _key.append(block + begin, block_size - begin);
+    _key_offset = _block_offset + block_size;
+  }
+  _block_offset += block_size;
+}
+
+void host_streaming_tokenizer::visit(block_masks const& masks, int pos)
+{
+  auto const bit    = uint64_t{1} << pos;
+  auto const offset = _block_offset + pos;
+  switch (_mode) {
+    case scan_mode::NEWLINES: end_record(); return;
+    case scan_mode::BRACKETS: {
+      if (masks.newlines & bit) {
+        fail(offset, "unexpected end of line");
+        end_record();
+      } else if ((_block[pos] | 0x20) == '{') {
+        ++_depth;
+      } else if (--_depth == 0) {
+        _mode = scan_mode::ALL;
+        end_value(offset + 1);
+      }
+      return;
+    }
+    case scan_mode::ALL: break;
+  }
+
+  if ((masks.scalar_ends & bit) and _in_scalar) {
+    _in_scalar = false;
+    end_value(offset);
+    // All projected fields may have been found
+    if (_mode != scan_mode::ALL) {
+      if (masks.newlines & bit) { end_record(); }
+      return;
+    }
+  }
+  if (masks.newlines & bit) {
+    on_newline(offset);
+  } else if (masks.quotes & bit) {
+    on_quote(offset);
+  } else if (masks.operators & bit) {
+    on_operator(_block[pos], offset);
+  } else if (masks.scalars & bit) {
+    on_scalar(offset);
+  }
+}
+
+void host_streaming_tokenizer::on_newline(int64_t offset)
+{
+  if (_expect == expect::RECORD) { return; }
+  if (_expect != expect::END_OF_RECORD) {
+    fail(offset, _in_string ? "unterminated string" : "unexpected end of line");
+  }
+  end_record();
+}
+
+void host_streaming_tokenizer::on_quote(int64_t offset)
+{
+  if (_in_string) {
+    _in_string = false;
+    if (not _in_key) {
+      end_value(offset + 1);
+      return;
+    }
+    _in_key = false;
+    // Names within a block are looked up in place
+    auto name = std::string_view{_block + (_key_offset - _block_offset),
+                                 static_cast<std::size_t>(offset - _key_offset)};
+    if (not _key.empty()) { name = _key.append(name); }
+    if (name.find('\\') != std::string_view::npos) { name = _key = unescape(name); }
+    auto const& node = _trie[_frames.back()];
+    _member_node     = -1;
+    if ((node.name_lengths >> std::min<std::size_t>(name.size(), 63)) & 1) {
+      auto const child = node.children.find(name);
+      if (child != node.children.end()) { _member_node = child->second; }
+    }
+    _expect      = expect::COLON;
+    return;
+  }
+  switch (_expect) {
+    case expect::FIRST_KEY:
+    case expect::KEY:
+      _in_string = true;
+      _in_key    = true;
+      _key.clear();
+      _key_offset = offset + 1;
+      return;
+    case expect::VALUE:
+      _in_string = true;
+      begin_value(offset);
+      return;
+    case expect::RECORD: begin_record(); [[fallthrough]];
+    default: fail(offset, "unexpected string");
+  }
+}
+
+void host_streaming_tokenizer::on_operator(char symbol, int64_t offset)
+{
+  switch (_expect) {
+    case expect::RECORD:
+      begin_record();
+      if (symbol != '{') { return fail(offset, "expected a struct"); }
+      _frames.push_back(0);
+      _expect = expect::FIRST_KEY;
+      return;
+    case expect::FIRST_KEY:
+      if (symbol != '}') { return fail(offset, "expected a field name"); }
+      return close_struct();
+    case expect::KEY: return fail(offset, "expected a field name");
+    case expect::COLON:
+      if (symbol != ':') { return fail(offset, "expected a colon"); }
+      _expect = expect::VALUE;
+      return;
+    case expect::VALUE:
+      if (symbol != '{' and symbol != '[') { return fail(offset, "expected a value"); }
+      // Structs on a projected path are parsed, and all other structs and lists are read or
+      // skipped by their brackets alone
+      if (symbol == '{' and _member_node >= 0 and _trie[_member_node].field < 0) {
+        _frames.push_back(_member_node);
+        _expect = expect::FIRST_KEY;
+        return;
+      }
+      begin_value(offset);
+      _depth = 1;
+      _mode  = scan_mode::BRACKETS;
+      return;
+    case expect::SEPARATOR:
+      if (symbol == ',') {
+        _expect = expect::KEY;
+        return;
+      }
+      if (symbol != '}') { return fail(offset, "expected a comma or the end of a struct"); }
+      return close_struct();
+    case expect::END_OF_RECORD: return fail(offset, "expected the end of the line");
+  }
+}
+
+void host_streaming_tokenizer::on_scalar(int64_t offset)
+{
+  if (_expect == expect::RECORD) { begin_record(); }
+  if (_expect != expect::VALUE) { return fail(offset, "unexpected literal"); }
+  _in_scalar = true;
+  begin_value(offset);
+}
+
+void host_streaming_tokenizer::begin_value(int64_t offset)
+{
+  _value_field = -1;
+  if (_member_node >= 0) {
+    auto const field = _trie[_member_node].field;
+    if (field >= 0 and _tapes[field].offsets.back() == field_tape::missing_value) {
+      _value_field = field;
+    }
+  }
+  _value_offset = offset;
+}
+
+void host_streaming_tokenizer::end_value(int64_t end)
+{
+  _expect = expect::SEPARATOR;
+  if (_value_field < 0) { return; }
+  _tapes[_value_field].offsets.back() = _value_offset;
+  _tapes[_value_field].lengths.back() = end - _value_offset;
+  _value_field                        = -1;
+  // The rest of the record is of no interest once all projected fields are found
+  if (++_num_found == _num_fields) { _mode = scan_mode::NEWLINES; }
+}
+
+void host_streaming_tokenizer::close_struct()
+{
+  _frames.pop_back();
+  _expect = _frames.empty() ? expect::END_OF_RECORD : expect::SEPARATOR;
+}
+
+void host_streaming_tokenizer::begin_record()
+{
+  _in_record = true;
+  _num_found = 0;
+  for (auto& tape : _tapes) {
+    tape.offsets.push_back(field_tape::missing_value);
+    tape.lengths.push_back(0);
+  }
+}
+
+void host_streaming_tokenizer::end_record()
+{
+  if (_in_record) { ++_num_completed; }
+  _in_record = false;
+  _in_string = false;
+  _in_key    = false;
+  _in_scalar = false;
+  _mode      = scan_mode::ALL;
+  _expect    = expect::RECORD;
+  _frames.clear();
+}
+
+void host_streaming_tokenizer::fail(int64_t offset, char const* reason)
+{
+  if (not _recover_with_null) {
+    CUDF_FAIL("Invalid JSON at offset " + std::to_string(offset) + ": " + reason);
+  }
+  // The record is null, and the rest of it is skipped
+  for (auto& tape : _tapes) {
+    tape.offsets.back() = field_tape::missing_value;
+    tape.lengths.back() = 0;
+  }
+  _value_field = -1;
+  _in_string   = false;
+  _in_key      = false;
+  _in_scalar   = false;
+  _mode        = scan_mode::NEWLINES;
+}
+
+}  // namespace cudf::io::json::detail
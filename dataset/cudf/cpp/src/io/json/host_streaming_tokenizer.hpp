@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/types.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace cudf::io::json::detail {
+
+/**
+ * @brief Location of the values of one projected field, with one entry per record.
+ *
+ * Offsets are relative to the beginning of the whole input stream, not to the window in which the
+ * value was found, and a value may span several windows. The extent of a value is its raw text:
+ * strings include their quotes, and structs and lists span from their opening to their closing
+ * bracket. Records in which the field is absent, or which failed to parse in recovery mode, have
+ * an offset of `missing_value`.
+ */
+struct field_tape {
+  static constexpr int64_t missing_value = -1;
+
+  std::vector<int64_t> offsets;  ///< Offset of the value in each record
+  std::vector<int64_t> lengths;  ///< Length in bytes of the value in each record
+};
+
+/**
+ * @brief Tokenizes JSON Lines input on the host one window at a time, producing the locations of
+ * the values of a set of projected fields.
+ *
+ * Input is appended in windows of any size, and records may span windows. The tokenizer keeps the
+ * state of a partially processed record between windows, and buffers less than one block of
+ * input, so memory use is independent of the size of the input. Locations of the values of
+ * completed records can be taken out at any time.
+ *
+ * Each block of 64 bytes is first classified into bitmaps of quotes, escapes, string interiors,
+ * structural characters and the boundaries of numbers and literals, in the manner of the first
+ * stage of simdjson. The structural positions are then visited in order, and only the positions
+ * relevant to the current state are considered: an unprojected struct or list is skipped by
+ * visiting its brackets alone, and the rest of a record is skipped up to the next newline as soon
+ * as all projected fields of the record have been found.
+ *
+ * Every record must be a struct on a single line, and empty lines are ignored. Projected fields
+ * are matched by their unescaped names, and if a field occurs more than once in a record, its
+ * first occurrence is used. Skipped parts of a record are not validated.
+ */
+class host_streaming_tokenizer {
+ public:
+  /**
+   * @brief Constructs a tokenizer that locates the values of the given fields.
+   *
+   * @param projection Paths of the projected fields, each from the record down through nested
+   * structs, such as `{"user", "id"}`
+   * @param recover_with_null Whether records that fail to parse have all projected fields missing
+   * instead of throwing
+   */
+  host_streaming_tokenizer(std::vector<std::vector<std::string>> const& projection,
+                           bool recover_with_null = false);
+
+  /**
+   * @brief Tokenizes the next window of input.
+   *
+   * @throws cudf::logic_error if a record is malformed and recovery is disabled
+   *
+   * @param window The input following the previous window
+   */
+  void append(host_span<char const> window);
+
+  /**
+   * @brief Tokenizes the input held back from previous windows and completes the last record.
+   *
+   * No input may be appended afterwards.
+   *
+   * @throws cudf::logic_error if the last record is incomplete and recovery is disabled
+   */
+  void finish();
+
+  /**
+   * @brief Returns the number of records completed since the tapes were last taken.
+   */
+  [[nodiscard]] size_type num_completed_records() const;
+
+  /**
+   * @brief Moves out the tapes of the records completed since the tapes were last taken.
+   *
+   * @return One tape per projected field, in the order of the projection
+   */
+  std::vector<field_tape> take_completed_records();
+
+ private:
+  static constexpr int64_t block_size = 64;
+
+  /// Bitmaps of a block, one bit per byte
+  struct block_masks {
+    uint64_t quotes;       ///< Quotes that open or close a string
+    uint64_t in_string;    ///< Opening quotes and the contents of strings
+    uint64_t newlines;     ///< Newlines, which always end a record
+    uint64_t operators;    ///< Brackets, colons and commas outside strings
+    uint64_t brackets;     ///< Brackets outside strings
+    uint64_t scalars;      ///< First byte of a number or literal
+    uint64_t scalar_ends;  ///< First byte after a number or literal
+  };
+
+  /// Positions that need to be visited in the current state
+  enum class scan_mode : uint8_t {
+    ALL,       ///< Every structural position, while parsing the projected path of a record
+    BRACKETS,  ///< Brackets, while reading or skipping a struct or list value
+    NEWLINES   ///< Newlines, while skipping the rest of a record
+  };
+
+  /// Token expected next while parsing a record
+  enum class expect : uint8_t { RECORD, FIRST_KEY, KEY, COLON, VALUE, SEPARATOR, END_OF_RECORD };
+
+  /// Hash of field names that allows lookups by `std::string_view`
+  struct name_hash {
+    using is_transparent = void;
+    std::size_t operator()(std::string_view name) const
+    {
+      return std::hash<std::string_view>{}(name);
+    }
+  };
+
+  /// A node of the trie of projected paths
+  struct trie_node {
+    std::unordered_map<std::string, int32_t, name_hash, std::equal_to<>> children;
+    uint64_t name_lengths{};  ///< Bit `i` is set if a child name has length `min(i, 63)`
+    int32_t field{-1};        ///< Index of the projected field if this node is a leaf
+  };
+
+  block_masks classify(char const* block, uint64_t valid);
+  void process_block(char const* block);
+  void visit(block_masks const& masks, int pos);
+  void on_newline(int64_t offset);
+  void on_quote(int64_t offset);
+  void on_operator(char symbol, int64_t offset);
+  void on_scalar(int64_t offset);
+  void begin_value(int64_t offset);
+  void end_value(int64_t end);
+  void close_struct();
+  void begin_record();
+  void end_record();
+  void fail(int64_t offset, char const* reason);
+
+  std::vector<trie_node> _trie;
+  std::vector<field_tape> _tapes;
+  size_type _num_fields{};
+  bool _recover_with_null;
+  bool _finished{false};
+
+  // Input held back until a whole block is available
+  std::array<char, block_size> _pending{};
+  int64_t _num_pending{};
+  char const* _block{};     ///< Block being processed
+  int64_t _block_offset{};  ///< Offset of the block being processed in the input stream
+
+  // State carried over from the previous block by the classification
+  uint64_t _escaped_carry{};
+  uint64_t _in_string_carry{};
+  uint64_t _scalar_carry{};
+
+  // State of the parser
+  scan_mode _mode{scan_mode::ALL};
+  expect _expect{expect::RECORD};
+  std::vector<int32_t> _frames;  ///< Trie nodes of the structs being parsed
+  bool _in_record{};
+  bool _in_string{};
+  bool _in_key{};
+  bool _in_scalar{};
+  int64_t _depth{};           ///< Depth of brackets within the struct or list value being read
+  int32_t _member_node{-1};   ///< Trie node of the current struct member, or -1 if unprojected
+  int32_t _value_field{-1};   ///< Projected field whose value is being read, or -1
+  int64_t _value_offset{};    ///< Offset of the value being read
+  int64_t _key_offset{};      ///< Offset of the unread part of the field name being read
+  std::string _key;           ///< Field name being read
+  size_type _num_found{};     ///< Number of projected fields found in the current record
+  size_type _num_completed{}; ///< Number of completed records in the tapes
+};
+
+}  // namespace cudf::io::json::detail
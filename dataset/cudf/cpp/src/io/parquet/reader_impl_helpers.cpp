@@ -29,10 +29,15 @@
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/zip_iterator.h>
 
+#include <algorithm>
 #include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
 #include <numeric>
 #include <optional>
 #include <regex>
+#include <string>
 #include <utility>
 
 namespace cudf::io::parquet::detail {
@@ -94,6 +99,68 @@ std::optional<LogicalType> converted_to_logical_type(SchemaElement const& schema
   return std::nullopt;
 }
 
+/**
+ * @brief Cache of the arrow schemas collected from the ARROW_SCHEMA_KEY metadata of Parquet files
+ *
+ * Files of one dataset, as well as files read repeatedly, usually have the same arrow schema,
+ * and decoding it dominates footer processing for wide schemas. Collected schemas are keyed by
+ * the hash of their encoded IPC message, and the most recently used ones are kept.
+ */
+class arrow_schema_cache {
+ public:
+  using schema_ptr = std::shared_ptr<arrow_schema_data_types const>;
+
+  /**
+   * @brief Returns the schema collected before from the same encoded message, or collects it
+   *
+   * @param encoded_schema The base64-encoded IPC message of the arrow schema
+   * @param collect Function that collects the schema from the message
+   * @return The collected schema
+   */
+  template <typename Collect>
+  schema_ptr get_or_collect(std::string const& encoded_schema, Collect&& collect)
+  {
+    auto const hash = std::hash<std::string>{}(encoded_schema);
+    {
+      std::lock_guard lock(_mutex);
+      auto const it = std::find_if(_entries.begin(), _entries.end(), [&](auto const& entry) {
+        return entry.hash == hash and entry.encoded_schema == encoded_schema;
+      });
+      if (it != _entries.end()) {
+        // Move the entry to the front as the most recently used one
+        std::rotate(_entries.begin(), it, std::next(it));
+        return _entries.front().schema;
+      }
+    }
+
+    // Collect without holding the lock, so readers of different schemas do not wait for each
+    // other. Readers of the same new schema may each collect it.
+    auto schema = std::make_shared<arrow_schema_data_types const>(collect());
+    std::lock_guard lock(_mutex);
+    if (_entries.size() == capacity) { _entries.pop_back(); }
+    _entries.insert(_entries.begin(), entry{hash, encoded_schema, schema});
+    return schema;
+  }
+
+ private:
+  static constexpr std::size_t capacity = 16;
+
+  struct entry {
+    std::size_t hash;
+    std::string encoded_schema;
+    schema_ptr schema;
+  };
+
+  std::mutex _mutex;
+  std::vector<entry> _entries;  ///< Entries from the most to the least recently used
+};
+
+arrow_schema_cache& get_arrow_schema_cache()
+{
+  static arrow_schema_cache cache;
+  return cache;
+}
+
 }  // namespace
 
 /**
@@ -798,8 +865,14 @@ arrow_schema_data_types aggregate_reader_metadata::collect_arrow_schema() const
 
 void aggregate_reader_metadata::apply_arrow_schema()
 {
-  // Collect the arrow schema from the key value section of Parquet metadata
-  auto arrow_schema_root = collect_arrow_schema();
+  auto const it = keyval_maps[0].find(ARROW_SCHEMA_KEY);
+  if (it == keyval_maps[0].end()) { return; }
+
+  // Collect the arrow schema from the key value section of Parquet metadata, unless the same
+  // schema was collected before
+  auto const arrow_schema = get_arrow_schema_cache().get_or_collect(
+    it->second, [this]() { return collect_arrow_schema(); });
+  auto const& arrow_schema_root = *arrow_schema;
 
   // Check if empty arrow schema collected
   if (arrow_schema_root.type.id() == type_id::EMPTY and arrow_schema_root.children.size() == 0) {
@@ -175,8 +175,10 @@ class aggregate_reader_metadata {
   [[nodiscard]] arrow_schema_data_types collect_arrow_schema() const;
 
   /**
-   * @brief Co-walks the collected arrow and Parquet schema, updates
-   * dtypes and destroys the no longer needed arrow schema object(s).
+   * @brief Co-walks the collected arrow and Parquet schema and updates dtypes.
+   *
+   * Collected arrow schemas are cached by the content of their IPC message, so that files with
+   * the same arrow schema only have it decoded once.
    */
   void apply_arrow_schema();
 
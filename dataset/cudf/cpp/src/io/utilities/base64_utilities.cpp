@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024, NVIDIA CORPORATION.
+ * Copyright (c) 2024-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -62,64 +62,77 @@
 
 #include <cudf/logger.hpp>
 
-#include <thrust/iterator/counting_iterator.h>
-
-#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <string_view>
 
 // altered: use cudf namespaces
 namespace cudf::io::detail {
 
-static const std::string base64_chars =
+namespace {
+
+constexpr std::string_view base64_chars =
   "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
   "abcdefghijklmnopqrstuvwxyz"
   "0123456789+/";
 
-static constexpr unsigned char trailing_char = '=';
+constexpr char trailing_char = '=';
+
+// altered: decode characters with lookup tables instead of searching the alphabet for each one.
+// Each table maps the character at one position of a 4-character chunk to its 6 bits within the
+// 24 bits decoded from the chunk, so that a chunk is decoded with four lookups and three ORs.
+// Characters outside the alphabet map to `invalid_bits`, which no valid chunk sets.
+constexpr uint32_t invalid_bits = 1u << 24;
+
+using decode_table = std::array<uint32_t, 256>;
+
+constexpr decode_table make_decode_table(int position)
+{
+  decode_table table{};
+  for (auto& bits : table) {
+    bits = invalid_bits;
+  }
+  for (uint32_t value = 0; value < base64_chars.size(); ++value) {
+    table[static_cast<unsigned char>(base64_chars[value])] = value << (6 * (3 - position));
+  }
+  return table;
+}
+
+constexpr std::array<decode_table, 4> decode_tables{
+  make_decode_table(0), make_decode_table(1), make_decode_table(2), make_decode_table(3)};
+
+}  // namespace
 
 // Function to encode input string to base64 and return the encoded string
 std::string base64_encode(std::string_view string_to_encode)
 {
-  auto input_length = static_cast<int32_t>(string_to_encode.size());
-
-  // altered: compute number of encoding iterations = floor(multiple of 3)
-  int32_t num_iterations = (input_length / 3);
-  num_iterations += (input_length % 3) ? 1 : 0;
-
-  std::string encoded;
-  size_t const encoded_length = (input_length + 2) / 3 * 4;
-  encoded.reserve(encoded_length);
-
-  // altered: modify base64 encoder loop using STL and Thrust.
-  // TODO: Port this loop to thrust cooperative groups if needed for too-wide tables.
-  std::for_each(thrust::make_counting_iterator(0),
-                thrust::make_counting_iterator(num_iterations),
-                [&](auto&& iter) {
-                  auto idx = iter * 3;
-
-                  encoded.push_back(base64_chars[(string_to_encode[idx] & 0xfc) >> 2]);
-                  // increment the index by 1
-                  idx += 1;
-
-                  if (idx < input_length) {
-                    encoded.push_back(base64_chars[((string_to_encode[idx - 1] & 0x03) << 4) +
-                                                   ((string_to_encode[idx] & 0xf0) >> 4)]);
-                    // increment the index by 1
-                    idx += 1;
-
-                    if (idx < input_length) {
-                      encoded.push_back(base64_chars[((string_to_encode[idx - 1] & 0x0f) << 2) +
-                                                     ((string_to_encode[idx] & 0xc0) >> 6)]);
-                      encoded.push_back(base64_chars[string_to_encode[idx] & 0x3f]);
-                    } else {
-                      encoded.push_back(base64_chars[(string_to_encode[idx - 1] & 0x0f) << 2]);
-                      encoded.push_back(trailing_char);
-                    }
-                  } else {
-                    encoded.push_back(base64_chars[(string_to_encode[idx - 1] & 0x03) << 4]);
-                    encoded.push_back(trailing_char);
-                    encoded.push_back(trailing_char);
-                  }
-                });
+  // altered: encode whole 3-byte chunks into a presized output instead of appending characters
+  auto const input_length = string_to_encode.size();
+  auto const num_chunks   = input_length / 3;
+  auto const remainder    = input_length % 3;
+
+  std::string encoded((input_length + 2) / 3 * 4, trailing_char);
+  auto input  = reinterpret_cast<unsigned char const*>(string_to_encode.data());
+  auto output = encoded.data();
+
+  // Writes the characters of the first `num_chars` sextets of a 24-bit chunk
+  auto const encode_chunk = [](uint32_t bits, char* chars, int num_chars) {
+    chars[0] = base64_chars[bits >> 18];
+    chars[1] = base64_chars[(bits >> 12) & 0x3f];
+    if (num_chars > 2) { chars[2] = base64_chars[(bits >> 6) & 0x3f]; }
+    if (num_chars > 3) { chars[3] = base64_chars[bits & 0x3f]; }
+  };
+
+  for (std::size_t chunk = 0; chunk < num_chunks; ++chunk, input += 3, output += 4) {
+    encode_chunk((uint32_t{input[0]} << 16) | (uint32_t{input[1]} << 8) | input[2], output, 4);
+  }
+
+  // The last chunk of 1 or 2 bytes produces 2 or 3 characters, padded with equal signs
+  if (remainder == 1) {
+    encode_chunk(uint32_t{input[0]} << 16, output, 2);
+  } else if (remainder == 2) {
+    encode_chunk((uint32_t{input[0]} << 16) | (uint32_t{input[1]} << 8), output, 3);
+  }
 
   return encoded;
 }
@@ -135,98 +148,47 @@ std::string base64_decode(std::string_view encoded_string)
     return std::string{};
   }
 
-  size_t const input_length = encoded_string.length();
-  std::string decoded;
-
-  // altered: compute number of decoding iterations = floor (multiple of 4)
-  int32_t num_iterations = (input_length / 4);
-  num_iterations += (input_length % 4) ? 1 : 0;
-
-  //
-  // The approximate length (bytes) of the decoded string might be one or
-  // two bytes smaller, depending on the amount of trailing equal signs
-  // in the encoded string. This approximation is needed to reserve
-  // enough space in the string to be returned.
-  size_t const approx_decoded_length = input_length / 4 * 3;
-  decoded.reserve(approx_decoded_length);
-
-  //
-  // Iterate over encoded input string in chunks. The size of all
-  // chunks except the last one is 4 bytes.
-  //
-  // The last chunk might be padded with equal signs or dots
-  // in order to make it 4 bytes in size as well, but this
-  // is not required as per RFC 2045.
-  //
-  // All chunks except the last one produce three output bytes.
-  //
-  // The last chunk produces at least one and up to three bytes.
-  //
-  // altered: modify base64 encoder loop to number of iterations using STL and Thrust.
-  // TODO: Port this loop to thrust cooperative groups if needed for too-wide tables.
-  if (not std::all_of(
-        thrust::make_counting_iterator(0),
-        thrust::make_counting_iterator(num_iterations),
-        [&](auto&& iter) {
-          int32_t idx                  = iter * 4;
-          size_t current_char_position = 0;
-          size_t char1_position        = 0;
-          size_t char2_position        = 0;
-
-          // Check for data that is not padded with equal
-          // signs (which is allowed by RFC 2045)
-          if (encoded_string[idx] == '=') { return true; }
-
-          current_char_position = base64_chars.find(encoded_string[idx]);
-          char1_position        = base64_chars.find(encoded_string[idx + 1]);
-          if (current_char_position == std::string::npos or char1_position == std::string::npos) {
-            return false;
-          }
-          // Emit the first output byte that is produced in each chunk:
-          decoded.push_back(static_cast<std::string::value_type>((current_char_position << 2) +
-                                                                 ((char1_position & 0x30) >> 4)));
-
-          // increment the index by 1
-          idx += 1;
-          // check for = padding
-          if (encoded_string[idx] == '=') { return true; }
-
-          // increment the index by 1
-          idx += 1;
-          // check for = padding
-          if (encoded_string[idx] == '=') { return true; }
-
-          char1_position = base64_chars.find(encoded_string[idx - 1]);
-          char2_position = base64_chars.find(encoded_string[idx]);
-          if (char1_position == std::string::npos or char2_position == std::string::npos) {
-            return false;
-          }
-          // Emit a chunk's second byte (which might not be produced in the last
-          // chunk).
-          decoded.push_back(static_cast<std::string::value_type>(((char1_position & 0x0f) << 4) +
-                                                                 ((char2_position & 0x3c) >> 2)));
-
-          // increment the index by 1
-          idx += 1;
-          // check for = padding
-          if (encoded_string[idx] == '=') { return true; }
-
-          char2_position        = base64_chars.find(encoded_string[idx - 1]);
-          current_char_position = base64_chars.find(encoded_string[idx]);
-          if (current_char_position == std::string::npos or char2_position == std::string::npos) {
-            return false;
-          }
-          // Emit a chunk's third byte (which might not be produced in the last
-          // chunk).
-          decoded.push_back(static_cast<std::string::value_type>(((char2_position & 0x03) << 6) +
-                                                                 current_char_position));
-
-          // all good, return true
-          return true;
-        })) {
-    return std::string{};
+  // The last chunk might be padded with equal signs in order to make it 4 bytes in size as well,
+  // but this is not required as per RFC 2045.
+  // altered: equal signs are only accepted as padding at the end of the string
+  auto input_length = encoded_string.size();
+  if (input_length % 4 == 0) {
+    input_length -= (encoded_string[input_length - 1] == trailing_char);
+    input_length -= (encoded_string[input_length - 1] == trailing_char);
   }
 
+  // All chunks except the last one produce three output bytes. The last chunk produces one or
+  // two bytes if it has two or three characters, and a single character is invalid.
+  auto const num_chunks = input_length / 4;
+  auto const remainder  = input_length % 4;
+  if (remainder == 1) { return std::string{}; }
+
+  std::string decoded(num_chunks * 3 + (remainder > 0 ? remainder - 1 : 0), '\0');
+  auto input  = reinterpret_cast<unsigned char const*>(encoded_string.data());
+  auto output = decoded.data();
+
+  // altered: decode whole chunks without branches, and check all of them for invalid characters
+  // at once at the end
+  uint32_t all_bits = 0;
+  for (std::size_t chunk = 0; chunk < num_chunks; ++chunk, input += 4, output += 3) {
+    auto const bits = decode_tables[0][input[0]] | decode_tables[1][input[1]] |
+                      decode_tables[2][input[2]] | decode_tables[3][input[3]];
+    all_bits |= bits;
+    output[0] = static_cast<char>(bits >> 16);
+    output[1] = static_cast<char>(bits >> 8);
+    output[2] = static_cast<char>(bits);
+  }
+
+  if (remainder > 0) {
+    auto const bits = decode_tables[0][input[0]] | decode_tables[1][input[1]] |
+                      (remainder == 3 ? decode_tables[2][input[2]] : 0);
+    all_bits |= bits;
+    output[0] = static_cast<char>(bits >> 16);
+    if (remainder == 3) { output[1] = static_cast<char>(bits >> 8); }
+  }
+
+  if (all_bits & invalid_bits) { return std::string{}; }
+
   // return the decoded string
   return decoded;
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2024, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -14,11 +14,24 @@
  * limitations under the License.
  */
 
+#include "jit/cache.hpp"
+
+#include "jit/file_cache.hpp"
+
 #include <cudf/utilities/error.hpp>
 
 #include <jitify2.hpp>
 
+#include <algorithm>
+#include <cstdlib>
+#include <deque>
 #include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace cudf {
 namespace jit {
@@ -44,6 +57,29 @@ std::filesystem::path get_user_home_cache_dir()
 #define LIBCUDF_KERNEL_CACHE_PATH get_user_home_cache_dir()
 #endif
 
+/**
+ * @brief Returns the ID of the current device.
+ */
+int get_current_device()
+{
+  int device = 0;
+  CUDF_CUDA_TRY(cudaGetDevice(&device));
+  return device;
+}
+
+/**
+ * @brief Returns the compute capability of the current device, such as 80 for `sm_80`.
+ */
+int get_compute_capability()
+{
+  auto const device = get_current_device();
+  int cc_major      = 0;
+  int cc_minor      = 0;
+  CUDF_CUDA_TRY(cudaDeviceGetAttribute(&cc_major, cudaDevAttrComputeCapabilityMajor, device));
+  CUDF_CUDA_TRY(cudaDeviceGetAttribute(&cc_minor, cudaDevAttrComputeCapabilityMinor, device));
+  return cc_major * 10 + cc_minor;
+}
+
 /**
  * @brief Get the string path to the JITIFY kernel cache directory.
  *
@@ -73,15 +109,7 @@ std::filesystem::path get_cache_dir()
 
     // Make per device cache based on compute capability. This is to avoid multiple devices of
     // different compute capability to access the same kernel cache.
-    int device   = 0;
-    int cc_major = 0;
-    int cc_minor = 0;
-    CUDF_CUDA_TRY(cudaGetDevice(&device));
-    CUDF_CUDA_TRY(cudaDeviceGetAttribute(&cc_major, cudaDevAttrComputeCapabilityMajor, device));
-    CUDF_CUDA_TRY(cudaDeviceGetAttribute(&cc_minor, cudaDevAttrComputeCapabilityMinor, device));
-    int const cc = cc_major * 10 + cc_minor;
-
-    kernel_cache_path /= std::to_string(cc);
+    kernel_cache_path /= std::to_string(get_compute_capability());
 
     try {
       // `mkdir -p` the kernel cache path if it doesn't exist
@@ -108,6 +136,71 @@ std::size_t try_parse_numeric_env_var(char const* const env_name, std::size_t de
   auto const value = std::getenv(env_name);
   return value != nullptr ? std::stoull(value) : default_val;
 }
+
+/**
+ * @brief Returns the compressed on-disk kernel cache, or nullptr if disk caching is disabled.
+ *
+ * The cache keeps at most `LIBCUDF_KERNEL_CACHE_LIMIT_DISK` entries, where zero disables the disk
+ * cache, and at most `LIBCUDF_KERNEL_CACHE_LIMIT_DISK_BYTES` bytes of entries. If the environment
+ * variable `LIBCUDF_KERNEL_CACHE_MANIFEST` names a manifest, the entries it lists are read into
+ * memory when the cache is created.
+ */
+file_cache* get_file_cache()
+{
+  static auto const cache = []() -> std::unique_ptr<file_cache> {
+    auto const max_entries = try_parse_numeric_env_var("LIBCUDF_KERNEL_CACHE_LIMIT_DISK", 100'000);
+    auto const max_bytes =
+      try_parse_numeric_env_var("LIBCUDF_KERNEL_CACHE_LIMIT_DISK_BYTES", std::size_t{4} << 30);
+    auto const cache_dir = max_entries == 0 ? std::string{} : get_program_cache_dir();
+    if (cache_dir.empty()) { return nullptr; }
+
+    auto cache = std::make_unique<file_cache>(cache_dir, file_cache_limits{max_entries, max_bytes});
+    if (auto const manifest = std::getenv("LIBCUDF_KERNEL_CACHE_MANIFEST"); manifest != nullptr) {
+      cache->warm_up(manifest);
+    }
+    return cache;
+  }();
+  return cache.get();
+}
+
+/**
+ * @brief Returns the key of the disk cache entry of a kernel.
+ *
+ * The key covers the preprocessed program with all of its headers, the kernel, the extra headers
+ * and options, and the architecture that `-arch=sm_.` resolves to.
+ */
+std::string get_kernel_key(jitify2::PreprocessedProgramData const& preprog,
+                           std::string const& kernel_name,
+                           jitify2::StringMap const& extra_header_sources,
+                           jitify2::StringVec const& extra_options)
+{
+  // Hashing a preprocessed program is costly, so its key is computed once per program
+  static std::mutex program_keys_mutex{};
+  static std::unordered_map<std::string, std::string> program_keys{};
+  auto const program_key = [&]() {
+    std::lock_guard<std::mutex> const program_keys_lock(program_keys_mutex);
+    auto it = program_keys.find(preprog.name());
+    if (it == program_keys.end()) {
+      auto const serialized = preprog.serialize();
+      it = program_keys.emplace(preprog.name(), file_cache::make_key({serialized})).first;
+    }
+    return it->second;
+  }();
+
+  // Headers are hashed in order of their names, which does not depend on the map
+  std::vector<std::pair<std::string, std::string>> headers(extra_header_sources.begin(),
+                                                           extra_header_sources.end());
+  std::sort(headers.begin(), headers.end());
+
+  auto const compute_capability = std::to_string(get_compute_capability());
+  std::vector<std::string_view> parts{program_key, kernel_name, compute_capability};
+  for (auto const& [name, source] : headers) {
+    parts.insert(parts.end(), {name, source});
+  }
+  parts.insert(parts.end(), extra_options.begin(), extra_options.end());
+  return file_cache::make_key(parts);
+}
+
 }  // namespace
 
 jitify2::ProgramCache<>& get_program_cache(jitify2::PreprocessedProgramData preprog)
@@ -139,5 +232,71 @@ jitify2::ProgramCache<>& get_program_cache(jitify2::PreprocessedProgramData prep
   return *(existing_cache->second);
 }
 
+jitify2::Kernel get_kernel(jitify2::PreprocessedProgramData const& preprog,
+                           std::string const& kernel_name,
+                           jitify2::StringMap const& extra_header_sources,
+                           jitify2::StringVec const& extra_options)
+{
+  auto const cache = get_file_cache();
+  if (cache == nullptr) {
+    return get_program_cache(preprog).get_kernel(
+      kernel_name, {}, extra_header_sources, extra_options);
+  }
+
+  static std::mutex programs_mutex{};
+  static std::unordered_map<std::string, jitify2::LoadedProgram> programs{};
+  static std::deque<std::string> program_order{};
+
+  auto const key = get_kernel_key(preprog, kernel_name, extra_header_sources, extra_options);
+  // A loaded program belongs to the context it was loaded in, so the devices of the same
+  // architecture share the compiled program but not the loaded one
+  auto const program_key = key + "/" + std::to_string(get_current_device());
+  {
+    std::lock_guard<std::mutex> const programs_lock(programs_mutex);
+    auto const existing_program = programs.find(program_key);
+    if (existing_program != programs.end()) {
+      return existing_program->second->get_kernel(kernel_name);
+    }
+  }
+
+  // Programs are compiled and loaded without the lock, so that the threads needing different
+  // programs don't wait for each other. Compiled programs are shared with other processes through
+  // the disk cache, and only the first process to need a program compiles it.
+  auto const serialized = cache->get_or_create(key, [&] {
+    auto const compiled = preprog.compile(kernel_name, extra_header_sources, extra_options);
+    CUDF_EXPECTS(compiled.ok(), "JIT compilation failed: " + compiled.error());
+    return compiled->serialize();
+  });
+  auto const compiled = jitify2::CompiledProgramData::deserialize(serialized);
+  CUDF_EXPECTS(compiled.ok(), "Invalid kernel cache entry: " + compiled.error());
+  auto loaded = compiled->link()->load();
+  CUDF_EXPECTS(loaded.ok(), "Failed to load JIT program: " + loaded.error());
+
+  std::lock_guard<std::mutex> const programs_lock(programs_mutex);
+  // Another thread may have loaded the same program meanwhile; its copy is kept
+  auto const [program, inserted] = programs.try_emplace(program_key, std::move(loaded));
+  if (inserted) {
+    auto const kernel_limit_proc =
+      try_parse_numeric_env_var("LIBCUDF_KERNEL_CACHE_LIMIT_PER_PROCESS", 10'000);
+    if (not program_order.empty() and program_order.size() >= kernel_limit_proc) {
+      programs.erase(program_order.front());
+      program_order.pop_front();
+    }
+    program_order.push_back(program_key);
+  }
+  return program->second->get_kernel(kernel_name);
+}
+
+std::size_t warm_up_kernel_cache(std::filesystem::path const& manifest)
+{
+  auto const cache = get_file_cache();
+  return cache == nullptr ? 0 : cache->warm_up(manifest);
+}
+
+void write_kernel_cache_manifest(std::filesystem::path const& manifest)
+{
+  if (auto const cache = get_file_cache(); cache != nullptr) { cache->write_manifest(manifest); }
+}
+
 }  // namespace jit
 }  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2024, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -18,12 +18,52 @@
 
 #include <jitify2.hpp>
 
+#include <cstddef>
+#include <filesystem>
 #include <memory>
+#include <string>
 
 namespace cudf {
 namespace jit {
 
 jitify2::ProgramCache<>& get_program_cache(jitify2::PreprocessedProgramData preprog);
 
+/**
+ * @brief Returns a kernel of a JIT program, compiling the program if it is not cached.
+ *
+ * Compiled programs are kept in memory, and on disk in a compressed cache shared by the processes
+ * of the host, keyed by a hash of the preprocessed program, the kernel, the extra headers and
+ * options, and the device architecture. The programs loaded in memory are kept per device. If disk
+ * caching is disabled, the kernel is taken from the jitify program cache of `get_program_cache`
+ * instead.
+ *
+ * @param preprog Preprocessed program
+ * @param kernel_name Name expression of the kernel
+ * @param extra_header_sources Headers added to the program, such as the source of a UDF
+ * @param extra_options Compile options added to those of the program
+ * @return The kernel
+ */
+jitify2::Kernel get_kernel(jitify2::PreprocessedProgramData const& preprog,
+                           std::string const& kernel_name,
+                           jitify2::StringMap const& extra_header_sources,
+                           jitify2::StringVec const& extra_options);
+
+/**
+ * @brief Reads the entries listed in a manifest from the disk kernel cache into memory.
+ *
+ * Used at startup to avoid reading and decompressing kernels one at a time on first use.
+ *
+ * @param manifest Manifest written by `write_kernel_cache_manifest`
+ * @return Number of entries read, or zero if disk caching is disabled
+ */
+std::size_t warm_up_kernel_cache(std::filesystem::path const& manifest);
+
+/**
+ * @brief Writes a manifest of the disk kernel cache entries used by this process.
+ *
+ * @param manifest File to write
+ */
+void write_kernel_cache_manifest(std::filesystem::path const& manifest);
+
 }  // namespace jit
 }  // namespace cudf
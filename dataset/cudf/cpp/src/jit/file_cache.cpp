@@ -0,0 +1,365 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jit/file_cache.hpp"
+
+#include <cudf/detail/utilities/host_worker_pool.hpp>
+
+#include <zstd.h>
+
+#include <sys/file.h>
+#include <unistd.h>
+
+#include <fcntl.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <future>
+#include <system_error>
+
+namespace cudf {
+namespace jit {
+namespace {
+
+constexpr std::array<char, 8> entry_magic{'C', 'U', 'D', 'F', 'J', 'I', 'T', '1'};
+constexpr std::string_view entry_extension = ".zst";
+constexpr std::size_t key_length           = 32;
+
+// Temporary files older than this are left over from processes that failed to store an entry
+constexpr auto stale_temporary_age = std::chrono::minutes{10};
+
+/**
+ * @brief Header of an entry file, followed by the zstd frame of the contents.
+ */
+struct entry_header {
+  std::array<char, 8> magic;
+  uint64_t size;  ///< Size of the contents
+};
+
+/**
+ * @brief Continues a 64-bit FNV-1a hash over a range of bytes.
+ */
+uint64_t hash_bytes(uint64_t hash, void const* data, std::size_t size)
+{
+  constexpr uint64_t prime = 0x0000'0100'0000'01b3;
+  auto const bytes         = static_cast<unsigned char const*>(data);
+  for (std::size_t i = 0; i < size; ++i) {
+    hash = (hash ^ bytes[i]) * prime;
+  }
+  return hash;
+}
+
+/**
+ * @brief Mixes the bits of a hash value, so that every bit of the key depends on all the input.
+ */
+uint64_t finalize(uint64_t hash)
+{
+  hash = (hash ^ (hash >> 30)) * 0xbf58'476d'1ce4'e5b9;
+  hash = (hash ^ (hash >> 27)) * 0x94d0'49bb'1331'11eb;
+  return hash ^ (hash >> 31);
+}
+
+bool is_key(std::string_view key)
+{
+  return key.size() == key_length && std::all_of(key.begin(), key.end(), [](char c) {
+           return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f');
+         });
+}
+
+/**
+ * @brief Exclusive `flock` on a file, held for the lifetime of the object.
+ *
+ * The lock is not taken if the file cannot be opened, such as on a read-only file system.
+ */
+class file_lock {
+ public:
+  file_lock(std::filesystem::path const& path, bool blocking)
+    : _fd{open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0666)}
+  {
+    if (_fd != -1 && flock(_fd, LOCK_EX | (blocking ? 0 : LOCK_NB)) != 0) {
+      close(_fd);
+      _fd = -1;
+    }
+  }
+  file_lock(file_lock const&)            = delete;
+  file_lock& operator=(file_lock const&) = delete;
+  ~file_lock()
+  {
+    if (_fd != -1) {
+      flock(_fd, LOCK_UN);
+      close(_fd);
+    }
+  }
+
+  [[nodiscard]] bool is_locked() const { return _fd != -1; }
+
+ private:
+  int _fd;
+};
+
+std::string compress(std::string_view value)
+{
+  std::string entry(sizeof(entry_header) + ZSTD_compressBound(value.size()), '\0');
+  entry_header const header{entry_magic, value.size()};
+  std::memcpy(entry.data(), &header, sizeof(header));
+  auto const compressed_size = ZSTD_compress(entry.data() + sizeof(header),
+                                             entry.size() - sizeof(header),
+                                             value.data(),
+                                             value.size(),
+                                             ZSTD_CLEVEL_DEFAULT);
+  if (ZSTD_isError(compressed_size)) { return {}; }
+  entry.resize(sizeof(header) + compressed_size);
+  return entry;
+}
+
+std::optional<std::string> decompress(std::string_view entry)
+{
+  entry_header header{};
+  if (entry.size() < sizeof(header)) { return std::nullopt; }
+  std::memcpy(&header, entry.data(), sizeof(header));
+  if (header.magic != entry_magic ||
+      ZSTD_getFrameContentSize(entry.data() + sizeof(header), entry.size() - sizeof(header)) !=
+        header.size) {
+    return std::nullopt;
+  }
+  std::string value(header.size, '\0');
+  auto const size = ZSTD_decompress(
+    value.data(), value.size(), entry.data() + sizeof(header), entry.size() - sizeof(header));
+  if (ZSTD_isError(size) || size != header.size) { return std::nullopt; }
+  return value;
+}
+
+/**
+ * @brief Writes a file as a whole by writing a temporary file and renaming it into place.
+ */
+bool write_atomically(std::filesystem::path const& path, std::string_view contents)
+{
+  static std::atomic<uint64_t> counter{0};
+  auto temporary = path;
+  temporary += ".tmp." + std::to_string(getpid()) + "." + std::to_string(counter++);
+  {
+    std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+    file.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+    if (!file.flush()) {
+      std::error_code ec;
+      std::filesystem::remove(temporary, ec);
+      return false;
+    }
+  }
+  std::error_code ec;
+  std::filesystem::rename(temporary, path, ec);
+  if (ec) { std::filesystem::remove(temporary, ec); }
+  return !ec;
+}
+
+}  // namespace
+
+file_cache::file_cache(std::filesystem::path directory, file_cache_limits limits)
+  : _directory{std::move(directory)}, _limits{limits}
+{
+  std::error_code ec;
+  std::filesystem::create_directories(_directory / "locks", ec);
+}
+
+std::string file_cache::make_key(std::vector<std::string_view> const& parts)
+{
+  // Two hashes from different seeds form a 128-bit key; the size of each part is hashed as well,
+  // so that moving text from one part to the next changes the key
+  uint64_t low  = 0xcbf2'9ce4'8422'2325;
+  uint64_t high = 0x6c62'272e'07bb'0142;
+  for (auto const part : parts) {
+    uint64_t const size = part.size();
+    low  = hash_bytes(hash_bytes(low, &size, sizeof(size)), part.data(), part.size());
+    high = hash_bytes(hash_bytes(high, &size, sizeof(size)), part.data(), part.size());
+  }
+
+  constexpr char digits[] = "0123456789abcdef";
+  std::string key(key_length, '0');
+  auto const words = std::array<uint64_t, 2>{finalize(high), finalize(low ^ high)};
+  for (std::size_t i = 0; i < key_length; ++i) {
+    key[i] = digits[(words[i / 16] >> (60 - 4 * (i % 16))) & 0xf];
+  }
+  return key;
+}
+
+std::filesystem::path file_cache::entry_path(std::string const& key) const
+{
+  auto path = _directory / key;
+  path += entry_extension;
+  return path;
+}
+
+std::optional<std::string> file_cache::read_entry(std::string const& key) const
+{
+  std::ifstream file(entry_path(key), std::ios::binary | std::ios::ate);
+  if (!file) { return std::nullopt; }
+  std::string entry(static_cast<std::size_t>(file.tellg()), '\0');
+  file.seekg(0);
+  if (!file.read(entry.data(), static_cast<std::streamsize>(entry.size()))) {
+    return std::nullopt;
+  }
+  return decompress(entry);
+}
+
+void file_cache::record_use(std::string const& key)
+{
+  std::lock_guard<std::mutex> const lock(_mutex);
+  if (_used.insert(key).second) { _used_keys.push_back(key); }
+}
+
+std::optional<std::string> file_cache::load(std::string const& key)
+{
+  auto value = [&]() -> std::optional<std::string> {
+    std::lock_guard<std::mutex> const lock(_mutex);
+    auto const it = _preloaded.find(key);
+    if (it == _preloaded.end()) { return std::nullopt; }
+    auto preloaded = std::move(it->second);
+    _preloaded.erase(it);
+    return preloaded;
+  }();
+  if (value.has_value()) {
+    record_use(key);
+    return value;
+  }
+
+  value = read_entry(key);
+  if (value.has_value()) {
+    // A read makes the entry the most recently used
+    std::error_code ec;
+    std::filesystem::last_write_time(
+      entry_path(key), std::filesystem::file_time_type::clock::now(), ec);
+    record_use(key);
+  }
+  return value;
+}
+
+bool file_cache::store(std::string const& key, std::string_view value)
+{
+  auto const entry = compress(value);
+  if (entry.empty() || !write_atomically(entry_path(key), entry)) { return false; }
+  record_use(key);
+  prune();
+  return true;
+}
+
+std::string file_cache::get_or_create(std::string const& key,
+                                      std::function<std::string()> const& create)
+{
+  if (auto value = load(key)) { return std::move(*value); }
+
+  // Another process may have created the entry while this one waited for the lock
+  auto const lock_index = std::stoi(key.substr(0, 2), nullptr, 16) % num_lock_files;
+  file_lock const lock(_directory / "locks" / (std::to_string(lock_index) + ".lock"), true);
+  if (auto value = load(key)) { return std::move(*value); }
+
+  auto value = create();
+  store(key, value);
+  return value;
+}
+
+void file_cache::prune()
+{
+  file_lock const lock(_directory / "locks" / "prune.lock", false);
+  if (!lock.is_locked()) { return; }
+
+  struct entry_info {
+    std::filesystem::path path;
+    std::filesystem::file_time_type time;
+    std::uintmax_t size;
+  };
+  std::vector<entry_info> entries;
+  std::uintmax_t total_size = 0;
+  auto const now            = std::filesystem::file_time_type::clock::now();
+
+  std::error_code ec;
+  for (auto const& file : std::filesystem::directory_iterator(_directory, ec)) {
+    std::error_code file_ec;
+    if (!file.is_regular_file(file_ec)) { continue; }
+    auto const time = file.last_write_time(file_ec);
+    auto const size = file.file_size(file_ec);
+    if (file_ec) { continue; }
+    auto const name = file.path().filename().string();
+    if (name.find(".tmp.") != std::string::npos) {
+      if (now - time > stale_temporary_age) { std::filesystem::remove(file.path(), file_ec); }
+    } else if (file.path().extension() == entry_extension) {
+      entries.push_back({file.path(), time, size});
+      total_size += size;
+    }
+  }
+  if (entries.size() <= _limits.max_entries && total_size <= _limits.max_bytes) { return; }
+
+  std::sort(entries.begin(), entries.end(), [](auto const& lhs, auto const& rhs) {
+    return lhs.time < rhs.time;
+  });
+  auto num_entries = entries.size();
+  for (auto const& entry : entries) {
+    if (num_entries <= _limits.max_entries && total_size <= _limits.max_bytes) { break; }
+    std::filesystem::remove(entry.path, ec);
+    --num_entries;
+    total_size -= entry.size;
+  }
+}
+
+std::size_t file_cache::warm_up(std::filesystem::path const& manifest)
+{
+  std::vector<std::string> keys;
+  {
+    std::ifstream file(manifest);
+    std::string key;
+    while (std::getline(file, key)) {
+      if (is_key(key)) { keys.push_back(std::move(key)); }
+    }
+  }
+
+  std::vector<std::future<std::optional<std::string>>> tasks;
+  tasks.reserve(keys.size());
+  for (auto const& key : keys) {
+    tasks.emplace_back(cudf::detail::host_worker_pool().submit_task(
+      [this, &key] { return read_entry(key); }));
+  }
+
+  std::size_t num_loaded = 0;
+  std::lock_guard<std::mutex> const lock(_mutex);
+  for (std::size_t i = 0; i < keys.size(); ++i) {
+    auto value = std::move(tasks[i]).get();
+    if (value.has_value()) {
+      _preloaded.insert_or_assign(keys[i], std::move(*value));
+      ++num_loaded;
+    }
+  }
+  return num_loaded;
+}
+
+void file_cache::write_manifest(std::filesystem::path const& manifest) const
+{
+  std::string contents;
+  {
+    std::lock_guard<std::mutex> const lock(_mutex);
+    for (auto const& key : _used_keys) {
+      contents += key;
+      contents += '\n';
+    }
+  }
+  write_atomically(manifest, contents);
+}
+
+}  // namespace jit
+}  // namespace cudf
@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/utilities/export.hpp>
+
+#include <cstddef>
+#include <filesystem>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace CUDF_EXPORT cudf {
+namespace jit {
+
+/**
+ * @brief Limits on the entries a file cache keeps on disk.
+ */
+struct file_cache_limits {
+  std::size_t max_entries;  ///< Maximum number of entries
+  std::size_t max_bytes;    ///< Maximum total size of the compressed entries in bytes
+};
+
+/**
+ * @brief Content-addressed cache of compiled programs on disk, shared by the processes of a host.
+ *
+ * Entries are keyed by a hash of everything that determines the compiled program, so that
+ * processes compiling the same program find the same entry, and are stored compressed with zstd.
+ * An entry is written to a temporary file and renamed into place, so that readers only ever see
+ * whole entries and need no locks. Creating an entry takes an exclusive `flock` on one of a fixed
+ * set of lock files selected by the key, so that processes racing to create the same entry wait
+ * for the first one instead of all compiling it.
+ *
+ * The modification time of an entry is updated when it is read, and after an entry is stored the
+ * least recently used entries are removed until the cache is within its limits. Entries listed in
+ * a manifest, such as the entries used by a previous run, can be read ahead of their use.
+ *
+ * Failures to read or write the cache are not errors: a corrupt or missing entry is a miss, and an
+ * entry that cannot be stored is simply not cached.
+ */
+class file_cache {
+ public:
+  /**
+   * @brief Constructs a cache of the entries in a directory, creating the directory if needed.
+   *
+   * @param directory Directory of the entries
+   * @param limits Limits on the entries kept in the directory
+   */
+  file_cache(std::filesystem::path directory, file_cache_limits limits);
+
+  /**
+   * @brief Returns the key of the entry of a program.
+   *
+   * @param parts Everything that determines the compiled program, such as its preprocessed source,
+   * compile options and target architecture
+   * @return Key of 32 hexadecimal digits
+   */
+  [[nodiscard]] static std::string make_key(std::vector<std::string_view> const& parts);
+
+  /**
+   * @brief Reads an entry.
+   *
+   * @param key Key of the entry
+   * @return The entry, or no value if the cache has no valid entry for the key
+   */
+  [[nodiscard]] std::optional<std::string> load(std::string const& key);
+
+  /**
+   * @brief Stores an entry, replacing any existing entry with the key, and prunes the cache.
+   *
+   * @param key Key of the entry
+   * @param value Contents of the entry
+   * @return Whether the entry was stored
+   */
+  bool store(std::string const& key, std::string_view value);
+
+  /**
+   * @brief Reads an entry, or creates and stores it if the cache has no entry for the key.
+   *
+   * Only one process of the host creates a given entry at a time; the others wait for the entry
+   * and read it.
+   *
+   * @param key Key of the entry
+   * @param create Function that creates the contents of the entry
+   * @return The entry
+   */
+  std::string get_or_create(std::string const& key, std::function<std::string()> const& create);
+
+  /**
+   * @brief Removes the least recently used entries until the cache is within its limits.
+   *
+   * Does nothing if another process is pruning the cache.
+   */
+  void prune();
+
+  /**
+   * @brief Reads the entries listed in a manifest into memory, in parallel.
+   *
+   * Later reads of these entries are served from memory.
+   *
+   * @param manifest File with one key per line
+   * @return Number of entries read
+   */
+  std::size_t warm_up(std::filesystem::path const& manifest);
+
+  /**
+   * @brief Writes the keys of the entries read or stored by this process to a manifest.
+   *
+   * @param manifest File to write
+   */
+  void write_manifest(std::filesystem::path const& manifest) const;
+
+ private:
+  static constexpr int num_lock_files = 256;
+
+  [[nodiscard]] std::filesystem::path entry_path(std::string const& key) const;
+  [[nodiscard]] std::optional<std::string> read_entry(std::string const& key) const;
+  void record_use(std::string const& key);
+
+  std::filesystem::path _directory;
+  file_cache_limits _limits;
+
+  mutable std::mutex _mutex;
+  std::unordered_map<std::string, std::string> _preloaded;  ///< Entries read by `warm_up`
+  std::vector<std::string> _used_keys;                      ///< Keys in order of first use
+  std::unordered_set<std::string> _used;
+};
+
+}  // namespace jit
+}  // namespace CUDF_EXPORT cudf
@@ -1282,10 +1282,11 @@ std::unique_ptr<column> rolling_window_udf(column_view const& input,
                    preceding_window_str.c_str(),
                    following_window_str.c_str());
 
-  cudf::jit::get_program_cache(*rolling_jit_kernel_cu_jit)
-    .get_kernel(
-      kernel_name, {}, {{"rolling/jit/operation-udf.hpp", cuda_source}}, {"-arch=sm_."})  //
-    ->configure_1d_max_occupancy(0, 0, nullptr, stream.value())                           //
+  cudf::jit::get_kernel(*rolling_jit_kernel_cu_jit,
+                        kernel_name,
+                        {{"rolling/jit/operation-udf.hpp", cuda_source}},
+                        {"-arch=sm_."})
+    ->configure_1d_max_occupancy(0, 0, nullptr, stream.value())
     ->launch(input.size(),
              cudf::jit::get_data_ptr(input),
              input.null_mask(),
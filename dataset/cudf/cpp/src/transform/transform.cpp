@@ -154,17 +154,16 @@ column_views_to_device(std::vector<ColumnView> const& views,
 
 jitify2::Kernel get_kernel(std::string const& kernel_name, std::string const& cuda_source)
 {
-  return cudf::jit::get_program_cache(*transform_jit_kernel_cu_jit)
-    .get_kernel(kernel_name,
-                {},
-                {{"transform/jit/operation-udf.hpp", cuda_source}},
-                {"-arch=sm_.",
-                 "--device-int128",
-                 // TODO: remove when we upgrade to CCCL >= 3.0
-
-                 // CCCL WAR for not using the correct INT128 feature macro:
-                 // https://github.com/NVIDIA/cccl/issues/3801
-                 "-D__SIZEOF_INT128__=16"});
+  return cudf::jit::get_kernel(*transform_jit_kernel_cu_jit,
+                               kernel_name,
+                               {{"transform/jit/operation-udf.hpp", cuda_source}},
+                               {"-arch=sm_.",
+                                "--device-int128",
+                                // TODO: remove when we upgrade to CCCL >= 3.0
+
+                                // CCCL WAR for not using the correct INT128 feature macro:
+                                // https://github.com/NVIDIA/cccl/issues/3801
+                                "-D__SIZEOF_INT128__=16"});
 }
 
 input_column_reflection reflect_input_column(size_type base_column_size, column_view column)
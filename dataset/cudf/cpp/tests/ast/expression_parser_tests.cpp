@@ -0,0 +1,237 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/default_stream.hpp>
+
+#include <cudf/ast/detail/expression_parser.hpp>
+#include <cudf/ast/expressions.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/transform.hpp>
+#include <cudf/utilities/memory_resource.hpp>
+
+#include <vector>
+
+template <typename T>
+using column_wrapper = cudf::test::fixed_width_column_wrapper<T>;
+
+using op = cudf::ast::ast_operator;
+
+struct ExpressionParserTest : public cudf::test::BaseFixture {
+ protected:
+  /// Returns the operators of the plan generated for `expr`
+  std::vector<op> plan_operators(cudf::ast::expression const& expr,
+                                 cudf::table_view const& table,
+                                 bool has_nulls = false,
+                                 bool optimize  = true)
+  {
+    auto const parser = cudf::ast::detail::expression_parser{
+      expr, table, has_nulls, cudf::test::get_default_stream(), mr(), optimize};
+    auto const plan   = parser.host_expression_data();
+    return std::vector<op>(plan.operators.begin(), plan.operators.end());
+  }
+
+  /// Returns the number of literals in the plan generated for `expr`
+  std::size_t plan_literals(cudf::ast::expression const& expr, cudf::table_view const& table)
+  {
+    auto const parser = cudf::ast::detail::expression_parser{
+      expr, table, false, cudf::test::get_default_stream(), mr()};
+    return parser.host_expression_data().literals.size();
+  }
+};
+
+TEST_F(ExpressionParserTest, CommonSubexpressions)
+{
+  auto c_0   = column_wrapper<int32_t>{1, 2, 3, 4};
+  auto c_1   = column_wrapper<int32_t>{1, 1, 2, 3};
+  auto table = cudf::table_view{{c_0, c_1}};
+
+  auto one       = cudf::numeric_scalar<int32_t>(1);
+  auto five      = cudf::numeric_scalar<int32_t>(5);
+  auto col_ref_0 = cudf::ast::column_reference(0);
+  auto col_ref_1 = cudf::ast::column_reference(1);
+  auto lit_one   = cudf::ast::literal(one);
+  auto lit_five  = cudf::ast::literal(five);
+
+  // a * b > 1 && b * a < 5 evaluates a * b once
+  auto product_ab = cudf::ast::operation(op::MUL, col_ref_0, col_ref_1);
+  auto product_ba = cudf::ast::operation(op::MUL, col_ref_1, col_ref_0);
+  auto greater    = cudf::ast::operation(op::GREATER, product_ab, lit_one);
+  auto less       = cudf::ast::operation(op::LESS, product_ba, lit_five);
+  auto expression = cudf::ast::operation(op::LOGICAL_AND, greater, less);
+
+  EXPECT_EQ(plan_operators(expression, table),
+            (std::vector<op>{op::MUL, op::GREATER, op::LESS, op::LOGICAL_AND}));
+  EXPECT_EQ(plan_operators(expression, table, false, false),
+            (std::vector<op>{op::MUL, op::GREATER, op::MUL, op::LESS, op::LOGICAL_AND}));
+
+  auto expected = column_wrapper<bool>{false, true, false, false};
+  auto result   = cudf::compute_column(table, expression);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view());
+}
+
+TEST_F(ExpressionParserTest, CommonSubexpressionsWithNulls)
+{
+  auto c_0   = column_wrapper<int32_t>{{1, 2, 3, 4}, {true, false, true, true}};
+  auto table = cudf::table_view{{c_0}};
+
+  // (a + a) * (a + a) reuses the intermediate holding a + a
+  auto col_ref_0  = cudf::ast::column_reference(0);
+  auto sum_0      = cudf::ast::operation(op::ADD, col_ref_0, col_ref_0);
+  auto sum_1      = cudf::ast::operation(op::ADD, col_ref_0, col_ref_0);
+  auto expression = cudf::ast::operation(op::MUL, sum_0, sum_1);
+
+  EXPECT_EQ(plan_operators(expression, table, true), (std::vector<op>{op::ADD, op::MUL}));
+
+  auto expected = column_wrapper<int32_t>{{4, 0, 36, 64}, {true, false, true, true}};
+  auto result   = cudf::compute_column(table, expression);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view());
+}
+
+TEST_F(ExpressionParserTest, ConstantFolding)
+{
+  auto c_0   = column_wrapper<int32_t>{1, 2, 3, 4};
+  auto table = cudf::table_view{{c_0}};
+
+  auto two       = cudf::numeric_scalar<int32_t>(2);
+  auto three     = cudf::numeric_scalar<int32_t>(3);
+  auto col_ref_0 = cudf::ast::column_reference(0);
+  auto lit_two   = cudf::ast::literal(two);
+  auto lit_three = cudf::ast::literal(three);
+
+  // a + 2 * 3 is a + 6
+  auto product    = cudf::ast::operation(op::MUL, lit_two, lit_three);
+  auto expression = cudf::ast::operation(op::ADD, col_ref_0, product);
+
+  EXPECT_EQ(plan_operators(expression, table), (std::vector<op>{op::ADD}));
+  EXPECT_EQ(plan_literals(expression, table), std::size_t{1});
+
+  auto expected = column_wrapper<int32_t>{7, 8, 9, 10};
+  auto result   = cudf::compute_column(table, expression);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view());
+}
+
+TEST_F(ExpressionParserTest, ConstantExpression)
+{
+  auto c_0   = column_wrapper<int32_t>{1, 2, 3};
+  auto table = cudf::table_view{{c_0}};
+
+  auto two        = cudf::numeric_scalar<int32_t>(2);
+  auto three      = cudf::numeric_scalar<int32_t>(3);
+  auto null       = cudf::numeric_scalar<int32_t>(0, false);
+  auto lit_two    = cudf::ast::literal(two);
+  auto lit_three  = cudf::ast::literal(three);
+  auto lit_null   = cudf::ast::literal(null);
+  auto expression = cudf::ast::operation(op::LESS, lit_two, lit_three);
+  auto is_null    = cudf::ast::operation(op::IS_NULL, lit_null);
+
+  // A folded root is written to the output by an identity operation
+  EXPECT_EQ(plan_operators(expression, table), (std::vector<op>{op::IDENTITY}));
+  EXPECT_EQ(plan_literals(expression, table), std::size_t{1});
+  EXPECT_EQ(plan_operators(is_null, table, true), (std::vector<op>{op::IDENTITY}));
+
+  auto expected = column_wrapper<bool>{true, true, true};
+  auto result   = cudf::compute_column(table, expression);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view());
+}
+
+TEST_F(ExpressionParserTest, UndefinedOperationsAreNotFolded)
+{
+  auto c_0   = column_wrapper<int32_t>{1, 2, 3};
+  auto table = cudf::table_view{{c_0}};
+
+  auto one         = cudf::numeric_scalar<int32_t>(1);
+  auto zero        = cudf::numeric_scalar<int32_t>(0);
+  auto null        = cudf::numeric_scalar<int32_t>(0, false);
+  auto two         = cudf::numeric_scalar<double>(2);
+  auto lit_one     = cudf::ast::literal(one);
+  auto lit_zero    = cudf::ast::literal(zero);
+  auto lit_null    = cudf::ast::literal(null);
+  auto lit_two     = cudf::ast::literal(two);
+  auto division    = cudf::ast::operation(op::DIV, lit_one, lit_zero);
+  auto null_sum    = cudf::ast::operation(op::ADD, lit_one, lit_null);
+  auto square_root = cudf::ast::operation(op::SQRT, lit_two);
+
+  // Division by zero, operations on nulls and transcendental functions are left to the device
+  EXPECT_EQ(plan_operators(division, table), (std::vector<op>{op::DIV}));
+  EXPECT_EQ(plan_operators(null_sum, table, true), (std::vector<op>{op::ADD}));
+  EXPECT_EQ(plan_operators(square_root, table), (std::vector<op>{op::SQRT}));
+}
+
+TEST_F(ExpressionParserTest, BooleanSimplification)
+{
+  auto c_0   = column_wrapper<int32_t>{{1, 2, 3, 4}, {true, true, false, true}};
+  auto c_1   = column_wrapper<int32_t>{2, 2, 2, 2};
+  auto table = cudf::table_view{{c_0, c_1}};
+
+  auto true_scalar  = cudf::numeric_scalar<bool>(true);
+  auto false_scalar = cudf::numeric_scalar<bool>(false);
+  auto col_ref_0    = cudf::ast::column_reference(0);
+  auto col_ref_1    = cudf::ast::column_reference(1);
+  auto lit_true     = cudf::ast::literal(true_scalar);
+  auto lit_false    = cudf::ast::literal(false_scalar);
+  auto less         = cudf::ast::operation(op::LESS, col_ref_0, col_ref_1);
+
+  // x && true, x || false, x && x and !!x are x
+  auto and_true = cudf::ast::operation(op::LOGICAL_AND, less, lit_true);
+  auto or_false = cudf::ast::operation(op::NULL_LOGICAL_OR, lit_false, less);
+  auto and_self = cudf::ast::operation(op::LOGICAL_AND, less, less);
+  auto not_less = cudf::ast::operation(op::NOT, less);
+  auto not_not  = cudf::ast::operation(op::NOT, not_less);
+  for (auto const* expression : std::vector<cudf::ast::expression const*>{
+         &and_true, &or_false, &and_self, &not_not}) {
+    EXPECT_EQ(plan_operators(*expression, table, true), (std::vector<op>{op::LESS}));
+  }
+
+  // x || true is true only if a null x does not make it null
+  auto or_true      = cudf::ast::operation(op::LOGICAL_OR, less, lit_true);
+  auto null_or_true = cudf::ast::operation(op::NULL_LOGICAL_OR, less, lit_true);
+  EXPECT_EQ(plan_operators(or_true, table, true), (std::vector<op>{op::LESS, op::LOGICAL_OR}));
+  EXPECT_EQ(plan_operators(or_true, table, false), (std::vector<op>{op::IDENTITY}));
+  EXPECT_EQ(plan_operators(null_or_true, table, true), (std::vector<op>{op::IDENTITY}));
+
+  auto expected_and = column_wrapper<bool>{{true, false, false, false}, {true, true, false, true}};
+  auto result_and   = cudf::compute_column(table, and_true);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_and, result_and->view());
+
+  auto expected_or = column_wrapper<bool>{{true, true, true, true}, {true, true, false, true}};
+  auto result_or   = cudf::compute_column(table, or_true);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_or, result_or->view());
+}
+
+TEST_F(ExpressionParserTest, OptimizationDisabled)
+{
+  auto c_0   = column_wrapper<int32_t>{1, 2, 3};
+  auto table = cudf::table_view{{c_0}};
+
+  auto true_scalar = cudf::numeric_scalar<bool>(true);
+  auto col_ref_0   = cudf::ast::column_reference(0);
+  auto lit_true    = cudf::ast::literal(true_scalar);
+  auto is_null     = cudf::ast::operation(op::IS_NULL, col_ref_0);
+  auto and_true    = cudf::ast::operation(op::LOGICAL_AND, is_null, lit_true);
+  auto expression  = cudf::ast::operation(op::LOGICAL_AND, and_true, and_true);
+
+  EXPECT_EQ(plan_operators(expression, table, false, false),
+            (std::vector<op>{op::IS_NULL,
+                             op::LOGICAL_AND,
+                             op::IS_NULL,
+                             op::LOGICAL_AND,
+                             op::LOGICAL_AND}));
+  EXPECT_EQ(plan_operators(expression, table), (std::vector<op>{op::IS_NULL}));
+}
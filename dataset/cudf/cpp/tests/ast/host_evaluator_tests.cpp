@@ -0,0 +1,269 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/default_stream.hpp>
+#include <cudf_test/nanoarrow_utils.hpp>
+
+#include <cudf/ast/detail/host_evaluator.hpp>
+#include <cudf/ast/expressions.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/interop.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/transform.hpp>
+#include <cudf/wrappers/durations.hpp>
+#include <cudf/wrappers/timestamps.hpp>
+
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+template <typename T>
+using column_wrapper = cudf::test::fixed_width_column_wrapper<T>;
+
+using op = cudf::ast::ast_operator;
+
+struct HostEvaluatorTest : public cudf::test::BaseFixture {
+ protected:
+  /// Evaluates `expr` on a host copy of `table` and copies the result back to the device
+  std::unique_ptr<cudf::column> compute_column_host(cudf::table_view const& table,
+                                                    cudf::ast::expression const& expr,
+                                                    bool vectorized)
+  {
+    auto const stream   = cudf::test::get_default_stream();
+    auto const metadata = std::vector<cudf::column_metadata>(table.num_columns());
+    auto const schema   = cudf::to_arrow_schema(table, metadata);
+    auto const input    = cudf::to_arrow_host(table, stream);
+    auto const [result_schema, result] =
+      cudf::ast::detail::compute_column_host(expr, schema.get(), &input->array, vectorized, stream);
+    EXPECT_EQ(result->device_type, ARROW_DEVICE_CPU);
+    return cudf::from_arrow_host_column(result_schema.get(), result.get(), stream, mr());
+  }
+
+  /// Checks that both host evaluation paths produce the result of `cudf::compute_column`
+  void expect_conformance(cudf::table_view const& table, cudf::ast::expression const& expr)
+  {
+    auto const expected = cudf::compute_column(table, expr, cudf::test::get_default_stream());
+    for (bool vectorized : {true, false}) {
+      auto const result = compute_column_host(table, expr, vectorized);
+      CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected->view(), result->view());
+    }
+  }
+};
+
+TEST_F(HostEvaluatorTest, Arithmetic)
+{
+  auto c_0   = column_wrapper<int32_t>{{3, 20, 1, 50, -7}, {true, true, false, true, true}};
+  auto c_1   = column_wrapper<int32_t>{{10, 7, 20, 0, 3}, {true, false, true, true, true}};
+  auto table = cudf::table_view{{c_0, c_1}};
+
+  auto col_ref_0 = cudf::ast::column_reference(0);
+  auto col_ref_1 = cudf::ast::column_reference(1);
+  auto two       = cudf::numeric_scalar<int32_t>(2);
+  auto lit_two   = cudf::ast::literal(two);
+
+  for (auto const binary_op :
+       {op::ADD, op::SUB, op::MUL, op::TRUE_DIV, op::BITWISE_AND, op::BITWISE_XOR, op::POW}) {
+    expect_conformance(table, cudf::ast::operation(binary_op, col_ref_0, col_ref_1));
+    expect_conformance(table, cudf::ast::operation(binary_op, lit_two, col_ref_1));
+  }
+
+  // a * 2 + b
+  auto product    = cudf::ast::operation(op::MUL, col_ref_0, lit_two);
+  auto expression = cudf::ast::operation(op::ADD, product, col_ref_1);
+  expect_conformance(table, expression);
+}
+
+TEST_F(HostEvaluatorTest, Comparison)
+{
+  auto c_0   = column_wrapper<double>{{1.5, 2.0, 3.0, -4.0}, {true, false, true, true}};
+  auto c_1   = column_wrapper<double>{1.5, 1.0, 4.0, -5.0};
+  auto table = cudf::table_view{{c_0, c_1}};
+
+  auto col_ref_0 = cudf::ast::column_reference(0);
+  auto col_ref_1 = cudf::ast::column_reference(1);
+  for (auto const binary_op : {op::EQUAL,
+                               op::NOT_EQUAL,
+                               op::LESS,
+                               op::GREATER,
+                               op::LESS_EQUAL,
+                               op::GREATER_EQUAL,
+                               op::NULL_EQUAL}) {
+    expect_conformance(table, cudf::ast::operation(binary_op, col_ref_0, col_ref_1));
+  }
+}
+
+TEST_F(HostEvaluatorTest, NullAwareOperators)
+{
+  auto c_0   = column_wrapper<bool>{{true, false, true, false, true, false, true},
+                                    {true, true, false, false, true, true, false}};
+  auto c_1   = column_wrapper<bool>{{true, true, true, true, false, false, false},
+                                    {true, true, true, false, false, false, true}};
+  auto table = cudf::table_view{{c_0, c_1}};
+
+  auto col_ref_0 = cudf::ast::column_reference(0);
+  auto col_ref_1 = cudf::ast::column_reference(1);
+  auto null      = cudf::numeric_scalar<bool>(false, false);
+  auto lit_null  = cudf::ast::literal(null);
+  for (auto const binary_op : {op::LOGICAL_AND,
+                               op::LOGICAL_OR,
+                               op::NULL_LOGICAL_AND,
+                               op::NULL_LOGICAL_OR,
+                               op::NULL_EQUAL}) {
+    expect_conformance(table, cudf::ast::operation(binary_op, col_ref_0, col_ref_1));
+    expect_conformance(table, cudf::ast::operation(binary_op, col_ref_0, lit_null));
+  }
+  expect_conformance(table, cudf::ast::operation(op::IS_NULL, col_ref_0));
+  expect_conformance(table, cudf::ast::operation(op::NOT, col_ref_1));
+}
+
+TEST_F(HostEvaluatorTest, UnaryOperators)
+{
+  auto c_0   = column_wrapper<double>{{0.25, 4.0, -1.5, 9.0}, {true, true, true, false}};
+  auto c_1   = column_wrapper<int64_t>{{-3, 0, 7, 12}, {false, true, true, true}};
+  auto table = cudf::table_view{{c_0, c_1}};
+
+  auto col_ref_0 = cudf::ast::column_reference(0);
+  auto col_ref_1 = cudf::ast::column_reference(1);
+  for (auto const unary_op :
+       {op::IDENTITY, op::ABS, op::CEIL, op::FLOOR, op::RINT, op::CAST_TO_INT64, op::NOT}) {
+    expect_conformance(table, cudf::ast::operation(unary_op, col_ref_0));
+  }
+  for (auto const unary_op :
+       {op::IDENTITY, op::ABS, op::BIT_INVERT, op::CAST_TO_FLOAT64, op::CAST_TO_UINT64}) {
+    expect_conformance(table, cudf::ast::operation(unary_op, col_ref_1));
+  }
+}
+
+TEST_F(HostEvaluatorTest, Chrono)
+{
+  using cudf::duration_s;
+  using cudf::timestamp_s;
+  auto c_0 = column_wrapper<timestamp_s, timestamp_s::rep>{{10, 20, 30}, {true, false, true}};
+  auto c_1 = column_wrapper<timestamp_s, timestamp_s::rep>{10, 25, 5};
+  auto c_2 = column_wrapper<duration_s, duration_s::rep>{{4, -6, 9}, {true, true, false}};
+  auto table = cudf::table_view{{c_0, c_1, c_2}};
+
+  auto col_ref_0 = cudf::ast::column_reference(0);
+  auto col_ref_1 = cudf::ast::column_reference(1);
+  auto col_ref_2 = cudf::ast::column_reference(2);
+  expect_conformance(table, cudf::ast::operation(op::LESS, col_ref_0, col_ref_1));
+  expect_conformance(table, cudf::ast::operation(op::SUB, col_ref_0, col_ref_1));
+  expect_conformance(table, cudf::ast::operation(op::ADD, col_ref_2, col_ref_2));
+  expect_conformance(table, cudf::ast::operation(op::IDENTITY, col_ref_0));
+}
+
+TEST_F(HostEvaluatorTest, SlicedInput)
+{
+  auto c_0 = column_wrapper<int32_t>{{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11},
+                                     {true, false, true, true, true, false, true, true, true, true,
+                                      false}};
+  auto c_1 = column_wrapper<bool>{{true, false, true, false, true, false, true, true, false, true,
+                                   false},
+                                  {true, true, true, false, true, true, true, true, true, false,
+                                   true}};
+  auto const table = cudf::slice(cudf::table_view{{c_0, c_1}}, {3, 10}).front();
+
+  auto col_ref_0  = cudf::ast::column_reference(0);
+  auto col_ref_1  = cudf::ast::column_reference(1);
+  auto three      = cudf::numeric_scalar<int32_t>(3);
+  auto lit_three  = cudf::ast::literal(three);
+  auto greater    = cudf::ast::operation(op::GREATER, col_ref_0, lit_three);
+  auto expression = cudf::ast::operation(op::NULL_LOGICAL_OR, greater, col_ref_1);
+  expect_conformance(table, expression);
+}
+
+TEST_F(HostEvaluatorTest, LiteralExpression)
+{
+  auto c_0   = column_wrapper<int32_t>{1, 2, 3};
+  auto table = cudf::table_view{{c_0}};
+
+  auto two        = cudf::numeric_scalar<int32_t>(2);
+  auto null       = cudf::numeric_scalar<int32_t>(0, false);
+  auto lit_two    = cudf::ast::literal(two);
+  auto lit_null   = cudf::ast::literal(null);
+  auto product    = cudf::ast::operation(op::MUL, lit_two, lit_two);
+  auto null_sum   = cudf::ast::operation(op::ADD, lit_two, lit_null);
+  auto is_null    = cudf::ast::operation(op::IS_NULL, lit_null);
+
+  // Literal results are broadcast to every row of the table
+  for (bool vectorized : {true, false}) {
+    auto const result = compute_column_host(table, product, vectorized);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(column_wrapper<int32_t>{4, 4, 4}, result->view());
+
+    auto const null_result = compute_column_host(table, null_sum, vectorized);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(column_wrapper<int32_t>({0, 0, 0}, {false, false, false}),
+                                   null_result->view());
+
+    auto const is_null_result = compute_column_host(table, is_null, vectorized);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(column_wrapper<bool>{true, true, true},
+                                   is_null_result->view());
+  }
+}
+
+TEST_F(HostEvaluatorTest, UndefinedDivisionIsNull)
+{
+  auto c_0   = column_wrapper<int32_t>{7, -7, std::numeric_limits<int32_t>::min(), 8};
+  auto c_1   = column_wrapper<int32_t>{2, 0, -1, 3};
+  auto table = cudf::table_view{{c_0, c_1}};
+
+  auto col_ref_0 = cudf::ast::column_reference(0);
+  auto col_ref_1 = cudf::ast::column_reference(1);
+  auto division  = cudf::ast::operation(op::DIV, col_ref_0, col_ref_1);
+  auto modulo    = cudf::ast::operation(op::MOD, col_ref_0, col_ref_1);
+
+  // Rows that would trap on the host are null
+  auto expected_quotient  = column_wrapper<int32_t>({3, 0, 0, 2}, {true, false, false, true});
+  auto expected_remainder = column_wrapper<int32_t>({1, 0, 0, 2}, {true, false, false, true});
+  for (bool vectorized : {true, false}) {
+    auto const quotient = compute_column_host(table, division, vectorized);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_quotient, quotient->view());
+
+    auto const remainder = compute_column_host(table, modulo, vectorized);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_remainder, remainder->view());
+  }
+}
+
+TEST_F(HostEvaluatorTest, Errors)
+{
+  auto c_0   = column_wrapper<int32_t>{1, 2, 3};
+  auto c_1   = column_wrapper<int64_t>{1, 2, 3};
+  auto c_2   = cudf::test::strings_column_wrapper{"a", "b", "c"};
+  auto table = cudf::table_view{{c_0, c_1, c_2}};
+
+  auto const metadata = std::vector<cudf::column_metadata>(table.num_columns());
+  auto const schema   = cudf::to_arrow_schema(table, metadata);
+  auto const input    = cudf::to_arrow_host(table);
+  auto const evaluate = [&](cudf::ast::expression const& expr) {
+    cudf::ast::detail::compute_column_host(expr, schema.get(), &input->array);
+  };
+
+  auto col_ref_0  = cudf::ast::column_reference(0);
+  auto col_ref_1  = cudf::ast::column_reference(1);
+  auto col_ref_2  = cudf::ast::column_reference(2);
+  auto right_ref  = cudf::ast::column_reference(0, cudf::ast::table_reference::RIGHT);
+  auto name_ref   = cudf::ast::column_name_reference("a");
+  auto mismatched = cudf::ast::operation(op::ADD, col_ref_0, col_ref_1);
+  EXPECT_THROW(evaluate(mismatched), cudf::logic_error);
+  EXPECT_THROW(evaluate(right_ref), cudf::logic_error);
+  EXPECT_THROW(evaluate(name_ref), cudf::logic_error);
+  EXPECT_THROW(evaluate(col_ref_2), cudf::data_type_error);
+  EXPECT_THROW(cudf::ast::detail::compute_column_host(col_ref_0, nullptr, &input->array),
+               std::invalid_argument);
+}
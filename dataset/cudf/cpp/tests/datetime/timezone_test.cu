@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/testing_main.hpp>
+
+#include <cudf/detail/timezone.cuh>
+#include <cudf/detail/timezone.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/memory_resource.hpp>
+
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/transform.h>
+
+#include <string>
+#include <vector>
+
+namespace {
+
+struct ut_offset_fn {
+  cudf::table_device_view tz_table;
+
+  __device__ int64_t operator()(int64_t timestamp) const
+  {
+    return cudf::detail::get_ut_offset(tz_table, cudf::timestamp_s{cudf::duration_s{timestamp}})
+      .count();
+  }
+};
+
+/**
+ * @brief Looks up the UT offsets of the timestamps in a device transition table.
+ */
+std::vector<int64_t> device_ut_offsets(cudf::table_view tz_table,
+                                       std::vector<int64_t> const& timestamps)
+{
+  auto const stream       = cudf::get_default_stream();
+  auto const d_tz_table   = cudf::table_device_view::create(tz_table, stream);
+  auto const d_timestamps = cudf::detail::make_device_uvector_async(
+    timestamps, stream, cudf::get_current_device_resource_ref());
+  rmm::device_uvector<int64_t> d_offsets(timestamps.size(), stream);
+  thrust::transform(rmm::exec_policy(stream),
+                    d_timestamps.begin(),
+                    d_timestamps.end(),
+                    d_offsets.begin(),
+                    ut_offset_fn{*d_tz_table});
+  return cudf::detail::make_std_vector(d_offsets, stream);
+}
+
+/**
+ * @brief Returns timestamps around the transitions of a table and spread over several centuries.
+ */
+std::vector<int64_t> test_timestamps(cudf::table_view tz_table)
+{
+  std::vector<int64_t> timestamps;
+  for (int64_t ts = -10'000'000'000; ts < 40'000'000'000; ts += 7'654'321) {
+    timestamps.push_back(ts);
+  }
+  if (tz_table.num_columns() != 0) {
+    auto const transition_times = cudf::detail::make_std_vector(
+      cudf::device_span<int64_t const>{tz_table.column(0).data<int64_t>(),
+                                       static_cast<std::size_t>(tz_table.num_rows())},
+      cudf::get_default_stream());
+    for (auto const transition : transition_times) {
+      if (transition == std::numeric_limits<int64_t>::max()) { continue; }
+      for (int64_t delta : {-3600, -1, 0, 1, 3600}) {
+        timestamps.push_back(transition + delta);
+      }
+    }
+  }
+  return timestamps;
+}
+
+}  // namespace
+
+struct HostTimezoneTableTest : public cudf::test::BaseFixture {};
+
+TEST_F(HostTimezoneTableTest, MatchesDeviceLookup)
+{
+  std::vector<std::string> const timezone_names{"America/Los_Angeles",
+                                                "Europe/London",
+                                                "Australia/Sydney",
+                                                "Asia/Kolkata",
+                                                "Pacific/Apia",
+                                                "Africa/Casablanca",
+                                                "Etc/GMT+5",
+                                                "UTC"};
+  auto const host_tables = cudf::detail::make_host_timezone_tables(std::nullopt, timezone_names);
+  ASSERT_EQ(host_tables.size(), timezone_names.size());
+
+  for (std::size_t i = 0; i < timezone_names.size(); ++i) {
+    SCOPED_TRACE(timezone_names[i]);
+    auto const tz_table = cudf::make_timezone_transition_table(std::nullopt, timezone_names[i]);
+    auto const timestamps = test_timestamps(tz_table->view());
+    auto const offsets    = device_ut_offsets(tz_table->view(), timestamps);
+
+    std::vector<int64_t> local(timestamps.size());
+    host_tables[i].to_local(timestamps, local);
+    for (std::size_t row = 0; row < timestamps.size(); ++row) {
+      ASSERT_EQ(local[row], timestamps[row] + offsets[row]) << "timestamp " << timestamps[row];
+      ASSERT_EQ(host_tables[i].ut_offset(timestamps[row]), offsets[row]);
+    }
+  }
+}
+
+TEST_F(HostTimezoneTableTest, LocalToUtc)
+{
+  auto const table = cudf::detail::make_host_timezone_table(std::nullopt, "America/New_York");
+
+  // 2024-01-15 12:00, 2024-07-15 12:00, and 01:30 on 2024-11-03, which occurs twice
+  std::vector<int64_t> timestamps{1'705'320'000, 1'721'044'800, 1'730'597'400};
+  table.to_utc(timestamps, timestamps);
+  EXPECT_EQ(timestamps, (std::vector<int64_t>{1'705'338'000, 1'721'059'200, 1'730'611'800}));
+
+  // Local times convert back to themselves, except for the hour skipped on 2024-03-10
+  std::vector<int64_t> local;
+  for (int64_t ts = 1'704'067'200; ts < 1'735'689'600; ts += 599) {
+    local.push_back(ts);
+  }
+  std::vector<int64_t> utc(local.size());
+  std::vector<int64_t> round_trip(local.size());
+  table.to_utc(local, utc);
+  table.to_local(utc, round_trip);
+  for (std::size_t row = 0; row < local.size(); ++row) {
+    auto const skipped = local[row] >= 1'710'036'000 && local[row] < 1'710'039'600;
+    if (!skipped) { ASSERT_EQ(round_trip[row], local[row]); }
+  }
+}
+
+TEST_F(HostTimezoneTableTest, InvalidTables)
+{
+  std::vector<int64_t> const times(cudf::solar_cycle_entry_count + 2);
+  std::vector<int64_t> const offsets(cudf::solar_cycle_entry_count + 1);
+  EXPECT_THROW(cudf::detail::host_timezone_table(times, offsets), cudf::logic_error);
+  std::vector<int64_t> const short_table(2);
+  EXPECT_THROW(cudf::detail::host_timezone_table(short_table, short_table), cudf::logic_error);
+  EXPECT_THROW(cudf::detail::make_host_timezone_table(std::nullopt, "Not/A_Timezone"),
+               cudf::logic_error);
+}
+
+CUDF_TEST_PROGRAM_MAIN()
@@ -0,0 +1,228 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "io/json/host_streaming_tokenizer.hpp"
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/cudf_gtest.hpp>
+#include <cudf_test/testing_main.hpp>
+
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <algorithm>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace cuio_json = cudf::io::json;
+
+namespace {
+
+using field_values = std::vector<std::optional<std::string>>;
+
+/**
+ * @brief Tokenizes the input in windows of the given size and returns the text of the values of
+ * each projected field.
+ */
+std::vector<field_values> tokenize(std::string const& input,
+                                   std::vector<std::vector<std::string>> const& projection,
+                                   std::size_t window_size,
+                                   bool recover_with_null = false)
+{
+  cuio_json::detail::host_streaming_tokenizer tokenizer(projection, recover_with_null);
+  std::vector<field_values> values(projection.size());
+  auto const take = [&]() {
+    auto const tapes = tokenizer.take_completed_records();
+    for (std::size_t field = 0; field < tapes.size(); ++field) {
+      for (std::size_t row = 0; row < tapes[field].offsets.size(); ++row) {
+        auto const offset = tapes[field].offsets[row];
+        if (offset == cuio_json::detail::field_tape::missing_value) {
+          values[field].emplace_back();
+        } else {
+          values[field].emplace_back(input.substr(offset, tapes[field].lengths[row]));
+        }
+      }
+    }
+  };
+  for (std::size_t pos = 0; pos < input.size(); pos += window_size) {
+    auto const size = std::min(window_size, input.size() - pos);
+    tokenizer.append(cudf::host_span<char const>{input.data() + pos, size});
+    take();
+  }
+  tokenizer.finish();
+  take();
+  return values;
+}
+
+}  // namespace
+
+struct HostStreamingTokenizerTest : public cudf::test::BaseFixture {};
+
+struct HostStreamingTokenizerWindowTest : public cudf::test::BaseFixture,
+                                          public testing::WithParamInterface<std::size_t> {};
+
+INSTANTIATE_TEST_SUITE_P(WindowSizes,
+                         HostStreamingTokenizerWindowTest,
+                         testing::Values(1, 7, 64, 100, 1 << 20));
+
+TEST_P(HostStreamingTokenizerWindowTest, ScalarsAndStrings)
+{
+  std::string const input =
+    "{\"a\": 1, \"b\": \"x,y}\", \"c\": true}\n"
+    "{\"c\": null,\"a\":-2.5e3}\n"
+    "\n"
+    "{\"b\": \"say \\\"hi\\\"\"}";
+  auto const values = tokenize(input, {{"a"}, {"b"}}, GetParam());
+
+  field_values const expected_a{"1", "-2.5e3", std::nullopt};
+  field_values const expected_b{"\"x,y}\"", std::nullopt, "\"say \\\"hi\\\"\""};
+  EXPECT_EQ(values[0], expected_a);
+  EXPECT_EQ(values[1], expected_b);
+}
+
+TEST_P(HostStreamingTokenizerWindowTest, NestedPaths)
+{
+  std::string const input =
+    "{\"user\": {\"name\": \"ann\", \"id\": 7, \"tags\": [1, {\"id\": 0}]}, \"id\": 1}\n"
+    "{\"user\": [\"not\", \"a\", \"struct\"], \"id\": 2}\n"
+    "{\"id\": 3, \"user\": {\"address\": {\"city\": \"]\\\\\"}}}\n";
+  auto const values = tokenize(input, {{"user", "id"}, {"user", "tags"}, {"id"}}, GetParam());
+
+  field_values const expected_user_id{"7", std::nullopt, std::nullopt};
+  field_values const expected_tags{"[1, {\"id\": 0}]", std::nullopt, std::nullopt};
+  field_values const expected_id{"1", "2", "3"};
+  EXPECT_EQ(values[0], expected_user_id);
+  EXPECT_EQ(values[1], expected_tags);
+  EXPECT_EQ(values[2], expected_id);
+}
+
+TEST_P(HostStreamingTokenizerWindowTest, StructAndListValues)
+{
+  std::string const input =
+    "{\"skip\": {\"a\": [\"}\", \"{\"]}, \"s\": {\"x\": [1, 2]}, \"l\": [[], [{}]]}\n"
+    "{\"s\": {}, \"l\": []}\n";
+  auto const values = tokenize(input, {{"s"}, {"l"}}, GetParam());
+
+  field_values const expected_s{"{\"x\": [1, 2]}", "{}"};
+  field_values const expected_l{"[[], [{}]]", "[]"};
+  EXPECT_EQ(values[0], expected_s);
+  EXPECT_EQ(values[1], expected_l);
+}
+
+TEST_P(HostStreamingTokenizerWindowTest, EscapedFieldNames)
+{
+  std::string const input =
+    "{\"\\u0061\": 1, \"q\\\"\": 2, \"\\ud83d\\ude00\": 3}\n";
+  auto const values = tokenize(input, {{"a"}, {"q\""}, {"\xF0\x9F\x98\x80"}}, GetParam());
+
+  EXPECT_EQ(values[0], field_values{"1"});
+  EXPECT_EQ(values[1], field_values{"2"});
+  EXPECT_EQ(values[2], field_values{"3"});
+}
+
+TEST_P(HostStreamingTokenizerWindowTest, FirstOccurrence)
+{
+  // The rest of a record is skipped once all fields are found, including the second "a" and
+  // the malformed text after it
+  std::string const input =
+    "{\"a\": 1, \"a\": 2, ]]]}\n"
+    "{\"b\": 0, \"a\": \"x\"}\n";
+  auto const values = tokenize(input, {{"a"}}, GetParam());
+
+  field_values const expected{"1", "\"x\""};
+  EXPECT_EQ(values[0], expected);
+}
+
+TEST_P(HostStreamingTokenizerWindowTest, LongValues)
+{
+  std::string const long_name(300, 'n');
+  std::string const long_string = "\"" + std::string(500, 'x') + "\\\\\"";
+  std::string const input       = "{\"" + long_name + "\": " + long_string + ", \"a\": [" +
+                            std::string(200, ' ') + "]}\n{\"a\": 12345678901234567890}";
+  auto const values = tokenize(input, {{long_name}, {"a"}}, GetParam());
+
+  field_values const expected_long{long_string, std::nullopt};
+  field_values const expected_a{"[" + std::string(200, ' ') + "]", "12345678901234567890"};
+  EXPECT_EQ(values[0], expected_long);
+  EXPECT_EQ(values[1], expected_a);
+}
+
+TEST_P(HostStreamingTokenizerWindowTest, RecoverWithNull)
+{
+  std::string const input =
+    "{\"a\": 1}\n"
+    "{\"a\": \"unterminated\n"
+    "[1, 2]\n"
+    "{\"b\": 2 3, \"a\": 5}\n"
+    "{\"b\": {\"a\": 1}\n"
+    "{\"a\": 4}\n";
+  auto const values = tokenize(input, {{"a"}}, GetParam(), true);
+
+  field_values const expected{"1", std::nullopt, std::nullopt, std::nullopt, std::nullopt, "4"};
+  EXPECT_EQ(values[0], expected);
+}
+
+TEST_P(HostStreamingTokenizerWindowTest, InvalidInput)
+{
+  for (std::string const input : {"{\"a\": 1}}",
+                                  "{\"a\" 1}",
+                                  "[1]",
+                                  "{\"a\": \"x\n\"}",
+                                  "{\"a\":",
+                                  "{\"a\": 1,}",
+                                  "{\"b\": [1, 2}"}) {
+    EXPECT_THROW(tokenize(input, {{"a"}, {"c"}}, GetParam()), cudf::logic_error);
+  }
+}
+
+TEST_F(HostStreamingTokenizerTest, CompletedRecords)
+{
+  // Input is only tokenized once a whole block of it is available, until the tokenizer finishes
+  std::string const first  = "{\"a\": 1}\n{\"a\": 2}\n" + std::string(110, ' ') + "{\"a\":";
+  std::string const second = " 3}";
+  cuio_json::detail::host_streaming_tokenizer tokenizer({{"a"}});
+
+  tokenizer.append(cudf::host_span<char const>{first.data(), first.size()});
+  EXPECT_EQ(tokenizer.num_completed_records(), 2);
+  auto const tapes = tokenizer.take_completed_records();
+  ASSERT_EQ(tapes.size(), 1);
+  EXPECT_EQ(tapes[0].offsets, (std::vector<int64_t>{6, 15}));
+  EXPECT_EQ(tapes[0].lengths, (std::vector<int64_t>{1, 1}));
+
+  tokenizer.append(cudf::host_span<char const>{second.data(), second.size()});
+  tokenizer.finish();
+  EXPECT_EQ(tokenizer.num_completed_records(), 1);
+  auto const last = tokenizer.take_completed_records();
+  EXPECT_EQ(last[0].offsets, std::vector<int64_t>{134});
+  EXPECT_EQ(last[0].lengths, std::vector<int64_t>{1});
+
+  EXPECT_THROW(tokenizer.append(cudf::host_span<char const>{first.data(), first.size()}),
+               cudf::logic_error);
+}
+
+TEST_F(HostStreamingTokenizerTest, InvalidProjection)
+{
+  using cuio_json::detail::host_streaming_tokenizer;
+  using projection = std::vector<std::vector<std::string>>;
+  EXPECT_THROW(host_streaming_tokenizer(projection{std::vector<std::string>{}}),
+               std::invalid_argument);
+  EXPECT_THROW(host_streaming_tokenizer(projection{{"a"}, {"a"}}), std::invalid_argument);
+  EXPECT_THROW(host_streaming_tokenizer(projection{{"a"}, {"a", "b"}}), std::invalid_argument);
+  EXPECT_THROW(host_streaming_tokenizer(projection{{"a", "b"}, {"a"}}), std::invalid_argument);
+}
+
+CUDF_TEST_PROGRAM_MAIN()
@@ -122,6 +122,45 @@ TEST_F(ParquetWriterTest, Durations)
   test_durations([](auto i) { return false; }, false, true);
 }
 
+TEST_F(ParquetWriterTest, DurationsFromDifferentArrowSchemas)
+{
+  // Arrow schemas are cached across reads, so reading files with different arrow schemas in turn
+  // must still apply the right schema to each of them
+  constexpr auto num_rows = 10;
+  auto sequence           = thrust::make_counting_iterator(0);
+  auto durations_s        = cudf::test::fixed_width_column_wrapper<cudf::duration_s, int64_t>(
+    sequence, sequence + num_rows);
+  auto durations_ms = cudf::test::fixed_width_column_wrapper<cudf::duration_ms, int64_t>(
+    sequence, sequence + num_rows);
+
+  auto const first  = table_view{{durations_s, durations_ms}};
+  auto const second = table_view{{durations_ms, durations_s}};
+
+  auto const write = [](table_view const& table) {
+    std::vector<char> buffer;
+    cudf::io::parquet_writer_options out_opts =
+      cudf::io::parquet_writer_options::builder(cudf::io::sink_info{&buffer}, table)
+        .write_arrow_schema(true);
+    cudf::io::write_parquet(out_opts);
+    return buffer;
+  };
+  auto const first_buffer  = write(first);
+  auto const second_buffer = write(second);
+
+  for (int i = 0; i < 2; ++i) {
+    for (auto const& [buffer, expected] :
+         {std::pair{&first_buffer, first}, std::pair{&second_buffer, second}}) {
+      cudf::io::parquet_reader_options in_opts =
+        cudf::io::parquet_reader_options::builder(
+          cudf::io::source_info{cudf::host_span<std::byte const>{
+            reinterpret_cast<std::byte const*>(buffer->data()), buffer->size()}})
+          .use_arrow_schema(true);
+      auto const result = cudf::io::read_parquet(in_opts);
+      CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+    }
+  }
+}
+
 TEST_F(ParquetWriterTest, MultiIndex)
 {
   constexpr auto num_rows = 100;
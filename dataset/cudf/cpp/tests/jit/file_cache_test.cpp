@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jit/file_cache.hpp"
+
+#include <cudf_test/file_utilities.hpp>
+#include <cudf_test/testing_main.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <string>
+#include <thread>
+#include <vector>
+
+using cudf::jit::file_cache;
+
+namespace {
+
+constexpr cudf::jit::file_cache_limits unlimited{std::numeric_limits<std::size_t>::max(),
+                                                 std::numeric_limits<std::size_t>::max()};
+
+std::filesystem::path entry_path(std::filesystem::path const& directory, std::string const& key)
+{
+  return directory / (key + ".zst");
+}
+
+std::string read_file(std::filesystem::path const& path)
+{
+  std::ifstream file(path, std::ios::binary);
+  return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+}
+
+}  // namespace
+
+struct JitFileCacheTest : public ::testing::Test {
+  temp_directory temp_dir{"jit_file_cache_test"};
+  std::filesystem::path directory{temp_dir.path()};
+};
+
+TEST_F(JitFileCacheTest, Keys)
+{
+  auto const key = file_cache::make_key({"source", "-arch=sm_80", "80"});
+  EXPECT_EQ(key.size(), 32);
+  EXPECT_EQ(key.find_first_not_of("0123456789abcdef"), std::string::npos);
+  EXPECT_EQ(key, file_cache::make_key({"source", "-arch=sm_80", "80"}));
+  EXPECT_NE(key, file_cache::make_key({"source", "-arch=sm_80", "90"}));
+  EXPECT_NE(file_cache::make_key({"ab", "c"}), file_cache::make_key({"a", "bc"}));
+}
+
+TEST_F(JitFileCacheTest, StoreAndLoad)
+{
+  std::string value;
+  for (int i = 0; i < 1000; ++i) {
+    value += ".visible .entry kernel_" + std::to_string(i % 10) + "() { ret; }\n";
+  }
+  auto const key = file_cache::make_key({value});
+
+  file_cache cache(directory, unlimited);
+  EXPECT_FALSE(cache.load(key).has_value());
+  EXPECT_TRUE(cache.store(key, value));
+
+  // Entries are compressed, and are found by other processes
+  auto const entry = read_file(entry_path(directory, key));
+  EXPECT_LT(entry.size(), value.size() / 10);
+  file_cache other(directory, unlimited);
+  EXPECT_EQ(other.load(key), value);
+
+  // Corrupt entries are misses
+  std::ofstream(entry_path(directory, key), std::ios::binary) << entry.substr(0, entry.size() / 2);
+  EXPECT_FALSE(other.load(key).has_value());
+}
+
+TEST_F(JitFileCacheTest, CreateOnce)
+{
+  // Each thread uses its own cache, as separate processes would
+  auto const key = file_cache::make_key({"kernel"});
+  std::atomic<int> num_created{0};
+  std::vector<std::thread> threads;
+  std::vector<std::string> values(8);
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    threads.emplace_back([&, i] {
+      file_cache cache(directory, unlimited);
+      values[i] = cache.get_or_create(key, [&] {
+        ++num_created;
+        std::this_thread::sleep_for(std::chrono::milliseconds{50});
+        return std::string{"compiled kernel"};
+      });
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(num_created, 1);
+  for (auto const& value : values) {
+    EXPECT_EQ(value, "compiled kernel");
+  }
+}
+
+TEST_F(JitFileCacheTest, PruneLeastRecentlyUsed)
+{
+  file_cache cache(directory, {3, std::numeric_limits<std::size_t>::max()});
+  std::vector<std::string> keys;
+  auto const now = std::filesystem::file_time_type::clock::now();
+  for (int i = 0; i < 3; ++i) {
+    keys.push_back(file_cache::make_key({std::to_string(i)}));
+    cache.store(keys.back(), std::to_string(i));
+    std::filesystem::last_write_time(entry_path(directory, keys.back()),
+                                     now - std::chrono::minutes{3 - i});
+  }
+
+  // Reading the oldest entry makes the second one the least recently used
+  EXPECT_EQ(cache.load(keys[0]), "0");
+  keys.push_back(file_cache::make_key({"3"}));
+  cache.store(keys.back(), "3");
+  EXPECT_TRUE(std::filesystem::exists(entry_path(directory, keys[0])));
+  EXPECT_FALSE(std::filesystem::exists(entry_path(directory, keys[1])));
+  EXPECT_TRUE(std::filesystem::exists(entry_path(directory, keys[2])));
+  EXPECT_TRUE(std::filesystem::exists(entry_path(directory, keys[3])));
+
+  // The size limit removes all but the newest entry
+  auto const entry_size = std::filesystem::file_size(entry_path(directory, keys[3]));
+  file_cache small(directory, {10, entry_size + entry_size / 2});
+  small.prune();
+  auto const num_entries = std::count_if(keys.begin(), keys.end(), [&](auto const& key) {
+    return std::filesystem::exists(entry_path(directory, key));
+  });
+  EXPECT_EQ(num_entries, 1);
+  EXPECT_FALSE(std::filesystem::exists(entry_path(directory, keys[2])));
+}
+
+TEST_F(JitFileCacheTest, WarmUp)
+{
+  auto const manifest = directory / "manifest";
+  std::vector<std::string> keys;
+  {
+    file_cache cache(directory, unlimited);
+    for (int i = 0; i < 20; ++i) {
+      keys.push_back(file_cache::make_key({std::to_string(i)}));
+      cache.store(keys.back(), "program " + std::to_string(i));
+    }
+    cache.write_manifest(manifest);
+  }
+
+  file_cache cache(directory, unlimited);
+  EXPECT_EQ(cache.warm_up(manifest), keys.size());
+
+  // Preloaded entries are served from memory
+  std::filesystem::remove(entry_path(directory, keys[5]));
+  EXPECT_EQ(cache.load(keys[5]), "program 5");
+  EXPECT_EQ(cache.warm_up(directory / "missing_manifest"), 0);
+}
+
+CUDF_TEST_PROGRAM_MAIN()
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024, NVIDIA CORPORATION.
+ * Copyright (c) 2024-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -134,3 +134,38 @@ TEST(IoUtilitiesTest, Base64EncodeAndDecode)
   // Check equal columns
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, results);
 }
+
+TEST(IoUtilitiesTest, Base64AllBytesAndLengths)
+{
+  std::string input;
+  for (int i = 0; i < 300; ++i) {
+    EXPECT_EQ(base64_decode(base64_encode(input)), input);
+    input.push_back(static_cast<char>((i * 131) % 256));
+  }
+}
+
+TEST(IoUtilitiesTest, Base64KnownValues)
+{
+  EXPECT_EQ(base64_encode("M"), "TQ==");
+  EXPECT_EQ(base64_encode("Ma"), "TWE=");
+  EXPECT_EQ(base64_encode("Man"), "TWFu");
+  EXPECT_EQ(base64_encode("\xff\xfe\xfd"), "//79");
+
+  EXPECT_EQ(base64_decode("TQ=="), "M");
+  EXPECT_EQ(base64_decode("TWE="), "Ma");
+  EXPECT_EQ(base64_decode("TWFu"), "Man");
+  EXPECT_EQ(base64_decode("//79"), "\xff\xfe\xfd");
+
+  // Padding is optional
+  EXPECT_EQ(base64_decode("TQ"), "M");
+  EXPECT_EQ(base64_decode("TWFuTWE"), "ManMa");
+}
+
+TEST(IoUtilitiesTest, Base64InvalidInput)
+{
+  EXPECT_EQ(base64_decode("T"), "");
+  EXPECT_EQ(base64_decode("TWFuT"), "");
+  EXPECT_EQ(base64_decode("TW!u"), "");
+  EXPECT_EQ(base64_decode("TQ==TWFu"), "");
+  EXPECT_EQ(base64_decode("===="), "");
+}
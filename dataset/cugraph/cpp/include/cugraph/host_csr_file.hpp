@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <raft/core/host_span.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+/**
+ * Persistent, compressed host graph format.
+ *
+ * A CSR file stores a graph after renumbering and CSR construction, so a job can map it and use it
+ * instead of parsing an edge list and rebuilding the graph. The file holds, in order:
+ *
+ *   - a 128 byte header (see host_csr_file_header_t),
+ *   - the renumber map (external id of every internal vertex), if the graph was renumbered,
+ *   - the CSR offsets, uncompressed,
+ *   - optional weight, edge id and edge type columns, in adjacency order,
+ *   - the adjacency lists, compressed,
+ *   - a block index: the byte offset of the adjacency list of every 64th vertex.
+ *
+ * The adjacency list of each vertex is sorted and delta encoded with LEB128 varints: the first
+ * neighbor as the zigzag encoded difference to the vertex itself, every other neighbor as the gap
+ * to the previous one. Sections are 64 byte aligned, so all uncompressed sections are exposed as
+ * zero-copy spans of the memory mapped file.
+ */
+
+namespace cugraph {
+
+/**
+ * @brief Layout of a CSR file, independent of the vertex, edge and weight types.
+ */
+struct host_csr_file_header_t {
+  uint32_t version{};
+  uint32_t vertex_size{};     ///< sizeof(vertex_t)
+  uint32_t edge_size{};       ///< sizeof(edge_t), also the size of the edge ids
+  uint32_t weight_size{};     ///< sizeof(weight_t), 0 if the graph is unweighted
+  uint32_t edge_type_size{};  ///< sizeof(int32_t), 0 if there are no edge types
+  bool is_symmetric{false};
+  bool has_edge_ids{false};
+  bool is_renumbered{false};
+  uint64_t number_of_vertices{};
+  uint64_t number_of_edges{};
+  uint64_t vertices_per_block{};
+  uint64_t renumber_map_offset{};  ///< byte offsets of the sections, 0 if absent
+  uint64_t offsets_offset{};
+  uint64_t weights_offset{};
+  uint64_t edge_ids_offset{};
+  uint64_t edge_types_offset{};
+  uint64_t adjacency_offset{};
+  uint64_t adjacency_size{};
+  uint64_t block_index_offset{};
+  uint64_t file_size{};
+};
+
+/**
+ * @brief Read and validate the header of a CSR file.
+ *
+ * Lets a caller pick the vertex, edge and weight types to open the file with.
+ *
+ * @throws cugraph::logic_error if @p path is not a CSR file.
+ */
+host_csr_file_header_t read_host_csr_file_header(std::string const& path);
+
+/**
+ * @brief Write a CSR graph to a compressed CSR file.
+ *
+ * The adjacency lists do not need to be sorted; each list is sorted (stably, carrying the optional
+ * columns along) while it is encoded. Vertices are encoded in parallel, a few million edges at a
+ * time, so memory use beyond the input arrays stays bounded.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam weight_t Type of edge weights. Needs to be a floating point type.
+ * @param path Output file path.
+ * @param offsets CSR offsets, number_of_vertices + 1 entries.
+ * @param indices CSR indices (neighbor of each edge).
+ * @param weights Optional edge weights.
+ * @param edge_ids Optional edge ids.
+ * @param edge_types Optional edge types.
+ * @param renumber_map Optional external vertex id of each vertex.
+ * @param is_symmetric Whether the graph is symmetric, recorded in the header.
+ * @param num_threads Number of encoding threads, 0 for the hardware concurrency.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+void write_host_csr_file(std::string const& path,
+                         raft::host_span<edge_t const> offsets,
+                         raft::host_span<vertex_t const> indices,
+                         std::optional<raft::host_span<weight_t const>> weights,
+                         std::optional<raft::host_span<edge_t const>> edge_ids,
+                         std::optional<raft::host_span<int32_t const>> edge_types,
+                         std::optional<raft::host_span<vertex_t const>> renumber_map,
+                         bool is_symmetric,
+                         size_t num_threads = 0);
+
+/**
+ * @brief Memory mapped, read-only CSR file.
+ *
+ * The offsets and the optional columns are views of the mapping and cost nothing to access; the
+ * operating system pages them in on demand. Only the adjacency lists are decoded. Every vertex
+ * range can be decoded independently, so a graph larger than device memory can be streamed to
+ * the device in partitions: decode [first, last), then copy the decoded indices together with
+ * offsets()[first, last] and the slices [offsets()[first], offsets()[last]) of the columns.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Must match the file.
+ * @tparam edge_t Type of edge identifiers. Must match the file.
+ * @tparam weight_t Type of edge weights. Must match the file if the graph is weighted.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+class host_csr_file_t {
+ public:
+  /**
+   * @brief Map @p path and validate its header.
+   *
+   * @throws cugraph::logic_error if @p path is not a CSR file or its types do not match.
+   */
+  explicit host_csr_file_t(std::string const& path);
+
+  host_csr_file_t(host_csr_file_t const&)            = delete;
+  host_csr_file_t& operator=(host_csr_file_t const&) = delete;
+
+  ~host_csr_file_t();
+
+  host_csr_file_header_t const& header() const { return header_; }
+
+  vertex_t number_of_vertices() const { return static_cast<vertex_t>(header_.number_of_vertices); }
+  edge_t number_of_edges() const { return static_cast<edge_t>(header_.number_of_edges); }
+  bool is_symmetric() const { return header_.is_symmetric; }
+
+  raft::host_span<edge_t const> offsets() const;
+  std::optional<raft::host_span<weight_t const>> weights() const;
+  std::optional<raft::host_span<edge_t const>> edge_ids() const;
+  std::optional<raft::host_span<int32_t const>> edge_types() const;
+  std::optional<raft::host_span<vertex_t const>> renumber_map() const;
+
+  /**
+   * @brief Decode the (sorted) adjacency lists of the vertices in [@p first, @p last).
+   *
+   * @param first First vertex of the range.
+   * @param last One past the last vertex of the range.
+   * @param indices Output, offsets()[last] - offsets()[first] entries.
+   * @throws cugraph::logic_error if the adjacency data is corrupt.
+   */
+  void decode_indices(vertex_t first, vertex_t last, raft::host_span<vertex_t> indices) const;
+
+  /**
+   * @brief Decode all adjacency lists, in parallel.
+   *
+   * @param num_threads Number of decoding threads, 0 for the hardware concurrency.
+   * @return std::vector<vertex_t> The CSR indices.
+   */
+  std::vector<vertex_t> decode_indices(size_t num_threads = 0) const;
+
+ private:
+  template <typename T>
+  T const* section(uint64_t offset) const
+  {
+    return reinterpret_cast<T const*>(data_ + offset);
+  }
+
+  host_csr_file_header_t header_{};
+  unsigned char const* data_{nullptr};
+};
+
+}  // namespace cugraph
@@ -0,0 +1,301 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <tuple>
+#include <vector>
+
+/**
+ * Host (CPU) counterparts of the generators in graph_generators.hpp.
+ *
+ * The device generators materialize the whole edge list in GPU memory. The generators in this
+ * file instead produce edges in fixed-size chunks on a pool of host threads and hand every chunk,
+ * in order, to a caller-supplied consumer. Peak memory is bounded by a few chunks per thread, so
+ * edge lists far larger than host (or device) memory can be streamed straight to a file with
+ * host_edgelist_file_writer_t.
+ *
+ * The generated edge list depends only on the generator parameters and the seed: neither the
+ * number of threads nor the chunk size changes the output.
+ */
+
+namespace cugraph {
+
+/**
+ * @ingroup graph_generators_cpp
+ * @brief Receives consecutive chunks of a generated edge list.
+ *
+ * Chunks are delivered in order, one at a time, from the thread that called the generator. The
+ * pointers are only valid for the duration of the call.
+ */
+template <typename vertex_t>
+using host_edgelist_consumer_t =
+  std::function<void(vertex_t const* srcs, vertex_t const* dsts, size_t num_edges)>;
+
+/**
+ * @ingroup graph_generators_cpp
+ * @brief Parallelism controls for the host generators.
+ */
+struct host_generator_options_t {
+  size_t num_threads{0};                    ///< Worker threads, 0 for the hardware concurrency
+  size_t edges_per_chunk{size_t{1} << 22};  ///< Approximate number of edges per delivered chunk
+};
+
+/**
+ * @ingroup graph_generators_cpp
+ * @brief generate an edge list for an R-mat graph on the host.
+ *
+ * Same model as generate_rmat_edgelist, optionally perturbed with the level-wise noise of
+ * Seshadhri, Pinar and Kolda ("An In-Depth Analysis of Stochastic Kronecker Graphs", 2013): at
+ * every level l a noise value mu_l is drawn uniformly from [-@p noise, @p noise] and the level
+ * uses a - 2 mu_l a / (a + d), b + mu_l, c + mu_l and d - 2 mu_l d / (a + d). Noise smooths out
+ * the oscillating degree distribution of plain R-mat graphs.
+ *
+ * Edge i is derived from (@p seed, i) alone, so the output is independent of the number of
+ * threads and of the chunk size.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @param scale Scale factor to set the number of vertices in the graph. Vertex IDs have values in
+ * [0, V), where V = 1 << @p scale.
+ * @param num_edges Number of edges to generate.
+ * @param consumer Receives the generated edges, chunk by chunk, in order.
+ * @param a a, b, c, d (= 1.0 - (a + b + c)) in the R-mat graph generator. a, b, c, d should be
+ * non-negative and a + b + c should be no larger than 1.0.
+ * @param b See @p a.
+ * @param c See @p a.
+ * @param noise Maximum magnitude of the per-level noise, 0 disables noise. Must not exceed
+ * min((a + d) / 2, b, c).
+ * @param seed Seed value for the random number generator.
+ * @param clip_and_flip Flag controlling whether to generate edges only in the lower triangular part
+ * (including the diagonal) of the graph adjacency matrix (if set to `true`) or not (if set to
+ * `false`).
+ * @param scramble_vertex_ids Flag controlling whether to apply a seed-dependent permutation of
+ * [0, V) to the vertex IDs (if set to `true`) or not (if set to `false`).
+ * @param options Parallelism controls.
+ * @return size_t Number of edges delivered to @p consumer.
+ */
+template <typename vertex_t>
+size_t host_generate_rmat_edgelist(size_t scale,
+                                   size_t num_edges,
+                                   host_edgelist_consumer_t<vertex_t> const& consumer,
+                                   double a                         = 0.57,
+                                   double b                         = 0.19,
+                                   double c                         = 0.19,
+                                   double noise                     = 0.0,
+                                   uint64_t seed                    = 0,
+                                   bool clip_and_flip               = false,
+                                   bool scramble_vertex_ids         = false,
+                                   host_generator_options_t options = host_generator_options_t{});
+
+/**
+ * @ingroup graph_generators_cpp
+ * @brief generate an edge list for a bipartite R-mat graph on the host.
+ *
+ * The source vertex IDs will be in the range of [0, 2^src_scale) and the destination vertex IDs
+ * will be in the range of [0, 2^dst_scale). This function allows multi-edges.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @param src_scale Scale factor to set the range of source vertex IDs.
+ * @param dst_scale Scale factor to set the range of destination vertex IDs.
+ * @param num_edges Number of edges to generate.
+ * @param consumer Receives the generated edges, chunk by chunk, in order.
+ * @param a a, b, c, d (= 1.0 - (a + b + c)) in the R-mat graph generator. a, b, c, d should be
+ * non-negative and a + b + c should be no larger than 1.0.
+ * @param b See @p a.
+ * @param c See @p a.
+ * @param seed Seed value for the random number generator.
+ * @param options Parallelism controls.
+ * @return size_t Number of edges delivered to @p consumer.
+ */
+template <typename vertex_t>
+size_t host_generate_bipartite_rmat_edgelist(
+  size_t src_scale,
+  size_t dst_scale,
+  size_t num_edges,
+  host_edgelist_consumer_t<vertex_t> const& consumer,
+  double a                         = 0.57,
+  double b                         = 0.19,
+  double c                         = 0.19,
+  uint64_t seed                    = 0,
+  host_generator_options_t options = host_generator_options_t{});
+
+/**
+ * @ingroup graph_generators_cpp
+ * @brief generate an edge list for an Erdos-Renyi G(n,p) graph on the host.
+ *
+ * Every unordered pair {u, v} with u != v is selected independently with probability @p p and
+ * emitted in both directions, matching the symmetric output of
+ * generate_erdos_renyi_graph_edgelist_gnp. Unlike the device version this takes O(n + m) work:
+ * gaps between selected pairs are drawn from the geometric distribution instead of testing all
+ * n^2 pairs.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @param num_vertices Number of vertices in the generated graph
+ * @param p Probability for edge creation
+ * @param consumer Receives the generated edges, chunk by chunk, in order.
+ * @param base_vertex_id Starting vertex id for the generated graph
+ * @param seed Seed value for the random number generator.
+ * @param options Parallelism controls.
+ * @return size_t Number of edges delivered to @p consumer.
+ */
+template <typename vertex_t>
+size_t host_generate_erdos_renyi_graph_edgelist_gnp(
+  vertex_t num_vertices,
+  double p,
+  host_edgelist_consumer_t<vertex_t> const& consumer,
+  vertex_t base_vertex_id          = 0,
+  uint64_t seed                    = 0,
+  host_generator_options_t options = host_generator_options_t{});
+
+/**
+ * @ingroup graph_generators_cpp
+ * @brief generate an edge list for a sequence of 2D mesh graphs on the host.
+ *
+ * Each component is configured with a tuple containing (x, y, base_vertex_id), as in
+ * generate_2d_mesh_graph_edgelist.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @param component_parameters_v Vector containing tuple defining the configuration of each
+ * component
+ * @param consumer Receives the generated edges, chunk by chunk, in order.
+ * @param options Parallelism controls.
+ * @return size_t Number of edges delivered to @p consumer.
+ */
+template <typename vertex_t>
+size_t host_generate_2d_mesh_graph_edgelist(
+  std::vector<std::tuple<vertex_t, vertex_t, vertex_t>> const& component_parameters_v,
+  host_edgelist_consumer_t<vertex_t> const& consumer,
+  host_generator_options_t options = host_generator_options_t{});
+
+/**
+ * @ingroup graph_generators_cpp
+ * @brief generate an edge list for a sequence of 3D mesh graphs on the host.
+ *
+ * Each component is configured with a tuple containing (x, y, z, base_vertex_id), as in
+ * generate_3d_mesh_graph_edgelist.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @param component_parameters_v Vector containing tuple defining the configuration of each
+ * component
+ * @param consumer Receives the generated edges, chunk by chunk, in order.
+ * @param options Parallelism controls.
+ * @return size_t Number of edges delivered to @p consumer.
+ */
+template <typename vertex_t>
+size_t host_generate_3d_mesh_graph_edgelist(
+  std::vector<std::tuple<vertex_t, vertex_t, vertex_t, vertex_t>> const& component_parameters_v,
+  host_edgelist_consumer_t<vertex_t> const& consumer,
+  host_generator_options_t options = host_generator_options_t{});
+
+/**
+ * @ingroup graph_generators_cpp
+ * @brief On-disk edge list formats written by host_edgelist_file_writer_t.
+ *
+ * BINARY is a 32 byte header (the magic "CGEDGES\0", a uint32_t format version, a uint32_t
+ * sizeof(vertex_t), uint64_t number of vertices and uint64_t number of edges) followed by
+ * interleaved (src, dst) pairs of vertex_t in native byte order.
+ *
+ * MATRIX_MARKET is a "coordinate pattern general" MatrixMarket file with 1-based vertex IDs.
+ */
+enum class host_edgelist_file_format_t { BINARY = 0, MATRIX_MARKET };
+
+/**
+ * @ingroup graph_generators_cpp
+ * @brief Streams an edge list to disk.
+ *
+ * The number of edges does not need to be known up front (G(n,p) output is random): the header
+ * reserves room for the edge count and close() patches it in place. Intended as the consumer of
+ * the host generators:
+ *
+ * @code
+ * cugraph::host_edgelist_file_writer_t<int64_t> writer(
+ *   "rmat.bin", cugraph::host_edgelist_file_format_t::BINARY, int64_t{1} << scale);
+ * cugraph::host_generate_rmat_edgelist<int64_t>(
+ *   scale, num_edges, [&](auto srcs, auto dsts, auto n) { writer.append(srcs, dsts, n); });
+ * writer.close();
+ * @endcode
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ */
+template <typename vertex_t>
+class host_edgelist_file_writer_t {
+ public:
+  /**
+   * @brief Create (or truncate) @p path and write the header.
+   *
+   * @param path Output file path.
+   * @param format Output format.
+   * @param num_vertices Number of vertices recorded in the header. Every vertex ID appended must be
+   * in [0, @p num_vertices).
+   */
+  host_edgelist_file_writer_t(std::string const& path,
+                              host_edgelist_file_format_t format,
+                              vertex_t num_vertices);
+
+  host_edgelist_file_writer_t(host_edgelist_file_writer_t const&)            = delete;
+  host_edgelist_file_writer_t& operator=(host_edgelist_file_writer_t const&) = delete;
+
+  /**
+   * @brief Closes the file if close() was not called. Errors are swallowed; call close() to
+   * observe them.
+   */
+  ~host_edgelist_file_writer_t();
+
+  /**
+   * @brief Append @p num_edges edges.
+   */
+  void append(vertex_t const* srcs, vertex_t const* dsts, size_t num_edges);
+
+  /**
+   * @brief Patch the edge count into the header, flush and close the file.
+   */
+  void close();
+
+  size_t num_edges() const { return num_edges_; }
+
+ private:
+  void flush();
+
+  std::FILE* file_{nullptr};
+  host_edgelist_file_format_t format_{};
+  vertex_t num_vertices_{};
+  size_t num_edges_{0};
+  std::vector<char> buffer_{};
+  size_t buffered_{0};
+};
+
+/**
+ * @ingroup graph_generators_cpp
+ * @brief Read an edge list written in host_edgelist_file_format_t::BINARY format.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Must match the type the file was written with.
+ * @param path Input file path.
+ * @param consumer Receives the edges, chunk by chunk, in file order.
+ * @param edges_per_chunk Maximum number of edges per delivered chunk.
+ * @return std::tuple<vertex_t, size_t> The number of vertices and the number of edges recorded in
+ * the header.
+ */
+template <typename vertex_t>
+std::tuple<vertex_t, size_t> host_read_binary_edgelist_file(
+  std::string const& path,
+  host_edgelist_consumer_t<vertex_t> const& consumer,
+  size_t edges_per_chunk = size_t{1} << 22);
+
+}  // namespace cugraph
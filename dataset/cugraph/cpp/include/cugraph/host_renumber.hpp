@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <raft/core/host_span.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+namespace cugraph {
+
+/**
+ * @brief Renumber an edge list on the host.
+ *
+ * Host counterpart of the single-GPU renumber_edgelist, for edge lists that arrive on the CPU
+ * with arbitrary (e.g. 64-bit or hashed string) vertex IDs and have to be renumbered before they
+ * are partitioned and shipped to GPUs. The renumber map has the same semantics as the device
+ * path: it holds every vertex (the vertices in @p vertices if given, otherwise every vertex that
+ * appears in the edge list) sorted by major degree in descending order (ties by ascending vertex
+ * ID), and the segment offsets split it into the high, mid, low and zero degree segments.
+ *
+ * Vertices are collected in a lock-free open addressing hash map in parallel, counting major
+ * degrees as they are inserted; then the unique vertices are compacted with a prefix sum over the
+ * table, sorted, and the edge list is relabeled in parallel.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @param vertices If valid, vertices in the graph to be renumbered. This parameter can be used to
+ * include isolated vertices; every edge endpoint must be in @p vertices.
+ * @param edgelist_srcs Edge source vertex IDs, in one or more chunks (e.g. one per ingest thread).
+ * Source IDs are updated in-place ([INOUT] parameter).
+ * @param edgelist_dsts Edge destination vertex IDs, chunked as @p edgelist_srcs. Destination IDs
+ * are updated in-place ([INOUT] parameter).
+ * @param store_transposed Should be true if renumbered edges will be used to create a graph with
+ * store_transposed = true (degrees are then in-degrees).
+ * @param num_threads Number of threads, 0 for the hardware concurrency.
+ * @param do_expensive_check A flag to run expensive checks for input arguments (if set to `true`).
+ * @return std::tuple<std::vector<vertex_t>, std::vector<vertex_t>> Tuple of labels (vertex IDs
+ * before renumbering) for the entire set of vertices and the segment offsets.
+ */
+template <typename vertex_t, typename edge_t>
+std::tuple<std::vector<vertex_t>, std::vector<vertex_t>> host_renumber_edgelist(
+  std::optional<raft::host_span<vertex_t const>> vertices,
+  std::vector<raft::host_span<vertex_t>> const& edgelist_srcs /* [INOUT] */,
+  std::vector<raft::host_span<vertex_t>> const& edgelist_dsts /* [INOUT] */,
+  bool store_transposed,
+  size_t num_threads      = 0,
+  bool do_expensive_check = false);
+
+/**
+ * @brief Concurrent map from external vertex IDs to consecutive internal vertex IDs.
+ *
+ * Assigns internal IDs 0, 1, 2, ... in the order vertices are first inserted, so that ingest
+ * threads can renumber edges as they receive them (see mtmg::per_thread_edgelist_t) and partition
+ * the dense IDs evenly across GPUs. Inserts and lookups are lock-free (linear probing on a table
+ * sized for @p max_number_of_vertices) and may run concurrently from any number of threads. Any
+ * vertex_t value is a valid external ID.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ */
+template <typename vertex_t>
+class host_vertex_map_t {
+ public:
+  /**
+   * @param max_number_of_vertices Maximum number of distinct vertices that will be inserted.
+   */
+  explicit host_vertex_map_t(size_t max_number_of_vertices);
+
+  host_vertex_map_t(host_vertex_map_t const&)            = delete;
+  host_vertex_map_t& operator=(host_vertex_map_t const&) = delete;
+
+  /**
+   * @brief Return the internal ID of @p v, assigning the next one if @p v is new.
+   *
+   * @throws cugraph::logic_error if more than max_number_of_vertices vertices are inserted.
+   */
+  vertex_t insert(vertex_t v);
+
+  /**
+   * @brief Insert @p vertices and store their internal IDs in @p internal_vertices (which may
+   * alias @p vertices).
+   */
+  void insert(raft::host_span<vertex_t const> vertices,
+              raft::host_span<vertex_t> internal_vertices);
+
+  /**
+   * @brief Return the internal ID of @p v, or invalid_vertex_id<vertex_t>::value if @p v was not
+   * inserted.
+   */
+  vertex_t find(vertex_t v) const;
+
+  vertex_t number_of_vertices() const;
+
+  /**
+   * @brief Return the external ID of each internal vertex.
+   *
+   * Must not run concurrently with insert().
+   */
+  std::vector<vertex_t> renumber_map() const;
+
+ private:
+  vertex_t assign(vertex_t v, std::atomic<vertex_t>& value);
+
+  size_t max_number_of_vertices_{};
+  size_t mask_{};
+  std::unique_ptr<std::atomic<vertex_t>[]> keys_{};
+  std::unique_ptr<std::atomic<vertex_t>[]> values_{};
+  std::unique_ptr<vertex_t[]> labels_{};
+  // the key value marking empty slots is kept out of the table
+  std::atomic<bool> empty_key_inserted_{false};
+  std::atomic<vertex_t> empty_key_value_{};
+  std::atomic<size_t> count_{0};
+};
+
+}  // namespace cugraph
@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <raft/core/host_span.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace cugraph {
+
+/**
+ * @brief Host memory edge id and type to source and destination lookup map.
+ *
+ * Host counterpart of lookup_container_t for serving edge endpoint lookups on the CPU. For each
+ * edge type, the edge ids are sorted and indexed with an Elias-Fano code (about 2 + log2(id range
+ * / number of edges) bits per edge, nothing if the ids of the type are consecutive), and the
+ * position of an edge id in the sorted order indexes the source and destination arrays. Lookups
+ * are read-only and may run concurrently from any number of threads.
+ *
+ * @tparam edge_id_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam edge_type_t Type of edge types. Needs to be an integral type.
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ */
+template <typename edge_id_t, typename edge_type_t, typename vertex_t>
+class host_lookup_container_t {
+  template <typename _edge_id_t, typename _edge_type_t, typename _vertex_t>
+  struct host_lookup_container_impl;
+  std::unique_ptr<host_lookup_container_impl<edge_id_t, edge_type_t, vertex_t>> pimpl;
+
+ public:
+  using edge_id_type   = edge_id_t;
+  using edge_type_type = edge_type_t;
+
+  static_assert(std::is_integral_v<edge_id_t>);
+  static_assert(std::is_integral_v<edge_type_t>);
+  static_assert(std::is_integral_v<vertex_t>);
+
+  ~host_lookup_container_t();
+  host_lookup_container_t();
+
+  /**
+   * @brief Build the lookup map from an edge list.
+   *
+   * @param srcs Edge sources.
+   * @param dsts Edge destinations.
+   * @param edge_ids Edge ids, unique within each edge type.
+   * @param edge_types Edge types, if std::nullopt every edge has type 0.
+   * @param num_threads Number of threads, 0 for the hardware concurrency.
+   */
+  host_lookup_container_t(raft::host_span<vertex_t const> srcs,
+                          raft::host_span<vertex_t const> dsts,
+                          raft::host_span<edge_id_t const> edge_ids,
+                          std::optional<raft::host_span<edge_type_t const>> edge_types,
+                          size_t num_threads = 0);
+
+  host_lookup_container_t(host_lookup_container_t&& other);
+  host_lookup_container_t& operator=(host_lookup_container_t&& other);
+
+  void lookup_from_edge_ids_and_single_type(raft::host_span<edge_id_t const> edge_ids_to_lookup,
+                                            edge_type_t edge_type_to_lookup,
+                                            raft::host_span<vertex_t> srcs,
+                                            raft::host_span<vertex_t> dsts,
+                                            size_t num_threads = 0) const;
+
+  void lookup_from_edge_ids_and_types(raft::host_span<edge_id_t const> edge_ids_to_lookup,
+                                      raft::host_span<edge_type_t const> edge_types_to_lookup,
+                                      raft::host_span<vertex_t> srcs,
+                                      raft::host_span<vertex_t> dsts,
+                                      size_t num_threads = 0) const;
+
+  size_t number_of_edges() const;
+
+  /**
+   * @brief Host memory held by the map (the index and the endpoint arrays).
+   */
+  size_t size_in_bytes() const;
+};
+
+/**
+ * @ingroup sampling_functions_cpp
+ * @brief Build a host map to lookup source and destination using edge id and type
+ *
+ * The map is built in parallel from an edge list in host memory and does not use the GPU.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam edge_type_t Type of edge types. Needs to be an integral type.
+ * @param srcs Edge sources.
+ * @param dsts Edge destinations.
+ * @param edge_ids Edge ids, unique within each edge type.
+ * @param edge_types Edge types, if std::nullopt every edge has type 0.
+ * @param num_threads Number of threads, 0 for the hardware concurrency.
+ * @return An object of type cugraph::host_lookup_container_t that encapsulates edge id and type
+ * to source and destination lookup map.
+ */
+template <typename vertex_t, typename edge_t, typename edge_type_t>
+host_lookup_container_t<edge_t, edge_type_t, vertex_t> build_edge_id_and_type_to_src_dst_lookup_map(
+  raft::host_span<vertex_t const> srcs,
+  raft::host_span<vertex_t const> dsts,
+  raft::host_span<edge_t const> edge_ids,
+  std::optional<raft::host_span<edge_type_t const>> edge_types,
+  size_t num_threads = 0);
+
+/**
+ * @ingroup sampling_functions_cpp
+ * @brief Lookup edge sources and destinations in a host map using edge ids and a single edge
+ * type.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam edge_type_t Type of edge types. Needs to be an integral type.
+ * @param lookup_container Host lookup map.
+ * @param edge_ids_to_lookup Host span of edge ids to lookup
+ * @param edge_type_to_lookup Type of the edges corresponding to edge ids in @p edge_ids_to_lookup
+ * @param num_threads Number of threads, 0 for the hardware concurrency.
+ * @return A tuple of host vectors containing edge sources and destinations for edge ids in @p
+ * edge_ids_to_lookup. If an edge id or the edge type is not found, the corresponding entries
+ * contain cugraph::invalid_vertex_id<vertex_t>.
+ */
+template <typename vertex_t, typename edge_t, typename edge_type_t>
+std::tuple<std::vector<vertex_t>, std::vector<vertex_t>>
+lookup_endpoints_from_edge_ids_and_single_type(
+  host_lookup_container_t<edge_t, edge_type_t, vertex_t> const& lookup_container,
+  raft::host_span<edge_t const> edge_ids_to_lookup,
+  edge_type_t edge_type_to_lookup,
+  size_t num_threads = 0);
+
+/**
+ * @ingroup sampling_functions_cpp
+ * @brief Lookup edge sources and destinations in a host map using edge ids and edge types.
+ *
+ * @tparam vertex_t Type of vertex identifiers. Needs to be an integral type.
+ * @tparam edge_t Type of edge identifiers. Needs to be an integral type.
+ * @tparam edge_type_t Type of edge types. Needs to be an integral type.
+ * @param lookup_container Host lookup map.
+ * @param edge_ids_to_lookup Host span of edge ids to lookup
+ * @param edge_types_to_lookup Host span of edge types corresponding to the edge ids in @p
+ * edge_ids_to_lookup
+ * @param num_threads Number of threads, 0 for the hardware concurrency.
+ * @return A tuple of host vectors containing edge sources and destinations for the edge ids in @p
+ * edge_ids_to_lookup and the edge types in @p edge_types_to_lookup. If an edge id or edge type is
+ * not found, the corresponding entries contain cugraph::invalid_vertex_id<vertex_t>.
+ */
+template <typename vertex_t, typename edge_t, typename edge_type_t>
+std::tuple<std::vector<vertex_t>, std::vector<vertex_t>> lookup_endpoints_from_edge_ids_and_types(
+  host_lookup_container_t<edge_t, edge_type_t, vertex_t> const& lookup_container,
+  raft::host_span<edge_t const> edge_ids_to_lookup,
+  raft::host_span<edge_type_t const> edge_types_to_lookup,
+  size_t num_threads = 0);
+
+}  // namespace cugraph
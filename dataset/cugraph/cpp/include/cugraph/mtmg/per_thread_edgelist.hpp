@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <cugraph/host_renumber.hpp>
 #include <cugraph/mtmg/detail/device_shared_wrapper.hpp>
 #include <cugraph/mtmg/detail/per_device_edgelist.hpp>
 
@@ -33,6 +34,11 @@ namespace mtmg {
  * Calls to the append() method will take edges (in CPU host memory) and append them to a local
  * buffer.  As the local buffer fills, the buffer will be sent to GPU memory using the flush()
  * method.  This allows the CPU to GPU transfers to be larger (and consequently more efficient).
+ *
+ * If constructed with a host_vertex_map_t (shared by all the threads), appended vertex ids are
+ * renumbered on the host to consecutive ids before they are buffered, so that edges with
+ * arbitrary (e.g. hashed) vertex ids can be partitioned evenly across GPUs.  The map's
+ * renumber_map() then translates the ids back.
  */
 template <typename vertex_t,
           typename weight_t,
@@ -45,7 +51,7 @@ class per_thread_edgelist_t {
   per_thread_edgelist_t(per_thread_edgelist_t const&) = delete;
 
   /**
-   * @brief Only constructor
+   * @brief Constructor
    *
    * @param edgelist            The edge list this thread_edgelist_t should be associated with
    * @param thread_buffer_size  Size of the local buffer for accumulating edges on the CPU
@@ -78,6 +84,22 @@ class per_thread_edgelist_t {
       edge_end_time_ = std::make_optional(std::vector<edge_time_t>(thread_buffer_size));
   }
 
+  /**
+   * @brief Constructor renumbering vertex ids on the host
+   *
+   * @param edgelist            The edge list this thread_edgelist_t should be associated with
+   * @param thread_buffer_size  Size of the local buffer for accumulating edges on the CPU
+   * @param vertex_map          Map assigning consecutive vertex ids, shared by all threads
+   */
+  per_thread_edgelist_t(
+    detail::per_device_edgelist_t<vertex_t, weight_t, edge_t, edge_type_t, edge_time_t>& edgelist,
+    size_t thread_buffer_size,
+    host_vertex_map_t<vertex_t>& vertex_map)
+    : per_thread_edgelist_t(edgelist, thread_buffer_size)
+  {
+    vertex_map_ = &vertex_map;
+  }
+
   /**
    * @brief Append an edge to the edge list
    *
@@ -101,6 +123,11 @@ class per_thread_edgelist_t {
   {
     if (current_pos_ == src_.size()) { flush(stream_view); }
 
+    if (vertex_map_ != nullptr) {
+      src = vertex_map_->insert(src);
+      dst = vertex_map_->insert(dst);
+    }
+
     src_[current_pos_] = src;
     dst_[current_pos_] = dst;
     if (wgt) (*wgt_)[current_pos_] = *wgt;
@@ -139,6 +166,12 @@ class per_thread_edgelist_t {
 
       std::copy(src.begin() + pos, src.begin() + pos + copy_count, src_.begin() + current_pos_);
       std::copy(dst.begin() + pos, dst.begin() + pos + copy_count, dst_.begin() + current_pos_);
+      if (vertex_map_ != nullptr) {
+        vertex_map_->insert(raft::host_span<vertex_t const>{src_.data() + current_pos_, copy_count},
+                            raft::host_span<vertex_t>{src_.data() + current_pos_, copy_count});
+        vertex_map_->insert(raft::host_span<vertex_t const>{dst_.data() + current_pos_, copy_count},
+                            raft::host_span<vertex_t>{dst_.data() + current_pos_, copy_count});
+      }
       if (wgt)
         std::copy(wgt.begin() + pos, wgt.begin() + pos + copy_count, wgt_->begin() + current_pos_);
       if (edge_id)
@@ -199,6 +232,7 @@ class per_thread_edgelist_t {
 
  private:
   detail::per_device_edgelist_t<vertex_t, weight_t, edge_t, edge_type_t, edge_time_t>& edgelist_;
+  host_vertex_map_t<vertex_t>* vertex_map_{nullptr};
   size_t current_pos_{0};
   std::vector<vertex_t> src_{};
   std::vector<vertex_t> dst_{};
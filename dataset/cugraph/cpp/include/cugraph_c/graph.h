@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -134,6 +134,89 @@ cugraph_error_code_t cugraph_graph_create_sg_from_csr(
   cugraph_graph_t** graph,
   cugraph_error_t** error);
 
+/**
+ * @brief     Construct an SG graph in host memory
+ *
+ * Algorithms on a host graph run on the host threads instead of the GPU, which answers queries
+ * on small graphs (up to a few hundred thousand edges) with much lower latency than constructing
+ * and traversing a graph on the device.  The algorithms take and return device arrays as for any
+ * other graph.  Currently BFS, SSSP, PageRank (including personalized PageRank), random walks,
+ * neighbor sampling, triangle counting, K-truss, Louvain, Leiden and ECG support host graphs;
+ * other algorithms return CUGRAPH_NOT_IMPLEMENTED.
+ *
+ * @param [in]  handle         Handle for accessing resources
+ * @param [in]  properties     Properties of the constructed graph
+ * @param [in]  src            Host array containing the source vertex ids.
+ * @param [in]  dst            Host array containing the destination vertex ids
+ * @param [in]  weights        Host array containing the edge weights.  Note that an unweighted
+ *                             graph can be created by passing weights == NULL.
+ * @param [in]  renumber       If true, renumber vertices to consecutive integers.  Renumbering is
+ *    required if the vertices are not sequential integer values from 0 to num_vertices.
+ * @param [in]  drop_self_loops  If true, drop any self loops that exist in the provided edge list.
+ * @param [in]  drop_multi_edges If true, drop any multi edges that exist in the provided edge list.
+ * @param [in]  symmetrize     If true, symmetrize the edgelist.
+ * @param [out] graph          A pointer to the graph object
+ * @param [out] error          Pointer to an error object storing details of any error.  Will
+ *                             be populated if error code is not CUGRAPH_SUCCESS
+ *
+ * @return error code
+ */
+cugraph_error_code_t cugraph_graph_create_sg_from_host_edgelist(
+  const cugraph_resource_handle_t* handle,
+  const cugraph_graph_properties_t* properties,
+  const cugraph_type_erased_host_array_view_t* src,
+  const cugraph_type_erased_host_array_view_t* dst,
+  const cugraph_type_erased_host_array_view_t* weights,
+  bool_t renumber,
+  bool_t drop_self_loops,
+  bool_t drop_multi_edges,
+  bool_t symmetrize,
+  cugraph_graph_t** graph,
+  cugraph_error_t** error);
+
+/**
+ * @brief     Construct an SG graph in host memory from a CSR file
+ *
+ * A CSR file holds a renumbered graph in CSR format with compressed adjacency lists (see
+ * cugraph/host_csr_file.hpp), so loading it only maps the file and decodes the adjacency lists;
+ * the edge list is not parsed, renumbered or sorted again.  The graph is a host graph, as created
+ * by cugraph_graph_create_sg_from_host_edgelist.  The vertex and weight types are those of the
+ * file.
+ *
+ * @param [in]  handle         Handle for accessing resources
+ * @param [in]  path           Path of the CSR file
+ * @param [out] graph          A pointer to the graph object
+ * @param [out] error          Pointer to an error object storing details of any error.  Will
+ *                             be populated if error code is not CUGRAPH_SUCCESS
+ *
+ * @return error code
+ */
+cugraph_error_code_t cugraph_graph_create_sg_from_host_csr_file(
+  const cugraph_resource_handle_t* handle,
+  const char* path,
+  cugraph_graph_t** graph,
+  cugraph_error_t** error);
+
+/**
+ * @brief     Write a host graph to a CSR file
+ *
+ * Writes the CSR, weights and renumber map of a graph created by
+ * cugraph_graph_create_sg_from_host_edgelist (or cugraph_graph_create_sg_from_host_csr_file),
+ * so that later jobs can load it with cugraph_graph_create_sg_from_host_csr_file.
+ *
+ * @param [in]  handle         Handle for accessing resources
+ * @param [in]  graph          A host graph
+ * @param [in]  path           Path of the CSR file, overwritten if it exists
+ * @param [out] error          Pointer to an error object storing details of any error.  Will
+ *                             be populated if error code is not CUGRAPH_SUCCESS
+ *
+ * @return error code
+ */
+cugraph_error_code_t cugraph_graph_write_host_csr_file(const cugraph_resource_handle_t* handle,
+                                                       const cugraph_graph_t* graph,
+                                                       const char* path,
+                                                       cugraph_error_t** error);
+
 /**
  * @brief     Construct an MG graph
  *
@@ -108,6 +108,84 @@ cugraph_error_code_t cugraph_lookup_endpoints_from_edge_ids_and_types(
   cugraph_lookup_result_t** result,
   cugraph_error_t** error);
 
+/**
+ * @brief Build a host memory map to lookup source and destination using edge id and type
+ *
+ * The map is built in parallel on the CPU from an edge list in host memory and is looked up with
+ * cugraph_lookup_endpoints_from_edge_ids_and_types_host or
+ * cugraph_lookup_endpoints_from_edge_ids_and_single_type_host.  Edge ids of each edge type are
+ * kept in a compressed (Elias-Fano) index, so the map takes little more than the source and
+ * destination arrays.
+ *
+ * @param [in]  handle       Handle for accessing resources
+ * @param [in]  srcs         Edge sources (INT32 or INT64)
+ * @param [in]  dsts         Edge destinations, same type as @p srcs
+ * @param [in]  edge_ids     Edge ids, same type as @p srcs, unique within each edge type
+ * @param [in]  edge_types   Edge types (INT32).  If NULL every edge has type 0
+ * @param [out]  lookup_container Lookup map
+ * @param [out]  error        Pointer to an error object storing details of any error.  Will
+ *                           be populated if error code is not CUGRAPH_SUCCESS
+ * @return error code
+ */
+cugraph_error_code_t cugraph_build_edge_id_and_type_to_src_dst_host_lookup_map(
+  const cugraph_resource_handle_t* handle,
+  const cugraph_type_erased_host_array_view_t* srcs,
+  const cugraph_type_erased_host_array_view_t* dsts,
+  const cugraph_type_erased_host_array_view_t* edge_ids,
+  const cugraph_type_erased_host_array_view_t* edge_types,
+  cugraph_lookup_container_t** lookup_container,
+  cugraph_error_t** error);
+
+/**
+ * @brief Lookup edge sources and destinations in a host map using edge ids and a single edge
+ * type.
+ *
+ * @param [in]  handle       Handle for accessing resources
+ * @param [in]  lookup_container Lookup map built by
+ *                           cugraph_build_edge_id_and_type_to_src_dst_host_lookup_map
+ * @param[in]  edge_ids_to_lookup Edge ids to lookup
+ * @param[in]  edge_type_to_lookup Edge type of the edge ids in @p edge_ids_to_lookup
+ * @param [out]  srcs        Edge sources, the size of @p edge_ids_to_lookup.  Edges that are not
+ *                           found get an invalid vertex id (-1)
+ * @param [out]  dsts        Edge destinations, the size of @p edge_ids_to_lookup
+ * @param [out]  error        Pointer to an error object storing details of any error.  Will
+ *                           be populated if error code is not CUGRAPH_SUCCESS
+ * @return error code
+ */
+cugraph_error_code_t cugraph_lookup_endpoints_from_edge_ids_and_single_type_host(
+  const cugraph_resource_handle_t* handle,
+  const cugraph_lookup_container_t* lookup_container,
+  const cugraph_type_erased_host_array_view_t* edge_ids_to_lookup,
+  int edge_type_to_lookup,
+  cugraph_type_erased_host_array_view_t* srcs,
+  cugraph_type_erased_host_array_view_t* dsts,
+  cugraph_error_t** error);
+
+/**
+ * @brief Lookup edge sources and destinations in a host map using edge ids and edge types.
+ *
+ * @param [in]  handle       Handle for accessing resources
+ * @param [in]  lookup_container Lookup map built by
+ *                           cugraph_build_edge_id_and_type_to_src_dst_host_lookup_map
+ * @param[in]  edge_ids_to_lookup Edge ids to lookup
+ * @param[in]  edge_types_to_lookup Edge types corresponding to the edge ids in @p
+ * edge_ids_to_lookup
+ * @param [out]  srcs        Edge sources, the size of @p edge_ids_to_lookup.  Edges that are not
+ *                           found get an invalid vertex id (-1)
+ * @param [out]  dsts        Edge destinations, the size of @p edge_ids_to_lookup
+ * @param [out]  error        Pointer to an error object storing details of any error.  Will
+ *                           be populated if error code is not CUGRAPH_SUCCESS
+ * @return error code
+ */
+cugraph_error_code_t cugraph_lookup_endpoints_from_edge_ids_and_types_host(
+  const cugraph_resource_handle_t* handle,
+  const cugraph_lookup_container_t* lookup_container,
+  const cugraph_type_erased_host_array_view_t* edge_ids_to_lookup,
+  const cugraph_type_erased_host_array_view_t* edge_types_to_lookup,
+  cugraph_type_erased_host_array_view_t* srcs,
+  cugraph_type_erased_host_array_view_t* dsts,
+  cugraph_error_t** error);
+
 /**
  * @ingroup samplingC
  * @brief  Get the edge sources from the lookup result
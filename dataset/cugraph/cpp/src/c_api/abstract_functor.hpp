@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -30,6 +30,9 @@ struct abstract_functor {
   std::unique_ptr<cugraph_error_t> error_ = {std::make_unique<cugraph_error_t>("")};
   cugraph_error_code_t error_code_{CUGRAPH_SUCCESS};
 
+  // Functors that can run on a host graph (see host_graph_t) override this
+  static constexpr bool supports_host_graph{false};
+
   void unsupported()
   {
     mark_error(CUGRAPH_UNSUPPORTED_TYPE_COMBINATION,
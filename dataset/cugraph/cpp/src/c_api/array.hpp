@@ -66,6 +66,15 @@ struct cugraph_type_erased_device_array_t {
   {
   }
 
+  // Copies a host vector, the stream must be synchronized before the vector is destroyed
+  template <typename T>
+  cugraph_type_erased_device_array_t(std::vector<T> const& vec,
+                                     cugraph_data_type_id_t type,
+                                     rmm::cuda_stream_view const& stream_view)
+    : size_(vec.size()), data_(vec.data(), vec.size() * sizeof(T), stream_view), type_(type)
+  {
+  }
+
   template <typename T>
   T* as_type()
   {
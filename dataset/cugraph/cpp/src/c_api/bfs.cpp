@@ -16,6 +16,7 @@
 
 #include "c_api/abstract_functor.hpp"
 #include "c_api/graph.hpp"
+#include "c_api/host_graph_algorithms.hpp"
 #include "c_api/paths_result.hpp"
 #include "c_api/resource_handle.hpp"
 #include "c_api/utils.hpp"
@@ -40,6 +41,8 @@ struct bfs_functor : public abstract_functor {
   bool do_expensive_check_;
   cugraph_paths_result_t* result_{};
 
+  static constexpr bool supports_host_graph{true};
+
   bfs_functor(::cugraph_resource_handle_t const* handle,
               ::cugraph_graph_t* graph,
               ::cugraph_type_erased_device_array_view_t* sources,
@@ -70,6 +73,13 @@ struct bfs_functor : public abstract_functor {
     if constexpr (!cugraph::is_candidate<vertex_t, edge_t, weight_t>::value) {
       unsupported();
     } else {
+      if constexpr (!multi_gpu) {
+        if (graph_->host_graph_ != nullptr) {
+          run_on_host<vertex_t, edge_t, weight_t>();
+          return;
+        }
+      }
+
       // BFS expects store_transposed == false
       if constexpr (store_transposed) {
         error_code_ = cugraph::c_api::
@@ -155,6 +165,50 @@ struct bfs_functor : public abstract_functor {
         new cugraph_type_erased_device_array_t(predecessors, graph_->vertex_type_)};
     }
   }
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_on_host()
+  {
+    auto graph =
+      reinterpret_cast<host_graph_t<vertex_t, edge_t, weight_t> const*>(graph_->host_graph_);
+
+    std::vector<vertex_t> sources(sources_->size_);
+    raft::update_host(
+      sources.data(), sources_->as_type<vertex_t>(), sources.size(), handle_.get_stream());
+    handle_.sync_stream();
+
+    for (auto& source : sources) {
+      source = graph->internal_vertex(source);
+      if (source == cugraph::invalid_vertex_id<vertex_t>::value) {
+        mark_error(CUGRAPH_INVALID_INPUT, "Found invalid vertex in the input sources");
+        return;
+      }
+    }
+
+    std::vector<vertex_t> distances(graph->number_of_vertices_);
+    std::vector<vertex_t> predecessors(compute_predecessors_ ? graph->number_of_vertices_ : 0);
+
+    host_bfs(*graph,
+             sources,
+             direction_optimizing_,
+             depth_limit_,
+             distances.data(),
+             compute_predecessors_ ? predecessors.data() : nullptr);
+
+    for (auto& predecessor : predecessors) {
+      predecessor = graph->external_vertex(predecessor);
+    }
+
+    auto vertex_ids = graph->vertex_ids();
+
+    result_ = new cugraph_paths_result_t{
+      new cugraph_type_erased_device_array_t(
+        vertex_ids, graph_->vertex_type_, handle_.get_stream()),
+      new cugraph_type_erased_device_array_t(distances, graph_->vertex_type_, handle_.get_stream()),
+      new cugraph_type_erased_device_array_t(
+        predecessors, graph_->vertex_type_, handle_.get_stream())};
+    handle_.sync_stream();
+  }
 };
 
 }  // namespace c_api
@@ -25,6 +25,7 @@
 #include <c_api/graph.hpp>
 #include <c_api/graph_helper.hpp>
 #include <c_api/hierarchical_clustering_result.hpp>
+#include <c_api/host_louvain.hpp>
 #include <c_api/random.hpp>
 #include <c_api/resource_handle.hpp>
 #include <c_api/utils.hpp>
@@ -45,6 +46,8 @@ struct ecg_functor : public cugraph::c_api::abstract_functor {
   bool do_expensive_check_{false};
   cugraph::c_api::cugraph_hierarchical_clustering_result_t* result_{};
 
+  static constexpr bool supports_host_graph{true};
+
   ecg_functor(::cugraph_resource_handle_t const* handle,
               ::cugraph_rng_state_t* rng_state,
               ::cugraph_graph_t* graph,
@@ -58,6 +61,8 @@ struct ecg_functor : public cugraph::c_api::abstract_functor {
       handle_(*reinterpret_cast<cugraph::c_api::cugraph_resource_handle_t const*>(handle)->handle_),
       rng_state_(reinterpret_cast<cugraph::c_api::cugraph_rng_state_t*>(rng_state)),
       graph_(reinterpret_cast<cugraph::c_api::cugraph_graph_t*>(graph)),
+      min_weight_(min_weight),
+      ensemble_size_(ensemble_size),
       max_level_(max_level),
       threshold_(threshold),
       resolution_(resolution),
@@ -76,6 +81,13 @@ struct ecg_functor : public cugraph::c_api::abstract_functor {
     if constexpr (!cugraph::is_candidate<vertex_t, edge_t, weight_t>::value) {
       unsupported();
     } else {
+      if constexpr (!multi_gpu) {
+        if (graph_->host_graph_ != nullptr) {
+          run_on_host<vertex_t, edge_t, weight_t>();
+          return;
+        }
+      }
+
       // ecg expects store_transposed == false
       if constexpr (store_transposed) {
         error_code_ = cugraph::c_api::
@@ -123,6 +135,39 @@ struct ecg_functor : public cugraph::c_api::abstract_functor {
         new cugraph::c_api::cugraph_type_erased_device_array_t(clusters, graph_->vertex_type_)};
     }
   }
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_on_host()
+  {
+    auto graph = reinterpret_cast<cugraph::c_api::host_graph_t<vertex_t, edge_t, weight_t> const*>(
+      graph_->host_graph_);
+
+    if (!graph->is_symmetric_) {
+      mark_error(CUGRAPH_INVALID_INPUT, "ECG requires a symmetric graph");
+      return;
+    }
+
+    auto rng_seed = cugraph::c_api::host_rng_seed(rng_state_->rng_state_);
+
+    auto [clusters, modularity] = cugraph::c_api::host_ecg(*graph,
+                                                           min_weight_,
+                                                           ensemble_size_,
+                                                           max_level_,
+                                                           threshold_,
+                                                           resolution_,
+                                                           rng_seed);
+
+    auto vertices = graph->vertex_ids();
+
+    auto stream = handle_.get_stream();
+    result_     = new cugraph::c_api::cugraph_hierarchical_clustering_result_t{
+      modularity,
+      new cugraph::c_api::cugraph_type_erased_device_array_t(
+        vertices, graph_->vertex_type_, stream),
+      new cugraph::c_api::cugraph_type_erased_device_array_t(
+        clusters, graph_->vertex_type_, stream)};
+    handle_.sync_stream();
+  }
 };
 
 }  // namespace
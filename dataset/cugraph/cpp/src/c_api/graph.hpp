@@ -43,6 +43,8 @@ struct cugraph_graph_t {
   void* edge_types_;        // edge_property_t<edge_t, edge_type_t>*
   void* edge_start_times_;  // edge_property_t<edge_t, edge_time_t>*
   void* edge_end_times_;    // edge_property_t<edge_t, edge_time_t>*
+
+  void* host_graph_{nullptr};  // host_graph_t<vertex_t, edge_t, weight_t>*, graph_ is nullptr
 };
 
 template <typename vertex_t,
@@ -20,6 +20,7 @@
 #include "c_api/generic_cascaded_dispatch.hpp"
 #include "c_api/graph.hpp"
 #include "c_api/graph_helper.hpp"
+#include "c_api/host_graph.hpp"
 #include "c_api/resource_handle.hpp"
 
 #include <cugraph_c/graph.h>
@@ -552,15 +553,21 @@ struct destroy_graph_functor : public cugraph::c_api::abstract_functor {
   void* edge_weights_;
   void* edge_ids_;
   void* edge_types_;
-
-  destroy_graph_functor(
-    void* graph, void* number_map, void* edge_weights, void* edge_ids, void* edge_types)
+  void* host_graph_;
+
+  destroy_graph_functor(void* graph,
+                        void* number_map,
+                        void* edge_weights,
+                        void* edge_ids,
+                        void* edge_types,
+                        void* host_graph)
     : abstract_functor(),
       graph_(graph),
       number_map_(number_map),
       edge_weights_(edge_weights),
       edge_ids_(edge_ids),
-      edge_types_(edge_types)
+      edge_types_(edge_types),
+      host_graph_(host_graph)
   {
   }
 
@@ -593,6 +600,10 @@ struct destroy_graph_functor : public cugraph::c_api::abstract_functor {
     auto internal_edge_type_pointer =
       reinterpret_cast<cugraph::edge_property_t<edge_t, edge_type_t>*>(edge_types_);
     if (internal_edge_type_pointer) { delete internal_edge_type_pointer; }
+
+    auto internal_host_graph_pointer =
+      reinterpret_cast<cugraph::c_api::host_graph_t<vertex_t, edge_t, weight_t>*>(host_graph_);
+    if (internal_host_graph_pointer) { delete internal_host_graph_pointer; }
   }
 };
 
@@ -851,7 +862,8 @@ extern "C" void cugraph_graph_free(cugraph_graph_t* ptr_graph)
                                   internal_pointer->number_map_,
                                   internal_pointer->edge_weights_,
                                   internal_pointer->edge_ids_,
-                                  internal_pointer->edge_types_);
+                                  internal_pointer->edge_types_,
+                                  internal_pointer->host_graph_);
 
     cugraph::c_api::vertex_dispatcher(internal_pointer->vertex_type_,
                                       internal_pointer->edge_type_,
@@ -0,0 +1,810 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "c_api/host_graph.hpp"
+
+#include "c_api/abstract_functor.hpp"
+#include "c_api/array.hpp"
+#include "c_api/error.hpp"
+#include "c_api/generic_cascaded_dispatch.hpp"
+#include "c_api/graph.hpp"
+
+#include <cugraph/host_csr_file.hpp>
+#include <cugraph/utilities/error.hpp>
+
+#include <cugraph_c/graph.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <optional>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <utility>
+
+namespace cugraph {
+namespace c_api {
+
+namespace {
+
+/**
+ * @brief Fixed set of threads that run the chunks of one parallel loop at a time.
+ */
+class host_worker_pool {
+ public:
+  host_worker_pool()
+  {
+    auto num_workers = std::max(std::thread::hardware_concurrency(), 1u) - 1;
+    workers_.reserve(num_workers);
+    for (unsigned i = 0; i < num_workers; ++i) {
+      workers_.emplace_back([this] { work(); });
+    }
+  }
+
+  host_worker_pool(host_worker_pool const&)            = delete;
+  host_worker_pool& operator=(host_worker_pool const&) = delete;
+
+  ~host_worker_pool()
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+    wake_.notify_all();
+    for (auto& worker : workers_) {
+      worker.join();
+    }
+  }
+
+  size_t num_threads() const { return workers_.size() + 1; }
+
+  /**
+   * @brief Whether the calling thread is running a chunk of a parallel loop.
+   */
+  static bool& in_parallel_loop()
+  {
+    thread_local bool in_loop{false};
+    return in_loop;
+  }
+
+  /**
+   * @brief Runs f on each task index if no other loop is using the workers, returns false
+   * otherwise.
+   */
+  bool try_run(size_t num_tasks, std::function<void(size_t)> const& f)
+  {
+    std::unique_lock<std::mutex> run_lock(run_mutex_, std::try_to_lock);
+    if (!run_lock.owns_lock()) { return false; }
+
+    job_t job{f, num_tasks};
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      job_ = &job;
+      ++generation_;
+    }
+    wake_.notify_all();
+
+    execute(job);
+
+    {
+      // Workers that have not picked up the job yet will find job_ reset and skip it
+      std::unique_lock<std::mutex> lock(mutex_);
+      done_.wait(lock, [this] { return active_workers_ == 0; });
+      job_ = nullptr;
+    }
+
+    if (job.error) { std::rethrow_exception(job.error); }
+    return true;
+  }
+
+ private:
+  struct job_t {
+    job_t(std::function<void(size_t)> const& f, size_t num_tasks) : f_(f), num_tasks_(num_tasks)
+    {
+    }
+
+    std::function<void(size_t)> const& f_;
+    size_t num_tasks_;
+    std::atomic<size_t> next_task_{0};
+    std::mutex error_mutex_{};
+    std::exception_ptr error{};
+  };
+
+  static void execute(job_t& job)
+  {
+    in_parallel_loop() = true;
+    for (auto task = job.next_task_.fetch_add(1); task < job.num_tasks_;
+         task      = job.next_task_.fetch_add(1)) {
+      try {
+        job.f_(task);
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(job.error_mutex_);
+        if (!job.error) { job.error = std::current_exception(); }
+      }
+    }
+    in_parallel_loop() = false;
+  }
+
+  void work()
+  {
+    uint64_t seen_generation{0};
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      wake_.wait(lock, [&] { return stop_ || (generation_ != seen_generation); });
+      if (stop_) { return; }
+      seen_generation = generation_;
+      if (job_ == nullptr) { continue; }
+
+      auto job = job_;
+      ++active_workers_;
+      lock.unlock();
+      execute(*job);
+      lock.lock();
+      if (--active_workers_ == 0) { done_.notify_all(); }
+    }
+  }
+
+  std::vector<std::thread> workers_{};
+  std::mutex run_mutex_{};
+  std::mutex mutex_{};
+  std::condition_variable wake_{};
+  std::condition_variable done_{};
+  job_t* job_{nullptr};
+  uint64_t generation_{0};
+  size_t active_workers_{0};
+  bool stop_{false};
+};
+
+host_worker_pool& worker_pool()
+{
+  static host_worker_pool pool{};
+  return pool;
+}
+
+}  // namespace
+
+size_t host_num_threads() { return worker_pool().num_threads(); }
+
+size_t host_num_chunks(size_t n, size_t min_chunk_size)
+{
+  if ((n < 2 * min_chunk_size) || host_worker_pool::in_parallel_loop()) { return 1; }
+  auto num_threads = host_num_threads();
+  if (num_threads == 1) { return 1; }
+  // A few chunks per thread balance chunks of uneven cost
+  return std::min(n / min_chunk_size, num_threads * 4);
+}
+
+void host_parallel_for_chunks(size_t num_chunks, std::function<void(size_t)> const& f)
+{
+  if ((num_chunks <= 1) || host_worker_pool::in_parallel_loop() ||
+      !worker_pool().try_run(num_chunks, f)) {
+    for (size_t chunk = 0; chunk < num_chunks; ++chunk) {
+      f(chunk);
+    }
+  }
+}
+
+namespace {
+
+/**
+ * @brief Sorts edges by their major vertex into offsets and (minor, weight) arrays.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+void counting_sort_edges(vertex_t number_of_vertices,
+                         std::vector<vertex_t> const& majors,
+                         std::vector<vertex_t> const& minors,
+                         std::vector<weight_t> const& weights,
+                         std::vector<edge_t>& offsets,
+                         std::vector<vertex_t>& indices,
+                         std::vector<weight_t>& sorted_weights)
+{
+  indices.resize(majors.size());
+  sorted_weights.resize(weights.size());
+  offsets = host_counting_sort<edge_t>(
+    majors.size(),
+    static_cast<size_t>(number_of_vertices),
+    [&](size_t i) { return static_cast<size_t>(majors[i]); },
+    [&](size_t i, edge_t position) {
+      indices[position] = minors[i];
+      if (!weights.empty()) { sorted_weights[position] = weights[i]; }
+    });
+}
+
+// Derives the SSSP edge order and the transposed graph from the CSR of a graph
+template <typename vertex_t, typename edge_t, typename weight_t>
+void finish_host_graph(host_graph_t<vertex_t, edge_t, weight_t>& graph)
+{
+  // The average edge weight balances the work of a delta-stepping bucket against the number of
+  // buckets.  Delta is at least a fraction of the maximum weight, so that skewed weights (many
+  // tiny edges and a few heavy ones) can't spread the tentative distances over a huge number of
+  // buckets
+  if (graph.is_weighted_) {
+    auto sum = std::accumulate(graph.weights_.begin(), graph.weights_.end(), double{0});
+    if (sum > 0) {
+      graph.sssp_max_weight_ = *std::max_element(graph.weights_.begin(), graph.weights_.end());
+      graph.sssp_delta_ =
+        std::max(static_cast<weight_t>(sum / graph.weights_.size()),
+                 graph.sssp_max_weight_ / static_cast<weight_t>(host_sssp_max_buckets));
+    }
+
+    std::vector<std::tuple<vertex_t, weight_t>> heavy{};
+    graph.heavy_offsets_.resize(graph.number_of_vertices_);
+    for (vertex_t v = 0; v < graph.number_of_vertices_; ++v) {
+      auto light = graph.offsets_[v];
+      heavy.clear();
+      for (auto e = graph.offsets_[v]; e < graph.offsets_[v + 1]; ++e) {
+        if (graph.weights_[e] <= graph.sssp_delta_) {
+          graph.indices_[light] = graph.indices_[e];
+          graph.weights_[light] = graph.weights_[e];
+          ++light;
+        } else {
+          heavy.emplace_back(graph.indices_[e], graph.weights_[e]);
+        }
+      }
+      graph.heavy_offsets_[v] = light;
+      for (auto const& [dst, weight] : heavy) {
+        graph.indices_[light] = dst;
+        graph.weights_[light] = weight;
+        ++light;
+      }
+    }
+  }
+
+  if (graph.is_symmetric_) {
+    graph.transposed_offsets_ = graph.offsets_;
+    graph.transposed_indices_ = graph.indices_;
+    graph.transposed_weights_ = graph.weights_;
+  } else {
+    std::vector<vertex_t> rows(graph.indices_.size());
+    for (vertex_t v = 0; v < graph.number_of_vertices_; ++v) {
+      std::fill(rows.begin() + graph.offsets_[v], rows.begin() + graph.offsets_[v + 1], v);
+    }
+    counting_sort_edges(graph.number_of_vertices_,
+                        graph.indices_,
+                        rows,
+                        graph.weights_,
+                        graph.transposed_offsets_,
+                        graph.transposed_indices_,
+                        graph.transposed_weights_);
+  }
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+std::unique_ptr<host_graph_t<vertex_t, edge_t, weight_t>> make_host_graph(
+  vertex_t const* src,
+  vertex_t const* dst,
+  weight_t const* weights,
+  size_t num_edges,
+  bool is_symmetric,
+  bool renumber,
+  bool drop_self_loops,
+  bool drop_multi_edges,
+  bool symmetrize)
+{
+  auto graph           = std::make_unique<host_graph_t<vertex_t, edge_t, weight_t>>();
+  graph->is_symmetric_ = is_symmetric;
+  graph->is_weighted_  = weights != nullptr;
+
+  std::vector<vertex_t> majors(src, src + num_edges);
+  std::vector<vertex_t> minors(dst, dst + num_edges);
+  std::vector<weight_t> edge_weights{};
+  if (weights != nullptr) { edge_weights.assign(weights, weights + num_edges); }
+
+  if (renumber) {
+    graph->number_map_.reserve(2 * num_edges);
+    graph->number_map_.insert(graph->number_map_.end(), majors.begin(), majors.end());
+    graph->number_map_.insert(graph->number_map_.end(), minors.begin(), minors.end());
+    std::sort(graph->number_map_.begin(), graph->number_map_.end());
+    graph->number_map_.erase(std::unique(graph->number_map_.begin(), graph->number_map_.end()),
+                             graph->number_map_.end());
+    graph->number_map_.shrink_to_fit();
+
+    graph->renumber_lookup_.reserve(graph->number_map_.size());
+    for (size_t i = 0; i < graph->number_map_.size(); ++i) {
+      graph->renumber_lookup_.emplace(graph->number_map_[i], static_cast<vertex_t>(i));
+    }
+    for (size_t i = 0; i < num_edges; ++i) {
+      majors[i] = graph->renumber_lookup_[majors[i]];
+      minors[i] = graph->renumber_lookup_[minors[i]];
+    }
+    graph->number_of_vertices_ = static_cast<vertex_t>(graph->number_map_.size());
+  } else {
+    vertex_t max_vertex{-1};
+    for (size_t i = 0; i < num_edges; ++i) {
+      max_vertex = std::max({max_vertex, majors[i], minors[i]});
+    }
+    graph->number_of_vertices_ = max_vertex + 1;
+  }
+
+  if (symmetrize) {
+    majors.reserve(2 * num_edges);
+    minors.reserve(2 * num_edges);
+    majors.insert(majors.end(), minors.begin(), minors.end());
+    minors.insert(minors.end(), majors.begin(), majors.begin() + num_edges);
+    if (weights != nullptr) {
+      edge_weights.resize(2 * num_edges);
+      std::copy(edge_weights.begin(),
+                edge_weights.begin() + num_edges,
+                edge_weights.begin() + num_edges);
+    }
+  }
+
+  if (drop_self_loops) {
+    size_t kept{0};
+    for (size_t i = 0; i < majors.size(); ++i) {
+      if (majors[i] == minors[i]) { continue; }
+      majors[kept] = majors[i];
+      minors[kept] = minors[i];
+      if (weights != nullptr) { edge_weights[kept] = edge_weights[i]; }
+      ++kept;
+    }
+    majors.resize(kept);
+    minors.resize(kept);
+    if (weights != nullptr) { edge_weights.resize(kept); }
+  }
+
+  counting_sort_edges(graph->number_of_vertices_,
+                      majors,
+                      minors,
+                      edge_weights,
+                      graph->offsets_,
+                      graph->indices_,
+                      graph->weights_);
+
+  // Symmetrizing duplicates the edges given in both directions, these copies are always dropped
+  if (drop_multi_edges || symmetrize) {
+    std::vector<std::tuple<vertex_t, weight_t>> row{};
+    edge_t kept{0};
+    for (vertex_t v = 0; v < graph->number_of_vertices_; ++v) {
+      auto first = graph->offsets_[v];
+      auto last  = graph->offsets_[v + 1];
+      row.clear();
+      for (auto e = first; e < last; ++e) {
+        row.emplace_back(graph->indices_[e],
+                         graph->is_weighted_ ? graph->weights_[e] : weight_t{1});
+      }
+      std::stable_sort(row.begin(), row.end(), [](auto const& lhs, auto const& rhs) {
+        return std::get<0>(lhs) < std::get<0>(rhs);
+      });
+      graph->offsets_[v] = kept;
+      for (size_t i = 0; i < row.size(); ++i) {
+        if ((i > 0) && (std::get<0>(row[i]) == std::get<0>(row[i - 1])) &&
+            (drop_multi_edges || (std::get<1>(row[i]) == std::get<1>(row[i - 1])))) {
+          continue;
+        }
+        graph->indices_[kept] = std::get<0>(row[i]);
+        if (graph->is_weighted_) { graph->weights_[kept] = std::get<1>(row[i]); }
+        ++kept;
+      }
+    }
+    graph->offsets_.back() = kept;
+    graph->indices_.resize(kept);
+    if (graph->is_weighted_) { graph->weights_.resize(kept); }
+  }
+
+  finish_host_graph(*graph);
+
+  return graph;
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+std::unique_ptr<host_graph_t<vertex_t, edge_t, weight_t>> make_host_graph_from_csr_file(
+  std::string const& path)
+{
+  host_csr_file_t<vertex_t, edge_t, weight_t> file(path);
+
+  auto graph                 = std::make_unique<host_graph_t<vertex_t, edge_t, weight_t>>();
+  graph->number_of_vertices_ = file.number_of_vertices();
+  graph->is_symmetric_       = file.is_symmetric();
+  graph->is_weighted_        = file.weights().has_value();
+
+  // The file is already renumbered and sorted; only the adjacency lists need decoding
+  graph->offsets_.assign(file.offsets().begin(), file.offsets().end());
+  graph->indices_ = file.decode_indices(host_num_threads());
+  if (auto weights = file.weights()) { graph->weights_.assign(weights->begin(), weights->end()); }
+
+  if (auto renumber_map = file.renumber_map()) {
+    graph->number_map_.assign(renumber_map->begin(), renumber_map->end());
+    graph->renumber_lookup_.reserve(graph->number_map_.size());
+    for (size_t i = 0; i < graph->number_map_.size(); ++i) {
+      graph->renumber_lookup_.emplace(graph->number_map_[i], static_cast<vertex_t>(i));
+    }
+    CUGRAPH_EXPECTS(graph->renumber_lookup_.size() == graph->number_map_.size(),
+                    "Corrupt CSR file: the renumber map has duplicate vertex ids.");
+  }
+
+  finish_host_graph(*graph);
+
+  return graph;
+}
+
+struct create_host_graph_functor : public abstract_functor {
+  cugraph_graph_properties_t const* properties_;
+  cugraph_type_erased_host_array_view_t const* src_;
+  cugraph_type_erased_host_array_view_t const* dst_;
+  cugraph_type_erased_host_array_view_t const* weights_;
+  bool renumber_;
+  bool drop_self_loops_;
+  bool drop_multi_edges_;
+  bool symmetrize_;
+  cugraph_graph_t* result_{};
+
+  create_host_graph_functor(cugraph_graph_properties_t const* properties,
+                            cugraph_type_erased_host_array_view_t const* src,
+                            cugraph_type_erased_host_array_view_t const* dst,
+                            cugraph_type_erased_host_array_view_t const* weights,
+                            bool renumber,
+                            bool drop_self_loops,
+                            bool drop_multi_edges,
+                            bool symmetrize)
+    : abstract_functor(),
+      properties_(properties),
+      src_(src),
+      dst_(dst),
+      weights_(weights),
+      renumber_(renumber),
+      drop_self_loops_(drop_self_loops),
+      drop_multi_edges_(drop_multi_edges),
+      symmetrize_(symmetrize)
+  {
+  }
+
+  template <typename vertex_t,
+            typename edge_t,
+            typename weight_t,
+            typename edge_type_t,
+            bool store_transposed,
+            bool multi_gpu>
+  void operator()()
+  {
+    if constexpr (multi_gpu || store_transposed ||
+                  !cugraph::is_candidate<vertex_t, edge_t, weight_t>::value) {
+      unsupported();
+    } else {
+      auto src = src_->as_type<vertex_t>();
+      auto dst = dst_->as_type<vertex_t>();
+
+      if (!renumber_) {
+        auto is_negative = [](vertex_t v) { return v < 0; };
+        if (std::any_of(src, src + src_->size_, is_negative) ||
+            std::any_of(dst, dst + dst_->size_, is_negative)) {
+          mark_error(CUGRAPH_INVALID_INPUT,
+                     "Vertex ids must be non-negative when 'renumber' is 'false'");
+          return;
+        }
+      }
+
+      auto graph = make_host_graph<vertex_t, edge_t, weight_t>(
+        src,
+        dst,
+        weights_ != nullptr ? weights_->as_type<weight_t>() : nullptr,
+        src_->size_,
+        properties_->is_symmetric == TRUE,
+        renumber_,
+        drop_self_loops_,
+        drop_multi_edges_,
+        symmetrize_);
+
+      result_ = new cugraph_graph_t{
+        src_->type_,
+        src_->type_,
+        weights_ != nullptr ? weights_->type_ : cugraph_data_type_id_t::FLOAT32,
+        cugraph_data_type_id_t::INT32,
+        false,
+        false,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        graph.release()};
+    }
+  }
+};
+
+struct create_host_graph_from_csr_file_functor : public abstract_functor {
+  std::string path_;
+  cugraph_data_type_id_t vertex_type_;
+  cugraph_data_type_id_t weight_type_;
+  cugraph_graph_t* result_{};
+
+  create_host_graph_from_csr_file_functor(std::string path,
+                                          cugraph_data_type_id_t vertex_type,
+                                          cugraph_data_type_id_t weight_type)
+    : abstract_functor(),
+      path_(std::move(path)),
+      vertex_type_(vertex_type),
+      weight_type_(weight_type)
+  {
+  }
+
+  template <typename vertex_t,
+            typename edge_t,
+            typename weight_t,
+            typename edge_type_t,
+            bool store_transposed,
+            bool multi_gpu>
+  void operator()()
+  {
+    if constexpr (multi_gpu || store_transposed ||
+                  !cugraph::is_candidate<vertex_t, edge_t, weight_t>::value) {
+      unsupported();
+    } else {
+      auto graph = make_host_graph_from_csr_file<vertex_t, edge_t, weight_t>(path_);
+
+      result_ = new cugraph_graph_t{vertex_type_,
+                                    vertex_type_,
+                                    weight_type_,
+                                    cugraph_data_type_id_t::INT32,
+                                    false,
+                                    false,
+                                    nullptr,
+                                    nullptr,
+                                    nullptr,
+                                    nullptr,
+                                    nullptr,
+                                    nullptr,
+                                    nullptr,
+                                    graph.release()};
+    }
+  }
+};
+
+struct write_host_csr_file_functor : public abstract_functor {
+  cugraph_graph_t const* graph_;
+  std::string path_;
+
+  write_host_csr_file_functor(cugraph_graph_t const* graph, std::string path)
+    : abstract_functor(), graph_(graph), path_(std::move(path))
+  {
+  }
+
+  template <typename vertex_t,
+            typename edge_t,
+            typename weight_t,
+            typename edge_type_t,
+            bool store_transposed,
+            bool multi_gpu>
+  void operator()()
+  {
+    if constexpr (multi_gpu || store_transposed ||
+                  !cugraph::is_candidate<vertex_t, edge_t, weight_t>::value) {
+      unsupported();
+    } else {
+      auto graph =
+        reinterpret_cast<host_graph_t<vertex_t, edge_t, weight_t> const*>(graph_->host_graph_);
+
+      std::optional<raft::host_span<weight_t const>> weights{std::nullopt};
+      if (graph->is_weighted_) {
+        weights = raft::host_span<weight_t const>(graph->weights_.data(), graph->weights_.size());
+      }
+      std::optional<raft::host_span<vertex_t const>> renumber_map{std::nullopt};
+      if (!graph->number_map_.empty()) {
+        renumber_map =
+          raft::host_span<vertex_t const>(graph->number_map_.data(), graph->number_map_.size());
+      }
+
+      // The writer sorts the out-edges again, the light/heavy order is rebuilt when loading
+      write_host_csr_file<vertex_t, edge_t, weight_t>(
+        path_,
+        raft::host_span<edge_t const>(graph->offsets_.data(), graph->offsets_.size()),
+        raft::host_span<vertex_t const>(graph->indices_.data(), graph->indices_.size()),
+        weights,
+        std::nullopt,
+        std::nullopt,
+        renumber_map,
+        graph->is_symmetric_,
+        host_num_threads());
+    }
+  }
+};
+
+}  // namespace
+
+}  // namespace c_api
+}  // namespace cugraph
+
+extern "C" cugraph_error_code_t cugraph_graph_create_sg_from_host_edgelist(
+  const cugraph_resource_handle_t* handle,
+  const cugraph_graph_properties_t* properties,
+  const cugraph_type_erased_host_array_view_t* src,
+  const cugraph_type_erased_host_array_view_t* dst,
+  const cugraph_type_erased_host_array_view_t* weights,
+  bool_t renumber,
+  bool_t drop_self_loops,
+  bool_t drop_multi_edges,
+  bool_t symmetrize,
+  cugraph_graph_t** graph,
+  cugraph_error_t** error)
+{
+  *graph = nullptr;
+  *error = nullptr;
+
+  auto p_src = reinterpret_cast<cugraph::c_api::cugraph_type_erased_host_array_view_t const*>(src);
+  auto p_dst = reinterpret_cast<cugraph::c_api::cugraph_type_erased_host_array_view_t const*>(dst);
+  auto p_weights =
+    reinterpret_cast<cugraph::c_api::cugraph_type_erased_host_array_view_t const*>(weights);
+
+  if (symmetrize == TRUE) {
+    CAPI_EXPECTS((properties->is_symmetric == TRUE),
+                 CUGRAPH_INVALID_INPUT,
+                 "Invalid input arguments: The graph property must be symmetric if 'symmetrize' is "
+                 "set to True.",
+                 *error);
+  }
+
+  CAPI_EXPECTS(p_src->size_ == p_dst->size_,
+               CUGRAPH_INVALID_INPUT,
+               "Invalid input arguments: src size != dst size.",
+               *error);
+
+  CAPI_EXPECTS(p_src->type_ == p_dst->type_,
+               CUGRAPH_INVALID_INPUT,
+               "Invalid input arguments: src type != dst type.",
+               *error);
+
+  CAPI_EXPECTS((weights == nullptr) || (p_weights->size_ == p_src->size_),
+               CUGRAPH_INVALID_INPUT,
+               "Invalid input arguments: src size != weights size.",
+               *error);
+
+  if (p_src->type_ == cugraph_data_type_id_t::INT32)
+    CAPI_EXPECTS(p_src->size_ < static_cast<size_t>(std::numeric_limits<int32_t>::max()) / 2,
+                 CUGRAPH_INVALID_INPUT,
+                 "Number of edges won't fit in 32-bit integer, using 32-bit type",
+                 *error);
+
+  cugraph::c_api::create_host_graph_functor functor(properties,
+                                                    p_src,
+                                                    p_dst,
+                                                    p_weights,
+                                                    renumber == TRUE,
+                                                    drop_self_loops == TRUE,
+                                                    drop_multi_edges == TRUE,
+                                                    symmetrize == TRUE);
+
+  try {
+    cugraph::c_api::vertex_dispatcher(p_src->type_,
+                                      p_src->type_,
+                                      weights != nullptr ? p_weights->type_
+                                                         : cugraph_data_type_id_t::FLOAT32,
+                                      cugraph_data_type_id_t::INT32,
+                                      false,
+                                      false,
+                                      functor);
+
+    if (functor.error_code_ != CUGRAPH_SUCCESS) {
+      *error = reinterpret_cast<cugraph_error_t*>(functor.error_.release());
+      return functor.error_code_;
+    }
+
+    *graph = reinterpret_cast<cugraph_graph_t*>(functor.result_);
+  } catch (std::exception const& ex) {
+    *error = reinterpret_cast<cugraph_error_t*>(new cugraph::c_api::cugraph_error_t{ex.what()});
+    return CUGRAPH_UNKNOWN_ERROR;
+  }
+
+  return CUGRAPH_SUCCESS;
+}
+
+extern "C" cugraph_error_code_t cugraph_graph_create_sg_from_host_csr_file(
+  const cugraph_resource_handle_t* handle,
+  const char* path,
+  cugraph_graph_t** graph,
+  cugraph_error_t** error)
+{
+  *graph = nullptr;
+  *error = nullptr;
+
+  CAPI_EXPECTS(path != nullptr,
+               CUGRAPH_INVALID_INPUT,
+               "Invalid input arguments: path must not be NULL.",
+               *error);
+
+  try {
+    auto header = cugraph::read_host_csr_file_header(path);
+
+    CAPI_EXPECTS(((header.vertex_size == sizeof(int32_t)) ||
+                  (header.vertex_size == sizeof(int64_t))) &&
+                   (header.edge_size == header.vertex_size),
+                 CUGRAPH_INVALID_INPUT,
+                 "Invalid input arguments: the CSR file must use 32-bit or 64-bit vertex ids, and "
+                 "edge ids of the same type.",
+                 *error);
+    CAPI_EXPECTS((header.weight_size == 0) || (header.weight_size == sizeof(float)) ||
+                   (header.weight_size == sizeof(double)),
+                 CUGRAPH_INVALID_INPUT,
+                 "Invalid input arguments: the CSR file must use float or double weights.",
+                 *error);
+
+    auto vertex_type = header.vertex_size == sizeof(int32_t) ? cugraph_data_type_id_t::INT32
+                                                             : cugraph_data_type_id_t::INT64;
+    auto weight_type = header.weight_size == sizeof(double) ? cugraph_data_type_id_t::FLOAT64
+                                                            : cugraph_data_type_id_t::FLOAT32;
+
+    cugraph::c_api::create_host_graph_from_csr_file_functor functor(path, vertex_type, weight_type);
+
+    cugraph::c_api::vertex_dispatcher(vertex_type,
+                                      vertex_type,
+                                      weight_type,
+                                      cugraph_data_type_id_t::INT32,
+                                      false,
+                                      false,
+                                      functor);
+
+    if (functor.error_code_ != CUGRAPH_SUCCESS) {
+      *error = reinterpret_cast<cugraph_error_t*>(functor.error_.release());
+      return functor.error_code_;
+    }
+
+    *graph = reinterpret_cast<cugraph_graph_t*>(functor.result_);
+  } catch (std::exception const& ex) {
+    *error = reinterpret_cast<cugraph_error_t*>(new cugraph::c_api::cugraph_error_t{ex.what()});
+    return CUGRAPH_UNKNOWN_ERROR;
+  }
+
+  return CUGRAPH_SUCCESS;
+}
+
+extern "C" cugraph_error_code_t cugraph_graph_write_host_csr_file(
+  const cugraph_resource_handle_t* handle,
+  const cugraph_graph_t* graph,
+  const char* path,
+  cugraph_error_t** error)
+{
+  *error = nullptr;
+
+  auto p_graph = reinterpret_cast<cugraph::c_api::cugraph_graph_t const*>(graph);
+
+  CAPI_EXPECTS(path != nullptr,
+               CUGRAPH_INVALID_INPUT,
+               "Invalid input arguments: path must not be NULL.",
+               *error);
+  CAPI_EXPECTS(p_graph->host_graph_ != nullptr,
+               CUGRAPH_INVALID_INPUT,
+               "Invalid input arguments: only host graphs can be written to a CSR file.",
+               *error);
+
+  cugraph::c_api::write_host_csr_file_functor functor(p_graph, path);
+
+  try {
+    cugraph::c_api::vertex_dispatcher(p_graph->vertex_type_,
+                                      p_graph->edge_type_,
+                                      p_graph->weight_type_,
+                                      p_graph->edge_type_id_type_,
+                                      p_graph->store_transposed_,
+                                      p_graph->multi_gpu_,
+                                      functor);
+
+    if (functor.error_code_ != CUGRAPH_SUCCESS) {
+      *error = reinterpret_cast<cugraph_error_t*>(functor.error_.release());
+      return functor.error_code_;
+    }
+  } catch (std::exception const& ex) {
+    *error = reinterpret_cast<cugraph_error_t*>(new cugraph::c_api::cugraph_error_t{ex.what()});
+    return CUGRAPH_UNKNOWN_ERROR;
+  }
+
+  return CUGRAPH_SUCCESS;
+}
@@ -0,0 +1,233 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cugraph/graph.hpp>
+
+#include <raft/random/rng_state.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <unordered_map>
+#include <vector>
+
+namespace cugraph {
+namespace c_api {
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+struct host_walk_tables_t;
+
+// Upper bound on the number of delta-stepping buckets spanned by the heaviest edge of a graph
+constexpr size_t host_sssp_max_buckets{1024};
+
+/**
+ * @brief Graph stored in host memory, for graphs small enough that running an algorithm on the
+ * host is faster than constructing the graph on the device and moving the data.
+ *
+ * Both the CSR (outgoing edges) and the CSC (incoming edges) are stored, so that push and pull
+ * based algorithms can run without transposing the graph.  Vertices are numbered from 0 to
+ * number_of_vertices_ - 1; if the graph was renumbered, number_map_ holds the external vertex id
+ * of each internal vertex.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+struct host_graph_t {
+  vertex_t number_of_vertices_{0};
+  bool is_symmetric_{false};
+  bool is_weighted_{false};
+
+  std::vector<edge_t> offsets_{};
+  std::vector<vertex_t> indices_{};
+  std::vector<weight_t> weights_{};  // empty if the graph is unweighted
+
+  std::vector<edge_t> transposed_offsets_{};
+  std::vector<vertex_t> transposed_indices_{};
+  std::vector<weight_t> transposed_weights_{};  // empty if the graph is unweighted
+
+  // The out-edges of each vertex of a weighted graph are ordered light (weight <= sssp_delta_)
+  // before heavy; heavy_offsets_ holds the first heavy out-edge of each vertex
+  weight_t sssp_delta_{1};
+  weight_t sssp_max_weight_{1};
+  std::vector<edge_t> heavy_offsets_{};
+
+  std::vector<vertex_t> number_map_{};                       // empty if not renumbered
+  std::unordered_map<vertex_t, vertex_t> renumber_lookup_{};  // external to internal vertex id
+
+  // Random walk transition tables, built by the first walk that needs them (host_random_walks.hpp)
+  mutable std::mutex walk_tables_mutex_{};
+  mutable std::shared_ptr<host_walk_tables_t<vertex_t, edge_t, weight_t> const> walk_tables_{};
+
+  edge_t number_of_edges() const { return static_cast<edge_t>(indices_.size()); }
+
+  /**
+   * @brief Returns the internal id of an external vertex id, or invalid_vertex_id if the vertex
+   * is not in the graph.
+   */
+  vertex_t internal_vertex(vertex_t v) const
+  {
+    if (number_map_.empty()) {
+      return ((v >= 0) && (v < number_of_vertices_)) ? v : invalid_vertex_id<vertex_t>::value;
+    }
+    auto it = renumber_lookup_.find(v);
+    return (it != renumber_lookup_.end()) ? it->second : invalid_vertex_id<vertex_t>::value;
+  }
+
+  /**
+   * @brief Returns the external id of every internal vertex.
+   */
+  std::vector<vertex_t> vertex_ids() const
+  {
+    if (!number_map_.empty()) { return number_map_; }
+    std::vector<vertex_t> ids(number_of_vertices_);
+    std::iota(ids.begin(), ids.end(), vertex_t{0});
+    return ids;
+  }
+
+  vertex_t external_vertex(vertex_t v) const
+  {
+    return (number_map_.empty() || (v == invalid_vertex_id<vertex_t>::value)) ? v
+                                                                               : number_map_[v];
+  }
+};
+
+/**
+ * @brief Returns the number of threads that run host parallel loops, including the caller.
+ */
+size_t host_num_threads();
+
+/**
+ * @brief Returns the number of chunks a host loop over @p n items should be split into.
+ *
+ * Loops with fewer than two chunks of @p min_chunk_size items run on the calling thread; the
+ * dispatch cost of the worker threads is larger than the work in small loops.
+ */
+size_t host_num_chunks(size_t n, size_t min_chunk_size);
+
+/**
+ * @brief Runs @p f on each chunk index in [0, @p num_chunks), using the host worker threads
+ * together with the calling thread.
+ *
+ * Only one parallel loop uses the worker threads at a time; loops started by other threads while
+ * the workers are busy run on their calling thread, so that concurrent queries do not wait on
+ * each other.
+ */
+void host_parallel_for_chunks(size_t num_chunks, std::function<void(size_t)> const& f);
+
+/**
+ * @brief Runs @p f(begin, end) over the chunks of [0, @p n) on the host worker threads.
+ */
+inline void host_parallel_for(size_t n,
+                              size_t min_chunk_size,
+                              std::function<void(size_t, size_t)> const& f)
+{
+  auto num_chunks = host_num_chunks(n, min_chunk_size);
+  if (num_chunks <= 1) {
+    if (n > 0) { f(0, n); }
+    return;
+  }
+  host_parallel_for_chunks(num_chunks, [&](size_t chunk) {
+    f((n * chunk) / num_chunks, (n * (chunk + 1)) / num_chunks);
+  });
+}
+
+/**
+ * @brief Stable counting sort of the items [0, @p n) by @p key(i), a value in [0, @p num_keys):
+ * calls @p scatter(i, position) with the sorted position of every item.
+ *
+ * Every chunk of items counts its keys separately and scatters its items after the items of the
+ * previous chunks with the same key, so the order does not depend on the number of threads.
+ *
+ * @return the position of the first item of every key, followed by @p n
+ */
+template <typename offset_t, typename key_op_t, typename scatter_op_t>
+std::vector<offset_t> host_counting_sort(size_t n,
+                                         size_t num_keys,
+                                         key_op_t key,
+                                         scatter_op_t scatter)
+{
+  std::vector<offset_t> offsets(num_keys + 1, offset_t{0});
+
+  // The per chunk counts are bounded by the number of items
+  auto num_chunks = std::min({host_num_chunks(n, size_t{1} << 14),
+                              host_num_threads(),
+                              std::max(n / std::max(num_keys, size_t{1}), size_t{1})});
+  if (num_chunks <= 1) {
+    for (size_t i = 0; i < n; ++i) {
+      ++offsets[key(i) + 1];
+    }
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+    std::vector<offset_t> positions(offsets.begin(), offsets.end() - 1);
+    for (size_t i = 0; i < n; ++i) {
+      scatter(i, positions[key(i)]++);
+    }
+    return offsets;
+  }
+
+  std::vector<offset_t> positions(num_chunks * num_keys, offset_t{0});
+  host_parallel_for_chunks(num_chunks, [&](size_t chunk) {
+    auto counts = positions.data() + chunk * num_keys;
+    for (size_t i = (n * chunk) / num_chunks; i < (n * (chunk + 1)) / num_chunks; ++i) {
+      ++counts[key(i)];
+    }
+  });
+  for (size_t k = 0; k < num_keys; ++k) {
+    auto position = offsets[k];
+    for (size_t chunk = 0; chunk < num_chunks; ++chunk) {
+      auto count                      = positions[chunk * num_keys + k];
+      positions[chunk * num_keys + k] = position;
+      position += count;
+    }
+    offsets[k + 1] = position;
+  }
+  host_parallel_for_chunks(num_chunks, [&](size_t chunk) {
+    auto chunk_positions = positions.data() + chunk * num_keys;
+    for (size_t i = (n * chunk) / num_chunks; i < (n * (chunk + 1)) / num_chunks; ++i) {
+      scatter(i, chunk_positions[key(i)]++);
+    }
+  });
+  return offsets;
+}
+
+namespace detail {
+
+constexpr uint64_t host_splitmix64(uint64_t x)
+{
+  x += uint64_t{0x9e3779b97f4a7c15};
+  x = (x ^ (x >> 30)) * uint64_t{0xbf58476d1ce4e5b9};
+  x = (x ^ (x >> 27)) * uint64_t{0x94d049bb133111eb};
+  return x ^ (x >> 31);
+}
+
+}  // namespace detail
+
+/**
+ * @brief Returns the seed of the host random streams of one algorithm call, and advances
+ * @p rng_state so that every call uses new streams.
+ */
+inline uint64_t host_rng_seed(raft::random::RngState& rng_state)
+{
+  auto seed = detail::host_splitmix64(rng_state.seed ^
+                                      detail::host_splitmix64(rng_state.base_subsequence));
+  rng_state.advance(1);
+  return seed;
+}
+
+}  // namespace c_api
+}  // namespace cugraph
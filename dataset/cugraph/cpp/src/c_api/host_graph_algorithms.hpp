@@ -0,0 +1,546 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "c_api/host_graph.hpp"
+
+#include <cugraph/utilities/error.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+namespace cugraph {
+namespace c_api {
+namespace detail {
+
+// Frontiers and vertex ranges smaller than this are processed on the calling thread
+constexpr size_t host_min_chunk_size{1024};
+
+template <typename T>
+void host_atomic_store_all(std::atomic<T>* values, size_t n, T value)
+{
+  host_parallel_for(n, host_min_chunk_size * 16, [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      values[i].store(value, std::memory_order_relaxed);
+    }
+  });
+}
+
+/**
+ * @brief Lowers @p target to @p value, returns true if @p value was smaller.
+ */
+template <typename T>
+bool host_atomic_min(std::atomic<T>& target, T value)
+{
+  auto current = target.load(std::memory_order_relaxed);
+  while (value < current) {
+    if (target.compare_exchange_weak(current, value, std::memory_order_relaxed)) { return true; }
+  }
+  return false;
+}
+
+/**
+ * @brief Expands a frontier by one level, top-down: @p edge_op is called on the out-edges in
+ * [first, last) = @p edge_range(u) of every frontier vertex u, and the neighbors for which it
+ * returns true form the next frontier.
+ */
+template <typename vertex_t,
+          typename edge_t,
+          typename weight_t,
+          typename edge_range_t,
+          typename edge_op_t>
+std::vector<vertex_t> host_expand_top_down(host_graph_t<vertex_t, edge_t, weight_t> const& graph,
+                                           std::vector<vertex_t> const& frontier,
+                                           edge_range_t edge_range,
+                                           edge_op_t edge_op)
+{
+  auto num_chunks = host_num_chunks(frontier.size(), host_min_chunk_size / 4);
+
+  auto expand = [&](size_t begin, size_t end, std::vector<vertex_t>& output) {
+    for (size_t i = begin; i < end; ++i) {
+      auto u              = frontier[i];
+      auto [first, last] = edge_range(u);
+      for (auto e = first; e < last; ++e) {
+        auto v = graph.indices_[e];
+        if (edge_op(u, v, e)) { output.push_back(v); }
+      }
+    }
+  };
+
+  std::vector<vertex_t> next_frontier{};
+  if (num_chunks <= 1) {
+    expand(0, frontier.size(), next_frontier);
+    return next_frontier;
+  }
+
+  std::vector<std::vector<vertex_t>> chunk_outputs(num_chunks);
+  host_parallel_for_chunks(num_chunks, [&](size_t chunk) {
+    expand((frontier.size() * chunk) / num_chunks,
+           (frontier.size() * (chunk + 1)) / num_chunks,
+           chunk_outputs[chunk]);
+  });
+
+  size_t total{0};
+  for (auto const& output : chunk_outputs) {
+    total += output.size();
+  }
+  next_frontier.reserve(total);
+  for (auto const& output : chunk_outputs) {
+    next_frontier.insert(next_frontier.end(), output.begin(), output.end());
+  }
+  return next_frontier;
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t, typename edge_op_t>
+std::vector<vertex_t> host_expand_top_down(host_graph_t<vertex_t, edge_t, weight_t> const& graph,
+                                           std::vector<vertex_t> const& frontier,
+                                           edge_op_t edge_op)
+{
+  return host_expand_top_down(
+    graph,
+    frontier,
+    [&](vertex_t u) { return std::make_tuple(graph.offsets_[u], graph.offsets_[u + 1]); },
+    edge_op);
+}
+
+}  // namespace detail
+
+/**
+ * @brief Breadth-first search on a host graph.
+ *
+ * Levels are expanded top-down from the frontier while the frontier is small.  When
+ * @p direction_optimizing is set and the edges out of the frontier outnumber a fraction of the
+ * edges of the unvisited vertices, levels are expanded bottom-up instead: every unvisited vertex
+ * looks for a parent among its in-neighbors and stops at the first one found.
+ *
+ * @param graph Host graph
+ * @param sources Internal ids of the source vertices
+ * @param direction_optimizing If true, switch between top-down and bottom-up expansion
+ * @param depth_limit Vertices farther than this from the sources are not visited
+ * @param distances Output, hop count from the nearest source, or the maximum vertex_t value if
+ * the vertex is not reached
+ * @param predecessors Output, if not nullptr: parent in the BFS tree or invalid_vertex_id
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+void host_bfs(host_graph_t<vertex_t, edge_t, weight_t> const& graph,
+              std::vector<vertex_t> const& sources,
+              bool direction_optimizing,
+              size_t depth_limit,
+              vertex_t* distances,
+              vertex_t* predecessors)
+{
+  constexpr auto unreached = std::numeric_limits<vertex_t>::max();
+  // Beamer et al.'s switching thresholds
+  constexpr edge_t top_down_to_bottom_up{14};
+  constexpr vertex_t bottom_up_to_top_down{24};
+
+  auto n = static_cast<size_t>(graph.number_of_vertices_);
+  auto levels = std::make_unique<std::atomic<vertex_t>[]>(n);
+  detail::host_atomic_store_all(levels.get(), n, unreached);
+  if (predecessors != nullptr) {
+    std::fill(predecessors, predecessors + n, invalid_vertex_id<vertex_t>::value);
+  }
+
+  std::vector<vertex_t> frontier;
+  frontier.reserve(sources.size());
+  for (auto s : sources) {
+    if (levels[s].exchange(0, std::memory_order_relaxed) == unreached) { frontier.push_back(s); }
+  }
+
+  auto out_degree = [&](vertex_t v) { return graph.offsets_[v + 1] - graph.offsets_[v]; };
+
+  edge_t unvisited_edges = graph.number_of_edges();
+  for (auto v : frontier) {
+    unvisited_edges -= out_degree(v);
+  }
+
+  std::vector<uint8_t> in_frontier{};
+  bool bottom_up{false};
+  for (size_t level = 0; !frontier.empty() && (level < depth_limit); ++level) {
+    auto next_level = static_cast<vertex_t>(level + 1);
+
+    if (direction_optimizing) {
+      edge_t frontier_edges{0};
+      for (auto v : frontier) {
+        frontier_edges += out_degree(v);
+      }
+      if (!bottom_up) {
+        bottom_up = frontier_edges > unvisited_edges / top_down_to_bottom_up;
+      } else {
+        bottom_up = static_cast<vertex_t>(frontier.size()) >=
+                    graph.number_of_vertices_ / bottom_up_to_top_down;
+      }
+    }
+
+    std::vector<vertex_t> next_frontier;
+    if (bottom_up) {
+      in_frontier.assign(n, uint8_t{0});
+      for (auto v : frontier) {
+        in_frontier[v] = 1;
+      }
+
+      // Each unvisited vertex only writes its own entries, so no atomic updates are needed
+      auto num_chunks = host_num_chunks(n, detail::host_min_chunk_size);
+      std::vector<std::vector<vertex_t>> chunk_outputs(std::max(num_chunks, size_t{1}));
+      auto search = [&](size_t chunk, size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+          auto v = static_cast<vertex_t>(i);
+          if (levels[v].load(std::memory_order_relaxed) != unreached) { continue; }
+          for (auto e = graph.transposed_offsets_[v]; e < graph.transposed_offsets_[v + 1]; ++e) {
+            auto u = graph.transposed_indices_[e];
+            if (in_frontier[u]) {
+              levels[v].store(next_level, std::memory_order_relaxed);
+              if (predecessors != nullptr) { predecessors[v] = u; }
+              chunk_outputs[chunk].push_back(v);
+              break;
+            }
+          }
+        }
+      };
+      if (num_chunks <= 1) {
+        search(0, 0, n);
+      } else {
+        host_parallel_for_chunks(num_chunks, [&](size_t chunk) {
+          search(chunk, (n * chunk) / num_chunks, (n * (chunk + 1)) / num_chunks);
+        });
+      }
+      for (auto const& output : chunk_outputs) {
+        next_frontier.insert(next_frontier.end(), output.begin(), output.end());
+      }
+    } else {
+      next_frontier =
+        detail::host_expand_top_down(graph, frontier, [&](vertex_t u, vertex_t v, edge_t) {
+          auto expected = unreached;
+          if ((levels[v].load(std::memory_order_relaxed) == unreached) &&
+              levels[v].compare_exchange_strong(expected, next_level, std::memory_order_relaxed)) {
+            if (predecessors != nullptr) { predecessors[v] = u; }
+            return true;
+          }
+          return false;
+        });
+    }
+
+    for (auto v : next_frontier) {
+      unvisited_edges -= out_degree(v);
+    }
+    frontier = std::move(next_frontier);
+  }
+
+  host_parallel_for(n, detail::host_min_chunk_size * 16, [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      distances[i] = levels[i].load(std::memory_order_relaxed);
+    }
+  });
+}
+
+/**
+ * @brief Single-source shortest paths on a host graph, by delta-stepping.
+ *
+ * Vertices are kept in buckets of width delta by tentative distance.  The lowest bucket is
+ * emptied by relaxing the light edges (weight <= delta) of its vertices until no vertex re-enters
+ * it, then the heavy edges of every vertex removed from the bucket are relaxed once.  Relaxations
+ * within a step run in parallel and lower the distances with atomic compare-and-swap.  Every
+ * tentative distance lies within the maximum edge weight of the lowest bucket, so the buckets are
+ * kept in a ring of about host_sssp_max_buckets entries at most.
+ *
+ * Predecessors are found after the distances have converged, by a breadth-first search from the
+ * source over the edges that lie on a shortest path, so that edges of weight zero cannot form
+ * predecessor cycles.
+ *
+ * @param graph Host graph, unweighted graphs use weight 1 for every edge
+ * @param source Internal id of the source vertex
+ * @param cutoff Vertices farther than this from the source are marked unreachable
+ * @param distances Output, distance from the source or the maximum weight_t value if the vertex
+ * is not reached
+ * @param predecessors Output, if not nullptr: predecessor on a shortest path or invalid_vertex_id
+ * @param do_expensive_check If true, check that the edge weights are not negative
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+void host_sssp(host_graph_t<vertex_t, edge_t, weight_t> const& graph,
+               vertex_t source,
+               weight_t cutoff,
+               weight_t* distances,
+               vertex_t* predecessors,
+               bool do_expensive_check)
+{
+  constexpr auto unreached = std::numeric_limits<weight_t>::max();
+
+  auto n      = static_cast<size_t>(graph.number_of_vertices_);
+  auto weight = [&](edge_t e) { return graph.is_weighted_ ? graph.weights_[e] : weight_t{1}; };
+
+  if (do_expensive_check && graph.is_weighted_) {
+    CUGRAPH_EXPECTS(std::none_of(graph.weights_.begin(),
+                                 graph.weights_.end(),
+                                 [](auto w) { return w < weight_t{0}; }),
+                    "Invalid input argument: input edge weights should have non-negative values.");
+  }
+
+  // Every edge of an unweighted graph is light
+  auto delta     = graph.sssp_delta_;
+  auto bucket_of = [delta](weight_t d) { return static_cast<size_t>(d / delta); };
+  auto light_edges = [&](vertex_t u) {
+    return std::make_tuple(graph.offsets_[u],
+                           graph.is_weighted_ ? graph.heavy_offsets_[u] : graph.offsets_[u + 1]);
+  };
+  auto heavy_edges = [&](vertex_t u) {
+    return std::make_tuple(graph.is_weighted_ ? graph.heavy_offsets_[u] : graph.offsets_[u + 1],
+                           graph.offsets_[u + 1]);
+  };
+
+  auto tentative = std::make_unique<std::atomic<weight_t>[]>(n);
+  detail::host_atomic_store_all(tentative.get(), n, unreached);
+  std::vector<weight_t> light_relaxed(n, unreached);  // distance at the last light relaxation
+
+  // Bucket b is buckets[b % buckets.size()], one extra bucket absorbs the rounding of bucket_of
+  std::vector<std::vector<vertex_t>> buckets(bucket_of(graph.sssp_max_weight_) + 3);
+  size_t num_queued{0};
+  auto add_to_bucket = [&](vertex_t v) {
+    auto b = bucket_of(tentative[v].load(std::memory_order_relaxed));
+    buckets[b % buckets.size()].push_back(v);
+    ++num_queued;
+  };
+  tentative[source].store(weight_t{0}, std::memory_order_relaxed);
+  add_to_bucket(source);
+
+  auto relax = [&](std::vector<vertex_t> const& vertices, auto edge_range) {
+    return detail::host_expand_top_down(
+      graph, vertices, edge_range, [&](vertex_t u, vertex_t v, edge_t e) {
+        weight_t d = tentative[u].load(std::memory_order_relaxed) + weight(e);
+        return (d <= cutoff) && detail::host_atomic_min(tentative[v], d);
+      });
+  };
+
+  std::vector<vertex_t> current{};
+  std::vector<vertex_t> removed{};
+  for (size_t index = 0; num_queued > 0; ++index) {
+    auto& bucket = buckets[index % buckets.size()];
+    removed.clear();
+    while (!bucket.empty()) {
+      // Skip vertices that moved to a lower distance, or were already relaxed at this one
+      current.clear();
+      for (auto v : bucket) {
+        auto d = tentative[v].load(std::memory_order_relaxed);
+        if ((bucket_of(d) == index) && (light_relaxed[v] != d)) {
+          light_relaxed[v] = d;
+          current.push_back(v);
+        }
+      }
+      num_queued -= bucket.size();
+      bucket.clear();
+      removed.insert(removed.end(), current.begin(), current.end());
+
+      for (auto v : relax(current, light_edges)) {
+        add_to_bucket(v);
+      }
+    }
+
+    if (graph.is_weighted_) {
+      std::sort(removed.begin(), removed.end());
+      removed.erase(std::unique(removed.begin(), removed.end()), removed.end());
+      for (auto v : relax(removed, heavy_edges)) {
+        add_to_bucket(v);
+      }
+    }
+  }
+
+  host_parallel_for(n, detail::host_min_chunk_size * 16, [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      distances[i] = tentative[i].load(std::memory_order_relaxed);
+    }
+  });
+
+  if (predecessors != nullptr) {
+    std::fill(predecessors, predecessors + n, invalid_vertex_id<vertex_t>::value);
+    auto claimed = std::make_unique<std::atomic<uint8_t>[]>(n);
+    detail::host_atomic_store_all(claimed.get(), n, uint8_t{0});
+    claimed[source].store(1, std::memory_order_relaxed);
+
+    std::vector<vertex_t> frontier{source};
+    while (!frontier.empty()) {
+      frontier =
+        detail::host_expand_top_down(graph, frontier, [&](vertex_t u, vertex_t v, edge_t e) {
+          if ((distances[v] == unreached) || (distances[u] + weight(e) != distances[v]) ||
+              (claimed[v].load(std::memory_order_relaxed) != 0) ||
+              (claimed[v].exchange(1, std::memory_order_relaxed) != 0)) {
+            return false;
+          }
+          predecessors[v] = u;
+          return true;
+        });
+    }
+  }
+}
+
+/**
+ * @brief Pull-based PageRank on a host graph.
+ *
+ * Every iteration scales the PageRank of each vertex by its out-weight sum, then each vertex sums
+ * the scaled values of its in-neighbors over the CSC.  The loops read and write contiguous arrays
+ * without dependencies between iterations, so that the compiler can vectorize them.  The
+ * semantics match cugraph::pagerank: the PageRank of vertices without out-edges is spread over
+ * all vertices (or over the personalization vertices), and the iteration converges when the sum
+ * of the absolute changes is below @p epsilon times the number of vertices.
+ *
+ * @param graph Host graph
+ * @param precomputed_vertex_out_weight_sums Optional out-weight sum of each internal vertex
+ * @param personalization Optional internal vertex ids and values of the personalization vector
+ * @param initial_guess Optional initial PageRank of each internal vertex
+ * @param alpha PageRank damping factor
+ * @param epsilon Error tolerance to check convergence
+ * @param max_iterations Maximum number of iterations
+ * @return Tuple of the PageRank of each internal vertex, the number of iterations and whether the
+ * iteration converged
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+std::tuple<std::vector<weight_t>, size_t, bool> host_pagerank(
+  host_graph_t<vertex_t, edge_t, weight_t> const& graph,
+  std::optional<std::vector<weight_t>> const& precomputed_vertex_out_weight_sums,
+  std::optional<std::tuple<std::vector<vertex_t>, std::vector<weight_t>>> const& personalization,
+  std::optional<std::vector<weight_t>> const& initial_guess,
+  weight_t alpha,
+  weight_t epsilon,
+  size_t max_iterations)
+{
+  auto n = static_cast<size_t>(graph.number_of_vertices_);
+  if (n == 0) { return {std::vector<weight_t>{}, size_t{0}, true}; }
+
+  std::vector<weight_t> out_weight_sums(n);
+  if (precomputed_vertex_out_weight_sums) {
+    out_weight_sums = *precomputed_vertex_out_weight_sums;
+  } else {
+    host_parallel_for(n, detail::host_min_chunk_size, [&](size_t begin, size_t end) {
+      for (size_t v = begin; v < end; ++v) {
+        if (graph.is_weighted_) {
+          out_weight_sums[v] = std::accumulate(graph.weights_.begin() + graph.offsets_[v],
+                                               graph.weights_.begin() + graph.offsets_[v + 1],
+                                               weight_t{0});
+        } else {
+          out_weight_sums[v] = static_cast<weight_t>(graph.offsets_[v + 1] - graph.offsets_[v]);
+        }
+      }
+    });
+  }
+
+  std::vector<weight_t> pageranks{};
+  if (initial_guess) {
+    pageranks = *initial_guess;
+    auto sum  = std::accumulate(pageranks.begin(), pageranks.end(), weight_t{0});
+    CUGRAPH_EXPECTS(sum > weight_t{0},
+                    "Invalid input argument: sum of the PageRank initial guess values should be "
+                    "positive.");
+    for (auto& pagerank : pageranks) {
+      pagerank /= sum;
+    }
+  } else {
+    pageranks.assign(n, weight_t{1} / static_cast<weight_t>(n));
+  }
+
+  weight_t personalization_sum{0};
+  if (personalization) {
+    auto const& values  = std::get<1>(*personalization);
+    personalization_sum = std::accumulate(values.begin(), values.end(), weight_t{0});
+    CUGRAPH_EXPECTS(personalization_sum > weight_t{0},
+                    "Invalid input argument: sum of the personalization values should be "
+                    "positive.");
+  }
+
+  std::vector<weight_t> scaled(n);
+  std::vector<weight_t> old_pageranks(n);
+  auto num_chunks = std::max(host_num_chunks(n, detail::host_min_chunk_size), size_t{1});
+  std::vector<weight_t> chunk_sums(num_chunks);
+
+  // Runs f(begin, end) on every chunk of the vertices and returns the sum of its results
+  auto chunked_sum = [&](auto f) {
+    if (num_chunks == 1) { return f(size_t{0}, n); }
+    host_parallel_for_chunks(num_chunks, [&](size_t chunk) {
+      chunk_sums[chunk] = f((n * chunk) / num_chunks, (n * (chunk + 1)) / num_chunks);
+    });
+    return std::accumulate(chunk_sums.begin(), chunk_sums.end(), weight_t{0});
+  };
+
+  size_t iterations{0};
+  bool converged{false};
+  while (iterations < max_iterations) {
+    std::swap(pageranks, old_pageranks);
+
+    auto dangling_sum = chunked_sum([&](size_t begin, size_t end) {
+      weight_t sum{0};
+      for (size_t v = begin; v < end; ++v) {
+        auto has_out_weight = out_weight_sums[v] > weight_t{0};
+        scaled[v] = has_out_weight ? old_pageranks[v] / out_weight_sums[v] : weight_t{0};
+        sum += has_out_weight ? weight_t{0} : old_pageranks[v];
+      }
+      return sum;
+    });
+
+    auto base = personalization ? weight_t{0}
+                                : (alpha * dangling_sum + (weight_t{1} - alpha)) /
+                                    static_cast<weight_t>(n);
+
+    chunked_sum([&](size_t begin, size_t end) {
+      for (size_t v = begin; v < end; ++v) {
+        auto first = graph.transposed_offsets_[v];
+        auto last  = graph.transposed_offsets_[v + 1];
+        weight_t sum{0};
+        if (graph.is_weighted_) {
+          for (auto e = first; e < last; ++e) {
+            sum += scaled[graph.transposed_indices_[e]] * graph.transposed_weights_[e];
+          }
+        } else {
+          for (auto e = first; e < last; ++e) {
+            sum += scaled[graph.transposed_indices_[e]];
+          }
+        }
+        pageranks[v] = alpha * sum + base;
+      }
+      return weight_t{0};
+    });
+
+    if (personalization) {
+      auto const& [vertices, values] = *personalization;
+      auto scale = (alpha * dangling_sum + (weight_t{1} - alpha)) / personalization_sum;
+      for (size_t i = 0; i < vertices.size(); ++i) {
+        pageranks[vertices[i]] += values[i] * scale;
+      }
+    }
+
+    auto diff_sum = chunked_sum([&](size_t begin, size_t end) {
+      weight_t sum{0};
+      for (size_t v = begin; v < end; ++v) {
+        sum += std::abs(pageranks[v] - old_pageranks[v]);
+      }
+      return sum;
+    });
+
+    ++iterations;
+    if (diff_sum < epsilon * static_cast<weight_t>(n)) {
+      converged = true;
+      break;
+    }
+  }
+
+  return {std::move(pageranks), iterations, converged};
+}
+
+}  // namespace c_api
+}  // namespace cugraph
@@ -0,0 +1,796 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "c_api/host_graph.hpp"
+#include "c_api/host_graph_algorithms.hpp"
+#include "c_api/host_sampling.hpp"
+
+#include <cugraph/utilities/error.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+namespace cugraph {
+namespace c_api {
+namespace detail {
+
+// Leiden stops moving vertices of a level once a sweep improves the modularity by less than this
+constexpr double host_leiden_threshold{1e-4};
+
+/**
+ * @brief Open addressing map from community id to the total weight of the edges into the
+ * community, reused for every vertex a thread visits.
+ */
+template <typename vertex_t>
+class host_community_weights_t {
+ public:
+  /**
+   * @brief Empties the map, sizing it for up to @p max_size communities.
+   */
+  void reset(size_t max_size)
+  {
+    for (auto slot : used_) {
+      keys_[slot] = empty_key;
+    }
+    used_.clear();
+
+    size_t capacity{16};
+    int bits{4};
+    while (capacity < 2 * max_size) {
+      capacity <<= 1;
+      ++bits;
+    }
+    if (capacity > keys_.size()) {
+      keys_.assign(capacity, empty_key);
+      weights_.resize(capacity);
+    }
+    mask_  = capacity - 1;
+    shift_ = 64 - bits;
+  }
+
+  void add(vertex_t key, double weight)
+  {
+    for (auto slot = slot_of(key);; slot = (slot + 1) & mask_) {
+      if (keys_[slot] == key) {
+        weights_[slot] += weight;
+        return;
+      }
+      if (keys_[slot] == empty_key) {
+        keys_[slot]    = key;
+        weights_[slot] = weight;
+        used_.push_back(slot);
+        return;
+      }
+    }
+  }
+
+  double weight(vertex_t key) const
+  {
+    for (auto slot = slot_of(key);; slot = (slot + 1) & mask_) {
+      if (keys_[slot] == key) { return weights_[slot]; }
+      if (keys_[slot] == empty_key) { return 0; }
+    }
+  }
+
+  size_t size() const { return used_.size(); }
+  vertex_t key(size_t i) const { return keys_[used_[i]]; }
+  double weight_at(size_t i) const { return weights_[used_[i]]; }
+
+ private:
+  static constexpr vertex_t empty_key{invalid_vertex_id<vertex_t>::value};
+
+  size_t slot_of(vertex_t key) const
+  {
+    return static_cast<size_t>((static_cast<uint64_t>(key) * uint64_t{0x9e3779b97f4a7c15}) >>
+                               shift_);
+  }
+
+  std::vector<vertex_t> keys_{};
+  std::vector<double> weights_{};
+  std::vector<size_t> used_{};
+  size_t mask_{0};
+  int shift_{60};
+};
+
+/**
+ * @brief Weighted CSR of one level of the hierarchy; every undirected edge is stored in both
+ * directions and a self loop once.
+ */
+template <typename vertex_t, typename edge_t, typename w_t>
+struct host_level_graph_t {
+  vertex_t number_of_vertices_{0};
+  edge_t const* offsets_{nullptr};
+  vertex_t const* indices_{nullptr};
+  w_t const* weights_{nullptr};  // nullptr if every edge has weight 1
+
+  double weight(edge_t e) const
+  {
+    return (weights_ != nullptr) ? static_cast<double>(weights_[e]) : double{1};
+  }
+};
+
+/**
+ * @brief Graph of the communities of a level: the weight of the edge between two communities is
+ * the total weight of the edges between their vertices.
+ */
+template <typename vertex_t, typename edge_t>
+struct host_coarse_graph_t {
+  std::vector<edge_t> offsets_{};
+  std::vector<vertex_t> indices_{};
+  std::vector<double> weights_{};
+
+  host_level_graph_t<vertex_t, edge_t, double> view() const
+  {
+    return {static_cast<vertex_t>(offsets_.size() - 1),
+            offsets_.data(),
+            indices_.data(),
+            weights_.data()};
+  }
+};
+
+template <typename sum_op_t>
+double host_parallel_sum(size_t n, size_t min_chunk_size, sum_op_t sum_op)
+{
+  auto num_chunks = std::max(host_num_chunks(n, min_chunk_size), size_t{1});
+  std::vector<double> sums(num_chunks, double{0});
+  host_parallel_for_chunks(num_chunks, [&](size_t chunk) {
+    double sum{0};
+    for (size_t i = (n * chunk) / num_chunks; i < (n * (chunk + 1)) / num_chunks; ++i) {
+      sum += sum_op(i);
+    }
+    sums[chunk] = sum;
+  });
+  return std::accumulate(sums.begin(), sums.end(), double{0});
+}
+
+inline void host_atomic_add(std::atomic<double>& target, double value)
+{
+  auto current = target.load(std::memory_order_relaxed);
+  while (!target.compare_exchange_weak(current, current + value, std::memory_order_relaxed)) {}
+}
+
+/**
+ * @brief Returns the total weight of the edges of every vertex, self loops included.
+ */
+template <typename vertex_t, typename edge_t, typename w_t>
+std::vector<double> host_vertex_strengths(host_level_graph_t<vertex_t, edge_t, w_t> const& graph)
+{
+  std::vector<double> strengths(graph.number_of_vertices_);
+  host_parallel_for(strengths.size(), host_min_chunk_size, [&](size_t begin, size_t end) {
+    for (size_t v = begin; v < end; ++v) {
+      double strength{0};
+      for (auto e = graph.offsets_[v]; e < graph.offsets_[v + 1]; ++e) {
+        strength += graph.weight(e);
+      }
+      strengths[v] = strength;
+    }
+  });
+  return strengths;
+}
+
+/**
+ * @brief Modularity of the partition given by @p community(v), from the total strength of every
+ * community.
+ */
+template <typename vertex_t, typename edge_t, typename w_t, typename community_op_t>
+double host_modularity(host_level_graph_t<vertex_t, edge_t, w_t> const& graph,
+                       community_op_t community,
+                       std::vector<double> const& community_strengths,
+                       double total_weight,
+                       double resolution)
+{
+  auto internal = host_parallel_sum(
+    static_cast<size_t>(graph.number_of_vertices_), host_min_chunk_size, [&](size_t v) {
+      auto c = community(static_cast<vertex_t>(v));
+      double sum{0};
+      for (auto e = graph.offsets_[v]; e < graph.offsets_[v + 1]; ++e) {
+        if (community(graph.indices_[e]) == c) { sum += graph.weight(e); }
+      }
+      return sum;
+    });
+  auto squares = host_parallel_sum(
+    community_strengths.size(), host_min_chunk_size * 16, [&](size_t c) {
+      return community_strengths[c] * community_strengths[c];
+    });
+  return internal / total_weight - resolution * squares / (total_weight * total_weight);
+}
+
+/**
+ * @brief Renumbers the community ids in [0, @p n) of @p communities to [0, number of
+ * communities), in ascending order; returns the number of communities.
+ */
+template <typename vertex_t>
+vertex_t host_compact_communities(std::vector<vertex_t>& communities, vertex_t n)
+{
+  std::vector<vertex_t> new_ids(n, vertex_t{0});
+  for (auto c : communities) {
+    new_ids[c] = 1;
+  }
+  vertex_t num_communities{0};
+  for (auto& id : new_ids) {
+    auto used = id;
+    id        = num_communities;
+    num_communities += used;
+  }
+  host_parallel_for(communities.size(), host_min_chunk_size * 16, [&](size_t begin, size_t end) {
+    for (size_t v = begin; v < end; ++v) {
+      communities[v] = new_ids[communities[v]];
+    }
+  });
+  return num_communities;
+}
+
+/**
+ * @brief Local moving phase of a level: sweeps over the vertices, moving each to the neighboring
+ * community with the largest modularity gain, until a sweep gains less than @p threshold.
+ *
+ * The vertices are swept in parallel; every thread collects the edge weights from a vertex to its
+ * neighboring communities in its own host_community_weights_t, and the community strengths and
+ * sizes are updated with atomics.  Only the vertices with a neighbor that moved in the previous
+ * sweep are visited again.  Two singleton communities could swap their vertices forever, so a
+ * singleton only moves to another singleton with a smaller id.  A sweep that lowers the
+ * modularity, which concurrent moves can do, is undone.
+ *
+ * @param communities initial community (in [0, number of vertices)) of every vertex, replaced by
+ * the result
+ * @param order order of the sweeps, or empty to sweep in vertex order
+ * @return the modularity of the resulting partition
+ */
+template <typename vertex_t, typename edge_t, typename w_t>
+double host_local_moving(host_level_graph_t<vertex_t, edge_t, w_t> const& graph,
+                         std::vector<double> const& strengths,
+                         double total_weight,
+                         double threshold,
+                         double resolution,
+                         std::vector<vertex_t>& communities,
+                         std::vector<vertex_t> const& order)
+{
+  auto n = static_cast<size_t>(graph.number_of_vertices_);
+
+  std::vector<double> community_strengths(n, double{0});
+  std::vector<vertex_t> community_sizes(n, vertex_t{0});
+  for (size_t v = 0; v < n; ++v) {
+    community_strengths[communities[v]] += strengths[v];
+    ++community_sizes[communities[v]];
+  }
+
+  auto community   = std::make_unique<std::atomic<vertex_t>[]>(n);
+  auto c_strengths = std::make_unique<std::atomic<double>[]>(n);
+  auto c_sizes     = std::make_unique<std::atomic<vertex_t>[]>(n);
+  auto active      = std::make_unique<std::atomic<uint8_t>[]>(n);
+  host_parallel_for(n, host_min_chunk_size * 16, [&](size_t begin, size_t end) {
+    for (size_t v = begin; v < end; ++v) {
+      community[v].store(communities[v], std::memory_order_relaxed);
+      c_strengths[v].store(community_strengths[v], std::memory_order_relaxed);
+      c_sizes[v].store(community_sizes[v], std::memory_order_relaxed);
+      active[v].store(1, std::memory_order_relaxed);
+    }
+  });
+
+  auto community_of = [&](vertex_t v) { return community[v].load(std::memory_order_relaxed); };
+  auto modularity   = [&]() {
+    host_parallel_for(n, host_min_chunk_size * 16, [&](size_t begin, size_t end) {
+      for (size_t c = begin; c < end; ++c) {
+        community_strengths[c] = c_strengths[c].load(std::memory_order_relaxed);
+      }
+    });
+    return host_modularity(graph, community_of, community_strengths, total_weight, resolution);
+  };
+
+  auto sweep = [&](size_t begin, size_t end) {
+    host_community_weights_t<vertex_t> neighbor_weights{};
+    for (size_t i = begin; i < end; ++i) {
+      auto u = order.empty() ? static_cast<vertex_t>(i) : order[i];
+      if (active[u].load(std::memory_order_relaxed) == 0) { continue; }
+      active[u].store(0, std::memory_order_relaxed);
+
+      auto first = graph.offsets_[u];
+      auto last  = graph.offsets_[u + 1];
+      neighbor_weights.reset(static_cast<size_t>(last - first));
+      for (auto e = first; e < last; ++e) {
+        auto v = graph.indices_[e];
+        if (v != u) { neighbor_weights.add(community_of(v), graph.weight(e)); }
+      }
+
+      // Modularity gain of joining a community, up to a factor 2 / total_weight
+      auto current_community = community_of(u);
+      auto scale             = resolution * strengths[u] / total_weight;
+      auto is_singleton      = c_sizes[current_community].load(std::memory_order_relaxed) == 1;
+      auto best_community    = current_community;
+      auto best_gain =
+        neighbor_weights.weight(current_community) -
+        scale *
+          (c_strengths[current_community].load(std::memory_order_relaxed) - strengths[u]);
+      for (size_t j = 0; j < neighbor_weights.size(); ++j) {
+        auto c = neighbor_weights.key(j);
+        if (c == current_community) { continue; }
+        if (is_singleton && (c > current_community) &&
+            (c_sizes[c].load(std::memory_order_relaxed) == 1)) {
+          continue;
+        }
+        auto gain = neighbor_weights.weight_at(j) -
+                    scale * c_strengths[c].load(std::memory_order_relaxed);
+        if (gain > best_gain) {
+          best_gain      = gain;
+          best_community = c;
+        }
+      }
+
+      if (best_community != current_community) {
+        host_atomic_add(c_strengths[current_community], -strengths[u]);
+        host_atomic_add(c_strengths[best_community], strengths[u]);
+        c_sizes[current_community].fetch_sub(1, std::memory_order_relaxed);
+        c_sizes[best_community].fetch_add(1, std::memory_order_relaxed);
+        community[u].store(best_community, std::memory_order_relaxed);
+        for (auto e = first; e < last; ++e) {
+          active[graph.indices_[e]].store(1, std::memory_order_relaxed);
+        }
+      }
+    }
+  };
+
+  auto new_modularity = modularity();
+  auto modularity_now = new_modularity - 1;
+  while (new_modularity > modularity_now + threshold) {
+    modularity_now = new_modularity;
+    host_parallel_for(n, host_min_chunk_size, sweep);
+    new_modularity = modularity();
+    if (new_modularity > modularity_now) {
+      host_parallel_for(n, host_min_chunk_size * 16, [&](size_t begin, size_t end) {
+        for (size_t v = begin; v < end; ++v) {
+          communities[v] = community_of(static_cast<vertex_t>(v));
+        }
+      });
+    }
+  }
+  return std::max(new_modularity, modularity_now);
+}
+
+/**
+ * @brief Leiden refinement: splits every community of @p communities into well connected
+ * sub-communities.
+ *
+ * Every community starts from singletons and is refined independently, in parallel.  Its
+ * vertices are visited in random order; a vertex that is still a singleton and is well connected
+ * to the rest of its community joins the well connected sub-community of its community with the
+ * largest modularity gain, if the gain is not negative.
+ *
+ * @return the sub-community of every vertex, numbered from 0, and the number of sub-communities
+ */
+template <typename vertex_t, typename edge_t, typename w_t>
+std::tuple<std::vector<vertex_t>, vertex_t> host_refine_communities(
+  host_level_graph_t<vertex_t, edge_t, w_t> const& graph,
+  std::vector<double> const& strengths,
+  double total_weight,
+  double resolution,
+  std::vector<vertex_t> const& communities,
+  vertex_t num_communities,
+  uint64_t rng_seed,
+  size_t level)
+{
+  auto n = static_cast<size_t>(graph.number_of_vertices_);
+
+  std::vector<vertex_t> members(n);
+  auto member_offsets = host_counting_sort<vertex_t>(
+    n,
+    static_cast<size_t>(num_communities),
+    [&](size_t v) { return static_cast<size_t>(communities[v]); },
+    [&](size_t v, vertex_t position) { members[position] = static_cast<vertex_t>(v); });
+
+  // A sub-community is identified by one of its vertices
+  std::vector<vertex_t> refined(n);
+  std::vector<double> refined_strengths(strengths);
+  std::vector<vertex_t> refined_sizes(n, vertex_t{1});
+  std::vector<double> external_weights(n);  // from the sub-community to the rest of its community
+
+  host_parallel_for(
+    static_cast<size_t>(num_communities), host_min_chunk_size / 16, [&](size_t begin, size_t end) {
+      host_community_weights_t<vertex_t> neighbor_weights{};
+      std::vector<vertex_t> visit_order{};
+      for (size_t c = begin; c < end; ++c) {
+        auto first = members.begin() + member_offsets[c];
+        auto last  = members.begin() + member_offsets[c + 1];
+
+        double community_strength{0};
+        for (auto it = first; it != last; ++it) {
+          auto v     = *it;
+          refined[v] = v;
+          community_strength += strengths[v];
+          double external{0};
+          for (auto e = graph.offsets_[v]; e < graph.offsets_[v + 1]; ++e) {
+            auto u = graph.indices_[e];
+            if ((u != v) && (communities[u] == static_cast<vertex_t>(c))) {
+              external += graph.weight(e);
+            }
+          }
+          external_weights[v] = external;
+        }
+
+        auto is_well_connected = [&](vertex_t r) {
+          return external_weights[r] >= resolution * refined_strengths[r] *
+                                          (community_strength - refined_strengths[r]) /
+                                          total_weight;
+        };
+
+        visit_order.assign(first, last);
+        host_rng_t rng(rng_seed, level, c, 0);
+        for (size_t i = visit_order.size(); i > 1; --i) {
+          std::swap(visit_order[i - 1], visit_order[rng.uniform_index(i)]);
+        }
+
+        for (auto v : visit_order) {
+          if ((refined[v] != v) || (refined_sizes[v] != 1) || !is_well_connected(v)) {
+            continue;
+          }
+
+          neighbor_weights.reset(static_cast<size_t>(graph.offsets_[v + 1] - graph.offsets_[v]));
+          for (auto e = graph.offsets_[v]; e < graph.offsets_[v + 1]; ++e) {
+            auto u = graph.indices_[e];
+            if ((u != v) && (communities[u] == static_cast<vertex_t>(c))) {
+              neighbor_weights.add(refined[u], graph.weight(e));
+            }
+          }
+
+          auto scale = resolution * strengths[v] / total_weight;
+          std::optional<size_t> best{};
+          double best_gain{0};
+          for (size_t j = 0; j < neighbor_weights.size(); ++j) {
+            auto r = neighbor_weights.key(j);
+            if (!is_well_connected(r)) { continue; }
+            auto gain = neighbor_weights.weight_at(j) - scale * refined_strengths[r];
+            if ((gain >= 0) && (!best || (gain > best_gain))) {
+              best      = j;
+              best_gain = gain;
+            }
+          }
+
+          if (best) {
+            auto r = neighbor_weights.key(*best);
+            external_weights[r] += external_weights[v] - 2 * neighbor_weights.weight_at(*best);
+            refined_strengths[r] += strengths[v];
+            ++refined_sizes[r];
+            refined_sizes[v] = 0;
+            refined[v]       = r;
+          }
+        }
+      }
+    });
+
+  auto num_refined = host_compact_communities(refined, static_cast<vertex_t>(n));
+  return std::make_tuple(std::move(refined), num_refined);
+}
+
+/**
+ * @brief Contracts every community of @p communities (numbered from 0) into a vertex.
+ *
+ * The vertices are grouped by community with host_counting_sort; each thread then merges the
+ * edges of the communities in its chunk by neighboring community in its own
+ * host_community_weights_t, and the rows of all chunks are concatenated into the CSR.
+ */
+template <typename vertex_t, typename edge_t, typename w_t>
+host_coarse_graph_t<vertex_t, edge_t> host_coarsen(
+  host_level_graph_t<vertex_t, edge_t, w_t> const& graph,
+  std::vector<vertex_t> const& communities,
+  vertex_t num_communities)
+{
+  auto n = static_cast<size_t>(graph.number_of_vertices_);
+  auto k = static_cast<size_t>(num_communities);
+
+  std::vector<vertex_t> members(n);
+  auto member_offsets = host_counting_sort<vertex_t>(
+    n,
+    k,
+    [&](size_t v) { return static_cast<size_t>(communities[v]); },
+    [&](size_t v, vertex_t position) { members[position] = static_cast<vertex_t>(v); });
+
+  host_coarse_graph_t<vertex_t, edge_t> coarse{};
+  coarse.offsets_.assign(k + 1, edge_t{0});
+
+  auto num_chunks = std::max(host_num_chunks(k, host_min_chunk_size / 4), size_t{1});
+  std::vector<std::vector<vertex_t>> chunk_indices(num_chunks);
+  std::vector<std::vector<double>> chunk_weights(num_chunks);
+  host_parallel_for_chunks(num_chunks, [&](size_t chunk) {
+    host_community_weights_t<vertex_t> neighbor_weights{};
+    for (size_t c = (k * chunk) / num_chunks; c < (k * (chunk + 1)) / num_chunks; ++c) {
+      size_t num_edges{0};
+      for (auto i = member_offsets[c]; i < member_offsets[c + 1]; ++i) {
+        num_edges += static_cast<size_t>(graph.offsets_[members[i] + 1] -
+                                         graph.offsets_[members[i]]);
+      }
+      neighbor_weights.reset(std::min(num_edges, k));
+      for (auto i = member_offsets[c]; i < member_offsets[c + 1]; ++i) {
+        auto v = members[i];
+        for (auto e = graph.offsets_[v]; e < graph.offsets_[v + 1]; ++e) {
+          neighbor_weights.add(communities[graph.indices_[e]], graph.weight(e));
+        }
+      }
+      coarse.offsets_[c + 1] = static_cast<edge_t>(neighbor_weights.size());
+      for (size_t j = 0; j < neighbor_weights.size(); ++j) {
+        chunk_indices[chunk].push_back(neighbor_weights.key(j));
+        chunk_weights[chunk].push_back(neighbor_weights.weight_at(j));
+      }
+    }
+  });
+  std::partial_sum(coarse.offsets_.begin(), coarse.offsets_.end(), coarse.offsets_.begin());
+
+  coarse.indices_.resize(coarse.offsets_.back());
+  coarse.weights_.resize(coarse.offsets_.back());
+  host_parallel_for_chunks(num_chunks, [&](size_t chunk) {
+    auto first = coarse.offsets_[(k * chunk) / num_chunks];
+    std::copy(
+      chunk_indices[chunk].begin(), chunk_indices[chunk].end(), coarse.indices_.begin() + first);
+    std::copy(
+      chunk_weights[chunk].begin(), chunk_weights[chunk].end(), coarse.weights_.begin() + first);
+  });
+  return coarse;
+}
+
+/**
+ * @brief Louvain (or, with @p refine, Leiden) on the level 0 graph @p graph.
+ *
+ * Every level moves the vertices between communities (host_local_moving), starting from
+ * singletons for Louvain and from the communities of the previous level for Leiden, and then
+ * contracts every community (every refined community for Leiden) into a vertex of the next level.
+ * The levels stop when @p max_level levels ran, when a level does not improve the modularity or
+ * when no two vertices can be contracted.
+ *
+ * @param rng_seed seeds the refinement order of Leiden and, for Louvain, randomizes the order in
+ * which the vertices are swept
+ * @return the community of every vertex and the modularity of the partition
+ */
+template <typename vertex_t, typename edge_t, typename w_t>
+std::tuple<std::vector<vertex_t>, double> host_hierarchical_clustering(
+  host_level_graph_t<vertex_t, edge_t, w_t> const& graph,
+  size_t max_level,
+  double threshold,
+  double resolution,
+  bool refine,
+  std::optional<uint64_t> rng_seed)
+{
+  auto n = static_cast<size_t>(graph.number_of_vertices_);
+
+  std::vector<vertex_t> clusters(n);
+  std::iota(clusters.begin(), clusters.end(), vertex_t{0});
+  std::vector<vertex_t> coarse_vertices(clusters);  // level vertex of every vertex
+  double best_modularity{-1};
+
+  host_coarse_graph_t<vertex_t, edge_t> coarse{};
+  std::vector<vertex_t> initial_communities{};
+
+  // Returns false when the hierarchy is complete
+  auto run_level = [&](auto const& level_graph, size_t level) {
+    auto level_n      = static_cast<size_t>(level_graph.number_of_vertices_);
+    auto strengths    = host_vertex_strengths(level_graph);
+    auto total_weight = std::accumulate(strengths.begin(), strengths.end(), double{0});
+    if (total_weight <= 0) { return false; }
+
+    std::vector<vertex_t> communities(level_n);
+    if (initial_communities.empty()) {
+      std::iota(communities.begin(), communities.end(), vertex_t{0});
+    } else {
+      communities = std::move(initial_communities);
+    }
+    std::vector<vertex_t> order{};
+    if (rng_seed && !refine) {
+      order.resize(level_n);
+      std::iota(order.begin(), order.end(), vertex_t{0});
+      host_rng_t rng(*rng_seed, level, 0, 0);
+      for (size_t i = level_n; i > 1; --i) {
+        std::swap(order[i - 1], order[rng.uniform_index(i)]);
+      }
+    }
+
+    auto modularity = host_local_moving(
+      level_graph, strengths, total_weight, threshold, resolution, communities, order);
+    auto num_communities =
+      host_compact_communities(communities, static_cast<vertex_t>(level_n));
+    if (modularity <= best_modularity) { return false; }
+
+    best_modularity = modularity;
+    host_parallel_for(n, host_min_chunk_size * 16, [&](size_t begin, size_t end) {
+      for (size_t v = begin; v < end; ++v) {
+        clusters[v] = communities[coarse_vertices[v]];
+      }
+    });
+
+    std::vector<vertex_t> next_vertices{};
+    vertex_t num_next_vertices{};
+    if (refine) {
+      std::tie(next_vertices, num_next_vertices) = host_refine_communities(level_graph,
+                                                                           strengths,
+                                                                           total_weight,
+                                                                           resolution,
+                                                                           communities,
+                                                                           num_communities,
+                                                                           *rng_seed,
+                                                                           level);
+      initial_communities.resize(num_next_vertices);
+      for (size_t v = 0; v < level_n; ++v) {
+        initial_communities[next_vertices[v]] = communities[v];
+      }
+    } else {
+      next_vertices     = std::move(communities);
+      num_next_vertices = num_communities;
+    }
+    if (static_cast<size_t>(num_next_vertices) == level_n) { return false; }
+
+    coarse = host_coarsen(level_graph, next_vertices, num_next_vertices);
+    host_parallel_for(n, host_min_chunk_size * 16, [&](size_t begin, size_t end) {
+      for (size_t v = begin; v < end; ++v) {
+        coarse_vertices[v] = next_vertices[coarse_vertices[v]];
+      }
+    });
+    return true;
+  };
+
+  for (size_t level = 0; level < max_level; ++level) {
+    if (!((level == 0) ? run_level(graph, level) : run_level(coarse.view(), level))) { break; }
+  }
+
+  return std::make_tuple(std::move(clusters), best_modularity);
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+host_level_graph_t<vertex_t, edge_t, weight_t> host_level_graph(
+  host_graph_t<vertex_t, edge_t, weight_t> const& graph)
+{
+  return {graph.number_of_vertices_,
+          graph.offsets_.data(),
+          graph.indices_.data(),
+          graph.is_weighted_ ? graph.weights_.data() : nullptr};
+}
+
+}  // namespace detail
+
+/**
+ * @brief Louvain community detection on a symmetric host graph (an unweighted graph has weight 1
+ * on every edge).
+ *
+ * See detail::host_local_moving for the parallel local moving and detail::host_coarsen for the
+ * contraction of the communities.
+ *
+ * @return the community (numbered from 0) of every internal vertex and the modularity of the
+ * partition
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+std::tuple<std::vector<vertex_t>, double> host_louvain(
+  host_graph_t<vertex_t, edge_t, weight_t> const& graph,
+  size_t max_level,
+  double threshold,
+  double resolution)
+{
+  CUGRAPH_EXPECTS(graph.is_symmetric_,
+                  "Invalid input arguments: Louvain requires a symmetric graph");
+
+  return detail::host_hierarchical_clustering(
+    detail::host_level_graph(graph), max_level, threshold, resolution, false, std::nullopt);
+}
+
+/**
+ * @brief Leiden community detection on a symmetric host graph: Louvain, with every community
+ * refined into well connected sub-communities (detail::host_refine_communities) before it is
+ * contracted.
+ *
+ * @return the community (numbered from 0) of every internal vertex and the modularity of the
+ * partition
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+std::tuple<std::vector<vertex_t>, double> host_leiden(
+  host_graph_t<vertex_t, edge_t, weight_t> const& graph,
+  size_t max_level,
+  double resolution,
+  uint64_t rng_seed)
+{
+  CUGRAPH_EXPECTS(graph.is_symmetric_,
+                  "Invalid input arguments: Leiden requires a symmetric graph");
+
+  return detail::host_hierarchical_clustering(detail::host_level_graph(graph),
+                                              max_level,
+                                              detail::host_leiden_threshold,
+                                              resolution,
+                                              true,
+                                              rng_seed);
+}
+
+/**
+ * @brief Ensemble clustering for graphs (ECG) on a symmetric host graph.
+ *
+ * Runs @p ensemble_size single level Louvain passes, each sweeping the vertices in a different
+ * random order, reweights every edge by the fraction f of the passes that put its endpoints in
+ * the same community (min_weight + (weight - min_weight) * f), and runs Louvain on the reweighted
+ * graph.
+ *
+ * @return the community (numbered from 0) of every internal vertex and the modularity of the
+ * partition on the original edge weights
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+std::tuple<std::vector<vertex_t>, double> host_ecg(
+  host_graph_t<vertex_t, edge_t, weight_t> const& graph,
+  double min_weight,
+  size_t ensemble_size,
+  size_t max_level,
+  double threshold,
+  double resolution,
+  uint64_t rng_seed)
+{
+  CUGRAPH_EXPECTS(graph.is_symmetric_, "Invalid input arguments: ECG requires a symmetric graph");
+  CUGRAPH_EXPECTS(min_weight >= 0.0, "Invalid input arguments: min_weight must be positive");
+  CUGRAPH_EXPECTS(ensemble_size >= 1,
+                  "Invalid input arguments: ensemble_size must be a non-zero integer");
+  CUGRAPH_EXPECTS(
+    threshold > 0.0 && threshold <= 1.0,
+    "Invalid input arguments: threshold must be a positive number in range (0.0, 1.0]");
+  CUGRAPH_EXPECTS(
+    resolution > 0.0 && resolution <= 1.0,
+    "Invalid input arguments: resolution must be a positive number in range (0.0, 1.0]");
+
+  auto level_graph = detail::host_level_graph(graph);
+  auto n           = static_cast<size_t>(graph.number_of_vertices_);
+
+  std::vector<double> weights(graph.indices_.size(), double{0});
+  std::vector<vertex_t> communities{};
+  for (size_t i = 0; i < ensemble_size; ++i) {
+    std::tie(communities, std::ignore) = detail::host_hierarchical_clustering(
+      level_graph, size_t{1}, threshold, resolution, false, rng_seed + i);
+    host_parallel_for(n, detail::host_min_chunk_size, [&](size_t begin, size_t end) {
+      for (size_t v = begin; v < end; ++v) {
+        for (auto e = graph.offsets_[v]; e < graph.offsets_[v + 1]; ++e) {
+          if (communities[graph.indices_[e]] == communities[v]) { weights[e] += 1; }
+        }
+      }
+    });
+  }
+  host_parallel_for(
+    weights.size(), detail::host_min_chunk_size * 16, [&](size_t begin, size_t end) {
+      for (size_t e = begin; e < end; ++e) {
+        weights[e] = min_weight + (level_graph.weight(static_cast<edge_t>(e)) - min_weight) *
+                                    weights[e] / static_cast<double>(ensemble_size);
+      }
+    });
+
+  detail::host_level_graph_t<vertex_t, edge_t, double> reweighted{
+    graph.number_of_vertices_, graph.offsets_.data(), graph.indices_.data(), weights.data()};
+  auto [clusters, modularity] = detail::host_hierarchical_clustering(
+    reweighted, max_level, threshold, resolution, false, rng_seed + ensemble_size);
+
+  auto strengths    = detail::host_vertex_strengths(level_graph);
+  auto total_weight = std::accumulate(strengths.begin(), strengths.end(), double{0});
+  if (total_weight > 0) {
+    std::vector<double> cluster_strengths(n, double{0});
+    for (size_t v = 0; v < n; ++v) {
+      cluster_strengths[clusters[v]] += strengths[v];
+    }
+    auto const& cluster_of = clusters;
+    modularity             = detail::host_modularity(
+      level_graph,
+      [&](vertex_t v) { return cluster_of[v]; },
+      cluster_strengths,
+      total_weight,
+      resolution);
+  }
+
+  return std::make_tuple(std::move(clusters), modularity);
+}
+
+}  // namespace c_api
+}  // namespace cugraph
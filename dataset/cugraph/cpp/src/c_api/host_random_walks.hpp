@@ -0,0 +1,461 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "c_api/host_graph.hpp"
+#include "c_api/host_sampling.hpp"
+
+#include <cugraph/utilities/error.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+namespace cugraph {
+namespace c_api {
+namespace detail {
+
+// Walks that step together; their independent memory accesses overlap
+constexpr size_t host_walk_group_size{64};
+
+// Walk chunks smaller than this run on the calling thread
+constexpr size_t host_walk_min_chunk_size{256};
+
+// node2vec steps into vertices with at least this many out-edges may use second order alias
+// tables built on first use, smaller vertices use rejection sampling
+constexpr size_t host_node2vec_cache_min_degree{64};
+
+// Total number of alias table entries the second order cache of one walk call may hold
+constexpr size_t host_node2vec_cache_max_entries{size_t{1} << 23};
+
+/**
+ * @brief Builds a Walker alias table over @p n weights with Vose's method.
+ *
+ * Slot i keeps itself with probability @p probabilities[i] and moves to @p aliases[i]
+ * otherwise.  Non-positive weights are never selected.  Returns false (and leaves the table
+ * unspecified) if no weight is positive.
+ */
+template <typename weight_t, typename index_t>
+bool host_build_alias_table(weight_t const* weights,
+                            size_t n,
+                            float* probabilities,
+                            index_t* aliases,
+                            std::vector<double>& scaled,
+                            std::vector<index_t>& small,
+                            std::vector<index_t>& large)
+{
+  double sum{0};
+  for (size_t i = 0; i < n; ++i) {
+    if (weights[i] > 0) { sum += static_cast<double>(weights[i]); }
+  }
+  if (!(sum > 0)) { return false; }
+
+  scaled.resize(n);
+  small.clear();
+  large.clear();
+  index_t positive{0};
+  for (size_t i = 0; i < n; ++i) {
+    scaled[i] = (weights[i] > 0) ? static_cast<double>(weights[i]) * n / sum : 0.0;
+    if (weights[i] > 0) { positive = static_cast<index_t>(i); }
+    (scaled[i] < 1.0 ? small : large).push_back(static_cast<index_t>(i));
+  }
+
+  while (!small.empty() && !large.empty()) {
+    auto s = small.back();
+    auto l = large.back();
+    small.pop_back();
+    large.pop_back();
+    probabilities[s] = static_cast<float>(scaled[s]);
+    aliases[s]       = l;
+    scaled[l]        = (scaled[l] + scaled[s]) - 1.0;
+    (scaled[l] < 1.0 ? small : large).push_back(l);
+  }
+
+  // What is left has a scaled weight of 1 up to rounding, except zero weights whose partners
+  // were used up by rounding; those must never keep their own slot
+  auto finish = [&](std::vector<index_t> const& rest) {
+    for (auto i : rest) {
+      probabilities[i] = (weights[i] > 0) ? 1.0f : 0.0f;
+      aliases[i]       = (weights[i] > 0) ? i : positive;
+    }
+  };
+  finish(small);
+  finish(large);
+  return true;
+}
+
+}  // namespace detail
+
+/**
+ * @brief Transition tables of a host graph for weighted and node2vec random walks.
+ *
+ * The tables depend only on the graph, so they are built by the first walk that needs them and
+ * shared by all later walks on the graph.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+struct host_walk_tables_t {
+  // Alias tables over the out-edge weights of each vertex, parallel to host_graph_t::indices_.
+  // Edge e keeps itself with probability alias_probabilities_[e] and moves to edge aliases_[e]
+  // otherwise; aliases_[e] is -1 if the vertex has no positive out-edge weight.  Empty if the
+  // graph is unweighted.
+  std::vector<float> alias_probabilities_{};
+  std::vector<edge_t> aliases_{};
+
+  // The out-neighbors of each vertex in ascending order, for the node2vec distance tests
+  std::vector<vertex_t> sorted_indices_{};
+
+  // Whether node2vec steps out of each vertex use second order alias tables.  The vertices are
+  // chosen from the graph alone, before any walk, so that the walks do not depend on which
+  // thread fills the second order cache first.
+  std::vector<bool> node2vec_table_vertices_{};
+
+  bool has_edge(host_graph_t<vertex_t, edge_t, weight_t> const& graph,
+                vertex_t src,
+                vertex_t dst) const
+  {
+    return std::binary_search(sorted_indices_.begin() + graph.offsets_[src],
+                              sorted_indices_.begin() + graph.offsets_[src + 1],
+                              dst);
+  }
+};
+
+/**
+ * @brief Returns the walk tables of @p graph, building them on first use.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+host_walk_tables_t<vertex_t, edge_t, weight_t> const& host_walk_tables(
+  host_graph_t<vertex_t, edge_t, weight_t> const& graph)
+{
+  std::lock_guard<std::mutex> lock(graph.walk_tables_mutex_);
+  if (graph.walk_tables_) { return *graph.walk_tables_; }
+
+  auto tables    = std::make_shared<host_walk_tables_t<vertex_t, edge_t, weight_t>>();
+  auto num_edges = static_cast<size_t>(graph.number_of_edges());
+
+  tables->sorted_indices_.resize(num_edges);
+  if (graph.is_weighted_) {
+    tables->alias_probabilities_.resize(num_edges);
+    tables->aliases_.resize(num_edges);
+  }
+
+  host_parallel_for(
+    static_cast<size_t>(graph.number_of_vertices_), size_t{1} << 12, [&](size_t begin, size_t end) {
+      std::vector<double> scaled{};
+      std::vector<edge_t> small{};
+      std::vector<edge_t> large{};
+      for (auto v = static_cast<vertex_t>(begin); v < static_cast<vertex_t>(end); ++v) {
+        auto first = graph.offsets_[v];
+        auto last  = graph.offsets_[v + 1];
+        std::copy(graph.indices_.begin() + first,
+                  graph.indices_.begin() + last,
+                  tables->sorted_indices_.begin() + first);
+        std::sort(tables->sorted_indices_.begin() + first, tables->sorted_indices_.begin() + last);
+
+        if (!graph.is_weighted_ || (first == last)) { continue; }
+        auto aliases = tables->aliases_.data() + first;
+        if (detail::host_build_alias_table(graph.weights_.data() + first,
+                                           static_cast<size_t>(last - first),
+                                           tables->alias_probabilities_.data() + first,
+                                           aliases,
+                                           scaled,
+                                           small,
+                                           large)) {
+          for (auto e = first; e < last; ++e, ++aliases) {
+            *aliases += first;
+          }
+        } else {
+          std::fill(tables->alias_probabilities_.begin() + first,
+                    tables->alias_probabilities_.begin() + last,
+                    0.0f);
+          std::fill(aliases, aliases + (last - first), edge_t{-1});
+        }
+      }
+    });
+
+  // A vertex with in-degree d_in needs up to d_in tables of its out-degree entries; take the
+  // vertices in id order while their tables fit in the cache budget
+  std::vector<edge_t> in_degrees(static_cast<size_t>(graph.number_of_vertices_), edge_t{0});
+  for (auto dst : graph.indices_) {
+    ++in_degrees[dst];
+  }
+  tables->node2vec_table_vertices_.assign(static_cast<size_t>(graph.number_of_vertices_), false);
+  auto free_entries = detail::host_node2vec_cache_max_entries;
+  for (vertex_t v = 0; v < graph.number_of_vertices_; ++v) {
+    auto out_degree = static_cast<size_t>(graph.offsets_[v + 1] - graph.offsets_[v]);
+    auto in_degree  = static_cast<size_t>(in_degrees[v]);
+    if ((out_degree < detail::host_node2vec_cache_min_degree) || (in_degree == 0) ||
+        (in_degree > free_entries / out_degree)) {
+      continue;
+    }
+    free_entries -= in_degree * out_degree;
+    tables->node2vec_table_vertices_[v] = true;
+  }
+
+  graph.walk_tables_ = std::move(tables);
+  return *graph.walk_tables_;
+}
+
+namespace detail {
+
+/**
+ * @brief Second order node2vec alias tables of the out-edges of a vertex, for one incoming
+ * edge.  Aliases are relative to the first out-edge of the vertex.
+ */
+template <typename edge_t>
+struct host_node2vec_alias_t {
+  std::vector<float> probabilities_{};
+  std::vector<edge_t> aliases_{};
+  bool is_empty_{false};  // no out-edge has a positive weight
+};
+
+/**
+ * @brief Second order alias tables of one node2vec walk call, keyed by the edge a walk arrived
+ * on.  Tables are built lazily and never evicted; only edges into the vertices selected by
+ * host_walk_tables_t::node2vec_table_vertices_ get tables, which bounds the total size by
+ * host_node2vec_cache_max_entries.
+ */
+template <typename edge_t>
+class host_node2vec_cache_t {
+ public:
+  host_node2vec_alias_t<edge_t> const* find(edge_t incoming) const
+  {
+    auto& shard = shards_[shard_of(incoming)];
+    std::lock_guard<std::mutex> lock(shard.mutex_);
+    auto it = shard.tables_.find(incoming);
+    return (it != shard.tables_.end()) ? it->second.get() : nullptr;
+  }
+
+  /**
+   * @brief Inserts @p table for @p incoming, returns the table cached for @p incoming, which is
+   * the one inserted first if two threads built the same table.
+   */
+  host_node2vec_alias_t<edge_t> const* insert(
+    edge_t incoming, std::unique_ptr<host_node2vec_alias_t<edge_t>>&& table)
+  {
+    auto& shard = shards_[shard_of(incoming)];
+    std::lock_guard<std::mutex> lock(shard.mutex_);
+    auto [it, inserted] = shard.tables_.emplace(incoming, std::move(table));
+    return it->second.get();
+  }
+
+ private:
+  struct shard_t {
+    mutable std::mutex mutex_{};
+    std::unordered_map<edge_t, std::unique_ptr<host_node2vec_alias_t<edge_t>>> tables_{};
+  };
+
+  static size_t shard_of(edge_t incoming)
+  {
+    return static_cast<size_t>(host_splitmix64(static_cast<uint64_t>(incoming))) % num_shards;
+  }
+
+  static constexpr size_t num_shards{64};
+
+  std::array<shard_t, num_shards> shards_{};
+};
+
+}  // namespace detail
+
+enum class host_walk_type_t { UNIFORM, BIASED, NODE2VEC };
+
+/**
+ * @brief Host random walks over the out-edges of @p graph.
+ *
+ * Each walk starts at an internal vertex id in @p start_vertices and takes up to
+ * @p max_length steps.  Biased walks select an out-edge with probability proportional to its
+ * weight using the alias tables of the graph.  node2vec walks scale the (weighted) first order
+ * probabilities by 1/p for returning to the previous vertex, 1 for vertices adjacent to the
+ * previous vertex and 1/q otherwise; they sample by rejection from the first order tables, and
+ * from lazily built second order tables after stepping into one of the vertices with many
+ * out-edges that host_walk_tables selects for them.
+ *
+ * Walks run in groups that take each step together, so that the memory accesses of the
+ * different walks overlap, and the groups run on the host worker threads.  Every walk draws from
+ * its own random stream, so the walks do not depend on the number of threads.
+ *
+ * @return the paths (internal vertex ids, @p max_length + 1 per walk, padded with
+ * invalid_vertex_id) and, for weighted graphs, the weights of the traversed edges
+ * (@p max_length per walk, padded with 0).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+std::tuple<std::vector<vertex_t>, std::optional<std::vector<weight_t>>> host_random_walks(
+  host_graph_t<vertex_t, edge_t, weight_t> const& graph,
+  std::vector<vertex_t> const& start_vertices,
+  size_t max_length,
+  host_walk_type_t walk_type,
+  double p,
+  double q,
+  uint64_t rng_seed)
+{
+  CUGRAPH_EXPECTS((walk_type != host_walk_type_t::BIASED) || graph.is_weighted_,
+                  "Biased random walks require edge weights");
+  CUGRAPH_EXPECTS((walk_type != host_walk_type_t::NODE2VEC) || ((p > 0) && (q > 0)),
+                  "node2vec p and q must be positive");
+
+  auto const* tables =
+    (walk_type == host_walk_type_t::UNIFORM) ? nullptr : &host_walk_tables(graph);
+
+  auto num_walks   = start_vertices.size();
+  auto path_stride = max_length + 1;
+
+  std::vector<vertex_t> paths(num_walks * path_stride, invalid_vertex_id<vertex_t>::value);
+  auto weights = graph.is_weighted_
+                   ? std::make_optional<std::vector<weight_t>>(num_walks * max_length, weight_t{0})
+                   : std::nullopt;
+
+  double return_scale{1.0 / p};
+  double out_scale{1.0 / q};
+  double max_scale{std::max({return_scale, 1.0, out_scale})};
+
+  std::optional<detail::host_node2vec_cache_t<edge_t>> cache{};
+  if (walk_type == host_walk_type_t::NODE2VEC) { cache.emplace(); }
+
+  constexpr edge_t no_edge{-1};
+
+  auto first_order_edge = [&](vertex_t v, detail::host_rng_t& rng) {
+    auto first  = graph.offsets_[v];
+    auto degree = graph.offsets_[v + 1] - first;
+    if (degree == 0) { return no_edge; }
+    auto e = first + static_cast<edge_t>(rng.uniform_index(static_cast<uint64_t>(degree)));
+    if (tables == nullptr || !graph.is_weighted_) { return e; }
+    return (rng.uniform_real() < tables->alias_probabilities_[e]) ? e : tables->aliases_[e];
+  };
+
+  auto node2vec_scale = [&](vertex_t previous, vertex_t next) {
+    if (next == previous) { return return_scale; }
+    return tables->has_edge(graph, previous, next) ? 1.0 : out_scale;
+  };
+
+  auto second_order_table = [&](vertex_t v, vertex_t previous, edge_t incoming) {
+    auto first  = graph.offsets_[v];
+    auto degree = static_cast<size_t>(graph.offsets_[v + 1] - first);
+    if (auto table = cache->find(incoming)) { return table; }
+
+    auto table = std::make_unique<detail::host_node2vec_alias_t<edge_t>>();
+    std::vector<double> scaled_weights(degree);
+    for (size_t i = 0; i < degree; ++i) {
+      auto e            = first + static_cast<edge_t>(i);
+      scaled_weights[i] = (graph.is_weighted_ ? static_cast<double>(graph.weights_[e]) : 1.0) *
+                          node2vec_scale(previous, graph.indices_[e]);
+    }
+    table->probabilities_.resize(degree);
+    table->aliases_.resize(degree);
+    std::vector<double> scaled{};
+    std::vector<edge_t> small{};
+    std::vector<edge_t> large{};
+    table->is_empty_ = !detail::host_build_alias_table(scaled_weights.data(),
+                                                       degree,
+                                                       table->probabilities_.data(),
+                                                       table->aliases_.data(),
+                                                       scaled,
+                                                       small,
+                                                       large);
+    return cache->insert(incoming, std::move(table));
+  };
+
+  auto node2vec_edge = [&](
+                         vertex_t v, vertex_t previous, edge_t incoming, detail::host_rng_t& rng) {
+    auto first  = graph.offsets_[v];
+    auto degree = static_cast<size_t>(graph.offsets_[v + 1] - first);
+    if (degree == 0) { return no_edge; }
+
+    if ((incoming != no_edge) && tables->node2vec_table_vertices_[v]) {
+      auto table = second_order_table(v, previous, incoming);
+      if (table->is_empty_) { return no_edge; }
+      auto i = static_cast<edge_t>(rng.uniform_index(degree));
+      return static_cast<edge_t>(
+        first + ((rng.uniform_real() < table->probabilities_[i]) ? i : table->aliases_[i]));
+    }
+
+    // Rejection sampling: propose from the first order distribution, accept with probability
+    // scale / max_scale
+    while (true) {
+      auto e = first_order_edge(v, rng);
+      if (e == no_edge) { return no_edge; }
+      if (rng.uniform_real() * max_scale < node2vec_scale(previous, graph.indices_[e])) {
+        return e;
+      }
+    }
+  };
+
+  auto num_groups = (num_walks + detail::host_walk_group_size - 1) / detail::host_walk_group_size;
+  host_parallel_for(
+    num_groups,
+    std::max(detail::host_walk_min_chunk_size / detail::host_walk_group_size, size_t{1}),
+    [&](size_t group_begin, size_t group_end) {
+      std::vector<size_t> active{};
+      std::vector<vertex_t> current{};
+      std::vector<vertex_t> previous{};
+      std::vector<edge_t> incoming{};
+      std::vector<detail::host_rng_t> rngs{};
+
+      for (size_t group = group_begin; group < group_end; ++group) {
+        auto walk_begin = group * detail::host_walk_group_size;
+        auto walk_end   = std::min(walk_begin + detail::host_walk_group_size, num_walks);
+
+        active.clear();
+        current.clear();
+        previous.clear();
+        incoming.clear();
+        rngs.clear();
+        for (auto w = walk_begin; w < walk_end; ++w) {
+          paths[w * path_stride] = start_vertices[w];
+          active.push_back(active.size());
+          current.push_back(start_vertices[w]);
+          previous.push_back(start_vertices[w]);
+          incoming.push_back(no_edge);
+          rngs.emplace_back(rng_seed, w, 0, 0);
+        }
+
+        for (size_t step = 0; (step < max_length) && !active.empty(); ++step) {
+          size_t num_active{0};
+          for (auto i : active) {
+            auto v = current[i];
+            auto e = (walk_type == host_walk_type_t::NODE2VEC)
+                       ? node2vec_edge(v, previous[i], incoming[i], rngs[i])
+                       : first_order_edge(v, rngs[i]);
+            if (e == no_edge) { continue; }
+
+            auto w    = walk_begin + i;
+            auto next = graph.indices_[e];
+            paths[w * path_stride + step + 1] = next;
+            if (weights) { (*weights)[w * max_length + step] = graph.weights_[e]; }
+
+            // The next step of this walk reads the offsets of next, fetch them while the other
+            // walks of the group take their step
+            __builtin_prefetch(graph.offsets_.data() + next);
+
+            previous[i]          = v;
+            current[i]           = next;
+            incoming[i]          = e;
+            active[num_active++] = i;
+          }
+          active.resize(num_active);
+        }
+      }
+    });
+
+  return std::make_tuple(std::move(paths), std::move(weights));
+}
+
+}  // namespace c_api
+}  // namespace cugraph
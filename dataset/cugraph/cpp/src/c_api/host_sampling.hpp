@@ -0,0 +1,786 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "c_api/host_graph.hpp"
+
+#include <cugraph/sampling_functions.hpp>
+#include <cugraph/utilities/error.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <optional>
+#include <thread>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+namespace cugraph {
+namespace c_api {
+namespace detail {
+
+// Frontiers smaller than this are sampled on the calling thread
+constexpr size_t host_sampling_min_chunk_size{64};
+
+/**
+ * @brief Counter based random number stream.
+ *
+ * Every (batch, hop, frontier position) gets its own stream, so the samples do not depend on
+ * which thread draws them or on how the frontier is split into chunks.
+ */
+class host_rng_t {
+ public:
+  host_rng_t(uint64_t seed, uint64_t batch, uint64_t hop, uint64_t position)
+    : state_(host_splitmix64(seed ^ (host_splitmix64(host_splitmix64(batch) + hop) + position)))
+  {
+  }
+
+  uint64_t next()
+  {
+    state_ += uint64_t{0x9e3779b97f4a7c15};
+    return host_splitmix64(state_);
+  }
+
+  // Uniform integer in [0, n)
+  uint64_t uniform_index(uint64_t n)
+  {
+    return static_cast<uint64_t>((static_cast<__uint128_t>(next()) * n) >> 64);
+  }
+
+  // Uniform real in [0, 1)
+  double uniform_real() { return static_cast<double>(next() >> 11) * 0x1.0p-53; }
+
+ private:
+  uint64_t state_;
+};
+
+/**
+ * @brief Insert-only open addressing set of vertices that threads can insert into concurrently
+ * without locks.
+ *
+ * The capacity is fixed at construction; inserting more than @p max_size vertices is an error.
+ */
+template <typename vertex_t>
+class host_concurrent_vertex_set_t {
+ public:
+  explicit host_concurrent_vertex_set_t(size_t max_size)
+  {
+    size_t capacity{16};
+    while (capacity < 2 * max_size) {
+      capacity *= 2;
+    }
+    mask_  = capacity - 1;
+    slots_ = std::unique_ptr<std::atomic<vertex_t>[]>(new std::atomic<vertex_t>[capacity]);
+    host_parallel_for(capacity, size_t{1} << 16, [&](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; ++i) {
+        slots_[i].store(empty_slot, std::memory_order_relaxed);
+      }
+    });
+  }
+
+  /**
+   * @brief Inserts @p v, returns true if @p v was not in the set.
+   */
+  bool insert(vertex_t v)
+  {
+    for (auto slot = hash(v);; slot = (slot + 1) & mask_) {
+      auto current = slots_[slot].load(std::memory_order_relaxed);
+      if (current == v) { return false; }
+      if (current == empty_slot) {
+        if (slots_[slot].compare_exchange_strong(current, v, std::memory_order_relaxed)) {
+          return true;
+        }
+        if (current == v) { return false; }
+      }
+    }
+  }
+
+  bool contains(vertex_t v) const
+  {
+    for (auto slot = hash(v);; slot = (slot + 1) & mask_) {
+      auto current = slots_[slot].load(std::memory_order_relaxed);
+      if (current == v) { return true; }
+      if (current == empty_slot) { return false; }
+    }
+  }
+
+ private:
+  static constexpr vertex_t empty_slot{invalid_vertex_id<vertex_t>::value};
+
+  size_t hash(vertex_t v) const
+  {
+    return static_cast<size_t>(host_splitmix64(static_cast<uint64_t>(v))) & mask_;
+  }
+
+  std::unique_ptr<std::atomic<vertex_t>[]> slots_{};
+  size_t mask_{0};
+};
+
+/**
+ * @brief Selects the out-edges of one vertex to sample, appending their edge indices to
+ * @p selected.
+ *
+ * A negative @p fan_out selects every out-edge (every out-edge with a positive weight if
+ * @p is_biased).  Biased sampling uses the edge weights as biases; without replacement it uses
+ * the Efraimidis-Spirakis exponential keys, with replacement it searches the prefix sums of the
+ * weights.
+ */
+template <typename edge_t, typename weight_t>
+void host_select_edges(edge_t first,
+                       edge_t last,
+                       weight_t const* weights,
+                       int fan_out,
+                       bool with_replacement,
+                       bool is_biased,
+                       host_rng_t& rng,
+                       std::vector<edge_t>& selected,
+                       std::vector<std::pair<double, edge_t>>& scratch)
+{
+  auto degree = static_cast<size_t>(last - first);
+  if (degree == 0 || fan_out == 0) { return; }
+
+  if (!is_biased) {
+    if (fan_out < 0 || (!with_replacement && static_cast<size_t>(fan_out) >= degree)) {
+      for (auto e = first; e < last; ++e) {
+        selected.push_back(e);
+      }
+    } else if (with_replacement) {
+      for (int i = 0; i < fan_out; ++i) {
+        selected.push_back(first + static_cast<edge_t>(rng.uniform_index(degree)));
+      }
+    } else if (fan_out <= 64) {
+      // Floyd's algorithm, the membership test is cheap for small fan outs
+      auto begin = selected.size();
+      for (auto j = degree - fan_out; j < degree; ++j) {
+        auto e = first + static_cast<edge_t>(rng.uniform_index(j + 1));
+        if (std::find(selected.begin() + begin, selected.end(), e) != selected.end()) {
+          e = first + static_cast<edge_t>(j);
+        }
+        selected.push_back(e);
+      }
+    } else {
+      // Partial Fisher-Yates shuffle of the edge indices
+      scratch.resize(degree);
+      for (size_t i = 0; i < degree; ++i) {
+        scratch[i].second = first + static_cast<edge_t>(i);
+      }
+      for (int i = 0; i < fan_out; ++i) {
+        auto j = i + rng.uniform_index(degree - i);
+        std::swap(scratch[i].second, scratch[j].second);
+        selected.push_back(scratch[i].second);
+      }
+    }
+    return;
+  }
+
+  if (with_replacement && fan_out > 0) {
+    scratch.resize(degree);
+    double total{0};
+    for (size_t i = 0; i < degree; ++i) {
+      auto w = weights[first + i];
+      total += (w > weight_t{0}) ? static_cast<double>(w) : 0.0;
+      scratch[i] = {total, first + static_cast<edge_t>(i)};
+    }
+    if (total <= 0.0) { return; }
+    for (int i = 0; i < fan_out; ++i) {
+      auto r  = rng.uniform_real() * total;
+      auto it = std::upper_bound(scratch.begin(),
+                                 scratch.end(),
+                                 r,
+                                 [](double x, auto const& entry) { return x < entry.first; });
+      // Rounding can put r at the end of the last range
+      if (it == scratch.end()) { --it; }
+      while (weights[it->second] <= weight_t{0}) {
+        --it;
+      }
+      selected.push_back(it->second);
+    }
+    return;
+  }
+
+  // Without replacement, or every edge: larger keys log(u) / w are selected first
+  scratch.clear();
+  for (auto e = first; e < last; ++e) {
+    auto w = weights[e];
+    if (w > weight_t{0}) {
+      scratch.emplace_back(std::log(1.0 - rng.uniform_real()) / static_cast<double>(w), e);
+    }
+  }
+  if (fan_out >= 0 && scratch.size() > static_cast<size_t>(fan_out)) {
+    std::nth_element(
+      scratch.begin(), scratch.begin() + fan_out, scratch.end(), [](auto const& a, auto const& b) {
+        return a.first > b.first;
+      });
+    scratch.resize(fan_out);
+  }
+  for (auto const& entry : scratch) {
+    selected.push_back(entry.second);
+  }
+}
+
+}  // namespace detail
+
+/**
+ * @brief Edges sampled from the seeds of one batch (label), in internal vertex ids.
+ *
+ * The edges are ordered by hop; the edges of hop h are [hop_offsets[h], hop_offsets[h + 1]).
+ */
+template <typename vertex_t, typename weight_t>
+struct host_sampled_batch_t {
+  size_t batch{0};
+  std::vector<vertex_t> srcs{};
+  std::vector<vertex_t> dsts{};
+  std::vector<weight_t> weights{};  // empty if the graph is unweighted
+  std::vector<size_t> hop_offsets{};
+};
+
+/**
+ * @brief Samples the neighborhood of the seeds of one batch, hop by hop.
+ *
+ * Follows the semantics of cugraph::homogeneous_uniform_neighbor_sample and
+ * cugraph::homogeneous_biased_neighbor_sample (the edge weights are the biases): the frontier of
+ * hop h + 1 is built from the destinations sampled in hop h according to
+ * @p flags.prior_sources_behavior and @p flags.dedupe_sources.  Large frontiers are sampled by
+ * the host worker threads; the result only depends on @p rng_seed and @p batch.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+host_sampled_batch_t<vertex_t, weight_t> host_sample_batch(
+  host_graph_t<vertex_t, edge_t, weight_t> const& graph,
+  std::vector<vertex_t> const& seeds,
+  std::vector<int> const& fan_out,
+  cugraph::sampling_flags_t const& flags,
+  bool is_biased,
+  uint64_t rng_seed,
+  size_t batch)
+{
+  CUGRAPH_EXPECTS(!is_biased || graph.is_weighted_,
+                  "biased sampling on a host graph requires edge weights.");
+
+  host_sampled_batch_t<vertex_t, weight_t> result{};
+  result.batch = batch;
+  result.hop_offsets.push_back(0);
+
+  bool exclude = flags.prior_sources_behavior == cugraph::prior_sources_behavior_t::EXCLUDE;
+  bool dedupe  = flags.dedupe_sources || exclude;
+
+  std::optional<detail::host_concurrent_vertex_set_t<vertex_t>> prior_sources{};
+  if (exclude) {
+    // Every vertex is a source at most once, the set never holds more than all the vertices
+    size_t max_sources = seeds.size();
+    size_t frontier_bound{seeds.size()};
+    for (size_t hop = 0; hop + 1 < fan_out.size(); ++hop) {
+      frontier_bound = (fan_out[hop] < 0)
+                         ? static_cast<size_t>(graph.number_of_vertices_)
+                         : std::min(frontier_bound * static_cast<size_t>(fan_out[hop]),
+                                    static_cast<size_t>(graph.number_of_vertices_));
+      max_sources += frontier_bound;
+    }
+    prior_sources.emplace(std::min(max_sources, static_cast<size_t>(graph.number_of_vertices_)));
+  }
+
+  std::vector<vertex_t> frontier = seeds;
+
+  for (size_t hop = 0; hop < fan_out.size(); ++hop) {
+    if (exclude) {
+      for (auto v : frontier) {
+        prior_sources->insert(v);
+      }
+    }
+
+    auto num_chunks = host_num_chunks(frontier.size(), detail::host_sampling_min_chunk_size);
+    std::vector<host_sampled_batch_t<vertex_t, weight_t>> chunk_edges(num_chunks);
+
+    auto sample = [&](size_t begin, size_t end, host_sampled_batch_t<vertex_t, weight_t>& edges) {
+      std::vector<edge_t> selected{};
+      std::vector<std::pair<double, edge_t>> scratch{};
+      for (size_t i = begin; i < end; ++i) {
+        auto u = frontier[i];
+        detail::host_rng_t rng(rng_seed, batch, hop, i);
+        selected.clear();
+        detail::host_select_edges(graph.offsets_[u],
+                                  graph.offsets_[u + 1],
+                                  graph.weights_.data(),
+                                  fan_out[hop],
+                                  flags.with_replacement,
+                                  is_biased,
+                                  rng,
+                                  selected,
+                                  scratch);
+        for (auto e : selected) {
+          edges.srcs.push_back(u);
+          edges.dsts.push_back(graph.indices_[e]);
+          if (graph.is_weighted_) { edges.weights.push_back(graph.weights_[e]); }
+        }
+      }
+    };
+
+    auto hop_begin = result.srcs.size();
+    if (num_chunks <= 1) {
+      sample(0, frontier.size(), result);
+    } else {
+      host_parallel_for_chunks(num_chunks, [&](size_t chunk) {
+        sample((frontier.size() * chunk) / num_chunks,
+               (frontier.size() * (chunk + 1)) / num_chunks,
+               chunk_edges[chunk]);
+      });
+      for (auto const& edges : chunk_edges) {
+        result.srcs.insert(result.srcs.end(), edges.srcs.begin(), edges.srcs.end());
+        result.dsts.insert(result.dsts.end(), edges.dsts.begin(), edges.dsts.end());
+        result.weights.insert(result.weights.end(), edges.weights.begin(), edges.weights.end());
+      }
+    }
+    result.hop_offsets.push_back(result.srcs.size());
+
+    if (hop + 1 == fan_out.size()) { break; }
+
+    // Build the next frontier from the destinations of this hop; with CARRY_OVER the frontier
+    // already holds the sources of the previous hops
+    std::vector<vertex_t> candidates(result.dsts.begin() + hop_begin, result.dsts.end());
+    if (flags.prior_sources_behavior == cugraph::prior_sources_behavior_t::CARRY_OVER) {
+      candidates.insert(candidates.end(), frontier.begin(), frontier.end());
+    }
+
+    if (!dedupe) {
+      frontier = std::move(candidates);
+      continue;
+    }
+
+    detail::host_concurrent_vertex_set_t<vertex_t> next_sources(candidates.size());
+    auto filter_chunks = host_num_chunks(candidates.size(), detail::host_sampling_min_chunk_size);
+    std::vector<std::vector<vertex_t>> chunk_frontiers(filter_chunks);
+    host_parallel_for_chunks(filter_chunks, [&](size_t chunk) {
+      auto begin = (candidates.size() * chunk) / filter_chunks;
+      auto end   = (candidates.size() * (chunk + 1)) / filter_chunks;
+      for (auto i = begin; i < end; ++i) {
+        auto v = candidates[i];
+        if ((!exclude || !prior_sources->contains(v)) && next_sources.insert(v)) {
+          chunk_frontiers[chunk].push_back(v);
+        }
+      }
+    });
+
+    frontier.clear();
+    for (auto const& chunk_frontier : chunk_frontiers) {
+      frontier.insert(frontier.end(), chunk_frontier.begin(), chunk_frontier.end());
+    }
+    // Which thread inserted a vertex first is not deterministic, its position is
+    std::sort(frontier.begin(), frontier.end());
+  }
+
+  while (result.hop_offsets.size() < fan_out.size() + 1) {
+    result.hop_offsets.push_back(result.srcs.size());
+  }
+
+  return result;
+}
+
+/**
+ * @brief Queue with a fixed capacity connecting threads producing and consuming items.
+ */
+template <typename T>
+class host_bounded_queue_t {
+ public:
+  explicit host_bounded_queue_t(size_t capacity) : capacity_(std::max(capacity, size_t{1})) {}
+
+  /**
+   * @brief Waits until the queue has room for @p item, returns false if the queue was cancelled.
+   */
+  bool push(T&& item)
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    not_full_.wait(lock, [this] { return cancelled_ || (items_.size() < capacity_); });
+    if (cancelled_) { return false; }
+    items_.push_back(std::move(item));
+    not_empty_.notify_one();
+    return true;
+  }
+
+  /**
+   * @brief Waits for an item, returns std::nullopt once the queue is closed and drained or
+   * cancelled.
+   */
+  std::optional<T> pop()
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    not_empty_.wait(lock, [this] { return cancelled_ || closed_ || !items_.empty(); });
+    if (cancelled_ || items_.empty()) { return std::nullopt; }
+    auto item = std::move(items_.front());
+    items_.pop_front();
+    not_full_.notify_one();
+    return item;
+  }
+
+  // No more items will be pushed
+  void close()
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    closed_ = true;
+    not_empty_.notify_all();
+  }
+
+  // Drops the queued items and releases the waiting producers and consumers
+  void cancel()
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    cancelled_ = true;
+    items_.clear();
+    not_full_.notify_all();
+    not_empty_.notify_all();
+  }
+
+  bool cancelled() const
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return cancelled_;
+  }
+
+ private:
+  size_t capacity_;
+  mutable std::mutex mutex_{};
+  std::condition_variable not_full_{};
+  std::condition_variable not_empty_{};
+  std::deque<T> items_{};
+  bool closed_{false};
+  bool cancelled_{false};
+};
+
+/**
+ * @brief Samples minibatches on host threads in the background.
+ *
+ * Batch b samples the seeds [batch_offsets[b], batch_offsets[b + 1]).  Batches are sampled
+ * concurrently by the host worker threads (a single batch is split over the threads instead) and
+ * handed to the consumer through a bounded queue as they complete, so that consuming the batches
+ * (building the output, copying it to the device, training) overlaps with sampling the next
+ * ones, and at most @p queue_capacity sampled batches wait in memory.
+ *
+ * The graph and the seeds must outlive the sampler.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+class host_neighbor_sampler_t {
+ public:
+  using batch_t = host_sampled_batch_t<vertex_t, weight_t>;
+
+  host_neighbor_sampler_t(host_graph_t<vertex_t, edge_t, weight_t> const& graph,
+                          std::vector<vertex_t> const& seeds,
+                          std::vector<size_t> const& batch_offsets,
+                          std::vector<int> fan_out,
+                          cugraph::sampling_flags_t flags,
+                          bool is_biased,
+                          uint64_t rng_seed,
+                          size_t queue_capacity)
+    : graph_(graph),
+      seeds_(seeds),
+      batch_offsets_(batch_offsets),
+      fan_out_(std::move(fan_out)),
+      flags_(flags),
+      is_biased_(is_biased),
+      rng_seed_(rng_seed),
+      queue_(queue_capacity)
+  {
+    producer_ = std::thread([this] { produce(); });
+  }
+
+  host_neighbor_sampler_t(host_neighbor_sampler_t const&)            = delete;
+  host_neighbor_sampler_t& operator=(host_neighbor_sampler_t const&) = delete;
+
+  ~host_neighbor_sampler_t()
+  {
+    queue_.cancel();
+    producer_.join();
+  }
+
+  size_t num_batches() const { return batch_offsets_.size() - 1; }
+
+  /**
+   * @brief Returns the next sampled batch in completion order, or std::nullopt once every batch
+   * was returned.  Rethrows the error if sampling a batch failed.
+   */
+  std::optional<batch_t> next()
+  {
+    auto batch = queue_.pop();
+    if (!batch && error_) { std::rethrow_exception(error_); }
+    return batch;
+  }
+
+ private:
+  batch_t sample(size_t batch) const
+  {
+    std::vector<vertex_t> seeds(seeds_.begin() + batch_offsets_[batch],
+                                seeds_.begin() + batch_offsets_[batch + 1]);
+    return host_sample_batch(graph_, seeds, fan_out_, flags_, is_biased_, rng_seed_, batch);
+  }
+
+  void produce()
+  {
+    try {
+      if (num_batches() < host_num_threads()) {
+        // Few batches: sample them one at a time, each on all the threads
+        for (size_t batch = 0; (batch < num_batches()) && !queue_.cancelled(); ++batch) {
+          if (!queue_.push(sample(batch))) { break; }
+        }
+      } else {
+        host_parallel_for_chunks(num_batches(), [this](size_t batch) {
+          if (!queue_.cancelled()) { queue_.push(sample(batch)); }
+        });
+      }
+    } catch (...) {
+      error_ = std::current_exception();
+    }
+    // error_ is published by the queue mutex
+    queue_.close();
+  }
+
+  host_graph_t<vertex_t, edge_t, weight_t> const& graph_;
+  std::vector<vertex_t> const& seeds_;
+  std::vector<size_t> const& batch_offsets_;
+  std::vector<int> fan_out_;
+  cugraph::sampling_flags_t flags_;
+  bool is_biased_;
+  uint64_t rng_seed_;
+  host_bounded_queue_t<batch_t> queue_;
+  std::exception_ptr error_{};
+  std::thread producer_{};
+};
+
+/**
+ * @brief How host_format_sampled_batch lays out the sampled edges, see
+ * cugraph::renumber_and_sort_sampled_edgelist, cugraph::renumber_and_compress_sampled_edgelist
+ * and cugraph::sort_sampled_edgelist.
+ */
+struct host_sample_format_t {
+  bool renumber{false};
+  bool use_hops{false};  // order and segment the edges by hop
+  bool src_is_major{true};
+  bool compress{false};
+  bool doubly_compress{false};
+  bool compress_per_hop{false};
+  bool retain_seeds{false};
+};
+
+/**
+ * @brief Sampled edges of one batch in the output layout.
+ *
+ * Positions in major_offsets are relative to the first edge of the batch and segment_offsets
+ * are relative to the first entry of majors (COO) or major_offsets (compressed).
+ */
+template <typename vertex_t, typename weight_t>
+struct host_formatted_batch_t {
+  size_t batch{0};
+  std::vector<vertex_t> majors{};  // COO majors, or DCSR/DCSC majors; empty for CSR/CSC
+  std::vector<size_t> major_offsets{};  // compressed formats only, no trailing entry
+  std::vector<vertex_t> minors{};
+  std::vector<weight_t> weights{};
+  std::vector<size_t> segment_offsets{};  // one segment per hop if use_hops, size segments + 1
+  std::vector<vertex_t> renumber_map{};
+};
+
+/**
+ * @brief Converts a sampled batch to external vertex ids, then renumbers, sorts and compresses it
+ * as the device sampling post processing functions would.
+ *
+ * @p seeds are the (internal) seeds of the batch, used if @p format.retain_seeds is set.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+host_formatted_batch_t<vertex_t, weight_t> host_format_sampled_batch(
+  host_graph_t<vertex_t, edge_t, weight_t> const& graph,
+  host_sampled_batch_t<vertex_t, weight_t>&& sampled,
+  std::vector<vertex_t> const& seeds,
+  host_sample_format_t const& format)
+{
+  host_formatted_batch_t<vertex_t, weight_t> result{};
+  result.batch = sampled.batch;
+
+  auto num_edges    = sampled.srcs.size();
+  auto num_hops     = sampled.hop_offsets.size() - 1;
+  auto num_segments = format.use_hops ? num_hops : size_t{1};
+
+  std::vector<int32_t> hops(num_edges, 0);
+  if (format.use_hops) {
+    for (size_t h = 0; h < num_hops; ++h) {
+      std::fill(hops.begin() + sampled.hop_offsets[h],
+                hops.begin() + sampled.hop_offsets[h + 1],
+                static_cast<int32_t>(h));
+    }
+  }
+
+  auto& majors = format.src_is_major ? sampled.srcs : sampled.dsts;
+  auto& minors = format.src_is_major ? sampled.dsts : sampled.srcs;
+
+  std::vector<vertex_t> seed_ids{};
+  if (format.renumber) {
+    // Vertices are ordered by the (hop, major before minor) pair where they first appear
+    std::unordered_map<vertex_t, vertex_t> local_ids{};
+    std::vector<vertex_t> vertices{};
+    std::vector<std::pair<int32_t, int32_t>> keys{};
+    local_ids.reserve(2 * num_edges + seeds.size());
+    auto visit = [&](vertex_t v, int32_t hop, int32_t is_minor) {
+      auto [it, inserted] = local_ids.emplace(v, static_cast<vertex_t>(vertices.size()));
+      if (inserted) {
+        vertices.push_back(v);
+        keys.emplace_back(hop, is_minor);
+      } else {
+        keys[it->second] = std::min(keys[it->second], std::make_pair(hop, is_minor));
+      }
+    };
+    if (format.retain_seeds) {
+      for (auto v : seeds) {
+        visit(v, 0, 0);
+      }
+    }
+    for (size_t e = 0; e < num_edges; ++e) {
+      visit(majors[e], hops[e], 0);
+      visit(minors[e], hops[e], 1);
+    }
+
+    std::vector<vertex_t> order(vertices.size());
+    std::iota(order.begin(), order.end(), vertex_t{0});
+    std::stable_sort(
+      order.begin(), order.end(), [&](vertex_t a, vertex_t b) { return keys[a] < keys[b]; });
+    std::vector<vertex_t> new_ids(vertices.size());
+    result.renumber_map.resize(vertices.size());
+    for (size_t i = 0; i < order.size(); ++i) {
+      new_ids[order[i]]      = static_cast<vertex_t>(i);
+      result.renumber_map[i] = graph.external_vertex(vertices[order[i]]);
+    }
+
+    for (size_t e = 0; e < num_edges; ++e) {
+      majors[e] = new_ids[local_ids[majors[e]]];
+      minors[e] = new_ids[local_ids[minors[e]]];
+    }
+    if (format.retain_seeds) {
+      for (auto v : seeds) {
+        seed_ids.push_back(new_ids[local_ids[v]]);
+      }
+    }
+  } else {
+    for (size_t e = 0; e < num_edges; ++e) {
+      majors[e] = graph.external_vertex(majors[e]);
+      minors[e] = graph.external_vertex(minors[e]);
+    }
+  }
+
+  // Compressing all the hops together groups the edges by major first
+  bool major_first = format.compress && !(format.use_hops && format.compress_per_hop);
+  std::vector<size_t> order(num_edges);
+  std::iota(order.begin(), order.end(), size_t{0});
+  std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+    return major_first
+             ? std::tie(majors[a], hops[a], minors[a]) < std::tie(majors[b], hops[b], minors[b])
+             : std::tie(hops[a], majors[a], minors[a]) < std::tie(hops[b], majors[b], minors[b]);
+  });
+
+  std::vector<vertex_t> sorted_majors(num_edges);
+  std::vector<int32_t> sorted_hops(num_edges);
+  result.minors.resize(num_edges);
+  if (graph.is_weighted_) { result.weights.resize(num_edges); }
+  for (size_t i = 0; i < num_edges; ++i) {
+    sorted_majors[i] = majors[order[i]];
+    sorted_hops[i]   = hops[order[i]];
+    result.minors[i] = minors[order[i]];
+    if (graph.is_weighted_) { result.weights[i] = sampled.weights[order[i]]; }
+  }
+
+  if (!format.compress) {
+    result.majors = std::move(sorted_majors);
+    result.segment_offsets.push_back(0);
+    for (size_t s = 1; s <= num_segments; ++s) {
+      result.segment_offsets.push_back(format.use_hops ? sampled.hop_offsets[s] : num_edges);
+    }
+    return result;
+  }
+
+  // Compress each group of edges (one group per hop if compress_per_hop, else one group)
+  std::vector<std::pair<size_t, size_t>> groups{};
+  if (format.use_hops && format.compress_per_hop) {
+    for (size_t h = 0; h < num_hops; ++h) {
+      groups.emplace_back(sampled.hop_offsets[h], sampled.hop_offsets[h + 1]);
+    }
+  } else {
+    groups.emplace_back(0, num_edges);
+  }
+
+  vertex_t max_vertex{-1};  // largest vertex id in the previous groups
+  for (auto v : seed_ids) {
+    max_vertex = std::max(max_vertex, v);
+  }
+  for (auto [begin, end] : groups) {
+    auto group_start = result.major_offsets.size();
+    if (format.doubly_compress) {
+      for (auto e = begin; e < end; ++e) {
+        if (e == begin || sorted_majors[e] != sorted_majors[e - 1]) {
+          result.majors.push_back(sorted_majors[e]);
+          result.major_offsets.push_back(e);
+        }
+      }
+    } else {
+      auto num_majors = max_vertex + 1;
+      for (auto e = begin; e < end; ++e) {
+        num_majors = std::max(num_majors, sorted_majors[e] + 1);
+      }
+      auto e = begin;
+      for (vertex_t v = 0; v < num_majors; ++v) {
+        result.major_offsets.push_back(e);
+        while (e < end && sorted_majors[e] == v) {
+          ++e;
+        }
+      }
+    }
+    for (auto e = begin; e < end; ++e) {
+      max_vertex = std::max({max_vertex, sorted_majors[e], result.minors[e]});
+    }
+
+    if (groups.size() > 1) {
+      result.segment_offsets.push_back(group_start);
+    } else if (!format.use_hops) {
+      result.segment_offsets.push_back(0);
+    } else {
+      // Hops compressed together: a hop starts at the first major of its edges
+      auto num_entries = result.major_offsets.size();
+      std::vector<size_t> hop_starts(num_hops, num_entries);
+      for (size_t entry = 0; entry < num_entries; ++entry) {
+        auto first = result.major_offsets[entry];
+        auto last  = (entry + 1 < num_entries) ? result.major_offsets[entry + 1] : end;
+        if (first < last) {
+          auto h      = static_cast<size_t>(sorted_hops[first]);
+          hop_starts[h] = std::min(hop_starts[h], entry);
+        }
+      }
+      hop_starts[0] = 0;
+      for (size_t h = num_hops - 1; h > 0; --h) {
+        hop_starts[h - 1] = std::min(hop_starts[h - 1], hop_starts[h]);
+      }
+      for (size_t h = 1; h < num_hops; ++h) {
+        hop_starts[h] = std::max(hop_starts[h], hop_starts[h - 1]);
+      }
+      result.segment_offsets.insert(
+        result.segment_offsets.end(), hop_starts.begin(), hop_starts.end());
+    }
+  }
+  result.segment_offsets.push_back(result.major_offsets.size());
+
+  return result;
+}
+
+}  // namespace c_api
+}  // namespace cugraph
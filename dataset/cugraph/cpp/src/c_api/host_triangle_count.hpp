@@ -0,0 +1,586 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "c_api/host_graph.hpp"
+#include "c_api/host_graph_algorithms.hpp"
+
+#include <cugraph/utilities/error.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+namespace cugraph {
+namespace c_api {
+namespace detail {
+
+// Triangle enumeration tasks cover oriented edges with about this much estimated intersection
+// work
+constexpr size_t host_triangle_min_task_cost{size_t{1} << 16};
+
+// Vertices with at least this many higher ranked neighbors mark them in a bitmap, so that each of
+// their edges costs a bit test per neighbor of the other endpoint instead of a merge
+constexpr size_t host_triangle_bitmap_min_degree{256};
+
+// Lists this many times shorter than the list they are intersected with search it by galloping
+constexpr size_t host_triangle_gallop_ratio{32};
+
+/**
+ * @brief Adjacency lists of an undirected simple graph, each in ascending order.
+ */
+template <typename vertex_t, typename edge_t>
+struct host_adjacency_t {
+  std::vector<edge_t> offsets_{};
+  std::vector<vertex_t> indices_{};
+
+  size_t degree(vertex_t v) const { return static_cast<size_t>(offsets_[v + 1] - offsets_[v]); }
+};
+
+/**
+ * @brief Returns the neighbors of every vertex of a symmetric host graph in ascending order,
+ * without self loops and multi-edges.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+host_adjacency_t<vertex_t, edge_t> host_simple_adjacency(
+  host_graph_t<vertex_t, edge_t, weight_t> const& graph)
+{
+  auto n = static_cast<size_t>(graph.number_of_vertices_);
+
+  std::vector<vertex_t> sorted(graph.indices_);
+  std::vector<edge_t> degrees(n);
+  host_parallel_for(n, host_min_chunk_size, [&](size_t begin, size_t end) {
+    for (auto v = static_cast<vertex_t>(begin); v < static_cast<vertex_t>(end); ++v) {
+      auto first = sorted.begin() + graph.offsets_[v];
+      auto last  = sorted.begin() + graph.offsets_[v + 1];
+      std::sort(first, last);
+      last       = std::remove(first, std::unique(first, last), v);
+      degrees[v] = static_cast<edge_t>(last - first);
+    }
+  });
+
+  host_adjacency_t<vertex_t, edge_t> adjacency{};
+  adjacency.offsets_.resize(n + 1);
+  adjacency.offsets_[0] = 0;
+  std::partial_sum(degrees.begin(), degrees.end(), adjacency.offsets_.begin() + 1);
+  adjacency.indices_.resize(adjacency.offsets_[n]);
+  host_parallel_for(n, host_min_chunk_size, [&](size_t begin, size_t end) {
+    for (auto v = static_cast<vertex_t>(begin); v < static_cast<vertex_t>(end); ++v) {
+      std::copy(sorted.begin() + graph.offsets_[v],
+                sorted.begin() + graph.offsets_[v] + degrees[v],
+                adjacency.indices_.begin() + adjacency.offsets_[v]);
+    }
+  });
+  return adjacency;
+}
+
+/**
+ * @brief Returns true if @p v ranks above @p u: vertices rank by degree, then by id.
+ */
+template <typename vertex_t, typename edge_t>
+bool host_ranks_above(host_adjacency_t<vertex_t, edge_t> const& adjacency, vertex_t v, vertex_t u)
+{
+  auto v_degree = adjacency.degree(v);
+  auto u_degree = adjacency.degree(u);
+  return (v_degree > u_degree) || ((v_degree == u_degree) && (v > u));
+}
+
+/**
+ * @brief Orients every edge of @p adjacency from its lower to its higher ranked endpoint.
+ *
+ * A vertex keeps only its higher ranked neighbors, so no vertex keeps more than sqrt(2 E) of them
+ * and the lists of the high degree vertices of power law graphs stay short.  Each triangle is
+ * found exactly once, from its lowest ranked vertex.
+ */
+template <typename vertex_t, typename edge_t>
+host_adjacency_t<vertex_t, edge_t> host_orient_by_degree(
+  host_adjacency_t<vertex_t, edge_t> const& adjacency)
+{
+  auto n = adjacency.offsets_.size() - 1;
+
+  std::vector<edge_t> degrees(n);
+  host_parallel_for(n, host_min_chunk_size, [&](size_t begin, size_t end) {
+    for (auto u = static_cast<vertex_t>(begin); u < static_cast<vertex_t>(end); ++u) {
+      degrees[u] = static_cast<edge_t>(std::count_if(
+        adjacency.indices_.begin() + adjacency.offsets_[u],
+        adjacency.indices_.begin() + adjacency.offsets_[u + 1],
+        [&](vertex_t v) { return host_ranks_above(adjacency, v, u); }));
+    }
+  });
+
+  host_adjacency_t<vertex_t, edge_t> oriented{};
+  oriented.offsets_.resize(n + 1);
+  oriented.offsets_[0] = 0;
+  std::partial_sum(degrees.begin(), degrees.end(), oriented.offsets_.begin() + 1);
+  oriented.indices_.resize(oriented.offsets_[n]);
+  host_parallel_for(n, host_min_chunk_size, [&](size_t begin, size_t end) {
+    for (auto u = static_cast<vertex_t>(begin); u < static_cast<vertex_t>(end); ++u) {
+      std::copy_if(adjacency.indices_.begin() + adjacency.offsets_[u],
+                   adjacency.indices_.begin() + adjacency.offsets_[u + 1],
+                   oriented.indices_.begin() + oriented.offsets_[u],
+                   [&](vertex_t v) { return host_ranks_above(adjacency, v, u); });
+    }
+  });
+  return oriented;
+}
+
+/**
+ * @brief Returns the index in @p oriented of the undirected edge {u, v} of @p adjacency.
+ */
+template <typename vertex_t, typename edge_t>
+edge_t host_oriented_edge(host_adjacency_t<vertex_t, edge_t> const& adjacency,
+                          host_adjacency_t<vertex_t, edge_t> const& oriented,
+                          vertex_t u,
+                          vertex_t v)
+{
+  if (!host_ranks_above(adjacency, v, u)) { std::swap(u, v); }
+  auto first = oriented.indices_.begin() + oriented.offsets_[u];
+  auto last  = oriented.indices_.begin() + oriented.offsets_[u + 1];
+  return static_cast<edge_t>(std::lower_bound(first, last, v) - oriented.indices_.begin());
+}
+
+/**
+ * @brief Calls @p match(i, j) for every @p small[i] == @p large[j], searching @p large for each
+ * entry of @p small with a doubling step.
+ */
+template <typename vertex_t, typename match_op_t>
+void host_intersect_galloping(vertex_t const* small,
+                              size_t small_size,
+                              vertex_t const* large,
+                              size_t large_size,
+                              match_op_t match)
+{
+  size_t lo{0};
+  for (size_t i = 0; (i < small_size) && (lo < large_size); ++i) {
+    auto x = small[i];
+    // large[lo - 1] < x; find hi with large[hi] >= x
+    size_t hi{lo};
+    size_t step{1};
+    while ((hi < large_size) && (large[hi] < x)) {
+      lo = hi + 1;
+      hi += step;
+      step *= 2;
+    }
+    lo = static_cast<size_t>(
+      std::lower_bound(large + lo, large + std::min(hi + 1, large_size), x) - large);
+    if ((lo < large_size) && (large[lo] == x)) { match(i, lo++); }
+  }
+}
+
+/**
+ * @brief Calls @p match(i, j) for every @p a[i] == @p b[j] of two ascending lists without
+ * duplicates.
+ *
+ * Lists of very different lengths are intersected by galloping search.  Otherwise the lists are
+ * merged a block of four entries at a time: with SSE2 all 16 pairs of two blocks of 32 bit ids are
+ * compared at once, by comparing one block with the four rotations of the other, and the block
+ * with the smaller last entry is consumed, so the merge takes one unpredictable branch per block
+ * instead of one per entry.  The rest of the lists, and lists of 64 bit ids, are merged without
+ * branches one entry at a time.
+ */
+template <typename vertex_t, typename match_op_t>
+void host_intersect_sorted(
+  vertex_t const* a, size_t a_size, vertex_t const* b, size_t b_size, match_op_t match)
+{
+  if (a_size * host_triangle_gallop_ratio < b_size) {
+    host_intersect_galloping(a, a_size, b, b_size, match);
+    return;
+  }
+  if (b_size * host_triangle_gallop_ratio < a_size) {
+    host_intersect_galloping(b, b_size, a, a_size, [&](size_t j, size_t i) { match(i, j); });
+    return;
+  }
+
+  size_t i{0};
+  size_t j{0};
+#ifdef __SSE2__
+  if constexpr (sizeof(vertex_t) == 4) {
+    while ((i + 4 <= a_size) && (j + 4 <= b_size)) {
+      auto va   = _mm_loadu_si128(reinterpret_cast<__m128i const*>(a + i));
+      auto vb   = _mm_loadu_si128(reinterpret_cast<__m128i const*>(b + j));
+      auto hits = _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi32(va, vb),
+                     _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(0, 3, 2, 1)))),
+        _mm_or_si128(_mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(1, 0, 3, 2))),
+                     _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(2, 1, 0, 3)))));
+      for (auto mask = _mm_movemask_ps(_mm_castsi128_ps(hits)); mask != 0; mask &= mask - 1) {
+        auto x = static_cast<size_t>(__builtin_ctz(mask));
+        size_t y{0};
+        while (b[j + y] != a[i + x]) {
+          ++y;
+        }
+        match(i + x, j + y);
+      }
+      auto a_last = a[i + 3];
+      auto b_last = b[j + 3];
+      if (a_last <= b_last) { i += 4; }
+      if (b_last <= a_last) { j += 4; }
+    }
+  }
+#endif
+
+  while ((i < a_size) && (j < b_size)) {
+    auto x = a[i];
+    auto y = b[j];
+    if (x == y) { match(i, j); }
+    i += (x <= y) ? 1 : 0;
+    j += (y <= x) ? 1 : 0;
+  }
+}
+
+/**
+ * @brief Vertex bitmaps shared by the tasks of one triangle enumeration.  Bitmaps are handed out
+ * and returned with all bits clear, so a task only clears the bits it set.
+ */
+class host_bitmap_pool_t {
+ public:
+  explicit host_bitmap_pool_t(size_t num_bits) : num_words_((num_bits + 63) / 64) {}
+
+  std::vector<uint64_t> acquire()
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (free_.empty()) { return std::vector<uint64_t>(num_words_, 0); }
+    auto bitmap = std::move(free_.back());
+    free_.pop_back();
+    return bitmap;
+  }
+
+  void release(std::vector<uint64_t>&& bitmap)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    free_.push_back(std::move(bitmap));
+  }
+
+ private:
+  size_t num_words_;
+  std::mutex mutex_{};
+  std::vector<std::vector<uint64_t>> free_{};
+};
+
+/**
+ * @brief Enumerates the triangles of a degree oriented graph.
+ *
+ * @p triangle_op(u, v, w, e_uv, e_uw, e_vw) is called once per triangle, with u the lowest and w
+ * the highest ranked vertex and the indices in @p oriented of its three edges.  e_uw is only
+ * computed if @p with_uw_edge is set (and is -1 otherwise), it costs a binary search when u
+ * intersects from a bitmap.
+ *
+ * Oriented edges are split into many more tasks than threads, of about equal estimated
+ * intersection cost, and the host worker threads take tasks one at a time: the edges of a high
+ * degree vertex spread over several tasks, and threads that run out of work take over the tasks
+ * left, so a few expensive vertices do not hold back the other threads.  Calls are concurrent.
+ */
+template <bool with_uw_edge, typename vertex_t, typename edge_t, typename triangle_op_t>
+void host_for_each_triangle(host_adjacency_t<vertex_t, edge_t> const& oriented,
+                            triangle_op_t triangle_op)
+{
+  auto n = oriented.offsets_.size() - 1;
+  auto m = oriented.indices_.size();
+  if (m == 0) { return; }
+
+  std::vector<uint64_t> costs(m);
+  host_parallel_for(n, host_min_chunk_size, [&](size_t begin, size_t end) {
+    for (auto u = static_cast<vertex_t>(begin); u < static_cast<vertex_t>(end); ++u) {
+      auto u_degree = oriented.degree(u);
+      for (auto e = oriented.offsets_[u]; e < oriented.offsets_[u + 1]; ++e) {
+        costs[e] = 1 + u_degree + oriented.degree(oriented.indices_[e]);
+      }
+    }
+  });
+  std::partial_sum(costs.begin(), costs.end(), costs.begin());
+  auto total_cost = costs.back();
+
+  host_bitmap_pool_t bitmaps(n);
+
+  auto num_tasks = host_num_chunks(total_cost, host_triangle_min_task_cost);
+  host_parallel_for_chunks(num_tasks, [&](size_t task) {
+    auto task_edge = [&](size_t t) {
+      return static_cast<edge_t>(
+        std::upper_bound(costs.begin(), costs.end(), (total_cost * t) / num_tasks) -
+        costs.begin());
+    };
+    auto first = task_edge(task);
+    auto last  = (task + 1 == num_tasks) ? static_cast<edge_t>(m) : task_edge(task + 1);
+    if (first >= last) { return; }
+
+    std::vector<uint64_t> bitmap{};
+    auto bitmap_vertex = invalid_vertex_id<vertex_t>::value;
+    auto clear_bitmap  = [&]() {
+      if (bitmap_vertex == invalid_vertex_id<vertex_t>::value) { return; }
+      for (auto e = oriented.offsets_[bitmap_vertex]; e < oriented.offsets_[bitmap_vertex + 1];
+           ++e) {
+        bitmap[oriented.indices_[e] / 64] = 0;
+      }
+      bitmap_vertex = invalid_vertex_id<vertex_t>::value;
+    };
+
+    auto u = static_cast<vertex_t>(
+      std::upper_bound(oriented.offsets_.begin(), oriented.offsets_.end(), first) -
+      oriented.offsets_.begin() - 1);
+    for (auto e = first; e < last; ++e) {
+      while (oriented.offsets_[u + 1] <= e) {
+        ++u;
+      }
+      auto v        = oriented.indices_[e];
+      auto u_first  = oriented.offsets_[u];
+      auto v_first  = oriented.offsets_[v];
+      auto u_list   = oriented.indices_.data() + u_first;
+      auto v_list   = oriented.indices_.data() + v_first;
+      auto u_degree = oriented.degree(u);
+      auto v_degree = oriented.degree(v);
+
+      if (u_degree < host_triangle_bitmap_min_degree) {
+        host_intersect_sorted(u_list, u_degree, v_list, v_degree, [&](size_t i, size_t j) {
+          triangle_op(u,
+                      v,
+                      v_list[j],
+                      e,
+                      static_cast<edge_t>(u_first + i),
+                      static_cast<edge_t>(v_first + j));
+        });
+        continue;
+      }
+
+      if (bitmap_vertex != u) {
+        if (bitmap.empty()) { bitmap = bitmaps.acquire(); }
+        clear_bitmap();
+        for (size_t i = 0; i < u_degree; ++i) {
+          bitmap[u_list[i] / 64] |= uint64_t{1} << (u_list[i] % 64);
+        }
+        bitmap_vertex = u;
+      }
+      for (size_t j = 0; j < v_degree; ++j) {
+        auto w = v_list[j];
+        if (((bitmap[w / 64] >> (w % 64)) & 1) == 0) { continue; }
+        edge_t e_uw{-1};
+        if constexpr (with_uw_edge) {
+          e_uw = static_cast<edge_t>(std::lower_bound(u_list, u_list + u_degree, w) -
+                                     oriented.indices_.data());
+        }
+        triangle_op(u, v, w, e, e_uw, static_cast<edge_t>(v_first + j));
+      }
+    }
+
+    if (!bitmap.empty()) {
+      clear_bitmap();
+      bitmaps.release(std::move(bitmap));
+    }
+  });
+}
+
+}  // namespace detail
+
+/**
+ * @brief Counts the triangles each vertex of a symmetric host graph is part of.
+ *
+ * Self loops are ignored and multi-edges count once.  Edges are oriented from the lower to the
+ * higher degree endpoint and each triangle is found once, by intersecting the higher ranked
+ * neighbors of the endpoints of its lowest ranked edge (see detail::host_for_each_triangle).
+ *
+ * @return the triangle count of every internal vertex
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+std::vector<edge_t> host_triangle_count(host_graph_t<vertex_t, edge_t, weight_t> const& graph)
+{
+  CUGRAPH_EXPECTS(graph.is_symmetric_,
+                  "Invalid input arguments: triangle counting requires a symmetric graph");
+
+  auto n = static_cast<size_t>(graph.number_of_vertices_);
+
+  auto oriented = detail::host_orient_by_degree(detail::host_simple_adjacency(graph));
+
+  auto counts = std::make_unique<std::atomic<edge_t>[]>(n);
+  detail::host_atomic_store_all(counts.get(), n, edge_t{0});
+  detail::host_for_each_triangle<false>(
+    oriented, [&](vertex_t u, vertex_t v, vertex_t w, edge_t, edge_t, edge_t) {
+      counts[u].fetch_add(1, std::memory_order_relaxed);
+      counts[v].fetch_add(1, std::memory_order_relaxed);
+      counts[w].fetch_add(1, std::memory_order_relaxed);
+    });
+
+  std::vector<edge_t> result(n);
+  host_parallel_for(n, detail::host_min_chunk_size * 16, [&](size_t begin, size_t end) {
+    for (size_t v = begin; v < end; ++v) {
+      result[v] = counts[v].load(std::memory_order_relaxed);
+    }
+  });
+  return result;
+}
+
+/**
+ * @brief k-truss of a symmetric host graph: the edges left after repeatedly removing every edge
+ * that is part of fewer than k - 2 triangles.
+ *
+ * The support (triangle count) of every edge is computed by triangle enumeration.  Edges are then
+ * peeled in rounds: the edges whose support dropped below k - 2 are removed together, in
+ * parallel, and each decrements the support of the other two edges of its remaining triangles.  A
+ * triangle that loses several edges in the same round is handled by the removed edge with the
+ * smallest index, so every support is decremented once per lost triangle.
+ *
+ * Self loops are never part of the k-truss.
+ *
+ * @return the sources, destinations (internal ids) and, for weighted graphs, the weights of the
+ * edges of @p graph in the k-truss; both directions of every edge are returned
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+std::tuple<std::vector<vertex_t>, std::vector<vertex_t>, std::optional<std::vector<weight_t>>>
+host_k_truss(host_graph_t<vertex_t, edge_t, weight_t> const& graph, size_t k)
+{
+  CUGRAPH_EXPECTS(graph.is_symmetric_,
+                  "Invalid input arguments: K-truss requires a symmetric graph");
+
+  auto n = static_cast<size_t>(graph.number_of_vertices_);
+
+  auto adjacency = detail::host_simple_adjacency(graph);
+  auto oriented  = detail::host_orient_by_degree(adjacency);
+  auto m         = oriented.indices_.size();
+
+  auto support = std::make_unique<std::atomic<edge_t>[]>(m);
+  detail::host_atomic_store_all(support.get(), m, edge_t{0});
+  detail::host_for_each_triangle<true>(
+    oriented, [&](vertex_t, vertex_t, vertex_t, edge_t e_uv, edge_t e_uw, edge_t e_vw) {
+      support[e_uv].fetch_add(1, std::memory_order_relaxed);
+      support[e_uw].fetch_add(1, std::memory_order_relaxed);
+      support[e_vw].fetch_add(1, std::memory_order_relaxed);
+    });
+
+  // Oriented edge of each adjacency entry, and source of each oriented edge
+  std::vector<edge_t> adjacency_edges(adjacency.indices_.size());
+  std::vector<vertex_t> oriented_srcs(m);
+  host_parallel_for(n, detail::host_min_chunk_size, [&](size_t begin, size_t end) {
+    for (auto u = static_cast<vertex_t>(begin); u < static_cast<vertex_t>(end); ++u) {
+      for (auto p = adjacency.offsets_[u]; p < adjacency.offsets_[u + 1]; ++p) {
+        adjacency_edges[p] =
+          detail::host_oriented_edge(adjacency, oriented, u, adjacency.indices_[p]);
+      }
+      std::fill(oriented_srcs.begin() + oriented.offsets_[u],
+                oriented_srcs.begin() + oriented.offsets_[u + 1],
+                u);
+    }
+  });
+
+  constexpr uint8_t alive{0};
+  constexpr uint8_t peeling{1};
+  constexpr uint8_t removed{2};
+
+  auto threshold = static_cast<edge_t>(k > 2 ? k - 2 : 0);
+
+  // Edge states only change between rounds, so they are read without synchronization
+  std::vector<uint8_t> states(m, alive);
+
+  auto collect = [&](size_t count, auto&& f) {
+    auto num_chunks = host_num_chunks(count, detail::host_min_chunk_size);
+    std::vector<std::vector<edge_t>> chunk_edges(std::max(num_chunks, size_t{1}));
+    host_parallel_for_chunks(num_chunks, [&](size_t chunk) {
+      f((count * chunk) / num_chunks, (count * (chunk + 1)) / num_chunks, chunk_edges[chunk]);
+    });
+    std::vector<edge_t> edges{};
+    for (auto const& c : chunk_edges) {
+      edges.insert(edges.end(), c.begin(), c.end());
+    }
+    return edges;
+  };
+
+  auto frontier = collect(m, [&](size_t begin, size_t end, std::vector<edge_t>& output) {
+    for (auto e = static_cast<edge_t>(begin); e < static_cast<edge_t>(end); ++e) {
+      if (support[e].load(std::memory_order_relaxed) < threshold) { output.push_back(e); }
+    }
+  });
+
+  while (!frontier.empty()) {
+    for (auto e : frontier) {
+      states[e] = peeling;
+    }
+
+    frontier =
+      collect(frontier.size(), [&](size_t begin, size_t end, std::vector<edge_t>& output) {
+        auto decrement = [&](edge_t e) {
+          if (support[e].fetch_sub(1, std::memory_order_relaxed) == threshold) {
+            output.push_back(e);
+          }
+        };
+        for (size_t i = begin; i < end; ++i) {
+          auto e  = frontier[i];
+          auto u  = oriented_srcs[e];
+          auto v  = oriented.indices_[e];
+          auto pu = adjacency.offsets_[u];
+          auto pv = adjacency.offsets_[v];
+          detail::host_intersect_sorted(adjacency.indices_.data() + pu,
+                                        adjacency.degree(u),
+                                        adjacency.indices_.data() + pv,
+                                        adjacency.degree(v),
+                                        [&](size_t a, size_t b) {
+                                          auto e1 = adjacency_edges[pu + a];
+                                          auto e2 = adjacency_edges[pv + b];
+                                          auto s1 = states[e1];
+                                          auto s2 = states[e2];
+                                          if ((s1 == removed) || (s2 == removed)) { return; }
+                                          if ((s1 == peeling) && (e1 < e)) { return; }
+                                          if ((s2 == peeling) && (e2 < e)) { return; }
+                                          if (s1 == alive) { decrement(e1); }
+                                          if (s2 == alive) { decrement(e2); }
+                                        });
+        }
+      });
+
+    for (auto& s : states) {
+      if (s == peeling) { s = removed; }
+    }
+  }
+
+  std::vector<uint8_t> keep(graph.indices_.size(), uint8_t{0});
+  host_parallel_for(n, detail::host_min_chunk_size, [&](size_t begin, size_t end) {
+    for (auto u = static_cast<vertex_t>(begin); u < static_cast<vertex_t>(end); ++u) {
+      for (auto e = graph.offsets_[u]; e < graph.offsets_[u + 1]; ++e) {
+        auto v  = graph.indices_[e];
+        keep[e] = (u != v) &&
+                  (states[detail::host_oriented_edge(adjacency, oriented, u, v)] != removed);
+      }
+    }
+  });
+
+  auto num_kept = static_cast<size_t>(std::count(keep.begin(), keep.end(), uint8_t{1}));
+  std::vector<vertex_t> srcs{};
+  std::vector<vertex_t> dsts{};
+  auto weights =
+    graph.is_weighted_ ? std::make_optional<std::vector<weight_t>>() : std::nullopt;
+  srcs.reserve(num_kept);
+  dsts.reserve(num_kept);
+  if (weights) { weights->reserve(num_kept); }
+  for (auto u = vertex_t{0}; u < graph.number_of_vertices_; ++u) {
+    for (auto e = graph.offsets_[u]; e < graph.offsets_[u + 1]; ++e) {
+      if (!keep[e]) { continue; }
+      srcs.push_back(u);
+      dsts.push_back(graph.indices_[e]);
+      if (weights) { weights->push_back(graph.weights_[e]); }
+    }
+  }
+
+  return std::make_tuple(std::move(srcs), std::move(dsts), std::move(weights));
+}
+
+}  // namespace c_api
+}  // namespace cugraph
@@ -16,6 +16,7 @@
 
 #include "c_api/abstract_functor.hpp"
 #include "c_api/graph.hpp"
+#include "c_api/host_triangle_count.hpp"
 #include "c_api/induced_subgraph_result.hpp"
 #include "c_api/resource_handle.hpp"
 #include "c_api/utils.hpp"
@@ -28,6 +29,7 @@
 #include <cugraph/graph_functions.hpp>
 
 #include <optional>
+#include <vector>
 
 namespace {
 
@@ -38,6 +40,8 @@ struct k_truss_functor : public cugraph::c_api::abstract_functor {
   bool do_expensive_check_;
   cugraph::c_api::cugraph_induced_subgraph_result_t* result_{};
 
+  static constexpr bool supports_host_graph{true};
+
   k_truss_functor(::cugraph_resource_handle_t const* handle,
                   ::cugraph_graph_t* graph,
                   size_t k,
@@ -61,6 +65,13 @@ struct k_truss_functor : public cugraph::c_api::abstract_functor {
     if constexpr (!cugraph::is_candidate<vertex_t, edge_t, weight_t>::value) {
       unsupported();
     } else {
+      if constexpr (!multi_gpu) {
+        if (graph_->host_graph_ != nullptr) {
+          run_on_host<vertex_t, edge_t, weight_t>();
+          return;
+        }
+      }
+
       if constexpr (store_transposed) {
         error_code_ = cugraph::c_api::
           transpose_storage<vertex_t, edge_t, weight_t, store_transposed, multi_gpu>(
@@ -120,6 +131,44 @@ struct k_truss_functor : public cugraph::c_api::abstract_functor {
                                                                cugraph_data_type_id_t::SIZE_T)};
     }
   }
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_on_host()
+  {
+    auto graph = reinterpret_cast<cugraph::c_api::host_graph_t<vertex_t, edge_t, weight_t> const*>(
+      graph_->host_graph_);
+
+    if (!graph->is_symmetric_) {
+      mark_error(CUGRAPH_INVALID_INPUT, "K-truss requires a symmetric graph");
+      return;
+    }
+
+    auto [result_src, result_dst, result_wgt] = cugraph::c_api::host_k_truss(*graph, k_);
+
+    for (auto& v : result_src) {
+      v = graph->external_vertex(v);
+    }
+    for (auto& v : result_dst) {
+      v = graph->external_vertex(v);
+    }
+
+    std::vector<size_t> edge_offsets{{0, result_src.size()}};
+
+    auto stream = handle_.get_stream();
+    result_     = new cugraph::c_api::cugraph_induced_subgraph_result_t{
+      new cugraph::c_api::cugraph_type_erased_device_array_t(
+        result_src, graph_->vertex_type_, stream),
+      new cugraph::c_api::cugraph_type_erased_device_array_t(
+        result_dst, graph_->vertex_type_, stream),
+      result_wgt ? new cugraph::c_api::cugraph_type_erased_device_array_t(
+                     *result_wgt, graph_->weight_type_, stream)
+                 : NULL,
+      NULL,
+      NULL,
+      new cugraph::c_api::cugraph_type_erased_device_array_t(
+        edge_offsets, cugraph_data_type_id_t::SIZE_T, stream)};
+    handle_.sync_stream();
+  }
 };
 
 }  // namespace
@@ -18,6 +18,7 @@
 #include "c_api/graph.hpp"
 #include "c_api/graph_helper.hpp"
 #include "c_api/hierarchical_clustering_result.hpp"
+#include "c_api/host_louvain.hpp"
 #include "c_api/random.hpp"
 #include "c_api/resource_handle.hpp"
 #include "c_api/utils.hpp"
@@ -44,6 +45,8 @@ struct leiden_functor : public cugraph::c_api::abstract_functor {
   bool do_expensive_check_;
   cugraph::c_api::cugraph_hierarchical_clustering_result_t* result_{};
 
+  static constexpr bool supports_host_graph{true};
+
   leiden_functor(::cugraph_resource_handle_t const* handle,
                  cugraph_rng_state_t* rng_state,
                  ::cugraph_graph_t* graph,
@@ -71,6 +74,13 @@ struct leiden_functor : public cugraph::c_api::abstract_functor {
     if constexpr (!cugraph::is_candidate<vertex_t, edge_t, weight_t>::value) {
       unsupported();
     } else {
+      if constexpr (!multi_gpu) {
+        if (graph_->host_graph_ != nullptr) {
+          run_on_host<vertex_t, edge_t, weight_t>();
+          return;
+        }
+      }
+
       // leiden expects store_transposed == false
       if constexpr (store_transposed) {
         error_code_ = cugraph::c_api::
@@ -120,6 +130,34 @@ struct leiden_functor : public cugraph::c_api::abstract_functor {
         new cugraph::c_api::cugraph_type_erased_device_array_t(clusters, graph_->vertex_type_)};
     }
   }
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_on_host()
+  {
+    auto graph = reinterpret_cast<cugraph::c_api::host_graph_t<vertex_t, edge_t, weight_t> const*>(
+      graph_->host_graph_);
+
+    if (!graph->is_symmetric_) {
+      mark_error(CUGRAPH_INVALID_INPUT, "Leiden requires a symmetric graph");
+      return;
+    }
+
+    auto rng_seed = cugraph::c_api::host_rng_seed(rng_state_->rng_state_);
+
+    auto [clusters, modularity] =
+      cugraph::c_api::host_leiden(*graph, max_level_, resolution_, rng_seed);
+
+    auto vertices = graph->vertex_ids();
+
+    auto stream = handle_.get_stream();
+    result_     = new cugraph::c_api::cugraph_hierarchical_clustering_result_t{
+      modularity,
+      new cugraph::c_api::cugraph_type_erased_device_array_t(
+        vertices, graph_->vertex_type_, stream),
+      new cugraph::c_api::cugraph_type_erased_device_array_t(
+        clusters, graph_->vertex_type_, stream)};
+    handle_.sync_stream();
+  }
 };
 
 }  // namespace
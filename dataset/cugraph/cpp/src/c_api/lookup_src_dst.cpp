@@ -28,6 +28,7 @@
 #include <cugraph/detail/shuffle_wrappers.hpp>
 #include <cugraph/detail/utility_wrappers.hpp>
 #include <cugraph/graph_functions.hpp>
+#include <cugraph/host_src_dst_lookup_container.hpp>
 #include <cugraph/sampling_functions.hpp>
 
 #include <raft/core/handle.hpp>
@@ -281,6 +282,197 @@ struct lookup_using_edge_ids_and_types_functor : public cugraph::c_api::abstract
   }
 };
 
+struct build_host_lookup_map_functor : public cugraph::c_api::abstract_functor {
+  cugraph::c_api::cugraph_type_erased_host_array_view_t const* srcs_{nullptr};
+  cugraph::c_api::cugraph_type_erased_host_array_view_t const* dsts_{nullptr};
+  cugraph::c_api::cugraph_type_erased_host_array_view_t const* edge_ids_{nullptr};
+  cugraph::c_api::cugraph_type_erased_host_array_view_t const* edge_types_{nullptr};
+  cugraph::c_api::cugraph_lookup_container_t* result_{};
+
+  build_host_lookup_map_functor(cugraph_type_erased_host_array_view_t const* srcs,
+                                cugraph_type_erased_host_array_view_t const* dsts,
+                                cugraph_type_erased_host_array_view_t const* edge_ids,
+                                cugraph_type_erased_host_array_view_t const* edge_types)
+    : abstract_functor(),
+      srcs_(reinterpret_cast<cugraph::c_api::cugraph_type_erased_host_array_view_t const*>(srcs)),
+      dsts_(reinterpret_cast<cugraph::c_api::cugraph_type_erased_host_array_view_t const*>(dsts)),
+      edge_ids_(
+        reinterpret_cast<cugraph::c_api::cugraph_type_erased_host_array_view_t const*>(edge_ids)),
+      edge_types_(
+        reinterpret_cast<cugraph::c_api::cugraph_type_erased_host_array_view_t const*>(edge_types))
+  {
+  }
+
+  template <typename vertex_t,
+            typename edge_t,
+            typename weight_t,
+            typename edge_type_type_t,
+            bool store_transposed,
+            bool multi_gpu>
+  void operator()()
+  {
+    if constexpr (multi_gpu || store_transposed ||
+                  !cugraph::is_candidate<vertex_t, edge_t, weight_t>::value) {
+      unsupported();
+    } else {
+      using container_t = cugraph::host_lookup_container_t<edge_t, edge_type_type_t, vertex_t>;
+
+      auto lookup_container = new container_t(
+        cugraph::build_edge_id_and_type_to_src_dst_lookup_map<vertex_t, edge_t, edge_type_type_t>(
+          raft::host_span<vertex_t const>(srcs_->as_type<vertex_t>(), srcs_->size_),
+          raft::host_span<vertex_t const>(dsts_->as_type<vertex_t>(), dsts_->size_),
+          raft::host_span<edge_t const>(edge_ids_->as_type<edge_t>(), edge_ids_->size_),
+          edge_types_ ? std::make_optional(raft::host_span<edge_type_type_t const>(
+                          edge_types_->as_type<edge_type_type_t>(), edge_types_->size_))
+                      : std::nullopt));
+
+      result_ = new cugraph::c_api::cugraph_lookup_container_t{edge_ids_->type_,
+                                                               cugraph_data_type_id_t::INT32,
+                                                               srcs_->type_,
+                                                               lookup_container,
+                                                               true};
+    }
+  }
+};
+
+struct host_lookup_functor : public cugraph::c_api::abstract_functor {
+  cugraph::c_api::cugraph_lookup_container_t const* lookup_container_{nullptr};
+  cugraph::c_api::cugraph_type_erased_host_array_view_t const* edge_ids_to_lookup_{nullptr};
+  cugraph::c_api::cugraph_type_erased_host_array_view_t const* edge_types_to_lookup_{nullptr};
+  int edge_type_to_lookup_{};
+  cugraph::c_api::cugraph_type_erased_host_array_view_t* srcs_{nullptr};
+  cugraph::c_api::cugraph_type_erased_host_array_view_t* dsts_{nullptr};
+
+  host_lookup_functor(cugraph_lookup_container_t const* lookup_container,
+                      cugraph_type_erased_host_array_view_t const* edge_ids_to_lookup,
+                      cugraph_type_erased_host_array_view_t const* edge_types_to_lookup,
+                      int edge_type_to_lookup,
+                      cugraph_type_erased_host_array_view_t* srcs,
+                      cugraph_type_erased_host_array_view_t* dsts)
+    : abstract_functor(),
+      lookup_container_(
+        reinterpret_cast<cugraph::c_api::cugraph_lookup_container_t const*>(lookup_container)),
+      edge_ids_to_lookup_(
+        reinterpret_cast<cugraph::c_api::cugraph_type_erased_host_array_view_t const*>(
+          edge_ids_to_lookup)),
+      edge_types_to_lookup_(
+        reinterpret_cast<cugraph::c_api::cugraph_type_erased_host_array_view_t const*>(
+          edge_types_to_lookup)),
+      edge_type_to_lookup_(edge_type_to_lookup),
+      srcs_(reinterpret_cast<cugraph::c_api::cugraph_type_erased_host_array_view_t*>(srcs)),
+      dsts_(reinterpret_cast<cugraph::c_api::cugraph_type_erased_host_array_view_t*>(dsts))
+  {
+  }
+
+  template <typename vertex_t,
+            typename edge_t,
+            typename weight_t,
+            typename edge_type_type_t,
+            bool store_transposed,
+            bool multi_gpu>
+  void operator()()
+  {
+    if constexpr (multi_gpu || store_transposed ||
+                  !cugraph::is_candidate<vertex_t, edge_t, weight_t>::value) {
+      unsupported();
+    } else {
+      auto lookup_container =
+        reinterpret_cast<cugraph::host_lookup_container_t<edge_t, edge_type_type_t, vertex_t>*>(
+          lookup_container_->lookup_container_);
+
+      raft::host_span<edge_t const> edge_ids(edge_ids_to_lookup_->as_type<edge_t>(),
+                                             edge_ids_to_lookup_->size_);
+      raft::host_span<vertex_t> srcs(srcs_->as_type<vertex_t>(), srcs_->size_);
+      raft::host_span<vertex_t> dsts(dsts_->as_type<vertex_t>(), dsts_->size_);
+
+      if (edge_types_to_lookup_) {
+        lookup_container->lookup_from_edge_ids_and_types(
+          edge_ids,
+          raft::host_span<edge_type_type_t const>(
+            edge_types_to_lookup_->as_type<edge_type_type_t>(), edge_types_to_lookup_->size_),
+          srcs,
+          dsts);
+      } else {
+        lookup_container->lookup_from_edge_ids_and_single_type(
+          edge_ids, static_cast<edge_type_type_t>(edge_type_to_lookup_), srcs, dsts);
+      }
+    }
+  }
+};
+
+cugraph_error_code_t run_host_lookup(
+  const cugraph_lookup_container_t* lookup_container,
+  const cugraph_type_erased_host_array_view_t* edge_ids_to_lookup,
+  const cugraph_type_erased_host_array_view_t* edge_types_to_lookup,
+  int edge_type_to_lookup,
+  cugraph_type_erased_host_array_view_t* srcs,
+  cugraph_type_erased_host_array_view_t* dsts,
+  cugraph_error_t** error)
+{
+  *error = nullptr;
+
+  auto p_container =
+    reinterpret_cast<cugraph::c_api::cugraph_lookup_container_t const*>(lookup_container);
+  auto p_edge_ids =
+    reinterpret_cast<cugraph::c_api::cugraph_type_erased_host_array_view_t const*>(
+      edge_ids_to_lookup);
+  auto p_edge_types =
+    reinterpret_cast<cugraph::c_api::cugraph_type_erased_host_array_view_t const*>(
+      edge_types_to_lookup);
+  auto p_srcs = reinterpret_cast<cugraph::c_api::cugraph_type_erased_host_array_view_t*>(srcs);
+  auto p_dsts = reinterpret_cast<cugraph::c_api::cugraph_type_erased_host_array_view_t*>(dsts);
+
+  CAPI_EXPECTS(p_container->host_,
+               CUGRAPH_INVALID_INPUT,
+               "lookup_container must be built with "
+               "cugraph_build_edge_id_and_type_to_src_dst_host_lookup_map",
+               *error);
+  CAPI_EXPECTS(p_edge_ids->type_ == p_container->edge_type_,
+               CUGRAPH_INVALID_INPUT,
+               "edge id type of edge_ids_to_lookup and lookup_container must match",
+               *error);
+  CAPI_EXPECTS(!p_edge_types || (p_edge_types->type_ == p_container->edge_type_id_type_),
+               CUGRAPH_INVALID_INPUT,
+               "edge type id type of edge_types_to_lookup and lookup_container must match",
+               *error);
+  CAPI_EXPECTS(!p_edge_types || (p_edge_types->size_ == p_edge_ids->size_),
+               CUGRAPH_INVALID_INPUT,
+               "edge_ids_to_lookup and edge_types_to_lookup must have the same size",
+               *error);
+  CAPI_EXPECTS((p_srcs->type_ == p_container->vertex_type_) &&
+                 (p_dsts->type_ == p_container->vertex_type_),
+               CUGRAPH_INVALID_INPUT,
+               "vertex type of srcs, dsts and lookup_container must match",
+               *error);
+  CAPI_EXPECTS((p_srcs->size_ == p_edge_ids->size_) && (p_dsts->size_ == p_edge_ids->size_),
+               CUGRAPH_INVALID_INPUT,
+               "srcs and dsts must have the size of edge_ids_to_lookup",
+               *error);
+
+  host_lookup_functor functor(
+    lookup_container, edge_ids_to_lookup, edge_types_to_lookup, edge_type_to_lookup, srcs, dsts);
+
+  try {
+    cugraph::c_api::vertex_dispatcher(p_container->vertex_type_,
+                                      p_container->edge_type_,
+                                      cugraph_data_type_id_t::FLOAT32,
+                                      p_container->edge_type_id_type_,
+                                      false,
+                                      false,
+                                      functor);
+
+    if (functor.error_code_ != CUGRAPH_SUCCESS) {
+      *error = reinterpret_cast<cugraph_error_t*>(functor.error_.release());
+      return functor.error_code_;
+    }
+  } catch (std::exception const& ex) {
+    *error = reinterpret_cast<cugraph_error_t*>(new cugraph::c_api::cugraph_error_t{ex.what()});
+    return CUGRAPH_UNKNOWN_ERROR;
+  }
+
+  return CUGRAPH_SUCCESS;
+}
+
 }  // namespace
 
 extern "C" cugraph_error_code_t cugraph_build_edge_id_and_type_to_src_dst_lookup_map(
@@ -303,6 +495,11 @@ extern "C" cugraph_error_code_t cugraph_lookup_endpoints_from_edge_ids_and_types
   cugraph_lookup_result_t** result,
   cugraph_error_t** error)
 {
+  CAPI_EXPECTS(
+    !reinterpret_cast<cugraph::c_api::cugraph_lookup_container_t const*>(lookup_container)->host_,
+    CUGRAPH_INVALID_INPUT,
+    "lookup_container is a host lookup map, use the _host lookup functions",
+    *error);
   CAPI_EXPECTS(
     reinterpret_cast<cugraph::c_api::cugraph_graph_t*>(graph)->vertex_type_ ==
       reinterpret_cast<cugraph::c_api::cugraph_lookup_container_t const*>(lookup_container)
@@ -340,6 +537,11 @@ extern "C" cugraph_error_code_t cugraph_lookup_endpoints_from_edge_ids_and_singl
   cugraph_lookup_result_t** result,
   cugraph_error_t** error)
 {
+  CAPI_EXPECTS(
+    !reinterpret_cast<cugraph::c_api::cugraph_lookup_container_t const*>(lookup_container)->host_,
+    CUGRAPH_INVALID_INPUT,
+    "lookup_container is a host lookup map, use the _host lookup functions",
+    *error);
   CAPI_EXPECTS(
     reinterpret_cast<cugraph::c_api::cugraph_graph_t*>(graph)->vertex_type_ ==
       reinterpret_cast<cugraph::c_api::cugraph_lookup_container_t const*>(lookup_container)
@@ -368,6 +570,92 @@ extern "C" cugraph_error_code_t cugraph_lookup_endpoints_from_edge_ids_and_singl
   return cugraph::c_api::run_algorithm(graph, functor, result, error);
 }
 
+extern "C" cugraph_error_code_t cugraph_build_edge_id_and_type_to_src_dst_host_lookup_map(
+  const cugraph_resource_handle_t* handle,
+  const cugraph_type_erased_host_array_view_t* srcs,
+  const cugraph_type_erased_host_array_view_t* dsts,
+  const cugraph_type_erased_host_array_view_t* edge_ids,
+  const cugraph_type_erased_host_array_view_t* edge_types,
+  cugraph_lookup_container_t** lookup_container,
+  cugraph_error_t** error)
+{
+  *lookup_container = nullptr;
+  *error            = nullptr;
+
+  auto p_srcs =
+    reinterpret_cast<cugraph::c_api::cugraph_type_erased_host_array_view_t const*>(srcs);
+  auto p_dsts =
+    reinterpret_cast<cugraph::c_api::cugraph_type_erased_host_array_view_t const*>(dsts);
+  auto p_edge_ids =
+    reinterpret_cast<cugraph::c_api::cugraph_type_erased_host_array_view_t const*>(edge_ids);
+  auto p_edge_types =
+    reinterpret_cast<cugraph::c_api::cugraph_type_erased_host_array_view_t const*>(edge_types);
+
+  CAPI_EXPECTS(p_srcs->type_ == p_dsts->type_,
+               CUGRAPH_INVALID_INPUT,
+               "vertex type of srcs and dsts must match",
+               *error);
+  CAPI_EXPECTS((p_srcs->size_ == p_dsts->size_) && (p_srcs->size_ == p_edge_ids->size_),
+               CUGRAPH_INVALID_INPUT,
+               "srcs, dsts and edge_ids must have the same size",
+               *error);
+  CAPI_EXPECTS(!p_edge_types || (p_edge_types->size_ == p_edge_ids->size_),
+               CUGRAPH_INVALID_INPUT,
+               "edge_ids and edge_types must have the same size",
+               *error);
+
+  build_host_lookup_map_functor functor(srcs, dsts, edge_ids, edge_types);
+
+  try {
+    cugraph::c_api::vertex_dispatcher(p_srcs->type_,
+                                      p_edge_ids->type_,
+                                      cugraph_data_type_id_t::FLOAT32,
+                                      p_edge_types ? p_edge_types->type_
+                                                   : cugraph_data_type_id_t::INT32,
+                                      false,
+                                      false,
+                                      functor);
+
+    if (functor.error_code_ != CUGRAPH_SUCCESS) {
+      *error = reinterpret_cast<cugraph_error_t*>(functor.error_.release());
+      return functor.error_code_;
+    }
+
+    *lookup_container = reinterpret_cast<cugraph_lookup_container_t*>(functor.result_);
+  } catch (std::exception const& ex) {
+    *error = reinterpret_cast<cugraph_error_t*>(new cugraph::c_api::cugraph_error_t{ex.what()});
+    return CUGRAPH_UNKNOWN_ERROR;
+  }
+
+  return CUGRAPH_SUCCESS;
+}
+
+extern "C" cugraph_error_code_t cugraph_lookup_endpoints_from_edge_ids_and_types_host(
+  const cugraph_resource_handle_t* handle,
+  const cugraph_lookup_container_t* lookup_container,
+  const cugraph_type_erased_host_array_view_t* edge_ids_to_lookup,
+  const cugraph_type_erased_host_array_view_t* edge_types_to_lookup,
+  cugraph_type_erased_host_array_view_t* srcs,
+  cugraph_type_erased_host_array_view_t* dsts,
+  cugraph_error_t** error)
+{
+  return run_host_lookup(
+    lookup_container, edge_ids_to_lookup, edge_types_to_lookup, 0, srcs, dsts, error);
+}
+
+extern "C" cugraph_error_code_t cugraph_lookup_endpoints_from_edge_ids_and_single_type_host(
+  const cugraph_resource_handle_t* handle,
+  const cugraph_lookup_container_t* lookup_container,
+  const cugraph_type_erased_host_array_view_t* edge_ids_to_lookup,
+  int edge_type_to_lookup,
+  cugraph_type_erased_host_array_view_t* srcs,
+  cugraph_type_erased_host_array_view_t* dsts,
+  cugraph_error_t** error)
+{
+  return run_host_lookup(
+    lookup_container, edge_ids_to_lookup, nullptr, edge_type_to_lookup, srcs, dsts, error);
+}
+
 extern "C" cugraph_type_erased_device_array_view_t* cugraph_lookup_result_get_srcs(
   const cugraph_lookup_result_t* result)
 {
@@ -395,6 +683,16 @@ extern "C" void cugraph_lookup_result_free(cugraph_lookup_result_t* result)
 extern "C" void cugraph_lookup_container_free(cugraph_lookup_container_t* container)
 {
   auto internal_ptr = reinterpret_cast<cugraph::c_api::cugraph_lookup_container_t*>(container);
-  // The graph should presumably own the other structures.
+  // host lookup maps are owned by the container, the graph should presumably own the other
+  // structures.
+  if (internal_ptr->host_) {
+    if (internal_ptr->vertex_type_ == cugraph_data_type_id_t::INT32) {
+      delete reinterpret_cast<cugraph::host_lookup_container_t<int32_t, int32_t, int32_t>*>(
+        internal_ptr->lookup_container_);
+    } else {
+      delete reinterpret_cast<cugraph::host_lookup_container_t<int64_t, int32_t, int64_t>*>(
+        internal_ptr->lookup_container_);
+    }
+  }
   delete internal_ptr;
 }
@@ -32,6 +32,7 @@ struct cugraph_lookup_container_t {
   cugraph_data_type_id_t vertex_type_;
 
   void* lookup_container_;
+  bool host_{false};  // lookup_container_ is a host_lookup_container_t if true
 };
 
 struct cugraph_lookup_result_t {
@@ -17,6 +17,7 @@
 #include "c_api/abstract_functor.hpp"
 #include "c_api/graph.hpp"
 #include "c_api/graph_helper.hpp"
+#include "c_api/host_sampling.hpp"
 #include "c_api/properties.hpp"
 #include "c_api/random.hpp"
 #include "c_api/resource_handle.hpp"
@@ -76,6 +77,253 @@ struct cugraph_sample_result_t {
 
 namespace {
 
+/**
+ * @brief Samples a graph created from host arrays on the host threads.
+ *
+ * Seeds are internal vertex ids grouped by label; label l has the seeds
+ * [start_vertex_label_offsets[l], start_vertex_label_offsets[l + 1]) and is reported as
+ * label_values[l].  Labels are sampled as independent batches by a host_neighbor_sampler_t while
+ * this thread renumbers, sorts and compresses the labels already sampled.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+cugraph::c_api::cugraph_sample_result_t* host_neighbor_sample(
+  raft::handle_t const& handle,
+  cugraph::c_api::cugraph_graph_t const* graph,
+  cugraph::c_api::cugraph_rng_state_t* rng_state,
+  std::vector<vertex_t> const& start_vertices,
+  std::optional<std::vector<size_t>> const& start_vertex_label_offsets,
+  std::vector<int32_t> const& label_values,
+  std::vector<int> const& fan_out,
+  cugraph::c_api::cugraph_sampling_options_t const& options,
+  bool is_biased)
+{
+  auto host_graph =
+    reinterpret_cast<cugraph::c_api::host_graph_t<vertex_t, edge_t, weight_t> const*>(
+      graph->host_graph_);
+
+  if (!options.renumber_results_ && options.compression_type_ != cugraph_compression_type_t::COO) {
+    CUGRAPH_FAIL("Can only use COO format if not renumbering");
+  }
+
+  cugraph::c_api::host_sample_format_t format{};
+  format.renumber     = options.renumber_results_;
+  format.use_hops     = options.return_hops_;
+  format.src_is_major = (options.compression_type_ == cugraph_compression_type_t::CSR) ||
+                        (options.compression_type_ == cugraph_compression_type_t::DCSR) ||
+                        (options.compression_type_ == cugraph_compression_type_t::COO);
+  format.compress     = options.compression_type_ != cugraph_compression_type_t::COO;
+  format.doubly_compress  = (options.compression_type_ == cugraph_compression_type_t::DCSR) ||
+                            (options.compression_type_ == cugraph_compression_type_t::DCSC);
+  format.compress_per_hop = options.compress_per_hop_;
+  format.retain_seeds     = options.retain_seeds_;
+
+  auto batch_offsets = start_vertex_label_offsets
+                         ? *start_vertex_label_offsets
+                         : std::vector<size_t>{size_t{0}, start_vertices.size()};
+  auto num_batches = batch_offsets.size() - 1;
+
+  auto rng_seed = cugraph::c_api::host_rng_seed(rng_state->rng_state_);
+
+  std::vector<cugraph::c_api::host_formatted_batch_t<vertex_t, weight_t>> batches(num_batches);
+  {
+    cugraph::c_api::host_neighbor_sampler_t<vertex_t, edge_t, weight_t> sampler(
+      *host_graph,
+      start_vertices,
+      batch_offsets,
+      fan_out,
+      cugraph::sampling_flags_t{options.prior_sources_behavior_,
+                                options.return_hops_ == TRUE,
+                                options.dedupe_sources_ == TRUE,
+                                options.with_replacement_ == TRUE},
+      is_biased,
+      rng_seed,
+      2 * cugraph::c_api::host_num_threads());
+
+    while (auto sampled = sampler.next()) {
+      auto batch = sampled->batch;
+      std::vector<vertex_t> seeds(start_vertices.begin() + batch_offsets[batch],
+                                  start_vertices.begin() + batch_offsets[batch + 1]);
+      batches[batch] = cugraph::c_api::host_format_sampled_batch(
+        *host_graph, std::move(*sampled), seeds, format);
+    }
+  }
+
+  bool has_labels            = start_vertex_label_offsets.has_value();
+  bool has_label_hop_offsets = has_labels || format.use_hops;
+
+  std::vector<vertex_t> majors{};
+  std::vector<size_t> major_offsets{};
+  std::vector<vertex_t> minors{};
+  std::vector<weight_t> weights{};
+  std::vector<size_t> label_hop_offsets{};
+  std::vector<int32_t> edge_labels{};
+  std::vector<vertex_t> renumber_map{};
+  std::vector<size_t> renumber_map_offsets{0};
+
+  for (auto const& batch : batches) {
+    auto edge_base    = minors.size();
+    auto segment_base = format.compress ? major_offsets.size() : minors.size();
+    for (size_t s = 0; s + 1 < batch.segment_offsets.size(); ++s) {
+      label_hop_offsets.push_back(segment_base + batch.segment_offsets[s]);
+    }
+    majors.insert(majors.end(), batch.majors.begin(), batch.majors.end());
+    for (auto offset : batch.major_offsets) {
+      major_offsets.push_back(edge_base + offset);
+    }
+    minors.insert(minors.end(), batch.minors.begin(), batch.minors.end());
+    weights.insert(weights.end(), batch.weights.begin(), batch.weights.end());
+    if (has_labels) {
+      edge_labels.insert(edge_labels.end(), batch.minors.size(), label_values[batch.batch]);
+    }
+    renumber_map.insert(renumber_map.end(), batch.renumber_map.begin(), batch.renumber_map.end());
+    renumber_map_offsets.push_back(renumber_map.size());
+  }
+  label_hop_offsets.push_back(format.compress ? major_offsets.size() : minors.size());
+  if (format.compress) { major_offsets.push_back(minors.size()); }
+
+  auto stream = handle.get_stream();
+
+  auto result = new cugraph::c_api::cugraph_sample_result_t{
+    format.compress
+      ? new cugraph::c_api::cugraph_type_erased_device_array_t(major_offsets, SIZE_T, stream)
+      : nullptr,
+    (format.compress && !format.doubly_compress)
+      ? nullptr
+      : new cugraph::c_api::cugraph_type_erased_device_array_t(majors, graph->vertex_type_, stream),
+    new cugraph::c_api::cugraph_type_erased_device_array_t(minors, graph->vertex_type_, stream),
+    nullptr,
+    nullptr,
+    host_graph->is_weighted_
+      ? new cugraph::c_api::cugraph_type_erased_device_array_t(weights, graph->weight_type_, stream)
+      : nullptr,
+    nullptr,
+    has_label_hop_offsets
+      ? new cugraph::c_api::cugraph_type_erased_device_array_t(label_hop_offsets, SIZE_T, stream)
+      : nullptr,
+    nullptr,
+    has_labels ? new cugraph::c_api::cugraph_type_erased_device_array_t(edge_labels, INT32, stream)
+               : nullptr,
+    format.renumber ? new cugraph::c_api::cugraph_type_erased_device_array_t(
+                        renumber_map, graph->vertex_type_, stream)
+                    : nullptr,
+    (format.renumber && has_labels) ? new cugraph::c_api::cugraph_type_erased_device_array_t(
+                                        renumber_map_offsets, SIZE_T, stream)
+                                    : nullptr,
+    nullptr,
+    nullptr};
+  handle.sync_stream();
+
+  return result;
+}
+
+/**
+ * @brief Copies the start vertices of a sampling call to the host as internal vertex ids,
+ * returns false if a start vertex is not in the host graph.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+bool host_start_vertices(
+  raft::handle_t const& handle,
+  cugraph::c_api::cugraph_graph_t const* graph,
+  cugraph::c_api::cugraph_type_erased_device_array_view_t const* start_vertices,
+  std::vector<vertex_t>& h_start_vertices)
+{
+  auto host_graph =
+    reinterpret_cast<cugraph::c_api::host_graph_t<vertex_t, edge_t, weight_t> const*>(
+      graph->host_graph_);
+
+  h_start_vertices.resize(start_vertices->size_);
+  raft::update_host(h_start_vertices.data(),
+                    start_vertices->as_type<vertex_t>(),
+                    start_vertices->size_,
+                    handle.get_stream());
+  handle.sync_stream();
+
+  for (auto& v : h_start_vertices) {
+    v = host_graph->internal_vertex(v);
+    if (v == cugraph::invalid_vertex_id<vertex_t>::value) { return false; }
+  }
+  return true;
+}
+
+/**
+ * @brief Groups the start vertices by their label for host sampling.  Labels are ordered by
+ * value; the order of the start vertices within a label is kept.
+ */
+template <typename vertex_t>
+std::tuple<std::vector<vertex_t>, std::vector<size_t>, std::vector<int32_t>>
+host_group_start_vertices_by_label(std::vector<vertex_t> const& start_vertices,
+                                   std::vector<int32_t> const& start_vertex_labels)
+{
+  std::vector<size_t> order(start_vertices.size());
+  std::iota(order.begin(), order.end(), size_t{0});
+  std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+    return start_vertex_labels[a] < start_vertex_labels[b];
+  });
+
+  std::vector<vertex_t> grouped(start_vertices.size());
+  std::vector<size_t> offsets{0};
+  std::vector<int32_t> labels{};
+  for (size_t i = 0; i < order.size(); ++i) {
+    grouped[i] = start_vertices[order[i]];
+    if (i == 0 || start_vertex_labels[order[i]] != start_vertex_labels[order[i - 1]]) {
+      if (i > 0) { offsets.push_back(i); }
+      labels.push_back(start_vertex_labels[order[i]]);
+    }
+  }
+  if (!grouped.empty()) { offsets.push_back(grouped.size()); }
+  return std::make_tuple(std::move(grouped), std::move(offsets), std::move(labels));
+}
+
+/**
+ * @brief Samples the start vertices of the deprecated uniform and biased sampling entry points
+ * on the host, grouped by their labels if @p start_vertex_labels is not nullptr.  Returns nullptr
+ * if a start vertex is not in the host graph.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+cugraph::c_api::cugraph_sample_result_t* host_labeled_neighbor_sample(
+  raft::handle_t const& handle,
+  cugraph::c_api::cugraph_graph_t const* graph,
+  cugraph::c_api::cugraph_rng_state_t* rng_state,
+  cugraph::c_api::cugraph_type_erased_device_array_view_t const* start_vertices,
+  cugraph::c_api::cugraph_type_erased_device_array_view_t const* start_vertex_labels,
+  cugraph::c_api::cugraph_type_erased_host_array_view_t const* fan_out,
+  cugraph::c_api::cugraph_sampling_options_t const& options,
+  bool is_biased)
+{
+  std::vector<vertex_t> h_start_vertices{};
+  if (!host_start_vertices<vertex_t, edge_t, weight_t>(
+        handle, graph, start_vertices, h_start_vertices)) {
+    return nullptr;
+  }
+
+  std::optional<std::vector<size_t>> start_vertex_label_offsets{std::nullopt};
+  std::vector<int32_t> label_values{};
+  if (start_vertex_labels != nullptr) {
+    std::vector<int32_t> h_start_vertex_labels(start_vertex_labels->size_);
+    raft::update_host(h_start_vertex_labels.data(),
+                      start_vertex_labels->as_type<int32_t>(),
+                      h_start_vertex_labels.size(),
+                      handle.get_stream());
+    handle.sync_stream();
+
+    std::vector<size_t> offsets{};
+    std::tie(h_start_vertices, offsets, label_values) =
+      host_group_start_vertices_by_label(h_start_vertices, h_start_vertex_labels);
+    start_vertex_label_offsets = std::move(offsets);
+  }
+
+  return host_neighbor_sample<vertex_t, edge_t, weight_t>(
+    handle,
+    graph,
+    rng_state,
+    h_start_vertices,
+    start_vertex_label_offsets,
+    label_values,
+    std::vector<int>(fan_out->as_type<int const>(), fan_out->as_type<int const>() + fan_out->size_),
+    options,
+    is_biased);
+}
+
 // Deprecated functor
 struct uniform_neighbor_sampling_functor : public cugraph::c_api::abstract_functor {
   raft::handle_t const& handle_;
@@ -91,6 +339,8 @@ struct uniform_neighbor_sampling_functor : public cugraph::c_api::abstract_funct
   bool do_expensive_check_{false};
   cugraph::c_api::cugraph_sample_result_t* result_{nullptr};
 
+  static constexpr bool supports_host_graph{true};
+
   uniform_neighbor_sampling_functor(
     cugraph_resource_handle_t const* handle,
     cugraph_graph_t* graph,
@@ -142,6 +392,13 @@ struct uniform_neighbor_sampling_functor : public cugraph::c_api::abstract_funct
     if constexpr (!cugraph::is_candidate<vertex_t, edge_t, weight_t>::value) {
       unsupported();
     } else {
+      if constexpr (!multi_gpu) {
+        if (graph_->host_graph_ != nullptr) {
+          run_on_host<vertex_t, edge_t, weight_t>();
+          return;
+        }
+      }
+
       // uniform_nbr_sample expects store_transposed == false
       if constexpr (store_transposed) {
         error_code_ = cugraph::c_api::
@@ -412,6 +669,22 @@ struct uniform_neighbor_sampling_functor : public cugraph::c_api::abstract_funct
         nullptr};
     }
   }
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_on_host()
+  {
+    result_ = host_labeled_neighbor_sample<vertex_t, edge_t, weight_t>(handle_,
+                                                                      graph_,
+                                                                      rng_state_,
+                                                                      start_vertices_,
+                                                                      start_vertex_labels_,
+                                                                      fan_out_,
+                                                                      options_,
+                                                                      false);
+    if (result_ == nullptr) {
+      mark_error(CUGRAPH_INVALID_INPUT, "Found invalid vertex in the input start vertices");
+    }
+  }
 };
 
 // Deprecated functor
@@ -430,6 +703,8 @@ struct biased_neighbor_sampling_functor : public cugraph::c_api::abstract_functo
   bool do_expensive_check_{false};
   cugraph::c_api::cugraph_sample_result_t* result_{nullptr};
 
+  static constexpr bool supports_host_graph{true};
+
   biased_neighbor_sampling_functor(
     cugraph_resource_handle_t const* handle,
     cugraph_graph_t* graph,
@@ -484,6 +759,13 @@ struct biased_neighbor_sampling_functor : public cugraph::c_api::abstract_functo
     if constexpr (!cugraph::is_candidate<vertex_t, edge_t, weight_t>::value) {
       unsupported();
     } else {
+      if constexpr (!multi_gpu) {
+        if (graph_->host_graph_ != nullptr) {
+          run_on_host<vertex_t, edge_t, weight_t>();
+          return;
+        }
+      }
+
       // uniform_nbr_sample expects store_transposed == false
       if constexpr (store_transposed) {
         error_code_ = cugraph::c_api::
@@ -760,6 +1042,29 @@ struct biased_neighbor_sampling_functor : public cugraph::c_api::abstract_functo
         nullptr};
     }
   }
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_on_host()
+  {
+    if (edge_biases_ != nullptr) {
+      mark_error(CUGRAPH_INVALID_INPUT,
+                 "Edge biases are not supported for graphs created from host arrays, the edge "
+                 "weights are used as biases");
+      return;
+    }
+
+    result_ = host_labeled_neighbor_sample<vertex_t, edge_t, weight_t>(handle_,
+                                                                      graph_,
+                                                                      rng_state_,
+                                                                      start_vertices_,
+                                                                      start_vertex_labels_,
+                                                                      fan_out_,
+                                                                      options_,
+                                                                      true);
+    if (result_ == nullptr) {
+      mark_error(CUGRAPH_INVALID_INPUT, "Found invalid vertex in the input start vertices");
+    }
+  }
 };
 
 struct neighbor_sampling_functor : public cugraph::c_api::abstract_functor {
@@ -778,6 +1083,8 @@ struct neighbor_sampling_functor : public cugraph::c_api::abstract_functor {
   bool do_expensive_check_{false};
   cugraph::c_api::cugraph_sample_result_t* result_{nullptr};
 
+  static constexpr bool supports_host_graph{true};
+
   neighbor_sampling_functor(
     cugraph_resource_handle_t const* handle,
     cugraph_rng_state_t* rng_state,
@@ -829,6 +1136,13 @@ struct neighbor_sampling_functor : public cugraph::c_api::abstract_functor {
     if constexpr (!cugraph::is_candidate<vertex_t, edge_t, weight_t>::value) {
       unsupported();
     } else {
+      if constexpr (!multi_gpu) {
+        if (graph_->host_graph_ != nullptr) {
+          run_on_host<vertex_t, edge_t, weight_t>();
+          return;
+        }
+      }
+
       // uniform_nbr_sample expects store_transposed == false
       if constexpr (store_transposed) {
         error_code_ = cugraph::c_api::
@@ -1373,6 +1687,56 @@ struct neighbor_sampling_functor : public cugraph::c_api::abstract_functor {
           : nullptr};
     }
   }
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_on_host()
+  {
+    if (num_edge_types_ > 1) {
+      mark_error(CUGRAPH_NOT_IMPLEMENTED,
+                 "Heterogeneous sampling is not implemented for graphs created from host arrays");
+      return;
+    }
+
+    if (edge_biases_ != nullptr) {
+      mark_error(CUGRAPH_INVALID_INPUT,
+                 "Edge biases are not supported for graphs created from host arrays, the edge "
+                 "weights are used as biases");
+      return;
+    }
+
+    std::vector<vertex_t> start_vertices{};
+    if (!host_start_vertices<vertex_t, edge_t, weight_t>(
+          handle_, graph_, start_vertices_, start_vertices)) {
+      mark_error(CUGRAPH_INVALID_INPUT, "Found invalid vertex in the input start vertices");
+      return;
+    }
+
+    std::optional<std::vector<size_t>> start_vertex_label_offsets{std::nullopt};
+    std::vector<int32_t> label_values{};
+    if (starting_vertex_label_offsets_ != nullptr) {
+      start_vertex_label_offsets = std::vector<size_t>(starting_vertex_label_offsets_->size_);
+      raft::update_host(start_vertex_label_offsets->data(),
+                        starting_vertex_label_offsets_->as_type<size_t>(),
+                        starting_vertex_label_offsets_->size_,
+                        handle_.get_stream());
+      handle_.sync_stream();
+
+      label_values.resize(start_vertex_label_offsets->size() - 1);
+      std::iota(label_values.begin(), label_values.end(), int32_t{0});
+    }
+
+    result_ = host_neighbor_sample<vertex_t, edge_t, weight_t>(
+      handle_,
+      graph_,
+      rng_state_,
+      start_vertices,
+      start_vertex_label_offsets,
+      label_values,
+      std::vector<int>(fan_out_->as_type<int const>(),
+                       fan_out_->as_type<int const>() + fan_out_->size_),
+      options_,
+      is_biased_);
+  }
 };
 
 }  // namespace
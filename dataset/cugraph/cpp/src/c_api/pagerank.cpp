@@ -17,6 +17,7 @@
 #include "c_api/abstract_functor.hpp"
 #include "c_api/centrality_result.hpp"
 #include "c_api/graph.hpp"
+#include "c_api/host_graph_algorithms.hpp"
 #include "c_api/resource_handle.hpp"
 #include "c_api/utils.hpp"
 
@@ -49,6 +50,8 @@ struct pagerank_functor : public cugraph::c_api::abstract_functor {
   bool do_expensive_check_{};
   cugraph::c_api::cugraph_centrality_result_t* result_{};
 
+  static constexpr bool supports_host_graph{true};
+
   pagerank_functor(
     cugraph_resource_handle_t const* handle,
     cugraph_graph_t* graph,
@@ -102,6 +105,13 @@ struct pagerank_functor : public cugraph::c_api::abstract_functor {
     if constexpr (!cugraph::is_candidate<vertex_t, edge_t, weight_t>::value) {
       unsupported();
     } else {
+      if constexpr (!multi_gpu) {
+        if (graph_->host_graph_ != nullptr) {
+          run_on_host<vertex_t, edge_t, weight_t>();
+          return;
+        }
+      }
+
       // Pagerank expects store_transposed == true
       if constexpr (!store_transposed) {
         error_code_ = cugraph::c_api::
@@ -247,6 +257,93 @@ struct pagerank_functor : public cugraph::c_api::abstract_functor {
         metadata.converged_};
     }
   }
+
+  template <typename T>
+  std::vector<T> copy_to_host(cugraph::c_api::cugraph_type_erased_device_array_view_t const* view)
+  {
+    std::vector<T> values(view->size_);
+    raft::update_host(values.data(), view->as_type<T>(), values.size(), handle_.get_stream());
+    return values;
+  }
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_on_host()
+  {
+    auto graph = reinterpret_cast<cugraph::c_api::host_graph_t<vertex_t, edge_t, weight_t> const*>(
+      graph_->host_graph_);
+
+    std::vector<vertex_t> out_weight_sum_vertices{};
+    std::vector<weight_t> out_weight_sum_values{};
+    std::vector<vertex_t> initial_guess_vertices{};
+    std::vector<weight_t> initial_guess_values{};
+    std::vector<vertex_t> personalization_vertices{};
+    std::vector<weight_t> personalization_values{};
+    if (precomputed_vertex_out_weight_sums_ != nullptr) {
+      out_weight_sum_vertices = copy_to_host<vertex_t>(precomputed_vertex_out_weight_vertices_);
+      out_weight_sum_values   = copy_to_host<weight_t>(precomputed_vertex_out_weight_sums_);
+    }
+    if (initial_guess_values_ != nullptr) {
+      initial_guess_vertices = copy_to_host<vertex_t>(initial_guess_vertices_);
+      initial_guess_values   = copy_to_host<weight_t>(initial_guess_values_);
+    }
+    if (personalization_vertices_ != nullptr) {
+      personalization_vertices = copy_to_host<vertex_t>(personalization_vertices_);
+      personalization_values   = copy_to_host<weight_t>(personalization_values_);
+    }
+    handle_.sync_stream();
+
+    bool valid_vertices{true};
+    auto renumber = [&](std::vector<vertex_t>& vertices) {
+      for (auto& v : vertices) {
+        v = graph->internal_vertex(v);
+        valid_vertices = valid_vertices && (v != cugraph::invalid_vertex_id<vertex_t>::value);
+      }
+    };
+    renumber(out_weight_sum_vertices);
+    renumber(initial_guess_vertices);
+    renumber(personalization_vertices);
+    if (!valid_vertices) {
+      mark_error(CUGRAPH_INVALID_INPUT, "Found invalid vertex in the input vertex lists");
+      return;
+    }
+
+    // Vertices missing from the vertex-value pairs take the value 0, as on the device
+    auto to_vertex_values = [&](std::vector<vertex_t> const& vertices,
+                                std::vector<weight_t> const& values) {
+      std::vector<weight_t> vertex_values(graph->number_of_vertices_, weight_t{0});
+      for (size_t i = 0; i < vertices.size(); ++i) {
+        vertex_values[vertices[i]] = values[i];
+      }
+      return vertex_values;
+    };
+
+    auto [pageranks, iterations, converged] = cugraph::c_api::host_pagerank(
+      *graph,
+      precomputed_vertex_out_weight_sums_ != nullptr
+        ? std::make_optional(to_vertex_values(out_weight_sum_vertices, out_weight_sum_values))
+        : std::nullopt,
+      personalization_vertices_ != nullptr
+        ? std::make_optional(std::make_tuple(std::move(personalization_vertices),
+                                             std::move(personalization_values)))
+        : std::nullopt,
+      initial_guess_values_ != nullptr
+        ? std::make_optional(to_vertex_values(initial_guess_vertices, initial_guess_values))
+        : std::nullopt,
+      static_cast<weight_t>(alpha_),
+      static_cast<weight_t>(epsilon_),
+      max_iterations_);
+
+    auto vertex_ids = graph->vertex_ids();
+
+    result_ = new cugraph::c_api::cugraph_centrality_result_t{
+      new cugraph::c_api::cugraph_type_erased_device_array_t(
+        vertex_ids, graph_->vertex_type_, handle_.get_stream()),
+      new cugraph::c_api::cugraph_type_erased_device_array_t(
+        pageranks, graph_->weight_type_, handle_.get_stream()),
+      iterations,
+      converged};
+    handle_.sync_stream();
+  }
 };
 
 }  // namespace
@@ -16,6 +16,7 @@
 
 #include "c_api/abstract_functor.hpp"
 #include "c_api/graph.hpp"
+#include "c_api/host_random_walks.hpp"
 #include "c_api/random.hpp"
 #include "c_api/resource_handle.hpp"
 #include "c_api/utils.hpp"
@@ -151,6 +152,60 @@ struct node2vec_functor : public abstract_functor {
 
 namespace {
 
+/**
+ * @brief Runs random walks on a graph created from host arrays.  Returns nullptr if a start
+ * vertex is not in the graph.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+cugraph::c_api::cugraph_random_walk_result_t* run_host_random_walks(
+  raft::handle_t const& handle,
+  cugraph::c_api::cugraph_rng_state_t* rng_state,
+  cugraph::c_api::cugraph_graph_t const* graph,
+  cugraph::c_api::cugraph_type_erased_device_array_view_t const* start_vertices,
+  size_t max_length,
+  cugraph::c_api::host_walk_type_t walk_type,
+  double p,
+  double q)
+{
+  auto host_graph =
+    reinterpret_cast<cugraph::c_api::host_graph_t<vertex_t, edge_t, weight_t> const*>(
+      graph->host_graph_);
+
+  std::vector<vertex_t> h_start_vertices(start_vertices->size_);
+  raft::update_host(h_start_vertices.data(),
+                    start_vertices->as_type<vertex_t>(),
+                    h_start_vertices.size(),
+                    handle.get_stream());
+  handle.sync_stream();
+
+  for (auto& v : h_start_vertices) {
+    v = host_graph->internal_vertex(v);
+    if (v == cugraph::invalid_vertex_id<vertex_t>::value) { return nullptr; }
+  }
+
+  auto rng_seed = cugraph::c_api::host_rng_seed(rng_state->rng_state_);
+
+  auto [paths, weights] = cugraph::c_api::host_random_walks(
+    *host_graph, h_start_vertices, max_length, walk_type, p, q, rng_seed);
+
+  for (auto& v : paths) {
+    v = host_graph->external_vertex(v);
+  }
+
+  auto stream = handle.get_stream();
+  auto result = new cugraph::c_api::cugraph_random_walk_result_t{
+    false,
+    max_length,
+    new cugraph::c_api::cugraph_type_erased_device_array_t(paths, graph->vertex_type_, stream),
+    weights ? new cugraph::c_api::cugraph_type_erased_device_array_t(
+                *weights, graph->weight_type_, stream)
+            : nullptr,
+    nullptr};
+  handle.sync_stream();
+
+  return result;
+}
+
 struct uniform_random_walks_functor : public cugraph::c_api::abstract_functor {
   raft::handle_t const& handle_;
   cugraph::c_api::cugraph_rng_state_t* rng_state_{nullptr};
@@ -159,6 +214,8 @@ struct uniform_random_walks_functor : public cugraph::c_api::abstract_functor {
   size_t max_length_{0};
   cugraph::c_api::cugraph_random_walk_result_t* result_{nullptr};
 
+  static constexpr bool supports_host_graph{true};
+
   uniform_random_walks_functor(cugraph_resource_handle_t const* handle,
                                cugraph_rng_state_t* rng_state,
                                cugraph_graph_t* graph,
@@ -187,6 +244,13 @@ struct uniform_random_walks_functor : public cugraph::c_api::abstract_functor {
     if constexpr (!cugraph::is_candidate<vertex_t, edge_t, weight_t>::value) {
       unsupported();
     } else {
+      if constexpr (!multi_gpu) {
+        if (graph_->host_graph_ != nullptr) {
+          run_on_host<vertex_t, edge_t, weight_t>();
+          return;
+        }
+      }
+
       // random walks expects store_transposed == false
       if constexpr (store_transposed) {
         error_code_ = cugraph::c_api::
@@ -252,6 +316,23 @@ struct uniform_random_walks_functor : public cugraph::c_api::abstract_functor {
         nullptr};
     }
   }
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_on_host()
+  {
+    result_ = run_host_random_walks<vertex_t, edge_t, weight_t>(
+      handle_,
+      rng_state_,
+      graph_,
+      start_vertices_,
+      max_length_,
+      cugraph::c_api::host_walk_type_t::UNIFORM,
+      1.0,
+      1.0);
+    if (result_ == nullptr) {
+      mark_error(CUGRAPH_INVALID_INPUT, "Found invalid vertex in the input start vertices");
+    }
+  }
 };
 
 struct biased_random_walks_functor : public cugraph::c_api::abstract_functor {
@@ -262,6 +343,8 @@ struct biased_random_walks_functor : public cugraph::c_api::abstract_functor {
   size_t max_length_{0};
   cugraph::c_api::cugraph_random_walk_result_t* result_{nullptr};
 
+  static constexpr bool supports_host_graph{true};
+
   biased_random_walks_functor(cugraph_resource_handle_t const* handle,
                               cugraph_rng_state_t* rng_state,
                               cugraph_graph_t* graph,
@@ -290,6 +373,13 @@ struct biased_random_walks_functor : public cugraph::c_api::abstract_functor {
     if constexpr (!cugraph::is_candidate<vertex_t, edge_t, weight_t>::value) {
       unsupported();
     } else {
+      if constexpr (!multi_gpu) {
+        if (graph_->host_graph_ != nullptr) {
+          run_on_host<vertex_t, edge_t, weight_t>();
+          return;
+        }
+      }
+
       // random walks expects store_transposed == false
       if constexpr (store_transposed) {
         error_code_ = cugraph::c_api::
@@ -355,6 +445,31 @@ struct biased_random_walks_functor : public cugraph::c_api::abstract_functor {
         nullptr};
     }
   }
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_on_host()
+  {
+    auto host_graph =
+      reinterpret_cast<cugraph::c_api::host_graph_t<vertex_t, edge_t, weight_t> const*>(
+        graph_->host_graph_);
+    if (!host_graph->is_weighted_) {
+      mark_error(CUGRAPH_INVALID_INPUT, "Biased random walks require edge weights");
+      return;
+    }
+
+    result_ = run_host_random_walks<vertex_t, edge_t, weight_t>(
+      handle_,
+      rng_state_,
+      graph_,
+      start_vertices_,
+      max_length_,
+      cugraph::c_api::host_walk_type_t::BIASED,
+      1.0,
+      1.0);
+    if (result_ == nullptr) {
+      mark_error(CUGRAPH_INVALID_INPUT, "Found invalid vertex in the input start vertices");
+    }
+  }
 };
 
 struct node2vec_random_walks_functor : public cugraph::c_api::abstract_functor {
@@ -367,6 +482,8 @@ struct node2vec_random_walks_functor : public cugraph::c_api::abstract_functor {
   double q_{0};
   cugraph::c_api::cugraph_random_walk_result_t* result_{nullptr};
 
+  static constexpr bool supports_host_graph{true};
+
   node2vec_random_walks_functor(cugraph_resource_handle_t const* handle,
                                 cugraph_rng_state_t* rng_state,
                                 cugraph_graph_t* graph,
@@ -399,6 +516,13 @@ struct node2vec_random_walks_functor : public cugraph::c_api::abstract_functor {
     if constexpr (!cugraph::is_candidate<vertex_t, edge_t, weight_t>::value) {
       unsupported();
     } else {
+      if constexpr (!multi_gpu) {
+        if (graph_->host_graph_ != nullptr) {
+          run_on_host<vertex_t, edge_t, weight_t>();
+          return;
+        }
+      }
+
       // random walks expects store_transposed == false
       if constexpr (store_transposed) {
         error_code_ = cugraph::c_api::
@@ -470,6 +594,23 @@ struct node2vec_random_walks_functor : public cugraph::c_api::abstract_functor {
         nullptr};
     }
   }
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_on_host()
+  {
+    result_ = run_host_random_walks<vertex_t, edge_t, weight_t>(
+      handle_,
+      rng_state_,
+      graph_,
+      start_vertices_,
+      max_length_,
+      cugraph::c_api::host_walk_type_t::NODE2VEC,
+      p_,
+      q_);
+    if (result_ == nullptr) {
+      mark_error(CUGRAPH_INVALID_INPUT, "Found invalid vertex in the input start vertices");
+    }
+  }
 };
 
 }  // anonymous namespace
@@ -16,6 +16,7 @@
 
 #include "c_api/abstract_functor.hpp"
 #include "c_api/graph.hpp"
+#include "c_api/host_graph_algorithms.hpp"
 #include "c_api/paths_result.hpp"
 #include "c_api/resource_handle.hpp"
 #include "c_api/utils.hpp"
@@ -38,6 +39,8 @@ struct sssp_functor : public abstract_functor {
   bool do_expensive_check_;
   cugraph_paths_result_t* result_{};
 
+  static constexpr bool supports_host_graph{true};
+
   sssp_functor(::cugraph_resource_handle_t const* handle,
                ::cugraph_graph_t* graph,
                size_t source,
@@ -66,6 +69,13 @@ struct sssp_functor : public abstract_functor {
     if constexpr (!cugraph::is_candidate<vertex_t, edge_t, weight_t>::value) {
       unsupported();
     } else {
+      if constexpr (!multi_gpu) {
+        if (graph_->host_graph_ != nullptr) {
+          run_on_host<vertex_t, edge_t, weight_t>();
+          return;
+        }
+      }
+
       // SSSP expects store_transposed == false
       if constexpr (store_transposed) {
         error_code_ = cugraph::c_api::
@@ -138,6 +148,43 @@ struct sssp_functor : public abstract_functor {
         new cugraph_type_erased_device_array_t(predecessors, graph_->vertex_type_)};
     }
   }
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_on_host()
+  {
+    auto graph =
+      reinterpret_cast<host_graph_t<vertex_t, edge_t, weight_t> const*>(graph_->host_graph_);
+
+    auto source = graph->internal_vertex(static_cast<vertex_t>(source_));
+    if (source == cugraph::invalid_vertex_id<vertex_t>::value) {
+      mark_error(CUGRAPH_INVALID_INPUT, "Found invalid vertex in the input source");
+      return;
+    }
+
+    std::vector<weight_t> distances(graph->number_of_vertices_);
+    std::vector<vertex_t> predecessors(compute_predecessors_ ? graph->number_of_vertices_ : 0);
+
+    host_sssp(*graph,
+              source,
+              static_cast<weight_t>(cutoff_),
+              distances.data(),
+              compute_predecessors_ ? predecessors.data() : nullptr,
+              do_expensive_check_);
+
+    for (auto& predecessor : predecessors) {
+      predecessor = graph->external_vertex(predecessor);
+    }
+
+    auto vertex_ids = graph->vertex_ids();
+
+    result_ = new cugraph_paths_result_t{
+      new cugraph_type_erased_device_array_t(
+        vertex_ids, graph_->vertex_type_, handle_.get_stream()),
+      new cugraph_type_erased_device_array_t(distances, graph_->weight_type_, handle_.get_stream()),
+      new cugraph_type_erased_device_array_t(
+        predecessors, graph_->vertex_type_, handle_.get_stream())};
+    handle_.sync_stream();
+  }
 };
 
 }  // namespace c_api
@@ -16,6 +16,7 @@
 
 #include "c_api/abstract_functor.hpp"
 #include "c_api/graph.hpp"
+#include "c_api/host_triangle_count.hpp"
 #include "c_api/resource_handle.hpp"
 #include "c_api/utils.hpp"
 
@@ -27,6 +28,7 @@
 #include <cugraph/shuffle_functions.hpp>
 
 #include <optional>
+#include <vector>
 
 namespace cugraph {
 namespace c_api {
@@ -48,6 +50,8 @@ struct triangle_count_functor : public cugraph::c_api::abstract_functor {
   bool do_expensive_check_;
   cugraph::c_api::cugraph_triangle_count_result_t* result_{};
 
+  static constexpr bool supports_host_graph{true};
+
   triangle_count_functor(::cugraph_resource_handle_t const* handle,
                          ::cugraph_graph_t* graph,
                          ::cugraph_type_erased_device_array_view_t const* vertices,
@@ -72,6 +76,13 @@ struct triangle_count_functor : public cugraph::c_api::abstract_functor {
     if constexpr (!cugraph::is_candidate<vertex_t, edge_t, weight_t>::value) {
       unsupported();
     } else {
+      if constexpr (!multi_gpu) {
+        if (graph_->host_graph_ != nullptr) {
+          run_on_host<vertex_t, edge_t, weight_t>();
+          return;
+        }
+      }
+
       // triangle counting expects store_transposed == false
       if constexpr (store_transposed) {
         error_code_ = cugraph::c_api::
@@ -141,6 +152,52 @@ struct triangle_count_functor : public cugraph::c_api::abstract_functor {
         new cugraph::c_api::cugraph_type_erased_device_array_t(counts, graph_->edge_type_)};
     }
   }
+
+  template <typename vertex_t, typename edge_t, typename weight_t>
+  void run_on_host()
+  {
+    auto graph = reinterpret_cast<cugraph::c_api::host_graph_t<vertex_t, edge_t, weight_t> const*>(
+      graph_->host_graph_);
+
+    if (!graph->is_symmetric_) {
+      mark_error(CUGRAPH_INVALID_INPUT, "Triangle counting requires a symmetric graph");
+      return;
+    }
+
+    std::vector<vertex_t> vertices{};
+    if (vertices_ != nullptr) {
+      vertices.resize(vertices_->size_);
+      raft::update_host(
+        vertices.data(), vertices_->as_type<vertex_t>(), vertices.size(), handle_.get_stream());
+      handle_.sync_stream();
+      for (auto v : vertices) {
+        if (graph->internal_vertex(v) == cugraph::invalid_vertex_id<vertex_t>::value) {
+          mark_error(CUGRAPH_INVALID_INPUT, "Found invalid vertex in the input vertices");
+          return;
+        }
+      }
+    }
+
+    auto all_counts = cugraph::c_api::host_triangle_count(*graph);
+
+    std::vector<edge_t> counts{};
+    if (vertices_ != nullptr) {
+      counts.resize(vertices.size());
+      for (size_t i = 0; i < vertices.size(); ++i) {
+        counts[i] = all_counts[graph->internal_vertex(vertices[i])];
+      }
+    } else {
+      vertices = graph->vertex_ids();
+      counts   = std::move(all_counts);
+    }
+
+    auto stream = handle_.get_stream();
+    result_     = new cugraph::c_api::cugraph_triangle_count_result_t{
+      new cugraph::c_api::cugraph_type_erased_device_array_t(
+        vertices, graph_->vertex_type_, stream),
+      new cugraph::c_api::cugraph_type_erased_device_array_t(counts, graph_->edge_type_, stream)};
+    handle_.sync_stream();
+  }
 };
 
 }  // namespace
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024, NVIDIA CORPORATION.
+ * Copyright (c) 2022-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -32,6 +32,12 @@ cugraph_error_code_t run_algorithm(::cugraph_graph_t const* graph,
   try {
     auto p_graph = reinterpret_cast<cugraph::c_api::cugraph_graph_t const*>(graph);
 
+    if (!functor_t::supports_host_graph && (p_graph->host_graph_ != nullptr)) {
+      *error = reinterpret_cast<::cugraph_error_t*>(new cugraph::c_api::cugraph_error_t{
+        "Algorithm is not implemented for graphs created from host arrays"});
+      return CUGRAPH_NOT_IMPLEMENTED;
+    }
+
     cugraph::c_api::vertex_dispatcher(p_graph->vertex_type_,
                                       p_graph->edge_type_,
                                       p_graph->weight_type_,
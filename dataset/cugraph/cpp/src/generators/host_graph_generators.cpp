@@ -0,0 +1,897 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cugraph/host_graph_generators.hpp>
+#include <cugraph/utilities/error.hpp>
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <condition_variable>
+#include <cstring>
+#include <exception>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+
+namespace cugraph {
+
+namespace detail {
+
+// gaps between selected G(n,p) pairs are drawn per block of pairs, a block holds this many
+// expected edges
+constexpr size_t host_gnp_expected_edges_per_block{size_t{1} << 16};
+
+// bytes buffered by host_edgelist_file_writer_t before each fwrite
+constexpr size_t host_edgelist_file_buffer_size{size_t{1} << 23};
+
+// width reserved for the edge count in the MatrixMarket size line, enough for any uint64_t
+constexpr size_t host_matrix_market_count_width{20};
+
+constexpr char const* host_matrix_market_banner{
+  "%%MatrixMarket matrix coordinate pattern general\n"};
+
+constexpr char host_binary_edgelist_magic[8] = {'C', 'G', 'E', 'D', 'G', 'E', 'S', '\0'};
+constexpr uint32_t host_binary_edgelist_version{1};
+
+inline uint64_t host_generator_mix(uint64_t x)
+{
+  x = (x ^ (x >> 30)) * uint64_t{0xbf58476d1ce4e5b9};
+  x = (x ^ (x >> 27)) * uint64_t{0x94d049bb133111eb};
+  return x ^ (x >> 31);
+}
+
+/**
+ * SplitMix64 stream keyed by (seed, stream). Every edge (R-mat) or block of vertex pairs
+ * (G(n,p)) draws from its own stream, which is what makes the output independent of how the
+ * work is split across threads and chunks.
+ */
+class host_generator_rng_t {
+ public:
+  host_generator_rng_t(uint64_t seed, uint64_t stream)
+    : state_{host_generator_mix(seed ^ host_generator_mix(stream + uint64_t{0x9e3779b97f4a7c15}))}
+  {
+  }
+
+  uint64_t next()
+  {
+    state_ += uint64_t{0x9e3779b97f4a7c15};
+    return host_generator_mix(state_);
+  }
+
+  // uniform in (0, 1]
+  double uniform_positive_real() { return static_cast<double>((next() >> 11) + 1) * 0x1.0p-53; }
+
+ private:
+  uint64_t state_;
+};
+
+inline size_t host_generator_num_threads(host_generator_options_t const& options,
+                                         size_t num_chunks)
+{
+  size_t num_threads = options.num_threads;
+  if (num_threads == 0) {
+    num_threads = std::max(size_t{1}, static_cast<size_t>(std::thread::hardware_concurrency()));
+  }
+  return std::max(size_t{1}, std::min(num_threads, num_chunks));
+}
+
+/**
+ * Generate @p num_chunks chunks on a pool of worker threads and hand them to @p consumer in chunk
+ * order from the calling thread. At most 2 * num_threads chunks are in flight, so memory stays
+ * bounded no matter how slow the consumer (typically a file writer) is.
+ *
+ * generate_chunk(chunk, srcs, dsts) must overwrite srcs and dsts with the edges of the chunk.
+ */
+template <typename vertex_t, typename generate_chunk_t>
+size_t host_stream_chunks(size_t num_chunks,
+                          generate_chunk_t generate_chunk,
+                          host_edgelist_consumer_t<vertex_t> const& consumer,
+                          host_generator_options_t const& options)
+{
+  size_t num_edges{0};
+  auto num_threads = host_generator_num_threads(options, num_chunks);
+
+  if (num_threads == 1) {
+    std::vector<vertex_t> srcs{};
+    std::vector<vertex_t> dsts{};
+    for (size_t chunk = 0; chunk < num_chunks; ++chunk) {
+      generate_chunk(chunk, srcs, dsts);
+      if (!srcs.empty()) { consumer(srcs.data(), dsts.data(), srcs.size()); }
+      num_edges += srcs.size();
+    }
+    return num_edges;
+  }
+
+  struct slot_t {
+    std::vector<vertex_t> srcs{};
+    std::vector<vertex_t> dsts{};
+    bool ready{false};
+  };
+
+  size_t window = 2 * num_threads;
+  std::vector<slot_t> slots(window);
+  std::mutex mutex{};
+  std::condition_variable chunk_ready{};
+  std::condition_variable slot_free{};
+  size_t next_chunk{0};
+  size_t num_consumed{0};
+  bool abort{false};
+  std::exception_ptr error{};
+
+  auto fail = [&](std::exception_ptr e) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!error) { error = e; }
+    abort = true;
+    chunk_ready.notify_all();
+    slot_free.notify_all();
+  };
+
+  std::vector<std::thread> workers{};
+  workers.reserve(num_threads);
+  for (size_t t = 0; t < num_threads; ++t) {
+    workers.emplace_back([&]() {
+      while (true) {
+        size_t chunk{};
+        {
+          std::unique_lock<std::mutex> lock(mutex);
+          slot_free.wait(lock, [&]() {
+            return abort || (next_chunk >= num_chunks) || (next_chunk < num_consumed + window);
+          });
+          if (abort || (next_chunk >= num_chunks)) { return; }
+          chunk = next_chunk++;
+        }
+        auto& slot = slots[chunk % window];
+        try {
+          generate_chunk(chunk, slot.srcs, slot.dsts);
+        } catch (...) {
+          fail(std::current_exception());
+          return;
+        }
+        {
+          std::lock_guard<std::mutex> lock(mutex);
+          slot.ready = true;
+        }
+        chunk_ready.notify_one();
+      }
+    });
+  }
+
+  for (size_t chunk = 0; chunk < num_chunks; ++chunk) {
+    auto& slot = slots[chunk % window];
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      chunk_ready.wait(lock, [&]() { return abort || slot.ready; });
+      if (abort) { break; }
+    }
+    try {
+      if (!slot.srcs.empty()) { consumer(slot.srcs.data(), slot.dsts.data(), slot.srcs.size()); }
+    } catch (...) {
+      fail(std::current_exception());
+      break;
+    }
+    num_edges += slot.srcs.size();
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      slot.ready = false;
+      ++num_consumed;
+    }
+    slot_free.notify_all();
+  }
+
+  for (auto& worker : workers) {
+    worker.join();
+  }
+  if (error) { std::rethrow_exception(error); }
+
+  return num_edges;
+}
+
+template <typename vertex_t>
+void host_check_scale(size_t scale)
+{
+  CUGRAPH_EXPECTS(
+    (scale < std::numeric_limits<uint64_t>::digits) &&
+      ((uint64_t{1} << scale) <= static_cast<uint64_t>(std::numeric_limits<vertex_t>::max())),
+    "Invalid input argument: scale too large for vertex_t.");
+}
+
+inline void host_check_rmat_parameters(double a, double b, double c)
+{
+  CUGRAPH_EXPECTS((a >= 0.0) && (b >= 0.0) && (c >= 0.0) && (a + b + c <= 1.0),
+                  "Invalid input argument: a, b, c should be non-negative and a + b + c should not "
+                  "be larger than 1.0.");
+}
+
+// cumulative quadrant thresholds of one R-mat level, scaled to 32 bit integers
+struct host_rmat_level_t {
+  uint64_t a_threshold;
+  uint64_t ab_threshold;
+  uint64_t abc_threshold;
+};
+
+inline std::vector<host_rmat_level_t> host_rmat_levels(
+  size_t num_levels, double a, double b, double c, double noise, uint64_t seed)
+{
+  double d = 1.0 - (a + b + c);
+  CUGRAPH_EXPECTS((noise >= 0.0) && (noise <= std::min({(a + d) / 2.0, b, c})),
+                  "Invalid input argument: noise should be in [0, min((a + d) / 2, b, c)].");
+
+  // the noise stream is keyed separately from the per edge streams
+  host_generator_rng_t rng(host_generator_mix(seed) ^ uint64_t{0x6e6f697365}, 0);
+  std::vector<host_rmat_level_t> levels(num_levels);
+  for (auto& level : levels) {
+    double la{a}, lb{b}, lc{c};
+    if (noise > 0.0) {
+      double mu = noise * (2.0 * rng.uniform_positive_real() - 1.0);
+      la        = a - 2.0 * mu * a / (a + d);
+      lb        = b + mu;
+      lc        = c + mu;
+    }
+    auto scaled = [](double x) {
+      return static_cast<uint64_t>(std::min(std::max(x, 0.0), 1.0) * 0x1.0p32);
+    };
+    level.a_threshold   = scaled(la);
+    level.ab_threshold  = scaled(la + lb);
+    level.abc_threshold = scaled(la + lb + lc);
+  }
+  return levels;
+}
+
+// quadrant of one R-mat level for a 32 bit uniform draw r: returns (src bit, dst bit). Branch
+// free, the quadrants are close to equally likely and would defeat the branch predictor.
+inline std::tuple<uint64_t, uint64_t> host_rmat_quadrant(host_rmat_level_t const& level,
+                                                         uint64_t r)
+{
+  uint64_t quadrant = static_cast<uint64_t>(r >= level.a_threshold) +
+                      static_cast<uint64_t>(r >= level.ab_threshold) +
+                      static_cast<uint64_t>(r >= level.abc_threshold);
+  return {quadrant >> 1, quadrant & 1};
+}
+
+/**
+ * Seed dependent bijection on [0, 2^scale): odd multipliers and xor-shifts are both invertible
+ * modulo 2^scale.
+ */
+class host_vertex_scrambler_t {
+ public:
+  host_vertex_scrambler_t(size_t scale, uint64_t seed)
+    : mask_{scale >= 64 ? ~uint64_t{0} : (uint64_t{1} << scale) - 1},
+      shift_{std::max(size_t{1}, (scale + 1) / 2)}
+  {
+    host_generator_rng_t rng(host_generator_mix(seed) ^ uint64_t{0x736372616d626c65}, 0);
+    for (auto& key : keys_) {
+      key = rng.next();
+    }
+    keys_[0] |= 1;
+    keys_[2] |= 1;
+  }
+
+  uint64_t operator()(uint64_t v) const
+  {
+    v = (v * keys_[0] + keys_[1]) & mask_;
+    v ^= v >> shift_;
+    v = (v * keys_[2] + keys_[3]) & mask_;
+    v ^= v >> shift_;
+    return v;
+  }
+
+ private:
+  uint64_t mask_;
+  uint64_t shift_;
+  std::array<uint64_t, 4> keys_{};
+};
+
+// offset of the first pair of row u in the row-major upper triangle of an n x n matrix
+inline uint64_t host_gnp_row_offset(uint64_t n, uint64_t u)
+{
+  uint64_t x = u;
+  uint64_t y = 2 * n - u - 1;
+  return (x % 2 == 0) ? (x / 2) * y : x * (y / 2);
+}
+
+}  // namespace detail
+
+template <typename vertex_t>
+size_t host_generate_rmat_edgelist(size_t scale,
+                                   size_t num_edges,
+                                   host_edgelist_consumer_t<vertex_t> const& consumer,
+                                   double a,
+                                   double b,
+                                   double c,
+                                   double noise,
+                                   uint64_t seed,
+                                   bool clip_and_flip,
+                                   bool scramble_vertex_ids,
+                                   host_generator_options_t options)
+{
+  detail::host_check_scale<vertex_t>(scale);
+  detail::host_check_rmat_parameters(a, b, c);
+  CUGRAPH_EXPECTS(options.edges_per_chunk > 0,
+                  "Invalid input argument: edges_per_chunk should be positive.");
+
+  auto levels = detail::host_rmat_levels(scale, a, b, c, noise, seed);
+  detail::host_vertex_scrambler_t scrambler(scale, seed);
+
+  auto generate_chunk = [&](size_t chunk,
+                            std::vector<vertex_t>& srcs,
+                            std::vector<vertex_t>& dsts) {
+    size_t first = chunk * options.edges_per_chunk;
+    size_t last  = std::min(num_edges, first + options.edges_per_chunk);
+    srcs.resize(last - first);
+    dsts.resize(last - first);
+    for (size_t i = first; i < last; ++i) {
+      detail::host_generator_rng_t rng(seed, i);
+      uint64_t src{0};
+      uint64_t dst{0};
+      bool on_diagonal{true};
+      uint64_t bits{0};
+      for (size_t l = 0; l < scale; ++l) {
+        // two 32 bit draws per 64 bit random number
+        if (l % 2 == 0) { bits = rng.next(); }
+        auto [src_bit, dst_bit] = detail::host_rmat_quadrant(levels[l], bits & 0xffffffff);
+        bits >>= 32;
+        if (clip_and_flip && on_diagonal && (src_bit == 0) && (dst_bit == 1)) {
+          src_bit = 1;
+          dst_bit = 0;
+        }
+        on_diagonal = on_diagonal && (src_bit == dst_bit);
+        src         = (src << 1) | src_bit;
+        dst         = (dst << 1) | dst_bit;
+      }
+      if (scramble_vertex_ids) {
+        src = scrambler(src);
+        dst = scrambler(dst);
+      }
+      srcs[i - first] = static_cast<vertex_t>(src);
+      dsts[i - first] = static_cast<vertex_t>(dst);
+    }
+  };
+
+  return detail::host_stream_chunks<vertex_t>(
+    (num_edges + options.edges_per_chunk - 1) / options.edges_per_chunk,
+    generate_chunk,
+    consumer,
+    options);
+}
+
+template <typename vertex_t>
+size_t host_generate_bipartite_rmat_edgelist(size_t src_scale,
+                                             size_t dst_scale,
+                                             size_t num_edges,
+                                             host_edgelist_consumer_t<vertex_t> const& consumer,
+                                             double a,
+                                             double b,
+                                             double c,
+                                             uint64_t seed,
+                                             host_generator_options_t options)
+{
+  detail::host_check_scale<vertex_t>(src_scale);
+  detail::host_check_scale<vertex_t>(dst_scale);
+  detail::host_check_rmat_parameters(a, b, c);
+  CUGRAPH_EXPECTS(options.edges_per_chunk > 0,
+                  "Invalid input argument: edges_per_chunk should be positive.");
+
+  auto num_levels = std::max(src_scale, dst_scale);
+  auto levels     = detail::host_rmat_levels(num_levels, a, b, c, 0.0, seed);
+
+  auto generate_chunk = [&](size_t chunk,
+                            std::vector<vertex_t>& srcs,
+                            std::vector<vertex_t>& dsts) {
+    size_t first = chunk * options.edges_per_chunk;
+    size_t last  = std::min(num_edges, first + options.edges_per_chunk);
+    srcs.resize(last - first);
+    dsts.resize(last - first);
+    for (size_t i = first; i < last; ++i) {
+      detail::host_generator_rng_t rng(seed, i);
+      uint64_t src{0};
+      uint64_t dst{0};
+      uint64_t bits{0};
+      for (size_t l = 0; l < num_levels; ++l) {
+        if (l % 2 == 0) { bits = rng.next(); }
+        auto [src_bit, dst_bit] = detail::host_rmat_quadrant(levels[l], bits & 0xffffffff);
+        bits >>= 32;
+        if (l < src_scale) { src = (src << 1) | src_bit; }
+        if (l < dst_scale) { dst = (dst << 1) | dst_bit; }
+      }
+      srcs[i - first] = static_cast<vertex_t>(src);
+      dsts[i - first] = static_cast<vertex_t>(dst);
+    }
+  };
+
+  return detail::host_stream_chunks<vertex_t>(
+    (num_edges + options.edges_per_chunk - 1) / options.edges_per_chunk,
+    generate_chunk,
+    consumer,
+    options);
+}
+
+template <typename vertex_t>
+size_t host_generate_erdos_renyi_graph_edgelist_gnp(
+  vertex_t num_vertices,
+  double p,
+  host_edgelist_consumer_t<vertex_t> const& consumer,
+  vertex_t base_vertex_id,
+  uint64_t seed,
+  host_generator_options_t options)
+{
+  CUGRAPH_EXPECTS(num_vertices >= 0,
+                  "Invalid input argument: num_vertices should be non-negative.");
+  CUGRAPH_EXPECTS((p >= 0.0) && (p <= 1.0), "Invalid input argument: p should be in [0, 1].");
+  CUGRAPH_EXPECTS((base_vertex_id >= 0) && (num_vertices <= std::numeric_limits<vertex_t>::max() -
+                                                              base_vertex_id),
+                  "Invalid input argument: vertex IDs overflow vertex_t.");
+  CUGRAPH_EXPECTS(options.edges_per_chunk > 0,
+                  "Invalid input argument: edges_per_chunk should be positive.");
+
+  uint64_t n = static_cast<uint64_t>(num_vertices);
+  if ((n < 2) || (p == 0.0)) { return 0; }
+
+  // the pair space is cut into blocks holding host_gnp_expected_edges_per_block selected pairs on
+  // average, each block draws from its own stream. A delivered chunk is a run of whole blocks.
+  uint64_t num_pairs = detail::host_gnp_row_offset(n, n - 1);
+  double block_pairs =
+    std::ceil(static_cast<double>(detail::host_gnp_expected_edges_per_block) / p);
+  uint64_t pairs_per_block =
+    block_pairs >= static_cast<double>(num_pairs) ? num_pairs : static_cast<uint64_t>(block_pairs);
+  uint64_t num_blocks = (num_pairs - 1) / pairs_per_block + 1;
+  uint64_t blocks_per_chunk =
+    std::max(size_t{1}, options.edges_per_chunk / (2 * detail::host_gnp_expected_edges_per_block));
+  double log_q = std::log1p(-p);
+
+  auto generate_chunk = [&](size_t chunk,
+                            std::vector<vertex_t>& srcs,
+                            std::vector<vertex_t>& dsts) {
+    srcs.clear();
+    dsts.clear();
+    uint64_t first_block = chunk * blocks_per_chunk;
+    uint64_t last_block  = std::min(num_blocks, first_block + blocks_per_chunk);
+    for (auto block = first_block; block < last_block; ++block) {
+      detail::host_generator_rng_t rng(seed, block);
+      uint64_t first_pair = block * pairs_per_block;
+      uint64_t last_pair  = std::min(num_pairs, first_pair + pairs_per_block);
+
+      // row u of the upper triangle holds the pairs (u, u + 1), ..., (u, n - 1)
+      auto u = static_cast<uint64_t>(
+        std::max(0.0,
+                 std::floor((2.0 * n - 1.0 - std::sqrt((2.0 * n - 1.0) * (2.0 * n - 1.0) -
+                                                       8.0 * static_cast<double>(first_pair))) /
+                            2.0)));
+      u = std::min(u, n - 2);
+      while ((u > 0) && (detail::host_gnp_row_offset(n, u) > first_pair)) {
+        --u;
+      }
+      while (detail::host_gnp_row_offset(n, u + 1) <= first_pair) {
+        ++u;
+      }
+      uint64_t row_first = detail::host_gnp_row_offset(n, u);
+      uint64_t row_last  = row_first + (n - 1 - u);
+
+      uint64_t pair = first_pair;
+      while (true) {
+        if (p < 1.0) {
+          double skip = std::floor(std::log(rng.uniform_positive_real()) / log_q);
+          if (skip >= static_cast<double>(last_pair - pair)) { break; }
+          pair += static_cast<uint64_t>(skip);
+        }
+        if (pair >= last_pair) { break; }
+        while (pair >= row_last) {
+          ++u;
+          row_first = row_last;
+          row_last += n - 1 - u;
+        }
+        auto src = static_cast<vertex_t>(base_vertex_id + u);
+        auto dst = static_cast<vertex_t>(base_vertex_id + u + 1 + (pair - row_first));
+        srcs.push_back(src);
+        dsts.push_back(dst);
+        srcs.push_back(dst);
+        dsts.push_back(src);
+        ++pair;
+      }
+    }
+  };
+
+  return detail::host_stream_chunks<vertex_t>(
+    (num_blocks + blocks_per_chunk - 1) / blocks_per_chunk, generate_chunk, consumer, options);
+}
+
+namespace detail {
+
+/**
+ * Streams the edges of a sequence of mesh components. Each component's edges are numbered
+ * consecutively and decode_edge(component, e) returns the e'th edge of a component.
+ */
+template <typename vertex_t, typename component_t, typename count_t, typename decode_t>
+size_t host_stream_mesh_edgelist(std::vector<component_t> const& components,
+                                 count_t count_edges,
+                                 decode_t decode_edge,
+                                 host_edgelist_consumer_t<vertex_t> const& consumer,
+                                 host_generator_options_t const& options)
+{
+  CUGRAPH_EXPECTS(options.edges_per_chunk > 0,
+                  "Invalid input argument: edges_per_chunk should be positive.");
+
+  std::vector<size_t> offsets(components.size() + 1, 0);
+  for (size_t i = 0; i < components.size(); ++i) {
+    offsets[i + 1] = offsets[i] + count_edges(components[i]);
+  }
+  size_t num_edges = offsets.back();
+
+  auto generate_chunk = [&](size_t chunk,
+                            std::vector<vertex_t>& srcs,
+                            std::vector<vertex_t>& dsts) {
+    size_t first = chunk * options.edges_per_chunk;
+    size_t last  = std::min(num_edges, first + options.edges_per_chunk);
+    srcs.resize(last - first);
+    dsts.resize(last - first);
+    size_t component =
+      std::upper_bound(offsets.begin(), offsets.end(), first) - offsets.begin() - 1;
+    for (size_t i = first; i < last; ++i) {
+      while (i >= offsets[component + 1]) {
+        ++component;
+      }
+      std::tie(srcs[i - first], dsts[i - first]) =
+        decode_edge(components[component], i - offsets[component]);
+    }
+  };
+
+  return host_stream_chunks<vertex_t>(
+    (num_edges + options.edges_per_chunk - 1) / options.edges_per_chunk,
+    generate_chunk,
+    consumer,
+    options);
+}
+
+}  // namespace detail
+
+template <typename vertex_t>
+size_t host_generate_2d_mesh_graph_edgelist(
+  std::vector<std::tuple<vertex_t, vertex_t, vertex_t>> const& component_parameters_v,
+  host_edgelist_consumer_t<vertex_t> const& consumer,
+  host_generator_options_t options)
+{
+  for (auto [x, y, base] : component_parameters_v) {
+    CUGRAPH_EXPECTS((x > 0) && (y > 0) && (base >= 0),
+                    "Invalid input argument: mesh dimensions should be positive.");
+  }
+
+  // edges along x first, then edges along y
+  return detail::host_stream_mesh_edgelist<vertex_t>(
+    component_parameters_v,
+    [](auto const& p) {
+      auto [x, y, base] = p;
+      return static_cast<size_t>(x - 1) * y + static_cast<size_t>(x) * (y - 1);
+    },
+    [](auto const& p, size_t e) {
+      auto [x, y, base] = p;
+      size_t num_x_edges = static_cast<size_t>(x - 1) * y;
+      if (e < num_x_edges) {
+        auto v = static_cast<vertex_t>(base + (e / (x - 1)) * x + e % (x - 1));
+        return std::make_tuple(v, static_cast<vertex_t>(v + 1));
+      }
+      auto v = static_cast<vertex_t>(base + (e - num_x_edges));
+      return std::make_tuple(v, static_cast<vertex_t>(v + x));
+    },
+    consumer,
+    options);
+}
+
+template <typename vertex_t>
+size_t host_generate_3d_mesh_graph_edgelist(
+  std::vector<std::tuple<vertex_t, vertex_t, vertex_t, vertex_t>> const& component_parameters_v,
+  host_edgelist_consumer_t<vertex_t> const& consumer,
+  host_generator_options_t options)
+{
+  for (auto [x, y, z, base] : component_parameters_v) {
+    CUGRAPH_EXPECTS((x > 0) && (y > 0) && (z > 0) && (base >= 0),
+                    "Invalid input argument: mesh dimensions should be positive.");
+  }
+
+  // edges along x first, then edges along y, then edges along z
+  return detail::host_stream_mesh_edgelist<vertex_t>(
+    component_parameters_v,
+    [](auto const& p) {
+      auto [x, y, z, base] = p;
+      return static_cast<size_t>(x - 1) * y * z + static_cast<size_t>(x) * (y - 1) * z +
+             static_cast<size_t>(x) * y * (z - 1);
+    },
+    [](auto const& p, size_t e) {
+      auto [x, y, z, base] = p;
+      size_t plane         = static_cast<size_t>(x) * y;
+      size_t num_x_edges   = static_cast<size_t>(x - 1) * y * z;
+      size_t num_y_edges   = static_cast<size_t>(x) * (y - 1) * z;
+      if (e < num_x_edges) {
+        size_t row = e / (x - 1);
+        auto v     = static_cast<vertex_t>(base + row * x + e % (x - 1));
+        return std::make_tuple(v, static_cast<vertex_t>(v + 1));
+      }
+      e -= num_x_edges;
+      if (e < num_y_edges) {
+        size_t layer = e / (plane - x);
+        auto v       = static_cast<vertex_t>(base + layer * plane + e % (plane - x));
+        return std::make_tuple(v, static_cast<vertex_t>(v + x));
+      }
+      e -= num_y_edges;
+      auto v = static_cast<vertex_t>(base + e);
+      return std::make_tuple(v, static_cast<vertex_t>(v + plane));
+    },
+    consumer,
+    options);
+}
+
+template <typename vertex_t>
+host_edgelist_file_writer_t<vertex_t>::host_edgelist_file_writer_t(
+  std::string const& path, host_edgelist_file_format_t format, vertex_t num_vertices)
+  : format_{format}, num_vertices_{num_vertices}
+{
+  static_assert(std::is_integral_v<vertex_t>);
+  CUGRAPH_EXPECTS(num_vertices >= 0,
+                  "Invalid input argument: num_vertices should be non-negative.");
+
+  file_ = std::fopen(path.c_str(), "wb");
+  CUGRAPH_EXPECTS(file_ != nullptr, "Could not open %s for writing.", path.c_str());
+  buffer_.resize(detail::host_edgelist_file_buffer_size);
+
+  if (format_ == host_edgelist_file_format_t::BINARY) {
+    char header[32]{};
+    uint32_t version     = detail::host_binary_edgelist_version;
+    uint32_t vertex_size = sizeof(vertex_t);
+    uint64_t nv          = static_cast<uint64_t>(num_vertices);
+    std::memcpy(header, detail::host_binary_edgelist_magic, 8);
+    std::memcpy(header + 8, &version, 4);
+    std::memcpy(header + 12, &vertex_size, 4);
+    std::memcpy(header + 16, &nv, 8);
+    std::memcpy(buffer_.data(), header, sizeof(header));
+    buffered_ = sizeof(header);
+  } else {
+    auto nv            = std::to_string(num_vertices);
+    std::string header = detail::host_matrix_market_banner + nv + " " + nv + " " +
+                         std::string(detail::host_matrix_market_count_width, ' ') + "\n";
+    std::memcpy(buffer_.data(), header.data(), header.size());
+    buffered_ = header.size();
+  }
+}
+
+template <typename vertex_t>
+host_edgelist_file_writer_t<vertex_t>::~host_edgelist_file_writer_t()
+{
+  if (file_ != nullptr) {
+    try {
+      close();
+    } catch (...) {
+      if (file_ != nullptr) { std::fclose(file_); }
+    }
+  }
+}
+
+template <typename vertex_t>
+void host_edgelist_file_writer_t<vertex_t>::append(vertex_t const* srcs,
+                                                   vertex_t const* dsts,
+                                                   size_t num_edges)
+{
+  CUGRAPH_EXPECTS(file_ != nullptr, "Invalid call: the edge list file is closed.");
+
+  // widest possible "<src> <dst>\n" line, 1-based IDs never need a sign
+  constexpr size_t max_field_size = std::numeric_limits<vertex_t>::digits10 + 1;
+  constexpr size_t max_line_size  = 2 * max_field_size + 2;
+
+  char* buffer = buffer_.data();
+  for (size_t i = 0; i < num_edges; ++i) {
+    CUGRAPH_EXPECTS((srcs[i] >= 0) && (srcs[i] < num_vertices_) && (dsts[i] >= 0) &&
+                      (dsts[i] < num_vertices_),
+                    "Invalid input argument: vertex ID out of range.");
+    if (buffered_ + max_line_size > buffer_.size()) { flush(); }
+    if (format_ == host_edgelist_file_format_t::BINARY) {
+      std::memcpy(buffer + buffered_, srcs + i, sizeof(vertex_t));
+      std::memcpy(buffer + buffered_ + sizeof(vertex_t), dsts + i, sizeof(vertex_t));
+      buffered_ += 2 * sizeof(vertex_t);
+    } else {
+      char* first = buffer + buffered_;
+      char* last  = std::to_chars(first, first + max_field_size, srcs[i] + 1).ptr;
+      *last++     = ' ';
+      last        = std::to_chars(last, last + max_field_size, dsts[i] + 1).ptr;
+      *last++     = '\n';
+      buffered_ += static_cast<size_t>(last - first);
+    }
+  }
+  num_edges_ += num_edges;
+}
+
+template <typename vertex_t>
+void host_edgelist_file_writer_t<vertex_t>::flush()
+{
+  CUGRAPH_EXPECTS(std::fwrite(buffer_.data(), 1, buffered_, file_) == buffered_,
+                  "Failed to write the edge list file.");
+  buffered_ = 0;
+}
+
+template <typename vertex_t>
+void host_edgelist_file_writer_t<vertex_t>::close()
+{
+  if (file_ == nullptr) { return; }
+
+  bool ok   = std::fwrite(buffer_.data(), 1, buffered_, file_) == buffered_;
+  buffered_ = 0;
+
+  if (format_ == host_edgelist_file_format_t::BINARY) {
+    uint64_t ne = num_edges_;
+    ok = ok && (std::fseek(file_, 24, SEEK_SET) == 0) &&
+         (std::fwrite(&ne, sizeof(ne), 1, file_) == 1);
+  } else {
+    // the edge count field starts right after "<banner>\n<n> <n> "
+    auto nv    = std::to_string(num_vertices_);
+    auto count = std::to_string(num_edges_);
+    auto count_offset =
+      std::strlen(detail::host_matrix_market_banner) + 2 * (nv.size() + 1);
+    ok = ok && (std::fseek(file_, static_cast<long>(count_offset), SEEK_SET) == 0) &&
+         (std::fwrite(count.data(), 1, count.size(), file_) == count.size());
+  }
+  ok    = (std::fclose(file_) == 0) && ok;
+  file_ = nullptr;
+  CUGRAPH_EXPECTS(ok, "Failed to write the edge list file.");
+}
+
+template <typename vertex_t>
+std::tuple<vertex_t, size_t> host_read_binary_edgelist_file(
+  std::string const& path,
+  host_edgelist_consumer_t<vertex_t> const& consumer,
+  size_t edges_per_chunk)
+{
+  CUGRAPH_EXPECTS(edges_per_chunk > 0,
+                  "Invalid input argument: edges_per_chunk should be positive.");
+
+  std::unique_ptr<std::FILE, int (*)(std::FILE*)> file(std::fopen(path.c_str(), "rb"),
+                                                      &std::fclose);
+  CUGRAPH_EXPECTS(file != nullptr, "Could not open %s for reading.", path.c_str());
+
+  char header[32];
+  CUGRAPH_EXPECTS(std::fread(header, 1, sizeof(header), file.get()) == sizeof(header),
+                  "%s is not a binary edge list file.",
+                  path.c_str());
+  uint32_t version{};
+  uint32_t vertex_size{};
+  uint64_t nv{};
+  uint64_t ne{};
+  std::memcpy(&version, header + 8, 4);
+  std::memcpy(&vertex_size, header + 12, 4);
+  std::memcpy(&nv, header + 16, 8);
+  std::memcpy(&ne, header + 24, 8);
+  CUGRAPH_EXPECTS(std::memcmp(header, detail::host_binary_edgelist_magic, 8) == 0 &&
+                    version == detail::host_binary_edgelist_version,
+                  "%s is not a binary edge list file.",
+                  path.c_str());
+  CUGRAPH_EXPECTS(vertex_size == sizeof(vertex_t),
+                  "%s stores %u byte vertex IDs, vertex_t mismatch.",
+                  path.c_str(),
+                  vertex_size);
+
+  std::vector<vertex_t> pairs{};
+  std::vector<vertex_t> srcs{};
+  std::vector<vertex_t> dsts{};
+  for (uint64_t first = 0; first < ne; first += edges_per_chunk) {
+    size_t count = static_cast<size_t>(std::min<uint64_t>(edges_per_chunk, ne - first));
+    pairs.resize(2 * count);
+    CUGRAPH_EXPECTS(std::fread(pairs.data(), sizeof(vertex_t), 2 * count, file.get()) == 2 * count,
+                    "%s is truncated.",
+                    path.c_str());
+    srcs.resize(count);
+    dsts.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+      srcs[i] = pairs[2 * i];
+      dsts[i] = pairs[2 * i + 1];
+    }
+    consumer(srcs.data(), dsts.data(), count);
+  }
+
+  return std::make_tuple(static_cast<vertex_t>(nv), static_cast<size_t>(ne));
+}
+
+template size_t host_generate_rmat_edgelist<int32_t>(size_t,
+                                                     size_t,
+                                                     host_edgelist_consumer_t<int32_t> const&,
+                                                     double,
+                                                     double,
+                                                     double,
+                                                     double,
+                                                     uint64_t,
+                                                     bool,
+                                                     bool,
+                                                     host_generator_options_t);
+
+template size_t host_generate_rmat_edgelist<int64_t>(size_t,
+                                                     size_t,
+                                                     host_edgelist_consumer_t<int64_t> const&,
+                                                     double,
+                                                     double,
+                                                     double,
+                                                     double,
+                                                     uint64_t,
+                                                     bool,
+                                                     bool,
+                                                     host_generator_options_t);
+
+template size_t host_generate_bipartite_rmat_edgelist<int32_t>(
+  size_t,
+  size_t,
+  size_t,
+  host_edgelist_consumer_t<int32_t> const&,
+  double,
+  double,
+  double,
+  uint64_t,
+  host_generator_options_t);
+
+template size_t host_generate_bipartite_rmat_edgelist<int64_t>(
+  size_t,
+  size_t,
+  size_t,
+  host_edgelist_consumer_t<int64_t> const&,
+  double,
+  double,
+  double,
+  uint64_t,
+  host_generator_options_t);
+
+template size_t host_generate_erdos_renyi_graph_edgelist_gnp<int32_t>(
+  int32_t,
+  double,
+  host_edgelist_consumer_t<int32_t> const&,
+  int32_t,
+  uint64_t,
+  host_generator_options_t);
+
+template size_t host_generate_erdos_renyi_graph_edgelist_gnp<int64_t>(
+  int64_t,
+  double,
+  host_edgelist_consumer_t<int64_t> const&,
+  int64_t,
+  uint64_t,
+  host_generator_options_t);
+
+template size_t host_generate_2d_mesh_graph_edgelist<int32_t>(
+  std::vector<std::tuple<int32_t, int32_t, int32_t>> const&,
+  host_edgelist_consumer_t<int32_t> const&,
+  host_generator_options_t);
+
+template size_t host_generate_2d_mesh_graph_edgelist<int64_t>(
+  std::vector<std::tuple<int64_t, int64_t, int64_t>> const&,
+  host_edgelist_consumer_t<int64_t> const&,
+  host_generator_options_t);
+
+template size_t host_generate_3d_mesh_graph_edgelist<int32_t>(
+  std::vector<std::tuple<int32_t, int32_t, int32_t, int32_t>> const&,
+  host_edgelist_consumer_t<int32_t> const&,
+  host_generator_options_t);
+
+template size_t host_generate_3d_mesh_graph_edgelist<int64_t>(
+  std::vector<std::tuple<int64_t, int64_t, int64_t, int64_t>> const&,
+  host_edgelist_consumer_t<int64_t> const&,
+  host_generator_options_t);
+
+template class host_edgelist_file_writer_t<int32_t>;
+template class host_edgelist_file_writer_t<int64_t>;
+
+template std::tuple<int32_t, size_t> host_read_binary_edgelist_file<int32_t>(
+  std::string const&, host_edgelist_consumer_t<int32_t> const&, size_t);
+
+template std::tuple<int64_t, size_t> host_read_binary_edgelist_file<int64_t>(
+  std::string const&, host_edgelist_consumer_t<int64_t> const&, size_t);
+
+}  // namespace cugraph
@@ -0,0 +1,669 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cugraph/graph.hpp>
+#include <cugraph/host_src_dst_lookup_container.hpp>
+#include <cugraph/utilities/error.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <exception>
+#include <limits>
+#include <optional>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+namespace cugraph {
+
+namespace detail {
+
+// a thread gets at least this many items, smaller loops run on fewer threads
+constexpr size_t host_lookup_min_items_per_thread{size_t{1} << 16};
+
+// the position of every host_lookup_select_sample_rate-th zero of the Elias-Fano upper bits is
+// sampled, select0 scans at most that many zeros from a sample
+constexpr size_t host_lookup_select_sample_rate{256};
+
+constexpr size_t host_lookup_not_found{std::numeric_limits<size_t>::max()};
+
+inline size_t host_lookup_num_threads(size_t num_threads)
+{
+  if (num_threads == 0) {
+    num_threads = std::max(size_t{1}, static_cast<size_t>(std::thread::hardware_concurrency()));
+  }
+  return num_threads;
+}
+
+/**
+ * Runs f(part) for part in [0, num_parts) on up to num_parts threads, rethrowing the first
+ * exception.
+ */
+template <typename f_t>
+void host_lookup_parallel_parts(size_t num_parts, f_t f)
+{
+  if (num_parts <= 1) {
+    if (num_parts == 1) { f(size_t{0}); }
+    return;
+  }
+  std::vector<std::exception_ptr> errors(num_parts);
+  std::vector<std::thread> threads{};
+  threads.reserve(num_parts - 1);
+  for (size_t part = 1; part < num_parts; ++part) {
+    threads.emplace_back([&, part]() {
+      try {
+        f(part);
+      } catch (...) {
+        errors[part] = std::current_exception();
+      }
+    });
+  }
+  try {
+    f(size_t{0});
+  } catch (...) {
+    errors[0] = std::current_exception();
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (auto& error : errors) {
+    if (error) { std::rethrow_exception(error); }
+  }
+}
+
+// Splits [0, n) into one range per thread and runs f(part, begin, end) on each
+template <typename f_t>
+size_t host_lookup_parallel_for(size_t n, size_t num_threads, f_t f)
+{
+  auto num_parts = std::max(
+    size_t{1},
+    std::min(num_threads,
+             (n + host_lookup_min_items_per_thread - 1) / host_lookup_min_items_per_thread));
+  host_lookup_parallel_parts(num_parts, [&](size_t part) {
+    f(part, (n * part) / num_parts, (n * (part + 1)) / num_parts);
+  });
+  return num_parts;
+}
+
+// Sorts runs in parallel, then merges pairs of runs in parallel
+template <typename T, typename comp_t>
+void host_lookup_parallel_sort(std::vector<T>& values, comp_t comp, size_t num_threads)
+{
+  auto n         = values.size();
+  auto num_parts = std::max(size_t{1}, std::min(num_threads, n / host_lookup_min_items_per_thread));
+  std::vector<size_t> bounds(num_parts + 1);
+  for (size_t part = 0; part <= num_parts; ++part) {
+    bounds[part] = (n * part) / num_parts;
+  }
+  host_lookup_parallel_parts(num_parts, [&](size_t part) {
+    std::sort(values.begin() + bounds[part], values.begin() + bounds[part + 1], comp);
+  });
+
+  std::vector<T> buffer(num_parts > 1 ? n : size_t{0});
+  while (bounds.size() > 2) {
+    auto num_runs = bounds.size() - 1;
+    host_lookup_parallel_parts((num_runs + 1) / 2, [&](size_t pair) {
+      auto first = bounds[2 * pair];
+      auto mid   = bounds[std::min(2 * pair + 1, num_runs)];
+      auto last  = bounds[std::min(2 * pair + 2, num_runs)];
+      std::merge(values.begin() + first,
+                 values.begin() + mid,
+                 values.begin() + mid,
+                 values.begin() + last,
+                 buffer.begin() + first,
+                 comp);
+    });
+    std::vector<size_t> merged_bounds{};
+    for (size_t i = 0; i < bounds.size(); i += 2) {
+      merged_bounds.push_back(bounds[i]);
+    }
+    if (merged_bounds.back() != n) { merged_bounds.push_back(n); }
+    bounds = std::move(merged_bounds);
+    values.swap(buffer);
+  }
+}
+
+// position of the r-th set bit of word (r < popcount(word))
+inline int host_lookup_select_in_word(uint64_t word, size_t r)
+{
+  for (size_t i = 0; i < r; ++i) {
+    word &= word - 1;
+  }
+  return __builtin_ctzll(word);
+}
+
+/**
+ * Elias-Fano code of a strictly increasing sequence of values in [0, universe). Value i is split
+ * into its lower_bits_ low bits, stored packed, and its high part h, stored as a one at position
+ * i + h of the upper bit vector. The values with high part h are thus the ones between the
+ * (h - 1)-th and the h-th zero of the upper bits.
+ */
+class host_lookup_elias_fano_t {
+ public:
+  template <typename value_of_t>
+  host_lookup_elias_fano_t(size_t size, uint64_t universe, value_of_t value_of, size_t num_threads)
+    : size_(size)
+  {
+    if (size == 0) { return; }
+    while ((universe >> (lower_bits_ + 1)) >= size) {
+      ++lower_bits_;
+    }
+    auto lower_mask = (uint64_t{1} << lower_bits_) - 1;
+
+    // lower bits, 64 values (lower_bits_ words) per block so blocks never share words
+    if (lower_bits_ > 0) {
+      lower_.assign((size * lower_bits_ + 63) / 64 + 1, uint64_t{0});
+      auto num_blocks = (size + 63) / 64;
+      host_lookup_parallel_for(
+        num_blocks * 64, num_threads, [&](size_t, size_t first, size_t last) {
+          for (size_t i = ((first + 63) / 64) * 64; i < std::min(((last + 63) / 64) * 64, size);
+               ++i) {
+            auto bit   = i * lower_bits_;
+            auto value = value_of(i) & lower_mask;
+            lower_[bit / 64] |= value << (bit % 64);
+            if ((bit % 64) + lower_bits_ > 64) { lower_[bit / 64 + 1] |= value >> (64 - bit % 64); }
+          }
+        });
+    }
+
+    // upper bits, the first and last words of each part may be shared with the neighbours
+    upper_size_ = size + ((universe - 1) >> lower_bits_) + 1;
+    upper_.assign((upper_size_ + 63) / 64, uint64_t{0});
+    std::vector<std::tuple<size_t, uint64_t, size_t, uint64_t>> boundaries(num_threads);
+    auto num_parts = host_lookup_parallel_for(size, num_threads, [&](size_t part,
+                                                                     size_t first,
+                                                                     size_t last) {
+      if (first == last) { return; }
+      auto first_word = (first + (value_of(first) >> lower_bits_)) / 64;
+      auto last_word  = (last - 1 + (value_of(last - 1) >> lower_bits_)) / 64;
+      uint64_t first_bits{0};
+      uint64_t last_bits{0};
+      for (size_t i = first; i < last; ++i) {
+        auto position = i + (value_of(i) >> lower_bits_);
+        auto word     = position / 64;
+        auto bit      = uint64_t{1} << (position % 64);
+        if (word == first_word) {
+          first_bits |= bit;
+        } else if (word == last_word) {
+          last_bits |= bit;
+        } else {
+          upper_[word] |= bit;
+        }
+      }
+      boundaries[part] = std::make_tuple(first_word, first_bits, last_word, last_bits);
+    });
+    for (size_t part = 0; part < num_parts; ++part) {
+      auto [first_word, first_bits, last_word, last_bits] = boundaries[part];
+      upper_[first_word] |= first_bits;
+      upper_[last_word] |= last_bits;
+    }
+
+    size_t zeros{0};
+    for (size_t word = 0; word < upper_.size(); ++word) {
+      auto bits = ~upper_[word];
+      if ((word + 1) * 64 > upper_size_) { bits &= (uint64_t{1} << (upper_size_ % 64)) - 1; }
+      auto count = static_cast<size_t>(__builtin_popcountll(bits));
+      while (select_samples_.size() * host_lookup_select_sample_rate < zeros + count) {
+        auto r = select_samples_.size() * host_lookup_select_sample_rate - zeros;
+        select_samples_.push_back(word * 64 + host_lookup_select_in_word(bits, r));
+      }
+      zeros += count;
+    }
+  }
+
+  // index of value in the sequence, or host_lookup_not_found (value must be < universe)
+  size_t find(uint64_t value) const
+  {
+    if (size_ == 0) { return host_lookup_not_found; }
+    auto high  = value >> lower_bits_;
+    auto low   = value & ((uint64_t{1} << lower_bits_) - 1);
+    auto first = (high == 0 ? size_t{0} : select0(high - 1) + 1) - high;
+    auto last  = select0(high) - high;
+    while (first < last) {
+      auto mid = first + (last - first) / 2;
+      if (lower(mid) < low) {
+        first = mid + 1;
+      } else {
+        last = mid;
+      }
+    }
+    return (first < select0(high) - high && lower(first) == low) ? first : host_lookup_not_found;
+  }
+
+  size_t size_in_bytes() const
+  {
+    return (lower_.size() + upper_.size() + select_samples_.size()) * sizeof(uint64_t);
+  }
+
+ private:
+  uint64_t lower(size_t i) const
+  {
+    if (lower_bits_ == 0) { return 0; }
+    auto bit   = i * lower_bits_;
+    auto value = lower_[bit / 64] >> (bit % 64);
+    if ((bit % 64) + lower_bits_ > 64) { value |= lower_[bit / 64 + 1] << (64 - bit % 64); }
+    return value & ((uint64_t{1} << lower_bits_) - 1);
+  }
+
+  // position of the k-th zero of the upper bits
+  size_t select0(size_t k) const
+  {
+    auto sample   = k / host_lookup_select_sample_rate;
+    auto position = select_samples_[sample];
+    auto r        = k - sample * host_lookup_select_sample_rate;
+    auto word     = position / 64;
+    auto bits     = ~upper_[word] & (~uint64_t{0} << (position % 64));
+    while (true) {
+      auto count = static_cast<size_t>(__builtin_popcountll(bits));
+      if (r < count) { return word * 64 + host_lookup_select_in_word(bits, r); }
+      r -= count;
+      bits = ~upper_[++word];
+    }
+  }
+
+  size_t size_{0};
+  int lower_bits_{0};
+  size_t upper_size_{0};
+  std::vector<uint64_t> lower_{};
+  std::vector<uint64_t> upper_{};
+  std::vector<size_t> select_samples_{};
+};
+
+// Edge ids and endpoints of one edge type, in edge id order
+template <typename edge_id_t, typename vertex_t>
+struct host_lookup_type_index_t {
+  edge_id_t first_id{};
+  uint64_t universe{};
+  std::optional<host_lookup_elias_fano_t> ids{};  // std::nullopt if the ids are consecutive
+  std::vector<vertex_t> srcs{};
+  std::vector<vertex_t> dsts{};
+
+  size_t find(edge_id_t id) const
+  {
+    auto offset = static_cast<uint64_t>(id) - static_cast<uint64_t>(first_id);
+    if (offset >= universe) { return host_lookup_not_found; }
+    return ids ? ids->find(offset) : static_cast<size_t>(offset);
+  }
+};
+
+template <typename edge_id_t, typename edge_type_t, typename vertex_t>
+struct host_lookup_entry_t {
+  edge_type_t type;
+  edge_id_t id;
+  vertex_t src;
+  vertex_t dst;
+};
+
+}  // namespace detail
+
+template <typename edge_id_t, typename edge_type_t, typename vertex_t>
+template <typename _edge_id_t, typename _edge_type_t, typename _vertex_t>
+struct host_lookup_container_t<edge_id_t, edge_type_t, vertex_t>::host_lookup_container_impl {
+  std::vector<edge_type_t> types_{};  // sorted
+  std::vector<detail::host_lookup_type_index_t<edge_id_t, vertex_t>> indices_{};
+  size_t number_of_edges_{0};
+
+  host_lookup_container_impl() = default;
+
+  // edges [0, n) sorted by (type, id), accessed through type_of, id_of, src_of and dst_of
+  template <typename type_of_t, typename id_of_t, typename src_of_t, typename dst_of_t>
+  host_lookup_container_impl(size_t n,
+                             type_of_t type_of,
+                             id_of_t id_of,
+                             src_of_t src_of,
+                             dst_of_t dst_of,
+                             size_t num_threads)
+    : number_of_edges_(n)
+  {
+    std::vector<std::vector<size_t>> part_type_firsts(num_threads);
+    auto num_parts = detail::host_lookup_parallel_for(
+      n, num_threads, [&](size_t part, size_t first, size_t last) {
+        for (size_t i = first; i < last; ++i) {
+          if ((i == 0) || (type_of(i) != type_of(i - 1))) {
+            part_type_firsts[part].push_back(i);
+          } else {
+            CUGRAPH_EXPECTS(id_of(i) != id_of(i - 1),
+                            "Invalid input arguments: edge ids should be unique within each edge "
+                            "type.");
+          }
+        }
+      });
+    std::vector<size_t> type_firsts{};
+    for (size_t part = 0; part < num_parts; ++part) {
+      type_firsts.insert(
+        type_firsts.end(), part_type_firsts[part].begin(), part_type_firsts[part].end());
+    }
+    type_firsts.push_back(n);
+
+    types_.reserve(type_firsts.size() - 1);
+    indices_.reserve(type_firsts.size() - 1);
+    for (size_t t = 0; t + 1 < type_firsts.size(); ++t) {
+      auto first = type_firsts[t];
+      auto count = type_firsts[t + 1] - first;
+
+      detail::host_lookup_type_index_t<edge_id_t, vertex_t> index{};
+      index.first_id = id_of(first);
+      index.universe =
+        static_cast<uint64_t>(id_of(first + count - 1)) - static_cast<uint64_t>(index.first_id) + 1;
+      if (index.universe != count) {
+        index.ids = detail::host_lookup_elias_fano_t(
+          count,
+          index.universe,
+          [&](size_t i) {
+            return static_cast<uint64_t>(id_of(first + i)) - static_cast<uint64_t>(index.first_id);
+          },
+          num_threads);
+      }
+      index.srcs.resize(count);
+      index.dsts.resize(count);
+      detail::host_lookup_parallel_for(count, num_threads, [&](size_t, size_t b, size_t e) {
+        for (size_t i = b; i < e; ++i) {
+          index.srcs[i] = src_of(first + i);
+          index.dsts[i] = dst_of(first + i);
+        }
+      });
+      types_.push_back(type_of(first));
+      indices_.push_back(std::move(index));
+    }
+  }
+
+  detail::host_lookup_type_index_t<edge_id_t, vertex_t> const* type_index(edge_type_t type) const
+  {
+    auto it = std::lower_bound(types_.begin(), types_.end(), type);
+    return (it != types_.end() && *it == type) ? &indices_[it - types_.begin()] : nullptr;
+  }
+};
+
+template <typename edge_id_t, typename edge_type_t, typename vertex_t>
+host_lookup_container_t<edge_id_t, edge_type_t, vertex_t>::~host_lookup_container_t()
+{
+  pimpl.reset();
+}
+
+template <typename edge_id_t, typename edge_type_t, typename vertex_t>
+host_lookup_container_t<edge_id_t, edge_type_t, vertex_t>::host_lookup_container_t()
+  : pimpl{std::make_unique<host_lookup_container_impl<edge_id_t, edge_type_t, vertex_t>>()}
+{
+}
+
+template <typename edge_id_t, typename edge_type_t, typename vertex_t>
+host_lookup_container_t<edge_id_t, edge_type_t, vertex_t>::host_lookup_container_t(
+  raft::host_span<vertex_t const> srcs,
+  raft::host_span<vertex_t const> dsts,
+  raft::host_span<edge_id_t const> edge_ids,
+  std::optional<raft::host_span<edge_type_t const>> edge_types,
+  size_t num_threads)
+{
+  CUGRAPH_EXPECTS(srcs.size() == dsts.size() && srcs.size() == edge_ids.size(),
+                  "Invalid input arguments: srcs, dsts and edge_ids should have the same size.");
+  CUGRAPH_EXPECTS(!edge_types || edge_types->size() == edge_ids.size(),
+                  "Invalid input arguments: edge_types and edge_ids should have the same size.");
+
+  num_threads = detail::host_lookup_num_threads(num_threads);
+  auto n      = edge_ids.size();
+
+  auto type_of = [&](size_t i) { return edge_types ? (*edge_types)[i] : edge_type_t{0}; };
+  auto less    = [&](size_t i, size_t j) {
+    return std::make_tuple(type_of(i), edge_ids[i]) < std::make_tuple(type_of(j), edge_ids[j]);
+  };
+
+  // edge lists are often already in (type, id) order, e.g. ids assigned consecutively per type
+  std::vector<uint8_t> part_sorted(num_threads, uint8_t{1});
+  auto num_parts = detail::host_lookup_parallel_for(
+    n, num_threads, [&](size_t part, size_t first, size_t last) {
+      for (size_t i = std::max(first, size_t{1}); i < last; ++i) {
+        if (less(i, i - 1)) {
+          part_sorted[part] = 0;
+          break;
+        }
+      }
+    });
+  auto sorted = std::all_of(
+    part_sorted.begin(), part_sorted.begin() + num_parts, [](auto s) { return s != 0; });
+
+  if (sorted) {
+    pimpl = std::make_unique<host_lookup_container_impl<edge_id_t, edge_type_t, vertex_t>>(
+      n,
+      type_of,
+      [&](size_t i) { return edge_ids[i]; },
+      [&](size_t i) { return srcs[i]; },
+      [&](size_t i) { return dsts[i]; },
+      num_threads);
+  } else {
+    using entry_t = detail::host_lookup_entry_t<edge_id_t, edge_type_t, vertex_t>;
+    std::vector<entry_t> entries(n);
+    detail::host_lookup_parallel_for(n, num_threads, [&](size_t, size_t first, size_t last) {
+      for (size_t i = first; i < last; ++i) {
+        entries[i] = entry_t{type_of(i), edge_ids[i], srcs[i], dsts[i]};
+      }
+    });
+    detail::host_lookup_parallel_sort(
+      entries,
+      [](entry_t const& lhs, entry_t const& rhs) {
+        return std::make_tuple(lhs.type, lhs.id) < std::make_tuple(rhs.type, rhs.id);
+      },
+      num_threads);
+    pimpl = std::make_unique<host_lookup_container_impl<edge_id_t, edge_type_t, vertex_t>>(
+      n,
+      [&](size_t i) { return entries[i].type; },
+      [&](size_t i) { return entries[i].id; },
+      [&](size_t i) { return entries[i].src; },
+      [&](size_t i) { return entries[i].dst; },
+      num_threads);
+  }
+}
+
+template <typename edge_id_t, typename edge_type_t, typename vertex_t>
+host_lookup_container_t<edge_id_t, edge_type_t, vertex_t>::host_lookup_container_t(
+  host_lookup_container_t&& other)
+  : pimpl{std::move(other.pimpl)}
+{
+}
+
+template <typename edge_id_t, typename edge_type_t, typename vertex_t>
+host_lookup_container_t<edge_id_t, edge_type_t, vertex_t>&
+host_lookup_container_t<edge_id_t, edge_type_t, vertex_t>::operator=(
+  host_lookup_container_t&& other)
+{
+  pimpl = std::move(other.pimpl);
+  return *this;
+}
+
+template <typename edge_id_t, typename edge_type_t, typename vertex_t>
+void host_lookup_container_t<edge_id_t, edge_type_t, vertex_t>::
+  lookup_from_edge_ids_and_single_type(raft::host_span<edge_id_t const> edge_ids_to_lookup,
+                                       edge_type_t edge_type_to_lookup,
+                                       raft::host_span<vertex_t> srcs,
+                                       raft::host_span<vertex_t> dsts,
+                                       size_t num_threads) const
+{
+  CUGRAPH_EXPECTS(srcs.size() == edge_ids_to_lookup.size() &&
+                    dsts.size() == edge_ids_to_lookup.size(),
+                  "Invalid input arguments: srcs and dsts should have the size of "
+                  "edge_ids_to_lookup.");
+
+  auto index = pimpl->type_index(edge_type_to_lookup);
+  detail::host_lookup_parallel_for(
+    edge_ids_to_lookup.size(),
+    detail::host_lookup_num_threads(num_threads),
+    [&](size_t, size_t first, size_t last) {
+      for (size_t i = first; i < last; ++i) {
+        auto position = index ? index->find(edge_ids_to_lookup[i]) : detail::host_lookup_not_found;
+        if (position != detail::host_lookup_not_found) {
+          srcs[i] = index->srcs[position];
+          dsts[i] = index->dsts[position];
+        } else {
+          srcs[i] = invalid_vertex_id<vertex_t>::value;
+          dsts[i] = invalid_vertex_id<vertex_t>::value;
+        }
+      }
+    });
+}
+
+template <typename edge_id_t, typename edge_type_t, typename vertex_t>
+void host_lookup_container_t<edge_id_t, edge_type_t, vertex_t>::lookup_from_edge_ids_and_types(
+  raft::host_span<edge_id_t const> edge_ids_to_lookup,
+  raft::host_span<edge_type_t const> edge_types_to_lookup,
+  raft::host_span<vertex_t> srcs,
+  raft::host_span<vertex_t> dsts,
+  size_t num_threads) const
+{
+  CUGRAPH_EXPECTS(edge_types_to_lookup.size() == edge_ids_to_lookup.size(),
+                  "Invalid input arguments: edge_ids_to_lookup and edge_types_to_lookup should "
+                  "have the same size.");
+  CUGRAPH_EXPECTS(srcs.size() == edge_ids_to_lookup.size() &&
+                    dsts.size() == edge_ids_to_lookup.size(),
+                  "Invalid input arguments: srcs and dsts should have the size of "
+                  "edge_ids_to_lookup.");
+
+  detail::host_lookup_parallel_for(
+    edge_ids_to_lookup.size(),
+    detail::host_lookup_num_threads(num_threads),
+    [&](size_t, size_t first, size_t last) {
+      // queries are often grouped by type, reuse the last type's index
+      edge_type_t type{};
+      detail::host_lookup_type_index_t<edge_id_t, vertex_t> const* index{nullptr};
+      for (size_t i = first; i < last; ++i) {
+        if ((i == first) || (edge_types_to_lookup[i] != type)) {
+          type  = edge_types_to_lookup[i];
+          index = pimpl->type_index(type);
+        }
+        auto position = index ? index->find(edge_ids_to_lookup[i]) : detail::host_lookup_not_found;
+        if (position != detail::host_lookup_not_found) {
+          srcs[i] = index->srcs[position];
+          dsts[i] = index->dsts[position];
+        } else {
+          srcs[i] = invalid_vertex_id<vertex_t>::value;
+          dsts[i] = invalid_vertex_id<vertex_t>::value;
+        }
+      }
+    });
+}
+
+template <typename edge_id_t, typename edge_type_t, typename vertex_t>
+size_t host_lookup_container_t<edge_id_t, edge_type_t, vertex_t>::number_of_edges() const
+{
+  return pimpl->number_of_edges_;
+}
+
+template <typename edge_id_t, typename edge_type_t, typename vertex_t>
+size_t host_lookup_container_t<edge_id_t, edge_type_t, vertex_t>::size_in_bytes() const
+{
+  size_t size = pimpl->types_.size() * sizeof(edge_type_t);
+  for (auto const& index : pimpl->indices_) {
+    size += sizeof(index) + (index.srcs.size() + index.dsts.size()) * sizeof(vertex_t);
+    if (index.ids) { size += index.ids->size_in_bytes(); }
+  }
+  return size;
+}
+
+template <typename vertex_t, typename edge_t, typename edge_type_t>
+host_lookup_container_t<edge_t, edge_type_t, vertex_t> build_edge_id_and_type_to_src_dst_lookup_map(
+  raft::host_span<vertex_t const> srcs,
+  raft::host_span<vertex_t const> dsts,
+  raft::host_span<edge_t const> edge_ids,
+  std::optional<raft::host_span<edge_type_t const>> edge_types,
+  size_t num_threads)
+{
+  return host_lookup_container_t<edge_t, edge_type_t, vertex_t>(
+    srcs, dsts, edge_ids, edge_types, num_threads);
+}
+
+template <typename vertex_t, typename edge_t, typename edge_type_t>
+std::tuple<std::vector<vertex_t>, std::vector<vertex_t>>
+lookup_endpoints_from_edge_ids_and_single_type(
+  host_lookup_container_t<edge_t, edge_type_t, vertex_t> const& lookup_container,
+  raft::host_span<edge_t const> edge_ids_to_lookup,
+  edge_type_t edge_type_to_lookup,
+  size_t num_threads)
+{
+  std::vector<vertex_t> srcs(edge_ids_to_lookup.size());
+  std::vector<vertex_t> dsts(edge_ids_to_lookup.size());
+  lookup_container.lookup_from_edge_ids_and_single_type(
+    edge_ids_to_lookup,
+    edge_type_to_lookup,
+    raft::host_span<vertex_t>(srcs.data(), srcs.size()),
+    raft::host_span<vertex_t>(dsts.data(), dsts.size()),
+    num_threads);
+  return std::make_tuple(std::move(srcs), std::move(dsts));
+}
+
+template <typename vertex_t, typename edge_t, typename edge_type_t>
+std::tuple<std::vector<vertex_t>, std::vector<vertex_t>> lookup_endpoints_from_edge_ids_and_types(
+  host_lookup_container_t<edge_t, edge_type_t, vertex_t> const& lookup_container,
+  raft::host_span<edge_t const> edge_ids_to_lookup,
+  raft::host_span<edge_type_t const> edge_types_to_lookup,
+  size_t num_threads)
+{
+  std::vector<vertex_t> srcs(edge_ids_to_lookup.size());
+  std::vector<vertex_t> dsts(edge_ids_to_lookup.size());
+  lookup_container.lookup_from_edge_ids_and_types(
+    edge_ids_to_lookup,
+    edge_types_to_lookup,
+    raft::host_span<vertex_t>(srcs.data(), srcs.size()),
+    raft::host_span<vertex_t>(dsts.data(), dsts.size()),
+    num_threads);
+  return std::make_tuple(std::move(srcs), std::move(dsts));
+}
+
+template class host_lookup_container_t<int32_t, int32_t, int32_t>;
+template class host_lookup_container_t<int64_t, int32_t, int64_t>;
+
+template host_lookup_container_t<int32_t, int32_t, int32_t>
+build_edge_id_and_type_to_src_dst_lookup_map<int32_t, int32_t, int32_t>(
+  raft::host_span<int32_t const> srcs,
+  raft::host_span<int32_t const> dsts,
+  raft::host_span<int32_t const> edge_ids,
+  std::optional<raft::host_span<int32_t const>> edge_types,
+  size_t num_threads);
+
+template host_lookup_container_t<int64_t, int32_t, int64_t>
+build_edge_id_and_type_to_src_dst_lookup_map<int64_t, int64_t, int32_t>(
+  raft::host_span<int64_t const> srcs,
+  raft::host_span<int64_t const> dsts,
+  raft::host_span<int64_t const> edge_ids,
+  std::optional<raft::host_span<int32_t const>> edge_types,
+  size_t num_threads);
+
+template std::tuple<std::vector<int32_t>, std::vector<int32_t>>
+lookup_endpoints_from_edge_ids_and_single_type<int32_t, int32_t, int32_t>(
+  host_lookup_container_t<int32_t, int32_t, int32_t> const& lookup_container,
+  raft::host_span<int32_t const> edge_ids_to_lookup,
+  int32_t edge_type_to_lookup,
+  size_t num_threads);
+
+template std::tuple<std::vector<int64_t>, std::vector<int64_t>>
+lookup_endpoints_from_edge_ids_and_single_type<int64_t, int64_t, int32_t>(
+  host_lookup_container_t<int64_t, int32_t, int64_t> const& lookup_container,
+  raft::host_span<int64_t const> edge_ids_to_lookup,
+  int32_t edge_type_to_lookup,
+  size_t num_threads);
+
+template std::tuple<std::vector<int32_t>, std::vector<int32_t>>
+lookup_endpoints_from_edge_ids_and_types<int32_t, int32_t, int32_t>(
+  host_lookup_container_t<int32_t, int32_t, int32_t> const& lookup_container,
+  raft::host_span<int32_t const> edge_ids_to_lookup,
+  raft::host_span<int32_t const> edge_types_to_lookup,
+  size_t num_threads);
+
+template std::tuple<std::vector<int64_t>, std::vector<int64_t>>
+lookup_endpoints_from_edge_ids_and_types<int64_t, int64_t, int32_t>(
+  host_lookup_container_t<int64_t, int32_t, int64_t> const& lookup_container,
+  raft::host_span<int64_t const> edge_ids_to_lookup,
+  raft::host_span<int32_t const> edge_types_to_lookup,
+  size_t num_threads);
+
+}  // namespace cugraph
@@ -0,0 +1,739 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cugraph/host_csr_file.hpp>
+#include <cugraph/utilities/error.hpp>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <numeric>
+#include <thread>
+#include <type_traits>
+
+namespace cugraph {
+
+namespace detail {
+
+constexpr char host_csr_file_magic[8] = {'C', 'G', 'C', 'S', 'R', '\0', '\0', '\0'};
+constexpr uint32_t host_csr_file_version{1};
+constexpr size_t host_csr_file_header_size{128};
+constexpr size_t host_csr_file_alignment{64};
+
+// vertices per block index entry, decoding a vertex range starts at the block of its first vertex
+constexpr uint64_t host_csr_file_vertices_per_block{64};
+
+// edges encoded in parallel before the encoded bytes are written out
+constexpr size_t host_csr_file_segment_edges{size_t{1} << 24};
+
+constexpr uint32_t host_csr_file_symmetric_flag{1};
+constexpr uint32_t host_csr_file_edge_ids_flag{2};
+constexpr uint32_t host_csr_file_renumbered_flag{4};
+
+// byte offsets of the header fields
+constexpr size_t host_csr_file_version_field{8};
+constexpr size_t host_csr_file_flags_field{12};
+constexpr size_t host_csr_file_sizes_field{16};     // 4 uint32_t
+constexpr size_t host_csr_file_counts_field{32};    // 3 uint64_t
+constexpr size_t host_csr_file_sections_field{56};  // 9 uint64_t
+
+inline uint64_t host_csr_align(uint64_t offset)
+{
+  return (offset + host_csr_file_alignment - 1) / host_csr_file_alignment *
+         host_csr_file_alignment;
+}
+
+inline size_t host_csr_num_threads(size_t num_threads)
+{
+  if (num_threads == 0) {
+    num_threads = std::max(size_t{1}, static_cast<size_t>(std::thread::hardware_concurrency()));
+  }
+  return num_threads;
+}
+
+inline uint64_t host_zigzag_encode(int64_t x)
+{
+  return (static_cast<uint64_t>(x) << 1) ^ static_cast<uint64_t>(x >> 63);
+}
+
+inline int64_t host_zigzag_decode(uint64_t x)
+{
+  return static_cast<int64_t>(x >> 1) ^ -static_cast<int64_t>(x & 1);
+}
+
+inline void host_varint_encode(uint64_t x, std::vector<unsigned char>& out)
+{
+  while (x >= 0x80) {
+    out.push_back(static_cast<unsigned char>(x | 0x80));
+    x >>= 7;
+  }
+  out.push_back(static_cast<unsigned char>(x));
+}
+
+// returns nullptr if the varint runs past end or is longer than 64 bits
+inline unsigned char const* host_varint_decode(unsigned char const* p,
+                                               unsigned char const* end,
+                                               uint64_t& x)
+{
+  if ((p < end) && (*p < 0x80)) {
+    x = *p;
+    return p + 1;
+  }
+  x = 0;
+  for (unsigned shift = 0; (shift < 64) && (p < end); shift += 7) {
+    auto byte = *p++;
+    x |= static_cast<uint64_t>(byte & 0x7f) << shift;
+    if (byte < 0x80) { return p; }
+  }
+  return nullptr;
+}
+
+/**
+ * Runs f(part) for part in [0, num_parts) on up to num_parts threads, rethrowing the first
+ * exception.
+ */
+template <typename f_t>
+void host_csr_parallel_parts(size_t num_parts, f_t f)
+{
+  if (num_parts <= 1) {
+    if (num_parts == 1) { f(size_t{0}); }
+    return;
+  }
+  std::vector<std::exception_ptr> errors(num_parts);
+  std::vector<std::thread> threads{};
+  threads.reserve(num_parts - 1);
+  for (size_t part = 1; part < num_parts; ++part) {
+    threads.emplace_back([&, part]() {
+      try {
+        f(part);
+      } catch (...) {
+        errors[part] = std::current_exception();
+      }
+    });
+  }
+  try {
+    f(size_t{0});
+  } catch (...) {
+    errors[0] = std::current_exception();
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (auto& error : errors) {
+    if (error) { std::rethrow_exception(error); }
+  }
+}
+
+/**
+ * Splits the blocks [first_block, last_block) into at most num_parts ranges of similar edge
+ * counts. Returns the num_ranges + 1 range boundaries.
+ */
+template <typename edge_t>
+std::vector<uint64_t> host_csr_balanced_blocks(edge_t const* offsets,
+                                               uint64_t number_of_vertices,
+                                               uint64_t first_block,
+                                               uint64_t last_block,
+                                               size_t num_parts)
+{
+  auto block_edge = [&](uint64_t block) {
+    return static_cast<uint64_t>(
+      offsets[std::min(block * host_csr_file_vertices_per_block, number_of_vertices)]);
+  };
+  uint64_t first_edge = block_edge(first_block);
+  uint64_t last_edge  = block_edge(last_block);
+
+  std::vector<uint64_t> boundaries{first_block};
+  for (size_t part = 1; part < num_parts; ++part) {
+    uint64_t target = first_edge + (last_edge - first_edge) * part / num_parts;
+    uint64_t lo     = boundaries.back();
+    uint64_t hi     = last_block;
+    while (lo < hi) {
+      uint64_t mid = lo + (hi - lo) / 2;
+      if (block_edge(mid) < target) {
+        lo = mid + 1;
+      } else {
+        hi = mid;
+      }
+    }
+    if ((lo > boundaries.back()) && (lo < last_block)) { boundaries.push_back(lo); }
+  }
+  boundaries.push_back(last_block);
+  return boundaries;
+}
+
+class host_csr_output_file_t {
+ public:
+  explicit host_csr_output_file_t(std::string const& path)
+    : fd_{::open(path.c_str(), O_CREAT | O_TRUNC | O_WRONLY, 0644)}
+  {
+    CUGRAPH_EXPECTS(fd_ >= 0, "Could not open %s for writing.", path.c_str());
+  }
+
+  host_csr_output_file_t(host_csr_output_file_t const&)            = delete;
+  host_csr_output_file_t& operator=(host_csr_output_file_t const&) = delete;
+
+  ~host_csr_output_file_t()
+  {
+    if (fd_ >= 0) { ::close(fd_); }
+  }
+
+  void write(void const* data, size_t size, uint64_t offset)
+  {
+    auto bytes = static_cast<char const*>(data);
+    while (size > 0) {
+      auto written = ::pwrite(fd_, bytes, size, static_cast<off_t>(offset));
+      if ((written < 0) && (errno == EINTR)) { continue; }
+      CUGRAPH_EXPECTS(written > 0, "Failed to write the CSR file: %s.", std::strerror(errno));
+      bytes += written;
+      size -= static_cast<size_t>(written);
+      offset += static_cast<uint64_t>(written);
+    }
+  }
+
+  void close()
+  {
+    auto status = ::close(fd_);
+    fd_         = -1;
+    CUGRAPH_EXPECTS(status == 0, "Failed to write the CSR file: %s.", std::strerror(errno));
+  }
+
+ private:
+  int fd_;
+};
+
+inline void host_csr_serialize_header(host_csr_file_header_t const& header,
+                                      unsigned char* bytes)
+{
+  std::memset(bytes, 0, host_csr_file_header_size);
+  std::memcpy(bytes, host_csr_file_magic, sizeof(host_csr_file_magic));
+
+  uint32_t flags = (header.is_symmetric ? host_csr_file_symmetric_flag : 0) |
+                   (header.has_edge_ids ? host_csr_file_edge_ids_flag : 0) |
+                   (header.is_renumbered ? host_csr_file_renumbered_flag : 0);
+  uint32_t sizes[4] = {
+    header.vertex_size, header.edge_size, header.weight_size, header.edge_type_size};
+  uint64_t counts[3] = {
+    header.number_of_vertices, header.number_of_edges, header.vertices_per_block};
+  uint64_t sections[9] = {header.renumber_map_offset,
+                          header.offsets_offset,
+                          header.weights_offset,
+                          header.edge_ids_offset,
+                          header.edge_types_offset,
+                          header.adjacency_offset,
+                          header.adjacency_size,
+                          header.block_index_offset,
+                          header.file_size};
+
+  std::memcpy(bytes + host_csr_file_version_field, &header.version, sizeof(uint32_t));
+  std::memcpy(bytes + host_csr_file_flags_field, &flags, sizeof(flags));
+  std::memcpy(bytes + host_csr_file_sizes_field, sizes, sizeof(sizes));
+  std::memcpy(bytes + host_csr_file_counts_field, counts, sizeof(counts));
+  std::memcpy(bytes + host_csr_file_sections_field, sections, sizeof(sections));
+}
+
+inline host_csr_file_header_t host_csr_parse_header(unsigned char const* bytes,
+                                                    uint64_t file_size,
+                                                    std::string const& path)
+{
+  CUGRAPH_EXPECTS(
+    (file_size >= host_csr_file_header_size) &&
+      (std::memcmp(bytes, host_csr_file_magic, sizeof(host_csr_file_magic)) == 0),
+    "%s is not a CSR file.",
+    path.c_str());
+
+  host_csr_file_header_t header{};
+  uint32_t flags{};
+  uint32_t sizes[4]{};
+  uint64_t counts[3]{};
+  uint64_t sections[9]{};
+  std::memcpy(&header.version, bytes + host_csr_file_version_field, sizeof(uint32_t));
+  std::memcpy(&flags, bytes + host_csr_file_flags_field, sizeof(flags));
+  std::memcpy(sizes, bytes + host_csr_file_sizes_field, sizeof(sizes));
+  std::memcpy(counts, bytes + host_csr_file_counts_field, sizeof(counts));
+  std::memcpy(sections, bytes + host_csr_file_sections_field, sizeof(sections));
+
+  CUGRAPH_EXPECTS(header.version == host_csr_file_version,
+                  "%s has CSR file version %u, expected %u.",
+                  path.c_str(),
+                  header.version,
+                  host_csr_file_version);
+
+  header.is_symmetric        = (flags & host_csr_file_symmetric_flag) != 0;
+  header.has_edge_ids        = (flags & host_csr_file_edge_ids_flag) != 0;
+  header.is_renumbered       = (flags & host_csr_file_renumbered_flag) != 0;
+  header.vertex_size         = sizes[0];
+  header.edge_size           = sizes[1];
+  header.weight_size         = sizes[2];
+  header.edge_type_size      = sizes[3];
+  header.number_of_vertices  = counts[0];
+  header.number_of_edges     = counts[1];
+  header.vertices_per_block  = counts[2];
+  header.renumber_map_offset = sections[0];
+  header.offsets_offset      = sections[1];
+  header.weights_offset      = sections[2];
+  header.edge_ids_offset     = sections[3];
+  header.edge_types_offset   = sections[4];
+  header.adjacency_offset    = sections[5];
+  header.adjacency_size      = sections[6];
+  header.block_index_offset  = sections[7];
+  header.file_size           = sections[8];
+
+  auto nv         = header.number_of_vertices;
+  auto ne         = header.number_of_edges;
+  auto num_blocks = (header.vertices_per_block > 0)
+                      ? (nv + header.vertices_per_block - 1) / header.vertices_per_block
+                      : uint64_t{0};
+
+  // every section must be aligned and inside the file, sizes are bounded by the file size first
+  // so that the products below cannot overflow
+  bool valid = (header.file_size == file_size) && (header.vertices_per_block > 0) &&
+               (nv < file_size) && (ne < file_size) &&
+               ((header.vertex_size == 4) || (header.vertex_size == 8)) &&
+               ((header.edge_size == 4) || (header.edge_size == 8)) &&
+               ((header.weight_size == 0) || (header.weight_size == 4) ||
+                (header.weight_size == 8)) &&
+               ((header.edge_type_size == 0) || (header.edge_type_size == 4));
+  auto section_fits = [&](uint64_t offset, uint64_t size, bool present) {
+    if (!present) { return offset == 0; }
+    return (offset >= host_csr_file_header_size) && (offset % host_csr_file_alignment == 0) &&
+           (offset <= file_size) && (size <= file_size - offset);
+  };
+  valid = valid &&
+          section_fits(header.renumber_map_offset, nv * header.vertex_size, header.is_renumbered) &&
+          section_fits(header.offsets_offset, (nv + 1) * header.edge_size, true) &&
+          section_fits(header.weights_offset, ne * header.weight_size, header.weight_size > 0) &&
+          section_fits(header.edge_ids_offset, ne * header.edge_size, header.has_edge_ids) &&
+          section_fits(
+            header.edge_types_offset, ne * header.edge_type_size, header.edge_type_size > 0) &&
+          section_fits(header.adjacency_offset, header.adjacency_size, true) &&
+          section_fits(header.block_index_offset, (num_blocks + 1) * sizeof(uint64_t), true);
+  CUGRAPH_EXPECTS(valid, "%s is not a valid CSR file.", path.c_str());
+
+  return header;
+}
+
+}  // namespace detail
+
+host_csr_file_header_t read_host_csr_file_header(std::string const& path)
+{
+  auto fd = ::open(path.c_str(), O_RDONLY);
+  CUGRAPH_EXPECTS(fd >= 0, "Could not open %s for reading.", path.c_str());
+
+  struct stat status {};
+  unsigned char bytes[detail::host_csr_file_header_size]{};
+  bool ok = (::fstat(fd, &status) == 0) &&
+            (::pread(fd, bytes, sizeof(bytes), 0) == static_cast<ssize_t>(sizeof(bytes)));
+  ::close(fd);
+  CUGRAPH_EXPECTS(ok, "%s is not a CSR file.", path.c_str());
+
+  return detail::host_csr_parse_header(bytes, static_cast<uint64_t>(status.st_size), path);
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+void write_host_csr_file(std::string const& path,
+                         raft::host_span<edge_t const> offsets,
+                         raft::host_span<vertex_t const> indices,
+                         std::optional<raft::host_span<weight_t const>> weights,
+                         std::optional<raft::host_span<edge_t const>> edge_ids,
+                         std::optional<raft::host_span<int32_t const>> edge_types,
+                         std::optional<raft::host_span<vertex_t const>> renumber_map,
+                         bool is_symmetric,
+                         size_t num_threads)
+{
+  static_assert(std::is_integral_v<vertex_t> && std::is_integral_v<edge_t>);
+  static_assert(std::is_floating_point_v<weight_t>);
+
+  CUGRAPH_EXPECTS(offsets.size() > 0, "Invalid input argument: offsets is empty.");
+  uint64_t nv = offsets.size() - 1;
+  uint64_t ne = indices.size();
+  CUGRAPH_EXPECTS((offsets[0] == 0) && (static_cast<uint64_t>(offsets[nv]) == ne),
+                  "Invalid input argument: offsets do not match the number of indices.");
+  CUGRAPH_EXPECTS(!weights || (weights->size() == ne),
+                  "Invalid input argument: weights size != indices size.");
+  CUGRAPH_EXPECTS(!edge_ids || (edge_ids->size() == ne),
+                  "Invalid input argument: edge_ids size != indices size.");
+  CUGRAPH_EXPECTS(!edge_types || (edge_types->size() == ne),
+                  "Invalid input argument: edge_types size != indices size.");
+  CUGRAPH_EXPECTS(!renumber_map || (renumber_map->size() == nv),
+                  "Invalid input argument: renumber_map size != number of vertices.");
+
+  host_csr_file_header_t header{};
+  header.version            = detail::host_csr_file_version;
+  header.vertex_size        = sizeof(vertex_t);
+  header.edge_size          = sizeof(edge_t);
+  header.weight_size        = weights ? sizeof(weight_t) : 0;
+  header.edge_type_size     = edge_types ? sizeof(int32_t) : 0;
+  header.is_symmetric       = is_symmetric;
+  header.has_edge_ids       = edge_ids.has_value();
+  header.is_renumbered      = renumber_map.has_value();
+  header.number_of_vertices = nv;
+  header.number_of_edges    = ne;
+  header.vertices_per_block = detail::host_csr_file_vertices_per_block;
+
+  uint64_t position = detail::host_csr_file_header_size;
+  auto place        = [&](bool present, uint64_t size) {
+    if (!present) { return uint64_t{0}; }
+    auto offset = detail::host_csr_align(position);
+    position    = offset + size;
+    return offset;
+  };
+  header.renumber_map_offset = place(renumber_map.has_value(), nv * sizeof(vertex_t));
+  header.offsets_offset      = place(true, (nv + 1) * sizeof(edge_t));
+  header.weights_offset      = place(weights.has_value(), ne * sizeof(weight_t));
+  header.edge_ids_offset     = place(edge_ids.has_value(), ne * sizeof(edge_t));
+  header.edge_types_offset   = place(edge_types.has_value(), ne * sizeof(int32_t));
+  header.adjacency_offset    = place(true, 0);
+
+  detail::host_csr_output_file_t file(path);
+  if (renumber_map) {
+    file.write(renumber_map->data(), nv * sizeof(vertex_t), header.renumber_map_offset);
+  }
+  file.write(offsets.data(), (nv + 1) * sizeof(edge_t), header.offsets_offset);
+
+  num_threads     = detail::host_csr_num_threads(num_threads);
+  auto num_blocks = (nv + header.vertices_per_block - 1) / header.vertices_per_block;
+  std::vector<uint64_t> block_index(num_blocks + 1);
+
+  struct part_t {
+    std::vector<unsigned char> bytes{};
+    std::vector<uint64_t> block_offsets{};
+  };
+  std::vector<part_t> parts(num_threads);
+  std::vector<weight_t> segment_weights{};
+  std::vector<edge_t> segment_edge_ids{};
+  std::vector<int32_t> segment_edge_types{};
+  uint64_t adjacency_size{0};
+
+  auto block_first_edge = [&](uint64_t block) {
+    return static_cast<uint64_t>(offsets[std::min(block * header.vertices_per_block, nv)]);
+  };
+
+  uint64_t segment_first_block{0};
+  while (segment_first_block < num_blocks) {
+    // a segment is the run of whole blocks holding about host_csr_file_segment_edges edges
+    uint64_t segment_last_block = segment_first_block + 1;
+    while ((segment_last_block < num_blocks) &&
+           (block_first_edge(segment_last_block) - block_first_edge(segment_first_block) <
+            detail::host_csr_file_segment_edges)) {
+      ++segment_last_block;
+    }
+    uint64_t segment_first_edge = block_first_edge(segment_first_block);
+    uint64_t segment_num_edges  = block_first_edge(segment_last_block) - segment_first_edge;
+    if (weights) { segment_weights.resize(segment_num_edges); }
+    if (edge_ids) { segment_edge_ids.resize(segment_num_edges); }
+    if (edge_types) { segment_edge_types.resize(segment_num_edges); }
+
+    auto boundaries = detail::host_csr_balanced_blocks(
+      offsets.data(), nv, segment_first_block, segment_last_block, num_threads);
+
+    detail::host_csr_parallel_parts(boundaries.size() - 1, [&](size_t p) {
+      auto& part = parts[p];
+      part.bytes.clear();
+      part.block_offsets.clear();
+      std::vector<edge_t> order{};
+      for (auto block = boundaries[p]; block < boundaries[p + 1]; ++block) {
+        part.block_offsets.push_back(part.bytes.size());
+        auto first_vertex = block * header.vertices_per_block;
+        auto last_vertex  = std::min(first_vertex + header.vertices_per_block, nv);
+        for (auto v = first_vertex; v < last_vertex; ++v) {
+          auto first = offsets[v];
+          auto last  = offsets[v + 1];
+          CUGRAPH_EXPECTS(first <= last, "Invalid input argument: offsets are not sorted.");
+          order.resize(last - first);
+          std::iota(order.begin(), order.end(), first);
+          if (!std::is_sorted(indices.data() + first, indices.data() + last)) {
+            std::stable_sort(order.begin(), order.end(), [&](edge_t lhs, edge_t rhs) {
+              return indices[lhs] < indices[rhs];
+            });
+          }
+
+          int64_t previous = static_cast<int64_t>(v);
+          for (size_t i = 0; i < order.size(); ++i) {
+            auto neighbor = static_cast<int64_t>(indices[order[i]]);
+            CUGRAPH_EXPECTS((neighbor >= 0) && (static_cast<uint64_t>(neighbor) < nv),
+                            "Invalid input argument: vertex ID out of range.");
+            detail::host_varint_encode(i == 0 ? detail::host_zigzag_encode(neighbor - previous)
+                                              : static_cast<uint64_t>(neighbor - previous),
+                                       part.bytes);
+            previous = neighbor;
+
+            auto slot = static_cast<uint64_t>(first) + i - segment_first_edge;
+            if (weights) { segment_weights[slot] = (*weights)[order[i]]; }
+            if (edge_ids) { segment_edge_ids[slot] = (*edge_ids)[order[i]]; }
+            if (edge_types) { segment_edge_types[slot] = (*edge_types)[order[i]]; }
+          }
+        }
+      }
+    });
+
+    for (size_t p = 0; p + 1 < boundaries.size(); ++p) {
+      for (size_t b = 0; b < parts[p].block_offsets.size(); ++b) {
+        block_index[boundaries[p] + b] = adjacency_size + parts[p].block_offsets[b];
+      }
+      file.write(
+        parts[p].bytes.data(), parts[p].bytes.size(), header.adjacency_offset + adjacency_size);
+      adjacency_size += parts[p].bytes.size();
+    }
+    if (weights) {
+      file.write(segment_weights.data(),
+                 segment_num_edges * sizeof(weight_t),
+                 header.weights_offset + segment_first_edge * sizeof(weight_t));
+    }
+    if (edge_ids) {
+      file.write(segment_edge_ids.data(),
+                 segment_num_edges * sizeof(edge_t),
+                 header.edge_ids_offset + segment_first_edge * sizeof(edge_t));
+    }
+    if (edge_types) {
+      file.write(segment_edge_types.data(),
+                 segment_num_edges * sizeof(int32_t),
+                 header.edge_types_offset + segment_first_edge * sizeof(int32_t));
+    }
+
+    segment_first_block = segment_last_block;
+  }
+  block_index[num_blocks] = adjacency_size;
+
+  header.adjacency_size     = adjacency_size;
+  header.block_index_offset = detail::host_csr_align(header.adjacency_offset + adjacency_size);
+  header.file_size          = header.block_index_offset + block_index.size() * sizeof(uint64_t);
+  file.write(block_index.data(), block_index.size() * sizeof(uint64_t), header.block_index_offset);
+
+  unsigned char header_bytes[detail::host_csr_file_header_size];
+  detail::host_csr_serialize_header(header, header_bytes);
+  file.write(header_bytes, sizeof(header_bytes), 0);
+  file.close();
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+host_csr_file_t<vertex_t, edge_t, weight_t>::host_csr_file_t(std::string const& path)
+{
+  auto fd = ::open(path.c_str(), O_RDONLY);
+  CUGRAPH_EXPECTS(fd >= 0, "Could not open %s for reading.", path.c_str());
+
+  struct stat status {};
+  if ((::fstat(fd, &status) != 0) ||
+      (static_cast<uint64_t>(status.st_size) < detail::host_csr_file_header_size)) {
+    ::close(fd);
+    CUGRAPH_FAIL("%s is not a CSR file.", path.c_str());
+  }
+  auto file_size = static_cast<uint64_t>(status.st_size);
+  auto mapping   = ::mmap(nullptr, file_size, PROT_READ, MAP_SHARED, fd, 0);
+  ::close(fd);
+  CUGRAPH_EXPECTS(mapping != MAP_FAILED, "Could not map %s.", path.c_str());
+  data_ = static_cast<unsigned char const*>(mapping);
+
+  try {
+    header_ = detail::host_csr_parse_header(data_, file_size, path);
+    CUGRAPH_EXPECTS((header_.vertex_size == sizeof(vertex_t)) &&
+                      (header_.edge_size == sizeof(edge_t)) &&
+                      ((header_.weight_size == 0) || (header_.weight_size == sizeof(weight_t))),
+                    "%s stores %u byte vertices, %u byte edges and %u byte weights, the requested "
+                    "types do not match.",
+                    path.c_str(),
+                    header_.vertex_size,
+                    header_.edge_size,
+                    header_.weight_size);
+
+    auto nv          = header_.number_of_vertices;
+    auto num_blocks  = (nv + header_.vertices_per_block - 1) / header_.vertices_per_block;
+    auto offsets     = section<edge_t>(header_.offsets_offset);
+    auto block_index = section<uint64_t>(header_.block_index_offset);
+    CUGRAPH_EXPECTS(
+      (offsets[0] == 0) && (static_cast<uint64_t>(offsets[nv]) == header_.number_of_edges) &&
+        (block_index[num_blocks] == header_.adjacency_size),
+      "%s is not a valid CSR file.",
+      path.c_str());
+  } catch (...) {
+    ::munmap(const_cast<unsigned char*>(data_), file_size);
+    throw;
+  }
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+host_csr_file_t<vertex_t, edge_t, weight_t>::~host_csr_file_t()
+{
+  ::munmap(const_cast<unsigned char*>(data_), header_.file_size);
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+raft::host_span<edge_t const> host_csr_file_t<vertex_t, edge_t, weight_t>::offsets() const
+{
+  return raft::host_span<edge_t const>(section<edge_t>(header_.offsets_offset),
+                                       header_.number_of_vertices + 1);
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+std::optional<raft::host_span<weight_t const>>
+host_csr_file_t<vertex_t, edge_t, weight_t>::weights() const
+{
+  if (header_.weight_size == 0) { return std::nullopt; }
+  return raft::host_span<weight_t const>(section<weight_t>(header_.weights_offset),
+                                         header_.number_of_edges);
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+std::optional<raft::host_span<edge_t const>>
+host_csr_file_t<vertex_t, edge_t, weight_t>::edge_ids() const
+{
+  if (!header_.has_edge_ids) { return std::nullopt; }
+  return raft::host_span<edge_t const>(section<edge_t>(header_.edge_ids_offset),
+                                       header_.number_of_edges);
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+std::optional<raft::host_span<int32_t const>>
+host_csr_file_t<vertex_t, edge_t, weight_t>::edge_types() const
+{
+  if (header_.edge_type_size == 0) { return std::nullopt; }
+  return raft::host_span<int32_t const>(section<int32_t>(header_.edge_types_offset),
+                                        header_.number_of_edges);
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+std::optional<raft::host_span<vertex_t const>>
+host_csr_file_t<vertex_t, edge_t, weight_t>::renumber_map() const
+{
+  if (!header_.is_renumbered) { return std::nullopt; }
+  return raft::host_span<vertex_t const>(section<vertex_t>(header_.renumber_map_offset),
+                                         header_.number_of_vertices);
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+void host_csr_file_t<vertex_t, edge_t, weight_t>::decode_indices(
+  vertex_t first, vertex_t last, raft::host_span<vertex_t> indices) const
+{
+  auto nv      = header_.number_of_vertices;
+  auto offsets = section<edge_t>(header_.offsets_offset);
+  CUGRAPH_EXPECTS((first >= 0) && (first <= last) && (static_cast<uint64_t>(last) <= nv),
+                  "Invalid input argument: invalid vertex range.");
+  CUGRAPH_EXPECTS(indices.size() == static_cast<size_t>(offsets[last] - offsets[first]),
+                  "Invalid input argument: indices size does not match the vertex range.");
+  if (first == last) { return; }
+
+  auto block       = static_cast<uint64_t>(first) / header_.vertices_per_block;
+  auto block_index = section<uint64_t>(header_.block_index_offset);
+  auto adjacency   = section<unsigned char>(header_.adjacency_offset);
+  auto end         = adjacency + header_.adjacency_size;
+  CUGRAPH_EXPECTS(block_index[block] <= header_.adjacency_size, "Corrupt CSR file.");
+  auto p = adjacency + block_index[block];
+
+  // skip the lists of the vertices of the block before first, a varint ends with a byte < 0x80
+  for (auto v = block * header_.vertices_per_block; v < static_cast<uint64_t>(first); ++v) {
+    auto degree = offsets[v + 1] - offsets[v];
+    for (edge_t i = 0; i < degree; ++i) {
+      while ((p < end) && (*p >= 0x80)) {
+        ++p;
+      }
+      CUGRAPH_EXPECTS(p < end, "Corrupt CSR file.");
+      ++p;
+    }
+  }
+
+  auto out = indices.data();
+  for (auto v = first; v < last; ++v) {
+    auto degree = offsets[v + 1] - offsets[v];
+    CUGRAPH_EXPECTS(degree >= 0, "Corrupt CSR file.");
+    int64_t neighbor = v;
+    for (edge_t i = 0; i < degree; ++i) {
+      uint64_t x{};
+      p = detail::host_varint_decode(p, end, x);
+      CUGRAPH_EXPECTS(p != nullptr, "Corrupt CSR file.");
+      neighbor += (i == 0) ? detail::host_zigzag_decode(x) : static_cast<int64_t>(x);
+      CUGRAPH_EXPECTS((neighbor >= 0) && (static_cast<uint64_t>(neighbor) < nv),
+                      "Corrupt CSR file.");
+      *out++ = static_cast<vertex_t>(neighbor);
+    }
+  }
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+std::vector<vertex_t> host_csr_file_t<vertex_t, edge_t, weight_t>::decode_indices(
+  size_t num_threads) const
+{
+  auto nv         = header_.number_of_vertices;
+  auto offsets    = section<edge_t>(header_.offsets_offset);
+  auto num_blocks = (nv + header_.vertices_per_block - 1) / header_.vertices_per_block;
+
+  std::vector<vertex_t> indices(header_.number_of_edges);
+  auto boundaries = detail::host_csr_balanced_blocks(
+    offsets, nv, 0, num_blocks, detail::host_csr_num_threads(num_threads));
+  detail::host_csr_parallel_parts(boundaries.size() - 1, [&](size_t p) {
+    auto first = std::min(boundaries[p] * header_.vertices_per_block, nv);
+    auto last  = std::min(boundaries[p + 1] * header_.vertices_per_block, nv);
+    decode_indices(
+      static_cast<vertex_t>(first),
+      static_cast<vertex_t>(last),
+      raft::host_span<vertex_t>(indices.data() + offsets[first], offsets[last] - offsets[first]));
+  });
+  return indices;
+}
+
+template void write_host_csr_file<int32_t, int32_t, float>(
+  std::string const&,
+  raft::host_span<int32_t const>,
+  raft::host_span<int32_t const>,
+  std::optional<raft::host_span<float const>>,
+  std::optional<raft::host_span<int32_t const>>,
+  std::optional<raft::host_span<int32_t const>>,
+  std::optional<raft::host_span<int32_t const>>,
+  bool,
+  size_t);
+
+template void write_host_csr_file<int32_t, int32_t, double>(
+  std::string const&,
+  raft::host_span<int32_t const>,
+  raft::host_span<int32_t const>,
+  std::optional<raft::host_span<double const>>,
+  std::optional<raft::host_span<int32_t const>>,
+  std::optional<raft::host_span<int32_t const>>,
+  std::optional<raft::host_span<int32_t const>>,
+  bool,
+  size_t);
+
+template void write_host_csr_file<int64_t, int64_t, float>(
+  std::string const&,
+  raft::host_span<int64_t const>,
+  raft::host_span<int64_t const>,
+  std::optional<raft::host_span<float const>>,
+  std::optional<raft::host_span<int64_t const>>,
+  std::optional<raft::host_span<int32_t const>>,
+  std::optional<raft::host_span<int64_t const>>,
+  bool,
+  size_t);
+
+template void write_host_csr_file<int64_t, int64_t, double>(
+  std::string const&,
+  raft::host_span<int64_t const>,
+  raft::host_span<int64_t const>,
+  std::optional<raft::host_span<double const>>,
+  std::optional<raft::host_span<int64_t const>>,
+  std::optional<raft::host_span<int32_t const>>,
+  std::optional<raft::host_span<int64_t const>>,
+  bool,
+  size_t);
+
+template class host_csr_file_t<int32_t, int32_t, float>;
+template class host_csr_file_t<int32_t, int32_t, double>;
+template class host_csr_file_t<int64_t, int64_t, float>;
+template class host_csr_file_t<int64_t, int64_t, double>;
+
+}  // namespace cugraph
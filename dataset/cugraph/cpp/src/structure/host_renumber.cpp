@@ -0,0 +1,638 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cugraph/graph.hpp>
+#include <cugraph/host_renumber.hpp>
+#include <cugraph/utilities/error.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <exception>
+#include <limits>
+#include <numeric>
+#include <thread>
+
+namespace cugraph {
+
+namespace detail {
+
+// precision of the HyperLogLog sketch that sizes the hash table (2^14 registers, ~1% error)
+constexpr int host_renumber_hll_precision{14};
+
+// a thread gets at least this many items, smaller loops run on fewer threads
+constexpr size_t host_renumber_min_items_per_thread{size_t{1} << 16};
+
+// internal id states of a host_vertex_map_t slot whose key is set
+constexpr int host_vertex_map_pending{-1};
+constexpr int host_vertex_map_failed{-2};
+
+inline size_t host_renumber_num_threads(size_t num_threads)
+{
+  if (num_threads == 0) {
+    num_threads = std::max(size_t{1}, static_cast<size_t>(std::thread::hardware_concurrency()));
+  }
+  return num_threads;
+}
+
+inline uint64_t host_renumber_hash(uint64_t x)
+{
+  x ^= x >> 33;
+  x *= 0xff51afd7ed558ccdULL;
+  x ^= x >> 33;
+  x *= 0xc4ceb9fe1a85ec53ULL;
+  x ^= x >> 33;
+  return x;
+}
+
+inline size_t host_renumber_table_capacity(size_t number_of_keys)
+{
+  size_t capacity{16};
+  while (capacity < 2 * number_of_keys) {
+    capacity *= 2;
+  }
+  return capacity;
+}
+
+/**
+ * Runs f(part) for part in [0, num_parts) on up to num_parts threads, rethrowing the first
+ * exception.
+ */
+template <typename f_t>
+void host_renumber_parallel_parts(size_t num_parts, f_t f)
+{
+  if (num_parts <= 1) {
+    if (num_parts == 1) { f(size_t{0}); }
+    return;
+  }
+  std::vector<std::exception_ptr> errors(num_parts);
+  std::vector<std::thread> threads{};
+  threads.reserve(num_parts - 1);
+  for (size_t part = 1; part < num_parts; ++part) {
+    threads.emplace_back([&, part]() {
+      try {
+        f(part);
+      } catch (...) {
+        errors[part] = std::current_exception();
+      }
+    });
+  }
+  try {
+    f(size_t{0});
+  } catch (...) {
+    errors[0] = std::current_exception();
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (auto& error : errors) {
+    if (error) { std::rethrow_exception(error); }
+  }
+}
+
+// Splits [0, n) into one range per thread and runs f(part, begin, end) on each
+template <typename f_t>
+size_t host_renumber_parallel_for(size_t n, size_t num_threads, f_t f)
+{
+  auto num_parts = std::max(
+    size_t{1},
+    std::min(num_threads, (n + host_renumber_min_items_per_thread - 1) /
+                            host_renumber_min_items_per_thread));
+  host_renumber_parallel_parts(num_parts, [&](size_t part) {
+    f(part, (n * part) / num_parts, (n * (part + 1)) / num_parts);
+  });
+  return num_parts;
+}
+
+// Sorts runs in parallel, then merges pairs of runs in parallel
+template <typename T, typename comp_t>
+void host_renumber_parallel_sort(std::vector<T>& values, comp_t comp, size_t num_threads)
+{
+  auto n         = values.size();
+  auto num_parts = std::max(
+    size_t{1}, std::min(num_threads, n / host_renumber_min_items_per_thread));
+  std::vector<size_t> bounds(num_parts + 1);
+  for (size_t part = 0; part <= num_parts; ++part) {
+    bounds[part] = (n * part) / num_parts;
+  }
+  host_renumber_parallel_parts(num_parts, [&](size_t part) {
+    std::sort(values.begin() + bounds[part], values.begin() + bounds[part + 1], comp);
+  });
+
+  std::vector<T> buffer(num_parts > 1 ? n : size_t{0});
+  while (bounds.size() > 2) {
+    auto num_runs = bounds.size() - 1;
+    host_renumber_parallel_parts((num_runs + 1) / 2, [&](size_t pair) {
+      auto first = bounds[2 * pair];
+      auto mid   = bounds[std::min(2 * pair + 1, num_runs)];
+      auto last  = bounds[std::min(2 * pair + 2, num_runs)];
+      std::merge(values.begin() + first,
+                 values.begin() + mid,
+                 values.begin() + mid,
+                 values.begin() + last,
+                 buffer.begin() + first,
+                 comp);
+    });
+    std::vector<size_t> merged_bounds{};
+    for (size_t i = 0; i < bounds.size(); i += 2) {
+      merged_bounds.push_back(bounds[i]);
+    }
+    if (merged_bounds.back() != n) { merged_bounds.push_back(n); }
+    bounds = std::move(merged_bounds);
+    values.swap(buffer);
+  }
+}
+
+// Edge list chunks addressed as one range of edges
+template <typename vertex_t>
+struct host_renumber_edges_t {
+  std::vector<vertex_t*> majors{};
+  std::vector<vertex_t*> minors{};
+  std::vector<size_t> offsets{0};
+
+  size_t size() const { return offsets.back(); }
+
+  // f(major, minor) for the edges in [first, last)
+  template <typename f_t>
+  void for_each(size_t first, size_t last, f_t f) const
+  {
+    size_t chunk = std::upper_bound(offsets.begin(), offsets.end(), first) - offsets.begin() - 1;
+    while (first < last) {
+      auto chunk_last = std::min(last, offsets[chunk + 1]);
+      auto major      = majors[chunk] - offsets[chunk];
+      auto minor      = minors[chunk] - offsets[chunk];
+      for (auto e = first; e < chunk_last; ++e) {
+        f(major[e], minor[e]);
+      }
+      first = chunk_last;
+      ++chunk;
+    }
+  }
+};
+
+// HyperLogLog estimate of the number of distinct edge endpoints
+template <typename vertex_t>
+double host_renumber_estimate_distinct(host_renumber_edges_t<vertex_t> const& edges,
+                                       size_t num_threads)
+{
+  constexpr int p = host_renumber_hll_precision;
+  constexpr size_t m{size_t{1} << p};
+
+  std::vector<std::vector<uint8_t>> registers(num_threads);
+  auto num_parts = host_renumber_parallel_for(
+    edges.size(), num_threads, [&](size_t part, size_t first, size_t last) {
+      auto& part_registers = registers[part];
+      part_registers.assign(m, uint8_t{0});
+      auto add = [&](vertex_t v) {
+        auto h    = host_renumber_hash(static_cast<uint64_t>(v));
+        auto rank = static_cast<uint8_t>(
+          __builtin_clzll((h << p) | (uint64_t{1} << (p - 1))) + 1);
+        auto& reg = part_registers[h >> (64 - p)];
+        reg       = std::max(reg, rank);
+      };
+      edges.for_each(first, last, [&](vertex_t major, vertex_t minor) {
+        add(major);
+        add(minor);
+      });
+    });
+
+  double sum{0};
+  size_t zeros{0};
+  for (size_t j = 0; j < m; ++j) {
+    uint8_t reg{0};
+    for (size_t part = 0; part < num_parts; ++part) {
+      reg = std::max(reg, registers[part][j]);
+    }
+    sum += std::ldexp(1.0, -static_cast<int>(reg));
+    if (reg == 0) { ++zeros; }
+  }
+  double estimate = (0.7213 / (1.0 + 1.079 / m)) * m * m / sum;
+  if ((estimate <= 2.5 * m) && (zeros > 0)) {
+    estimate = m * std::log(static_cast<double>(m) / zeros);
+  }
+  return estimate;
+}
+
+/**
+ * Lock-free set of vertices with a major degree counter per vertex, linear probing.
+ *
+ * invalid_vertex_id marks empty slots; that vertex ID is kept in its own slot past the table.
+ */
+template <typename vertex_t, typename edge_t>
+struct host_renumber_table_t {
+  static constexpr vertex_t empty_key{invalid_vertex_id<vertex_t>::value};
+  static constexpr size_t not_found{std::numeric_limits<size_t>::max()};
+
+  host_renumber_table_t(size_t capacity, size_t num_threads)
+    : capacity_(capacity),
+      mask_(capacity - 1),
+      keys_(new std::atomic<vertex_t>[capacity + 1]),
+      degrees_(new std::atomic<edge_t>[capacity + 1])
+  {
+    host_renumber_parallel_for(capacity + 1, num_threads, [&](size_t, size_t first, size_t last) {
+      for (auto slot = first; slot < last; ++slot) {
+        keys_[slot].store(empty_key, std::memory_order_relaxed);
+        degrees_[slot].store(edge_t{0}, std::memory_order_relaxed);
+      }
+    });
+  }
+
+  size_t capacity() const { return capacity_; }
+
+  // returns the slot of v, inserting v if it is new, or not_found if the table is full
+  size_t insert(vertex_t v, bool& inserted)
+  {
+    inserted = false;
+    if (v == empty_key) {
+      inserted = !empty_key_inserted_.exchange(true, std::memory_order_relaxed);
+      return capacity_;
+    }
+    auto slot = host_renumber_hash(static_cast<uint64_t>(v)) & mask_;
+    for (size_t probes = 0; probes < capacity_; ++probes) {
+      auto key = keys_[slot].load(std::memory_order_relaxed);
+      if (key == empty_key) {
+        if (keys_[slot].compare_exchange_strong(key, v, std::memory_order_relaxed)) {
+          inserted = true;
+          return slot;
+        }
+      }
+      if (key == v) { return slot; }
+      slot = (slot + 1) & mask_;
+    }
+    return not_found;
+  }
+
+  size_t find(vertex_t v) const
+  {
+    if (v == empty_key) {
+      return empty_key_inserted_.load(std::memory_order_relaxed) ? capacity_ : not_found;
+    }
+    auto slot = host_renumber_hash(static_cast<uint64_t>(v)) & mask_;
+    for (size_t probes = 0; probes < capacity_; ++probes) {
+      auto key = keys_[slot].load(std::memory_order_relaxed);
+      if (key == v) { return slot; }
+      if (key == empty_key) { return not_found; }
+      slot = (slot + 1) & mask_;
+    }
+    return not_found;
+  }
+
+  bool occupied(size_t slot) const
+  {
+    return (slot < capacity_) ? (keys_[slot].load(std::memory_order_relaxed) != empty_key)
+                              : empty_key_inserted_.load(std::memory_order_relaxed);
+  }
+
+  vertex_t key(size_t slot) const { return keys_[slot].load(std::memory_order_relaxed); }
+
+  std::atomic<edge_t>& degree(size_t slot) { return degrees_[slot]; }
+
+ private:
+  size_t capacity_{};
+  size_t mask_{};
+  std::unique_ptr<std::atomic<vertex_t>[]> keys_{};
+  std::unique_ptr<std::atomic<edge_t>[]> degrees_{};
+  std::atomic<bool> empty_key_inserted_{false};
+};
+
+template <typename vertex_t, typename edge_t>
+struct host_renumber_entry_t {
+  edge_t degree;
+  vertex_t label;
+  size_t slot;
+};
+
+template <typename vertex_t>
+vertex_t host_vertex_map_wait(std::atomic<vertex_t> const& value, size_t max_number_of_vertices)
+{
+  for (size_t spins = 0;; ++spins) {
+    auto v = value.load(std::memory_order_acquire);
+    if (v >= 0) { return v; }
+    CUGRAPH_EXPECTS(v != host_vertex_map_failed,
+                    "Invalid input arguments: more than %zu vertices were inserted into the "
+                    "vertex map.",
+                    max_number_of_vertices);
+    if (spins >= 64) { std::this_thread::yield(); }
+  }
+}
+
+}  // namespace detail
+
+template <typename vertex_t, typename edge_t>
+std::tuple<std::vector<vertex_t>, std::vector<vertex_t>> host_renumber_edgelist(
+  std::optional<raft::host_span<vertex_t const>> vertices,
+  std::vector<raft::host_span<vertex_t>> const& edgelist_srcs,
+  std::vector<raft::host_span<vertex_t>> const& edgelist_dsts,
+  bool store_transposed,
+  size_t num_threads,
+  bool do_expensive_check)
+{
+  using table_t = detail::host_renumber_table_t<vertex_t, edge_t>;
+  using entry_t = detail::host_renumber_entry_t<vertex_t, edge_t>;
+
+  CUGRAPH_EXPECTS(edgelist_srcs.size() == edgelist_dsts.size(),
+                  "Invalid input arguments: edgelist_srcs.size() != edgelist_dsts.size().");
+
+  num_threads = detail::host_renumber_num_threads(num_threads);
+
+  detail::host_renumber_edges_t<vertex_t> edges{};
+  for (size_t i = 0; i < edgelist_srcs.size(); ++i) {
+    CUGRAPH_EXPECTS(edgelist_srcs[i].size() == edgelist_dsts[i].size(),
+                    "Invalid input arguments: edgelist_srcs[%zu].size() != "
+                    "edgelist_dsts[%zu].size().",
+                    i,
+                    i);
+    edges.majors.push_back(store_transposed ? edgelist_dsts[i].data() : edgelist_srcs[i].data());
+    edges.minors.push_back(store_transposed ? edgelist_srcs[i].data() : edgelist_dsts[i].data());
+    edges.offsets.push_back(edges.offsets.back() + edgelist_srcs[i].size());
+  }
+
+  // 1. insert the vertices, counting major degrees
+
+  auto capacity = detail::host_renumber_table_capacity(
+    vertices ? vertices->size()
+             : static_cast<size_t>(
+                 1.05 * detail::host_renumber_estimate_distinct(edges, num_threads)));
+
+  std::unique_ptr<table_t> table{};
+  while (true) {
+    table = std::make_unique<table_t>(capacity, num_threads);
+
+    // a table that fills past 3/4 is rebuilt twice as large, this only happens if the estimate
+    // was far off
+    std::atomic<size_t> size{0};
+    std::atomic<bool> overflow{false};
+    std::atomic<bool> duplicate{false};
+    std::atomic<bool> missing{false};
+    auto max_size = capacity / 4 * 3;
+
+    if (vertices) {
+      detail::host_renumber_parallel_for(
+        vertices->size(), num_threads, [&](size_t, size_t first, size_t last) {
+          for (auto i = first; i < last; ++i) {
+            bool inserted{};
+            table->insert((*vertices)[i], inserted);
+            if (!inserted) { duplicate.store(true, std::memory_order_relaxed); }
+          }
+        });
+      CUGRAPH_EXPECTS(!do_expensive_check || !duplicate,
+                      "Invalid input argument: vertices should not have duplicates.");
+
+      detail::host_renumber_parallel_for(
+        edges.size(), num_threads, [&](size_t, size_t first, size_t last) {
+          edges.for_each(first, last, [&](vertex_t major, vertex_t minor) {
+            auto slot = table->find(major);
+            if ((slot == table_t::not_found) || (table->find(minor) == table_t::not_found)) {
+              missing.store(true, std::memory_order_relaxed);
+              return;
+            }
+            table->degree(slot).fetch_add(edge_t{1}, std::memory_order_relaxed);
+          });
+        });
+      CUGRAPH_EXPECTS(!missing,
+                      "Invalid input arguments: edge list vertices should be in vertices.");
+    } else {
+      detail::host_renumber_parallel_for(
+        edges.size(), num_threads, [&](size_t, size_t first, size_t last) {
+          size_t local_size{0};
+          auto insert = [&](vertex_t v) {
+            bool inserted{};
+            auto slot = table->insert(v, inserted);
+            if (slot == table_t::not_found) {
+              overflow.store(true, std::memory_order_relaxed);
+            } else if (inserted && (++local_size == 1024)) {
+              if (size.fetch_add(local_size, std::memory_order_relaxed) + local_size > max_size) {
+                overflow.store(true, std::memory_order_relaxed);
+              }
+              local_size = 0;
+            }
+            return slot;
+          };
+          constexpr size_t batch{size_t{1} << 14};
+          for (auto batch_first = first; batch_first < last; batch_first += batch) {
+            if (overflow.load(std::memory_order_relaxed)) { return; }
+            auto batch_last = std::min(batch_first + batch, last);
+            edges.for_each(batch_first, batch_last, [&](vertex_t major, vertex_t minor) {
+              auto slot = insert(major);
+              if (slot != table_t::not_found) {
+                table->degree(slot).fetch_add(edge_t{1}, std::memory_order_relaxed);
+              }
+              insert(minor);
+            });
+          }
+        });
+      if (overflow) {
+        capacity *= 2;
+        continue;
+      }
+    }
+    break;
+  }
+
+  // 2. compact the vertices with a prefix sum over the table and sort them by degree
+
+  auto num_slots = table->capacity() + 1;
+  std::vector<size_t> part_counts(num_threads + 1, size_t{0});
+  auto num_parts = detail::host_renumber_parallel_for(
+    num_slots, num_threads, [&](size_t part, size_t first, size_t last) {
+      size_t count{0};
+      for (auto slot = first; slot < last; ++slot) {
+        if (table->occupied(slot)) { ++count; }
+      }
+      part_counts[part + 1] = count;
+    });
+  std::partial_sum(part_counts.begin(), part_counts.begin() + num_parts + 1, part_counts.begin());
+  auto number_of_vertices = part_counts[num_parts];
+  CUGRAPH_EXPECTS(
+    number_of_vertices <= static_cast<size_t>(std::numeric_limits<vertex_t>::max()),
+    "Invalid input arguments: the number of vertices does not fit in vertex_t.");
+
+  std::vector<entry_t> entries(number_of_vertices);
+  detail::host_renumber_parallel_for(
+    num_slots, num_threads, [&](size_t part, size_t first, size_t last) {
+      auto position = part_counts[part];
+      for (auto slot = first; slot < last; ++slot) {
+        if (table->occupied(slot)) {
+          entries[position++] =
+            entry_t{table->degree(slot).load(std::memory_order_relaxed),
+                    (slot < table->capacity()) ? table->key(slot) : table_t::empty_key,
+                    slot};
+        }
+      }
+    });
+
+  detail::host_renumber_parallel_sort(
+    entries,
+    [](entry_t const& lhs, entry_t const& rhs) {
+      return (lhs.degree > rhs.degree) || ((lhs.degree == rhs.degree) && (lhs.label < rhs.label));
+    },
+    num_threads);
+
+  // 3. assign the new vertex IDs and relabel the edges
+
+  std::vector<vertex_t> renumber_map_labels(number_of_vertices);
+  std::vector<vertex_t> slot_vertices(num_slots);
+  detail::host_renumber_parallel_for(
+    number_of_vertices, num_threads, [&](size_t, size_t first, size_t last) {
+      for (auto i = first; i < last; ++i) {
+        renumber_map_labels[i]          = entries[i].label;
+        slot_vertices[entries[i].slot] = static_cast<vertex_t>(i);
+      }
+    });
+
+  detail::host_renumber_parallel_for(
+    edges.size(), num_threads, [&](size_t, size_t first, size_t last) {
+      edges.for_each(first, last, [&](vertex_t& major, vertex_t& minor) {
+        major = slot_vertices[table->find(major)];
+        minor = slot_vertices[table->find(minor)];
+      });
+    });
+
+  // 4. segment offsets (high, mid, low and zero degree vertices), as in the single-GPU path
+
+  std::vector<vertex_t> segment_offsets{vertex_t{0}};
+  for (size_t threshold : {detail::mid_degree_threshold, detail::low_degree_threshold, size_t{1}}) {
+    auto it = std::partition_point(entries.begin(), entries.end(), [threshold](auto const& e) {
+      return static_cast<size_t>(e.degree) >= threshold;
+    });
+    segment_offsets.push_back(static_cast<vertex_t>(it - entries.begin()));
+  }
+  segment_offsets.push_back(static_cast<vertex_t>(number_of_vertices));
+
+  return std::make_tuple(std::move(renumber_map_labels), std::move(segment_offsets));
+}
+
+template <typename vertex_t>
+host_vertex_map_t<vertex_t>::host_vertex_map_t(size_t max_number_of_vertices)
+  : max_number_of_vertices_(max_number_of_vertices),
+    mask_(detail::host_renumber_table_capacity(max_number_of_vertices) - 1),
+    keys_(new std::atomic<vertex_t>[mask_ + 1]),
+    values_(new std::atomic<vertex_t>[mask_ + 1]),
+    labels_(new vertex_t[max_number_of_vertices]),
+    empty_key_value_(detail::host_vertex_map_pending)
+{
+  for (size_t slot = 0; slot <= mask_; ++slot) {
+    keys_[slot].store(invalid_vertex_id<vertex_t>::value, std::memory_order_relaxed);
+    values_[slot].store(detail::host_vertex_map_pending, std::memory_order_relaxed);
+  }
+}
+
+template <typename vertex_t>
+vertex_t host_vertex_map_t<vertex_t>::assign(vertex_t v, std::atomic<vertex_t>& value)
+{
+  auto id = count_.fetch_add(1, std::memory_order_relaxed);
+  if (id >= max_number_of_vertices_) {
+    value.store(detail::host_vertex_map_failed, std::memory_order_release);
+    CUGRAPH_FAIL(
+      "Invalid input arguments: more than %zu vertices were inserted into the vertex map.",
+      max_number_of_vertices_);
+  }
+  labels_[id] = v;
+  value.store(static_cast<vertex_t>(id), std::memory_order_release);
+  return static_cast<vertex_t>(id);
+}
+
+template <typename vertex_t>
+vertex_t host_vertex_map_t<vertex_t>::insert(vertex_t v)
+{
+  constexpr vertex_t empty_key{invalid_vertex_id<vertex_t>::value};
+
+  if (v == empty_key) {
+    if (!empty_key_inserted_.exchange(true, std::memory_order_acq_rel)) {
+      return assign(v, empty_key_value_);
+    }
+    return detail::host_vertex_map_wait(empty_key_value_, max_number_of_vertices_);
+  }
+
+  auto slot = detail::host_renumber_hash(static_cast<uint64_t>(v)) & mask_;
+  for (size_t probes = 0; probes <= mask_; ++probes) {
+    auto key = keys_[slot].load(std::memory_order_acquire);
+    if (key == empty_key) {
+      if (keys_[slot].compare_exchange_strong(key, v, std::memory_order_acq_rel)) {
+        return assign(v, values_[slot]);
+      }
+    }
+    if (key == v) { return detail::host_vertex_map_wait(values_[slot], max_number_of_vertices_); }
+    slot = (slot + 1) & mask_;
+  }
+  CUGRAPH_FAIL("Invalid input arguments: more than %zu vertices were inserted into the vertex map.",
+               max_number_of_vertices_);
+}
+
+template <typename vertex_t>
+void host_vertex_map_t<vertex_t>::insert(raft::host_span<vertex_t const> vertices,
+                                         raft::host_span<vertex_t> internal_vertices)
+{
+  CUGRAPH_EXPECTS(vertices.size() == internal_vertices.size(),
+                  "Invalid input arguments: vertices.size() != internal_vertices.size().");
+  for (size_t i = 0; i < vertices.size(); ++i) {
+    internal_vertices[i] = insert(vertices[i]);
+  }
+}
+
+template <typename vertex_t>
+vertex_t host_vertex_map_t<vertex_t>::find(vertex_t v) const
+{
+  constexpr vertex_t empty_key{invalid_vertex_id<vertex_t>::value};
+
+  if (v == empty_key) {
+    return empty_key_inserted_.load(std::memory_order_acquire)
+             ? detail::host_vertex_map_wait(empty_key_value_, max_number_of_vertices_)
+             : invalid_vertex_id<vertex_t>::value;
+  }
+
+  auto slot = detail::host_renumber_hash(static_cast<uint64_t>(v)) & mask_;
+  for (size_t probes = 0; probes <= mask_; ++probes) {
+    auto key = keys_[slot].load(std::memory_order_acquire);
+    if (key == v) { return detail::host_vertex_map_wait(values_[slot], max_number_of_vertices_); }
+    if (key == empty_key) { break; }
+    slot = (slot + 1) & mask_;
+  }
+  return invalid_vertex_id<vertex_t>::value;
+}
+
+template <typename vertex_t>
+vertex_t host_vertex_map_t<vertex_t>::number_of_vertices() const
+{
+  return static_cast<vertex_t>(
+    std::min(count_.load(std::memory_order_acquire), max_number_of_vertices_));
+}
+
+template <typename vertex_t>
+std::vector<vertex_t> host_vertex_map_t<vertex_t>::renumber_map() const
+{
+  return std::vector<vertex_t>(labels_.get(), labels_.get() + number_of_vertices());
+}
+
+template std::tuple<std::vector<int32_t>, std::vector<int32_t>>
+host_renumber_edgelist<int32_t, int32_t>(std::optional<raft::host_span<int32_t const>> vertices,
+                                         std::vector<raft::host_span<int32_t>> const& edgelist_srcs,
+                                         std::vector<raft::host_span<int32_t>> const& edgelist_dsts,
+                                         bool store_transposed,
+                                         size_t num_threads,
+                                         bool do_expensive_check);
+
+template std::tuple<std::vector<int64_t>, std::vector<int64_t>>
+host_renumber_edgelist<int64_t, int64_t>(std::optional<raft::host_span<int64_t const>> vertices,
+                                         std::vector<raft::host_span<int64_t>> const& edgelist_srcs,
+                                         std::vector<raft::host_span<int64_t>> const& edgelist_dsts,
+                                         bool store_transposed,
+                                         size_t num_threads,
+                                         bool do_expensive_check);
+
+template class host_vertex_map_t<int32_t>;
+template class host_vertex_map_t<int64_t>;
+
+}  // namespace cugraph
@@ -57,6 +57,11 @@ int run_sg_test_new(int (*test)(const cugraph_resource_handle_t*),
 
 #define RUN_TEST_NEW(test_name, handle) run_sg_test_new(test_name, #test_name, handle)
 
+/*
+ * Microseconds from start to stop, both read with clock_gettime(CLOCK_MONOTONIC, ...).
+ */
+double elapsed_us(struct timespec const* start, struct timespec const* stop);
+
 int nearlyEqual(float a, float b, float epsilon);
 int nearlyEqualDouble(double a, double b, double epsilon);
 
@@ -82,6 +87,46 @@ int create_test_graph_double(const cugraph_resource_handle_t* p_handle,
                              cugraph_graph_t** p_graph,
                              cugraph_error_t** ret_error);
 
+int create_host_test_graph(const cugraph_resource_handle_t* p_handle,
+                           int32_t* h_src,
+                           int32_t* h_dst,
+                           float* h_wgt,
+                           size_t num_edges,
+                           bool_t renumber,
+                           cugraph_graph_t** p_graph,
+                           cugraph_error_t** ret_error);
+
+/*
+ * Creates a host graph with the given is_symmetric property; vertices are not renumbered and no
+ * edges are dropped.
+ */
+int create_symmetric_host_graph(const cugraph_resource_handle_t* p_handle,
+                                int32_t* h_src,
+                                int32_t* h_dst,
+                                float* h_wgt,
+                                size_t num_edges,
+                                bool_t is_symmetric,
+                                cugraph_graph_t** p_graph);
+
+/*
+ * Generates edge_factor << scale power law (R-MAT) edges over the vertex ids below 1 << scale and
+ * returns the number of edges.  The edges hold both directions of every generated edge, sorted by
+ * source and destination, without self loops and multi-edges; *h_src and *h_dst are allocated
+ * with malloc.
+ */
+size_t generate_symmetric_rmat_edges(
+  int scale, size_t edge_factor, uint64_t seed, int32_t** h_src, int32_t** h_dst);
+
+/*
+ * Naive reference triangle count: fills h_counts with the triangles of every vertex below
+ * num_vertices of a symmetric edge list sorted by source and destination.
+ */
+void count_triangles_naive(int32_t const* h_src,
+                           int32_t const* h_dst,
+                           size_t num_edges,
+                           size_t num_vertices,
+                           int32_t* h_counts);
+
 int create_sg_test_graph(const cugraph_resource_handle_t* handle,
                          cugraph_data_type_id_t vertex_tid,
                          cugraph_data_type_id_t edge_tid,
@@ -0,0 +1,264 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "c_test_utils.h" /* RUN_TEST */
+
+#include <cugraph_c/algorithms.h>
+#include <cugraph_c/graph.h>
+
+#include <float.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+typedef int32_t vertex_t;
+typedef int32_t edge_t;
+typedef float weight_t;
+
+/* Creates a host graph, writes it to a temporary CSR file and loads it back */
+int create_host_csr_file_graph(const cugraph_resource_handle_t* p_handle,
+                               vertex_t* src,
+                               vertex_t* dst,
+                               weight_t* wgt,
+                               size_t num_edges,
+                               bool_t renumber,
+                               cugraph_graph_t** p_graph,
+                               cugraph_error_t** ret_error)
+{
+  int test_ret_value = 0;
+
+  cugraph_error_code_t ret_code = CUGRAPH_SUCCESS;
+  cugraph_graph_t* p_host_graph = NULL;
+
+  char path[] = "/tmp/cugraph_host_csr_file_test_XXXXXX";
+  int fd      = mkstemp(path);
+  TEST_ASSERT(test_ret_value, fd >= 0, "temporary file creation failed.");
+  close(fd);
+
+  test_ret_value =
+    create_host_test_graph(p_handle, src, dst, wgt, num_edges, renumber, &p_host_graph, ret_error);
+
+  if (test_ret_value == 0) {
+    ret_code = cugraph_graph_write_host_csr_file(p_handle, p_host_graph, path, ret_error);
+    TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, cugraph_error_message(*ret_error));
+  }
+
+  if (test_ret_value == 0) {
+    ret_code = cugraph_graph_create_sg_from_host_csr_file(p_handle, path, p_graph, ret_error);
+    TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, cugraph_error_message(*ret_error));
+  }
+
+  cugraph_graph_free(p_host_graph);
+  unlink(path);
+
+  return test_ret_value;
+}
+
+int test_host_csr_file_bfs_renumbered()
+{
+  size_t num_edges    = 8;
+  size_t num_vertices = 6;
+
+  vertex_t src[]                   = {100, 101, 101, 102, 102, 102, 103, 104};
+  vertex_t dst[]                   = {101, 103, 104, 100, 101, 103, 105, 105};
+  weight_t wgt[]                   = {0.1f, 2.1f, 1.1f, 5.1f, 3.1f, 4.1f, 7.2f, 3.2f};
+  vertex_t expected_distances[]    = {0, 1, 2147483647, 2, 2, 3};
+  vertex_t expected_predecessors[] = {-1, 100, -1, 101, 101, 103};
+  vertex_t source                  = 100;
+
+  int test_ret_value = 0;
+
+  cugraph_error_code_t ret_code = CUGRAPH_SUCCESS;
+  cugraph_error_t* ret_error    = NULL;
+
+  cugraph_resource_handle_t* p_handle                    = NULL;
+  cugraph_graph_t* p_graph                               = NULL;
+  cugraph_paths_result_t* p_result                       = NULL;
+  cugraph_type_erased_device_array_t* p_sources          = NULL;
+  cugraph_type_erased_device_array_view_t* p_source_view = NULL;
+
+  p_handle = cugraph_create_resource_handle(NULL);
+  TEST_ASSERT(test_ret_value, p_handle != NULL, "resource handle creation failed.");
+
+  test_ret_value =
+    create_host_csr_file_graph(p_handle, src, dst, wgt, num_edges, TRUE, &p_graph, &ret_error);
+
+  ret_code = cugraph_type_erased_device_array_create(p_handle, 1, INT32, &p_sources, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "p_sources create failed.");
+
+  p_source_view = cugraph_type_erased_device_array_view(p_sources);
+
+  ret_code = cugraph_type_erased_device_array_view_copy_from_host(
+    p_handle, p_source_view, (byte_t*)&source, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "src copy_from_host failed.");
+
+  ret_code = cugraph_bfs(
+    p_handle, p_graph, p_source_view, FALSE, 10000000, TRUE, FALSE, &p_result, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, cugraph_error_message(ret_error));
+
+  vertex_t h_vertices[num_vertices];
+  vertex_t h_distances[num_vertices];
+  vertex_t h_predecessors[num_vertices];
+
+  ret_code = cugraph_type_erased_device_array_view_copy_to_host(
+    p_handle, (byte_t*)h_vertices, cugraph_paths_result_get_vertices(p_result), &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+  ret_code = cugraph_type_erased_device_array_view_copy_to_host(
+    p_handle, (byte_t*)h_distances, cugraph_paths_result_get_distances(p_result), &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+  ret_code = cugraph_type_erased_device_array_view_copy_to_host(
+    p_handle, (byte_t*)h_predecessors, cugraph_paths_result_get_predecessors(p_result), &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+  for (int i = 0; (i < num_vertices) && (test_ret_value == 0); ++i) {
+    TEST_ASSERT(test_ret_value,
+                expected_distances[h_vertices[i] - 100] == h_distances[i],
+                "bfs distances don't match");
+
+    TEST_ASSERT(test_ret_value,
+                expected_predecessors[h_vertices[i] - 100] == h_predecessors[i],
+                "bfs predecessors don't match");
+  }
+
+  cugraph_paths_result_free(p_result);
+  cugraph_type_erased_device_array_free(p_sources);
+  cugraph_graph_free(p_graph);
+  cugraph_free_resource_handle(p_handle);
+  cugraph_error_free(ret_error);
+
+  return test_ret_value;
+}
+
+int test_host_csr_file_sssp()
+{
+  size_t num_edges    = 8;
+  size_t num_vertices = 6;
+
+  vertex_t src[]                   = {0, 1, 1, 2, 2, 2, 3, 4};
+  vertex_t dst[]                   = {1, 3, 4, 0, 1, 3, 5, 5};
+  weight_t wgt[]                   = {0.1f, 2.1f, 1.1f, 5.1f, 3.1f, 4.1f, 7.2f, 3.2f};
+  weight_t expected_distances[]    = {0.0f, 0.1f, FLT_MAX, 2.2f, 1.2f, 4.4f};
+  vertex_t expected_predecessors[] = {-1, 0, -1, 1, 1, 4};
+
+  int test_ret_value = 0;
+
+  cugraph_error_code_t ret_code = CUGRAPH_SUCCESS;
+  cugraph_error_t* ret_error    = NULL;
+
+  cugraph_resource_handle_t* p_handle = NULL;
+  cugraph_graph_t* p_graph            = NULL;
+  cugraph_paths_result_t* p_result    = NULL;
+
+  p_handle = cugraph_create_resource_handle(NULL);
+  TEST_ASSERT(test_ret_value, p_handle != NULL, "resource handle creation failed.");
+
+  test_ret_value =
+    create_host_csr_file_graph(p_handle, src, dst, wgt, num_edges, FALSE, &p_graph, &ret_error);
+
+  ret_code = cugraph_sssp(p_handle, p_graph, 0, 10, TRUE, FALSE, &p_result, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, cugraph_error_message(ret_error));
+
+  vertex_t h_vertices[num_vertices];
+  weight_t h_distances[num_vertices];
+  vertex_t h_predecessors[num_vertices];
+
+  ret_code = cugraph_type_erased_device_array_view_copy_to_host(
+    p_handle, (byte_t*)h_vertices, cugraph_paths_result_get_vertices(p_result), &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+  ret_code = cugraph_type_erased_device_array_view_copy_to_host(
+    p_handle, (byte_t*)h_distances, cugraph_paths_result_get_distances(p_result), &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+  ret_code = cugraph_type_erased_device_array_view_copy_to_host(
+    p_handle, (byte_t*)h_predecessors, cugraph_paths_result_get_predecessors(p_result), &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+  for (int i = 0; (i < num_vertices) && (test_ret_value == 0); ++i) {
+    TEST_ASSERT(test_ret_value,
+                nearlyEqual(expected_distances[h_vertices[i]], h_distances[i], 0.0001),
+                "sssp distances don't match");
+
+    TEST_ASSERT(test_ret_value,
+                expected_predecessors[h_vertices[i]] == h_predecessors[i],
+                "sssp predecessors don't match");
+  }
+
+  cugraph_paths_result_free(p_result);
+  cugraph_graph_free(p_graph);
+  cugraph_free_resource_handle(p_handle);
+  cugraph_error_free(ret_error);
+
+  return test_ret_value;
+}
+
+int test_host_csr_file_device_graph()
+{
+  size_t num_edges = 8;
+
+  vertex_t src[] = {0, 1, 1, 2, 2, 2, 3, 4};
+  vertex_t dst[] = {1, 3, 4, 0, 1, 3, 5, 5};
+  weight_t wgt[] = {0.1f, 2.1f, 1.1f, 5.1f, 3.1f, 4.1f, 7.2f, 3.2f};
+
+  int test_ret_value = 0;
+
+  cugraph_error_code_t ret_code = CUGRAPH_SUCCESS;
+  cugraph_error_t* ret_error    = NULL;
+
+  cugraph_resource_handle_t* p_handle = NULL;
+  cugraph_graph_t* p_graph            = NULL;
+
+  p_handle = cugraph_create_resource_handle(NULL);
+  TEST_ASSERT(test_ret_value, p_handle != NULL, "resource handle creation failed.");
+
+  test_ret_value = create_test_graph(
+    p_handle, src, dst, wgt, num_edges, FALSE, FALSE, FALSE, &p_graph, &ret_error);
+
+  ret_code = cugraph_graph_write_host_csr_file(
+    p_handle, p_graph, "/tmp/cugraph_host_csr_file_device_graph", &ret_error);
+  TEST_ASSERT(test_ret_value,
+              ret_code == CUGRAPH_INVALID_INPUT,
+              "writing a device graph to a CSR file should fail.");
+  cugraph_graph_free(p_graph);
+  cugraph_error_free(ret_error);
+  p_graph   = NULL;
+  ret_error = NULL;
+
+  ret_code = cugraph_graph_create_sg_from_host_csr_file(
+    p_handle, "/tmp/cugraph_host_csr_file_does_not_exist", &p_graph, &ret_error);
+  TEST_ASSERT(
+    test_ret_value, ret_code != CUGRAPH_SUCCESS, "loading a missing CSR file should fail.");
+
+  cugraph_graph_free(p_graph);
+  cugraph_free_resource_handle(p_handle);
+  cugraph_error_free(ret_error);
+
+  return test_ret_value;
+}
+
+/******************************************************************************/
+
+int main(int argc, char** argv)
+{
+  int result = 0;
+  result |= RUN_TEST(test_host_csr_file_bfs_renumbered);
+  result |= RUN_TEST(test_host_csr_file_sssp);
+  result |= RUN_TEST(test_host_csr_file_device_graph);
+  return result;
+}
@@ -0,0 +1,636 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Times the algorithms on graphs created from host arrays against the same graphs created on the
+ * device or against a naive reference, and reports the quality of the host clustering.  This is
+ * built with the C API tests but not run by ctest; the correctness checks are in the
+ * host_*_test.c tests.
+ */
+
+#include "c_test_utils.h" /* RUN_TEST */
+
+#include <cugraph_c/algorithms.h>
+#include <cugraph_c/graph.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+typedef int32_t vertex_t;
+typedef int32_t edge_t;
+typedef float weight_t;
+
+/*
+ * Fills num_vertices * average_degree random edges with weights in [1, 11); the first
+ * num_vertices edges form a ring so that every vertex is reachable from vertex 0.
+ */
+static void generate_random_edges(size_t num_vertices,
+                                  size_t average_degree,
+                                  vertex_t** src,
+                                  vertex_t** dst,
+                                  weight_t** wgt)
+{
+  size_t num_edges = num_vertices * average_degree;
+
+  *src = (vertex_t*)malloc(num_edges * sizeof(vertex_t));
+  *dst = (vertex_t*)malloc(num_edges * sizeof(vertex_t));
+  *wgt = (weight_t*)malloc(num_edges * sizeof(weight_t));
+
+  srand(42);
+  for (size_t i = 0; i < num_edges; ++i) {
+    (*src)[i] = (vertex_t)(i % num_vertices);
+    (*dst)[i] = (i < num_vertices) ? (vertex_t)((i + 1) % num_vertices)
+                                   : (vertex_t)(rand() % num_vertices);
+    (*wgt)[i] = 1.0f + (float)(rand() % 100) / 10.0f;
+  }
+}
+
+/*
+ * Creates the host graph (on_host) or the device graph of the edges.
+ */
+static int create_graph(const cugraph_resource_handle_t* p_handle,
+                        int on_host,
+                        vertex_t* src,
+                        vertex_t* dst,
+                        weight_t* wgt,
+                        size_t num_edges,
+                        cugraph_graph_t** p_graph)
+{
+  int test_ret_value         = 0;
+  cugraph_error_t* ret_error = NULL;
+
+  if (on_host) {
+    test_ret_value =
+      create_host_test_graph(p_handle, src, dst, wgt, num_edges, FALSE, p_graph, &ret_error);
+  } else {
+    test_ret_value = create_test_graph(
+      p_handle, src, dst, wgt, num_edges, FALSE, FALSE, FALSE, p_graph, &ret_error);
+  }
+
+  cugraph_error_free(ret_error);
+  return test_ret_value;
+}
+
+/*
+ * Copies the vertices to a new device array.
+ */
+static int copy_vertices_to_device(const cugraph_resource_handle_t* p_handle,
+                                   vertex_t* h_vertices,
+                                   size_t num_vertices,
+                                   cugraph_type_erased_device_array_t** d_vertices,
+                                   cugraph_type_erased_device_array_view_t** d_vertices_view)
+{
+  int test_ret_value = 0;
+
+  cugraph_error_code_t ret_code;
+  cugraph_error_t* ret_error = NULL;
+
+  ret_code =
+    cugraph_type_erased_device_array_create(p_handle, num_vertices, INT32, d_vertices, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "device array create failed.");
+
+  *d_vertices_view = cugraph_type_erased_device_array_view(*d_vertices);
+
+  ret_code = cugraph_type_erased_device_array_view_copy_from_host(
+    p_handle, *d_vertices_view, (byte_t*)h_vertices, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_from_host failed.");
+
+  cugraph_error_free(ret_error);
+  return test_ret_value;
+}
+
+/*
+ * BFS latency from vertex 0, the time includes copying the distances and predecessors back.
+ */
+int bench_host_bfs_latency()
+{
+  size_t graph_sizes[]  = {1000, 10000, 100000};
+  size_t average_degree = 8;
+
+  int test_ret_value = 0;
+
+  cugraph_error_code_t ret_code;
+  cugraph_error_t* ret_error = NULL;
+
+  cugraph_resource_handle_t* p_handle = NULL;
+
+  p_handle = cugraph_create_resource_handle(NULL);
+  TEST_ASSERT(test_ret_value, p_handle != NULL, "resource handle creation failed.");
+
+  for (size_t s = 0; (s < sizeof(graph_sizes) / sizeof(graph_sizes[0])) && (test_ret_value == 0);
+       ++s) {
+    size_t num_vertices = graph_sizes[s];
+    size_t num_edges    = num_vertices * average_degree;
+
+    vertex_t *src, *dst;
+    weight_t* wgt;
+    generate_random_edges(num_vertices, average_degree, &src, &dst, &wgt);
+
+    vertex_t* h_distances    = (vertex_t*)malloc(num_vertices * sizeof(vertex_t));
+    vertex_t* h_predecessors = (vertex_t*)malloc(num_vertices * sizeof(vertex_t));
+
+    for (int on_host = 1; (on_host >= 0) && (test_ret_value == 0); --on_host) {
+      cugraph_graph_t* p_graph                               = NULL;
+      cugraph_paths_result_t* p_result                       = NULL;
+      cugraph_type_erased_device_array_t* d_source           = NULL;
+      cugraph_type_erased_device_array_view_t* d_source_view = NULL;
+
+      vertex_t source = 0;
+
+      test_ret_value = create_graph(p_handle, on_host, src, dst, wgt, num_edges, &p_graph);
+      if (test_ret_value == 0) {
+        test_ret_value = copy_vertices_to_device(p_handle, &source, 1, &d_source, &d_source_view);
+      }
+
+      struct timespec begin, end;
+
+      clock_gettime(CLOCK_MONOTONIC, &begin);
+      if (test_ret_value == 0) {
+        ret_code = cugraph_bfs(
+          p_handle, p_graph, d_source_view, TRUE, 10000000, TRUE, FALSE, &p_result, &ret_error);
+        TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, cugraph_error_message(ret_error));
+      }
+      if (test_ret_value == 0) {
+        ret_code = cugraph_type_erased_device_array_view_copy_to_host(
+          p_handle,
+          (byte_t*)h_distances,
+          cugraph_paths_result_get_distances(p_result),
+          &ret_error);
+        TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+        ret_code = cugraph_type_erased_device_array_view_copy_to_host(
+          p_handle,
+          (byte_t*)h_predecessors,
+          cugraph_paths_result_get_predecessors(p_result),
+          &ret_error);
+        TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+      }
+      clock_gettime(CLOCK_MONOTONIC, &end);
+
+      if (test_ret_value == 0) {
+        printf("  bfs, %zu vertices, %zu edges: %s graph %.1f us\n",
+               num_vertices,
+               num_edges,
+               on_host ? "host" : "device",
+               elapsed_us(&begin, &end));
+      }
+
+      cugraph_paths_result_free(p_result);
+      cugraph_type_erased_device_array_view_free(d_source_view);
+      cugraph_type_erased_device_array_free(d_source);
+      cugraph_graph_free(p_graph);
+    }
+
+    free(h_predecessors);
+    free(h_distances);
+    free(wgt);
+    free(dst);
+    free(src);
+  }
+
+  cugraph_free_resource_handle(p_handle);
+  cugraph_error_free(ret_error);
+
+  return test_ret_value;
+}
+
+/*
+ * Sampling throughput for a mini-batch workload of many small labeled batches.
+ */
+int bench_host_neighbor_sample_throughput()
+{
+  size_t num_vertices    = 100000;
+  size_t average_degree  = 16;
+  size_t num_labels      = 64;
+  size_t seeds_per_label = 256;
+  int fan_out[]          = {10, 10};
+
+  size_t num_edges = num_vertices * average_degree;
+  size_t num_start = num_labels * seeds_per_label;
+
+  int test_ret_value = 0;
+
+  cugraph_error_code_t ret_code;
+  cugraph_error_t* ret_error          = NULL;
+  cugraph_resource_handle_t* p_handle = NULL;
+  cugraph_sampling_options_t* options = NULL;
+
+  p_handle = cugraph_create_resource_handle(NULL);
+  TEST_ASSERT(test_ret_value, p_handle != NULL, "resource handle creation failed.");
+
+  vertex_t *src, *dst;
+  weight_t* wgt;
+  generate_random_edges(num_vertices, average_degree, &src, &dst, &wgt);
+
+  vertex_t* start       = (vertex_t*)malloc(num_start * sizeof(vertex_t));
+  size_t* label_offsets = (size_t*)malloc((num_labels + 1) * sizeof(size_t));
+
+  for (size_t i = 0; i < num_start; ++i)
+    start[i] = (vertex_t)(rand() % num_vertices);
+  for (size_t l = 0; l <= num_labels; ++l)
+    label_offsets[l] = l * seeds_per_label;
+
+  ret_code = cugraph_sampling_options_create(&options, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "sampling_options create failed.");
+
+  cugraph_sampling_set_with_replacement(options, FALSE);
+  cugraph_sampling_set_renumber_results(options, TRUE);
+
+  for (int on_host = 1; (on_host >= 0) && (test_ret_value == 0); --on_host) {
+    cugraph_graph_t* p_graph                                      = NULL;
+    cugraph_sample_result_t* p_result                             = NULL;
+    cugraph_type_erased_device_array_t* d_start                   = NULL;
+    cugraph_type_erased_device_array_view_t* d_start_view         = NULL;
+    cugraph_type_erased_device_array_t* d_label_offsets           = NULL;
+    cugraph_type_erased_device_array_view_t* d_label_offsets_view = NULL;
+    cugraph_type_erased_host_array_view_t* h_fan_out_view         = NULL;
+    cugraph_rng_state_t* rng_state                                = NULL;
+
+    test_ret_value = create_graph(p_handle, on_host, src, dst, wgt, num_edges, &p_graph);
+    if (test_ret_value == 0) {
+      test_ret_value =
+        copy_vertices_to_device(p_handle, start, num_start, &d_start, &d_start_view);
+    }
+
+    if (test_ret_value == 0) {
+      ret_code = cugraph_type_erased_device_array_create(
+        p_handle, num_labels + 1, SIZE_T, &d_label_offsets, &ret_error);
+      TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "d_label_offsets create failed.");
+
+      d_label_offsets_view = cugraph_type_erased_device_array_view(d_label_offsets);
+
+      ret_code = cugraph_type_erased_device_array_view_copy_from_host(
+        p_handle, d_label_offsets_view, (byte_t*)label_offsets, &ret_error);
+      TEST_ASSERT(
+        test_ret_value, ret_code == CUGRAPH_SUCCESS, "label offsets copy_from_host failed.");
+
+      ret_code = cugraph_rng_state_create(p_handle, 0, &rng_state, &ret_error);
+      TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "rng_state create failed.");
+    }
+
+    h_fan_out_view = cugraph_type_erased_host_array_view_create(fan_out, 2, INT32);
+
+    struct timespec begin, end;
+
+    clock_gettime(CLOCK_MONOTONIC, &begin);
+    if (test_ret_value == 0) {
+      ret_code = cugraph_homogeneous_uniform_neighbor_sample(p_handle,
+                                                             rng_state,
+                                                             p_graph,
+                                                             d_start_view,
+                                                             d_label_offsets_view,
+                                                             h_fan_out_view,
+                                                             options,
+                                                             FALSE,
+                                                             &p_result,
+                                                             &ret_error);
+      TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, cugraph_error_message(ret_error));
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    if (test_ret_value == 0) {
+      size_t num_samples = cugraph_type_erased_device_array_view_size(
+        cugraph_sample_result_get_majors(p_result));
+
+      printf("  sampling, %zu labels x %zu seeds, fan_out {10, 10}: %s graph %.2f M samples/sec\n",
+             num_labels,
+             seeds_per_label,
+             on_host ? "host" : "device",
+             num_samples / elapsed_us(&begin, &end));
+    }
+
+    cugraph_sample_result_free(p_result);
+    cugraph_rng_state_free(rng_state);
+    cugraph_type_erased_host_array_view_free(h_fan_out_view);
+    cugraph_type_erased_device_array_view_free(d_label_offsets_view);
+    cugraph_type_erased_device_array_free(d_label_offsets);
+    cugraph_type_erased_device_array_view_free(d_start_view);
+    cugraph_type_erased_device_array_free(d_start);
+    cugraph_graph_free(p_graph);
+  }
+
+  cugraph_sampling_options_free(options);
+
+  free(label_offsets);
+  free(start);
+  free(wgt);
+  free(dst);
+  free(src);
+
+  cugraph_free_resource_handle(p_handle);
+  cugraph_error_free(ret_error);
+
+  return test_ret_value;
+}
+
+/*
+ * Uniform, biased and node2vec (p = 0.5, q = 2) walk throughput.  A first walk on each graph
+ * builds the transition tables of the host graph before the timed walks.
+ */
+int bench_host_random_walks_throughput()
+{
+  size_t num_vertices   = 100000;
+  size_t average_degree = 16;
+  size_t num_starts     = 100000;
+  size_t max_length     = 40;
+
+  size_t num_edges = num_vertices * average_degree;
+
+  char const* walk_names[] = {"uniform", "biased", "node2vec"};
+
+  int test_ret_value = 0;
+
+  cugraph_error_code_t ret_code;
+  cugraph_error_t* ret_error          = NULL;
+  cugraph_resource_handle_t* p_handle = NULL;
+
+  p_handle = cugraph_create_resource_handle(NULL);
+  TEST_ASSERT(test_ret_value, p_handle != NULL, "resource handle creation failed.");
+
+  vertex_t *src, *dst;
+  weight_t* wgt;
+  generate_random_edges(num_vertices, average_degree, &src, &dst, &wgt);
+
+  vertex_t* start = (vertex_t*)malloc(num_starts * sizeof(vertex_t));
+  for (size_t i = 0; i < num_starts; ++i)
+    start[i] = (vertex_t)(rand() % num_vertices);
+
+  for (int on_host = 1; (on_host >= 0) && (test_ret_value == 0); --on_host) {
+    cugraph_graph_t* p_graph                              = NULL;
+    cugraph_type_erased_device_array_t* d_start           = NULL;
+    cugraph_type_erased_device_array_view_t* d_start_view = NULL;
+    cugraph_rng_state_t* rng_state                        = NULL;
+
+    test_ret_value = create_graph(p_handle, on_host, src, dst, wgt, num_edges, &p_graph);
+    if (test_ret_value == 0) {
+      test_ret_value =
+        copy_vertices_to_device(p_handle, start, num_starts, &d_start, &d_start_view);
+    }
+    if (test_ret_value == 0) {
+      ret_code = cugraph_rng_state_create(p_handle, 0, &rng_state, &ret_error);
+      TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "rng_state create failed.");
+    }
+
+    for (int walk_type = 0; (walk_type < 3) && (test_ret_value == 0); ++walk_type) {
+      struct timespec begin, end;
+
+      for (int timed = 0; (timed < 2) && (test_ret_value == 0); ++timed) {
+        cugraph_random_walk_result_t* p_result = NULL;
+
+        clock_gettime(CLOCK_MONOTONIC, &begin);
+        switch (walk_type) {
+          case 0:
+            ret_code = cugraph_uniform_random_walks(
+              p_handle, rng_state, p_graph, d_start_view, max_length, &p_result, &ret_error);
+            break;
+          case 1:
+            ret_code = cugraph_biased_random_walks(
+              p_handle, rng_state, p_graph, d_start_view, max_length, &p_result, &ret_error);
+            break;
+          default:
+            ret_code = cugraph_node2vec_random_walks(p_handle,
+                                                     rng_state,
+                                                     p_graph,
+                                                     d_start_view,
+                                                     max_length,
+                                                     0.5,
+                                                     2.0,
+                                                     &p_result,
+                                                     &ret_error);
+            break;
+        }
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, cugraph_error_message(ret_error));
+
+        cugraph_random_walk_result_free(p_result);
+      }
+
+      if (test_ret_value == 0) {
+        printf("  %s walks, length %zu: %s graph %.0f walks/sec\n",
+               walk_names[walk_type],
+               max_length,
+               on_host ? "host" : "device",
+               num_starts / (elapsed_us(&begin, &end) / 1e6));
+      }
+    }
+
+    cugraph_rng_state_free(rng_state);
+    cugraph_type_erased_device_array_view_free(d_start_view);
+    cugraph_type_erased_device_array_free(d_start);
+    cugraph_graph_free(p_graph);
+  }
+
+  free(start);
+  free(wgt);
+  free(dst);
+  free(src);
+
+  cugraph_free_resource_handle(p_handle);
+  cugraph_error_free(ret_error);
+
+  return test_ret_value;
+}
+
+/*
+ * Triangle counts of a power law (R-MAT) graph on the host against a naive count that merges the
+ * full, id ordered adjacency lists of both endpoints of every edge.
+ */
+int bench_host_triangle_count_power_law()
+{
+  int scale = 16;
+
+  int test_ret_value = 0;
+
+  cugraph_error_code_t ret_code;
+  cugraph_error_t* ret_error = NULL;
+
+  cugraph_resource_handle_t* p_handle       = NULL;
+  cugraph_graph_t* p_graph                  = NULL;
+  cugraph_triangle_count_result_t* p_result = NULL;
+
+  p_handle = cugraph_create_resource_handle(NULL);
+  TEST_ASSERT(test_ret_value, p_handle != NULL, "resource handle creation failed.");
+
+  vertex_t *src, *dst;
+  size_t num_edges = generate_symmetric_rmat_edges(scale, 16, 42, &src, &dst);
+
+  /* the edges are symmetric and sorted, the last source is the largest vertex id */
+  size_t num_vertices = (size_t)src[num_edges - 1] + 1;
+  edge_t* naive       = (edge_t*)malloc(num_vertices * sizeof(edge_t));
+
+  struct timespec begin, end;
+
+  if (test_ret_value == 0) {
+    test_ret_value =
+      create_symmetric_host_graph(p_handle, src, dst, NULL, num_edges, TRUE, &p_graph);
+  }
+
+  double host_us = 0;
+  if (test_ret_value == 0) {
+    clock_gettime(CLOCK_MONOTONIC, &begin);
+    ret_code = cugraph_triangle_count(p_handle, p_graph, NULL, FALSE, &p_result, &ret_error);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, cugraph_error_message(ret_error));
+    if (test_ret_value == 0) cugraph_triangle_count_result_free(p_result);
+    host_us = elapsed_us(&begin, &end);
+  }
+
+  clock_gettime(CLOCK_MONOTONIC, &begin);
+  count_triangles_naive(src, dst, num_edges, num_vertices, naive);
+  clock_gettime(CLOCK_MONOTONIC, &end);
+  double naive_us = elapsed_us(&begin, &end);
+
+  size_t num_triangles = 0;
+  for (size_t i = 0; i < num_vertices; ++i)
+    num_triangles += naive[i];
+
+  if (test_ret_value == 0) {
+    printf("  R-MAT scale %d, %zu edges, %zu triangles: host %.1f ms, naive merge %.1f ms\n",
+           scale,
+           num_edges / 2,
+           num_triangles / 3,
+           host_us / 1e3,
+           naive_us / 1e3);
+  }
+
+  free(naive);
+  free(dst);
+  free(src);
+
+  cugraph_graph_free(p_graph);
+  cugraph_free_resource_handle(p_handle);
+  cugraph_error_free(ret_error);
+
+  return test_ret_value;
+}
+
+/*
+ * Modularity, number of clusters and time of Louvain, Leiden and ECG on a power law (R-MAT)
+ * graph on the host.  A single level of Louvain is the quality baseline.
+ */
+int bench_host_louvain_power_law()
+{
+  int scale = 16;
+
+  char const* algorithm_names[] = {"Louvain (1 level)", "Louvain", "Leiden", "ECG"};
+
+  int test_ret_value = 0;
+
+  cugraph_error_code_t ret_code;
+  cugraph_error_t* ret_error = NULL;
+
+  cugraph_resource_handle_t* p_handle = NULL;
+  cugraph_rng_state_t* p_rng_state    = NULL;
+  cugraph_graph_t* p_graph            = NULL;
+
+  p_handle = cugraph_create_resource_handle(NULL);
+  TEST_ASSERT(test_ret_value, p_handle != NULL, "resource handle creation failed.");
+
+  ret_code = cugraph_rng_state_create(p_handle, 0, &p_rng_state, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "rng_state create failed.");
+
+  vertex_t *src, *dst;
+  size_t num_edges = generate_symmetric_rmat_edges(scale, 16, 42, &src, &dst);
+
+  if (test_ret_value == 0) {
+    test_ret_value =
+      create_symmetric_host_graph(p_handle, src, dst, NULL, num_edges, TRUE, &p_graph);
+  }
+
+  for (int run = 0; (run < 4) && (test_ret_value == 0); ++run) {
+    cugraph_hierarchical_clustering_result_t* p_result = NULL;
+    struct timespec begin, end;
+
+    clock_gettime(CLOCK_MONOTONIC, &begin);
+    switch (run) {
+      case 0:
+      case 1:
+        ret_code = cugraph_louvain(
+          p_handle, p_graph, (run == 0) ? 1 : 100, 1e-7, 1.0, FALSE, &p_result, &ret_error);
+        break;
+      case 2:
+        ret_code = cugraph_leiden(
+          p_handle, p_rng_state, p_graph, 100, 1.0, 1.0, FALSE, &p_result, &ret_error);
+        break;
+      default:
+        ret_code = cugraph_ecg(p_handle,
+                               p_rng_state,
+                               p_graph,
+                               0.05,
+                               8,
+                               100,
+                               1e-7,
+                               1.0,
+                               FALSE,
+                               &p_result,
+                               &ret_error);
+        break;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, cugraph_error_message(ret_error));
+
+    if (test_ret_value == 0) {
+      cugraph_type_erased_device_array_view_t* clusters =
+        cugraph_hierarchical_clustering_result_get_clusters(p_result);
+      size_t num_vertices  = cugraph_type_erased_device_array_view_size(clusters);
+      vertex_t* h_clusters = (vertex_t*)malloc(num_vertices * sizeof(vertex_t));
+
+      ret_code = cugraph_type_erased_device_array_view_copy_to_host(
+        p_handle, (byte_t*)h_clusters, clusters, &ret_error);
+      TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+      size_t num_clusters = 0;
+      for (size_t i = 0; i < num_vertices; ++i) {
+        if ((size_t)h_clusters[i] >= num_clusters) num_clusters = (size_t)h_clusters[i] + 1;
+      }
+
+      printf("  R-MAT scale %d, %zu edges: %s modularity %.4f, %zu clusters, %.1f ms\n",
+             scale,
+             num_edges / 2,
+             algorithm_names[run],
+             cugraph_hierarchical_clustering_result_get_modularity(p_result),
+             num_clusters,
+             elapsed_us(&begin, &end) / 1e3);
+
+      free(h_clusters);
+      cugraph_hierarchical_clustering_result_free(p_result);
+    }
+  }
+
+  free(dst);
+  free(src);
+
+  cugraph_graph_free(p_graph);
+  cugraph_rng_state_free(p_rng_state);
+  cugraph_free_resource_handle(p_handle);
+  cugraph_error_free(ret_error);
+
+  return test_ret_value;
+}
+
+/******************************************************************************/
+
+int main(int argc, char** argv)
+{
+  int result = 0;
+  result |= RUN_TEST(bench_host_bfs_latency);
+  result |= RUN_TEST(bench_host_neighbor_sample_throughput);
+  result |= RUN_TEST(bench_host_random_walks_throughput);
+  result |= RUN_TEST(bench_host_triangle_count_power_law);
+  result |= RUN_TEST(bench_host_louvain_power_law);
+  return result;
+}
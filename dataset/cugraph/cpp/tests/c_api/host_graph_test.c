@@ -0,0 +1,574 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "c_test_utils.h" /* RUN_TEST */
+
+#include <cugraph_c/algorithms.h>
+#include <cugraph_c/graph.h>
+
+#include <float.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+typedef int32_t vertex_t;
+typedef int32_t edge_t;
+typedef float weight_t;
+
+int run_bfs(const cugraph_resource_handle_t* p_handle,
+            cugraph_graph_t* p_graph,
+            vertex_t source,
+            size_t num_vertices,
+            vertex_t* h_vertices,
+            vertex_t* h_distances,
+            vertex_t* h_predecessors)
+{
+  int test_ret_value = 0;
+
+  cugraph_error_code_t ret_code = CUGRAPH_SUCCESS;
+  cugraph_error_t* ret_error    = NULL;
+
+  cugraph_paths_result_t* p_result                       = NULL;
+  cugraph_type_erased_device_array_t* p_sources          = NULL;
+  cugraph_type_erased_device_array_view_t* p_source_view = NULL;
+
+  ret_code = cugraph_type_erased_device_array_create(p_handle, 1, INT32, &p_sources, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "p_sources create failed.");
+
+  p_source_view = cugraph_type_erased_device_array_view(p_sources);
+
+  ret_code = cugraph_type_erased_device_array_view_copy_from_host(
+    p_handle, p_source_view, (byte_t*)&source, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "src copy_from_host failed.");
+
+  ret_code = cugraph_bfs(
+    p_handle, p_graph, p_source_view, TRUE, 10000000, TRUE, FALSE, &p_result, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, cugraph_error_message(ret_error));
+
+  ret_code = cugraph_type_erased_device_array_view_copy_to_host(
+    p_handle, (byte_t*)h_vertices, cugraph_paths_result_get_vertices(p_result), &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+  ret_code = cugraph_type_erased_device_array_view_copy_to_host(
+    p_handle, (byte_t*)h_distances, cugraph_paths_result_get_distances(p_result), &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+  if (h_predecessors != NULL) {
+    ret_code = cugraph_type_erased_device_array_view_copy_to_host(
+      p_handle,
+      (byte_t*)h_predecessors,
+      cugraph_paths_result_get_predecessors(p_result),
+      &ret_error);
+    TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+  }
+
+  cugraph_paths_result_free(p_result);
+  cugraph_type_erased_device_array_free(p_sources);
+  cugraph_error_free(ret_error);
+
+  return test_ret_value;
+}
+
+int test_host_bfs()
+{
+  size_t num_edges    = 8;
+  size_t num_vertices = 6;
+
+  vertex_t src[]                   = {0, 1, 1, 2, 2, 2, 3, 4};
+  vertex_t dst[]                   = {1, 3, 4, 0, 1, 3, 5, 5};
+  weight_t wgt[]                   = {0.1f, 2.1f, 1.1f, 5.1f, 3.1f, 4.1f, 7.2f, 3.2f};
+  vertex_t expected_distances[]    = {0, 1, 2147483647, 2, 2, 3};
+  vertex_t expected_predecessors[] = {-1, 0, -1, 1, 1, 3};
+
+  int test_ret_value = 0;
+
+  cugraph_error_t* ret_error = NULL;
+
+  cugraph_resource_handle_t* p_handle = NULL;
+  cugraph_graph_t* p_graph            = NULL;
+
+  p_handle = cugraph_create_resource_handle(NULL);
+  TEST_ASSERT(test_ret_value, p_handle != NULL, "resource handle creation failed.");
+
+  test_ret_value =
+    create_host_test_graph(p_handle, src, dst, wgt, num_edges, FALSE, &p_graph, &ret_error);
+
+  vertex_t h_vertices[num_vertices];
+  vertex_t h_distances[num_vertices];
+  vertex_t h_predecessors[num_vertices];
+
+  if (test_ret_value == 0) {
+    test_ret_value =
+      run_bfs(p_handle, p_graph, 0, num_vertices, h_vertices, h_distances, h_predecessors);
+  }
+
+  for (int i = 0; (i < num_vertices) && (test_ret_value == 0); ++i) {
+    TEST_ASSERT(test_ret_value,
+                expected_distances[h_vertices[i]] == h_distances[i],
+                "bfs distances don't match");
+
+    TEST_ASSERT(test_ret_value,
+                expected_predecessors[h_vertices[i]] == h_predecessors[i],
+                "bfs predecessors don't match");
+  }
+
+  cugraph_graph_free(p_graph);
+  cugraph_free_resource_handle(p_handle);
+  cugraph_error_free(ret_error);
+
+  return test_ret_value;
+}
+
+int test_host_bfs_renumbered()
+{
+  size_t num_edges    = 8;
+  size_t num_vertices = 6;
+
+  vertex_t src[]                   = {100, 101, 101, 102, 102, 102, 103, 104};
+  vertex_t dst[]                   = {101, 103, 104, 100, 101, 103, 105, 105};
+  weight_t wgt[]                   = {0.1f, 2.1f, 1.1f, 5.1f, 3.1f, 4.1f, 7.2f, 3.2f};
+  vertex_t expected_distances[]    = {0, 1, 2147483647, 2, 2, 3};
+  vertex_t expected_predecessors[] = {-1, 100, -1, 101, 101, 103};
+
+  int test_ret_value = 0;
+
+  cugraph_error_t* ret_error = NULL;
+
+  cugraph_resource_handle_t* p_handle = NULL;
+  cugraph_graph_t* p_graph            = NULL;
+
+  p_handle = cugraph_create_resource_handle(NULL);
+  TEST_ASSERT(test_ret_value, p_handle != NULL, "resource handle creation failed.");
+
+  test_ret_value =
+    create_host_test_graph(p_handle, src, dst, wgt, num_edges, TRUE, &p_graph, &ret_error);
+
+  vertex_t h_vertices[num_vertices];
+  vertex_t h_distances[num_vertices];
+  vertex_t h_predecessors[num_vertices];
+
+  if (test_ret_value == 0) {
+    test_ret_value =
+      run_bfs(p_handle, p_graph, 100, num_vertices, h_vertices, h_distances, h_predecessors);
+  }
+
+  for (int i = 0; (i < num_vertices) && (test_ret_value == 0); ++i) {
+    TEST_ASSERT(test_ret_value,
+                expected_distances[h_vertices[i] - 100] == h_distances[i],
+                "bfs distances don't match");
+
+    TEST_ASSERT(test_ret_value,
+                expected_predecessors[h_vertices[i] - 100] == h_predecessors[i],
+                "bfs predecessors don't match");
+  }
+
+  cugraph_graph_free(p_graph);
+  cugraph_free_resource_handle(p_handle);
+  cugraph_error_free(ret_error);
+
+  return test_ret_value;
+}
+
+int test_host_sssp()
+{
+  size_t num_edges    = 8;
+  size_t num_vertices = 6;
+
+  vertex_t src[]                   = {0, 1, 1, 2, 2, 2, 3, 4};
+  vertex_t dst[]                   = {1, 3, 4, 0, 1, 3, 5, 5};
+  weight_t wgt[]                   = {0.1f, 2.1f, 1.1f, 5.1f, 3.1f, 4.1f, 7.2f, 3.2f};
+  weight_t expected_distances[]    = {0.0f, 0.1f, FLT_MAX, 2.2f, 1.2f, 4.4f};
+  vertex_t expected_predecessors[] = {-1, 0, -1, 1, 1, 4};
+
+  int test_ret_value = 0;
+
+  cugraph_error_code_t ret_code = CUGRAPH_SUCCESS;
+  cugraph_error_t* ret_error    = NULL;
+
+  cugraph_resource_handle_t* p_handle = NULL;
+  cugraph_graph_t* p_graph            = NULL;
+  cugraph_paths_result_t* p_result    = NULL;
+
+  p_handle = cugraph_create_resource_handle(NULL);
+  TEST_ASSERT(test_ret_value, p_handle != NULL, "resource handle creation failed.");
+
+  test_ret_value =
+    create_host_test_graph(p_handle, src, dst, wgt, num_edges, FALSE, &p_graph, &ret_error);
+
+  ret_code = cugraph_sssp(p_handle, p_graph, 0, 10, TRUE, FALSE, &p_result, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, cugraph_error_message(ret_error));
+
+  vertex_t h_vertices[num_vertices];
+  weight_t h_distances[num_vertices];
+  vertex_t h_predecessors[num_vertices];
+
+  ret_code = cugraph_type_erased_device_array_view_copy_to_host(
+    p_handle, (byte_t*)h_vertices, cugraph_paths_result_get_vertices(p_result), &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+  ret_code = cugraph_type_erased_device_array_view_copy_to_host(
+    p_handle, (byte_t*)h_distances, cugraph_paths_result_get_distances(p_result), &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+  ret_code = cugraph_type_erased_device_array_view_copy_to_host(
+    p_handle, (byte_t*)h_predecessors, cugraph_paths_result_get_predecessors(p_result), &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+  for (int i = 0; (i < num_vertices) && (test_ret_value == 0); ++i) {
+    TEST_ASSERT(test_ret_value,
+                nearlyEqual(expected_distances[h_vertices[i]], h_distances[i], 0.0001),
+                "sssp distances don't match");
+
+    TEST_ASSERT(test_ret_value,
+                expected_predecessors[h_vertices[i]] == h_predecessors[i],
+                "sssp predecessors don't match");
+  }
+
+  cugraph_paths_result_free(p_result);
+  cugraph_graph_free(p_graph);
+  cugraph_free_resource_handle(p_handle);
+  cugraph_error_free(ret_error);
+
+  return test_ret_value;
+}
+
+/*
+ * A long chain of tiny edges next to a few heavy ones keeps the mean edge weight far below the
+ * maximum, the heavy edges in series reach distances of millions of mean weights.
+ */
+int test_host_sssp_skewed_weights()
+{
+  size_t num_chain_vertices = 100000;
+  size_t num_heavy_vertices = 8;
+  size_t num_vertices       = num_chain_vertices + num_heavy_vertices;
+  size_t num_edges          = (num_chain_vertices - 1) + 1 + 2 * (num_heavy_vertices - 1);
+
+  vertex_t* src = (vertex_t*)malloc(num_edges * sizeof(vertex_t));
+  vertex_t* dst = (vertex_t*)malloc(num_edges * sizeof(vertex_t));
+  weight_t* wgt = (weight_t*)malloc(num_edges * sizeof(weight_t));
+
+  weight_t* expected_distances    = (weight_t*)malloc(num_vertices * sizeof(weight_t));
+  vertex_t* expected_predecessors = (vertex_t*)malloc(num_vertices * sizeof(vertex_t));
+
+  /* chain vertex v is at v / 1024 from vertex 0 */
+  size_t e = 0;
+  for (size_t v = 0; v < num_chain_vertices; ++v) {
+    expected_distances[v]    = (weight_t)v / 1024.0f;
+    expected_predecessors[v] = (vertex_t)v - 1;
+    if (v > 0) {
+      src[e]   = (vertex_t)(v - 1);
+      dst[e]   = (vertex_t)v;
+      wgt[e++] = 1.0f / 1024.0f;
+    }
+  }
+
+  /*
+   * heavy vertex i is reached through the series of heavy edges from vertex 0, the direct edge
+   * from the chain is longer
+   */
+  for (size_t i = 0; i < num_heavy_vertices; ++i) {
+    vertex_t h               = (vertex_t)(num_chain_vertices + i);
+    expected_distances[h]    = 1e6f * (weight_t)(i + 1);
+    expected_predecessors[h] = (i == 0) ? 0 : h - 1;
+    src[e]                   = (i == 0) ? 0 : h - 1;
+    dst[e]                   = h;
+    wgt[e++]                 = 1e6f;
+    if (i > 0) {
+      src[e]   = (vertex_t)(i * (num_chain_vertices / num_heavy_vertices));
+      dst[e]   = h;
+      wgt[e++] = 1e6f * (weight_t)(i + 1);
+    }
+  }
+
+  int test_ret_value = 0;
+
+  cugraph_error_code_t ret_code = CUGRAPH_SUCCESS;
+  cugraph_error_t* ret_error    = NULL;
+
+  cugraph_resource_handle_t* p_handle = NULL;
+  cugraph_graph_t* p_graph            = NULL;
+  cugraph_paths_result_t* p_result    = NULL;
+
+  p_handle = cugraph_create_resource_handle(NULL);
+  TEST_ASSERT(test_ret_value, p_handle != NULL, "resource handle creation failed.");
+
+  test_ret_value =
+    create_host_test_graph(p_handle, src, dst, wgt, num_edges, FALSE, &p_graph, &ret_error);
+
+  ret_code = cugraph_sssp(p_handle, p_graph, 0, FLT_MAX, TRUE, TRUE, &p_result, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, cugraph_error_message(ret_error));
+
+  vertex_t* h_vertices     = (vertex_t*)malloc(num_vertices * sizeof(vertex_t));
+  weight_t* h_distances    = (weight_t*)malloc(num_vertices * sizeof(weight_t));
+  vertex_t* h_predecessors = (vertex_t*)malloc(num_vertices * sizeof(vertex_t));
+
+  if (test_ret_value == 0) {
+    ret_code = cugraph_type_erased_device_array_view_copy_to_host(
+      p_handle, (byte_t*)h_vertices, cugraph_paths_result_get_vertices(p_result), &ret_error);
+    TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+    ret_code = cugraph_type_erased_device_array_view_copy_to_host(
+      p_handle, (byte_t*)h_distances, cugraph_paths_result_get_distances(p_result), &ret_error);
+    TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+    ret_code = cugraph_type_erased_device_array_view_copy_to_host(
+      p_handle,
+      (byte_t*)h_predecessors,
+      cugraph_paths_result_get_predecessors(p_result),
+      &ret_error);
+    TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+  }
+
+  for (size_t i = 0; (i < num_vertices) && (test_ret_value == 0); ++i) {
+    TEST_ASSERT(test_ret_value,
+                nearlyEqual(expected_distances[h_vertices[i]], h_distances[i], 0.0001),
+                "sssp distances don't match");
+
+    TEST_ASSERT(test_ret_value,
+                expected_predecessors[h_vertices[i]] == h_predecessors[i],
+                "sssp predecessors don't match");
+  }
+
+  free(h_predecessors);
+  free(h_distances);
+  free(h_vertices);
+  free(expected_predecessors);
+  free(expected_distances);
+  free(wgt);
+  free(dst);
+  free(src);
+
+  cugraph_paths_result_free(p_result);
+  cugraph_graph_free(p_graph);
+  cugraph_free_resource_handle(p_handle);
+  cugraph_error_free(ret_error);
+
+  return test_ret_value;
+}
+
+int test_host_pagerank()
+{
+  size_t num_edges    = 8;
+  size_t num_vertices = 6;
+
+  vertex_t src[]      = {0, 1, 1, 2, 2, 2, 3, 4};
+  vertex_t dst[]      = {1, 3, 4, 0, 1, 3, 5, 5};
+  weight_t wgt[]      = {0.1f, 2.1f, 1.1f, 5.1f, 3.1f, 4.1f, 7.2f, 3.2f};
+  weight_t h_result[] = {0.0915528, 0.168382, 0.0656831, 0.191468, 0.120677, 0.362237};
+
+  double alpha          = 0.95;
+  double epsilon        = 0.0001;
+  size_t max_iterations = 20;
+
+  int test_ret_value = 0;
+
+  cugraph_error_code_t ret_code = CUGRAPH_SUCCESS;
+  cugraph_error_t* ret_error    = NULL;
+
+  cugraph_resource_handle_t* p_handle   = NULL;
+  cugraph_graph_t* p_graph              = NULL;
+  cugraph_centrality_result_t* p_result = NULL;
+
+  p_handle = cugraph_create_resource_handle(NULL);
+  TEST_ASSERT(test_ret_value, p_handle != NULL, "resource handle creation failed.");
+
+  test_ret_value =
+    create_host_test_graph(p_handle, src, dst, wgt, num_edges, FALSE, &p_graph, &ret_error);
+
+  ret_code = cugraph_pagerank(p_handle,
+                              p_graph,
+                              NULL,
+                              NULL,
+                              NULL,
+                              NULL,
+                              alpha,
+                              epsilon,
+                              max_iterations,
+                              FALSE,
+                              &p_result,
+                              &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, cugraph_error_message(ret_error));
+
+  vertex_t h_vertices[num_vertices];
+  weight_t h_pageranks[num_vertices];
+
+  ret_code = cugraph_type_erased_device_array_view_copy_to_host(
+    p_handle, (byte_t*)h_vertices, cugraph_centrality_result_get_vertices(p_result), &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+  ret_code = cugraph_type_erased_device_array_view_copy_to_host(
+    p_handle, (byte_t*)h_pageranks, cugraph_centrality_result_get_values(p_result), &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+  for (int i = 0; (i < num_vertices) && (test_ret_value == 0); ++i) {
+    TEST_ASSERT(test_ret_value,
+                nearlyEqual(h_result[h_vertices[i]], h_pageranks[i], 0.001),
+                "pagerank results don't match");
+  }
+
+  cugraph_centrality_result_free(p_result);
+  cugraph_graph_free(p_graph);
+  cugraph_free_resource_handle(p_handle);
+  cugraph_error_free(ret_error);
+
+  return test_ret_value;
+}
+
+int test_host_graph_unsupported_algorithm()
+{
+  size_t num_edges = 8;
+
+  vertex_t src[] = {0, 1, 1, 2, 2, 2, 3, 4};
+  vertex_t dst[] = {1, 3, 4, 0, 1, 3, 5, 5};
+  weight_t wgt[] = {0.1f, 2.1f, 1.1f, 5.1f, 3.1f, 4.1f, 7.2f, 3.2f};
+
+  int test_ret_value = 0;
+
+  cugraph_error_code_t ret_code = CUGRAPH_SUCCESS;
+  cugraph_error_t* ret_error    = NULL;
+
+  cugraph_resource_handle_t* p_handle = NULL;
+  cugraph_graph_t* p_graph            = NULL;
+  cugraph_labeling_result_t* p_result = NULL;
+
+  p_handle = cugraph_create_resource_handle(NULL);
+  TEST_ASSERT(test_ret_value, p_handle != NULL, "resource handle creation failed.");
+
+  test_ret_value =
+    create_host_test_graph(p_handle, src, dst, wgt, num_edges, FALSE, &p_graph, &ret_error);
+
+  ret_code = cugraph_weakly_connected_components(p_handle, p_graph, FALSE, &p_result, &ret_error);
+  TEST_ASSERT(test_ret_value,
+              ret_code == CUGRAPH_NOT_IMPLEMENTED,
+              "algorithms without a host implementation should not run on a host graph.");
+
+  cugraph_graph_free(p_graph);
+  cugraph_free_resource_handle(p_handle);
+  cugraph_error_free(ret_error);
+
+  return test_ret_value;
+}
+
+/*
+ * Checks that BFS on random graphs built from host arrays returns the distances of BFS on the
+ * same graphs built on the device.
+ */
+int test_host_bfs_matches_device()
+{
+  size_t graph_sizes[]  = {1000, 10000};
+  size_t average_degree = 8;
+
+  int test_ret_value = 0;
+
+  cugraph_error_t* ret_error = NULL;
+
+  cugraph_resource_handle_t* p_handle = NULL;
+
+  p_handle = cugraph_create_resource_handle(NULL);
+  TEST_ASSERT(test_ret_value, p_handle != NULL, "resource handle creation failed.");
+
+  srand(42);
+
+  for (size_t s = 0; (s < sizeof(graph_sizes) / sizeof(graph_sizes[0])) && (test_ret_value == 0);
+       ++s) {
+    size_t num_vertices = graph_sizes[s];
+    size_t num_edges    = num_vertices * average_degree;
+
+    vertex_t* src = (vertex_t*)malloc(num_edges * sizeof(vertex_t));
+    vertex_t* dst = (vertex_t*)malloc(num_edges * sizeof(vertex_t));
+    weight_t* wgt = (weight_t*)malloc(num_edges * sizeof(weight_t));
+
+    /* a ring keeps every vertex reachable from vertex 0 */
+    for (size_t i = 0; i < num_edges; ++i) {
+      src[i] = (vertex_t)(i % num_vertices);
+      dst[i] = (i < num_vertices) ? (vertex_t)((i + 1) % num_vertices)
+                                  : (vertex_t)(rand() % num_vertices);
+      wgt[i] = 1.0f + (float)(rand() % 100) / 10.0f;
+    }
+
+    cugraph_graph_t* p_host_graph   = NULL;
+    cugraph_graph_t* p_device_graph = NULL;
+
+    test_ret_value =
+      create_host_test_graph(p_handle, src, dst, wgt, num_edges, FALSE, &p_host_graph, &ret_error);
+
+    if (test_ret_value == 0) {
+      test_ret_value = create_test_graph(
+        p_handle, src, dst, wgt, num_edges, FALSE, FALSE, FALSE, &p_device_graph, &ret_error);
+    }
+
+    vertex_t* h_host_vertices    = (vertex_t*)malloc(num_vertices * sizeof(vertex_t));
+    vertex_t* h_host_distances   = (vertex_t*)malloc(num_vertices * sizeof(vertex_t));
+    vertex_t* h_device_vertices  = (vertex_t*)malloc(num_vertices * sizeof(vertex_t));
+    vertex_t* h_device_distances = (vertex_t*)malloc(num_vertices * sizeof(vertex_t));
+
+    if (test_ret_value == 0) {
+      test_ret_value = run_bfs(
+        p_handle, p_host_graph, 0, num_vertices, h_host_vertices, h_host_distances, NULL);
+    }
+
+    if (test_ret_value == 0) {
+      test_ret_value = run_bfs(
+        p_handle, p_device_graph, 0, num_vertices, h_device_vertices, h_device_distances, NULL);
+    }
+
+    if (test_ret_value == 0) {
+      /* both results are indexed by vertex id, the device result may be in any order */
+      vertex_t* expected = (vertex_t*)malloc(num_vertices * sizeof(vertex_t));
+      for (size_t i = 0; i < num_vertices; ++i)
+        expected[h_device_vertices[i]] = h_device_distances[i];
+
+      for (size_t i = 0; (i < num_vertices) && (test_ret_value == 0); ++i) {
+        TEST_ASSERT(test_ret_value,
+                    expected[h_host_vertices[i]] == h_host_distances[i],
+                    "host and device bfs distances don't match");
+      }
+      free(expected);
+    }
+
+    free(h_device_distances);
+    free(h_device_vertices);
+    free(h_host_distances);
+    free(h_host_vertices);
+
+    cugraph_graph_free(p_device_graph);
+    cugraph_graph_free(p_host_graph);
+
+    free(wgt);
+    free(dst);
+    free(src);
+  }
+
+  cugraph_free_resource_handle(p_handle);
+  cugraph_error_free(ret_error);
+
+  return test_ret_value;
+}
+
+/******************************************************************************/
+
+int main(int argc, char** argv)
+{
+  int result = 0;
+  result |= RUN_TEST(test_host_bfs);
+  result |= RUN_TEST(test_host_bfs_renumbered);
+  result |= RUN_TEST(test_host_sssp);
+  result |= RUN_TEST(test_host_sssp_skewed_weights);
+  result |= RUN_TEST(test_host_pagerank);
+  result |= RUN_TEST(test_host_graph_unsupported_algorithm);
+  result |= RUN_TEST(test_host_bfs_matches_device);
+  return result;
+}
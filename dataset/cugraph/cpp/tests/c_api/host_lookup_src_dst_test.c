@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "c_test_utils.h" /* RUN_TEST */
+
+#include <cugraph_c/algorithms.h>
+#include <cugraph_c/array.h>
+
+#include <stdio.h>
+
+typedef int32_t vertex_t;
+typedef int32_t edge_t;
+typedef int32_t edge_type_t;
+
+int generic_host_lookup_test(vertex_t* h_srcs,
+                             vertex_t* h_dsts,
+                             edge_t* h_edge_ids,
+                             edge_type_t* h_edge_types,
+                             size_t num_edges,
+                             edge_t* h_edge_ids_to_lookup,
+                             edge_type_t* h_edge_types_to_lookup,
+                             size_t num_edges_to_lookup,
+                             vertex_t* h_expected_srcs,
+                             vertex_t* h_expected_dsts)
+{
+  int test_ret_value = 0;
+
+  cugraph_error_code_t ret_code = CUGRAPH_SUCCESS;
+  cugraph_error_t* ret_error    = NULL;
+
+  cugraph_resource_handle_t* p_handle          = NULL;
+  cugraph_lookup_container_t* lookup_container = NULL;
+
+  vertex_t h_result_srcs[num_edges_to_lookup];
+  vertex_t h_result_dsts[num_edges_to_lookup];
+
+  p_handle = cugraph_create_resource_handle(NULL);
+  TEST_ASSERT(test_ret_value, p_handle != NULL, "resource handle creation failed.");
+
+  cugraph_type_erased_host_array_view_t* srcs_view =
+    cugraph_type_erased_host_array_view_create(h_srcs, num_edges, INT32);
+  cugraph_type_erased_host_array_view_t* dsts_view =
+    cugraph_type_erased_host_array_view_create(h_dsts, num_edges, INT32);
+  cugraph_type_erased_host_array_view_t* edge_ids_view =
+    cugraph_type_erased_host_array_view_create(h_edge_ids, num_edges, INT32);
+  cugraph_type_erased_host_array_view_t* edge_types_view =
+    cugraph_type_erased_host_array_view_create(h_edge_types, num_edges, INT32);
+  cugraph_type_erased_host_array_view_t* edge_ids_to_lookup_view =
+    cugraph_type_erased_host_array_view_create(h_edge_ids_to_lookup, num_edges_to_lookup, INT32);
+  cugraph_type_erased_host_array_view_t* edge_types_to_lookup_view =
+    cugraph_type_erased_host_array_view_create(h_edge_types_to_lookup, num_edges_to_lookup, INT32);
+  cugraph_type_erased_host_array_view_t* result_srcs_view =
+    cugraph_type_erased_host_array_view_create(h_result_srcs, num_edges_to_lookup, INT32);
+  cugraph_type_erased_host_array_view_t* result_dsts_view =
+    cugraph_type_erased_host_array_view_create(h_result_dsts, num_edges_to_lookup, INT32);
+
+  ret_code = cugraph_build_edge_id_and_type_to_src_dst_host_lookup_map(
+    p_handle, srcs_view, dsts_view, edge_ids_view, edge_types_view, &lookup_container, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, cugraph_error_message(ret_error));
+
+  if (test_ret_value == 0) {
+    ret_code = cugraph_lookup_endpoints_from_edge_ids_and_types_host(p_handle,
+                                                                     lookup_container,
+                                                                     edge_ids_to_lookup_view,
+                                                                     edge_types_to_lookup_view,
+                                                                     result_srcs_view,
+                                                                     result_dsts_view,
+                                                                     &ret_error);
+    TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, cugraph_error_message(ret_error));
+  }
+
+  for (size_t i = 0; (i < num_edges_to_lookup) && (test_ret_value == 0); ++i) {
+    TEST_ASSERT(test_ret_value, h_result_srcs[i] == h_expected_srcs[i], "srcs don't match");
+    TEST_ASSERT(test_ret_value, h_result_dsts[i] == h_expected_dsts[i], "dsts don't match");
+  }
+
+  /* look the edges of the first lookup type up again with the single type variant */
+  for (size_t i = 0; (i < num_edges_to_lookup) && (test_ret_value == 0); ++i) {
+    h_result_srcs[i] = 0;
+    h_result_dsts[i] = 0;
+  }
+
+  if (test_ret_value == 0) {
+    ret_code =
+      cugraph_lookup_endpoints_from_edge_ids_and_single_type_host(p_handle,
+                                                                  lookup_container,
+                                                                  edge_ids_to_lookup_view,
+                                                                  h_edge_types_to_lookup[0],
+                                                                  result_srcs_view,
+                                                                  result_dsts_view,
+                                                                  &ret_error);
+    TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, cugraph_error_message(ret_error));
+  }
+
+  for (size_t i = 0; (i < num_edges_to_lookup) && (test_ret_value == 0); ++i) {
+    if (h_edge_types_to_lookup[i] == h_edge_types_to_lookup[0]) {
+      TEST_ASSERT(test_ret_value, h_result_srcs[i] == h_expected_srcs[i], "srcs don't match");
+      TEST_ASSERT(test_ret_value, h_result_dsts[i] == h_expected_dsts[i], "dsts don't match");
+    }
+  }
+
+  cugraph_type_erased_host_array_view_free(srcs_view);
+  cugraph_type_erased_host_array_view_free(dsts_view);
+  cugraph_type_erased_host_array_view_free(edge_ids_view);
+  cugraph_type_erased_host_array_view_free(edge_types_view);
+  cugraph_type_erased_host_array_view_free(edge_ids_to_lookup_view);
+  cugraph_type_erased_host_array_view_free(edge_types_to_lookup_view);
+  cugraph_type_erased_host_array_view_free(result_srcs_view);
+  cugraph_type_erased_host_array_view_free(result_dsts_view);
+  cugraph_lookup_container_free(lookup_container);
+  cugraph_free_resource_handle(p_handle);
+  cugraph_error_free(ret_error);
+
+  return test_ret_value;
+}
+
+int test_host_lookup_src_dst()
+{
+  size_t num_edges           = 8;
+  size_t num_edges_to_lookup = 6;
+
+  vertex_t h_srcs[]          = {0, 1, 1, 2, 2, 2, 3, 4};
+  vertex_t h_dsts[]          = {1, 3, 4, 0, 1, 3, 5, 5};
+  edge_t h_edge_ids[]        = {7, 3, 100, 2, 0, 1, 1000, 5};
+  edge_type_t h_edge_types[] = {0, 0, 0, 1, 1, 1, 0, 1};
+
+  edge_t h_edge_ids_to_lookup[]        = {100, 0, 7, 1, 4, 1000};
+  edge_type_t h_edge_types_to_lookup[] = {0, 1, 0, 1, 1, 0};
+  vertex_t h_expected_srcs[]           = {1, 2, 0, 2, -1, 3};
+  vertex_t h_expected_dsts[]           = {4, 1, 1, 3, -1, 5};
+
+  return generic_host_lookup_test(h_srcs,
+                                  h_dsts,
+                                  h_edge_ids,
+                                  h_edge_types,
+                                  num_edges,
+                                  h_edge_ids_to_lookup,
+                                  h_edge_types_to_lookup,
+                                  num_edges_to_lookup,
+                                  h_expected_srcs,
+                                  h_expected_dsts);
+}
+
+/******************************************************************************/
+
+int main(int argc, char** argv)
+{
+  int result = 0;
+  result |= RUN_TEST(test_host_lookup_src_dst);
+  return result;
+}
@@ -0,0 +1,402 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "c_test_utils.h" /* RUN_TEST */
+
+#include <cugraph_c/algorithms.h>
+#include <cugraph_c/graph.h>
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+typedef int32_t vertex_t;
+typedef int32_t edge_t;
+typedef float weight_t;
+
+typedef enum { LOUVAIN, LEIDEN, ECG } clustering_algorithm_t;
+
+/*
+ * Runs a clustering algorithm with resolution 1 and copies the vertices and clusters,
+ * num_vertices of each, to h_vertices and h_clusters.
+ */
+int run_clustering(const cugraph_resource_handle_t* p_handle,
+                   cugraph_rng_state_t* p_rng_state,
+                   cugraph_graph_t* p_graph,
+                   clustering_algorithm_t algorithm,
+                   size_t max_level,
+                   size_t num_vertices,
+                   vertex_t* h_vertices,
+                   vertex_t* h_clusters,
+                   double* modularity)
+{
+  int test_ret_value = 0;
+
+  cugraph_error_code_t ret_code;
+  cugraph_error_t* ret_error = NULL;
+
+  cugraph_hierarchical_clustering_result_t* p_result = NULL;
+
+  switch (algorithm) {
+    case LOUVAIN:
+      ret_code =
+        cugraph_louvain(p_handle, p_graph, max_level, 1e-7, 1.0, FALSE, &p_result, &ret_error);
+      break;
+    case LEIDEN:
+      ret_code = cugraph_leiden(
+        p_handle, p_rng_state, p_graph, max_level, 1.0, 1.0, FALSE, &p_result, &ret_error);
+      break;
+    default:
+      ret_code = cugraph_ecg(p_handle,
+                             p_rng_state,
+                             p_graph,
+                             0.05,
+                             8,
+                             max_level,
+                             1e-7,
+                             1.0,
+                             FALSE,
+                             &p_result,
+                             &ret_error);
+      break;
+  }
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, cugraph_error_message(ret_error));
+
+  if (test_ret_value == 0) {
+    cugraph_type_erased_device_array_view_t* vertices =
+      cugraph_hierarchical_clustering_result_get_vertices(p_result);
+    cugraph_type_erased_device_array_view_t* clusters =
+      cugraph_hierarchical_clustering_result_get_clusters(p_result);
+    *modularity = cugraph_hierarchical_clustering_result_get_modularity(p_result);
+
+    TEST_ASSERT(test_ret_value,
+                cugraph_type_erased_device_array_view_size(vertices) == num_vertices,
+                "invalid number of results");
+
+    if (test_ret_value == 0) {
+      ret_code = cugraph_type_erased_device_array_view_copy_to_host(
+        p_handle, (byte_t*)h_vertices, vertices, &ret_error);
+      TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+      ret_code = cugraph_type_erased_device_array_view_copy_to_host(
+        p_handle, (byte_t*)h_clusters, clusters, &ret_error);
+      TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+    }
+
+    cugraph_hierarchical_clustering_result_free(p_result);
+  }
+
+  cugraph_error_free(ret_error);
+
+  return test_ret_value;
+}
+
+/*
+ * Modularity of the clustering h_clusters (the cluster of h_vertices[i] is h_clusters[i], cluster
+ * ids are below num_vertices) of the symmetric edge list src, dst, wgt (weight 1 if NULL).
+ */
+static double compute_modularity(vertex_t const* src,
+                                 vertex_t const* dst,
+                                 weight_t const* wgt,
+                                 size_t num_edges,
+                                 vertex_t const* h_vertices,
+                                 vertex_t const* h_clusters,
+                                 size_t num_vertices)
+{
+  vertex_t* cluster_of     = (vertex_t*)malloc(num_vertices * sizeof(vertex_t));
+  double* cluster_strength = (double*)calloc(num_vertices, sizeof(double));
+
+  for (size_t i = 0; i < num_vertices; ++i)
+    cluster_of[h_vertices[i]] = h_clusters[i];
+
+  double total    = 0;
+  double internal = 0;
+  for (size_t e = 0; e < num_edges; ++e) {
+    double w = (wgt != NULL) ? wgt[e] : 1.0;
+    total += w;
+    cluster_strength[cluster_of[src[e]]] += w;
+    if (cluster_of[src[e]] == cluster_of[dst[e]]) internal += w;
+  }
+
+  double squares = 0;
+  for (size_t c = 0; c < num_vertices; ++c)
+    squares += cluster_strength[c] * cluster_strength[c];
+
+  free(cluster_strength);
+  free(cluster_of);
+
+  return internal / total - squares / (total * total);
+}
+
+int test_host_louvain()
+{
+  size_t num_edges    = 16;
+  size_t num_vertices = 6;
+
+  vertex_t h_src[] = {0, 1, 1, 2, 2, 2, 3, 4, 1, 3, 4, 0, 1, 3, 5, 5};
+  vertex_t h_dst[] = {1, 3, 4, 0, 1, 3, 5, 5, 0, 1, 1, 2, 2, 2, 3, 4};
+  weight_t h_wgt[] = {
+    0.1f, 2.1f, 1.1f, 5.1f, 3.1f, 4.1f, 7.2f, 3.2f, 0.1f, 2.1f, 1.1f, 5.1f, 3.1f, 4.1f, 7.2f, 3.2f};
+  vertex_t h_result[]        = {0, 0, 0, 1, 1, 1};
+  double expected_modularity = 0.215969;
+  double expected_no_weights = 0.125;
+
+  int test_ret_value = 0;
+
+  cugraph_error_code_t ret_code;
+  cugraph_error_t* ret_error = NULL;
+
+  cugraph_resource_handle_t* p_handle = NULL;
+  cugraph_rng_state_t* p_rng_state    = NULL;
+  cugraph_graph_t* p_graph            = NULL;
+  cugraph_graph_t* p_unweighted_graph = NULL;
+
+  vertex_t h_vertices[num_vertices];
+  vertex_t h_clusters[num_vertices];
+  double modularity;
+
+  p_handle = cugraph_create_resource_handle(NULL);
+  TEST_ASSERT(test_ret_value, p_handle != NULL, "resource handle creation failed.");
+
+  ret_code = cugraph_rng_state_create(p_handle, 0, &p_rng_state, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "rng_state create failed.");
+
+  if (test_ret_value == 0) {
+    test_ret_value =
+      create_symmetric_host_graph(p_handle, h_src, h_dst, h_wgt, num_edges, TRUE, &p_graph);
+  }
+  if (test_ret_value == 0) {
+    test_ret_value = create_symmetric_host_graph(
+      p_handle, h_src, h_dst, NULL, num_edges, TRUE, &p_unweighted_graph);
+  }
+
+  for (int algorithm = LOUVAIN; (algorithm <= ECG) && (test_ret_value == 0); ++algorithm) {
+    test_ret_value = run_clustering(p_handle,
+                                    p_rng_state,
+                                    p_graph,
+                                    (clustering_algorithm_t)algorithm,
+                                    10,
+                                    num_vertices,
+                                    h_vertices,
+                                    h_clusters,
+                                    &modularity);
+
+    /* cluster ids may differ, the partition may not */
+    for (size_t i = 0; (i < num_vertices) && (test_ret_value == 0); ++i) {
+      for (size_t j = 0; (j < num_vertices) && (test_ret_value == 0); ++j) {
+        TEST_ASSERT(test_ret_value,
+                    (h_clusters[i] == h_clusters[j]) ==
+                      (h_result[h_vertices[i]] == h_result[h_vertices[j]]),
+                    "cluster results don't match");
+      }
+    }
+    TEST_ASSERT(test_ret_value,
+                nearlyEqual(modularity, expected_modularity, 0.001),
+                "modularity doesn't match");
+
+    if (test_ret_value == 0) {
+      test_ret_value = run_clustering(p_handle,
+                                      p_rng_state,
+                                      p_unweighted_graph,
+                                      (clustering_algorithm_t)algorithm,
+                                      10,
+                                      num_vertices,
+                                      h_vertices,
+                                      h_clusters,
+                                      &modularity);
+    }
+    TEST_ASSERT(test_ret_value,
+                nearlyEqual(modularity, expected_no_weights, 0.001),
+                "modularity doesn't match");
+    TEST_ASSERT(test_ret_value,
+                nearlyEqual(
+                  modularity,
+                  compute_modularity(
+                    h_src, h_dst, NULL, num_edges, h_vertices, h_clusters, num_vertices),
+                  0.001),
+                "modularity doesn't match the clusters");
+  }
+
+  cugraph_graph_free(p_unweighted_graph);
+  cugraph_graph_free(p_graph);
+  cugraph_rng_state_free(p_rng_state);
+  cugraph_free_resource_handle(p_handle);
+  cugraph_error_free(ret_error);
+
+  return test_ret_value;
+}
+
+int test_host_louvain_not_symmetric()
+{
+  size_t num_edges = 3;
+
+  vertex_t h_src[] = {0, 1, 2};
+  vertex_t h_dst[] = {1, 2, 0};
+
+  int test_ret_value = 0;
+
+  cugraph_error_code_t ret_code;
+  cugraph_error_t* ret_error = NULL;
+
+  cugraph_resource_handle_t* p_handle                = NULL;
+  cugraph_rng_state_t* p_rng_state                   = NULL;
+  cugraph_graph_t* p_graph                           = NULL;
+  cugraph_hierarchical_clustering_result_t* p_result = NULL;
+
+  p_handle = cugraph_create_resource_handle(NULL);
+  TEST_ASSERT(test_ret_value, p_handle != NULL, "resource handle creation failed.");
+
+  ret_code = cugraph_rng_state_create(p_handle, 0, &p_rng_state, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "rng_state create failed.");
+
+  if (test_ret_value == 0) {
+    test_ret_value =
+      create_symmetric_host_graph(p_handle, h_src, h_dst, NULL, num_edges, FALSE, &p_graph);
+  }
+
+  if (test_ret_value == 0) {
+    ret_code = cugraph_louvain(p_handle, p_graph, 10, 1e-7, 1.0, FALSE, &p_result, &ret_error);
+    TEST_ASSERT(test_ret_value,
+                ret_code == CUGRAPH_INVALID_INPUT,
+                "Louvain of a directed graph should fail");
+    cugraph_error_free(ret_error);
+    ret_error = NULL;
+
+    ret_code = cugraph_leiden(
+      p_handle, p_rng_state, p_graph, 10, 1.0, 1.0, FALSE, &p_result, &ret_error);
+    TEST_ASSERT(test_ret_value,
+                ret_code == CUGRAPH_INVALID_INPUT,
+                "Leiden of a directed graph should fail");
+    cugraph_error_free(ret_error);
+    ret_error = NULL;
+
+    ret_code = cugraph_ecg(
+      p_handle, p_rng_state, p_graph, 0.05, 8, 10, 1e-7, 1.0, FALSE, &p_result, &ret_error);
+    TEST_ASSERT(
+      test_ret_value, ret_code == CUGRAPH_INVALID_INPUT, "ECG of a directed graph should fail");
+  }
+
+  cugraph_graph_free(p_graph);
+  cugraph_rng_state_free(p_rng_state);
+  cugraph_free_resource_handle(p_handle);
+  cugraph_error_free(ret_error);
+
+  return test_ret_value;
+}
+
+/*
+ * Clusters a graph of 16 groups of 16 vertices, with 60% of the edges within each group and one
+ * edge from each vertex to another group, checking the returned modularity against the
+ * modularity of the returned clusters and against a lower bound close to that of the groups.
+ */
+int test_host_louvain_planted_partition()
+{
+  size_t num_groups   = 16;
+  size_t group_size   = 16;
+  size_t num_vertices = num_groups * group_size;
+  size_t max_edges    = 2 * (num_groups * group_size * (group_size - 1) / 2 + num_vertices);
+
+  /* the groups have a modularity of about 0.75 */
+  double min_modularity = 0.7;
+
+  int test_ret_value = 0;
+
+  cugraph_error_code_t ret_code;
+  cugraph_error_t* ret_error = NULL;
+
+  cugraph_resource_handle_t* p_handle = NULL;
+  cugraph_rng_state_t* p_rng_state    = NULL;
+  cugraph_graph_t* p_graph            = NULL;
+
+  vertex_t* src = (vertex_t*)malloc(max_edges * sizeof(vertex_t));
+  vertex_t* dst = (vertex_t*)malloc(max_edges * sizeof(vertex_t));
+  vertex_t h_vertices[num_vertices];
+  vertex_t h_clusters[num_vertices];
+  double modularity;
+
+  p_handle = cugraph_create_resource_handle(NULL);
+  TEST_ASSERT(test_ret_value, p_handle != NULL, "resource handle creation failed.");
+
+  ret_code = cugraph_rng_state_create(p_handle, 0, &p_rng_state, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "rng_state create failed.");
+
+  /* both directions of every edge; the edges between groups do not repeat */
+  size_t num_edges = 0;
+  srand(42);
+  for (size_t u = 0; u < num_vertices; ++u) {
+    for (size_t v = u + 1; v < (u / group_size + 1) * group_size; ++v) {
+      if (rand() % 10 >= 6) continue;
+      src[num_edges]   = (vertex_t)u;
+      dst[num_edges++] = (vertex_t)v;
+      src[num_edges]   = (vertex_t)v;
+      dst[num_edges++] = (vertex_t)u;
+    }
+  }
+  for (size_t u = 0; u < num_vertices; ++u) {
+    size_t v         = (u + group_size * (1 + u % 3)) % num_vertices;
+    src[num_edges]   = (vertex_t)u;
+    dst[num_edges++] = (vertex_t)v;
+    src[num_edges]   = (vertex_t)v;
+    dst[num_edges++] = (vertex_t)u;
+  }
+
+  if (test_ret_value == 0) {
+    test_ret_value =
+      create_symmetric_host_graph(p_handle, src, dst, NULL, num_edges, TRUE, &p_graph);
+  }
+
+  for (int algorithm = LOUVAIN; (algorithm <= ECG) && (test_ret_value == 0); ++algorithm) {
+    test_ret_value = run_clustering(p_handle,
+                                    p_rng_state,
+                                    p_graph,
+                                    (clustering_algorithm_t)algorithm,
+                                    100,
+                                    num_vertices,
+                                    h_vertices,
+                                    h_clusters,
+                                    &modularity);
+
+    TEST_ASSERT(test_ret_value,
+                nearlyEqual(modularity,
+                            compute_modularity(
+                              src, dst, NULL, num_edges, h_vertices, h_clusters, num_vertices),
+                            0.0001),
+                "modularity doesn't match the clusters");
+    TEST_ASSERT(test_ret_value, modularity > min_modularity, "modularity is too low");
+  }
+
+  free(dst);
+  free(src);
+
+  cugraph_graph_free(p_graph);
+  cugraph_rng_state_free(p_rng_state);
+  cugraph_free_resource_handle(p_handle);
+  cugraph_error_free(ret_error);
+
+  return test_ret_value;
+}
+
+/******************************************************************************/
+
+int main(int argc, char** argv)
+{
+  int result = 0;
+  result |= RUN_TEST(test_host_louvain);
+  result |= RUN_TEST(test_host_louvain_not_symmetric);
+  result |= RUN_TEST(test_host_louvain_planted_partition);
+  return result;
+}
@@ -0,0 +1,439 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "c_test_utils.h" /* RUN_TEST */
+
+#include <cugraph_c/algorithms.h>
+#include <cugraph_c/graph.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+typedef int32_t vertex_t;
+typedef int32_t edge_t;
+typedef float weight_t;
+
+/*
+ * Runs homogeneous neighbor sampling on p_graph, copying the seeds (and the label offsets, if
+ * not NULL) to the device first.
+ */
+int run_neighbor_sample(const cugraph_resource_handle_t* p_handle,
+                        cugraph_graph_t* p_graph,
+                        vertex_t* h_start,
+                        size_t num_start,
+                        size_t* h_label_offsets,
+                        size_t num_labels,
+                        int* fan_out,
+                        size_t fan_out_size,
+                        cugraph_sampling_options_t* options,
+                        bool_t is_biased,
+                        cugraph_sample_result_t** p_result)
+{
+  int test_ret_value = 0;
+
+  cugraph_error_code_t ret_code;
+  cugraph_error_t* ret_error = NULL;
+
+  cugraph_type_erased_device_array_t* d_start                   = NULL;
+  cugraph_type_erased_device_array_view_t* d_start_view         = NULL;
+  cugraph_type_erased_device_array_t* d_label_offsets           = NULL;
+  cugraph_type_erased_device_array_view_t* d_label_offsets_view = NULL;
+  cugraph_type_erased_host_array_view_t* h_fan_out_view         = NULL;
+  cugraph_rng_state_t* rng_state                                = NULL;
+
+  ret_code =
+    cugraph_type_erased_device_array_create(p_handle, num_start, INT32, &d_start, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "d_start create failed.");
+
+  d_start_view = cugraph_type_erased_device_array_view(d_start);
+
+  ret_code = cugraph_type_erased_device_array_view_copy_from_host(
+    p_handle, d_start_view, (byte_t*)h_start, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "start copy_from_host failed.");
+
+  if (h_label_offsets != NULL) {
+    ret_code = cugraph_type_erased_device_array_create(
+      p_handle, num_labels + 1, SIZE_T, &d_label_offsets, &ret_error);
+    TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "d_label_offsets create failed.");
+
+    d_label_offsets_view = cugraph_type_erased_device_array_view(d_label_offsets);
+
+    ret_code = cugraph_type_erased_device_array_view_copy_from_host(
+      p_handle, d_label_offsets_view, (byte_t*)h_label_offsets, &ret_error);
+    TEST_ASSERT(
+      test_ret_value, ret_code == CUGRAPH_SUCCESS, "label offsets copy_from_host failed.");
+  }
+
+  h_fan_out_view = cugraph_type_erased_host_array_view_create(fan_out, fan_out_size, INT32);
+
+  ret_code = cugraph_rng_state_create(p_handle, 0, &rng_state, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "rng_state create failed.");
+
+  if (is_biased) {
+    ret_code = cugraph_homogeneous_biased_neighbor_sample(p_handle,
+                                                          rng_state,
+                                                          p_graph,
+                                                          NULL,
+                                                          d_start_view,
+                                                          d_label_offsets_view,
+                                                          h_fan_out_view,
+                                                          options,
+                                                          FALSE,
+                                                          p_result,
+                                                          &ret_error);
+  } else {
+    ret_code = cugraph_homogeneous_uniform_neighbor_sample(p_handle,
+                                                           rng_state,
+                                                           p_graph,
+                                                           d_start_view,
+                                                           d_label_offsets_view,
+                                                           h_fan_out_view,
+                                                           options,
+                                                           FALSE,
+                                                           p_result,
+                                                           &ret_error);
+  }
+
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, cugraph_error_message(ret_error));
+
+  cugraph_rng_state_free(rng_state);
+  cugraph_type_erased_host_array_view_free(h_fan_out_view);
+  cugraph_type_erased_device_array_view_free(d_label_offsets_view);
+  cugraph_type_erased_device_array_free(d_label_offsets);
+  cugraph_type_erased_device_array_view_free(d_start_view);
+  cugraph_type_erased_device_array_free(d_start);
+  cugraph_error_free(ret_error);
+
+  return test_ret_value;
+}
+
+int copy_result_array(const cugraph_resource_handle_t* p_handle,
+                      cugraph_type_erased_device_array_view_t* view,
+                      void* h_array)
+{
+  int test_ret_value         = 0;
+  cugraph_error_t* ret_error = NULL;
+
+  cugraph_error_code_t ret_code = cugraph_type_erased_device_array_view_copy_to_host(
+    p_handle, (byte_t*)h_array, view, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+  cugraph_error_free(ret_error);
+  return test_ret_value;
+}
+
+int test_host_uniform_neighbor_sample()
+{
+  size_t num_edges    = 16;
+  size_t num_vertices = 6;
+
+  vertex_t src[] = {0, 1, 1, 2, 2, 2, 3, 4, 1, 3, 4, 0, 1, 3, 5, 5};
+  vertex_t dst[] = {1, 3, 4, 0, 1, 3, 5, 5, 0, 1, 1, 2, 2, 2, 3, 4};
+  weight_t wgt[] = {
+    0.1f, 2.1f, 1.1f, 5.1f, 3.1f, 4.1f, 7.2f, 3.2f, 0.1f, 2.1f, 1.1f, 5.1f, 3.1f, 4.1f, 7.2f, 3.2f};
+
+  vertex_t start[] = {2, 3};
+  int fan_out[]    = {2, 2};
+
+  int test_ret_value = 0;
+
+  cugraph_error_code_t ret_code;
+  cugraph_error_t* ret_error          = NULL;
+  cugraph_resource_handle_t* p_handle = NULL;
+  cugraph_graph_t* p_graph            = NULL;
+  cugraph_sampling_options_t* options = NULL;
+  cugraph_sample_result_t* p_result   = NULL;
+
+  p_handle = cugraph_create_resource_handle(NULL);
+  TEST_ASSERT(test_ret_value, p_handle != NULL, "resource handle creation failed.");
+
+  test_ret_value =
+    create_host_test_graph(p_handle, src, dst, wgt, num_edges, FALSE, &p_graph, &ret_error);
+
+  ret_code = cugraph_sampling_options_create(&options, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "sampling_options create failed.");
+
+  cugraph_sampling_set_return_hops(options, TRUE);
+  cugraph_sampling_set_with_replacement(options, FALSE);
+
+  if (test_ret_value == 0) {
+    test_ret_value = run_neighbor_sample(
+      p_handle, p_graph, start, 2, NULL, 0, fan_out, 2, options, FALSE, &p_result);
+  }
+
+  if (test_ret_value == 0) {
+    cugraph_type_erased_device_array_view_t* result_srcs =
+      cugraph_sample_result_get_majors(p_result);
+    cugraph_type_erased_device_array_view_t* result_dsts =
+      cugraph_sample_result_get_minors(p_result);
+    cugraph_type_erased_device_array_view_t* result_offsets =
+      cugraph_sample_result_get_label_hop_offsets(p_result);
+
+    size_t result_size         = cugraph_type_erased_device_array_view_size(result_srcs);
+    size_t result_offsets_size = cugraph_type_erased_device_array_view_size(result_offsets);
+
+    TEST_ASSERT(test_ret_value, result_offsets_size == 3, "expected one offset per hop");
+
+    vertex_t h_srcs[result_size + 1];
+    vertex_t h_dsts[result_size + 1];
+    size_t h_offsets[result_offsets_size];
+
+    test_ret_value |= copy_result_array(p_handle, result_srcs, h_srcs);
+    test_ret_value |= copy_result_array(p_handle, result_dsts, h_dsts);
+    test_ret_value |= copy_result_array(p_handle, result_offsets, h_offsets);
+
+    TEST_ASSERT(test_ret_value, h_offsets[2] == result_size, "hop offsets don't cover the result");
+
+    /* without replacement every seed has at least two out-edges, so the first hop is full */
+    TEST_ASSERT(test_ret_value, h_offsets[1] == 4, "first hop should sample 2 edges per seed");
+
+    for (size_t i = 0; (i < result_size) && (test_ret_value == 0); ++i) {
+      int found = 0;
+      for (size_t j = 0; j < num_edges; ++j)
+        if ((src[j] == h_srcs[i]) && (dst[j] == h_dsts[i])) found = 1;
+
+      TEST_ASSERT(test_ret_value, found, "sampled edge is not in the graph");
+      TEST_ASSERT(test_ret_value,
+                  (h_srcs[i] >= 0) && (h_srcs[i] < (vertex_t)num_vertices),
+                  "sampled source out of range");
+
+      if (i < h_offsets[1]) {
+        TEST_ASSERT(test_ret_value,
+                    (h_srcs[i] == start[0]) || (h_srcs[i] == start[1]),
+                    "first hop source is not a seed");
+      }
+    }
+  }
+
+  cugraph_sample_result_free(p_result);
+  cugraph_sampling_options_free(options);
+  cugraph_graph_free(p_graph);
+  cugraph_free_resource_handle(p_handle);
+  cugraph_error_free(ret_error);
+
+  return test_ret_value;
+}
+
+int test_host_biased_neighbor_sample()
+{
+  size_t num_edges = 10;
+
+  /* vertex 0 has one edge with weight 0, which must never be selected */
+  vertex_t src[] = {0, 0, 0, 0, 1, 1, 2, 2, 3, 4};
+  vertex_t dst[] = {1, 2, 3, 4, 0, 2, 0, 3, 4, 0};
+  weight_t wgt[] = {1.0f, 0.0f, 5.0f, 2.0f, 1.0f, 1.0f, 3.0f, 1.0f, 1.0f, 1.0f};
+
+  vertex_t start[] = {0, 0, 0, 0, 0, 0, 0, 0};
+  int fan_out[]    = {3};
+
+  int test_ret_value = 0;
+
+  cugraph_error_code_t ret_code;
+  cugraph_error_t* ret_error          = NULL;
+  cugraph_resource_handle_t* p_handle = NULL;
+  cugraph_graph_t* p_graph            = NULL;
+  cugraph_sampling_options_t* options = NULL;
+  cugraph_sample_result_t* p_result   = NULL;
+
+  p_handle = cugraph_create_resource_handle(NULL);
+  TEST_ASSERT(test_ret_value, p_handle != NULL, "resource handle creation failed.");
+
+  test_ret_value =
+    create_host_test_graph(p_handle, src, dst, wgt, num_edges, FALSE, &p_graph, &ret_error);
+
+  ret_code = cugraph_sampling_options_create(&options, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "sampling_options create failed.");
+
+  cugraph_sampling_set_with_replacement(options, TRUE);
+
+  if (test_ret_value == 0) {
+    test_ret_value = run_neighbor_sample(
+      p_handle, p_graph, start, 8, NULL, 0, fan_out, 1, options, TRUE, &p_result);
+  }
+
+  if (test_ret_value == 0) {
+    cugraph_type_erased_device_array_view_t* result_srcs =
+      cugraph_sample_result_get_majors(p_result);
+    cugraph_type_erased_device_array_view_t* result_dsts =
+      cugraph_sample_result_get_minors(p_result);
+    cugraph_type_erased_device_array_view_t* result_wgts =
+      cugraph_sample_result_get_edge_weight(p_result);
+
+    size_t result_size = cugraph_type_erased_device_array_view_size(result_srcs);
+
+    TEST_ASSERT(test_ret_value, result_size == 24, "expected fan_out samples per seed");
+
+    vertex_t h_srcs[result_size + 1];
+    vertex_t h_dsts[result_size + 1];
+    weight_t h_wgts[result_size + 1];
+
+    test_ret_value |= copy_result_array(p_handle, result_srcs, h_srcs);
+    test_ret_value |= copy_result_array(p_handle, result_dsts, h_dsts);
+    test_ret_value |= copy_result_array(p_handle, result_wgts, h_wgts);
+
+    for (size_t i = 0; (i < result_size) && (test_ret_value == 0); ++i) {
+      TEST_ASSERT(test_ret_value, h_srcs[i] == 0, "sampled source is not the seed");
+      TEST_ASSERT(test_ret_value, h_dsts[i] != 2, "sampled an edge with zero bias");
+      TEST_ASSERT(test_ret_value, h_wgts[i] > 0, "sampled an edge with zero bias");
+    }
+  }
+
+  cugraph_sample_result_free(p_result);
+  cugraph_sampling_options_free(options);
+  cugraph_graph_free(p_graph);
+  cugraph_free_resource_handle(p_handle);
+  cugraph_error_free(ret_error);
+
+  return test_ret_value;
+}
+
+int test_host_neighbor_sample_renumber_csr()
+{
+  size_t num_edges = 16;
+
+  vertex_t src[] = {0, 1, 1, 2, 2, 2, 3, 4, 1, 3, 4, 0, 1, 3, 5, 5};
+  vertex_t dst[] = {1, 3, 4, 0, 1, 3, 5, 5, 0, 1, 1, 2, 2, 2, 3, 4};
+  weight_t wgt[] = {
+    0.1f, 2.1f, 1.1f, 5.1f, 3.1f, 4.1f, 7.2f, 3.2f, 0.1f, 2.1f, 1.1f, 5.1f, 3.1f, 4.1f, 7.2f, 3.2f};
+
+  vertex_t start[]       = {2, 3, 1, 5};
+  size_t label_offsets[] = {0, 2, 4};
+  int fan_out[]          = {2, 2};
+
+  size_t num_labels = 2;
+  size_t num_hops   = 2;
+
+  int test_ret_value = 0;
+
+  cugraph_error_code_t ret_code;
+  cugraph_error_t* ret_error          = NULL;
+  cugraph_resource_handle_t* p_handle = NULL;
+  cugraph_graph_t* p_graph            = NULL;
+  cugraph_sampling_options_t* options = NULL;
+  cugraph_sample_result_t* p_result   = NULL;
+
+  p_handle = cugraph_create_resource_handle(NULL);
+  TEST_ASSERT(test_ret_value, p_handle != NULL, "resource handle creation failed.");
+
+  test_ret_value =
+    create_host_test_graph(p_handle, src, dst, wgt, num_edges, FALSE, &p_graph, &ret_error);
+
+  ret_code = cugraph_sampling_options_create(&options, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "sampling_options create failed.");
+
+  cugraph_sampling_set_return_hops(options, TRUE);
+  cugraph_sampling_set_renumber_results(options, TRUE);
+  cugraph_sampling_set_compression_type(options, CSR);
+  cugraph_sampling_set_compress_per_hop(options, TRUE);
+
+  if (test_ret_value == 0) {
+    test_ret_value = run_neighbor_sample(p_handle,
+                                         p_graph,
+                                         start,
+                                         4,
+                                         label_offsets,
+                                         num_labels,
+                                         fan_out,
+                                         num_hops,
+                                         options,
+                                         FALSE,
+                                         &p_result);
+  }
+
+  if (test_ret_value == 0) {
+    cugraph_type_erased_device_array_view_t* result_minors =
+      cugraph_sample_result_get_minors(p_result);
+    cugraph_type_erased_device_array_view_t* result_major_offsets =
+      cugraph_sample_result_get_major_offsets(p_result);
+    cugraph_type_erased_device_array_view_t* result_label_hop_offsets =
+      cugraph_sample_result_get_label_hop_offsets(p_result);
+    cugraph_type_erased_device_array_view_t* result_renumber_map =
+      cugraph_sample_result_get_renumber_map(p_result);
+    cugraph_type_erased_device_array_view_t* result_renumber_map_offsets =
+      cugraph_sample_result_get_renumber_map_offsets(p_result);
+
+    size_t minors_size = cugraph_type_erased_device_array_view_size(result_minors);
+    size_t major_offsets_size =
+      cugraph_type_erased_device_array_view_size(result_major_offsets);
+    size_t label_hop_offsets_size =
+      cugraph_type_erased_device_array_view_size(result_label_hop_offsets);
+    size_t renumber_map_size = cugraph_type_erased_device_array_view_size(result_renumber_map);
+    size_t renumber_map_offsets_size =
+      cugraph_type_erased_device_array_view_size(result_renumber_map_offsets);
+
+    TEST_ASSERT(test_ret_value,
+                label_hop_offsets_size == num_labels * num_hops + 1,
+                "expected one offset per label and hop");
+    TEST_ASSERT(test_ret_value,
+                renumber_map_offsets_size == num_labels + 1,
+                "expected one renumber map per label");
+
+    vertex_t h_minors[minors_size + 1];
+    size_t h_major_offsets[major_offsets_size];
+    size_t h_label_hop_offsets[label_hop_offsets_size];
+    vertex_t h_renumber_map[renumber_map_size + 1];
+    size_t h_renumber_map_offsets[renumber_map_offsets_size];
+
+    test_ret_value |= copy_result_array(p_handle, result_minors, h_minors);
+    test_ret_value |= copy_result_array(p_handle, result_major_offsets, h_major_offsets);
+    test_ret_value |= copy_result_array(p_handle, result_label_hop_offsets, h_label_hop_offsets);
+    test_ret_value |= copy_result_array(p_handle, result_renumber_map, h_renumber_map);
+    test_ret_value |=
+      copy_result_array(p_handle, result_renumber_map_offsets, h_renumber_map_offsets);
+
+    TEST_ASSERT(test_ret_value,
+                h_major_offsets[major_offsets_size - 1] == minors_size,
+                "major offsets don't cover the minors");
+    TEST_ASSERT(test_ret_value,
+                h_label_hop_offsets[label_hop_offsets_size - 1] == major_offsets_size - 1,
+                "label hop offsets don't cover the major offsets");
+    TEST_ASSERT(test_ret_value,
+                h_renumber_map_offsets[num_labels] == renumber_map_size,
+                "renumber map offsets don't cover the renumber map");
+
+    /* the minors of each label are renumbered into the vertices of that label's map */
+    for (size_t l = 0; (l < num_labels) && (test_ret_value == 0); ++l) {
+      size_t map_size = h_renumber_map_offsets[l + 1] - h_renumber_map_offsets[l];
+      size_t first    = h_major_offsets[h_label_hop_offsets[l * num_hops]];
+      size_t last     = h_major_offsets[h_label_hop_offsets[(l + 1) * num_hops]];
+
+      for (size_t i = first; (i < last) && (test_ret_value == 0); ++i) {
+        TEST_ASSERT(test_ret_value,
+                    (h_minors[i] >= 0) && ((size_t)h_minors[i] < map_size),
+                    "renumbered minor is outside the label's renumber map");
+      }
+    }
+  }
+
+  cugraph_sample_result_free(p_result);
+  cugraph_sampling_options_free(options);
+  cugraph_graph_free(p_graph);
+  cugraph_free_resource_handle(p_handle);
+  cugraph_error_free(ret_error);
+
+  return test_ret_value;
+}
+
+/******************************************************************************/
+
+int main(int argc, char** argv)
+{
+  int result = 0;
+  result |= RUN_TEST(test_host_uniform_neighbor_sample);
+  result |= RUN_TEST(test_host_biased_neighbor_sample);
+  result |= RUN_TEST(test_host_neighbor_sample_renumber_csr);
+  return result;
+}
@@ -0,0 +1,293 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "c_test_utils.h" /* RUN_TEST */
+
+#include <cugraph_c/algorithms.h>
+#include <cugraph_c/graph.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+typedef int32_t vertex_t;
+typedef int32_t edge_t;
+typedef float weight_t;
+
+typedef enum { UNIFORM_WALK, BIASED_WALK, NODE2VEC_WALK } walk_type_t;
+
+/*
+ * Runs random walks from h_start on p_graph and copies the paths (num_starts * (max_length + 1)
+ * vertices) and the weights (num_starts * max_length) to h_paths and h_weights.
+ */
+int run_random_walks(const cugraph_resource_handle_t* p_handle,
+                     cugraph_graph_t* p_graph,
+                     walk_type_t walk_type,
+                     vertex_t* h_start,
+                     size_t num_starts,
+                     size_t max_length,
+                     double p,
+                     double q,
+                     vertex_t* h_paths,
+                     weight_t* h_weights)
+{
+  int test_ret_value = 0;
+
+  cugraph_error_code_t ret_code;
+  cugraph_error_t* ret_error = NULL;
+
+  cugraph_type_erased_device_array_t* d_start           = NULL;
+  cugraph_type_erased_device_array_view_t* d_start_view = NULL;
+  cugraph_rng_state_t* rng_state                        = NULL;
+  cugraph_random_walk_result_t* p_result                = NULL;
+
+  ret_code =
+    cugraph_type_erased_device_array_create(p_handle, num_starts, INT32, &d_start, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "d_start create failed.");
+
+  d_start_view = cugraph_type_erased_device_array_view(d_start);
+
+  ret_code = cugraph_type_erased_device_array_view_copy_from_host(
+    p_handle, d_start_view, (byte_t*)h_start, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "start copy_from_host failed.");
+
+  ret_code = cugraph_rng_state_create(p_handle, 0, &rng_state, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "rng_state create failed.");
+
+  switch (walk_type) {
+    case UNIFORM_WALK:
+      ret_code = cugraph_uniform_random_walks(
+        p_handle, rng_state, p_graph, d_start_view, max_length, &p_result, &ret_error);
+      break;
+    case BIASED_WALK:
+      ret_code = cugraph_biased_random_walks(
+        p_handle, rng_state, p_graph, d_start_view, max_length, &p_result, &ret_error);
+      break;
+    case NODE2VEC_WALK:
+      ret_code = cugraph_node2vec_random_walks(
+        p_handle, rng_state, p_graph, d_start_view, max_length, p, q, &p_result, &ret_error);
+      break;
+  }
+
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, cugraph_error_message(ret_error));
+
+  if (test_ret_value == 0) {
+    cugraph_type_erased_device_array_view_t* paths =
+      cugraph_random_walk_result_get_paths(p_result);
+    cugraph_type_erased_device_array_view_t* weights =
+      cugraph_random_walk_result_get_weights(p_result);
+
+    TEST_ASSERT(test_ret_value,
+                cugraph_type_erased_device_array_view_size(paths) == num_starts * (max_length + 1),
+                "paths have the wrong size");
+    TEST_ASSERT(test_ret_value,
+                cugraph_type_erased_device_array_view_size(weights) == num_starts * max_length,
+                "weights have the wrong size");
+
+    ret_code = cugraph_type_erased_device_array_view_copy_to_host(
+      p_handle, (byte_t*)h_paths, paths, &ret_error);
+    TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+    ret_code = cugraph_type_erased_device_array_view_copy_to_host(
+      p_handle, (byte_t*)h_weights, weights, &ret_error);
+    TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+  }
+
+  cugraph_random_walk_result_free(p_result);
+  cugraph_rng_state_free(rng_state);
+  cugraph_type_erased_device_array_view_free(d_start_view);
+  cugraph_type_erased_device_array_free(d_start);
+  cugraph_error_free(ret_error);
+
+  return test_ret_value;
+}
+
+/*
+ * Checks that every step of every path follows an edge of the graph with the reported weight,
+ * and that walks only end early at vertices without out-edges.
+ */
+int check_paths(vertex_t* src,
+                vertex_t* dst,
+                weight_t* wgt,
+                size_t num_edges,
+                vertex_t* h_start,
+                size_t num_starts,
+                size_t max_length,
+                vertex_t* h_paths,
+                weight_t* h_weights)
+{
+  int test_ret_value = 0;
+
+  for (size_t i = 0; (i < num_starts) && (test_ret_value == 0); ++i) {
+    vertex_t* path = h_paths + i * (max_length + 1);
+    TEST_ASSERT(test_ret_value, path[0] == h_start[i], "path does not begin at its start vertex");
+
+    for (size_t j = 0; (j < max_length) && (test_ret_value == 0); ++j) {
+      if (path[j + 1] < 0) {
+        int departing_count = 0;
+        for (size_t k = 0; k < num_edges; ++k)
+          if ((path[j] >= 0) && (src[k] == path[j])) ++departing_count;
+        TEST_ASSERT(test_ret_value, departing_count == 0, "walk ended when an edge exists");
+        continue;
+      }
+
+      int found = 0;
+      for (size_t k = 0; k < num_edges; ++k)
+        if ((src[k] == path[j]) && (dst[k] == path[j + 1]) &&
+            (wgt[k] == h_weights[i * max_length + j]))
+          found = 1;
+      TEST_ASSERT(test_ret_value, found, "walk took an edge that is not in the graph");
+    }
+  }
+
+  return test_ret_value;
+}
+
+int test_host_random_walks()
+{
+  size_t num_edges  = 9;
+  size_t num_starts = 6;
+  size_t max_length = 5;
+
+  /* vertex 0 has an edge of weight 0 to vertex 4, biased walks never take it */
+  vertex_t src[] = {0, 0, 0, 1, 1, 2, 2, 3, 4};
+  vertex_t dst[] = {1, 2, 4, 2, 3, 0, 3, 0, 5};
+  weight_t wgt[] = {1.0f, 3.0f, 0.0f, 2.0f, 1.0f, 1.0f, 4.0f, 2.0f, 1.0f};
+
+  vertex_t start[] = {0, 1, 2, 3, 4, 5};
+
+  vertex_t h_paths[num_starts * (max_length + 1)];
+  weight_t h_weights[num_starts * max_length];
+
+  int test_ret_value = 0;
+
+  cugraph_error_t* ret_error          = NULL;
+  cugraph_resource_handle_t* p_handle = NULL;
+  cugraph_graph_t* p_graph            = NULL;
+
+  p_handle = cugraph_create_resource_handle(NULL);
+  TEST_ASSERT(test_ret_value, p_handle != NULL, "resource handle creation failed.");
+
+  test_ret_value =
+    create_host_test_graph(p_handle, src, dst, wgt, num_edges, TRUE, &p_graph, &ret_error);
+
+  for (int walk_type = UNIFORM_WALK; (walk_type <= NODE2VEC_WALK) && (test_ret_value == 0);
+       ++walk_type) {
+    test_ret_value = run_random_walks(p_handle,
+                                      p_graph,
+                                      (walk_type_t)walk_type,
+                                      start,
+                                      num_starts,
+                                      max_length,
+                                      0.5,
+                                      2.0,
+                                      h_paths,
+                                      h_weights);
+
+    if (test_ret_value == 0) {
+      test_ret_value = check_paths(
+        src, dst, wgt, num_edges, start, num_starts, max_length, h_paths, h_weights);
+    }
+
+    /* biased and node2vec walks never take the edge of weight 0 */
+    for (size_t i = 0; (i < num_starts) && (walk_type != UNIFORM_WALK); ++i) {
+      vertex_t* path = h_paths + i * (max_length + 1);
+      for (size_t j = 0; j < max_length; ++j) {
+        TEST_ASSERT(
+          test_ret_value, (path[j] != 0) || (path[j + 1] != 4), "walk took an edge of weight 0");
+      }
+    }
+  }
+
+  cugraph_graph_free(p_graph);
+  cugraph_free_resource_handle(p_handle);
+  cugraph_error_free(ret_error);
+
+  return test_ret_value;
+}
+
+int test_host_node2vec_returns()
+{
+  size_t num_edges  = 8;
+  size_t num_starts = 1000;
+  size_t max_length = 2;
+
+  /* an undirected star around vertex 0, with a small p the second step almost always returns */
+  vertex_t src[] = {0, 0, 0, 0, 1, 2, 3, 4};
+  vertex_t dst[] = {1, 2, 3, 4, 0, 0, 0, 0};
+  weight_t wgt[] = {1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f};
+
+  vertex_t* start   = (vertex_t*)malloc(num_starts * sizeof(vertex_t));
+  vertex_t* paths   = (vertex_t*)malloc(num_starts * (max_length + 1) * sizeof(vertex_t));
+  weight_t* weights = (weight_t*)malloc(num_starts * max_length * sizeof(weight_t));
+
+  for (size_t i = 0; i < num_starts; ++i)
+    start[i] = 1 + (vertex_t)(i % 4);
+
+  int test_ret_value = 0;
+
+  cugraph_error_t* ret_error          = NULL;
+  cugraph_resource_handle_t* p_handle = NULL;
+  cugraph_graph_t* p_graph            = NULL;
+
+  p_handle = cugraph_create_resource_handle(NULL);
+  TEST_ASSERT(test_ret_value, p_handle != NULL, "resource handle creation failed.");
+
+  test_ret_value =
+    create_host_test_graph(p_handle, src, dst, wgt, num_edges, FALSE, &p_graph, &ret_error);
+
+  if (test_ret_value == 0) {
+    test_ret_value = run_random_walks(p_handle,
+                                      p_graph,
+                                      NODE2VEC_WALK,
+                                      start,
+                                      num_starts,
+                                      max_length,
+                                      0.001,
+                                      1.0,
+                                      paths,
+                                      weights);
+  }
+
+  if (test_ret_value == 0) {
+    /* the return edge is 1000 times more likely than each of the 3 other edges */
+    size_t returns = 0;
+    for (size_t i = 0; i < num_starts; ++i) {
+      vertex_t* path = paths + i * (max_length + 1);
+      if (path[2] == path[0]) ++returns;
+    }
+    TEST_ASSERT(test_ret_value, returns > 0.95 * num_starts, "node2vec walks did not return");
+  }
+
+  cugraph_graph_free(p_graph);
+  cugraph_free_resource_handle(p_handle);
+  cugraph_error_free(ret_error);
+
+  free(weights);
+  free(paths);
+  free(start);
+
+  return test_ret_value;
+}
+
+/******************************************************************************/
+
+int main(int argc, char** argv)
+{
+  int result = 0;
+  result |= RUN_TEST(test_host_random_walks);
+  result |= RUN_TEST(test_host_node2vec_returns);
+  return result;
+}
@@ -0,0 +1,399 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "c_test_utils.h" /* RUN_TEST */
+
+#include <cugraph_c/algorithms.h>
+#include <cugraph_c/graph.h>
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+typedef int32_t vertex_t;
+typedef int32_t edge_t;
+typedef float weight_t;
+
+/*
+ * Counts the triangles of h_verts (all vertices if NULL) and copies the vertices and counts,
+ * num_results of each, to h_result_verts and h_result_counts.
+ */
+int run_triangle_count(const cugraph_resource_handle_t* p_handle,
+                       cugraph_graph_t* p_graph,
+                       vertex_t* h_verts,
+                       size_t num_results,
+                       vertex_t* h_result_verts,
+                       edge_t* h_result_counts)
+{
+  int test_ret_value = 0;
+
+  cugraph_error_code_t ret_code;
+  cugraph_error_t* ret_error = NULL;
+
+  cugraph_type_erased_device_array_t* p_verts           = NULL;
+  cugraph_type_erased_device_array_view_t* p_verts_view = NULL;
+  cugraph_triangle_count_result_t* p_result             = NULL;
+
+  if (h_verts != NULL) {
+    ret_code =
+      cugraph_type_erased_device_array_create(p_handle, num_results, INT32, &p_verts, &ret_error);
+    TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "p_verts create failed.");
+
+    p_verts_view = cugraph_type_erased_device_array_view(p_verts);
+
+    ret_code = cugraph_type_erased_device_array_view_copy_from_host(
+      p_handle, p_verts_view, (byte_t*)h_verts, &ret_error);
+    TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "verts copy_from_host failed.");
+  }
+
+  ret_code = cugraph_triangle_count(p_handle, p_graph, p_verts_view, FALSE, &p_result, &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, cugraph_error_message(ret_error));
+
+  if (test_ret_value == 0) {
+    cugraph_type_erased_device_array_view_t* vertices =
+      cugraph_triangle_count_result_get_vertices(p_result);
+    cugraph_type_erased_device_array_view_t* counts =
+      cugraph_triangle_count_result_get_counts(p_result);
+
+    TEST_ASSERT(test_ret_value,
+                cugraph_type_erased_device_array_view_size(vertices) == num_results,
+                "invalid number of results");
+
+    if (test_ret_value == 0) {
+      ret_code = cugraph_type_erased_device_array_view_copy_to_host(
+        p_handle, (byte_t*)h_result_verts, vertices, &ret_error);
+      TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+      ret_code = cugraph_type_erased_device_array_view_copy_to_host(
+        p_handle, (byte_t*)h_result_counts, counts, &ret_error);
+      TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+    }
+
+    cugraph_type_erased_device_array_view_free(vertices);
+    cugraph_type_erased_device_array_view_free(counts);
+    cugraph_triangle_count_result_free(p_result);
+  }
+
+  if (p_verts_view != NULL) cugraph_type_erased_device_array_view_free(p_verts_view);
+  if (p_verts != NULL) cugraph_type_erased_device_array_free(p_verts);
+  cugraph_error_free(ret_error);
+
+  return test_ret_value;
+}
+
+int test_host_triangle_count()
+{
+  size_t num_edges    = 16;
+  size_t num_vertices = 6;
+
+  vertex_t h_src[] = {0, 1, 1, 2, 2, 2, 3, 4, 1, 3, 4, 0, 1, 3, 5, 5};
+  vertex_t h_dst[] = {1, 3, 4, 0, 1, 3, 5, 5, 0, 1, 1, 2, 2, 2, 3, 4};
+  weight_t h_wgt[] = {
+    0.1f, 2.1f, 1.1f, 5.1f, 3.1f, 4.1f, 7.2f, 3.2f, 0.1f, 2.1f, 1.1f, 5.1f, 3.1f, 4.1f, 7.2f, 3.2f};
+
+  vertex_t h_verts[]     = {0, 1, 2, 4};
+  edge_t h_result[]      = {1, 2, 2, 0};
+  edge_t h_all_result[]  = {1, 2, 2, 1, 0, 0};
+  size_t num_results     = 4;
+  vertex_t h_bad_verts[] = {0, 7};
+
+  int test_ret_value = 0;
+
+  cugraph_error_code_t ret_code;
+  cugraph_error_t* ret_error = NULL;
+
+  cugraph_resource_handle_t* p_handle                       = NULL;
+  cugraph_graph_t* p_graph                                  = NULL;
+  cugraph_type_erased_device_array_t* p_bad_verts           = NULL;
+  cugraph_type_erased_device_array_view_t* p_bad_verts_view = NULL;
+  cugraph_triangle_count_result_t* p_result                 = NULL;
+
+  vertex_t h_result_verts[num_vertices];
+  edge_t h_result_counts[num_vertices];
+
+  p_handle = cugraph_create_resource_handle(NULL);
+  TEST_ASSERT(test_ret_value, p_handle != NULL, "resource handle creation failed.");
+
+  test_ret_value =
+    create_symmetric_host_graph(p_handle, h_src, h_dst, h_wgt, num_edges, TRUE, &p_graph);
+
+  if (test_ret_value == 0) {
+    test_ret_value = run_triangle_count(
+      p_handle, p_graph, h_verts, num_results, h_result_verts, h_result_counts);
+  }
+
+  for (size_t i = 0; (i < num_results) && (test_ret_value == 0); ++i) {
+    TEST_ASSERT(test_ret_value, h_result_verts[i] == h_verts[i], "vertices don't match");
+    TEST_ASSERT(test_ret_value, h_result_counts[i] == h_result[i], "counts results don't match");
+  }
+
+  if (test_ret_value == 0) {
+    test_ret_value = run_triangle_count(
+      p_handle, p_graph, NULL, num_vertices, h_result_verts, h_result_counts);
+  }
+
+  for (size_t i = 0; (i < num_vertices) && (test_ret_value == 0); ++i) {
+    TEST_ASSERT(test_ret_value,
+                h_result_counts[i] == h_all_result[h_result_verts[i]],
+                "counts results don't match");
+  }
+
+  /* vertices that are not in the graph are rejected */
+  if (test_ret_value == 0) {
+    ret_code =
+      cugraph_type_erased_device_array_create(p_handle, 2, INT32, &p_bad_verts, &ret_error);
+    TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "p_bad_verts create failed.");
+
+    p_bad_verts_view = cugraph_type_erased_device_array_view(p_bad_verts);
+
+    ret_code = cugraph_type_erased_device_array_view_copy_from_host(
+      p_handle, p_bad_verts_view, (byte_t*)h_bad_verts, &ret_error);
+    TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "verts copy_from_host failed.");
+
+    ret_code =
+      cugraph_triangle_count(p_handle, p_graph, p_bad_verts_view, FALSE, &p_result, &ret_error);
+    TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_INVALID_INPUT, "invalid vertex should fail");
+
+    cugraph_type_erased_device_array_view_free(p_bad_verts_view);
+    cugraph_type_erased_device_array_free(p_bad_verts);
+  }
+
+  cugraph_graph_free(p_graph);
+  cugraph_free_resource_handle(p_handle);
+  cugraph_error_free(ret_error);
+
+  return test_ret_value;
+}
+
+int test_host_triangle_count_not_symmetric()
+{
+  size_t num_edges = 3;
+
+  vertex_t h_src[] = {0, 1, 2};
+  vertex_t h_dst[] = {1, 2, 0};
+
+  int test_ret_value = 0;
+
+  cugraph_error_code_t ret_code;
+  cugraph_error_t* ret_error = NULL;
+
+  cugraph_resource_handle_t* p_handle          = NULL;
+  cugraph_graph_t* p_graph                     = NULL;
+  cugraph_triangle_count_result_t* p_result    = NULL;
+  cugraph_induced_subgraph_result_t* p_k_truss = NULL;
+
+  p_handle = cugraph_create_resource_handle(NULL);
+  TEST_ASSERT(test_ret_value, p_handle != NULL, "resource handle creation failed.");
+
+  test_ret_value =
+    create_symmetric_host_graph(p_handle, h_src, h_dst, NULL, num_edges, FALSE, &p_graph);
+
+  if (test_ret_value == 0) {
+    ret_code = cugraph_triangle_count(p_handle, p_graph, NULL, FALSE, &p_result, &ret_error);
+    TEST_ASSERT(test_ret_value,
+                ret_code == CUGRAPH_INVALID_INPUT,
+                "triangle count of a directed graph should fail");
+    cugraph_error_free(ret_error);
+    ret_error = NULL;
+
+    ret_code = cugraph_k_truss_subgraph(p_handle, p_graph, 3, FALSE, &p_k_truss, &ret_error);
+    TEST_ASSERT(test_ret_value,
+                ret_code == CUGRAPH_INVALID_INPUT,
+                "k-truss of a directed graph should fail");
+  }
+
+  cugraph_graph_free(p_graph);
+  cugraph_free_resource_handle(p_handle);
+  cugraph_error_free(ret_error);
+
+  return test_ret_value;
+}
+
+int test_host_k_truss()
+{
+  size_t num_edges = 16;
+  size_t k         = 3;
+
+  vertex_t h_src[] = {0, 1, 1, 2, 2, 2, 3, 4, 1, 3, 4, 0, 1, 3, 5, 5};
+  vertex_t h_dst[] = {1, 3, 4, 0, 1, 3, 5, 5, 0, 1, 1, 2, 2, 2, 3, 4};
+  weight_t h_wgt[] = {
+    0.1f, 2.1f, 1.1f, 5.1f, 3.1f, 4.1f, 7.2f, 3.2f, 0.1f, 2.1f, 1.1f, 5.1f, 3.1f, 4.1f, 7.2f, 3.2f};
+
+  vertex_t h_expected_src[]   = {1, 2, 2, 3, 3, 0, 0, 1, 1, 2};
+  vertex_t h_expected_dst[]   = {0, 0, 1, 1, 2, 1, 2, 2, 3, 3};
+  weight_t h_expected_wgt[]   = {0.1, 5.1, 3.1, 2.1, 4.1, 0.1, 5.1, 3.1, 2.1, 4.1};
+  size_t h_expected_offsets[] = {0, 10};
+  size_t num_expected_edges   = 10;
+
+  int test_ret_value = 0;
+
+  cugraph_error_code_t ret_code;
+  cugraph_error_t* ret_error = NULL;
+
+  cugraph_resource_handle_t* p_handle       = NULL;
+  cugraph_graph_t* p_graph                  = NULL;
+  cugraph_induced_subgraph_result_t* result = NULL;
+
+  p_handle = cugraph_create_resource_handle(NULL);
+  TEST_ASSERT(test_ret_value, p_handle != NULL, "resource handle creation failed.");
+
+  test_ret_value =
+    create_symmetric_host_graph(p_handle, h_src, h_dst, h_wgt, num_edges, TRUE, &p_graph);
+
+  if (test_ret_value == 0) {
+    ret_code = cugraph_k_truss_subgraph(p_handle, p_graph, k, FALSE, &result, &ret_error);
+    TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, cugraph_error_message(ret_error));
+  }
+
+  if (test_ret_value == 0) {
+    cugraph_type_erased_device_array_view_t* src;
+    cugraph_type_erased_device_array_view_t* dst;
+    cugraph_type_erased_device_array_view_t* wgt;
+    cugraph_type_erased_device_array_view_t* offsets;
+
+    src     = cugraph_induced_subgraph_get_sources(result);
+    dst     = cugraph_induced_subgraph_get_destinations(result);
+    wgt     = cugraph_induced_subgraph_get_edge_weights(result);
+    offsets = cugraph_induced_subgraph_get_subgraph_offsets(result);
+
+    size_t num_result_edges = cugraph_type_erased_device_array_view_size(src);
+
+    TEST_ASSERT(
+      test_ret_value, num_result_edges == num_expected_edges, "results not the same size");
+    TEST_ASSERT(test_ret_value, wgt != NULL, "weights should be returned");
+
+    vertex_t h_result_src[num_expected_edges];
+    vertex_t h_result_dst[num_expected_edges];
+    weight_t h_result_wgt[num_expected_edges];
+    size_t h_result_offsets[2];
+
+    if (test_ret_value == 0) {
+      ret_code = cugraph_type_erased_device_array_view_copy_to_host(
+        p_handle, (byte_t*)h_result_src, src, &ret_error);
+      TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+      ret_code = cugraph_type_erased_device_array_view_copy_to_host(
+        p_handle, (byte_t*)h_result_dst, dst, &ret_error);
+      TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+      ret_code = cugraph_type_erased_device_array_view_copy_to_host(
+        p_handle, (byte_t*)h_result_wgt, wgt, &ret_error);
+      TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+
+      ret_code = cugraph_type_erased_device_array_view_copy_to_host(
+        p_handle, (byte_t*)h_result_offsets, offsets, &ret_error);
+      TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "copy_to_host failed.");
+    }
+
+    for (size_t i = 0; (i < 2) && (test_ret_value == 0); ++i) {
+      TEST_ASSERT(test_ret_value,
+                  h_expected_offsets[i] == h_result_offsets[i],
+                  "graph offsets should match");
+    }
+
+    for (size_t i = 0; (i < num_expected_edges) && (test_ret_value == 0); ++i) {
+      bool_t found = FALSE;
+      for (size_t j = 0; (j < num_expected_edges) && !found; ++j) {
+        found = (h_expected_src[i] == h_result_src[j]) &&
+                (h_expected_dst[i] == h_result_dst[j]) &&
+                nearlyEqual(h_expected_wgt[i], h_result_wgt[j], 0.001);
+      }
+      TEST_ASSERT(test_ret_value, found, "extracted an edge that doesn't match");
+    }
+
+    cugraph_type_erased_device_array_view_free(src);
+    cugraph_type_erased_device_array_view_free(dst);
+    cugraph_type_erased_device_array_view_free(wgt);
+    cugraph_type_erased_device_array_view_free(offsets);
+    cugraph_induced_subgraph_result_free(result);
+  }
+
+  cugraph_graph_free(p_graph);
+  cugraph_free_resource_handle(p_handle);
+  cugraph_error_free(ret_error);
+
+  return test_ret_value;
+}
+
+/*
+ * Counts the triangles of a small power law (R-MAT) graph on the host and compares them with the
+ * naive count.
+ */
+int test_host_triangle_count_power_law()
+{
+  int scale = 10;
+
+  int test_ret_value = 0;
+
+  cugraph_resource_handle_t* p_handle = NULL;
+  cugraph_graph_t* p_graph            = NULL;
+
+  vertex_t* src = NULL;
+  vertex_t* dst = NULL;
+
+  p_handle = cugraph_create_resource_handle(NULL);
+  TEST_ASSERT(test_ret_value, p_handle != NULL, "resource handle creation failed.");
+
+  size_t num_edges = generate_symmetric_rmat_edges(scale, 16, 42, &src, &dst);
+
+  /* the edges are symmetric and sorted, the last source is the largest vertex id */
+  size_t num_vertices = (size_t)src[num_edges - 1] + 1;
+
+  vertex_t* vertices = (vertex_t*)malloc(num_vertices * sizeof(vertex_t));
+  edge_t* counts     = (edge_t*)malloc(num_vertices * sizeof(edge_t));
+  edge_t* naive      = (edge_t*)malloc(num_vertices * sizeof(edge_t));
+
+  count_triangles_naive(src, dst, num_edges, num_vertices, naive);
+
+  if (test_ret_value == 0) {
+    test_ret_value =
+      create_symmetric_host_graph(p_handle, src, dst, NULL, num_edges, TRUE, &p_graph);
+  }
+  if (test_ret_value == 0) {
+    test_ret_value = run_triangle_count(p_handle, p_graph, NULL, num_vertices, vertices, counts);
+  }
+
+  size_t num_triangles = 0;
+  for (size_t i = 0; (i < num_vertices) && (test_ret_value == 0); ++i) {
+    TEST_ASSERT(
+      test_ret_value, counts[i] == naive[vertices[i]], "counts don't match the naive count");
+    num_triangles += counts[i];
+  }
+  TEST_ASSERT(test_ret_value, num_triangles > 0, "the graph should have triangles");
+
+  free(naive);
+  free(counts);
+  free(vertices);
+  free(dst);
+  free(src);
+
+  cugraph_graph_free(p_graph);
+  cugraph_free_resource_handle(p_handle);
+
+  return test_ret_value;
+}
+
+/******************************************************************************/
+
+int main(int argc, char** argv)
+{
+  int result = 0;
+  result |= RUN_TEST(test_host_triangle_count);
+  result |= RUN_TEST(test_host_triangle_count_not_symmetric);
+  result |= RUN_TEST(test_host_k_truss);
+  result |= RUN_TEST(test_host_triangle_count_power_law);
+  return result;
+}
@@ -20,6 +20,13 @@
 #include <cugraph/utilities/host_scalar_comm.hpp>
 
 #include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+extern "C" double elapsed_us(struct timespec const* start, struct timespec const* stop)
+{
+  return (stop->tv_sec - start->tv_sec) * 1e6 + (stop->tv_nsec - start->tv_nsec) / 1e3;
+}
 
 extern "C" int nearlyEqual(float a, float b, float epsilon)
 {
@@ -212,6 +219,204 @@ extern "C" int create_test_graph_double(const cugraph_resource_handle_t* p_handl
   return test_ret_value;
 }
 
+/*
+ * Simple check of creating a graph from a COO in host memory, the graph stays in host memory.
+ */
+extern "C" int create_host_test_graph(const cugraph_resource_handle_t* p_handle,
+                                      int32_t* h_src,
+                                      int32_t* h_dst,
+                                      float* h_wgt,
+                                      size_t num_edges,
+                                      bool_t renumber,
+                                      cugraph_graph_t** p_graph,
+                                      cugraph_error_t** ret_error)
+{
+  int test_ret_value = 0;
+  cugraph_error_code_t ret_code;
+  cugraph_graph_properties_t properties;
+
+  properties.is_symmetric  = FALSE;
+  properties.is_multigraph = FALSE;
+
+  cugraph_type_erased_host_array_view_t* src_view;
+  cugraph_type_erased_host_array_view_t* dst_view;
+  cugraph_type_erased_host_array_view_t* wgt_view;
+
+  src_view = cugraph_type_erased_host_array_view_create(h_src, num_edges, INT32);
+  dst_view = cugraph_type_erased_host_array_view_create(h_dst, num_edges, INT32);
+  wgt_view = cugraph_type_erased_host_array_view_create(h_wgt, num_edges, FLOAT32);
+
+  ret_code = cugraph_graph_create_sg_from_host_edgelist(p_handle,
+                                                        &properties,
+                                                        src_view,
+                                                        dst_view,
+                                                        wgt_view,
+                                                        renumber,
+                                                        FALSE,
+                                                        FALSE,
+                                                        FALSE,
+                                                        p_graph,
+                                                        ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, "host graph creation failed.");
+
+  cugraph_type_erased_host_array_view_free(wgt_view);
+  cugraph_type_erased_host_array_view_free(dst_view);
+  cugraph_type_erased_host_array_view_free(src_view);
+
+  return test_ret_value;
+}
+
+/*
+ * Creates a host graph with the given is_symmetric property; vertices are not renumbered and no
+ * edges are dropped.
+ */
+extern "C" int create_symmetric_host_graph(const cugraph_resource_handle_t* p_handle,
+                                           int32_t* h_src,
+                                           int32_t* h_dst,
+                                           float* h_wgt,
+                                           size_t num_edges,
+                                           bool_t is_symmetric,
+                                           cugraph_graph_t** p_graph)
+{
+  int test_ret_value = 0;
+
+  cugraph_error_code_t ret_code;
+  cugraph_error_t* ret_error = NULL;
+  cugraph_graph_properties_t properties;
+
+  properties.is_symmetric  = is_symmetric;
+  properties.is_multigraph = FALSE;
+
+  cugraph_type_erased_host_array_view_t* src_view =
+    cugraph_type_erased_host_array_view_create(h_src, num_edges, INT32);
+  cugraph_type_erased_host_array_view_t* dst_view =
+    cugraph_type_erased_host_array_view_create(h_dst, num_edges, INT32);
+  cugraph_type_erased_host_array_view_t* wgt_view =
+    (h_wgt != NULL) ? cugraph_type_erased_host_array_view_create(h_wgt, num_edges, FLOAT32) : NULL;
+
+  ret_code = cugraph_graph_create_sg_from_host_edgelist(p_handle,
+                                                        &properties,
+                                                        src_view,
+                                                        dst_view,
+                                                        wgt_view,
+                                                        FALSE,
+                                                        FALSE,
+                                                        FALSE,
+                                                        FALSE,
+                                                        p_graph,
+                                                        &ret_error);
+  TEST_ASSERT(test_ret_value, ret_code == CUGRAPH_SUCCESS, cugraph_error_message(ret_error));
+
+  if (wgt_view != NULL) cugraph_type_erased_host_array_view_free(wgt_view);
+  cugraph_type_erased_host_array_view_free(dst_view);
+  cugraph_type_erased_host_array_view_free(src_view);
+  cugraph_error_free(ret_error);
+
+  return test_ret_value;
+}
+
+static uint64_t next_random(uint64_t* state)
+{
+  *state ^= *state << 13;
+  *state ^= *state >> 7;
+  *state ^= *state << 17;
+  return *state;
+}
+
+static int compare_edges(void const* a, void const* b)
+{
+  uint64_t x = *(uint64_t const*)a;
+  uint64_t y = *(uint64_t const*)b;
+  return (x > y) - (x < y);
+}
+
+/*
+ * Generates edge_factor << scale power law (R-MAT) edges and returns both directions of every
+ * edge, sorted by source and destination, without self loops and multi-edges.
+ */
+extern "C" size_t generate_symmetric_rmat_edges(
+  int scale, size_t edge_factor, uint64_t seed, int32_t** h_src, int32_t** h_dst)
+{
+  size_t num_random_edges = edge_factor << scale;
+
+  uint64_t* edges  = (uint64_t*)malloc(2 * num_random_edges * sizeof(uint64_t));
+  uint64_t state   = seed;
+  size_t num_edges = 0;
+  for (size_t i = 0; i < num_random_edges; ++i) {
+    uint64_t u = 0;
+    uint64_t v = 0;
+    for (int bit = 0; bit < scale; ++bit) {
+      double p = (double)(next_random(&state) >> 11) / 9007199254740992.0;
+      u |= (uint64_t)(p > 0.76) << bit;
+      v |= (uint64_t)(((p > 0.57) && (p <= 0.76)) || (p > 0.95)) << bit;
+    }
+    if (u == v) continue;
+    edges[num_edges++] = (u << 32) | v;
+    edges[num_edges++] = (v << 32) | u;
+  }
+  qsort(edges, num_edges, sizeof(uint64_t), compare_edges);
+
+  size_t num_unique = 0;
+  for (size_t i = 0; i < num_edges; ++i) {
+    if ((num_unique == 0) || (edges[i] != edges[num_unique - 1])) edges[num_unique++] = edges[i];
+  }
+
+  *h_src = (int32_t*)malloc(num_unique * sizeof(int32_t));
+  *h_dst = (int32_t*)malloc(num_unique * sizeof(int32_t));
+  for (size_t i = 0; i < num_unique; ++i) {
+    (*h_src)[i] = (int32_t)(edges[i] >> 32);
+    (*h_dst)[i] = (int32_t)(edges[i] & 0xffffffff);
+  }
+  free(edges);
+
+  return num_unique;
+}
+
+/*
+ * Counts the triangles of every vertex below num_vertices by merging the full adjacency lists of
+ * both endpoints of every edge of a symmetric edge list sorted by source and destination.
+ */
+extern "C" void count_triangles_naive(int32_t const* h_src,
+                                      int32_t const* h_dst,
+                                      size_t num_edges,
+                                      size_t num_vertices,
+                                      int32_t* h_counts)
+{
+  size_t* offsets = (size_t*)calloc(num_vertices + 1, sizeof(size_t));
+  for (size_t e = 0; e < num_edges; ++e)
+    ++offsets[h_src[e] + 1];
+  for (size_t v = 0; v < num_vertices; ++v)
+    offsets[v + 1] += offsets[v];
+
+  for (size_t v = 0; v < num_vertices; ++v)
+    h_counts[v] = 0;
+
+  for (size_t e = 0; e < num_edges; ++e) {
+    int32_t u = h_src[e];
+    int32_t v = h_dst[e];
+    if (v <= u) continue;
+    size_t i = offsets[u];
+    size_t j = offsets[v];
+    while ((i < offsets[u + 1]) && (j < offsets[v + 1])) {
+      if (h_dst[i] < h_dst[j]) {
+        ++i;
+      } else if (h_dst[j] < h_dst[i]) {
+        ++j;
+      } else {
+        if (h_dst[i] > v) {
+          ++h_counts[u];
+          ++h_counts[v];
+          ++h_counts[h_dst[i]];
+        }
+        ++i;
+        ++j;
+      }
+    }
+  }
+
+  free(offsets);
+}
+
 /*
  * Runs the function pointed to by "test" and returns the return code.  Also
  * prints reporting info (using "test_name"): pass/fail and run time, to stdout.
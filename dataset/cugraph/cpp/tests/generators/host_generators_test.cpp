@@ -0,0 +1,341 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utilities/base_fixture.hpp"
+
+#include <cugraph/host_graph_generators.hpp>
+#include <cugraph/utilities/error.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <set>
+#include <string>
+#include <tuple>
+#include <vector>
+
+struct HostGeneratorsTest : public ::testing::Test {};
+
+template <typename vertex_t>
+struct host_edgelist_t {
+  std::vector<vertex_t> srcs{};
+  std::vector<vertex_t> dsts{};
+
+  cugraph::host_edgelist_consumer_t<vertex_t> consumer()
+  {
+    return [this](vertex_t const* s, vertex_t const* d, size_t n) {
+      srcs.insert(srcs.end(), s, s + n);
+      dsts.insert(dsts.end(), d, d + n);
+    };
+  }
+
+  std::set<std::tuple<vertex_t, vertex_t>> edge_set() const
+  {
+    std::set<std::tuple<vertex_t, vertex_t>> edges{};
+    for (size_t i = 0; i < srcs.size(); ++i) {
+      edges.insert(std::make_tuple(srcs[i], dsts[i]));
+    }
+    return edges;
+  }
+};
+
+// (num_threads, edges_per_chunk) combinations that must all produce the same edge list
+std::vector<cugraph::host_generator_options_t> const host_generator_options_v{
+  {1, size_t{1} << 20}, {8, 1000}, {3, 77777}, {16, size_t{1} << 16}};
+
+TEST_F(HostGeneratorsTest, RmatDeterministic)
+{
+  using vertex_t = int64_t;
+
+  host_edgelist_t<vertex_t> expected{};
+  for (auto options : host_generator_options_v) {
+    host_edgelist_t<vertex_t> actual{};
+    auto num_edges = cugraph::host_generate_rmat_edgelist<vertex_t>(
+      16, 500000, actual.consumer(), 0.57, 0.19, 0.19, 0.1, 42, false, true, options);
+
+    ASSERT_EQ(num_edges, size_t{500000});
+    ASSERT_EQ(actual.srcs.size(), num_edges);
+    if (expected.srcs.empty()) {
+      expected = actual;
+    } else {
+      EXPECT_EQ(expected.srcs, actual.srcs);
+      EXPECT_EQ(expected.dsts, actual.dsts);
+    }
+  }
+
+  auto in_range = [](auto v) { return (v >= 0) && (v < (vertex_t{1} << 16)); };
+  EXPECT_TRUE(std::all_of(expected.srcs.begin(), expected.srcs.end(), in_range));
+  EXPECT_TRUE(std::all_of(expected.dsts.begin(), expected.dsts.end(), in_range));
+}
+
+TEST_F(HostGeneratorsTest, RmatClipAndFlip)
+{
+  using vertex_t = int32_t;
+
+  host_edgelist_t<vertex_t> edges{};
+  cugraph::host_generate_rmat_edgelist<vertex_t>(
+    12, 100000, edges.consumer(), 0.57, 0.19, 0.19, 0.0, 1, true, false);
+
+  for (size_t i = 0; i < edges.srcs.size(); ++i) {
+    ASSERT_GE(edges.srcs[i], edges.dsts[i]);
+  }
+}
+
+TEST_F(HostGeneratorsTest, RmatScrambleIsPermutation)
+{
+  using vertex_t = int32_t;
+
+  host_edgelist_t<vertex_t> plain{};
+  host_edgelist_t<vertex_t> scrambled{};
+  cugraph::host_generate_rmat_edgelist<vertex_t>(
+    12, 100000, plain.consumer(), 0.57, 0.19, 0.19, 0.0, 3, false, false);
+  cugraph::host_generate_rmat_edgelist<vertex_t>(
+    12, 100000, scrambled.consumer(), 0.57, 0.19, 0.19, 0.0, 3, false, true);
+
+  std::vector<vertex_t> map(vertex_t{1} << 12, vertex_t{-1});
+  auto check = [&](vertex_t from, vertex_t to) {
+    if (map[from] == -1) { map[from] = to; }
+    return map[from] == to;
+  };
+  for (size_t i = 0; i < plain.srcs.size(); ++i) {
+    ASSERT_TRUE(check(plain.srcs[i], scrambled.srcs[i]));
+    ASSERT_TRUE(check(plain.dsts[i], scrambled.dsts[i]));
+  }
+
+  std::set<vertex_t> images{};
+  for (auto v : map) {
+    if (v != -1) { ASSERT_TRUE(images.insert(v).second); }
+  }
+}
+
+TEST_F(HostGeneratorsTest, BipartiteRmat)
+{
+  using vertex_t = int32_t;
+
+  host_edgelist_t<vertex_t> expected{};
+  for (auto options : host_generator_options_v) {
+    host_edgelist_t<vertex_t> actual{};
+    cugraph::host_generate_bipartite_rmat_edgelist<vertex_t>(
+      10, 14, 300000, actual.consumer(), 0.57, 0.19, 0.19, 7, options);
+
+    if (expected.srcs.empty()) {
+      expected = actual;
+    } else {
+      EXPECT_EQ(expected.srcs, actual.srcs);
+      EXPECT_EQ(expected.dsts, actual.dsts);
+    }
+  }
+
+  EXPECT_TRUE(std::all_of(
+    expected.srcs.begin(), expected.srcs.end(), [](auto v) { return (v >= 0) && (v < 1024); }));
+  EXPECT_TRUE(std::all_of(
+    expected.dsts.begin(), expected.dsts.end(), [](auto v) { return (v >= 0) && (v < 16384); }));
+}
+
+TEST_F(HostGeneratorsTest, ErdosRenyiGnp)
+{
+  using vertex_t = int64_t;
+
+  vertex_t num_vertices{20000};
+  vertex_t base_vertex_id{5};
+  double p{0.003};
+
+  host_edgelist_t<vertex_t> expected{};
+  for (auto options : host_generator_options_v) {
+    host_edgelist_t<vertex_t> actual{};
+    cugraph::host_generate_erdos_renyi_graph_edgelist_gnp<vertex_t>(
+      num_vertices, p, actual.consumer(), base_vertex_id, 9, options);
+
+    if (expected.srcs.empty()) {
+      expected = actual;
+    } else {
+      EXPECT_EQ(expected.srcs, actual.srcs);
+      EXPECT_EQ(expected.dsts, actual.dsts);
+    }
+  }
+
+  double expected_edge_count = p * num_vertices * (num_vertices - 1);
+  ASSERT_GE(expected.srcs.size(), static_cast<size_t>(expected_edge_count * 0.95));
+  ASSERT_LE(expected.srcs.size(), static_cast<size_t>(expected_edge_count * 1.05));
+
+  // no self loops, no multi-edges, every edge present in both directions
+  auto edges = expected.edge_set();
+  ASSERT_EQ(edges.size(), expected.srcs.size());
+  for (auto [src, dst] : edges) {
+    ASSERT_NE(src, dst);
+    ASSERT_GE(std::min(src, dst), base_vertex_id);
+    ASSERT_LT(std::max(src, dst), base_vertex_id + num_vertices);
+    ASSERT_EQ(edges.count(std::make_tuple(dst, src)), size_t{1});
+  }
+
+  host_edgelist_t<vertex_t> complete{};
+  cugraph::host_generate_erdos_renyi_graph_edgelist_gnp<vertex_t>(50, 1.0, complete.consumer());
+  EXPECT_EQ(complete.srcs.size(), size_t{50 * 49});
+}
+
+TEST_F(HostGeneratorsTest, Mesh2D)
+{
+  using vertex_t = int32_t;
+
+  std::vector<vertex_t> expected_src_v({0,  1,  2,  4, 5, 6, 8, 9, 10, 12, 13, 14, 16, 17, 18,
+                                        20, 21, 22, 0, 1, 2, 3, 8, 9,  10, 11, 16, 17, 18, 19});
+  std::vector<vertex_t> expected_dst_v({1,  2,  3,  5, 6, 7, 9, 10, 11, 13, 14, 15, 17, 18, 19,
+                                        21, 22, 23, 4, 5, 6, 7, 12, 13, 14, 15, 20, 21, 22, 23});
+
+  host_edgelist_t<vertex_t> expected{expected_src_v, expected_dst_v};
+  host_edgelist_t<vertex_t> actual{};
+  cugraph::host_generate_2d_mesh_graph_edgelist<vertex_t>(
+    {{4, 2, 0}, {4, 2, 8}, {4, 2, 16}}, actual.consumer(), {2, 5});
+
+  EXPECT_EQ(actual.srcs.size(), expected_src_v.size());
+  EXPECT_EQ(actual.edge_set(), expected.edge_set());
+}
+
+TEST_F(HostGeneratorsTest, Mesh3D)
+{
+  using vertex_t = int32_t;
+
+  host_edgelist_t<vertex_t> actual{};
+  cugraph::host_generate_3d_mesh_graph_edgelist<vertex_t>(
+    {{3, 3, 3, 0}, {3, 3, 3, 27}, {3, 3, 3, 54}}, actual.consumer(), {3, 7});
+
+  ASSERT_EQ(actual.srcs.size(), size_t{162});
+  auto edges = actual.edge_set();
+  ASSERT_EQ(edges.size(), actual.srcs.size());
+  for (auto [src, dst] : edges) {
+    auto local = src % 27;
+    ASSERT_EQ(src / 27, dst / 27);
+    switch (dst - src) {
+      case 1: EXPECT_NE(local % 3, 2); break;
+      case 3: EXPECT_NE((local / 3) % 3, 2); break;
+      case 9: EXPECT_NE(local / 9, 2); break;
+      default: FAIL() << "not a mesh edge: " << src << " -> " << dst;
+    }
+  }
+}
+
+TEST_F(HostGeneratorsTest, BinaryFileRoundTrip)
+{
+  using vertex_t = int32_t;
+
+  std::string path = ::testing::TempDir() + "host_generators_test.bin";
+
+  host_edgelist_t<vertex_t> expected{};
+  cugraph::host_generate_rmat_edgelist<vertex_t>(
+    14, 123457, expected.consumer(), 0.57, 0.19, 0.19, 0.05, 8);
+
+  {
+    cugraph::host_edgelist_file_writer_t<vertex_t> writer(
+      path, cugraph::host_edgelist_file_format_t::BINARY, vertex_t{1} << 14);
+    cugraph::host_generate_rmat_edgelist<vertex_t>(
+      14,
+      123457,
+      [&](auto srcs, auto dsts, auto n) { writer.append(srcs, dsts, n); },
+      0.57,
+      0.19,
+      0.19,
+      0.05,
+      8,
+      false,
+      false,
+      {4, 1000});
+    writer.close();
+    EXPECT_EQ(writer.num_edges(), size_t{123457});
+  }
+
+  host_edgelist_t<vertex_t> actual{};
+  auto [num_vertices, num_edges] =
+    cugraph::host_read_binary_edgelist_file<vertex_t>(path, actual.consumer(), 999);
+
+  EXPECT_EQ(num_vertices, vertex_t{1} << 14);
+  EXPECT_EQ(num_edges, size_t{123457});
+  EXPECT_EQ(actual.srcs, expected.srcs);
+  EXPECT_EQ(actual.dsts, expected.dsts);
+
+  host_edgelist_t<int64_t> wrong_type{};
+  EXPECT_THROW(cugraph::host_read_binary_edgelist_file<int64_t>(path, wrong_type.consumer()),
+               cugraph::logic_error);
+
+  std::remove(path.c_str());
+}
+
+TEST_F(HostGeneratorsTest, MatrixMarketFile)
+{
+  using vertex_t = int64_t;
+
+  std::string path = ::testing::TempDir() + "host_generators_test.mtx";
+
+  host_edgelist_t<vertex_t> expected{};
+  {
+    cugraph::host_edgelist_file_writer_t<vertex_t> writer(
+      path, cugraph::host_edgelist_file_format_t::MATRIX_MARKET, 1000);
+    cugraph::host_generate_erdos_renyi_graph_edgelist_gnp<vertex_t>(
+      1000, 0.01, [&](auto srcs, auto dsts, auto n) {
+        expected.consumer()(srcs, dsts, n);
+        writer.append(srcs, dsts, n);
+      });
+    // the destructor patches the edge count
+  }
+
+  std::ifstream file(path);
+  std::string banner{};
+  std::getline(file, banner);
+  EXPECT_EQ(banner, "%%MatrixMarket matrix coordinate pattern general");
+
+  size_t rows{}, cols{}, nnz{};
+  file >> rows >> cols >> nnz;
+  EXPECT_EQ(rows, size_t{1000});
+  EXPECT_EQ(cols, size_t{1000});
+  ASSERT_EQ(nnz, expected.srcs.size());
+
+  for (size_t i = 0; i < nnz; ++i) {
+    vertex_t src{}, dst{};
+    file >> src >> dst;
+    ASSERT_EQ(src - 1, expected.srcs[i]);
+    ASSERT_EQ(dst - 1, expected.dsts[i]);
+  }
+
+  std::remove(path.c_str());
+}
+
+TEST_F(HostGeneratorsTest, InvalidInput)
+{
+  using vertex_t = int32_t;
+
+  host_edgelist_t<vertex_t> edges{};
+  EXPECT_THROW(cugraph::host_generate_rmat_edgelist<vertex_t>(32, 10, edges.consumer()),
+               cugraph::logic_error);
+  EXPECT_THROW(cugraph::host_generate_rmat_edgelist<vertex_t>(
+                 10, 10, edges.consumer(), 0.57, 0.19, 0.19, 0.5),
+               cugraph::logic_error);
+  EXPECT_THROW(
+    cugraph::host_generate_erdos_renyi_graph_edgelist_gnp<vertex_t>(10, 1.5, edges.consumer()),
+    cugraph::logic_error);
+
+  std::string path = ::testing::TempDir() + "host_generators_invalid.bin";
+  cugraph::host_edgelist_file_writer_t<vertex_t> writer(
+    path, cugraph::host_edgelist_file_format_t::BINARY, 10);
+  vertex_t src{3};
+  vertex_t dst{10};
+  EXPECT_THROW(writer.append(&src, &dst, 1), cugraph::logic_error);
+  writer.close();
+  std::remove(path.c_str());
+}
+
+CUGRAPH_TEST_PROGRAM_MAIN()
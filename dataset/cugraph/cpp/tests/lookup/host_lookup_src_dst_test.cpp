@@ -0,0 +1,313 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utilities/base_fixture.hpp"
+
+#include <cugraph/graph.hpp>
+#include <cugraph/host_src_dst_lookup_container.hpp>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/high_res_timer.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <iostream>
+#include <map>
+#include <numeric>
+#include <random>
+#include <tuple>
+#include <vector>
+
+struct HostLookupSrcDstTest : public ::testing::Test {};
+
+namespace {
+
+template <typename vertex_t, typename edge_t>
+struct typed_edgelist_t {
+  std::vector<vertex_t> srcs{};
+  std::vector<vertex_t> dsts{};
+  std::vector<edge_t> edge_ids{};
+  std::vector<int32_t> edge_types{};
+};
+
+// type 0 has consecutive ids, type 1 ids spread over the whole edge_t range and type 2 clustered
+// ids; edges are shuffled
+template <typename vertex_t, typename edge_t>
+typed_edgelist_t<vertex_t, edge_t> generate_typed_edgelist(size_t num_edges, uint64_t seed)
+{
+  std::mt19937_64 rng(seed);
+  typed_edgelist_t<vertex_t, edge_t> edgelist{};
+  std::map<std::tuple<int32_t, edge_t>, bool> used{};
+  while (edgelist.edge_ids.size() < num_edges) {
+    auto i    = edgelist.edge_ids.size();
+    auto type = static_cast<int32_t>(i % 3);
+    edge_t id{};
+    if (type == 0) {
+      id = static_cast<edge_t>(i / 3) - 5;
+    } else if (type == 1) {
+      id = static_cast<edge_t>(rng());
+    } else {
+      id = static_cast<edge_t>((rng() % 64) * 100000 + rng() % 5000);
+    }
+    if (used[std::make_tuple(type, id)]) { continue; }
+    used[std::make_tuple(type, id)] = true;
+    edgelist.srcs.push_back(static_cast<vertex_t>(rng() % 100000));
+    edgelist.dsts.push_back(static_cast<vertex_t>(rng() % 100000));
+    edgelist.edge_ids.push_back(id);
+    edgelist.edge_types.push_back(type);
+  }
+
+  std::vector<size_t> order(num_edges);
+  std::iota(order.begin(), order.end(), size_t{0});
+  std::shuffle(order.begin(), order.end(), rng);
+  auto shuffled = edgelist;
+  for (size_t i = 0; i < num_edges; ++i) {
+    shuffled.srcs[i]       = edgelist.srcs[order[i]];
+    shuffled.dsts[i]       = edgelist.dsts[order[i]];
+    shuffled.edge_ids[i]   = edgelist.edge_ids[order[i]];
+    shuffled.edge_types[i] = edgelist.edge_types[order[i]];
+  }
+  return shuffled;
+}
+
+template <typename vertex_t, typename edge_t>
+void check_lookup(typed_edgelist_t<vertex_t, edge_t> const& edgelist,
+                  bool use_edge_types,
+                  size_t num_threads)
+{
+  auto n         = edgelist.edge_ids.size();
+  auto container = cugraph::build_edge_id_and_type_to_src_dst_lookup_map<vertex_t, edge_t, int32_t>(
+    raft::host_span<vertex_t const>(edgelist.srcs.data(), n),
+    raft::host_span<vertex_t const>(edgelist.dsts.data(), n),
+    raft::host_span<edge_t const>(edgelist.edge_ids.data(), n),
+    use_edge_types
+      ? std::make_optional(raft::host_span<int32_t const>(edgelist.edge_types.data(), n))
+      : std::nullopt,
+    num_threads);
+  ASSERT_EQ(container.number_of_edges(), n);
+
+  std::map<std::tuple<int32_t, edge_t>, std::tuple<vertex_t, vertex_t>> reference{};
+  for (size_t i = 0; i < n; ++i) {
+    reference[std::make_tuple(use_edge_types ? edgelist.edge_types[i] : 0, edgelist.edge_ids[i])] =
+      std::make_tuple(edgelist.srcs[i], edgelist.dsts[i]);
+  }
+
+  // every edge, plus ids next to them (mostly absent) and an unknown type
+  std::vector<edge_t> ids{};
+  std::vector<int32_t> types{};
+  for (size_t i = 0; i < n; ++i) {
+    auto type = use_edge_types ? edgelist.edge_types[i] : 0;
+    for (edge_t delta : {0, 1, -1}) {
+      ids.push_back(edgelist.edge_ids[i] + delta);
+      types.push_back(type);
+    }
+    if (i % 10 == 0) {
+      ids.push_back(edgelist.edge_ids[i]);
+      types.push_back(7);
+    }
+  }
+
+  auto [srcs, dsts] = cugraph::lookup_endpoints_from_edge_ids_and_types(
+    container,
+    raft::host_span<edge_t const>(ids.data(), ids.size()),
+    raft::host_span<int32_t const>(types.data(), types.size()),
+    num_threads);
+  for (size_t i = 0; i < ids.size(); ++i) {
+    auto it = reference.find(std::make_tuple(types[i], ids[i]));
+    if (it != reference.end()) {
+      ASSERT_EQ(std::make_tuple(srcs[i], dsts[i]), it->second) << "edge id " << ids[i];
+    } else {
+      ASSERT_EQ(srcs[i], cugraph::invalid_vertex_id<vertex_t>::value) << "edge id " << ids[i];
+      ASSERT_EQ(dsts[i], cugraph::invalid_vertex_id<vertex_t>::value) << "edge id " << ids[i];
+    }
+  }
+
+  for (int32_t type : {0, 1, 2, 7}) {
+    std::vector<edge_t> type_ids{};
+    for (size_t i = 0; i < ids.size(); ++i) {
+      if (types[i] == type) { type_ids.push_back(ids[i]); }
+    }
+    auto [type_srcs, type_dsts] = cugraph::lookup_endpoints_from_edge_ids_and_single_type(
+      container,
+      raft::host_span<edge_t const>(type_ids.data(), type_ids.size()),
+      type,
+      num_threads);
+    for (size_t i = 0; i < type_ids.size(); ++i) {
+      auto it = reference.find(std::make_tuple(type, type_ids[i]));
+      auto expected =
+        it != reference.end()
+          ? it->second
+          : std::make_tuple(cugraph::invalid_vertex_id<vertex_t>::value,
+                            cugraph::invalid_vertex_id<vertex_t>::value);
+      ASSERT_EQ(std::make_tuple(type_srcs[i], type_dsts[i]), expected) << "edge id " << type_ids[i];
+    }
+  }
+}
+
+}  // namespace
+
+TEST_F(HostLookupSrcDstTest, Lookup)
+{
+  auto edgelist32 = generate_typed_edgelist<int32_t, int32_t>(300000, 1);
+  check_lookup(edgelist32, true, 1);
+  check_lookup(edgelist32, true, 4);
+
+  auto edgelist64 = generate_typed_edgelist<int64_t, int64_t>(300000, 2);
+  check_lookup(edgelist64, true, 4);
+
+  // without edge types, ids have to be unique across the whole edge list
+  typed_edgelist_t<int64_t, int64_t> untyped{};
+  std::mt19937_64 rng(3);
+  for (int64_t i = 0; i < 200000; ++i) {
+    untyped.srcs.push_back(static_cast<int64_t>(rng() % 1000));
+    untyped.dsts.push_back(static_cast<int64_t>(rng() % 1000));
+    untyped.edge_ids.push_back(i * 3 + static_cast<int64_t>(rng() % 3));
+  }
+  check_lookup(untyped, false, 4);  // already sorted by id
+  std::reverse(untyped.edge_ids.begin(), untyped.edge_ids.end());
+  check_lookup(untyped, false, 4);
+}
+
+TEST_F(HostLookupSrcDstTest, InvalidInput)
+{
+  std::vector<int32_t> srcs{0, 1, 2};
+  std::vector<int32_t> dsts{1, 2, 0};
+  std::vector<int32_t> edge_ids{4, 5, 4};
+  std::vector<int32_t> edge_types{0, 0, 1};
+
+  auto build = [&](std::optional<std::vector<int32_t>> const& types, size_t num_edges) {
+    return cugraph::build_edge_id_and_type_to_src_dst_lookup_map<int32_t, int32_t, int32_t>(
+      raft::host_span<int32_t const>(srcs.data(), srcs.size()),
+      raft::host_span<int32_t const>(dsts.data(), dsts.size()),
+      raft::host_span<int32_t const>(edge_ids.data(), num_edges),
+      types ? std::make_optional(raft::host_span<int32_t const>(types->data(), types->size()))
+            : std::nullopt);
+  };
+
+  EXPECT_NO_THROW(build(edge_types, 3));
+  EXPECT_THROW(build(std::nullopt, 3), cugraph::logic_error);
+  EXPECT_THROW(build(edge_types, 2), cugraph::logic_error);
+
+  auto container = build(edge_types, 3);
+  std::vector<int32_t> out(2);
+  EXPECT_THROW(container.lookup_from_edge_ids_and_single_type(
+                 raft::host_span<int32_t const>(edge_ids.data(), edge_ids.size()),
+                 0,
+                 raft::host_span<int32_t>(out.data(), out.size()),
+                 raft::host_span<int32_t>(out.data(), out.size())),
+               cugraph::logic_error);
+
+  cugraph::host_lookup_container_t<int32_t, int32_t, int32_t> empty{};
+  auto [empty_srcs, empty_dsts] = cugraph::lookup_endpoints_from_edge_ids_and_single_type(
+    empty, raft::host_span<int32_t const>(edge_ids.data(), edge_ids.size()), 0);
+  EXPECT_EQ(empty_srcs, std::vector<int32_t>(3, cugraph::invalid_vertex_id<int32_t>::value));
+}
+
+TEST_F(HostLookupSrcDstTest, IndexSize)
+{
+  size_t num_edges{1000000};
+  std::vector<int64_t> srcs(num_edges, 0);
+  std::vector<int64_t> dsts(num_edges, 0);
+  std::vector<int64_t> edge_ids(num_edges);
+
+  // consecutive ids need no index
+  std::iota(edge_ids.begin(), edge_ids.end(), int64_t{0});
+  auto consecutive =
+    cugraph::build_edge_id_and_type_to_src_dst_lookup_map<int64_t, int64_t, int32_t>(
+      raft::host_span<int64_t const>(srcs.data(), num_edges),
+      raft::host_span<int64_t const>(dsts.data(), num_edges),
+      raft::host_span<int64_t const>(edge_ids.data(), num_edges),
+      std::nullopt);
+  EXPECT_LT(consecutive.size_in_bytes(), num_edges * 2 * sizeof(int64_t) + 1024);
+
+  // ids sampled from a range 16x the number of edges take about 2 + log2(16) bits each
+  std::mt19937_64 rng(4);
+  for (size_t i = 0; i < num_edges; ++i) {
+    edge_ids[i] = static_cast<int64_t>(i * 16 + rng() % 16);
+  }
+  auto sparse = cugraph::build_edge_id_and_type_to_src_dst_lookup_map<int64_t, int64_t, int32_t>(
+    raft::host_span<int64_t const>(srcs.data(), num_edges),
+    raft::host_span<int64_t const>(dsts.data(), num_edges),
+    raft::host_span<int64_t const>(edge_ids.data(), num_edges),
+    std::nullopt);
+  auto index_bytes = sparse.size_in_bytes() - num_edges * 2 * sizeof(int64_t);
+  EXPECT_LT(index_bytes, (num_edges * 65) / 64);
+}
+
+// Lookup throughput. --perf --rmat_scale=26 --rmat_edge_factor=16 times 1B edges.
+TEST_F(HostLookupSrcDstTest, Throughput)
+{
+  using vertex_t = int64_t;
+  using edge_t   = int64_t;
+
+  size_t scale       = cugraph::test::g_rmat_scale.value_or(16);
+  size_t edge_factor = cugraph::test::g_rmat_edge_factor.value_or(16);
+  size_t num_edges   = edge_factor << scale;
+  int32_t num_types{4};
+
+  std::mt19937_64 rng(5);
+  std::vector<vertex_t> srcs(num_edges);
+  std::vector<vertex_t> dsts(num_edges);
+  std::vector<edge_t> edge_ids(num_edges);
+  std::vector<int32_t> edge_types(num_edges);
+  for (size_t i = 0; i < num_edges; ++i) {
+    srcs[i]       = static_cast<vertex_t>(rng() >> (64 - scale));
+    dsts[i]       = static_cast<vertex_t>(rng() >> (64 - scale));
+    edge_types[i] = static_cast<int32_t>(i % num_types);
+    edge_ids[i]   = static_cast<edge_t>(i / num_types) * 2;  // every other id of a type is used
+  }
+
+  std::vector<edge_t> query_ids(std::min(num_edges, size_t{1} << 24));
+  std::vector<int32_t> query_types(query_ids.size());
+  for (size_t i = 0; i < query_ids.size(); ++i) {
+    auto edge      = rng() % num_edges;
+    query_ids[i]   = edge_ids[edge];
+    query_types[i] = edge_types[edge];
+  }
+
+  HighResTimer hr_timer{};
+  if (cugraph::test::g_perf) { hr_timer.start("Build host lookup map"); }
+
+  auto container = cugraph::build_edge_id_and_type_to_src_dst_lookup_map<vertex_t, edge_t, int32_t>(
+    raft::host_span<vertex_t const>(srcs.data(), num_edges),
+    raft::host_span<vertex_t const>(dsts.data(), num_edges),
+    raft::host_span<edge_t const>(edge_ids.data(), num_edges),
+    std::make_optional(raft::host_span<int32_t const>(edge_types.data(), num_edges)));
+
+  if (cugraph::test::g_perf) {
+    hr_timer.stop();
+    hr_timer.start("Lookup " + std::to_string(query_ids.size()) + " edges");
+  }
+
+  auto [result_srcs, result_dsts] = cugraph::lookup_endpoints_from_edge_ids_and_types(
+    container,
+    raft::host_span<edge_t const>(query_ids.data(), query_ids.size()),
+    raft::host_span<int32_t const>(query_types.data(), query_types.size()));
+
+  if (cugraph::test::g_perf) {
+    hr_timer.stop();
+    hr_timer.display_and_clear(std::cout);
+    std::cout << num_edges << " edges, " << container.size_in_bytes() << " bytes" << std::endl;
+  }
+
+  for (size_t i = 0; i < query_ids.size(); ++i) {
+    auto edge = static_cast<size_t>(query_ids[i] / 2) * num_types + query_types[i];
+    ASSERT_EQ(result_srcs[i], srcs[edge]);
+    ASSERT_EQ(result_dsts[i], dsts[edge]);
+  }
+}
+
+CUGRAPH_TEST_PROGRAM_MAIN()
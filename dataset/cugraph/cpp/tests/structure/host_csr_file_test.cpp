@@ -0,0 +1,331 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utilities/base_fixture.hpp"
+
+#include <cugraph/host_csr_file.hpp>
+#include <cugraph/host_graph_generators.hpp>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/high_res_timer.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <numeric>
+#include <random>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+struct HostCsrFileTest : public ::testing::Test {};
+
+namespace {
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+struct host_csr_t {
+  std::vector<edge_t> offsets{};
+  std::vector<vertex_t> indices{};
+  std::vector<weight_t> weights{};
+  std::vector<edge_t> edge_ids{};
+  std::vector<int32_t> edge_types{};
+  std::vector<vertex_t> renumber_map{};
+};
+
+// CSR of random edges with unsorted adjacency lists, multi-edges and per-edge columns
+template <typename vertex_t, typename edge_t, typename weight_t>
+host_csr_t<vertex_t, edge_t, weight_t> random_csr(vertex_t num_vertices,
+                                                  size_t num_edges,
+                                                  uint64_t seed)
+{
+  std::mt19937_64 rng(seed);
+  std::vector<vertex_t> srcs(num_edges);
+  std::vector<vertex_t> dsts(num_edges);
+  for (size_t i = 0; i < num_edges; ++i) {
+    // skewed sources give a mix of empty, short and long adjacency lists
+    srcs[i] = static_cast<vertex_t>((rng() % num_vertices) * (rng() % num_vertices) / num_vertices);
+    dsts[i] = static_cast<vertex_t>(rng() % num_vertices);
+  }
+
+  host_csr_t<vertex_t, edge_t, weight_t> csr{};
+  csr.offsets.assign(num_vertices + 1, edge_t{0});
+  for (auto src : srcs) {
+    ++csr.offsets[src + 1];
+  }
+  std::partial_sum(csr.offsets.begin(), csr.offsets.end(), csr.offsets.begin());
+  std::vector<edge_t> positions(csr.offsets.begin(), csr.offsets.end() - 1);
+  csr.indices.resize(num_edges);
+  csr.weights.resize(num_edges);
+  csr.edge_ids.resize(num_edges);
+  csr.edge_types.resize(num_edges);
+  for (size_t i = 0; i < num_edges; ++i) {
+    auto e            = positions[srcs[i]]++;
+    csr.indices[e]    = dsts[i];
+    csr.weights[e]    = static_cast<weight_t>(rng() % 1000) / 8;
+    csr.edge_ids[e]   = static_cast<edge_t>(i);
+    csr.edge_types[e] = static_cast<int32_t>(rng() % 5);
+  }
+
+  csr.renumber_map.resize(num_vertices);
+  std::iota(csr.renumber_map.begin(), csr.renumber_map.end(), vertex_t{0});
+  std::shuffle(csr.renumber_map.begin(), csr.renumber_map.end(), rng);
+  for (auto& v : csr.renumber_map) {
+    v = v * 3 + 7;
+  }
+  return csr;
+}
+
+template <typename vertex_t, typename edge_t, typename weight_t>
+void write_csr(std::string const& path,
+               host_csr_t<vertex_t, edge_t, weight_t> const& csr,
+               bool with_columns,
+               size_t num_threads)
+{
+  using cugraph::write_host_csr_file;
+  auto span = [](auto const& v) {
+    using value_t = typename std::decay_t<decltype(v)>::value_type;
+    return raft::host_span<value_t const>(v.data(), v.size());
+  };
+  write_host_csr_file<vertex_t, edge_t, weight_t>(
+    path,
+    span(csr.offsets),
+    span(csr.indices),
+    with_columns ? std::make_optional(span(csr.weights)) : std::nullopt,
+    with_columns ? std::make_optional(span(csr.edge_ids)) : std::nullopt,
+    with_columns ? std::make_optional(span(csr.edge_types)) : std::nullopt,
+    with_columns ? std::make_optional(span(csr.renumber_map)) : std::nullopt,
+    false,
+    num_threads);
+}
+
+std::vector<char> read_bytes(std::string const& path)
+{
+  std::ifstream file(path, std::ios::binary);
+  return std::vector<char>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+}  // namespace
+
+TEST_F(HostCsrFileTest, RoundTrip)
+{
+  using vertex_t = int32_t;
+  using edge_t   = int32_t;
+  using weight_t = float;
+
+  std::string path = ::testing::TempDir() + "host_csr_file_test.csr";
+  auto csr         = random_csr<vertex_t, edge_t, weight_t>(5000, 200000, 1);
+
+  write_csr(path, csr, true, 1);
+  auto single_threaded = read_bytes(path);
+  write_csr(path, csr, true, 8);
+  EXPECT_EQ(read_bytes(path), single_threaded);
+
+  cugraph::host_csr_file_t<vertex_t, edge_t, weight_t> file(path);
+  ASSERT_EQ(file.number_of_vertices(), vertex_t{5000});
+  ASSERT_EQ(file.number_of_edges(), edge_t{200000});
+  EXPECT_FALSE(file.is_symmetric());
+  EXPECT_TRUE(std::equal(file.offsets().begin(), file.offsets().end(), csr.offsets.begin()));
+  ASSERT_TRUE(file.renumber_map().has_value());
+  EXPECT_TRUE(
+    std::equal(file.renumber_map()->begin(), file.renumber_map()->end(), csr.renumber_map.begin()));
+
+  // each adjacency list is sorted, carrying the columns of its edges along
+  auto indices    = file.decode_indices(4);
+  auto weights    = *file.weights();
+  auto edge_ids   = *file.edge_ids();
+  auto edge_types = *file.edge_types();
+  for (vertex_t v = 0; v < file.number_of_vertices(); ++v) {
+    using edge_tuple_t = std::tuple<vertex_t, weight_t, edge_t, int32_t>;
+    std::vector<edge_tuple_t> expected{};
+    std::vector<edge_tuple_t> actual{};
+    for (auto e = csr.offsets[v]; e < csr.offsets[v + 1]; ++e) {
+      expected.emplace_back(csr.indices[e], csr.weights[e], csr.edge_ids[e], csr.edge_types[e]);
+      actual.emplace_back(indices[e], weights[e], edge_ids[e], edge_types[e]);
+    }
+    ASSERT_TRUE(
+      std::is_sorted(indices.begin() + csr.offsets[v], indices.begin() + csr.offsets[v + 1]));
+    std::stable_sort(expected.begin(), expected.end(), [](auto const& lhs, auto const& rhs) {
+      return std::get<0>(lhs) < std::get<0>(rhs);
+    });
+    ASSERT_EQ(actual, expected);
+  }
+
+  std::remove(path.c_str());
+}
+
+TEST_F(HostCsrFileTest, DecodeVertexRanges)
+{
+  using vertex_t = int64_t;
+  using edge_t   = int64_t;
+  using weight_t = double;
+
+  std::string path = ::testing::TempDir() + "host_csr_file_ranges.csr";
+  auto csr         = random_csr<vertex_t, edge_t, weight_t>(1000, 30000, 2);
+  write_csr(path, csr, false, 3);
+
+  cugraph::host_csr_file_t<vertex_t, edge_t, weight_t> file(path);
+  EXPECT_FALSE(file.weights().has_value());
+  EXPECT_FALSE(file.edge_ids().has_value());
+  EXPECT_FALSE(file.edge_types().has_value());
+  EXPECT_FALSE(file.renumber_map().has_value());
+
+  auto indices = file.decode_indices(1);
+  std::mt19937 rng(3);
+  for (int trial = 0; trial < 200; ++trial) {
+    vertex_t first = rng() % 1001;
+    vertex_t last  = first + rng() % (1001 - first);
+    std::vector<vertex_t> partition(csr.offsets[last] - csr.offsets[first]);
+    file.decode_indices(first, last, raft::host_span<vertex_t>(partition.data(), partition.size()));
+    ASSERT_TRUE(
+      std::equal(partition.begin(), partition.end(), indices.begin() + csr.offsets[first]));
+  }
+
+  std::remove(path.c_str());
+}
+
+TEST_F(HostCsrFileTest, InvalidFiles)
+{
+  using vertex_t = int32_t;
+  using edge_t   = int32_t;
+  using weight_t = float;
+
+  std::string path = ::testing::TempDir() + "host_csr_file_invalid.csr";
+  auto csr         = random_csr<vertex_t, edge_t, weight_t>(300, 5000, 4);
+  write_csr(path, csr, true, 2);
+
+  auto header = cugraph::read_host_csr_file_header(path);
+  EXPECT_EQ(header.vertex_size, sizeof(vertex_t));
+  EXPECT_EQ(header.weight_size, sizeof(weight_t));
+  EXPECT_EQ(header.number_of_edges, uint64_t{5000});
+
+  using wrong_file_t = cugraph::host_csr_file_t<int64_t, int64_t, float>;
+  EXPECT_THROW(wrong_file_t{path}, cugraph::logic_error);
+
+  auto bytes       = read_bytes(path);
+  auto write_bytes = [&](std::vector<char> const& contents) {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(contents.data(), contents.size());
+  };
+  using file_t = cugraph::host_csr_file_t<vertex_t, edge_t, weight_t>;
+
+  write_bytes(std::vector<char>(bytes.begin(), bytes.end() - 8));
+  EXPECT_THROW(file_t{path}, cugraph::logic_error);
+
+  // a corrupt varint stream must be reported, not decoded out of bounds
+  auto corrupt = bytes;
+  std::fill(corrupt.begin() + header.adjacency_offset,
+            corrupt.begin() + header.adjacency_offset + header.adjacency_size,
+            static_cast<char>(0xff));
+  write_bytes(corrupt);
+  {
+    file_t file(path);
+    EXPECT_THROW(file.decode_indices(1), cugraph::logic_error);
+  }
+
+  std::remove(path.c_str());
+}
+
+// An R-mat graph loaded from a MatrixMarket file (parse and build the CSR) and from a CSR file
+// (map and decode): the same graph in less than half the size. With --perf, a larger graph (unless
+// --rmat_scale is given) and the load times.
+TEST_F(HostCsrFileTest, CompareWithMatrixMarket)
+{
+  using vertex_t = int32_t;
+  using edge_t   = int32_t;
+  using weight_t = float;
+
+  size_t scale = cugraph::test::g_rmat_scale.value_or(cugraph::test::g_perf ? 18 : 10);
+  size_t num_edges{size_t{16} << scale};
+  vertex_t num_vertices{vertex_t{1} << scale};
+  std::string mtx_path = ::testing::TempDir() + "host_csr_file_rmat.mtx";
+  std::string csr_path = ::testing::TempDir() + "host_csr_file_rmat.csr";
+
+  {
+    cugraph::host_edgelist_file_writer_t<vertex_t> writer(
+      mtx_path, cugraph::host_edgelist_file_format_t::MATRIX_MARKET, num_vertices);
+    cugraph::host_generate_rmat_edgelist<vertex_t>(
+      scale, num_edges, [&](auto srcs, auto dsts, auto n) { writer.append(srcs, dsts, n); });
+    writer.close();
+  }
+
+  HighResTimer hr_timer{};
+  if (cugraph::test::g_perf) { hr_timer.start("MatrixMarket load"); }
+  host_csr_t<vertex_t, edge_t, weight_t> csr{};
+  {
+    std::FILE* file = std::fopen(mtx_path.c_str(), "r");
+    ASSERT_NE(file, nullptr);
+    char line[256];
+    ASSERT_NE(std::fgets(line, sizeof(line), file), nullptr);
+    long rows{}, cols{}, nnz{};
+    ASSERT_EQ(std::fscanf(file, "%ld %ld %ld", &rows, &cols, &nnz), 3);
+    std::vector<vertex_t> srcs(nnz);
+    std::vector<vertex_t> dsts(nnz);
+    for (long i = 0; i < nnz; ++i) {
+      ASSERT_EQ(std::fscanf(file, "%d %d", &srcs[i], &dsts[i]), 2);
+    }
+    std::fclose(file);
+
+    csr.offsets.assign(rows + 1, edge_t{0});
+    for (auto src : srcs) {
+      ++csr.offsets[src];
+    }
+    std::partial_sum(csr.offsets.begin(), csr.offsets.end(), csr.offsets.begin());
+    std::vector<edge_t> positions(csr.offsets.begin(), csr.offsets.end() - 1);
+    csr.indices.resize(nnz);
+    for (long i = 0; i < nnz; ++i) {
+      csr.indices[positions[srcs[i] - 1]++] = dsts[i] - 1;
+    }
+  }
+  if (cugraph::test::g_perf) { hr_timer.stop(); }
+
+  write_csr(csr_path, csr, false, 0);
+
+  if (cugraph::test::g_perf) { hr_timer.start("CSR file load"); }
+  std::vector<edge_t> offsets{};
+  std::vector<vertex_t> indices{};
+  {
+    cugraph::host_csr_file_t<vertex_t, edge_t, weight_t> file(csr_path);
+    offsets.assign(file.offsets().begin(), file.offsets().end());
+    indices = file.decode_indices(0);
+  }
+  if (cugraph::test::g_perf) { hr_timer.stop(); }
+
+  // The CSR file sorts each adjacency list
+  ASSERT_EQ(offsets, csr.offsets);
+  ASSERT_EQ(indices.size(), num_edges);
+  for (vertex_t v = 0; v < num_vertices; ++v) {
+    std::sort(csr.indices.begin() + csr.offsets[v], csr.indices.begin() + csr.offsets[v + 1]);
+  }
+  ASSERT_EQ(indices, csr.indices);
+
+  auto mtx_size = read_bytes(mtx_path).size();
+  auto csr_size = read_bytes(csr_path).size();
+  if (cugraph::test::g_perf) {
+    hr_timer.display_and_clear(std::cout);
+    std::cout << "R-mat scale " << scale << ", " << num_edges << " edges: MatrixMarket "
+              << mtx_size / 1e6 << " MB, CSR file " << csr_size / 1e6 << " MB" << std::endl;
+  }
+  EXPECT_LT(csr_size, mtx_size / 2);
+
+  std::remove(mtx_path.c_str());
+  std::remove(csr_path.c_str());
+}
+
+CUGRAPH_TEST_PROGRAM_MAIN()
@@ -0,0 +1,336 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utilities/base_fixture.hpp"
+#include "utilities/host_csv_file_utilities.hpp"
+
+#include <cugraph/host_graph_generators.hpp>
+#include <cugraph/utilities/error.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+struct HostCsvFileTest : public ::testing::Test {};
+
+namespace {
+
+std::string write_file(std::string const& name, std::string const& contents)
+{
+  auto path = ::testing::TempDir() + name;
+  std::ofstream file(path, std::ios::binary);
+  file << contents;
+  return path;
+}
+
+struct random_edgelist_t {
+  std::vector<int32_t> srcs{};
+  std::vector<int32_t> dsts{};
+  std::vector<double> weights{};
+  std::vector<int32_t> edge_ids{};
+  std::vector<int32_t> edge_types{};
+};
+
+// "src,dst,weight,edge_id,edge_type" lines with mixed separators, comments and blank lines
+std::tuple<random_edgelist_t, std::string> random_csv(size_t num_edges, uint64_t seed)
+{
+  std::mt19937_64 rng(seed);
+  random_edgelist_t edgelist{};
+  std::ostringstream csv{};
+  csv.precision(17);
+  char const* separators[] = {",", " ", "\t", ", ", "  "};
+  for (size_t i = 0; i < num_edges; ++i) {
+    edgelist.srcs.push_back(static_cast<int32_t>(rng() % 1000000) - 1000);
+    edgelist.dsts.push_back(static_cast<int32_t>(rng() % 1000000));
+    edgelist.weights.push_back(static_cast<double>(rng() % 100000) / 1000.0 - 3.0);
+    edgelist.edge_ids.push_back(static_cast<int32_t>(i * 3));
+    edgelist.edge_types.push_back(static_cast<int32_t>(rng() % 5));
+    auto sep = separators[rng() % 5];
+    if (rng() % 97 == 0) { csv << "# comment, 1 2 3\n"; }
+    if (rng() % 89 == 0) { csv << "\n"; }
+    csv << edgelist.srcs.back() << sep << edgelist.dsts.back() << sep << edgelist.weights.back()
+        << sep << edgelist.edge_ids.back() << sep << edgelist.edge_types.back()
+        << (rng() % 7 == 0 ? "\r\n" : "\n");
+  }
+  return std::make_tuple(std::move(edgelist), csv.str());
+}
+
+}  // namespace
+
+TEST_F(HostCsvFileTest, DetectFormat)
+{
+  using cugraph::test::detect_host_csv_edgelist_format;
+
+  auto format = detect_host_csv_edgelist_format(write_file("csv_2.csv", "0 1\n1 2\n"));
+  EXPECT_FALSE(format.has_header);
+  EXPECT_EQ(format.num_columns, size_t{2});
+  EXPECT_FALSE(format.weight_column);
+
+  // the third column is the weight even if it holds integers
+  format = detect_host_csv_edgelist_format(write_file("csv_3.csv", "% comment\n0,1,1\n1,2,1\n"));
+  EXPECT_EQ(format.num_columns, size_t{3});
+  EXPECT_EQ(format.weight_column, std::optional<size_t>{2});
+
+  format = detect_host_csv_edgelist_format(
+    write_file("csv_4.csv", "0 1 0 1.5\n1 2 1 2\n2 0 1 0.25\n"));
+  EXPECT_EQ(format.num_columns, size_t{4});
+  EXPECT_EQ(format.weight_column, std::optional<size_t>{3});
+  EXPECT_EQ(format.edge_type_column, std::optional<size_t>{2});
+  EXPECT_FALSE(format.edge_id_column);
+
+  format = detect_host_csv_edgelist_format(
+    write_file("csv_5.csv", "0\t1\t0.5\t10\t0\n1\t2\t1.5\t11\t0\n2\t0\t2.5\t12\t1\n"));
+  EXPECT_EQ(format.weight_column, std::optional<size_t>{2});
+  EXPECT_EQ(format.edge_id_column, std::optional<size_t>{3});
+  EXPECT_EQ(format.edge_type_column, std::optional<size_t>{4});
+
+  format = detect_host_csv_edgelist_format(
+    write_file("csv_header.csv", "src,dst,Type,label,WEIGHT\n0,1,0,7,1\n1,2,1,7,2\n"));
+  EXPECT_TRUE(format.has_header);
+  EXPECT_EQ(format.num_columns, size_t{5});
+  EXPECT_EQ(format.weight_column, std::optional<size_t>{4});
+  EXPECT_EQ(format.edge_type_column, std::optional<size_t>{2});
+  EXPECT_FALSE(format.edge_id_column);
+
+  EXPECT_THROW(detect_host_csv_edgelist_format(write_file("csv_ragged.csv", "0 1\n1 2 3\n")),
+               cugraph::logic_error);
+  EXPECT_THROW(detect_host_csv_edgelist_format(::testing::TempDir() + "csv_missing.csv"),
+               cugraph::logic_error);
+}
+
+TEST_F(HostCsvFileTest, ReadColumns)
+{
+  auto path = write_file("csv_small.csv",
+                         "# src dst weight\n"
+                         "src, dst, edge_type, weight\n"
+                         "0, 1, 3, 1.5\r\n"
+                         "\n"
+                         "  -2,\t4 , 0,-2.5e-1\n"
+                         "% comment\n"
+                         "7 2147483647 1 1e300\n"
+                         "1,0,2,.5");
+  auto edgelist =
+    cugraph::test::read_host_edgelist_from_csv_file<int32_t, double, int32_t, int32_t>(path);
+  EXPECT_EQ(edgelist.srcs, (std::vector<int32_t>{0, -2, 7, 1}));
+  EXPECT_EQ(edgelist.dsts, (std::vector<int32_t>{1, 4, 2147483647, 0}));
+  ASSERT_TRUE(edgelist.weights);
+  EXPECT_EQ(*edgelist.weights, (std::vector<double>{1.5, -0.25, 1e300, 0.5}));
+  EXPECT_FALSE(edgelist.edge_ids);
+  ASSERT_TRUE(edgelist.edge_types);
+  EXPECT_EQ(*edgelist.edge_types, (std::vector<int32_t>{3, 0, 1, 2}));
+
+  // an explicit layout overrides the detected one
+  cugraph::test::host_csv_edgelist_format_t format{};
+  format.has_header     = true;
+  format.num_columns    = 4;
+  format.edge_id_column = 2;
+  auto ids =
+    cugraph::test::read_host_edgelist_from_csv_file<int64_t, float, int64_t, int32_t>(path, format);
+  EXPECT_FALSE(ids.weights);
+  EXPECT_FALSE(ids.edge_types);
+  ASSERT_TRUE(ids.edge_ids);
+  EXPECT_EQ(*ids.edge_ids, (std::vector<int64_t>{3, 0, 1, 2}));
+
+  auto empty = cugraph::test::read_host_edgelist_from_csv_file<int32_t, float, int32_t, int32_t>(
+    write_file("csv_empty.csv", ""));
+  EXPECT_TRUE(empty.srcs.empty());
+}
+
+TEST_F(HostCsvFileTest, ChunksAndThreads)
+{
+  auto [expected, contents] = random_csv(20000, 7);
+  auto path                 = write_file("csv_random.csv", contents);
+
+  auto format = cugraph::test::detect_host_csv_edgelist_format(path);
+  ASSERT_EQ(format.num_columns, size_t{5});
+  ASSERT_EQ(format.weight_column, std::optional<size_t>{2});
+  ASSERT_EQ(format.edge_id_column, std::optional<size_t>{3});
+  ASSERT_EQ(format.edge_type_column, std::optional<size_t>{4});
+
+  for (size_t bytes_per_chunk : {size_t{1}, size_t{100}, size_t{4096}, size_t{1} << 24}) {
+    for (size_t num_threads : {size_t{1}, size_t{3}}) {
+      cugraph::test::host_csv_reader_options_t options{num_threads, bytes_per_chunk};
+      auto edgelist =
+        cugraph::test::read_host_edgelist_from_csv_file<int32_t, double, int32_t, int32_t>(
+          path, std::nullopt, options);
+      ASSERT_EQ(edgelist.srcs, expected.srcs);
+      ASSERT_EQ(edgelist.dsts, expected.dsts);
+      ASSERT_EQ(*edgelist.weights, expected.weights);
+      ASSERT_EQ(*edgelist.edge_ids, expected.edge_ids);
+      ASSERT_EQ(*edgelist.edge_types, expected.edge_types);
+
+      // edge ids are unique, so the edges streamed in any order can be put back in file order
+      std::vector<size_t> seen(expected.srcs.size(), 0);
+      std::mutex mutex{};
+      auto num_edges =
+        cugraph::test::read_host_edgelist_from_csv_file<int32_t, double, int32_t, int32_t>(
+          path,
+          [&](size_t thread_id, auto srcs, auto dsts, auto weights, auto edge_ids, auto types) {
+            ASSERT_LT(thread_id, num_threads);
+            ASSERT_TRUE(weights && edge_ids && types);
+            std::lock_guard<std::mutex> lock(mutex);
+            for (size_t i = 0; i < srcs.size(); ++i) {
+              auto e = static_cast<size_t>((*edge_ids)[i] / 3);
+              ASSERT_LT(e, expected.srcs.size());
+              ++seen[e];
+              ASSERT_EQ(srcs[i], expected.srcs[e]);
+              ASSERT_EQ(dsts[i], expected.dsts[e]);
+              ASSERT_EQ((*weights)[i], expected.weights[e]);
+              ASSERT_EQ((*types)[i], expected.edge_types[e]);
+            }
+          },
+          std::nullopt,
+          options);
+      EXPECT_EQ(num_edges, expected.srcs.size());
+      EXPECT_TRUE(std::all_of(seen.begin(), seen.end(), [](auto count) { return count == 1; }));
+    }
+  }
+}
+
+// The fast float path must round exactly like strtod and strtof
+TEST_F(HostCsvFileTest, FloatParsing)
+{
+  std::mt19937_64 rng(11);
+  std::ostringstream csv{};
+  std::vector<std::string> tokens{};
+  for (size_t i = 0; i < 20000; ++i) {
+    std::ostringstream token{};
+    switch (i % 5) {
+      case 0: token << (rng() % 1000000) << '.' << (rng() % 1000000); break;
+      case 1: token << "-." << (rng() % 100000000) << 'e' << static_cast<int>(rng() % 40); break;
+      case 2: token << (rng() % 10) << '.' << (rng() % 10000000000000000000ull) << "E-5"; break;
+      case 3: token << (rng() >> 11) << 'e' << -static_cast<int>(rng() % 30); break;
+      default:
+        token.precision(1 + rng() % 17);
+        token << std::ldexp(static_cast<double>(rng()), -static_cast<int>(rng() % 80));
+    }
+    tokens.push_back(token.str());
+    csv << i << ' ' << i << ' ' << tokens.back() << '\n';
+  }
+  auto path = write_file("csv_floats.csv", csv.str());
+
+  auto doubles =
+    cugraph::test::read_host_edgelist_from_csv_file<int32_t, double, int32_t, int32_t>(path);
+  auto floats =
+    cugraph::test::read_host_edgelist_from_csv_file<int32_t, float, int32_t, int32_t>(path);
+  ASSERT_EQ(doubles.weights->size(), tokens.size());
+  for (size_t i = 0; i < tokens.size(); ++i) {
+    ASSERT_EQ((*doubles.weights)[i], std::strtod(tokens[i].c_str(), nullptr)) << tokens[i];
+    ASSERT_EQ((*floats.weights)[i], std::strtof(tokens[i].c_str(), nullptr)) << tokens[i];
+  }
+}
+
+TEST_F(HostCsvFileTest, InvalidInput)
+{
+  using reader = cugraph::test::host_csv_edgelist_t<int32_t, float, int32_t, int32_t> (*)(
+    std::string const&,
+    std::optional<cugraph::test::host_csv_edgelist_format_t>,
+    cugraph::test::host_csv_reader_options_t const&);
+  reader read = cugraph::test::read_host_edgelist_from_csv_file<int32_t, float, int32_t, int32_t>;
+
+  cugraph::test::host_csv_reader_options_t options{};
+  EXPECT_THROW(read(write_file("csv_bad_vertex.csv", "0 1\n1 x\n"), std::nullopt, options),
+               cugraph::logic_error);
+  EXPECT_THROW(read(write_file("csv_overflow.csv", "0 1\n1 2147483648\n"), std::nullopt, options),
+               cugraph::logic_error);
+  EXPECT_THROW(read(write_file("csv_bad_weight.csv", "0 1 1\n1 2 1.5.2\n"), std::nullopt, options),
+               cugraph::logic_error);
+  EXPECT_THROW(read(write_file("csv_columns.csv", "0 1 1\n1 2\n"), std::nullopt, options),
+               cugraph::logic_error);
+  EXPECT_THROW(read(write_file("csv_columns.csv", "0 1\n1 2 3\n"), std::nullopt, options),
+               cugraph::logic_error);
+
+  // a line past the lines sampled for the layout
+  std::string lines{};
+  for (int i = 0; i < 2000; ++i) {
+    lines += "0 1 0.5\n";
+  }
+  EXPECT_THROW(read(write_file("csv_late.csv", lines + "1 2\n"), std::nullopt, options),
+               cugraph::logic_error);
+  EXPECT_THROW(read(write_file("csv_late.csv", lines + "1 2 3 4\n"), std::nullopt, options),
+               cugraph::logic_error);
+
+  cugraph::test::host_csv_edgelist_format_t format{};
+  format.num_columns   = 2;
+  format.weight_column = 2;
+  EXPECT_THROW(read(write_file("csv_2.csv", "0 1\n"), format, options), cugraph::logic_error);
+}
+
+// Parse rate of an R-mat edge list with weights, on one thread and on all threads; a benchmark,
+// only run with --perf
+TEST_F(HostCsvFileTest, Throughput)
+{
+  using vertex_t = int64_t;
+
+  if (!cugraph::test::g_perf) { return; }
+
+  size_t scale       = cugraph::test::g_rmat_scale.value_or(22);
+  size_t edge_factor = cugraph::test::g_rmat_edge_factor.value_or(16);
+  size_t num_edges   = edge_factor << scale;
+  auto path          = ::testing::TempDir() + "csv_rmat.csv";
+
+  {
+    std::FILE* file = std::fopen(path.c_str(), "w");
+    ASSERT_NE(file, nullptr);
+    size_t edge_id{0};
+    cugraph::host_generate_rmat_edgelist<vertex_t>(
+      scale, num_edges, [&](auto srcs, auto dsts, auto n) {
+        for (size_t i = 0; i < n; ++i, ++edge_id) {
+          std::fprintf(file,
+                       "%lld,%lld,%.6f\n",
+                       static_cast<long long>(srcs[i]),
+                       static_cast<long long>(dsts[i]),
+                       static_cast<double>(edge_id % 1000003) / 1000003.0);
+        }
+      });
+    std::fclose(file);
+  }
+
+  auto now = []() { return std::chrono::steady_clock::now(); };
+  std::ifstream file(path, std::ios::binary | std::ios::ate);
+  auto file_size = static_cast<double>(file.tellg());
+
+  for (size_t num_threads : {size_t{1}, size_t{0}}) {
+    cugraph::test::host_csv_reader_options_t options{num_threads};
+    auto start = now();
+    auto edgelist =
+      cugraph::test::read_host_edgelist_from_csv_file<vertex_t, float, vertex_t, int32_t>(
+        path, std::nullopt, options);
+    auto seconds = std::chrono::duration<double>(now() - start).count();
+    ASSERT_EQ(edgelist.srcs.size(), num_edges);
+    ASSERT_TRUE(edgelist.weights);
+    std::cout << "R-mat scale " << scale << ", " << num_edges << " edges, " << file_size / 1e6
+              << " MB, " << (num_threads == 0 ? std::string("all") : std::to_string(num_threads))
+              << " thread(s): " << seconds << " s, " << file_size / seconds / 1e9 << " GB/s"
+              << std::endl;
+  }
+
+  std::remove(path.c_str());
+}
+
+CUGRAPH_TEST_PROGRAM_MAIN()
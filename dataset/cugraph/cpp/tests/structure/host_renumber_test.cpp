@@ -0,0 +1,327 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utilities/base_fixture.hpp"
+
+#include <cugraph/graph.hpp>
+#include <cugraph/graph_view.hpp>
+#include <cugraph/host_graph_generators.hpp>
+#include <cugraph/host_renumber.hpp>
+#include <cugraph/utilities/error.hpp>
+#include <cugraph/utilities/high_res_timer.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <random>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+struct HostRenumberTest : public ::testing::Test {};
+
+namespace {
+
+// renumber map and segment offsets computed as the single-GPU renumber_edgelist does
+template <typename vertex_t>
+std::tuple<std::vector<vertex_t>, std::vector<vertex_t>> reference_renumber(
+  std::vector<vertex_t> const& vertices, std::vector<vertex_t> const& majors)
+{
+  std::map<vertex_t, size_t> degrees{};
+  for (auto v : vertices) {
+    degrees[v];
+  }
+  for (auto v : majors) {
+    ++degrees[v];
+  }
+  std::vector<std::tuple<size_t, vertex_t>> order{};
+  for (auto [v, degree] : degrees) {
+    order.emplace_back(degree, v);
+  }
+  std::stable_sort(order.begin(), order.end(), [](auto const& lhs, auto const& rhs) {
+    return std::get<0>(lhs) > std::get<0>(rhs);
+  });
+
+  std::vector<vertex_t> labels{};
+  std::vector<vertex_t> segment_offsets{0};
+  for (size_t threshold : {cugraph::detail::mid_degree_threshold,
+                           cugraph::detail::low_degree_threshold,
+                           size_t{1}}) {
+    segment_offsets.push_back(static_cast<vertex_t>(
+      std::count_if(order.begin(), order.end(), [threshold](auto const& e) {
+        return std::get<0>(e) >= threshold;
+      })));
+  }
+  segment_offsets.push_back(static_cast<vertex_t>(order.size()));
+  for (auto const& e : order) {
+    labels.push_back(std::get<1>(e));
+  }
+  return std::make_tuple(labels, segment_offsets);
+}
+
+// renumbers srcs/dsts split into num_chunks chunks
+template <typename vertex_t>
+std::tuple<std::vector<vertex_t>, std::vector<vertex_t>> renumber_in_chunks(
+  std::optional<std::vector<vertex_t>> const& vertices,
+  std::vector<vertex_t>& srcs,
+  std::vector<vertex_t>& dsts,
+  bool store_transposed,
+  size_t num_chunks,
+  size_t num_threads)
+{
+  std::vector<raft::host_span<vertex_t>> src_chunks{};
+  std::vector<raft::host_span<vertex_t>> dst_chunks{};
+  for (size_t i = 0; i < num_chunks; ++i) {
+    auto first = (srcs.size() * i) / num_chunks;
+    auto last  = (srcs.size() * (i + 1)) / num_chunks;
+    src_chunks.emplace_back(srcs.data() + first, last - first);
+    dst_chunks.emplace_back(dsts.data() + first, last - first);
+  }
+  return cugraph::host_renumber_edgelist<vertex_t, vertex_t>(
+    vertices
+      ? std::make_optional(raft::host_span<vertex_t const>(vertices->data(), vertices->size()))
+      : std::nullopt,
+    src_chunks,
+    dst_chunks,
+    store_transposed,
+    num_threads,
+    true);
+}
+
+template <typename vertex_t>
+void check_renumber(std::optional<std::vector<vertex_t>> const& vertices,
+                    std::vector<vertex_t> const& srcs,
+                    std::vector<vertex_t> const& dsts,
+                    bool store_transposed,
+                    size_t num_chunks,
+                    size_t num_threads)
+{
+  auto renumbered_srcs = srcs;
+  auto renumbered_dsts = dsts;
+  auto [labels, segment_offsets] = renumber_in_chunks(
+    vertices, renumbered_srcs, renumbered_dsts, store_transposed, num_chunks, num_threads);
+
+  // without vertices, the minors contribute the vertices with no major edge
+  auto [expected_labels, expected_segment_offsets] =
+    reference_renumber(vertices ? *vertices : (store_transposed ? srcs : dsts),
+                       store_transposed ? dsts : srcs);
+  ASSERT_EQ(labels, expected_labels);
+  ASSERT_EQ(segment_offsets, expected_segment_offsets);
+  for (size_t i = 0; i < srcs.size(); ++i) {
+    ASSERT_EQ(labels[renumbered_srcs[i]], srcs[i]);
+    ASSERT_EQ(labels[renumbered_dsts[i]], dsts[i]);
+  }
+}
+
+}  // namespace
+
+TEST_F(HostRenumberTest, MatchesDeviceSemantics)
+{
+  std::mt19937_64 rng(1);
+
+  // sparse 64-bit ids, including the value the hash map uses to mark empty slots, and a hub that
+  // lands in the high degree segment
+  std::vector<int64_t> ids(3000);
+  for (auto& id : ids) {
+    id = static_cast<int64_t>(rng());
+  }
+  ids[7] = cugraph::invalid_vertex_id<int64_t>::value;
+  std::vector<int64_t> srcs(60000);
+  std::vector<int64_t> dsts(srcs.size());
+  for (size_t i = 0; i < srcs.size(); ++i) {
+    // skewed degrees: ids near the front are picked more often
+    auto skewed = (rng() % ids.size()) * (rng() % ids.size()) / ids.size();
+    srcs[i]     = (i % 20 == 0) ? ids[0] : ids[skewed];
+    dsts[i]     = ids[rng() % ids.size()];
+  }
+
+  for (bool store_transposed : {false, true}) {
+    for (auto [num_chunks, num_threads] : {std::make_tuple(size_t{1}, size_t{1}),
+                                           std::make_tuple(size_t{3}, size_t{4}),
+                                           std::make_tuple(size_t{16}, size_t{0})}) {
+      check_renumber<int64_t>(std::nullopt, srcs, dsts, store_transposed, num_chunks, num_threads);
+    }
+  }
+
+  std::vector<int32_t> srcs32(srcs.size());
+  std::vector<int32_t> dsts32(dsts.size());
+  for (size_t i = 0; i < srcs.size(); ++i) {
+    srcs32[i] = static_cast<int32_t>(srcs[i] >> 33);
+    dsts32[i] = static_cast<int32_t>(dsts[i] >> 33);
+  }
+  check_renumber<int32_t>(std::nullopt, srcs32, dsts32, false, 2, 2);
+}
+
+TEST_F(HostRenumberTest, Vertices)
+{
+  std::vector<int32_t> srcs{10, 10, 20, 30, 40};
+  std::vector<int32_t> dsts{20, 30, 30, 10, 10};
+  std::vector<int32_t> vertices{50, 40, 30, 20, 10, 60};
+
+  check_renumber<int32_t>(vertices, srcs, dsts, false, 1, 1);
+  check_renumber<int32_t>(vertices, srcs, dsts, true, 2, 2);
+
+  auto missing = srcs;
+  missing[2]   = 70;
+  EXPECT_THROW(check_renumber<int32_t>(vertices, missing, dsts, false, 1, 1),
+               cugraph::logic_error);
+
+  auto duplicates = vertices;
+  duplicates.push_back(10);
+  EXPECT_THROW(check_renumber<int32_t>(duplicates, srcs, dsts, false, 1, 1), cugraph::logic_error);
+
+  std::vector<int32_t> no_edges{};
+  check_renumber<int32_t>(vertices, no_edges, no_edges, false, 1, 1);
+  check_renumber<int32_t>(std::nullopt, no_edges, no_edges, false, 1, 1);
+}
+
+TEST_F(HostRenumberTest, StringIds)
+{
+  std::vector<std::string> names{"alice", "bob", "carol", "dave", "erin", "frank"};
+  std::vector<std::tuple<int, int>> edges{{0, 1}, {0, 2}, {1, 2}, {2, 3}, {3, 4}, {4, 5}, {5, 0}};
+
+  std::vector<int64_t> srcs{};
+  std::vector<int64_t> dsts{};
+  for (auto [src, dst] : edges) {
+    srcs.push_back(static_cast<int64_t>(std::hash<std::string>{}(names[src])));
+    dsts.push_back(static_cast<int64_t>(std::hash<std::string>{}(names[dst])));
+  }
+  check_renumber<int64_t>(std::nullopt, srcs, dsts, false, 1, 2);
+}
+
+TEST_F(HostRenumberTest, VertexMap)
+{
+  using vertex_t = int64_t;
+
+  size_t num_vertices{20000};
+  size_t num_threads{8};
+  cugraph::host_vertex_map_t<vertex_t> vertex_map(num_vertices);
+
+  // every thread inserts the same ids in a different order
+  std::vector<vertex_t> ids(num_vertices);
+  std::mt19937_64 rng(2);
+  for (auto& id : ids) {
+    id = static_cast<vertex_t>(rng());
+  }
+  ids[0] = cugraph::invalid_vertex_id<vertex_t>::value;
+
+  std::vector<std::vector<vertex_t>> results(num_threads);
+  std::vector<std::thread> threads{};
+  for (size_t t = 0; t < num_threads; ++t) {
+    threads.emplace_back([&, t]() {
+      std::vector<vertex_t> order(ids);
+      std::shuffle(order.begin(), order.end(), std::mt19937_64(t));
+      std::vector<vertex_t> internal(order.size());
+      vertex_map.insert(raft::host_span<vertex_t const>(order.data(), order.size()),
+                        raft::host_span<vertex_t>(internal.data(), internal.size()));
+      results[t].resize(ids.size());
+      for (size_t i = 0; i < order.size(); ++i) {
+        results[t][std::find(ids.begin(), ids.end(), order[i]) - ids.begin()] = internal[i];
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  ASSERT_EQ(vertex_map.number_of_vertices(), static_cast<vertex_t>(num_vertices));
+  auto renumber_map = vertex_map.renumber_map();
+  for (size_t i = 0; i < ids.size(); ++i) {
+    for (size_t t = 1; t < num_threads; ++t) {
+      ASSERT_EQ(results[t][i], results[0][i]);
+    }
+    ASSERT_EQ(vertex_map.find(ids[i]), results[0][i]);
+    ASSERT_EQ(renumber_map[results[0][i]], ids[i]);
+  }
+  auto sorted = renumber_map;
+  std::sort(sorted.begin(), sorted.end());
+  ASSERT_TRUE(std::adjacent_find(sorted.begin(), sorted.end()) == sorted.end());
+
+  EXPECT_EQ(vertex_map.find(vertex_t{12345}), cugraph::invalid_vertex_id<vertex_t>::value);
+  EXPECT_THROW(vertex_map.insert(vertex_t{12345}), cugraph::logic_error);
+}
+
+// Renumbers a scrambled R-mat edge list. --perf --rmat_scale=26 --rmat_edge_factor=16 times the
+// renumbering of 1B edges.
+TEST_F(HostRenumberTest, Rmat)
+{
+  using vertex_t = int64_t;
+
+  size_t scale       = cugraph::test::g_rmat_scale.value_or(16);
+  size_t edge_factor = cugraph::test::g_rmat_edge_factor.value_or(16);
+  size_t num_edges   = edge_factor << scale;
+
+  std::vector<vertex_t> srcs{};
+  std::vector<vertex_t> dsts{};
+  srcs.reserve(num_edges);
+  dsts.reserve(num_edges);
+  cugraph::host_generate_rmat_edgelist<vertex_t>(
+    scale,
+    num_edges,
+    [&](vertex_t const* chunk_srcs, vertex_t const* chunk_dsts, size_t n) {
+      srcs.insert(srcs.end(), chunk_srcs, chunk_srcs + n);
+      dsts.insert(dsts.end(), chunk_dsts, chunk_dsts + n);
+    },
+    0.57,
+    0.19,
+    0.19,
+    0.0,
+    0,
+    false,
+    true);
+
+  std::optional<std::vector<vertex_t>> original_srcs{};
+  std::optional<std::vector<vertex_t>> original_dsts{};
+  if (!cugraph::test::g_perf) {
+    original_srcs = srcs;
+    original_dsts = dsts;
+  }
+
+  HighResTimer hr_timer{};
+  if (cugraph::test::g_perf) { hr_timer.start("Host renumber"); }
+
+  auto [labels, segment_offsets] = cugraph::host_renumber_edgelist<vertex_t, vertex_t>(
+    std::nullopt,
+    {raft::host_span<vertex_t>(srcs.data(), srcs.size())},
+    {raft::host_span<vertex_t>(dsts.data(), dsts.size())},
+    false);
+
+  if (cugraph::test::g_perf) {
+    hr_timer.stop();
+    hr_timer.display_and_clear(std::cout);
+    std::cout << num_edges << " edges, " << labels.size() << " vertices" << std::endl;
+  }
+
+  ASSERT_EQ(segment_offsets.back(), static_cast<vertex_t>(labels.size()));
+  if (original_srcs) {
+    std::vector<vertex_t> unique_vertices(*original_srcs);
+    unique_vertices.insert(unique_vertices.end(), original_dsts->begin(), original_dsts->end());
+    std::sort(unique_vertices.begin(), unique_vertices.end());
+    unique_vertices.erase(std::unique(unique_vertices.begin(), unique_vertices.end()),
+                          unique_vertices.end());
+    ASSERT_EQ(labels.size(), unique_vertices.size());
+    for (size_t i = 0; i < num_edges; ++i) {
+      ASSERT_EQ(labels[srcs[i]], (*original_srcs)[i]);
+      ASSERT_EQ(labels[dsts[i]], (*original_dsts)[i]);
+    }
+  }
+}
+
+CUGRAPH_TEST_PROGRAM_MAIN()
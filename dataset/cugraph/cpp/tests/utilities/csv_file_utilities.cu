@@ -16,6 +16,7 @@
 
 #include "detail/graph_partition_utils.cuh"
 #include "utilities/csv_file_utilities.hpp"
+#include "utilities/host_csv_file_utilities.hpp"
 
 #include <cugraph/graph_functions.hpp>
 #include <cugraph/utilities/error.hpp>
@@ -30,7 +31,6 @@
 #include <thrust/remove.h>
 
 #include <cstdint>
-#include <fstream>
 
 namespace cugraph {
 namespace test {
@@ -153,75 +153,15 @@ read_edgelist_from_csv_file(raft::handle_t const& handle,
                             bool store_transposed,
                             bool multi_gpu)
 {
-  std::ifstream file(graph_file_full_path);
-  CUGRAPH_EXPECTS(file.is_open(), "File open (%s) failure.", graph_file_full_path.c_str());
-
-  file.seekg(0, file.end);
-  auto length = file.tellg();
-  file.seekg(0, file.beg);
-
-  std::vector<char> buffer(length + 1);
-
-  file.read(buffer.data(), length);
-  CUGRAPH_EXPECTS(file, "File read failure.");
-
-  buffer[length] = '\0';  // null termination
-
-  file.close();
-
-  char const* delimiters = ", \t\n";
-
-  std::vector<vertex_t> h_edgelist_srcs{};
-  std::vector<vertex_t> h_edgelist_dsts{};
-  std::vector<weight_t> h_edgelist_weights{};
-
-  char const* cur = buffer.data();
-  size_t num_tokens_this_line{0};
-  while (cur) {
-    char const* prev = cur;
-    cur              = strpbrk(prev, delimiters);
-    if (cur) {
-      auto token = std::string(prev, cur);
-      if (num_tokens_this_line == 0) {  // source
-        auto src = stoll(token);
-        CUGRAPH_EXPECTS((src >= std::numeric_limits<vertex_t>::lowest()) &&
-                          (src <= std::numeric_limits<vertex_t>::max()),
-                        "vertex_t overflow.");
-        h_edgelist_srcs.push_back(static_cast<vertex_t>(src));
-      } else if (num_tokens_this_line == 1) {  // destination
-        auto dst = stoll(token);
-        CUGRAPH_EXPECTS((dst >= std::numeric_limits<vertex_t>::lowest()) &&
-                          (dst <= std::numeric_limits<vertex_t>::max()),
-                        "vertex_t overflow.");
-        h_edgelist_dsts.push_back(static_cast<vertex_t>(dst));
-      } else if (num_tokens_this_line == 2) {  // weight
-        auto w = stod(token);
-        h_edgelist_weights.push_back(static_cast<weight_t>(w));
-      } else {
-        CUGRAPH_FAIL("Too many tokens in a line.");
-      }
-      ++num_tokens_this_line;
-      auto num_delimiters = std::strspn(cur, delimiters);
-      for (size_t i = 0; i < num_delimiters; ++i) {
-        if (*cur == '\n') { num_tokens_this_line = 0; }
-      }
-      cur += num_delimiters;
-    }
-  }
-
-  CUGRAPH_EXPECTS(h_edgelist_srcs.size() == h_edgelist_dsts.size(),
-                  "Invalid input file contents (# source IDs != # destination IDs).");
-
-  CUGRAPH_EXPECTS(
-    (h_edgelist_weights.size() == 0) || (h_edgelist_srcs.size() == h_edgelist_weights.size()),
-    "Invalid input file contents (# source IDs != # weights).");
-  CUGRAPH_EXPECTS(!test_weighted || (h_edgelist_weights.size() > 0),
+  auto [h_edgelist_srcs, h_edgelist_dsts, h_edgelist_weights, h_edge_ids, h_edge_types] =
+    read_host_edgelist_from_csv_file<vertex_t, weight_t, vertex_t, int32_t>(graph_file_full_path);
+  CUGRAPH_EXPECTS(!test_weighted || h_edgelist_weights,
                   "test_weighted set but weights are not provided.");
 
   rmm::device_uvector<vertex_t> d_edgelist_srcs(h_edgelist_srcs.size(), handle.get_stream());
   rmm::device_uvector<vertex_t> d_edgelist_dsts(h_edgelist_dsts.size(), handle.get_stream());
   auto d_edgelist_weights = test_weighted ? std::make_optional<rmm::device_uvector<weight_t>>(
-                                              h_edgelist_weights.size(), handle.get_stream())
+                                              (*h_edgelist_weights).size(), handle.get_stream())
                                           : std::nullopt;
 
   raft::update_device(
@@ -230,8 +170,8 @@ read_edgelist_from_csv_file(raft::handle_t const& handle,
     d_edgelist_dsts.data(), h_edgelist_dsts.data(), h_edgelist_dsts.size(), handle.get_stream());
   if (d_edgelist_weights) {
     raft::update_device((*d_edgelist_weights).data(),
-                        h_edgelist_weights.data(),
-                        h_edgelist_weights.size(),
+                        (*h_edgelist_weights).data(),
+                        (*h_edgelist_weights).size(),
                         handle.get_stream());
   }
 
@@ -351,6 +291,36 @@ read_edgelist_from_csv_file<int32_t, float>(raft::handle_t const& handle,
                                             bool store_transposed,
                                             bool multi_gpu);
 
+template std::tuple<rmm::device_uvector<int32_t>,
+                    rmm::device_uvector<int32_t>,
+                    std::optional<rmm::device_uvector<double>>,
+                    bool>
+read_edgelist_from_csv_file<int32_t, double>(raft::handle_t const& handle,
+                                             std::string const& graph_file_full_path,
+                                             bool test_weighted,
+                                             bool store_transposed,
+                                             bool multi_gpu);
+
+template std::tuple<rmm::device_uvector<int64_t>,
+                    rmm::device_uvector<int64_t>,
+                    std::optional<rmm::device_uvector<float>>,
+                    bool>
+read_edgelist_from_csv_file<int64_t, float>(raft::handle_t const& handle,
+                                            std::string const& graph_file_full_path,
+                                            bool test_weighted,
+                                            bool store_transposed,
+                                            bool multi_gpu);
+
+template std::tuple<rmm::device_uvector<int64_t>,
+                    rmm::device_uvector<int64_t>,
+                    std::optional<rmm::device_uvector<double>>,
+                    bool>
+read_edgelist_from_csv_file<int64_t, double>(raft::handle_t const& handle,
+                                             std::string const& graph_file_full_path,
+                                             bool test_weighted,
+                                             bool store_transposed,
+                                             bool multi_gpu);
+
 template std::tuple<cugraph::graph_t<int32_t, int32_t, false, false>,
                     std::optional<cugraph::edge_property_t<int32_t, float>>,
                     std::optional<rmm::device_uvector<int32_t>>>
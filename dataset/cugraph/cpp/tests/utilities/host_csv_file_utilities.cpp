@@ -0,0 +1,813 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "utilities/host_csv_file_utilities.hpp"
+
+#include <cugraph/utilities/error.hpp>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <initializer_list>
+#include <limits>
+#include <mutex>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+
+namespace cugraph {
+namespace test {
+namespace detail {
+
+// data lines sampled by detect_host_csv_edgelist_format
+constexpr size_t host_csv_sample_lines{1024};
+
+// longest token handed to strtod when the fast float path does not apply
+constexpr size_t host_csv_max_float_token{64};
+
+enum class host_csv_role_t { SOURCE, DESTINATION, WEIGHT, EDGE_ID, EDGE_TYPE, SKIP };
+
+inline size_t host_csv_num_threads(size_t num_threads)
+{
+  if (num_threads == 0) {
+    num_threads = std::max(size_t{1}, static_cast<size_t>(std::thread::hardware_concurrency()));
+  }
+  return num_threads;
+}
+
+/**
+ * Read-only mapping of a whole file, unmapped on destruction. Empty files are not mapped.
+ */
+class host_csv_mapping_t {
+ public:
+  explicit host_csv_mapping_t(std::string const& path)
+  {
+    auto fd = ::open(path.c_str(), O_RDONLY);
+    CUGRAPH_EXPECTS(fd >= 0, "File open (%s) failure.", path.c_str());
+
+    struct stat status {};
+    if (::fstat(fd, &status) != 0) {
+      ::close(fd);
+      CUGRAPH_FAIL("File stat (%s) failure.", path.c_str());
+    }
+    size_ = static_cast<size_t>(status.st_size);
+    if (size_ > 0) {
+      auto mapping = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+      ::close(fd);
+      CUGRAPH_EXPECTS(mapping != MAP_FAILED, "File map (%s) failure.", path.c_str());
+      ::madvise(mapping, size_, MADV_SEQUENTIAL);
+      data_ = static_cast<char const*>(mapping);
+    } else {
+      ::close(fd);
+    }
+  }
+
+  host_csv_mapping_t(host_csv_mapping_t const&)            = delete;
+  host_csv_mapping_t& operator=(host_csv_mapping_t const&) = delete;
+
+  ~host_csv_mapping_t()
+  {
+    if (data_ != nullptr) { ::munmap(const_cast<char*>(data_), size_); }
+  }
+
+  char const* data() const { return data_; }
+  size_t size() const { return size_; }
+
+ private:
+  char const* data_{nullptr};
+  size_t size_{0};
+};
+
+inline bool host_csv_is_separator(char c)
+{
+  return (c == ',') || (c == ' ') || (c == '\t') || (c == '\r');
+}
+
+inline bool host_csv_is_comment(char c) { return (c == '#') || (c == '%'); }
+
+/**
+ * Bit i of separators (newlines) is set if p[i] is a separator (a line end), for the 64 bytes
+ * starting at p.
+ */
+inline void host_csv_block_masks(char const* p, uint64_t& separators, uint64_t& newlines)
+{
+#if defined(__SSE2__)
+  auto const comma   = _mm_set1_epi8(',');
+  auto const space   = _mm_set1_epi8(' ');
+  auto const tab     = _mm_set1_epi8('\t');
+  auto const cr      = _mm_set1_epi8('\r');
+  auto const newline = _mm_set1_epi8('\n');
+  separators         = 0;
+  newlines           = 0;
+  for (int i = 0; i < 4; ++i) {
+    auto v   = _mm_loadu_si128(reinterpret_cast<__m128i const*>(p + 16 * i));
+    auto sep = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, comma), _mm_cmpeq_epi8(v, space)),
+                            _mm_or_si128(_mm_cmpeq_epi8(v, tab), _mm_cmpeq_epi8(v, cr)));
+    auto nl  = _mm_cmpeq_epi8(v, newline);
+    separators |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(sep))) << (16 * i);
+    newlines |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(nl))) << (16 * i);
+  }
+#else
+  separators = 0;
+  newlines   = 0;
+  for (int i = 0; i < 64; ++i) {
+    separators |= static_cast<uint64_t>(host_csv_is_separator(p[i])) << i;
+    newlines |= static_cast<uint64_t>(p[i] == '\n') << i;
+  }
+#endif
+}
+
+// Number of line ends in [first, last).
+inline size_t host_csv_count_line_ends(char const* first, char const* last)
+{
+  size_t count{0};
+  auto p = first;
+#if defined(__SSE2__)
+  // per-byte counters, summed before they can overflow
+  auto const newline = _mm_set1_epi8('\n');
+  while (last - p >= 16) {
+    auto counters = _mm_setzero_si128();
+    for (int i = 0; (i < 255) && (last - p >= 16); ++i, p += 16) {
+      auto v   = _mm_loadu_si128(reinterpret_cast<__m128i const*>(p));
+      counters = _mm_sub_epi8(counters, _mm_cmpeq_epi8(v, newline));
+    }
+    auto sums = _mm_sad_epu8(counters, _mm_setzero_si128());
+    count += static_cast<size_t>(_mm_cvtsi128_si32(sums)) +
+             static_cast<size_t>(_mm_cvtsi128_si32(_mm_srli_si128(sums, 8)));
+  }
+#endif
+  for (; p < last; ++p) {
+    count += (*p == '\n');
+  }
+  return count;
+}
+
+template <typename T>
+bool host_csv_parse_integer(char const* first, char const* last, T& value)
+{
+  bool negative{false};
+  if ((first < last) && ((*first == '-') || (*first == '+'))) {
+    negative = (*first == '-');
+    ++first;
+  }
+  // 19 digits never overflow uint64_t
+  if ((first == last) || (last - first > 19)) { return false; }
+  uint64_t x{0};
+  for (; first < last; ++first) {
+    auto digit = static_cast<unsigned>(*first - '0');
+    if (digit > 9) { return false; }
+    x = x * 10 + digit;
+  }
+  if (negative) {
+    if constexpr (std::is_signed_v<T>) {
+      if (x > static_cast<uint64_t>(std::numeric_limits<T>::max()) + 1) { return false; }
+      value = static_cast<T>(-static_cast<int64_t>(x - 1) - 1);
+    } else {
+      if (x != 0) { return false; }
+      value = T{0};
+    }
+  } else {
+    if (x > static_cast<uint64_t>(std::numeric_limits<T>::max())) { return false; }
+    value = static_cast<T>(x);
+  }
+  return true;
+}
+
+/**
+ * Values with at most 2^53 (2^24 for float) as significand and a power of ten exactly
+ * representable in the same type are computed with a single correctly rounded multiplication or
+ * division (Clinger's fast path), everything else goes through strtod/strtof.
+ */
+template <typename T>
+bool host_csv_parse_float(char const* first, char const* last, T& value)
+{
+  static_assert(std::is_floating_point_v<T>);
+  constexpr bool is_float = std::is_same_v<T, float>;
+  constexpr uint64_t max_significand{is_float ? (uint64_t{1} << 24) : (uint64_t{1} << 53)};
+  constexpr int max_exponent{is_float ? 10 : 22};
+  static constexpr T powers[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+                                 1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+                                 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+  auto p = first;
+  bool negative{false};
+  if ((p < last) && ((*p == '-') || (*p == '+'))) {
+    negative = (*p == '-');
+    ++p;
+  }
+  uint64_t significand{0};
+  int num_significant_digits{0};
+  int exponent{0};
+  bool any_digit{false};
+  bool exact{true};  // false once significant digits are dropped, left to strtod
+  auto consume = [&](unsigned digit) {
+    any_digit = true;
+    if ((significand == 0) && (digit == 0)) { return; }
+    if (num_significant_digits < 19) {
+      significand = significand * 10 + digit;
+      ++num_significant_digits;
+    } else {
+      exact = false;
+    }
+  };
+  for (; (p < last) && (static_cast<unsigned>(*p - '0') <= 9); ++p) {
+    consume(static_cast<unsigned>(*p - '0'));
+  }
+  if ((p < last) && (*p == '.')) {
+    for (++p; (p < last) && (static_cast<unsigned>(*p - '0') <= 9); ++p) {
+      consume(static_cast<unsigned>(*p - '0'));
+      --exponent;
+    }
+  }
+  if (any_digit && (p < last) && ((*p == 'e') || (*p == 'E'))) {
+    ++p;
+    bool negative_exponent{false};
+    if ((p < last) && ((*p == '-') || (*p == '+'))) {
+      negative_exponent = (*p == '-');
+      ++p;
+    }
+    int e{0};
+    bool any_exponent_digit{false};
+    for (; (p < last) && (static_cast<unsigned>(*p - '0') <= 9); ++p) {
+      any_exponent_digit = true;
+      if (e < 100000) { e = e * 10 + (*p - '0'); }
+    }
+    if (!any_exponent_digit) { any_digit = false; }
+    exponent += negative_exponent ? -e : e;
+  }
+
+  if (any_digit && exact && (p == last) && (significand <= max_significand) &&
+      (exponent >= -max_exponent) && (exponent <= max_exponent)) {
+    auto x = static_cast<T>(significand);
+    x      = exponent < 0 ? x / powers[-exponent] : x * powers[exponent];
+    value  = negative ? -x : x;
+    return true;
+  }
+
+  // slow path: long significands, large exponents, inf and nan
+  auto length = static_cast<size_t>(last - first);
+  if (length >= host_csv_max_float_token) { return false; }
+  char token[host_csv_max_float_token];
+  std::memcpy(token, first, length);
+  token[length] = '\0';
+  char* end{nullptr};
+  if constexpr (is_float) {
+    value = std::strtof(token, &end);
+  } else {
+    value = std::strtod(token, &end);
+  }
+  return (end == token + length) && (length > 0);
+}
+
+inline bool host_csv_is_integer(std::string_view token)
+{
+  int64_t value{};
+  return host_csv_parse_integer(token.data(), token.data() + token.size(), value);
+}
+
+// Splits a line (without its line end) into tokens, collapsing runs of separators.
+inline std::vector<std::string_view> host_csv_split(std::string_view line)
+{
+  std::vector<std::string_view> tokens{};
+  size_t i{0};
+  while (i < line.size()) {
+    while ((i < line.size()) && host_csv_is_separator(line[i])) {
+      ++i;
+    }
+    auto start = i;
+    while ((i < line.size()) && !host_csv_is_separator(line[i])) {
+      ++i;
+    }
+    if (i > start) { tokens.push_back(line.substr(start, i - start)); }
+  }
+  return tokens;
+}
+
+inline host_csv_edgelist_format_t host_csv_detect(char const* data, size_t size)
+{
+  host_csv_edgelist_format_t format{};
+  std::vector<std::string_view> names{};
+  std::vector<std::vector<std::string_view>> samples{};
+
+  size_t pos{0};
+  bool first_line{true};
+  while ((pos < size) && (samples.size() < host_csv_sample_lines)) {
+    auto line_end = static_cast<char const*>(std::memchr(data + pos, '\n', size - pos));
+    auto end      = line_end != nullptr ? static_cast<size_t>(line_end - data) : size;
+    auto tokens   = host_csv_split(std::string_view(data + pos, end - pos));
+    auto next     = std::min(end + 1, size);
+    if (!tokens.empty() && !host_csv_is_comment(tokens[0][0])) {
+      if (first_line && !host_csv_is_integer(tokens[0])) {
+        format.has_header = true;
+        names             = std::move(tokens);
+      } else {
+        samples.push_back(std::move(tokens));
+      }
+      first_line = false;
+    }
+    pos = next;
+  }
+
+  if (format.has_header) {
+    format.num_columns = names.size();
+  } else if (!samples.empty()) {
+    format.num_columns = samples[0].size();
+  } else {
+    return format;
+  }
+  CUGRAPH_EXPECTS(format.num_columns >= 2,
+                  "Invalid input file contents (fewer than 2 columns in a line).");
+  for (auto const& tokens : samples) {
+    CUGRAPH_EXPECTS(tokens.size() == format.num_columns,
+                    "Invalid input file contents (lines with %zu and %zu columns).",
+                    format.num_columns,
+                    tokens.size());
+  }
+
+  if (format.has_header) {
+    auto is_one_of = [](std::string_view name, std::initializer_list<char const*> candidates) {
+      return std::any_of(candidates.begin(), candidates.end(), [name](auto candidate) {
+        auto length = std::strlen(candidate);
+        if (name.size() != length) { return false; }
+        for (size_t i = 0; i < length; ++i) {
+          if (std::tolower(static_cast<unsigned char>(name[i])) != candidate[i]) { return false; }
+        }
+        return true;
+      });
+    };
+    for (size_t c = 2; c < format.num_columns; ++c) {
+      if (!format.weight_column && is_one_of(names[c], {"weight", "wgt", "w"})) {
+        format.weight_column = c;
+      } else if (!format.edge_id_column && is_one_of(names[c], {"edge_id", "eid", "id"})) {
+        format.edge_id_column = c;
+      } else if (!format.edge_type_column && is_one_of(names[c], {"edge_type", "etype", "type"})) {
+        format.edge_type_column = c;
+      }
+    }
+    return format;
+  }
+
+  if (format.num_columns == 3) {
+    format.weight_column = 2;
+    return format;
+  }
+
+  std::vector<bool> is_integer(format.num_columns, true);
+  for (auto const& tokens : samples) {
+    for (size_t c = 2; c < format.num_columns; ++c) {
+      if (is_integer[c] && !host_csv_is_integer(tokens[c])) { is_integer[c] = false; }
+    }
+  }
+  for (size_t c = 2; c < format.num_columns; ++c) {
+    if (!is_integer[c]) {
+      format.weight_column = c;
+      break;
+    }
+  }
+  for (size_t c = 2; c < format.num_columns; ++c) {
+    if (!is_integer[c]) { continue; }
+    std::vector<int64_t> values(samples.size());
+    for (size_t i = 0; i < samples.size(); ++i) {
+      auto token = samples[i][c];
+      host_csv_parse_integer(token.data(), token.data() + token.size(), values[i]);
+    }
+    std::sort(values.begin(), values.end());
+    bool distinct = std::adjacent_find(values.begin(), values.end()) == values.end();
+    if (distinct && !format.edge_id_column) {
+      format.edge_id_column = c;
+    } else if (!distinct && !format.edge_type_column) {
+      format.edge_type_column = c;
+    }
+  }
+  return format;
+}
+
+template <typename vertex_t, typename weight_t, typename edge_t, typename edge_type_t>
+struct host_csv_columns_t {
+  std::vector<vertex_t> srcs{};
+  std::vector<vertex_t> dsts{};
+  std::vector<weight_t> weights{};
+  std::vector<edge_t> edge_ids{};
+  std::vector<edge_type_t> edge_types{};
+
+  void clear()
+  {
+    srcs.clear();
+    dsts.clear();
+    weights.clear();
+    edge_ids.clear();
+    edge_types.clear();
+  }
+};
+
+[[noreturn]] inline void host_csv_invalid_token(char const* first,
+                                                char const* last,
+                                                char const* what)
+{
+  auto token = std::string(first, std::min(last, first + 32));
+  CUGRAPH_FAIL("Invalid input file contents (%s is not a valid %s).", token.c_str(), what);
+}
+
+/**
+ * Parses the lines in [first, last) into columns. last must be a line start (or the end of the
+ * file).
+ */
+template <typename vertex_t, typename weight_t, typename edge_t, typename edge_type_t>
+void host_csv_parse_chunk(char const* first,
+                          char const* last,
+                          std::vector<host_csv_role_t> const& roles,
+                          host_csv_columns_t<vertex_t, weight_t, edge_t, edge_type_t>& columns)
+{
+  auto num_columns = roles.size();
+  auto has_role    = [&](host_csv_role_t role) {
+    return std::find(roles.begin(), roles.end(), role) != roles.end();
+  };
+
+  // every line holds at most one edge, so the columns are sized once and trimmed at the end
+  auto max_edges = host_csv_count_line_ends(first, last) + 1;
+  columns.srcs.resize(max_edges);
+  columns.dsts.resize(max_edges);
+  if (has_role(host_csv_role_t::WEIGHT)) { columns.weights.resize(max_edges); }
+  if (has_role(host_csv_role_t::EDGE_ID)) { columns.edge_ids.resize(max_edges); }
+  if (has_role(host_csv_role_t::EDGE_TYPE)) { columns.edge_types.resize(max_edges); }
+  auto srcs       = columns.srcs.data();
+  auto dsts       = columns.dsts.data();
+  auto weights    = columns.weights.data();
+  auto edge_ids   = columns.edge_ids.data();
+  auto edge_types = columns.edge_types.data();
+
+  size_t num_edges{0};
+  size_t column{0};
+  bool in_comment{false};
+  char const* token_first = first;
+
+  auto on_token = [&](char const* token_last) {
+    if (token_first == token_last) { return; }  // collapsed separators
+    if (column == 0 && host_csv_is_comment(*token_first)) { in_comment = true; }
+    if (in_comment) { return; }
+    CUGRAPH_EXPECTS(column < num_columns,
+                    "Invalid input file contents (line with more than %zu columns).",
+                    num_columns);
+    bool valid{true};
+    switch (roles[column]) {
+      case host_csv_role_t::SOURCE:
+        valid = host_csv_parse_integer(token_first, token_last, srcs[num_edges]);
+        break;
+      case host_csv_role_t::DESTINATION:
+        valid = host_csv_parse_integer(token_first, token_last, dsts[num_edges]);
+        break;
+      case host_csv_role_t::WEIGHT:
+        valid = host_csv_parse_float(token_first, token_last, weights[num_edges]);
+        break;
+      case host_csv_role_t::EDGE_ID:
+        valid = host_csv_parse_integer(token_first, token_last, edge_ids[num_edges]);
+        break;
+      case host_csv_role_t::EDGE_TYPE:
+        valid = host_csv_parse_integer(token_first, token_last, edge_types[num_edges]);
+        break;
+      default: break;
+    }
+    if (!valid) {
+      host_csv_invalid_token(token_first,
+                             token_last,
+                             roles[column] == host_csv_role_t::WEIGHT ? "weight"
+                             : roles[column] == host_csv_role_t::EDGE_ID
+                               ? "edge id"
+                               : (roles[column] == host_csv_role_t::EDGE_TYPE ? "edge type"
+                                                                             : "vertex id"));
+    }
+    ++column;
+  };
+  auto on_line_end = [&]() {
+    CUGRAPH_EXPECTS(in_comment || (column == 0) || (column == num_columns),
+                    "Invalid input file contents (line with %zu of %zu columns).",
+                    column,
+                    num_columns);
+    if (column == num_columns) { ++num_edges; }
+    column     = 0;
+    in_comment = false;
+  };
+
+  for (auto block = first; block < last; block += 64) {
+    uint64_t separators{};
+    uint64_t newlines{};
+    if (last - block >= 64) {
+      host_csv_block_masks(block, separators, newlines);
+    } else {
+      // the last partial block, padded with line ends that terminate an unterminated last line
+      char padded[64];
+      auto length = static_cast<size_t>(last - block);
+      std::memcpy(padded, block, length);
+      std::memset(padded + length, '\n', 64 - length);
+      host_csv_block_masks(padded, separators, newlines);
+      newlines &= (uint64_t{1} << length) | ((uint64_t{1} << length) - 1);
+    }
+    auto structural = separators | newlines;
+    while (structural != 0) {
+      auto i   = __builtin_ctzll(structural);
+      auto pos = block + i;
+      on_token(pos);
+      if ((newlines >> i) & 1) { on_line_end(); }
+      token_first = pos + 1;
+      structural &= structural - 1;
+    }
+  }
+  if (token_first < last) {
+    on_token(last);
+    on_line_end();
+  }
+
+  columns.srcs.resize(num_edges);
+  columns.dsts.resize(num_edges);
+  if (has_role(host_csv_role_t::WEIGHT)) { columns.weights.resize(num_edges); }
+  if (has_role(host_csv_role_t::EDGE_ID)) { columns.edge_ids.resize(num_edges); }
+  if (has_role(host_csv_role_t::EDGE_TYPE)) { columns.edge_types.resize(num_edges); }
+}
+
+// Offset of the first byte after the header line, 0 without a header.
+inline size_t host_csv_data_begin(char const* data, size_t size, bool has_header)
+{
+  size_t pos{0};
+  while (has_header && (pos < size)) {
+    auto line_end = static_cast<char const*>(std::memchr(data + pos, '\n', size - pos));
+    auto end      = line_end != nullptr ? static_cast<size_t>(line_end - data) : size;
+    auto tokens   = host_csv_split(std::string_view(data + pos, end - pos));
+    pos           = std::min(end + 1, size);
+    if (!tokens.empty() && !host_csv_is_comment(tokens[0][0])) { break; }
+  }
+  return pos;
+}
+
+// Start of the first line beginning at or after pos.
+inline size_t host_csv_line_start(char const* data, size_t size, size_t pos)
+{
+  if ((pos == 0) || (pos >= size)) { return std::min(pos, size); }
+  auto line_end = static_cast<char const*>(std::memchr(data + pos - 1, '\n', size - pos + 1));
+  return line_end != nullptr ? static_cast<size_t>(line_end - data) + 1 : size;
+}
+
+/**
+ * Parses the chunks of the file on up to num_threads threads and calls
+ * f(thread_id, chunk, columns) for every chunk with the chunk's edges.
+ */
+template <typename vertex_t, typename weight_t, typename edge_t, typename edge_type_t, typename f_t>
+void host_csv_for_each_chunk(host_csv_mapping_t const& mapping,
+                             host_csv_edgelist_format_t const& format,
+                             host_csv_reader_options_t const& options,
+                             f_t f)
+{
+  CUGRAPH_EXPECTS(format.num_columns >= 2,
+                  "Invalid input arguments: a CSV edge list has at least 2 columns.");
+  std::vector<host_csv_role_t> roles(format.num_columns, host_csv_role_t::SKIP);
+  roles[0]         = host_csv_role_t::SOURCE;
+  roles[1]         = host_csv_role_t::DESTINATION;
+  auto assign_role = [&](std::optional<size_t> column, host_csv_role_t role) {
+    if (!column) { return; }
+    CUGRAPH_EXPECTS((*column >= 2) && (*column < format.num_columns) &&
+                      (roles[*column] == host_csv_role_t::SKIP),
+                    "Invalid input arguments: column %zu can't hold a weight, edge id or type.",
+                    *column);
+    roles[*column] = role;
+  };
+  assign_role(format.weight_column, host_csv_role_t::WEIGHT);
+  assign_role(format.edge_id_column, host_csv_role_t::EDGE_ID);
+  assign_role(format.edge_type_column, host_csv_role_t::EDGE_TYPE);
+
+  auto size            = mapping.size();
+  auto data_begin      = host_csv_data_begin(mapping.data(), size, format.has_header);
+  auto bytes_per_chunk = std::max(options.bytes_per_chunk, size_t{64});
+  auto num_chunks =
+    std::max(size_t{1}, (size - data_begin + bytes_per_chunk - 1) / bytes_per_chunk);
+  auto num_threads = std::min(host_csv_num_threads(options.num_threads), num_chunks);
+
+  std::atomic<size_t> next_chunk{0};
+  std::atomic<bool> abort{false};
+  std::vector<std::exception_ptr> errors(num_threads);
+  auto work = [&](size_t thread_id) {
+    try {
+      host_csv_columns_t<vertex_t, weight_t, edge_t, edge_type_t> columns{};
+      while (!abort.load(std::memory_order_relaxed)) {
+        auto chunk = next_chunk.fetch_add(1, std::memory_order_relaxed);
+        if (chunk >= num_chunks) { break; }
+        auto first =
+          host_csv_line_start(mapping.data(), size, data_begin + chunk * bytes_per_chunk);
+        auto last =
+          host_csv_line_start(mapping.data(), size, data_begin + (chunk + 1) * bytes_per_chunk);
+        columns.clear();
+        if (first < last) {
+          host_csv_parse_chunk(mapping.data() + first, mapping.data() + last, roles, columns);
+        }
+        f(thread_id, chunk, columns);
+      }
+    } catch (...) {
+      errors[thread_id] = std::current_exception();
+      abort             = true;
+    }
+  };
+
+  std::vector<std::thread> threads{};
+  threads.reserve(num_threads - 1);
+  for (size_t t = 1; t < num_threads; ++t) {
+    threads.emplace_back(work, t);
+  }
+  work(size_t{0});
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (auto& error : errors) {
+    if (error) { std::rethrow_exception(error); }
+  }
+}
+
+}  // namespace detail
+
+host_csv_edgelist_format_t detect_host_csv_edgelist_format(std::string const& graph_file_full_path)
+{
+  detail::host_csv_mapping_t mapping(graph_file_full_path);
+  return detail::host_csv_detect(mapping.data(), mapping.size());
+}
+
+template <typename vertex_t, typename weight_t, typename edge_t, typename edge_type_t>
+host_csv_edgelist_t<vertex_t, weight_t, edge_t, edge_type_t> read_host_edgelist_from_csv_file(
+  std::string const& graph_file_full_path,
+  std::optional<host_csv_edgelist_format_t> format,
+  host_csv_reader_options_t const& options)
+{
+  using columns_t = detail::host_csv_columns_t<vertex_t, weight_t, edge_t, edge_type_t>;
+
+  detail::host_csv_mapping_t mapping(graph_file_full_path);
+  if (!format) { format = detail::host_csv_detect(mapping.data(), mapping.size()); }
+
+  std::vector<columns_t> chunks{};
+  std::vector<size_t> chunk_offsets{};
+  {
+    std::mutex mutex{};
+    detail::host_csv_for_each_chunk<vertex_t, weight_t, edge_t, edge_type_t>(
+      mapping, *format, options, [&](size_t, size_t chunk, columns_t& columns) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (chunks.size() <= chunk) { chunks.resize(chunk + 1); }
+        chunks[chunk] = std::move(columns);
+      });
+  }
+
+  chunk_offsets.assign(chunks.size() + 1, size_t{0});
+  for (size_t i = 0; i < chunks.size(); ++i) {
+    chunk_offsets[i + 1] = chunk_offsets[i] + chunks[i].srcs.size();
+  }
+  auto num_edges = chunk_offsets.back();
+
+  host_csv_edgelist_t<vertex_t, weight_t, edge_t, edge_type_t> edgelist{};
+  edgelist.srcs.resize(num_edges);
+  edgelist.dsts.resize(num_edges);
+  if (format->weight_column) { edgelist.weights = std::vector<weight_t>(num_edges); }
+  if (format->edge_id_column) { edgelist.edge_ids = std::vector<edge_t>(num_edges); }
+  if (format->edge_type_column) { edgelist.edge_types = std::vector<edge_type_t>(num_edges); }
+
+  // concatenate in parallel, releasing every chunk once copied
+  std::atomic<size_t> next_chunk{0};
+  auto copy = [&]() {
+    for (auto i = next_chunk.fetch_add(1); i < chunks.size(); i = next_chunk.fetch_add(1)) {
+      auto& columns = chunks[i];
+      auto offset   = chunk_offsets[i];
+      std::copy(columns.srcs.begin(), columns.srcs.end(), edgelist.srcs.begin() + offset);
+      std::copy(columns.dsts.begin(), columns.dsts.end(), edgelist.dsts.begin() + offset);
+      if (edgelist.weights) {
+        std::copy(
+          columns.weights.begin(), columns.weights.end(), edgelist.weights->begin() + offset);
+      }
+      if (edgelist.edge_ids) {
+        std::copy(
+          columns.edge_ids.begin(), columns.edge_ids.end(), edgelist.edge_ids->begin() + offset);
+      }
+      if (edgelist.edge_types) {
+        std::copy(columns.edge_types.begin(),
+                  columns.edge_types.end(),
+                  edgelist.edge_types->begin() + offset);
+      }
+      columns = columns_t{};
+    }
+  };
+  auto num_threads = std::min(detail::host_csv_num_threads(options.num_threads), chunks.size());
+  std::vector<std::thread> threads{};
+  for (size_t t = 1; t < num_threads; ++t) {
+    threads.emplace_back(copy);
+  }
+  copy();
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  return edgelist;
+}
+
+template <typename vertex_t, typename weight_t, typename edge_t, typename edge_type_t>
+size_t read_host_edgelist_from_csv_file(
+  std::string const& graph_file_full_path,
+  host_csv_edgelist_consumer_t<vertex_t, weight_t, edge_t, edge_type_t> const& consumer,
+  std::optional<host_csv_edgelist_format_t> format,
+  host_csv_reader_options_t const& options)
+{
+  using columns_t = detail::host_csv_columns_t<vertex_t, weight_t, edge_t, edge_type_t>;
+
+  detail::host_csv_mapping_t mapping(graph_file_full_path);
+  if (!format) { format = detail::host_csv_detect(mapping.data(), mapping.size()); }
+
+  std::atomic<size_t> num_edges{0};
+  detail::host_csv_for_each_chunk<vertex_t, weight_t, edge_t, edge_type_t>(
+    mapping, *format, options, [&](size_t thread_id, size_t, columns_t& columns) {
+      if (columns.srcs.empty()) { return; }
+      auto n = columns.srcs.size();
+      consumer(thread_id,
+               raft::host_span<vertex_t const>(columns.srcs.data(), n),
+               raft::host_span<vertex_t const>(columns.dsts.data(), n),
+               format->weight_column
+                 ? std::make_optional<raft::host_span<weight_t const>>(columns.weights.data(), n)
+                 : std::nullopt,
+               format->edge_id_column
+                 ? std::make_optional<raft::host_span<edge_t const>>(columns.edge_ids.data(), n)
+                 : std::nullopt,
+               format->edge_type_column ? std::make_optional<raft::host_span<edge_type_t const>>(
+                                            columns.edge_types.data(), n)
+                                        : std::nullopt);
+      num_edges += n;
+    });
+  return num_edges.load();
+}
+
+// explicit instantiations
+
+template host_csv_edgelist_t<int32_t, float, int32_t, int32_t>
+read_host_edgelist_from_csv_file<int32_t, float, int32_t, int32_t>(
+  std::string const& graph_file_full_path,
+  std::optional<host_csv_edgelist_format_t> format,
+  host_csv_reader_options_t const& options);
+
+template host_csv_edgelist_t<int32_t, double, int32_t, int32_t>
+read_host_edgelist_from_csv_file<int32_t, double, int32_t, int32_t>(
+  std::string const& graph_file_full_path,
+  std::optional<host_csv_edgelist_format_t> format,
+  host_csv_reader_options_t const& options);
+
+template host_csv_edgelist_t<int64_t, float, int64_t, int32_t>
+read_host_edgelist_from_csv_file<int64_t, float, int64_t, int32_t>(
+  std::string const& graph_file_full_path,
+  std::optional<host_csv_edgelist_format_t> format,
+  host_csv_reader_options_t const& options);
+
+template host_csv_edgelist_t<int64_t, double, int64_t, int32_t>
+read_host_edgelist_from_csv_file<int64_t, double, int64_t, int32_t>(
+  std::string const& graph_file_full_path,
+  std::optional<host_csv_edgelist_format_t> format,
+  host_csv_reader_options_t const& options);
+
+template size_t read_host_edgelist_from_csv_file<int32_t, float, int32_t, int32_t>(
+  std::string const& graph_file_full_path,
+  host_csv_edgelist_consumer_t<int32_t, float, int32_t, int32_t> const& consumer,
+  std::optional<host_csv_edgelist_format_t> format,
+  host_csv_reader_options_t const& options);
+
+template size_t read_host_edgelist_from_csv_file<int32_t, double, int32_t, int32_t>(
+  std::string const& graph_file_full_path,
+  host_csv_edgelist_consumer_t<int32_t, double, int32_t, int32_t> const& consumer,
+  std::optional<host_csv_edgelist_format_t> format,
+  host_csv_reader_options_t const& options);
+
+template size_t read_host_edgelist_from_csv_file<int64_t, float, int64_t, int32_t>(
+  std::string const& graph_file_full_path,
+  host_csv_edgelist_consumer_t<int64_t, float, int64_t, int32_t> const& consumer,
+  std::optional<host_csv_edgelist_format_t> format,
+  host_csv_reader_options_t const& options);
+
+template size_t read_host_edgelist_from_csv_file<int64_t, double, int64_t, int32_t>(
+  std::string const& graph_file_full_path,
+  host_csv_edgelist_consumer_t<int64_t, double, int64_t, int32_t> const& consumer,
+  std::optional<host_csv_edgelist_format_t> format,
+  host_csv_reader_options_t const& options);
+
+}  // namespace test
+}  // namespace cugraph
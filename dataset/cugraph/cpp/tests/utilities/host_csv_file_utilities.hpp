@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <raft/core/host_span.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+#include <vector>
+
+/**
+ * Parallel host reader for CSV edge lists.
+ *
+ * The file is memory mapped and split into chunks at line boundaries. Chunks are parsed on a pool
+ * of host threads: separators (',', ' ', '\t', '\r') and line ends are located 64 bytes at a time
+ * with SIMD compares, integers are parsed digit by digit without copies and floating point values
+ * take an exact fast path before falling back to strtod. As in read_edgelist_from_csv_file, runs
+ * of separators are treated as one. Lines starting with '#' or '%' are skipped.
+ */
+
+namespace cugraph {
+namespace test {
+
+/**
+ * @brief Column layout of a CSV edge list.
+ *
+ * Sources and destinations are always the first two columns. Columns without a role are skipped.
+ */
+struct host_csv_edgelist_format_t {
+  bool has_header{false};  ///< First non-comment line holds column names
+  size_t num_columns{2};
+  std::optional<size_t> weight_column{std::nullopt};
+  std::optional<size_t> edge_id_column{std::nullopt};
+  std::optional<size_t> edge_type_column{std::nullopt};
+};
+
+/**
+ * @brief Parallelism controls for the host CSV reader.
+ */
+struct host_csv_reader_options_t {
+  size_t num_threads{0};                    ///< Worker threads, 0 for the hardware concurrency
+  size_t bytes_per_chunk{size_t{1} << 24};  ///< Approximate number of file bytes per chunk
+};
+
+/**
+ * @brief Detect the column layout of a CSV edge list from its first lines.
+ *
+ * A first line whose leading token is not a number is a header. Header names select the column
+ * roles ("weight", "wgt" or "w"; "edge_id", "eid" or "id"; "edge_type", "etype" or "type", case
+ * insensitive). Without a header the roles are inferred from the first 1024 data lines: a third
+ * column of a three column file is the weight (as in read_edgelist_from_csv_file), otherwise the
+ * first column holding a non-integer value is the weight, the first integer column whose sampled
+ * values are distinct is the edge id and the first integer column with repeated values is the
+ * edge type.
+ *
+ * @param graph_file_full_path Path of the CSV file.
+ * @return Detected layout.
+ */
+host_csv_edgelist_format_t detect_host_csv_edgelist_format(std::string const& graph_file_full_path);
+
+/**
+ * @brief Edge list read from a CSV file into host memory.
+ */
+template <typename vertex_t, typename weight_t, typename edge_t, typename edge_type_t>
+struct host_csv_edgelist_t {
+  std::vector<vertex_t> srcs{};
+  std::vector<vertex_t> dsts{};
+  std::optional<std::vector<weight_t>> weights{std::nullopt};
+  std::optional<std::vector<edge_t>> edge_ids{std::nullopt};
+  std::optional<std::vector<edge_type_t>> edge_types{std::nullopt};
+};
+
+/**
+ * @brief Receives the edges of one parsed chunk.
+ *
+ * Called concurrently from the reader threads, chunks arrive in no particular order. thread_id is
+ * in [0, number of reader threads) and no two concurrent calls share a thread_id, so per-thread
+ * sinks (e.g. one cugraph::mtmg::per_thread_edgelist_t per thread, whose append takes the spans
+ * in this order) need no locking. The spans are only valid for the duration of the call.
+ */
+template <typename vertex_t, typename weight_t, typename edge_t, typename edge_type_t>
+using host_csv_edgelist_consumer_t =
+  std::function<void(size_t thread_id,
+                     raft::host_span<vertex_t const> srcs,
+                     raft::host_span<vertex_t const> dsts,
+                     std::optional<raft::host_span<weight_t const>> weights,
+                     std::optional<raft::host_span<edge_t const>> edge_ids,
+                     std::optional<raft::host_span<edge_type_t const>> edge_types)>;
+
+/**
+ * @brief Read a CSV edge list into host arrays.
+ *
+ * Edges are returned in file order.
+ *
+ * @param graph_file_full_path Path of the CSV file.
+ * @param format Column layout, detected with detect_host_csv_edgelist_format if std::nullopt.
+ * @param options Parallelism controls.
+ * @return Edge list with the columns present in @p format.
+ */
+template <typename vertex_t, typename weight_t, typename edge_t, typename edge_type_t>
+host_csv_edgelist_t<vertex_t, weight_t, edge_t, edge_type_t> read_host_edgelist_from_csv_file(
+  std::string const& graph_file_full_path,
+  std::optional<host_csv_edgelist_format_t> format = std::nullopt,
+  host_csv_reader_options_t const& options         = host_csv_reader_options_t{});
+
+/**
+ * @brief Stream a CSV edge list, chunk by chunk, to a consumer.
+ *
+ * Only a chunk per thread is held in memory.
+ *
+ * @param graph_file_full_path Path of the CSV file.
+ * @param consumer Receives the parsed chunks.
+ * @param format Column layout, detected with detect_host_csv_edgelist_format if std::nullopt.
+ * @param options Parallelism controls.
+ * @return size_t Number of edges delivered to @p consumer.
+ */
+template <typename vertex_t, typename weight_t, typename edge_t, typename edge_type_t>
+size_t read_host_edgelist_from_csv_file(
+  std::string const& graph_file_full_path,
+  host_csv_edgelist_consumer_t<vertex_t, weight_t, edge_t, edge_type_t> const& consumer,
+  std::optional<host_csv_edgelist_format_t> format = std::nullopt,
+  host_csv_reader_options_t const& options         = host_csv_reader_options_t{});
+
+}  // namespace test
+}  // namespace cugraph
@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <common/benchmark.hpp>
+
+#include <raft/core/host_bitset.hpp>
+#include <raft/core/host_csr_matrix.hpp>
+
+#include <chrono>
+#include <random>
+#include <sstream>
+#include <vector>
+
+namespace raft::bench::core {
+
+enum class host_bitset_op {
+  /** bitwise_and of two bitsets. */
+  kAnd,
+  /** bitwise_or of two bitsets. */
+  kOr,
+  /** bitwise_andnot of two bitsets. */
+  kAndNot,
+  /** The same `and` of two `std::vector<bool>`, for reference. */
+  kVectorBoolAnd,
+  /** count() of a bitset. */
+  kCount,
+  /** Random rank queries. */
+  kRank,
+  /** Random select queries. */
+  kSelect,
+  /** Conversion of a bitset to a single-row CSR matrix. */
+  kToCsr,
+};
+
+struct host_bitset_inputs {
+  int64_t n_bits;
+  /** The fraction of the set bits. */
+  double density;
+  host_bitset_op op;
+};
+
+inline auto operator<<(std::ostream& os, const host_bitset_inputs& p) -> std::ostream&
+{
+  const char* ops[] = {"and", "or", "andnot", "vector-bool-and", "count", "rank", "select", "csr"};
+  os << p.n_bits << "#" << p.density << "#" << ops[static_cast<int>(p.op)];
+  return os;
+}
+
+/**
+ * The set operations, the counts, the rank/select queries and the CSR conversion of the host
+ * bitset. The set operations report the bytes of the two input bitsets processed per second; the
+ * rank and select queries report the queries per second.
+ */
+template <typename bitset_t, typename index_t>
+struct host_bitset_bench : public fixture {
+  static constexpr int64_t kNQueries = 1 << 20;
+
+  explicit host_bitset_bench(const host_bitset_inputs& p)
+    : params_(p),
+      a_(handle, index_t(p.n_bits), false),
+      b_(handle, index_t(p.n_bits), false),
+      a_ref_(p.n_bits),
+      b_ref_(p.n_bits)
+  {
+    std::mt19937_64 rng(42);
+    std::bernoulli_distribution dist(p.density);
+    for (int64_t i = 0; i < p.n_bits; i++) {
+      a_ref_[i] = dist(rng);
+      b_ref_[i] = dist(rng);
+      a_.view().set(index_t(i), a_ref_[i]);
+      b_.view().set(index_t(i), b_ref_[i]);
+    }
+    auto n_set = std::max<index_t>(1, a_.view().count());
+    std::uniform_int_distribution<int64_t> rank_dist(0, p.n_bits);
+    std::uniform_int_distribution<int64_t> select_dist(0, int64_t(n_set) - 1);
+    queries_.resize(kNQueries);
+    for (auto& q : queries_) {
+      q = index_t(p.op == host_bitset_op::kSelect ? select_dist(rng) : rank_dist(rng));
+    }
+  }
+
+  void run_benchmark(::benchmark::State& state) override
+  {
+    std::ostringstream label_stream;
+    label_stream << params_;
+    state.SetLabel(label_stream.str());
+
+    raft::core::host_bitset_rank_select<bitset_t, index_t> rank_select(a_.view());
+    auto csr = raft::make_host_csr_matrix<float, int64_t, int64_t, int64_t>(
+      handle, int64_t(1), int64_t(params_.n_bits));
+    index_t sink = 0;
+    for (auto _ : state) {
+      auto start = std::chrono::high_resolution_clock::now();
+      switch (params_.op) {
+        case host_bitset_op::kAnd: a_.view().bitwise_and(b_.view()); break;
+        case host_bitset_op::kOr: a_.view().bitwise_or(b_.view()); break;
+        case host_bitset_op::kAndNot: a_.view().bitwise_andnot(b_.view()); break;
+        case host_bitset_op::kVectorBoolAnd:
+          for (int64_t i = 0; i < params_.n_bits; i++) {
+            a_ref_[i] = a_ref_[i] && b_ref_[i];
+          }
+          break;
+        case host_bitset_op::kCount: sink += a_.view().count(); break;
+        case host_bitset_op::kRank:
+          for (auto q : queries_) {
+            sink += rank_select.rank(q);
+          }
+          break;
+        case host_bitset_op::kSelect:
+          for (auto q : queries_) {
+            sink += rank_select.select(q);
+          }
+          break;
+        case host_bitset_op::kToCsr: a_.view().to_csr(handle, csr); break;
+      }
+      auto end = std::chrono::high_resolution_clock::now();
+      state.SetIterationTime(std::chrono::duration<double>(end - start).count());
+    }
+    ::benchmark::DoNotOptimize(sink);
+
+    switch (params_.op) {
+      case host_bitset_op::kRank:
+      case host_bitset_op::kSelect:
+        state.SetItemsProcessed(state.iterations() * kNQueries);
+        break;
+      default:
+        state.SetBytesProcessed(state.iterations() * 2 * a_.n_elements() * sizeof(bitset_t));
+        break;
+    }
+  }
+
+ private:
+  host_bitset_inputs params_;
+  raft::core::host_bitset<bitset_t, index_t> a_;
+  raft::core::host_bitset<bitset_t, index_t> b_;
+  std::vector<bool> a_ref_;
+  std::vector<bool> b_ref_;
+  std::vector<index_t> queries_;
+};
+
+const std::vector<host_bitset_inputs> kHostBitsetInputs = [] {
+  std::vector<host_bitset_inputs> inputs;
+  for (auto op : {host_bitset_op::kAnd,
+                  host_bitset_op::kOr,
+                  host_bitset_op::kAndNot,
+                  host_bitset_op::kVectorBoolAnd,
+                  host_bitset_op::kCount,
+                  host_bitset_op::kRank,
+                  host_bitset_op::kSelect,
+                  host_bitset_op::kToCsr}) {
+    for (int64_t n_bits : {int64_t(1) << 20, int64_t(1) << 28}) {
+      inputs.push_back({n_bits, 0.5, op});
+    }
+  }
+  return inputs;
+}();
+
+RAFT_BENCH_REGISTER((host_bitset_bench<uint32_t, int64_t>), "", kHostBitsetInputs);
+RAFT_BENCH_REGISTER((host_bitset_bench<uint64_t, int64_t>), "", kHostBitsetInputs);
+
+}  // namespace raft::bench::core
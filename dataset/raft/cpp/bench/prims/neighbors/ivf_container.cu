@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <common/benchmark.hpp>
+
+#include <raft/core/device_mdarray.hpp>
+#include <raft/core/host_mdarray.hpp>
+#include <raft/core/resource/cuda_stream.hpp>
+#include <raft/neighbors/ivf_flat.cuh>
+#include <raft/neighbors/ivf_flat_host.hpp>
+#include <raft/neighbors/ivf_flat_host_serialize.hpp>
+#include <raft/neighbors/ivf_flat_serialize.cuh>
+#include <raft/random/rng.cuh>
+#include <raft/util/cudart_utils.hpp>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+namespace raft::bench::neighbors {
+
+enum class container_load_mode {
+  /** Read the stream written by `ivf_flat::serialize`. */
+  kStream,
+  /** Read the lists of the index container with one thread. */
+  kContainerSerial,
+  /** Read the lists of the index container in parallel. */
+  kContainerParallel,
+  /** Map the lists of the index container into memory. */
+  kContainerMmap,
+};
+
+struct ivf_container_inputs {
+  int64_t n_samples;
+  int64_t dim;
+  uint32_t n_lists;
+  int64_t n_queries;
+  uint32_t n_probes;
+  container_load_mode mode;
+};
+
+inline auto operator<<(std::ostream& os, const ivf_container_inputs& p) -> std::ostream&
+{
+  const char* modes[] = {"stream", "container-serial", "container-parallel", "container-mmap"};
+  os << p.n_samples << "#" << p.dim << "#" << p.n_lists << "#" << p.n_queries << "#"
+     << p.n_probes << "#" << modes[static_cast<int>(p.mode)];
+  return os;
+}
+
+/**
+ * Loading a host IVF-Flat index from the stream of `ivf_flat::serialize` compared to the index
+ * container of `ivf_flat::serialize_host`. The iteration time is the load time from a cold page
+ * cache. The memory counters are the growth of the resident set size after loading the index and
+ * after searching it, which shows that a mapped index only loads the probed lists.
+ */
+template <typename T, typename IdxT>
+struct ivf_container : public fixture {
+  explicit ivf_container(const ivf_container_inputs& p)
+    : params_(p),
+      queries_(make_host_matrix<T, IdxT>(p.n_queries, p.dim)),
+      neighbors_(make_host_matrix<IdxT, IdxT>(p.n_queries, 10)),
+      distances_(make_host_matrix<float, IdxT>(p.n_queries, 10))
+  {
+    auto dataset   = make_device_matrix<T, IdxT>(handle, p.n_samples, p.dim);
+    auto d_queries = make_device_matrix<T, IdxT>(handle, p.n_queries, p.dim);
+    raft::random::RngState state{42};
+    raft::random::uniform(handle, state, dataset.data_handle(), dataset.size(), T(-1), T(1));
+    raft::random::uniform(handle, state, d_queries.data_handle(), d_queries.size(), T(-1), T(1));
+    raft::copy(queries_.data_handle(), d_queries.data_handle(), d_queries.size(), stream);
+    resource::sync_stream(handle, stream);
+
+    raft::neighbors::ivf_flat::index_params index_params;
+    index_params.n_lists = p.n_lists;
+    index_params.metric  = raft::distance::DistanceType::L2Expanded;
+    auto index           = raft::neighbors::ivf_flat::build(
+      handle, index_params, raft::make_const_mdspan(dataset.view()));
+
+    filename_ = std::filesystem::temp_directory_path() /
+                ("raft_ivf_container_bench_" + std::to_string(::getpid()) + ".bin");
+    raft::neighbors::ivf_flat::serialize(handle, filename_, index);
+    if (p.mode != container_load_mode::kStream) {
+      auto host_index = raft::neighbors::ivf_flat::deserialize_host<T, IdxT>(handle, filename_);
+      raft::neighbors::ivf_flat::serialize_host(handle, filename_, host_index);
+    }
+  }
+
+  ~ivf_container() { std::filesystem::remove(filename_); }
+
+  void run_benchmark(::benchmark::State& state) override
+  {
+    std::ostringstream label_stream;
+    label_stream << params_;
+    state.SetLabel(label_stream.str());
+
+    double load_rss   = 0;
+    double search_rss = 0;
+    for (auto _ : state) {
+      drop_page_cache();
+      auto rss0  = resident_bytes();
+      auto start = std::chrono::high_resolution_clock::now();
+      auto index = load();
+      auto end   = std::chrono::high_resolution_clock::now();
+      state.SetIterationTime(std::chrono::duration<double>(end - start).count());
+      load_rss = resident_bytes() - rss0;
+
+      raft::neighbors::ivf_flat::host_search_params search_params;
+      search_params.n_probes = params_.n_probes;
+      raft::neighbors::ivf_flat::search(handle,
+                                        search_params,
+                                        index,
+                                        raft::make_const_mdspan(queries_.view()),
+                                        neighbors_.view(),
+                                        distances_.view());
+      search_rss = resident_bytes() - rss0;
+    }
+    state.counters["FileMB"]         = std::filesystem::file_size(filename_) / double(1 << 20);
+    state.counters["LoadRssMB"]      = load_rss / double(1 << 20);
+    state.counters["SearchRssMB"]    = search_rss / double(1 << 20);
+    state.counters["ProbedFraction"] = double(params_.n_probes) / double(params_.n_lists);
+  }
+
+ private:
+  auto load() -> raft::neighbors::ivf_flat::host_index<T, IdxT>
+  {
+    raft::neighbors::ivf::container_load_params load_params;
+    switch (params_.mode) {
+      case container_load_mode::kStream: break;
+      case container_load_mode::kContainerSerial: load_params.num_threads = 1; break;
+      case container_load_mode::kContainerParallel: break;
+      case container_load_mode::kContainerMmap: load_params.mmap_lists = true; break;
+    }
+    return raft::neighbors::ivf_flat::deserialize_host<T, IdxT>(handle, filename_, load_params);
+  }
+
+  /** Evict the index file from the page cache, so that loading it reads the disk. */
+  void drop_page_cache() const
+  {
+    int fd = ::open(filename_.c_str(), O_RDONLY);
+    if (fd < 0) { return; }
+    ::fdatasync(fd);
+    ::posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+    ::close(fd);
+  }
+
+  static auto resident_bytes() -> double
+  {
+    std::ifstream statm("/proc/self/statm");
+    size_t total_pages    = 0;
+    size_t resident_pages = 0;
+    statm >> total_pages >> resident_pages;
+    return double(resident_pages) * double(::sysconf(_SC_PAGESIZE));
+  }
+
+  ivf_container_inputs params_;
+  std::string filename_;
+  host_matrix<T, IdxT> queries_;
+  host_matrix<IdxT, IdxT> neighbors_;
+  host_matrix<float, IdxT> distances_;
+};
+
+const std::vector<ivf_container_inputs> kIvfContainerInputs = [] {
+  std::vector<ivf_container_inputs> inputs;
+  for (auto mode : {container_load_mode::kStream,
+                    container_load_mode::kContainerSerial,
+                    container_load_mode::kContainerParallel,
+                    container_load_mode::kContainerMmap}) {
+    for (uint32_t n_probes : {10, 100}) {
+      inputs.push_back({2000000, 128, 4096, 100, n_probes, mode});
+    }
+  }
+  return inputs;
+}();
+
+RAFT_BENCH_REGISTER((ivf_container<float, int64_t>), "", kIvfContainerInputs);
+
+}  // namespace raft::bench::neighbors
@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <common/benchmark.hpp>
+
+#include <raft/core/device_mdarray.hpp>
+#include <raft/core/host_mdarray.hpp>
+#include <raft/core/resource/cuda_stream.hpp>
+#include <raft/neighbors/ivf_flat.cuh>
+#include <raft/neighbors/ivf_flat_disk.hpp>
+#include <raft/neighbors/ivf_flat_host.hpp>
+#include <raft/neighbors/ivf_flat_host_serialize.hpp>
+#include <raft/neighbors/ivf_flat_serialize.cuh>
+#include <raft/random/rng.cuh>
+#include <raft/util/cudart_utils.hpp>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <sstream>
+#include <string>
+
+namespace raft::bench::neighbors {
+
+struct ivf_flat_disk_inputs {
+  int64_t n_samples;
+  int64_t dim;
+  int64_t n_queries;
+  int64_t k;
+  uint32_t n_lists;
+  uint32_t n_probes;
+  /** The capacity of the list cache relative to the size of the lists. */
+  double cache_fraction;
+  bool readahead;
+};
+
+inline auto operator<<(std::ostream& os, const ivf_flat_disk_inputs& p) -> std::ostream&
+{
+  os << p.n_samples << "#" << p.dim << "#" << p.n_queries << "#" << p.k << "#" << p.n_lists << "#"
+     << p.n_probes << "#" << p.cache_fraction << (p.readahead ? "#readahead" : "#no-readahead");
+  return os;
+}
+
+/**
+ * The search of a disk-resident IVF-Flat index for the cache sizes relative to the index. The
+ * index is built on the device and saved in an index container in the temporary directory (set
+ * `TMPDIR` to a directory on the drive to measure). The index file is evicted from the page cache
+ * once before the iterations, so that the list cache misses read the drive; the list cache is kept
+ * across the iterations. The reported recall is the fraction of the neighbors of the search of the
+ * index loaded into memory found by the search, which must be 1.
+ */
+template <typename T, typename IdxT>
+struct ivf_flat_disk : public fixture {
+  explicit ivf_flat_disk(const ivf_flat_disk_inputs& p)
+    : params_(p),
+      queries_(make_host_matrix<T, IdxT>(p.n_queries, p.dim)),
+      neighbors_(make_host_matrix<IdxT, IdxT>(p.n_queries, p.k)),
+      distances_(make_host_matrix<float, IdxT>(p.n_queries, p.k)),
+      host_neighbors_(make_host_matrix<IdxT, IdxT>(p.n_queries, p.k))
+  {
+    auto dataset   = make_device_matrix<T, IdxT>(handle, p.n_samples, p.dim);
+    auto d_queries = make_device_matrix<T, IdxT>(handle, p.n_queries, p.dim);
+    raft::random::RngState state{42};
+    raft::random::uniform(handle, state, dataset.data_handle(), dataset.size(), T(-1), T(1));
+    raft::random::uniform(handle, state, d_queries.data_handle(), d_queries.size(), T(-1), T(1));
+    raft::copy(queries_.data_handle(), d_queries.data_handle(), d_queries.size(), stream);
+    resource::sync_stream(handle, stream);
+
+    raft::neighbors::ivf_flat::index_params index_params;
+    index_params.n_lists = p.n_lists;
+    index_params.metric  = raft::distance::DistanceType::L2Expanded;
+    auto index           = raft::neighbors::ivf_flat::build(
+      handle, index_params, raft::make_const_mdspan(dataset.view()));
+
+    filename_ = std::filesystem::temp_directory_path() /
+                ("raft_ivf_flat_disk_bench_" + std::to_string(::getpid()) + ".bin");
+    raft::neighbors::ivf_flat::serialize(handle, filename_, index);
+    auto host_index = raft::neighbors::ivf_flat::deserialize_host<T, IdxT>(handle, filename_);
+    raft::neighbors::ivf_flat::serialize_host(handle, filename_, host_index);
+
+    // The search of the index in memory is the reference for the recall
+    raft::neighbors::ivf_flat::host_search_params search_params;
+    search_params.n_probes = p.n_probes;
+    auto host_distances    = make_host_matrix<float, IdxT>(p.n_queries, p.k);
+    raft::neighbors::ivf_flat::search(handle,
+                                      search_params,
+                                      host_index,
+                                      raft::make_const_mdspan(queries_.view()),
+                                      host_neighbors_.view(),
+                                      host_distances.view());
+    for (uint32_t label = 0; label < host_index.n_lists(); label++) {
+      const auto& list = host_index.lists()[label];
+      if (list.has_value()) {
+        lists_bytes_ += list->data.size() * sizeof(T) + list->indices.size() * sizeof(IdxT);
+      }
+    }
+  }
+
+  ~ivf_flat_disk() { std::filesystem::remove(filename_); }
+
+  void run_benchmark(::benchmark::State& state) override
+  {
+    std::ostringstream label_stream;
+    label_stream << params_;
+    state.SetLabel(label_stream.str());
+
+    raft::neighbors::ivf::list_cache_params cache_params;
+    cache_params.capacity_bytes = static_cast<uint64_t>(params_.cache_fraction * lists_bytes_);
+    cache_params.readahead      = params_.readahead;
+    drop_page_cache();
+    auto index =
+      raft::neighbors::ivf_flat::deserialize_disk<T, IdxT>(handle, filename_, cache_params);
+
+    raft::neighbors::ivf_flat::host_search_params search_params;
+    search_params.n_probes = params_.n_probes;
+    for (auto _ : state) {
+      auto start = std::chrono::high_resolution_clock::now();
+      raft::neighbors::ivf_flat::search(handle,
+                                        search_params,
+                                        index,
+                                        raft::make_const_mdspan(queries_.view()),
+                                        neighbors_.view(),
+                                        distances_.view());
+      auto end = std::chrono::high_resolution_clock::now();
+      state.SetIterationTime(std::chrono::duration<double>(end - start).count());
+    }
+    auto stats   = index.cache_stats();
+    auto lookups = std::max<uint64_t>(1, stats.hits + stats.misses);
+    state.SetItemsProcessed(state.iterations() * params_.n_queries);
+    state.counters["Recall"]    = recall();
+    state.counters["ListsMB"]   = lists_bytes_ / double(1 << 20);
+    state.counters["CacheMB"]   = stats.resident_bytes / double(1 << 20);
+    state.counters["HitRate"]   = double(stats.hits) / double(lookups);
+    state.counters["Readahead"] = stats.readahead;
+    state.counters["Evictions"] = stats.evictions;
+  }
+
+ private:
+  /** Evict the index file from the page cache, so that the search reads the disk. */
+  void drop_page_cache() const
+  {
+    int fd = ::open(filename_.c_str(), O_RDONLY);
+    if (fd < 0) { return; }
+    ::fdatasync(fd);
+    ::posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+    ::close(fd);
+  }
+
+  auto recall() const -> double
+  {
+    size_t match_count = 0;
+    for (int64_t i = 0; i < params_.n_queries; i++) {
+      auto* expected = host_neighbors_.data_handle() + i * params_.k;
+      for (int64_t j = 0; j < params_.k; j++) {
+        auto id = neighbors_(i, j);
+        if (std::find(expected, expected + params_.k, id) != expected + params_.k) {
+          match_count++;
+        }
+      }
+    }
+    return double(match_count) / double(params_.n_queries * params_.k);
+  }
+
+  ivf_flat_disk_inputs params_;
+  std::string filename_;
+  uint64_t lists_bytes_ = 0;
+  host_matrix<T, IdxT> queries_;
+  host_matrix<IdxT, IdxT> neighbors_;
+  host_matrix<float, IdxT> distances_;
+  host_matrix<IdxT, IdxT> host_neighbors_;
+};
+
+const std::vector<ivf_flat_disk_inputs> kIvfFlatDiskInputs = [] {
+  std::vector<ivf_flat_disk_inputs> inputs;
+  for (double cache_fraction : {0.01, 0.05, 0.2, 0.5, 1.1}) {
+    for (bool readahead : {false, true}) {
+      inputs.push_back({2000000, 128, 10000, 10, 4096, 50, cache_fraction, readahead});
+    }
+  }
+  return inputs;
+}();
+
+RAFT_BENCH_REGISTER((ivf_flat_disk<float, int64_t>), "", kIvfFlatDiskInputs);
+
+}  // namespace raft::bench::neighbors
@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <common/benchmark.hpp>
+
+#include <raft/core/device_mdarray.hpp>
+#include <raft/core/host_mdarray.hpp>
+#include <raft/core/resource/cuda_stream.hpp>
+#include <raft/neighbors/ivf_flat.cuh>
+#include <raft/neighbors/ivf_flat_host.hpp>
+#include <raft/neighbors/ivf_flat_serialize.cuh>
+#include <raft/random/rng.cuh>
+#include <raft/util/cudart_utils.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <optional>
+#include <sstream>
+
+namespace raft::bench::neighbors {
+
+struct ivf_flat_host_inputs {
+  int64_t n_samples;
+  int64_t dim;
+  int64_t n_queries;
+  int64_t k;
+  uint32_t n_lists;
+  uint32_t n_probes;
+  int num_threads;
+  /** Run the host search; otherwise run the device search on the same index. */
+  bool host;
+};
+
+inline auto operator<<(std::ostream& os, const ivf_flat_host_inputs& p) -> std::ostream&
+{
+  os << p.n_samples << "#" << p.dim << "#" << p.n_queries << "#" << p.k << "#" << p.n_lists << "#"
+     << p.n_probes << "#" << p.num_threads << (p.host ? "#host" : "#device");
+  return os;
+}
+
+/**
+ * Compare the host IVF-Flat search to the device search on the same index: the index is built on
+ * the device, serialized and loaded into host memory. The reported recall is the fraction of the
+ * device neighbors found by the search.
+ */
+template <typename T, typename IdxT>
+struct ivf_flat_host : public fixture {
+  explicit ivf_flat_host(const ivf_flat_host_inputs& p)
+    : params_(p),
+      index_(std::nullopt),
+      host_index_(std::nullopt),
+      queries_(make_host_matrix<T, IdxT>(p.n_queries, p.dim)),
+      neighbors_(make_host_matrix<IdxT, IdxT>(p.n_queries, p.k)),
+      distances_(make_host_matrix<float, IdxT>(p.n_queries, p.k)),
+      device_neighbors_(make_host_matrix<IdxT, IdxT>(p.n_queries, p.k))
+  {
+    auto dataset   = make_device_matrix<T, IdxT>(handle, p.n_samples, p.dim);
+    auto d_queries = make_device_matrix<T, IdxT>(handle, p.n_queries, p.dim);
+    raft::random::RngState state{42};
+    raft::random::uniform(handle, state, dataset.data_handle(), dataset.size(), T(-1), T(1));
+    raft::random::uniform(handle, state, d_queries.data_handle(), d_queries.size(), T(-1), T(1));
+    raft::copy(queries_.data_handle(), d_queries.data_handle(), d_queries.size(), stream);
+
+    raft::neighbors::ivf_flat::index_params index_params;
+    index_params.n_lists = p.n_lists;
+    index_params.metric  = raft::distance::DistanceType::L2Expanded;
+    index_.emplace(raft::neighbors::ivf_flat::build(
+      handle, index_params, raft::make_const_mdspan(dataset.view())));
+
+    std::stringstream ss;
+    raft::neighbors::ivf_flat::serialize(handle, ss, *index_);
+    host_index_.emplace(raft::neighbors::ivf_flat::deserialize_host<T, IdxT>(handle, ss));
+
+    // The device results are the reference for the recall of both searches
+    auto d_neighbors = make_device_matrix<IdxT, IdxT>(handle, p.n_queries, p.k);
+    auto d_distances = make_device_matrix<float, IdxT>(handle, p.n_queries, p.k);
+    raft::neighbors::ivf_flat::search_params search_params;
+    search_params.n_probes = p.n_probes;
+    raft::neighbors::ivf_flat::search(handle,
+                                      search_params,
+                                      *index_,
+                                      raft::make_const_mdspan(d_queries.view()),
+                                      d_neighbors.view(),
+                                      d_distances.view());
+    raft::copy(
+      device_neighbors_.data_handle(), d_neighbors.data_handle(), d_neighbors.size(), stream);
+    resource::sync_stream(handle, stream);
+  }
+
+  void run_benchmark(::benchmark::State& state) override
+  {
+    std::ostringstream label_stream;
+    label_stream << params_;
+    state.SetLabel(label_stream.str());
+
+    if (params_.host) {
+      run_host(state);
+    } else {
+      run_device(state);
+    }
+    state.SetItemsProcessed(state.iterations() * params_.n_queries);
+    state.counters["Recall"] = recall();
+  }
+
+ private:
+  void run_host(::benchmark::State& state)
+  {
+    raft::neighbors::ivf_flat::host_search_params search_params;
+    search_params.n_probes    = params_.n_probes;
+    search_params.num_threads = params_.num_threads;
+    for (auto _ : state) {
+      auto start = std::chrono::high_resolution_clock::now();
+      raft::neighbors::ivf_flat::search(handle,
+                                        search_params,
+                                        *host_index_,
+                                        raft::make_const_mdspan(queries_.view()),
+                                        neighbors_.view(),
+                                        distances_.view());
+      auto end = std::chrono::high_resolution_clock::now();
+      state.SetIterationTime(std::chrono::duration<double>(end - start).count());
+    }
+  }
+
+  void run_device(::benchmark::State& state)
+  {
+    auto d_queries   = make_device_matrix<T, IdxT>(handle, params_.n_queries, params_.dim);
+    auto d_neighbors = make_device_matrix<IdxT, IdxT>(handle, params_.n_queries, params_.k);
+    auto d_distances = make_device_matrix<float, IdxT>(handle, params_.n_queries, params_.k);
+    raft::neighbors::ivf_flat::search_params search_params;
+    search_params.n_probes = params_.n_probes;
+    // Include the transfers, as a host caller of the device search would
+    loop_on_state(state, [&]() {
+      raft::copy(d_queries.data_handle(), queries_.data_handle(), queries_.size(), stream);
+      raft::neighbors::ivf_flat::search(handle,
+                                        search_params,
+                                        *index_,
+                                        raft::make_const_mdspan(d_queries.view()),
+                                        d_neighbors.view(),
+                                        d_distances.view());
+      raft::copy(neighbors_.data_handle(), d_neighbors.data_handle(), d_neighbors.size(), stream);
+    });
+    resource::sync_stream(handle, stream);
+  }
+
+  auto recall() const -> double
+  {
+    size_t match_count = 0;
+    for (int64_t i = 0; i < params_.n_queries; i++) {
+      auto* expected = device_neighbors_.data_handle() + i * params_.k;
+      for (int64_t j = 0; j < params_.k; j++) {
+        auto id = neighbors_(i, j);
+        if (std::find(expected, expected + params_.k, id) != expected + params_.k) {
+          match_count++;
+        }
+      }
+    }
+    return double(match_count) / double(params_.n_queries * params_.k);
+  }
+
+  ivf_flat_host_inputs params_;
+  std::optional<raft::neighbors::ivf_flat::index<T, IdxT>> index_;
+  std::optional<raft::neighbors::ivf_flat::host_index<T, IdxT>> host_index_;
+  host_matrix<T, IdxT> queries_;
+  host_matrix<IdxT, IdxT> neighbors_;
+  host_matrix<float, IdxT> distances_;
+  host_matrix<IdxT, IdxT> device_neighbors_;
+};
+
+const std::vector<ivf_flat_host_inputs> kIvfFlatHostInputs = [] {
+  std::vector<ivf_flat_host_inputs> inputs;
+  for (bool host : {false, true}) {
+    for (uint32_t n_probes : {10, 50, 200}) {
+      for (int num_threads : {1, 0}) {
+        if (!host && num_threads != 0) { continue; }
+        inputs.push_back({1000000, 128, 10000, 10, 1024, n_probes, num_threads, host});
+      }
+      inputs.push_back({1000000, 96, 1, 10, 1024, n_probes, 0, host});
+    }
+  }
+  return inputs;
+}();
+
+RAFT_BENCH_REGISTER((ivf_flat_host<float, int64_t>), "", kIvfFlatHostInputs);
+
+}  // namespace raft::bench::neighbors
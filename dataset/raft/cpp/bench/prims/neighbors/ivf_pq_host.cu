@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <common/benchmark.hpp>
+
+#include <raft/core/device_mdarray.hpp>
+#include <raft/core/host_mdarray.hpp>
+#include <raft/core/resource/cuda_stream.hpp>
+#include <raft/neighbors/brute_force.cuh>
+#include <raft/neighbors/ivf_flat.cuh>
+#include <raft/neighbors/ivf_flat_host.hpp>
+#include <raft/neighbors/ivf_flat_serialize.cuh>
+#include <raft/neighbors/ivf_pq.cuh>
+#include <raft/neighbors/ivf_pq_host.hpp>
+#include <raft/neighbors/ivf_pq_serialize.cuh>
+#include <raft/random/rng.cuh>
+#include <raft/util/cudart_utils.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <optional>
+#include <sstream>
+
+namespace raft::bench::neighbors {
+
+struct ivf_pq_host_inputs {
+  int64_t n_samples;
+  int64_t dim;
+  int64_t n_queries;
+  int64_t k;
+  uint32_t n_lists;
+  uint32_t n_probes;
+  uint32_t pq_bits;
+  uint32_t pq_dim;
+  /** Re-rank `k * refine_ratio` candidates with the exact distances; 0 disables the refinement. */
+  uint32_t refine_ratio;
+  int num_threads;
+  /** Run the exact host search (IVF-Flat probing all lists) as the baseline. */
+  bool exact;
+};
+
+inline auto operator<<(std::ostream& os, const ivf_pq_host_inputs& p) -> std::ostream&
+{
+  os << p.n_samples << "#" << p.dim << "#" << p.n_queries << "#" << p.k << "#" << p.n_lists << "#"
+     << p.n_probes << "#" << p.num_threads;
+  if (p.exact) {
+    os << "#exact";
+  } else {
+    os << "#" << p.pq_bits << "#" << p.pq_dim << "#" << p.refine_ratio;
+  }
+  return os;
+}
+
+/**
+ * The host IVF-PQ search compared to the exact host search: the IVF-PQ index is built on the
+ * device, serialized and loaded into host memory. The reported recall is the fraction of the
+ * exact neighbors (computed with the device brute-force search) found by the search, and the
+ * items per second are the queries per second.
+ */
+template <typename T, typename IdxT>
+struct ivf_pq_host : public fixture {
+  explicit ivf_pq_host(const ivf_pq_host_inputs& p)
+    : params_(p),
+      pq_index_(std::nullopt),
+      flat_index_(std::nullopt),
+      dataset_(make_host_matrix<T, IdxT>(p.n_samples, p.dim)),
+      queries_(make_host_matrix<T, IdxT>(p.n_queries, p.dim)),
+      neighbors_(make_host_matrix<IdxT, IdxT>(p.n_queries, p.k)),
+      distances_(make_host_matrix<float, IdxT>(p.n_queries, p.k)),
+      exact_neighbors_(make_host_matrix<IdxT, IdxT>(p.n_queries, p.k))
+  {
+    auto dataset   = make_device_matrix<T, IdxT>(handle, p.n_samples, p.dim);
+    auto d_queries = make_device_matrix<T, IdxT>(handle, p.n_queries, p.dim);
+    raft::random::RngState state{42};
+    raft::random::uniform(handle, state, dataset.data_handle(), dataset.size(), T(-1), T(1));
+    raft::random::uniform(handle, state, d_queries.data_handle(), d_queries.size(), T(-1), T(1));
+    raft::copy(dataset_.data_handle(), dataset.data_handle(), dataset.size(), stream);
+    raft::copy(queries_.data_handle(), d_queries.data_handle(), d_queries.size(), stream);
+
+    std::stringstream ss;
+    if (p.exact) {
+      raft::neighbors::ivf_flat::index_params index_params;
+      index_params.n_lists = p.n_lists;
+      index_params.metric  = raft::distance::DistanceType::L2Expanded;
+      auto index           = raft::neighbors::ivf_flat::build(
+        handle, index_params, raft::make_const_mdspan(dataset.view()));
+      raft::neighbors::ivf_flat::serialize(handle, ss, index);
+      flat_index_.emplace(raft::neighbors::ivf_flat::deserialize_host<T, IdxT>(handle, ss));
+    } else {
+      raft::neighbors::ivf_pq::index_params index_params;
+      index_params.n_lists = p.n_lists;
+      index_params.pq_bits = p.pq_bits;
+      index_params.pq_dim  = p.pq_dim;
+      index_params.metric  = raft::distance::DistanceType::L2Expanded;
+      auto index           = raft::neighbors::ivf_pq::build(
+        handle, index_params, raft::make_const_mdspan(dataset.view()));
+      raft::neighbors::ivf_pq::serialize(handle, ss, index);
+      pq_index_.emplace(raft::neighbors::ivf_pq::deserialize_host<IdxT>(handle, ss));
+    }
+
+    auto d_neighbors = make_device_matrix<IdxT, IdxT>(handle, p.n_queries, p.k);
+    auto d_distances = make_device_matrix<T, IdxT>(handle, p.n_queries, p.k);
+    std::vector<raft::device_matrix_view<const T, IdxT, row_major>> index_views{
+      raft::make_const_mdspan(dataset.view())};
+    raft::neighbors::brute_force::knn(handle,
+                                      index_views,
+                                      raft::make_const_mdspan(d_queries.view()),
+                                      d_neighbors.view(),
+                                      d_distances.view(),
+                                      raft::distance::DistanceType::L2Expanded);
+    raft::copy(
+      exact_neighbors_.data_handle(), d_neighbors.data_handle(), d_neighbors.size(), stream);
+    resource::sync_stream(handle, stream);
+  }
+
+  void run_benchmark(::benchmark::State& state) override
+  {
+    std::ostringstream label_stream;
+    label_stream << params_;
+    state.SetLabel(label_stream.str());
+
+    for (auto _ : state) {
+      auto start = std::chrono::high_resolution_clock::now();
+      if (params_.exact) {
+        search_exact();
+      } else {
+        search_pq();
+      }
+      auto end = std::chrono::high_resolution_clock::now();
+      state.SetIterationTime(std::chrono::duration<double>(end - start).count());
+    }
+    state.SetItemsProcessed(state.iterations() * params_.n_queries);
+    state.counters["Recall"] = recall();
+  }
+
+ private:
+  void search_pq()
+  {
+    raft::neighbors::ivf_pq::host_search_params search_params;
+    search_params.n_probes    = params_.n_probes;
+    search_params.num_threads = params_.num_threads;
+    if (params_.refine_ratio > 0) {
+      raft::neighbors::ivf_pq::search_with_refinement(handle,
+                                                      search_params,
+                                                      *pq_index_,
+                                                      raft::make_const_mdspan(dataset_.view()),
+                                                      raft::make_const_mdspan(queries_.view()),
+                                                      neighbors_.view(),
+                                                      distances_.view(),
+                                                      params_.refine_ratio);
+    } else {
+      raft::neighbors::ivf_pq::search(handle,
+                                      search_params,
+                                      *pq_index_,
+                                      raft::make_const_mdspan(queries_.view()),
+                                      neighbors_.view(),
+                                      distances_.view());
+    }
+  }
+
+  void search_exact()
+  {
+    // Probing all the lists makes the IVF-Flat search exhaustive
+    raft::neighbors::ivf_flat::host_search_params search_params;
+    search_params.n_probes    = flat_index_->n_lists();
+    search_params.num_threads = params_.num_threads;
+    raft::neighbors::ivf_flat::search(handle,
+                                      search_params,
+                                      *flat_index_,
+                                      raft::make_const_mdspan(queries_.view()),
+                                      neighbors_.view(),
+                                      distances_.view());
+  }
+
+  auto recall() const -> double
+  {
+    size_t match_count = 0;
+    for (int64_t i = 0; i < params_.n_queries; i++) {
+      auto* expected = exact_neighbors_.data_handle() + i * params_.k;
+      for (int64_t j = 0; j < params_.k; j++) {
+        auto id = neighbors_(i, j);
+        if (std::find(expected, expected + params_.k, id) != expected + params_.k) {
+          match_count++;
+        }
+      }
+    }
+    return double(match_count) / double(params_.n_queries * params_.k);
+  }
+
+  ivf_pq_host_inputs params_;
+  std::optional<raft::neighbors::ivf_pq::host_index<IdxT>> pq_index_;
+  std::optional<raft::neighbors::ivf_flat::host_index<T, IdxT>> flat_index_;
+  host_matrix<T, IdxT> dataset_;
+  host_matrix<T, IdxT> queries_;
+  host_matrix<IdxT, IdxT> neighbors_;
+  host_matrix<float, IdxT> distances_;
+  host_matrix<IdxT, IdxT> exact_neighbors_;
+};
+
+const std::vector<ivf_pq_host_inputs> kIvfPqHostInputs = [] {
+  std::vector<ivf_pq_host_inputs> inputs;
+  for (int num_threads : {1, 0}) {
+    inputs.push_back({1000000, 128, 1000, 10, 1024, 0, 0, 0, 0, num_threads, true});
+    for (uint32_t pq_bits : {4, 8}) {
+      for (uint32_t n_probes : {20, 100}) {
+        for (uint32_t refine_ratio : {0, 2, 4}) {
+          inputs.push_back({1000000,
+                            128,
+                            1000,
+                            10,
+                            1024,
+                            n_probes,
+                            pq_bits,
+                            64,
+                            refine_ratio,
+                            num_threads,
+                            false});
+        }
+      }
+    }
+  }
+  return inputs;
+}();
+
+RAFT_BENCH_REGISTER((ivf_pq_host<float, int64_t>), "", kIvfPqHostInputs);
+
+}  // namespace raft::bench::neighbors
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#if defined(__BMI2__)
+#include <immintrin.h>
+#endif
+
+namespace raft::core::detail {
+
+/** Number of the set bits of a word. */
+inline auto host_popc(uint64_t v) -> uint32_t
+{
+#if defined(__GNUC__) || defined(__clang__)
+  return __builtin_popcountll(v);
+#else
+  uint32_t c = 0;
+  for (; v != 0; v &= v - 1) {
+    c++;
+  }
+  return c;
+#endif  // compiler
+}
+
+/** Position of the lowest set bit of a non-zero word. */
+inline auto host_ctz(uint64_t v) -> uint32_t
+{
+#if defined(__GNUC__) || defined(__clang__)
+  return __builtin_ctzll(v);
+#else
+  uint32_t c = 0;
+  for (; (v & 1) == 0; v >>= 1) {
+    c++;
+  }
+  return c;
+#endif  // compiler
+}
+
+/** Position of the set bit of rank `r` (0-based) of a word with more than `r` set bits. */
+inline auto host_select_in_word(uint64_t v, uint32_t r) -> uint32_t
+{
+#if defined(__BMI2__)
+  return host_ctz(_pdep_u64(uint64_t{1} << r, v));
+#else
+  // Skip whole bytes by their counts, then the lower set bits of the byte
+  uint32_t offset = 0;
+  for (;; offset += 8) {
+    auto c = host_popc((v >> offset) & 0xffu);
+    if (r < c) { break; }
+    r -= c;
+  }
+  uint64_t byte = (v >> offset) & 0xffu;
+  for (; r > 0; r--) {
+    byte &= byte - 1;
+  }
+  return offset + host_ctz(byte);
+#endif
+}
+
+/** The mask of the bits [begin, end) of a word, `0 <= begin < end <= nbits`. */
+template <typename bitset_t>
+constexpr auto host_word_mask(uint32_t begin, uint32_t end) -> bitset_t
+{
+  constexpr uint32_t nbits = sizeof(bitset_t) * 8;
+  constexpr auto all_ones  = bitset_t(~bitset_t{0});
+  auto upper = end == nbits ? all_ones : bitset_t((bitset_t{1} << end) - bitset_t{1});
+  return bitset_t(upper & bitset_t(all_ones << begin));
+}
+
+/**
+ * Call `f(word_ix, masked_word)` for the words overlapping the bits [begin, end), with the bits
+ * outside of the range cleared.
+ */
+template <typename bitset_t, typename index_t, typename F>
+inline void host_for_each_word(const bitset_t* words, index_t begin, index_t end, F f)
+{
+  constexpr index_t nbits = sizeof(bitset_t) * 8;
+  if (begin >= end) { return; }
+  index_t first = begin / nbits;
+  index_t last  = (end - 1) / nbits;
+  for (index_t i = first; i <= last; i++) {
+    uint32_t lo = i == first ? uint32_t(begin % nbits) : 0;
+    uint32_t hi = i == last ? uint32_t(end - last * nbits) : uint32_t(nbits);
+    f(i, bitset_t(words[i] & host_word_mask<bitset_t>(lo, hi)));
+  }
+}
+
+}  // namespace raft::core::detail
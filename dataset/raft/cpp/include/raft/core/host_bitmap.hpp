@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <raft/core/error.hpp>
+#include <raft/core/host_bitset.hpp>
+#include <raft/core/host_csr_matrix.hpp>
+#include <raft/core/resources.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+
+namespace raft::core {
+
+template <typename bitmap_t, typename index_t>
+struct bitmap_view;
+
+/**
+ * @defgroup host_bitmap Host Bitmap
+ * @{
+ */
+/**
+ * @brief View of a bitmap in host memory.
+ *
+ * A row-major matrix of `rows * cols` bits with the layout of `bitmap_view`: the bit (row, col) is
+ * the bit `row * cols + col` of the bitset, so that the rows are not aligned to the words. See
+ * `host_bitset_view` for the zero-copy interop with the device views.
+ *
+ * @tparam bitmap_t Underlying type of the bitmap array. Default is uint32_t.
+ * @tparam index_t Indexing type used. Default is uint32_t.
+ */
+template <typename bitmap_t = uint32_t, typename index_t = uint32_t>
+struct host_bitmap_view : public host_bitset_view<bitmap_t, index_t> {
+  using host_bitset_view<bitmap_t, index_t>::set;
+  using host_bitset_view<bitmap_t, index_t>::test;
+
+  static_assert((std::is_same<typename std::remove_const<bitmap_t>::type, uint32_t>::value ||
+                 std::is_same<typename std::remove_const<bitmap_t>::type, uint64_t>::value),
+                "The bitmap_t must be uint32_t or uint64_t.");
+  /**
+   * @brief Create a bitmap view from a host raw pointer.
+   *
+   * @param bitmap_ptr Host raw pointer
+   * @param rows Number of row in the matrix.
+   * @param cols Number of col in the matrix.
+   */
+  host_bitmap_view(bitmap_t* bitmap_ptr, index_t rows, index_t cols)
+    : host_bitset_view<bitmap_t, index_t>(bitmap_ptr, rows * cols), rows_(rows), cols_(cols)
+  {
+  }
+  /**
+   * @brief Create a bitmap view from a host vector view of the bitmap.
+   *
+   * @param bitmap_span Host vector view of the bitmap
+   * @param rows Number of row in the matrix.
+   * @param cols Number of col in the matrix.
+   */
+  host_bitmap_view(raft::host_vector_view<bitmap_t, index_t> bitmap_span,
+                   index_t rows,
+                   index_t cols)
+    : host_bitset_view<bitmap_t, index_t>(bitmap_span, rows * cols), rows_(rows), cols_(cols)
+  {
+  }
+  /** @brief View the words of a `bitmap_view` in host-accessible memory, without a copy. */
+  explicit host_bitmap_view(bitmap_view<bitmap_t, index_t> view)
+    : host_bitmap_view(view.data(), view.get_n_rows(), view.get_n_cols())
+  {
+    RAFT_EXPECTS(view.get_original_nbits() == 0 ||
+                   view.get_original_nbits() == this->bitset_element_size,
+                 "A reinterpreted bitmap can't be viewed on the host");
+  }
+  /** @brief A `bitmap_view` of the same words (see `host_bitset_view`). */
+  [[nodiscard]] auto to_bitmap_view() const -> bitmap_view<bitmap_t, index_t>
+  {
+    return bitmap_view<bitmap_t, index_t>(this->data(), rows_, cols_);
+  }
+
+  /**
+   * @brief Test if a given row and col are set in the bitmap.
+   *
+   * @param row Row index of the bit to test
+   * @param col Col index of the bit to test
+   * @return bool True if index has not been unset in the bitset
+   */
+  inline auto test(const index_t row, const index_t col) const -> bool
+  {
+    return test(row * cols_ + col);
+  }
+  /**
+   * @brief Set a given row and col to set_value in the bitmap.
+   *
+   * @param row Row index of the bit to set
+   * @param col Col index of the bit to set
+   * @param new_value Value to set the bit to (true or false)
+   */
+  inline void set(const index_t row, const index_t col, bool new_value) const
+  {
+    set(row * cols_ + col, new_value);
+  }
+
+  /** @brief Get the total number of rows */
+  inline auto get_n_rows() const -> index_t { return rows_; }
+  /** @brief Get the total number of columns */
+  inline auto get_n_cols() const -> index_t { return cols_; }
+  /** @brief The number of bits set to true in a row. */
+  inline auto count_row(index_t row) const -> index_t
+  {
+    return this->count(row * cols_, (row + 1) * cols_);
+  }
+
+  /**
+   * @brief Converts to a Compressed Sparse Row (CSR) format matrix, as `bitmap_view::to_csr`.
+   *
+   * Every '1' bit of the bitmap is a non-zero entry of value 1 in the CSR matrix of the same
+   * dimensions. A sparsity-owning matrix is resized to the number of the non-zeros; otherwise the
+   * number of the non-zeros must match `count()`.
+   *
+   * @tparam csr_matrix_t a host CSR matrix type
+   *
+   * @param[in] res RAFT resources
+   * @param[out] csr Output CSR matrix [get_n_rows(), get_n_cols()]
+   */
+  template <typename csr_matrix_t>
+  void to_csr(const raft::resources& res, csr_matrix_t& csr) const
+  {
+    static_assert(raft::is_host_csr_matrix_v<csr_matrix_t>, "The CSR matrix must be on the host");
+    using indptr_t  = typename csr_matrix_t::indptr_type;
+    using indices_t = typename csr_matrix_t::indices_type;
+    using value_t   = typename csr_matrix_t::element_type;
+
+    auto structure = csr.structure_view();
+    RAFT_EXPECTS(index_t(structure.get_n_rows()) == rows_ &&
+                   index_t(structure.get_n_cols()) == cols_,
+                 "The CSR matrix must be of the dimensions of the bitmap");
+    auto nnz = size_t(this->count());
+    if constexpr (raft::is_host_csr_sparsity_owning_v<csr_matrix_t>) {
+      csr.initialize_sparsity(nnz);
+      structure = csr.structure_view();
+    } else {
+      RAFT_EXPECTS(size_t(structure.get_nnz()) == nnz,
+                   "The number of non-zeros of the CSR matrix must be count()");
+    }
+
+    indptr_t* indptr   = structure.get_indptr().data();
+    indices_t* indices = structure.get_indices().data();
+    size_t pos         = 0;
+    indptr[0]          = 0;
+    for (index_t row = 0; row < rows_; row++) {
+      index_t row_begin = row * cols_;
+      this->for_each_set(row_begin, row_begin + cols_, [&](index_t ix) {
+        indices[pos++] = indices_t(ix - row_begin);
+      });
+      indptr[row + 1] = indptr_t(pos);
+    }
+    std::fill_n(csr.get_elements().data(), nnz, value_t(1));
+  }
+
+  /**
+   * @brief Set the bits of the non-zero entries of a Compressed Sparse Row (CSR) format matrix of
+   * the dimensions of the bitmap, and unset the others.
+   *
+   * @tparam csr_matrix_t a host CSR matrix or matrix view type
+   *
+   * @param[in] res RAFT resources
+   * @param[in] csr Input CSR matrix [get_n_rows(), get_n_cols()]
+   */
+  template <typename csr_matrix_t>
+  void from_csr(const raft::resources& res, csr_matrix_t& csr) const
+  {
+    auto structure = csr.structure_view();
+    RAFT_EXPECTS(index_t(structure.get_n_rows()) == rows_ &&
+                   index_t(structure.get_n_cols()) == cols_,
+                 "The CSR matrix must be of the dimensions of the bitmap");
+    this->reset(false);
+    const auto* indptr  = structure.get_indptr().data();
+    const auto* indices = structure.get_indices().data();
+    for (index_t row = 0; row < rows_; row++) {
+      for (auto i = indptr[row]; i < indptr[row + 1]; i++) {
+        set(row, index_t(indices[i]), true);
+      }
+    }
+  }
+
+ private:
+  index_t rows_;
+  index_t cols_;
+};
+
+/** @} */
+}  // end namespace raft::core
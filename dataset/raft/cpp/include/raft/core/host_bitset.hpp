@@ -0,0 +1,608 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <raft/core/detail/host_bitset.hpp>
+#include <raft/core/error.hpp>
+#include <raft/core/host_csr_matrix.hpp>
+#include <raft/core/host_mdarray.hpp>
+#include <raft/core/host_mdspan.hpp>
+#include <raft/core/resources.hpp>
+#include <raft/util/integer_utils.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+namespace raft::core {
+
+template <typename bitset_t, typename index_t>
+struct bitset_view;
+
+/**
+ * @defgroup host_bitset Host Bitset
+ * @{
+ */
+/**
+ * @brief View of a bitset in host memory.
+ *
+ * The words of the bitset have the layout of `bitset_view`: the bit `i` is the bit
+ * `i % (sizeof(bitset_t) * 8)` of the word `i / (sizeof(bitset_t) * 8)`, and the bits of the last
+ * word past the size are ignored. A `bitset_view` of host-accessible memory (pinned, managed, or
+ * any memory on a system with HMM/ATS) can be viewed as a `host_bitset_view` and back without a
+ * copy, for example to filter the host search with `neighbors::filtering::bitset_filter`:
+ *
+ * @code{.cpp}
+ * #include <raft/core/bitset.cuh>
+ * #include <raft/core/host_bitset.hpp>
+ * #include <raft/neighbors/sample_filter.cuh>
+ *
+ * auto removed = raft::core::host_bitset<uint32_t, int64_t>(res, n_rows);
+ * for (auto id : removed_ids) { removed.view().set(id, false); }
+ * auto filter  = raft::neighbors::filtering::bitset_filter(removed.view().to_bitset_view());
+ * // A device bitset is copied to the host through the mdspans of the words:
+ * raft::copy(res, removed.to_mdspan(), device_bitset.to_mdspan());
+ * @endcode
+ *
+ * The set operations, the counts and the conversions process whole words and are written to be
+ * vectorized by the compiler.
+ *
+ * @tparam bitset_t Underlying type of the bitset array. Default is uint32_t.
+ * @tparam index_t Indexing type used. Default is uint32_t.
+ */
+template <typename bitset_t = uint32_t, typename index_t = uint32_t>
+struct host_bitset_view {
+  static constexpr index_t bitset_element_size = sizeof(bitset_t) * 8;
+  using word_type                              = std::remove_const_t<bitset_t>;
+
+  static_assert(std::is_unsigned_v<word_type>, "The bitset_t must be an unsigned integer type.");
+
+  /**
+   * @brief Create a bitset view from a host pointer to the bitset.
+   *
+   * @param bitset_ptr Host pointer to the bitset
+   * @param bitset_len Number of bits in the bitset
+   */
+  host_bitset_view(bitset_t* bitset_ptr, index_t bitset_len)
+    : bitset_ptr_{bitset_ptr}, bitset_len_{bitset_len}
+  {
+  }
+  /**
+   * @brief Create a bitset view from a host vector view of the bitset.
+   *
+   * @param bitset_span Host vector view of the bitset
+   * @param bitset_len Number of bits in the bitset
+   */
+  host_bitset_view(raft::host_vector_view<bitset_t, index_t> bitset_span, index_t bitset_len)
+    : bitset_ptr_{bitset_span.data_handle()}, bitset_len_{bitset_len}
+  {
+  }
+  /** @brief A read-only view of a mutable bitset. */
+  template <typename other_t,
+            typename = std::enable_if_t<std::is_same_v<bitset_t, const other_t> &&
+                                        !std::is_const_v<other_t>>>
+  host_bitset_view(host_bitset_view<other_t, index_t> other)
+    : bitset_ptr_{other.data()}, bitset_len_{other.size()}
+  {
+  }
+  /**
+   * @brief View the words of a `bitset_view` in host-accessible memory, without a copy.
+   *
+   * The bitset must not be reinterpreted (its `original_nbits` must be 0 or the size of
+   * `bitset_t`).
+   */
+  explicit host_bitset_view(bitset_view<bitset_t, index_t> view)
+    : bitset_ptr_{view.data()}, bitset_len_{view.size()}
+  {
+    RAFT_EXPECTS(
+      view.get_original_nbits() == 0 || view.get_original_nbits() == bitset_element_size,
+      "A reinterpreted bitset can't be viewed on the host");
+  }
+  /** @brief A `bitset_view` of the same words (see the host memory note above). */
+  [[nodiscard]] auto to_bitset_view() const -> bitset_view<bitset_t, index_t>
+  {
+    return bitset_view<bitset_t, index_t>(bitset_ptr_, bitset_len_);
+  }
+  /** @brief A view of the same words with the read-only access. */
+  [[nodiscard]] auto as_const() const -> host_bitset_view<const word_type, index_t>
+  {
+    return host_bitset_view<const word_type, index_t>(bitset_ptr_, bitset_len_);
+  }
+
+  /**
+   * @brief Test if a given index is set in the bitset.
+   *
+   * @param sample_index Single index to test
+   * @return bool True if index has not been unset in the bitset
+   */
+  inline auto test(const index_t sample_index) const -> bool
+  {
+    return (bitset_ptr_[sample_index / bitset_element_size] &
+            (word_type{1} << (sample_index % bitset_element_size))) != 0;
+  }
+  inline auto operator[](const index_t sample_index) const -> bool { return test(sample_index); }
+  /**
+   * @brief Set a given index to set_value in the bitset. Not thread-safe for the indices in the
+   * same word.
+   *
+   * @param sample_index index to set
+   * @param set_value Value to set the bit to (true or false)
+   */
+  inline void set(const index_t sample_index, bool set_value) const
+  {
+    const word_type bitmask = word_type{1} << (sample_index % bitset_element_size);
+    auto& word              = bitset_ptr_[sample_index / bitset_element_size];
+    word                    = set_value ? word_type(word | bitmask) : word_type(word & ~bitmask);
+  }
+
+  /** @brief Get the host pointer to the bitset. */
+  inline auto data() const -> bitset_t* { return bitset_ptr_; }
+  /** @brief Get the number of bits of the bitset representation. */
+  inline auto size() const -> index_t { return bitset_len_; }
+  /** @brief Get the number of elements used by the bitset representation. */
+  inline auto n_elements() const -> index_t
+  {
+    return raft::div_rounding_up_safe(bitset_len_, bitset_element_size);
+  }
+  inline auto to_mdspan() const -> raft::host_vector_view<bitset_t, index_t>
+  {
+    return raft::make_host_vector_view<bitset_t, index_t>(bitset_ptr_, n_elements());
+  }
+
+  /** @brief The number of bits set to true. */
+  auto count() const -> index_t
+  {
+    index_t n_full = bitset_len_ / bitset_element_size;
+    uint64_t total = 0;
+    for (index_t i = 0; i < n_full; i++) {
+      total += detail::host_popc(bitset_ptr_[i]);
+    }
+    if (n_full < n_elements()) {
+      total += detail::host_popc(
+        bitset_ptr_[n_full] &
+        detail::host_word_mask<word_type>(0, uint32_t(bitset_len_ % bitset_element_size)));
+    }
+    return index_t(total);
+  }
+  /** @brief The number of bits set to true in [begin, end). */
+  auto count(index_t begin, index_t end) const -> index_t
+  {
+    index_t total = 0;
+    detail::host_for_each_word(
+      bitset_ptr_, begin, end, [&total](index_t, word_type w) { total += detail::host_popc(w); });
+    return total;
+  }
+  /** @brief Checks if any of the bits are set to true in the bitset. */
+  auto any() const -> bool { return count() > 0; }
+  /** @brief Checks if all of the bits are set to true in the bitset. */
+  auto all() const -> bool { return count() == bitset_len_; }
+  /** @brief Checks if none of the bits are set to true in the bitset. */
+  auto none() const -> bool { return count() == 0; }
+  /** @brief The fraction of the unset bits; 1 for an empty bitset (see `bitset_view::sparsity`). */
+  auto sparsity() const -> double
+  {
+    if (bitset_len_ == 0) { return 1.0; }
+    return double(bitset_len_ - count()) / double(bitset_len_);
+  }
+
+  /**
+   * @brief Call `f(index)` for the indices set in [begin, end), in the ascending order.
+   */
+  template <typename F>
+  void for_each_set(index_t begin, index_t end, F f) const
+  {
+    detail::host_for_each_word(bitset_ptr_, begin, end, [&f](index_t word_ix, word_type w) {
+      for (; w != 0; w &= word_type(w - 1)) {
+        f(index_t(word_ix * bitset_element_size + detail::host_ctz(w)));
+      }
+    });
+  }
+
+  /** @brief Set all the bits to `default_value`. */
+  void reset(bool default_value = true) const
+  {
+    std::fill_n(bitset_ptr_, n_elements(), default_value ? ~word_type{0} : word_type{0});
+  }
+  /** @brief Flip all the bits. */
+  void flip() const
+  {
+    auto n = n_elements();
+    for (index_t i = 0; i < n; i++) {
+      bitset_ptr_[i] = word_type(~bitset_ptr_[i]);
+    }
+  }
+  /** @brief this = this & other; the bitsets must be of the same size. */
+  void bitwise_and(host_bitset_view<const word_type, index_t> other) const
+  {
+    apply(other, [](word_type a, word_type b) { return word_type(a & b); });
+  }
+  /** @brief this = this | other; the bitsets must be of the same size. */
+  void bitwise_or(host_bitset_view<const word_type, index_t> other) const
+  {
+    apply(other, [](word_type a, word_type b) { return word_type(a | b); });
+  }
+  /** @brief this = this & ~other; the bitsets must be of the same size. */
+  void bitwise_andnot(host_bitset_view<const word_type, index_t> other) const
+  {
+    apply(other, [](word_type a, word_type b) { return word_type(a & ~b); });
+  }
+
+  /**
+   * @brief Converts to a Compressed Sparse Row (CSR) format matrix, as `bitset_view::to_csr`.
+   *
+   * Every '1' bit of the bitset is a non-zero entry of value 1 in every row of the CSR matrix. The
+   * number of columns of the matrix must be the size of the bitset. A sparsity-owning matrix is
+   * resized to the number of the non-zeros; otherwise the number of the non-zeros must match
+   * `count() * n_rows`.
+   *
+   * @tparam csr_matrix_t a host CSR matrix type
+   *
+   * @param[in] res RAFT resources
+   * @param[out] csr Output CSR matrix [n_rows, size()]
+   */
+  template <typename csr_matrix_t>
+  void to_csr(const raft::resources& res, csr_matrix_t& csr) const;
+
+  /**
+   * @brief Set the bits from a Compressed Sparse Row (CSR) format matrix: an index is set if any
+   * row of the matrix has a non-zero entry in its column, so that `from_csr` reverts `to_csr`.
+   *
+   * @tparam csr_matrix_t a host CSR matrix or matrix view type
+   *
+   * @param[in] res RAFT resources
+   * @param[in] csr Input CSR matrix [n_rows, size()]
+   */
+  template <typename csr_matrix_t>
+  void from_csr(const raft::resources& res, csr_matrix_t& csr) const;
+
+ private:
+  template <typename Op>
+  void apply(host_bitset_view<const word_type, index_t> other, Op op) const
+  {
+    RAFT_EXPECTS(other.size() == bitset_len_, "The bitsets must be of the same size");
+    auto n          = n_elements();
+    word_type* dst  = bitset_ptr_;
+    const auto* src = other.data();
+    for (index_t i = 0; i < n; i++) {
+      dst[i] = op(dst[i], src[i]);
+    }
+  }
+
+  bitset_t* bitset_ptr_;
+  index_t bitset_len_;
+};
+
+/**
+ * @brief A bitset in host memory, the host counterpart of `raft::core::bitset`.
+ *
+ * See `host_bitset_view` for the layout of the words and the interop with the device bitset.
+ *
+ * @tparam bitset_t Underlying type of the bitset array. Default is uint32_t.
+ * @tparam index_t Indexing type used. Default is uint32_t.
+ */
+template <typename bitset_t = uint32_t, typename index_t = uint32_t>
+struct host_bitset {
+  static constexpr index_t bitset_element_size = sizeof(bitset_t) * 8;
+
+  /**
+   * @brief Construct a new bitset object with a list of indices to unset.
+   *
+   * @param res RAFT resources
+   * @param mask_index List of indices to unset in the bitset
+   * @param bitset_len Length of the bitset
+   * @param default_value Default value to set the bits to. Default is true.
+   */
+  host_bitset(const raft::resources& res,
+              raft::host_vector_view<const index_t, index_t> mask_index,
+              index_t bitset_len,
+              bool default_value = true)
+    : host_bitset(res, bitset_len, default_value)
+  {
+    set(res, mask_index, !default_value);
+  }
+  /**
+   * @brief Construct a new bitset object
+   *
+   * @param res RAFT resources
+   * @param bitset_len Length of the bitset
+   * @param default_value Default value to set the bits to. Default is true.
+   */
+  host_bitset(const raft::resources& res, index_t bitset_len, bool default_value = true)
+    : bitset_{raft::make_host_vector<bitset_t, index_t>(
+        raft::div_rounding_up_safe(bitset_len, bitset_element_size))},
+      bitset_len_{bitset_len}
+  {
+    reset(res, default_value);
+  }
+  // Disable copy constructor
+  host_bitset(const host_bitset&)            = delete;
+  host_bitset(host_bitset&&)                 = default;
+  host_bitset& operator=(const host_bitset&) = delete;
+  host_bitset& operator=(host_bitset&&)      = default;
+
+  inline auto view() -> host_bitset_view<bitset_t, index_t>
+  {
+    return host_bitset_view<bitset_t, index_t>(bitset_.data_handle(), bitset_len_);
+  }
+  [[nodiscard]] inline auto view() const -> host_bitset_view<const bitset_t, index_t>
+  {
+    return host_bitset_view<const bitset_t, index_t>(bitset_.data_handle(), bitset_len_);
+  }
+
+  /** @brief Get the host pointer to the bitset. */
+  inline auto data() -> bitset_t* { return bitset_.data_handle(); }
+  inline auto data() const -> const bitset_t* { return bitset_.data_handle(); }
+  /** @brief Get the number of bits of the bitset representation. */
+  inline auto size() const -> index_t { return bitset_len_; }
+  /** @brief Get the number of elements used by the bitset representation. */
+  inline auto n_elements() const -> index_t
+  {
+    return raft::div_rounding_up_safe(bitset_len_, bitset_element_size);
+  }
+  /** @brief Get an mdspan view of the current bitset */
+  inline auto to_mdspan() -> raft::host_vector_view<bitset_t, index_t> { return bitset_.view(); }
+  [[nodiscard]] inline auto to_mdspan() const -> raft::host_vector_view<const bitset_t, index_t>
+  {
+    return raft::make_host_vector_view<const bitset_t, index_t>(bitset_.data_handle(),
+                                                                n_elements());
+  }
+
+  /** @brief Resize the bitset. If the requested size is larger, the new bits are set to the
+   * default value.
+   * @param res RAFT resources
+   * @param new_bitset_len new size of the bitset
+   * @param default_value default value to initialize the new bits to
+   */
+  void resize(const raft::resources& res, index_t new_bitset_len, bool default_value = true)
+  {
+    auto new_size = raft::div_rounding_up_safe(new_bitset_len, bitset_element_size);
+    if (new_bitset_len > bitset_len_ && bitset_len_ % bitset_element_size != 0) {
+      // The bits of the last word past the old size are not defined
+      auto tail = detail::host_word_mask<bitset_t>(uint32_t(bitset_len_ % bitset_element_size),
+                                                   bitset_element_size);
+      auto& word = bitset_.data_handle()[n_elements() - 1];
+      word       = default_value ? bitset_t(word | tail) : bitset_t(word & ~tail);
+    }
+    if (new_size != n_elements()) {
+      auto new_bitset = raft::make_host_vector<bitset_t, index_t>(new_size);
+      auto n_copy     = std::min(new_size, n_elements());
+      std::copy_n(bitset_.data_handle(), n_copy, new_bitset.data_handle());
+      std::fill_n(new_bitset.data_handle() + n_copy,
+                  new_size - n_copy,
+                  default_value ? ~bitset_t{0} : bitset_t{0});
+      bitset_ = std::move(new_bitset);
+    }
+    bitset_len_ = new_bitset_len;
+  }
+
+  /**
+   * @brief Test a list of indices in a bitset.
+   *
+   * @tparam output_t Output type of the test. Default is bool.
+   * @param res RAFT resources
+   * @param queries List of indices to test
+   * @param output List of outputs
+   */
+  template <typename output_t = bool>
+  void test(const raft::resources& res,
+            raft::host_vector_view<const index_t, index_t> queries,
+            raft::host_vector_view<output_t, index_t> output) const
+  {
+    RAFT_EXPECTS(output.extent(0) == queries.extent(0), "Output and queries must be same size");
+    auto v = view();
+    for (index_t i = 0; i < queries.extent(0); i++) {
+      output(i) = output_t(v.test(queries(i)));
+    }
+  }
+  /**
+   * @brief Set a list of indices in a bitset to set_value.
+   *
+   * @param res RAFT resources
+   * @param mask_index indices to remove from the bitset
+   * @param set_value Value to set the bits to (true or false)
+   */
+  void set(const raft::resources& res,
+           raft::host_vector_view<const index_t, index_t> mask_index,
+           bool set_value = false)
+  {
+    auto v = view();
+    for (index_t i = 0; i < mask_index.extent(0); i++) {
+      v.set(mask_index(i), set_value);
+    }
+  }
+  /**
+   * @brief Flip all the bits in a bitset.
+   * @param res RAFT resources
+   */
+  void flip(const raft::resources& res) { view().flip(); }
+  /**
+   * @brief Reset the bits in a bitset.
+   *
+   * @param res RAFT resources
+   * @param default_value Value to set the bits to (true or false)
+   */
+  void reset(const raft::resources& res, bool default_value = true)
+  {
+    view().reset(default_value);
+  }
+  /**
+   * @brief Returns the number of bits set to true.
+   *
+   * @param res RAFT resources
+   * @return index_t Number of bits set to true
+   */
+  auto count(const raft::resources& res) const -> index_t { return view().count(); }
+  /**
+   * @brief Checks if any of the bits are set to true in the bitset.
+   * @param res RAFT resources
+   */
+  bool any(const raft::resources& res) const { return count(res) > 0; }
+  /**
+   * @brief Checks if all of the bits are set to true in the bitset.
+   * @param res RAFT resources
+   */
+  bool all(const raft::resources& res) const { return count(res) == bitset_len_; }
+  /**
+   * @brief Checks if none of the bits are set to true in the bitset.
+   * @param res RAFT resources
+   */
+  bool none(const raft::resources& res) const { return count(res) == 0; }
+
+ private:
+  raft::host_vector<bitset_t, index_t> bitset_;
+  index_t bitset_len_;
+};
+
+/**
+ * @brief Rank and select queries over a host bitset.
+ *
+ * Keeps the number of the set bits preceding every block of 512 bits, so that `rank` reads at most
+ * one block of words and `select` binary-searches the blocks and reads one block. The structure
+ * takes `n_bits / 512 * sizeof(index_t)` bytes, and is invalidated by the changes of the bitset.
+ *
+ * @code{.cpp}
+ * auto rs = raft::core::host_bitset_rank_select<uint32_t, int64_t>(filter.view());
+ * // the position of a sample among the samples passing the filter
+ * auto compact_ix = rs.rank(sample_ix);
+ * // and back
+ * auto sample_ix2 = rs.select(compact_ix);
+ * @endcode
+ *
+ * @tparam bitset_t Underlying type of the bitset array.
+ * @tparam index_t Indexing type used.
+ */
+template <typename bitset_t = uint32_t, typename index_t = uint32_t>
+struct host_bitset_rank_select {
+  using word_type                     = std::remove_const_t<bitset_t>;
+  static constexpr index_t kBlockBits = 512;
+  static constexpr index_t kBlockWords =
+    std::max<index_t>(1, kBlockBits / (sizeof(word_type) * 8));
+
+  template <typename view_bitset_t>
+  explicit host_bitset_rank_select(host_bitset_view<view_bitset_t, index_t> bitset)
+    : bitset_{bitset.as_const()}
+  {
+    index_t n_words  = bitset_.n_elements();
+    index_t n_blocks = raft::div_rounding_up_safe(n_words, kBlockWords);
+    block_ranks_.resize(n_blocks + 1);
+    block_ranks_[0] = 0;
+    for (index_t b = 0; b < n_blocks; b++) {
+      index_t begin = b * kBlockWords * index_t(sizeof(word_type) * 8);
+      index_t end   = std::min<index_t>(begin + kBlockBits, bitset_.size());
+      block_ranks_[b + 1] = block_ranks_[b] + bitset_.count(begin, end);
+    }
+  }
+
+  /** @brief The number of bits set to true. */
+  [[nodiscard]] auto count() const -> index_t { return block_ranks_.back(); }
+
+  /** @brief The number of bits set to true in [0, sample_index), `sample_index <= size()`. */
+  [[nodiscard]] auto rank(index_t sample_index) const -> index_t
+  {
+    index_t block = sample_index / kBlockBits;
+    return block_ranks_[block] + bitset_.count(block * kBlockBits, sample_index);
+  }
+
+  /**
+   * @brief The index of the set bit of rank `r` (0-based): `rank(select(r)) == r`.
+   * `r` must be less than `count()`.
+   */
+  [[nodiscard]] auto select(index_t r) const -> index_t
+  {
+    RAFT_EXPECTS(r < count(), "The rank is out of the range of the set bits");
+    // The last block whose rank is not greater than `r`
+    auto it    = std::upper_bound(block_ranks_.begin(), block_ranks_.end(), r);
+    auto block = index_t(it - block_ranks_.begin()) - 1;
+    r -= block_ranks_[block];
+    constexpr index_t nbits = sizeof(word_type) * 8;
+    const word_type* words  = bitset_.data();
+    index_t word_ix         = block * kBlockWords;
+    index_t end_bit         = bitset_.size();
+    for (;; word_ix++) {
+      word_type w = words[word_ix];
+      if ((word_ix + 1) * nbits > end_bit) {
+        w &= detail::host_word_mask<word_type>(0, uint32_t(end_bit - word_ix * nbits));
+      }
+      auto c = detail::host_popc(w);
+      if (r < c) { return word_ix * nbits + detail::host_select_in_word(w, uint32_t(r)); }
+      r -= c;
+    }
+  }
+
+ private:
+  host_bitset_view<const word_type, index_t> bitset_;
+  std::vector<index_t> block_ranks_;
+};
+
+template <typename bitset_t, typename index_t>
+template <typename csr_matrix_t>
+void host_bitset_view<bitset_t, index_t>::to_csr(const raft::resources& res,
+                                                 csr_matrix_t& csr) const
+{
+  static_assert(raft::is_host_csr_matrix_v<csr_matrix_t>, "The CSR matrix must be on the host");
+  using indptr_t  = typename csr_matrix_t::indptr_type;
+  using indices_t = typename csr_matrix_t::indices_type;
+  using value_t   = typename csr_matrix_t::element_type;
+
+  auto structure = csr.structure_view();
+  auto n_rows    = structure.get_n_rows();
+  RAFT_EXPECTS(index_t(structure.get_n_cols()) == bitset_len_,
+               "The number of columns of the CSR matrix must be the size of the bitset");
+  auto row_nnz = count();
+  auto nnz     = size_t(row_nnz) * size_t(n_rows);
+  if constexpr (raft::is_host_csr_sparsity_owning_v<csr_matrix_t>) {
+    csr.initialize_sparsity(nnz);
+    structure = csr.structure_view();
+  } else {
+    RAFT_EXPECTS(size_t(structure.get_nnz()) == nnz,
+                 "The number of non-zeros of the CSR matrix must be count() * n_rows");
+  }
+
+  indptr_t* indptr   = structure.get_indptr().data();
+  indices_t* indices = structure.get_indices().data();
+  value_t* values    = csr.get_elements().data();
+  size_t pos         = 0;
+  for_each_set(0, bitset_len_, [&](index_t ix) { indices[pos++] = indices_t(ix); });
+  for (decltype(n_rows) row = 0; row <= n_rows; row++) {
+    indptr[row] = indptr_t(size_t(row) * row_nnz);
+  }
+  for (decltype(n_rows) row = 1; row < n_rows; row++) {
+    std::copy_n(indices, row_nnz, indices + size_t(row) * row_nnz);
+  }
+  std::fill_n(values, nnz, value_t(1));
+}
+
+template <typename bitset_t, typename index_t>
+template <typename csr_matrix_t>
+void host_bitset_view<bitset_t, index_t>::from_csr(const raft::resources& res,
+                                                   csr_matrix_t& csr) const
+{
+  auto structure = csr.structure_view();
+  RAFT_EXPECTS(index_t(structure.get_n_cols()) == bitset_len_,
+               "The number of columns of the CSR matrix must be the size of the bitset");
+  reset(false);
+  const auto* indices = structure.get_indices().data();
+  auto nnz            = size_t(structure.get_nnz());
+  for (size_t i = 0; i < nnz; i++) {
+    set(index_t(indices[i]), true);
+  }
+}
+
+/** @} */
+}  // end namespace raft::core
@@ -0,0 +1,531 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <raft/core/error.hpp>
+#include <raft/util/integer_utils.hpp>
+
+#include <fcntl.h>
+#include <omp.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/*
+ * The IVF index container: the file format of the host IVF indexes.
+ *
+ *   [header][table of contents][section 0][section 1]...
+ *
+ * The table of contents lists the typed sections (`container_section`) of the file with their
+ * offsets and sizes. A reader looks up the sections it needs by id and ignores the others, so new
+ * sections can be added without breaking the existing readers. The scalar parameters of an index
+ * are stored in the params section as a sequence of (key, size, value) records; a reader ignores
+ * the unknown keys and uses a default value for the missing ones, so new parameters can be added
+ * the same way. `kContainerVersion` is only bumped for changes the existing readers can't skip.
+ *
+ * Every list is stored in the list data section at a page-aligned offset recorded in the list
+ * directory, so that the lists are written and read in parallel and can be mapped into memory one
+ * by one. The values are stored in little-endian byte order.
+ */
+namespace raft::neighbors::ivf::detail {
+
+static_assert(__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__,
+              "The IVF index container is only supported on little-endian platforms.");
+
+constexpr char kContainerMagic[8]          = {'R', 'A', 'F', 'T', 'I', 'V', 'F', '\0'};
+constexpr uint32_t kContainerVersion       = 1;
+constexpr uint64_t kContainerAlignment     = 64;
+constexpr uint64_t kContainerListAlignment = 4096;
+
+/** The ids of the sections; a section id is never reused for a different content. */
+enum class container_section : uint32_t {
+  kParams         = 1,
+  kCenters        = 2,
+  kCenterNorms    = 3,
+  kPqCenters      = 4,
+  kCentersRot     = 5,
+  kRotationMatrix = 6,
+  kListDirectory  = 7,
+  kListData       = 8,
+};
+
+/** The keys of the index parameters; a key is never reused for a different parameter. */
+enum class container_param : uint32_t {
+  kIndexKind                    = 1,
+  kDtype                        = 2,
+  kIndexDtype                   = 3,
+  kSize                         = 4,
+  kDim                          = 5,
+  kNLists                       = 6,
+  kMetric                       = 7,
+  kAdaptiveCenters              = 8,
+  kConservativeMemoryAllocation = 9,
+  kPqBits                       = 10,
+  kPqDim                        = 11,
+  kCodebookKind                 = 12,
+};
+
+struct container_header {
+  char magic[8];
+  uint32_t version;
+  /** Size of the header; a reader skips the fields added by the newer writers. */
+  uint32_t header_size;
+  uint64_t toc_offset;
+  uint32_t n_sections;
+  /** Size of a table of contents entry, see `header_size`. */
+  uint32_t toc_entry_size;
+  uint8_t reserved[32];
+};
+
+struct container_toc_entry {
+  uint32_t id;
+  uint32_t reserved;
+  uint64_t offset;
+  uint64_t size;
+};
+
+/** A list of the list directory; the directory is prefixed with the number of lists and the size
+ * of an entry (both `uint32_t`). */
+struct container_list_entry {
+  uint64_t data_offset;
+  uint64_t data_size;
+  uint64_t indices_offset;
+  uint64_t indices_size;
+  uint32_t size;
+  uint32_t reserved;
+};
+
+static_assert(sizeof(container_header) == 64);
+static_assert(sizeof(container_toc_entry) == 24);
+static_assert(sizeof(container_list_entry) == 40);
+
+/** The scalar parameters of an index, see `container_param`. */
+class container_params {
+ public:
+  template <typename T>
+  void set(container_param key, const T& value)
+  {
+    static_assert(std::is_trivially_copyable_v<T>);
+    auto& bytes = records_[key];
+    bytes.resize(sizeof(T));
+    std::memcpy(bytes.data(), &value, sizeof(T));
+  }
+  void set(container_param key, const std::string& value)
+  {
+    records_[key].assign(value.begin(), value.end());
+  }
+
+  /** The value of a parameter, or `default_value` if the index was written without it. */
+  template <typename T>
+  auto get(container_param key, const T& default_value) const -> T
+  {
+    auto it = records_.find(key);
+    if (it == records_.end()) { return default_value; }
+    RAFT_EXPECTS(it->second.size() == sizeof(T),
+                 "Index container: unexpected size of the parameter %u",
+                 static_cast<uint32_t>(key));
+    T value;
+    std::memcpy(&value, it->second.data(), sizeof(T));
+    return value;
+  }
+  /** The value of a required parameter. */
+  template <typename T>
+  auto get(container_param key) const -> T
+  {
+    RAFT_EXPECTS(records_.count(key) > 0,
+                 "Index container: missing parameter %u",
+                 static_cast<uint32_t>(key));
+    return get<T>(key, T{});
+  }
+  auto get_string(container_param key) const -> std::string
+  {
+    auto it = records_.find(key);
+    return it == records_.end() ? std::string{} : std::string(it->second.begin(), it->second.end());
+  }
+
+  /** Records: [uint32_t key, uint32_t size, size bytes of value]... */
+  [[nodiscard]] auto encode() const -> std::vector<uint8_t>
+  {
+    std::vector<uint8_t> out;
+    for (const auto& [key, bytes] : records_) {
+      uint32_t header[2] = {static_cast<uint32_t>(key), static_cast<uint32_t>(bytes.size())};
+      auto* p            = reinterpret_cast<const uint8_t*>(header);
+      out.insert(out.end(), p, p + sizeof(header));
+      out.insert(out.end(), bytes.begin(), bytes.end());
+    }
+    return out;
+  }
+  static auto decode(const std::vector<uint8_t>& in) -> container_params
+  {
+    container_params params;
+    size_t pos = 0;
+    while (pos < in.size()) {
+      uint32_t header[2];
+      RAFT_EXPECTS(pos + sizeof(header) <= in.size(), "Index container: truncated parameters");
+      std::memcpy(header, in.data() + pos, sizeof(header));
+      pos += sizeof(header);
+      RAFT_EXPECTS(pos + header[1] <= in.size(), "Index container: truncated parameters");
+      params.records_[static_cast<container_param>(header[0])].assign(
+        in.begin() + pos, in.begin() + pos + header[1]);
+      pos += header[1];
+    }
+    return params;
+  }
+
+ private:
+  std::map<container_param, std::vector<uint8_t>> records_;
+};
+
+/** A section of an index container being written. */
+struct container_array {
+  container_section id;
+  const void* data;
+  uint64_t size;
+};
+
+/** A list of an index container being written. */
+struct container_list {
+  const void* data;
+  uint64_t data_size;
+  const void* indices;
+  uint64_t indices_size;
+  uint32_t size;
+};
+
+inline void container_pwrite(int fd, const void* data, uint64_t size, uint64_t offset)
+{
+  auto* p = static_cast<const char*>(data);
+  while (size > 0) {
+    ssize_t n = ::pwrite(fd, p, size, offset);
+    if (n < 0 && errno == EINTR) { continue; }
+    RAFT_EXPECTS(n > 0, "Index container: write failed (%s)", std::strerror(errno));
+    p += n;
+    size -= n;
+    offset += n;
+  }
+}
+
+inline void container_pread(int fd, void* data, uint64_t size, uint64_t offset)
+{
+  auto* p = static_cast<char*>(data);
+  while (size > 0) {
+    ssize_t n = ::pread(fd, p, size, offset);
+    if (n < 0 && errno == EINTR) { continue; }
+    RAFT_EXPECTS(n > 0, "Index container: read failed (%s)", std::strerror(errno));
+    p += n;
+    size -= n;
+    offset += n;
+  }
+}
+
+/**
+ * Run `f(label)` for all the lists on `n_threads` threads (0 means `omp_get_max_threads()`).
+ * The first exception thrown by `f` is rethrown after the loop.
+ */
+template <typename F>
+void container_for_each_list(uint32_t n_lists, int n_threads, F f)
+{
+  if (n_threads <= 0) { n_threads = omp_get_max_threads(); }
+  std::exception_ptr error = nullptr;
+#pragma omp parallel for schedule(dynamic) num_threads(n_threads)
+  for (uint32_t label = 0; label < n_lists; label++) {
+    try {
+      f(label);
+    } catch (...) {
+#pragma omp critical(raft_ivf_container)
+      if (!error) { error = std::current_exception(); }
+    }
+  }
+  if (error) { std::rethrow_exception(error); }
+}
+
+/**
+ * Write an index container: the params, the arrays as sections and the lists.
+ *
+ * The layout is computed up front, so that the lists are written concurrently by `n_threads`
+ * threads (0 means `omp_get_max_threads()`), each list at its own offset.
+ */
+inline void write_container(const std::string& filename,
+                            const container_params& params,
+                            const std::vector<container_array>& arrays,
+                            const std::vector<container_list>& lists,
+                            int n_threads)
+{
+  auto params_bytes = params.encode();
+  uint32_t n_lists  = lists.size();
+  std::vector<uint8_t> directory(2 * sizeof(uint32_t) + n_lists * sizeof(container_list_entry));
+  uint32_t directory_header[2] = {n_lists, sizeof(container_list_entry)};
+  std::memcpy(directory.data(), directory_header, sizeof(directory_header));
+
+  std::vector<container_array> sections;
+  sections.push_back({container_section::kParams, params_bytes.data(), params_bytes.size()});
+  sections.insert(sections.end(), arrays.begin(), arrays.end());
+  sections.push_back({container_section::kListDirectory, directory.data(), directory.size()});
+
+  // The layout: the header, the table of contents, the sections, then the lists
+  std::vector<container_toc_entry> toc(sections.size() + 1);
+  uint64_t offset = sizeof(container_header) + toc.size() * sizeof(container_toc_entry);
+  for (size_t i = 0; i < sections.size(); i++) {
+    offset = raft::round_up_safe(offset, kContainerAlignment);
+    toc[i] = {static_cast<uint32_t>(sections[i].id), 0, offset, sections[i].size};
+    offset += sections[i].size;
+  }
+  uint64_t lists_offset = raft::round_up_safe(offset, kContainerListAlignment);
+  offset                = lists_offset;
+  auto* entries =
+    reinterpret_cast<container_list_entry*>(directory.data() + sizeof(directory_header));
+  for (uint32_t label = 0; label < n_lists; label++) {
+    auto& entry   = entries[label];
+    const auto& l = lists[label];
+    entry         = {};
+    entry.size    = l.size;
+    if (l.size == 0) { continue; }
+    entry.data_offset    = raft::round_up_safe(offset, kContainerListAlignment);
+    entry.data_size      = l.data_size;
+    entry.indices_offset =
+      raft::round_up_safe(entry.data_offset + l.data_size, kContainerAlignment);
+    entry.indices_size   = l.indices_size;
+    offset               = entry.indices_offset + l.indices_size;
+  }
+  toc.back() = {
+    static_cast<uint32_t>(container_section::kListData), 0, lists_offset, offset - lists_offset};
+
+  container_header header{};
+  std::memcpy(header.magic, kContainerMagic, sizeof(kContainerMagic));
+  header.version        = kContainerVersion;
+  header.header_size    = sizeof(container_header);
+  header.toc_offset     = sizeof(container_header);
+  header.n_sections     = toc.size();
+  header.toc_entry_size = sizeof(container_toc_entry);
+
+  int fd = ::open(filename.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  RAFT_EXPECTS(fd >= 0, "Cannot open file %s (%s)", filename.c_str(), std::strerror(errno));
+  std::unique_ptr<int, void (*)(int*)> fd_guard(&fd, [](int* f) { ::close(*f); });
+  // Allocate the file up front; the padding between the lists stays sparse
+  RAFT_EXPECTS(::ftruncate(fd, offset) == 0,
+               "Index container: cannot resize the file (%s)",
+               std::strerror(errno));
+  container_pwrite(fd, &header, sizeof(header), 0);
+  container_pwrite(fd, toc.data(), toc.size() * sizeof(container_toc_entry), header.toc_offset);
+  for (size_t i = 0; i < sections.size(); i++) {
+    container_pwrite(fd, sections[i].data, sections[i].size, toc[i].offset);
+  }
+  container_for_each_list(n_lists, n_threads, [&](uint32_t label) {
+    if (entries[label].size == 0) { return; }
+    container_pwrite(fd, lists[label].data, entries[label].data_size, entries[label].data_offset);
+    container_pwrite(
+      fd, lists[label].indices, entries[label].indices_size, entries[label].indices_offset);
+  });
+}
+
+/** Whether the range [offset, offset + size) lies within a file of `file_size` bytes. */
+constexpr auto container_in_file(uint64_t offset, uint64_t size, uint64_t file_size) -> bool
+{
+  return offset <= file_size && size <= file_size - offset;
+}
+
+/** Whether the file is an index container (rather than a stream of `ivf_*::serialize`). */
+inline auto is_container(const std::string& filename) -> bool
+{
+  int fd = ::open(filename.c_str(), O_RDONLY);
+  if (fd < 0) { return false; }
+  char magic[sizeof(kContainerMagic)] = {};
+  bool ok = ::pread(fd, magic, sizeof(magic), 0) == ssize_t(sizeof(magic)) &&
+            std::memcmp(magic, kContainerMagic, sizeof(magic)) == 0;
+  ::close(fd);
+  return ok;
+}
+
+/**
+ * A copy-on-write mapping of a whole file; the pages are read on first access. The lists viewing it
+ * are as writable as the lists owning their arrays, but the writes never reach the file.
+ */
+class container_mapping {
+ public:
+  container_mapping(int fd, uint64_t size) : size_{size}
+  {
+    // Private and writable, so that the views of the lists can't modify the file
+    void* ptr = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    RAFT_EXPECTS(ptr != MAP_FAILED, "Index container: mmap failed (%s)", std::strerror(errno));
+    data_ = static_cast<uint8_t*>(ptr);
+  }
+  container_mapping(const container_mapping&)                    = delete;
+  auto operator=(const container_mapping&) -> container_mapping& = delete;
+  ~container_mapping() { ::munmap(data_, size_); }
+
+  [[nodiscard]] auto data() const noexcept -> uint8_t* { return data_; }
+  [[nodiscard]] auto size() const noexcept -> uint64_t { return size_; }
+
+ private:
+  uint8_t* data_;
+  uint64_t size_;
+};
+
+/**
+ * Reader of an index container: reads the header, the table of contents, the params and the list
+ * directory on construction; the other sections and the lists are read on demand.
+ * `read_list` may be called concurrently.
+ */
+class container_reader {
+ public:
+  explicit container_reader(const std::string& filename)
+    : fd_{::open(filename.c_str(), O_RDONLY)}
+  {
+    RAFT_EXPECTS(fd_ >= 0, "Cannot open file %s (%s)", filename.c_str(), std::strerror(errno));
+    // The destructor doesn't run if the constructor throws
+    try {
+      read_metadata(filename);
+    } catch (...) {
+      ::close(fd_);
+      throw;
+    }
+  }
+  container_reader(const container_reader&)                    = delete;
+  auto operator=(const container_reader&) -> container_reader& = delete;
+  ~container_reader() { ::close(fd_); }
+
+  [[nodiscard]] auto params() const noexcept -> const container_params& { return params_; }
+  [[nodiscard]] auto n_lists() const noexcept -> uint32_t { return lists_.size(); }
+  [[nodiscard]] auto list(uint32_t label) const -> const container_list_entry&
+  {
+    return lists_[label];
+  }
+
+  /** The size of a section, if it is present in the file. */
+  [[nodiscard]] auto section_size(container_section id) const -> std::optional<uint64_t>
+  {
+    auto it = toc_.find(id);
+    if (it == toc_.end()) { return std::nullopt; }
+    return it->second.size;
+  }
+
+  /** Read a section of the expected size into `dst`. */
+  void read_section(container_section id, void* dst, uint64_t size) const
+  {
+    auto it = toc_.find(id);
+    RAFT_EXPECTS(it != toc_.end(),
+                 "Index container: missing section %u",
+                 static_cast<uint32_t>(id));
+    RAFT_EXPECTS(it->second.size == size,
+                 "Index container: unexpected size of the section %u (%zu vs %zu bytes)",
+                 static_cast<uint32_t>(id),
+                 size_t(it->second.size),
+                 size_t(size));
+    container_pread(fd_, dst, size, it->second.offset);
+  }
+  [[nodiscard]] auto read_section(container_section id) const -> std::vector<uint8_t>
+  {
+    std::vector<uint8_t> out(section_size(id).value_or(0));
+    read_section(id, out.data(), out.size());
+    return out;
+  }
+
+  /** Read the data and the indices of a list. */
+  void read_list(uint32_t label, void* data, void* indices) const
+  {
+    const auto& l = lists_[label];
+    container_pread(fd_, data, l.data_size, l.data_offset);
+    container_pread(fd_, indices, l.indices_size, l.indices_offset);
+  }
+
+  /** Map the whole file into memory. */
+  [[nodiscard]] auto map() const -> std::shared_ptr<container_mapping>
+  {
+    return std::make_shared<container_mapping>(fd_, file_size_);
+  }
+
+ private:
+  int fd_;
+  uint64_t file_size_;
+  std::map<container_section, container_toc_entry> toc_;
+  container_params params_;
+  std::vector<container_list_entry> lists_;
+
+  /** Read and check the header, the table of contents, the params and the list directory. */
+  void read_metadata(const std::string& filename)
+  {
+    struct stat st;
+    RAFT_EXPECTS(::fstat(fd_, &st) == 0, "Cannot stat file %s", filename.c_str());
+    file_size_ = st.st_size;
+
+    container_header header{};
+    RAFT_EXPECTS(file_size_ >= sizeof(header), "Index container: file %s is truncated",
+                 filename.c_str());
+    container_pread(fd_, &header, sizeof(header), 0);
+    RAFT_EXPECTS(std::memcmp(header.magic, kContainerMagic, sizeof(kContainerMagic)) == 0,
+                 "File %s is not an index container",
+                 filename.c_str());
+    RAFT_EXPECTS(header.version <= kContainerVersion,
+                 "Index container: unsupported version %u (expected at most %u)",
+                 header.version,
+                 kContainerVersion);
+    RAFT_EXPECTS(header.toc_entry_size >= sizeof(container_toc_entry) &&
+                   container_in_file(header.toc_offset,
+                                     uint64_t(header.n_sections) * header.toc_entry_size,
+                                     file_size_),
+                 "Index container: corrupted table of contents");
+
+    std::vector<uint8_t> toc(uint64_t(header.n_sections) * header.toc_entry_size);
+    container_pread(fd_, toc.data(), toc.size(), header.toc_offset);
+    for (uint32_t i = 0; i < header.n_sections; i++) {
+      container_toc_entry entry;
+      std::memcpy(&entry, toc.data() + uint64_t(i) * header.toc_entry_size, sizeof(entry));
+      RAFT_EXPECTS(container_in_file(entry.offset, entry.size, file_size_),
+                   "Index container: section %u is out of the file",
+                   entry.id);
+      toc_.emplace(static_cast<container_section>(entry.id), entry);
+    }
+
+    params_ = container_params::decode(read_section(container_section::kParams));
+
+    auto directory = read_section(container_section::kListDirectory);
+    uint32_t directory_header[2];
+    RAFT_EXPECTS(directory.size() >= sizeof(directory_header),
+                 "Index container: corrupted list directory");
+    std::memcpy(directory_header, directory.data(), sizeof(directory_header));
+    auto [n_lists, entry_size] = std::make_pair(directory_header[0], directory_header[1]);
+    RAFT_EXPECTS(entry_size >= sizeof(container_list_entry) &&
+                   directory.size() >= sizeof(directory_header) + uint64_t(n_lists) * entry_size,
+                 "Index container: corrupted list directory");
+    lists_.resize(n_lists);
+    for (uint32_t label = 0; label < n_lists; label++) {
+      std::memcpy(&lists_[label],
+                  directory.data() + sizeof(directory_header) + uint64_t(label) * entry_size,
+                  sizeof(container_list_entry));
+      const auto& l = lists_[label];
+      RAFT_EXPECTS(l.size == 0 || (container_in_file(l.data_offset, l.data_size, file_size_) &&
+                                   container_in_file(l.indices_offset, l.indices_size, file_size_)),
+                   "Index container: list %u is out of the file",
+                   label);
+    }
+  }
+};
+
+}  // namespace raft::neighbors::ivf::detail
@@ -0,0 +1,367 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <raft/core/error.hpp>
+#include <raft/core/logger.hpp>
+#include <raft/core/nvtx.hpp>
+#include <raft/distance/distance_types.hpp>
+#include <raft/neighbors/detail/ivf_container.hpp>
+#include <raft/neighbors/detail/ivf_flat_host_search.hpp>
+#include <raft/neighbors/detail/ivf_flat_host_serialize.hpp>
+#include <raft/neighbors/detail/ivf_host_common.hpp>
+#include <raft/neighbors/ivf_flat_disk_types.hpp>
+#include <raft/neighbors/sample_filter_types.hpp>  // none_ivf_sample_filter
+
+#include <omp.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <future>
+#include <limits>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace raft::neighbors::ivf_flat::detail {
+
+template <typename T, typename IdxT>
+auto deserialize_disk(raft::resources const& handle,
+                      const std::string& filename,
+                      const ivf::list_cache_params& cache_params) -> disk_index<T, IdxT>
+{
+  RAFT_EXPECTS(ivf::detail::is_container(filename),
+               "Only the indexes saved with `serialize_host` can be searched from the disk");
+  auto reader  = std::make_unique<ivf::detail::container_reader>(filename);
+  auto centers = deserialize_container_centers<T, IdxT>(*reader, filename);
+  auto n_rows  = reader->params().template get<uint64_t>(ivf::detail::container_param::kSize);
+  disk_index<T, IdxT> index_(std::move(centers), std::move(reader), cache_params);
+  RAFT_EXPECTS(index_.size() == IdxT(n_rows), "Error inconsistent index size");
+
+  RAFT_LOG_DEBUG("Opened disk-resident IVF-Flat index, size %zu, dim %u",
+                 static_cast<size_t>(index_.size()),
+                 index_.dim());
+  return index_;
+}
+
+/**
+ * Split the probed lists of a batch into the chunks scanned at once: at most `budget` bytes of
+ * lists per chunk (or a single larger list), in the order of the labels, which is the order of the
+ * lists in the file.
+ */
+template <typename T, typename IdxT>
+void disk_make_chunks(const disk_index<T, IdxT>& index,
+                      const std::vector<uint32_t>& list_offsets,
+                      uint64_t budget,
+                      std::vector<std::vector<uint32_t>>& chunks)
+{
+  chunks.clear();
+  uint64_t chunk_bytes = 0;
+  for (uint32_t label = 0; label < index.n_lists(); label++) {
+    if (list_offsets[label + 1] == list_offsets[label] || index.list_sizes()(label) == 0) {
+      continue;
+    }
+    uint64_t bytes = index.list_bytes(label);
+    if (chunks.empty() || (chunk_bytes + bytes > budget && !chunks.back().empty())) {
+      chunks.emplace_back();
+      chunk_bytes = 0;
+    }
+    chunks.back().push_back(label);
+    chunk_bytes += bytes;
+  }
+}
+
+/**
+ * Read the lists of a chunk missing in the cache ahead of the search, in the order of the file.
+ * Returns the lists read (`nullptr` for the cached ones), which are pinned by the search even if
+ * they don't fit into the cache.
+ */
+template <typename T, typename IdxT>
+auto disk_readahead(const disk_index<T, IdxT>& index, const std::vector<uint32_t>& labels)
+  -> std::vector<std::shared_ptr<const host_list_data<T, IdxT>>>
+{
+  std::vector<std::shared_ptr<const host_list_data<T, IdxT>>> lists(labels.size());
+  for (size_t i = 0; i < labels.size(); i++) {
+    if (index.cache().contains(labels[i])) { continue; }
+    lists[i] = index.read_list(labels[i]);
+    index.cache().insert(labels[i], lists[i], index.list_bytes(labels[i]), true);
+  }
+  return lists;
+}
+
+/**
+ * Pin the lists of a chunk for scanning: take them from the cache and read the missing ones, which
+ * were not read ahead, with `n_threads` threads, in the order of the file.
+ */
+template <typename T, typename IdxT>
+void disk_acquire(const disk_index<T, IdxT>& index,
+                  const std::vector<uint32_t>& labels,
+                  int n_threads,
+                  std::vector<std::shared_ptr<const host_list_data<T, IdxT>>>& pinned,
+                  std::vector<const IdxT*>& inds_ptrs)
+{
+  std::vector<uint32_t> missing;
+  for (auto label : labels) {
+    auto cached = index.cache().get(label);
+    if (cached) { pinned[label] = std::move(cached); }
+    if (!pinned[label]) { missing.push_back(label); }
+  }
+  ivf::detail::container_for_each_list(missing.size(), n_threads, [&](uint32_t i) {
+    auto label    = missing[i];
+    pinned[label] = index.read_list(label);
+    index.cache().insert(label, pinned[label], index.list_bytes(label));
+  });
+  for (auto label : labels) {
+    inds_ptrs[label] = pinned[label]->indices.data_handle();
+  }
+}
+
+/**
+ * The search of a disk-resident index: the same scan as the in-memory search, over the lists of a
+ * batch pinned chunk by chunk.
+ *
+ * The probed lists of a batch of queries are gathered across the queries and sorted by the
+ * label, so that every probed list is read once per batch and the lists are read in the order of
+ * the file. The lists are scanned in chunks fitting into the list cache; while a chunk is
+ * scanned, the lists of the next one (or of the first chunk of the next batch, whose clusters are
+ * selected before scanning the current batch) are read in the background.
+ */
+template <uint32_t Veclen, typename DistT, typename T, typename IdxT, typename IvfSampleFilterT>
+void disk_search_impl(const disk_index<T, IdxT>& index,
+                      const T* queries,
+                      uint32_t n_queries,
+                      uint32_t k,
+                      uint32_t n_probes,
+                      int n_threads,
+                      uint32_t max_batch_size,
+                      IdxT* neighbors,
+                      float* distances,
+                      IvfSampleFilterT sample_filter)
+{
+  using list_type = host_list_data<T, IdxT>;
+
+  // The groups scanned by one task: about a million distance component evaluations
+  constexpr size_t kTaskSize = 1 << 20;
+
+  // A batch size heuristic: keep the per-thread heaps and the probes within the workspace size
+  uint64_t ws_size_per_query =
+    uint64_t(n_threads) * (k * (sizeof(float) + sizeof(IdxT)) + sizeof(uint32_t)) +
+    4 * sizeof(uint32_t) * n_probes;
+  const uint32_t max_queries =
+    ivf::detail::host_batch_size(n_queries, max_batch_size, ws_size_per_query);
+
+  const auto& cache_params = index.cache_params();
+  // With the readahead, one half of the cache holds the chunk being scanned and the other half the
+  // chunk being read
+  const uint64_t budget =
+    cache_params.readahead ? cache_params.capacity_bytes / 2 : cache_params.capacity_bytes;
+  const uint32_t dim     = index.dim();
+  const uint32_t n_lists = index.n_lists();
+
+  std::vector<uint32_t> probes(size_t(max_queries) * n_probes);
+  std::vector<uint32_t> list_offsets(n_lists + 1);
+  std::vector<uint32_t> list_queries(size_t(max_queries) * n_probes);
+  std::vector<std::vector<uint32_t>> chunks;
+  std::vector<uint32_t> next_probes(size_t(max_queries) * n_probes);
+  std::vector<uint32_t> next_list_offsets(n_lists + 1);
+  std::vector<uint32_t> next_list_queries(size_t(max_queries) * n_probes);
+  std::vector<std::vector<uint32_t>> next_chunks;
+  std::vector<float> heap_scores(size_t(n_threads) * max_queries * k);
+  std::vector<IdxT> heap_ids(size_t(n_threads) * max_queries * k);
+  std::vector<uint32_t> heap_sizes(size_t(n_threads) * max_queries);
+  std::vector<host_scan_task> tasks;
+  std::vector<std::shared_ptr<const list_type>> pinned(n_lists);
+  std::vector<const IdxT*> inds_ptrs(n_lists, nullptr);
+  // The labels outlive the pending readahead
+  std::vector<uint32_t> readahead_labels;
+  std::future<std::vector<std::shared_ptr<const list_type>>> readahead;
+
+  // The filters taking the source index of a sample see it through the indices of the pinned lists
+  auto filter = raft::neighbors::filtering::ivf_to_sample_filter(inds_ptrs.data(), sample_filter);
+
+  const auto metric        = index.metric();
+  const bool inner_product = metric == raft::distance::DistanceType::InnerProduct;
+  const bool take_sqrt     = metric == raft::distance::DistanceType::L2SqrtExpanded ||
+                         metric == raft::distance::DistanceType::L2SqrtUnexpanded;
+
+  // Select the clusters of a batch and split its probed lists into chunks
+  auto plan_batch = [&](uint32_t offset_q,
+                        std::vector<uint32_t>& batch_probes,
+                        std::vector<uint32_t>& batch_list_offsets,
+                        std::vector<uint32_t>& batch_list_queries,
+                        std::vector<std::vector<uint32_t>>& batch_chunks) {
+    uint32_t queries_batch = std::min(max_queries, n_queries - offset_q);
+#pragma omp parallel num_threads(n_threads)
+    host_select_clusters(index.resident(),
+                         queries + size_t(offset_q) * dim,
+                         queries_batch,
+                         n_probes,
+                         batch_probes.data());
+    ivf::detail::host_group_by_list(
+      batch_probes.data(), queries_batch, n_probes, batch_list_offsets, batch_list_queries);
+    disk_make_chunks(index, batch_list_offsets, budget, batch_chunks);
+  };
+
+  plan_batch(0, probes, list_offsets, list_queries, chunks);
+  for (uint32_t offset_q = 0; offset_q < n_queries; offset_q += max_queries) {
+    uint32_t queries_batch = std::min(max_queries, n_queries - offset_q);
+    const T* batch_queries = queries + size_t(offset_q) * dim;
+    next_chunks.clear();
+    if (offset_q + queries_batch < n_queries) {
+      plan_batch(
+        offset_q + queries_batch, next_probes, next_list_offsets, next_list_queries, next_chunks);
+    }
+    std::fill(heap_sizes.begin(), heap_sizes.end(), 0);
+
+    for (size_t chunk_ix = 0; chunk_ix < chunks.size(); chunk_ix++) {
+      if (readahead.valid()) {
+        auto lists = readahead.get();
+        for (size_t i = 0; i < lists.size(); i++) {
+          pinned[readahead_labels[i]] = std::move(lists[i]);
+        }
+      }
+      disk_acquire(index, chunks[chunk_ix], n_threads, pinned, inds_ptrs);
+      const auto* ahead = chunk_ix + 1 < chunks.size() ? &chunks[chunk_ix + 1]
+                          : next_chunks.empty()       ? nullptr
+                                                      : &next_chunks.front();
+      if (cache_params.readahead && ahead != nullptr) {
+        readahead_labels = *ahead;
+        readahead        = std::async(std::launch::async, [&index, &readahead_labels]() {
+          return disk_readahead(index, readahead_labels);
+        });
+      }
+
+      ivf::detail::host_make_scan_tasks(
+        [&pinned](uint32_t label) -> uint32_t { return pinned[label] ? pinned[label]->size : 0; },
+        n_lists,
+        kIndexGroupSize,
+        list_offsets,
+        [&](uint32_t n_list_queries) {
+          return kTaskSize / (size_t(kIndexGroupSize) * dim * n_list_queries);
+        },
+        tasks);
+#pragma omp parallel num_threads(n_threads)
+      host_scan_lists<Veclen, DistT>(
+        [&pinned](uint32_t label) -> const list_type& { return *pinned[label]; },
+        dim,
+        batch_queries,
+        queries_batch,
+        offset_q,
+        k,
+        tasks,
+        list_offsets,
+        list_queries,
+        heap_scores.data(),
+        heap_ids.data(),
+        heap_sizes.data(),
+        filter);
+
+      for (auto label : chunks[chunk_ix]) {
+        pinned[label].reset();
+        inds_ptrs[label] = nullptr;
+      }
+    }
+
+#pragma omp parallel num_threads(n_threads)
+    ivf::detail::host_merge_topk(
+      queries_batch,
+      k,
+      n_threads,
+      heap_scores.data(),
+      heap_ids.data(),
+      heap_sizes.data(),
+      neighbors + size_t(offset_q) * k,
+      distances + size_t(offset_q) * k,
+      inner_product ? std::numeric_limits<float>::lowest() : std::numeric_limits<float>::max(),
+      [inner_product, take_sqrt](float score) {
+        return inner_product ? -score : (take_sqrt ? std::sqrt(score) : score);
+      });
+
+    std::swap(probes, next_probes);
+    std::swap(list_offsets, next_list_offsets);
+    std::swap(list_queries, next_list_queries);
+    std::swap(chunks, next_chunks);
+  }
+  if (readahead.valid()) { readahead.get(); }
+}
+
+/** See raft::neighbors::ivf_flat::search (disk_index) docs */
+template <typename T,
+          typename IdxT,
+          typename IvfSampleFilterT = raft::neighbors::filtering::none_ivf_sample_filter>
+inline void search(const host_search_params& params,
+                   const disk_index<T, IdxT>& index,
+                   const T* queries,
+                   uint32_t n_queries,
+                   uint32_t k,
+                   IdxT* neighbors,
+                   float* distances,
+                   IvfSampleFilterT sample_filter = IvfSampleFilterT())
+{
+  common::nvtx::range<common::nvtx::domain::raft> fun_scope(
+    "ivf_flat::search_disk(k = %u, n_queries = %u, dim = %u)", k, n_queries, index.dim());
+
+  RAFT_EXPECTS(params.n_probes > 0,
+               "n_probes (number of clusters to probe in the search) must be positive.");
+  if (n_queries == 0 || k == 0) { return; }
+  auto n_probes = std::min<uint32_t>(params.n_probes, index.n_lists());
+  int n_threads = params.num_threads > 0 ? params.num_threads : omp_get_max_threads();
+
+  // Lift the `veclen` of the index to the template level (see `index::calculate_veclen`)
+  constexpr uint32_t kMaxVeclen = std::max<uint32_t>(1, 16 / sizeof(T));
+  auto search_with_dist         = [&](auto dist) {
+    using dist_t = decltype(dist);
+    if (index.veclen() == kMaxVeclen) {
+      disk_search_impl<kMaxVeclen, dist_t>(index,
+                                           queries,
+                                           n_queries,
+                                           k,
+                                           n_probes,
+                                           n_threads,
+                                           params.max_queries,
+                                           neighbors,
+                                           distances,
+                                           sample_filter);
+    } else {
+      RAFT_EXPECTS(index.veclen() == 1, "Unexpected veclen (%u)", index.veclen());
+      disk_search_impl<1, dist_t>(index,
+                                  queries,
+                                  n_queries,
+                                  k,
+                                  n_probes,
+                                  n_threads,
+                                  params.max_queries,
+                                  neighbors,
+                                  distances,
+                                  sample_filter);
+    }
+  };
+  switch (index.metric()) {
+    case raft::distance::DistanceType::L2Expanded:
+    case raft::distance::DistanceType::L2Unexpanded:
+    case raft::distance::DistanceType::L2SqrtExpanded:
+    case raft::distance::DistanceType::L2SqrtUnexpanded:
+      return search_with_dist(host_euclidean_dist{});
+    case raft::distance::DistanceType::InnerProduct:
+      return search_with_dist(host_inner_prod_dist{});
+    default: RAFT_FAIL("The chosen distance metric is not supported (%d)", int(index.metric()));
+  }
+}
+
+}  // namespace raft::neighbors::ivf_flat::detail
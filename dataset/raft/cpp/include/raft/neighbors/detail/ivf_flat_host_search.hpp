@@ -0,0 +1,474 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <raft/core/error.hpp>
+#include <raft/core/nvtx.hpp>
+#include <raft/distance/distance_types.hpp>
+#include <raft/neighbors/detail/ivf_host_common.hpp>
+#include <raft/neighbors/ivf_flat_host_types.hpp>
+#include <raft/neighbors/sample_filter_types.hpp>  // none_ivf_sample_filter
+#include <raft/util/integer_utils.hpp>
+
+#include <omp.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace raft::neighbors::ivf_flat::detail {
+
+using raft::neighbors::ivf::detail::host_scan_task;
+using raft::neighbors::ivf::detail::host_topk_push;
+
+/** The accumulator type of the list scan; the same as the device scan (`utils::config`). */
+template <typename T>
+struct host_scan_acc {
+  using type = float;
+};
+template <>
+struct host_scan_acc<int8_t> {
+  using type = int32_t;
+};
+template <>
+struct host_scan_acc<uint8_t> {
+  using type = uint32_t;
+};
+
+/**
+ * The scale of the integer data converted to float before the k-means, i.e. the scale of the
+ * queries compared to the cluster centers (see `utils::mapping<float>`).
+ */
+template <typename T>
+constexpr auto host_center_scale() -> float
+{
+  if constexpr (std::is_same_v<T, uint8_t>) {
+    return 1.0f / 256.0f;
+  } else if constexpr (std::is_same_v<T, int8_t>) {
+    return 1.0f / 128.0f;
+  } else {
+    return 1.0f;
+  }
+}
+
+/*
+ * The distance functors of the list scan; `score` converts the accumulated value to a score,
+ * the smaller the better.
+ */
+struct host_euclidean_dist {
+  template <typename AccT, typename T>
+  static inline auto eval(T x, T y) -> AccT
+  {
+    const auto diff = static_cast<AccT>(x) - static_cast<AccT>(y);
+    return diff * diff;
+  }
+  template <typename AccT>
+  static inline auto score(AccT acc) -> float
+  {
+    return static_cast<float>(acc);
+  }
+};
+
+struct host_inner_prod_dist {
+  template <typename AccT, typename T>
+  static inline auto eval(T x, T y) -> AccT
+  {
+    return static_cast<AccT>(x) * static_cast<AccT>(y);
+  }
+  template <typename AccT>
+  static inline auto score(AccT acc) -> float
+  {
+    return -static_cast<float>(acc);
+  }
+};
+
+/**
+ * The number of the lanes of the list scan, the width of a SIMD register of the accumulators.
+ * Must be a multiple of `Veclen`.
+ */
+template <uint32_t Veclen>
+constexpr uint32_t kHostScanLanes = std::max<uint32_t>(16, Veclen);
+
+/**
+ * Repeat every chunk of `Veclen` components of a query to the width of the scan lanes, i.e. lay
+ * out the query in the same way as a group of `kHostScanLanes / Veclen` interleaved records
+ * [dim / Veclen, kHostScanLanes].
+ */
+template <uint32_t Veclen, typename T>
+inline void host_expand_query(const T* query, uint32_t dim, T* query_lanes)
+{
+  constexpr uint32_t kLanes = kHostScanLanes<Veclen>;
+  for (uint32_t l = 0; l < dim; l += Veclen, query_lanes += kLanes) {
+    for (uint32_t i = 0; i < kLanes; i += Veclen) {
+      for (uint32_t j = 0; j < Veclen; j++) {
+        query_lanes[i + j] = query[l + j];
+      }
+    }
+  }
+}
+
+/**
+ * Compute the scores of a query against the `kIndexGroupSize` records of one interleaved group.
+ *
+ * The group is read in the order it is stored: the `l`-th chunk of the group holds the components
+ * [l, l + Veclen) of all records. With the query expanded by `host_expand_query`, the chunk is
+ * processed as a flat array of SIMD lanes without unpacking the records; the lanes of a record are
+ * summed up at the end.
+ */
+template <uint32_t Veclen, typename DistT, typename T>
+[[gnu::optimize(3), gnu::optimize("tree-vectorize")]] inline void host_group_scores(
+  const T* group, const T* query_lanes, uint32_t dim, float* scores)
+{
+  using acc_t                     = typename host_scan_acc<T>::type;
+  constexpr uint32_t kChunkLength = kIndexGroupSize * Veclen;
+  constexpr uint32_t kLanes       = kHostScanLanes<Veclen>;
+  static_assert(kChunkLength % kLanes == 0 && kLanes % Veclen == 0);
+
+  acc_t acc[kChunkLength];
+  std::fill(acc, acc + kChunkLength, acc_t{0});
+  for (uint32_t l = 0; l < dim; l += Veclen, group += kChunkLength, query_lanes += kLanes) {
+    for (uint32_t offset = 0; offset < kChunkLength; offset += kLanes) {
+      for (uint32_t i = 0; i < kLanes; i++) {
+        acc[offset + i] += DistT::template eval<acc_t>(query_lanes[i], group[offset + i]);
+      }
+    }
+  }
+  for (uint32_t r = 0; r < kIndexGroupSize; r++) {
+    acc_t sum = 0;
+    for (uint32_t j = 0; j < Veclen; j++) {
+      sum += acc[r * Veclen + j];
+    }
+    scores[r] = DistT::score(sum);
+  }
+}
+
+/**
+ * Select the `n_probes` closest clusters of every query.
+ *
+ * The centers are compared with a tile of queries at a time, so that every center is read once
+ * per tile. Must be called from within an OpenMP parallel region.
+ */
+template <typename T, typename IdxT>
+void host_select_clusters(const host_index<T, IdxT>& index,
+                          const T* queries,
+                          uint32_t n_queries,
+                          uint32_t n_probes,
+                          uint32_t* probes)
+{
+  constexpr uint32_t kQueryTile = 4;
+
+  const uint32_t dim     = index.dim();
+  const uint32_t n_lists = index.n_lists();
+  const float* centers   = index.centers().data_handle();
+  const float* norms =
+    index.center_norms().has_value() ? index.center_norms()->data_handle() : nullptr;
+  const bool inner_product = index.metric() == raft::distance::DistanceType::InnerProduct;
+  const uint32_t n_tiles   = raft::div_rounding_up_safe(n_queries, kQueryTile);
+
+  std::vector<float> tile_queries(kQueryTile * dim);
+  std::vector<float> scores(kQueryTile * n_lists);
+  std::vector<uint32_t> labels(n_lists);
+
+#pragma omp for schedule(dynamic)
+  for (uint32_t tile = 0; tile < n_tiles; tile++) {
+    uint32_t tile_begin = tile * kQueryTile;
+    uint32_t tile_size  = std::min(kQueryTile, n_queries - tile_begin);
+    for (uint32_t i = 0; i < tile_size * dim; i++) {
+      tile_queries[i] =
+        static_cast<float>(queries[size_t(tile_begin) * dim + i]) * host_center_scale<T>();
+    }
+    for (uint32_t label = 0; label < n_lists; label++) {
+      const float* center = centers + size_t(label) * dim;
+      for (uint32_t t = 0; t < tile_size; t++) {
+        const float* query = tile_queries.data() + t * dim;
+        float dot          = 0;
+#pragma omp simd reduction(+ : dot)
+        for (uint32_t j = 0; j < dim; j++) {
+          dot += query[j] * center[j];
+        }
+        // The query norm does not change the order of the clusters
+        scores[t * n_lists + label] = inner_product ? -dot : norms[label] - 2.0f * dot;
+      }
+    }
+    for (uint32_t t = 0; t < tile_size; t++) {
+      const float* query_scores = scores.data() + t * n_lists;
+      std::iota(labels.begin(), labels.end(), 0);
+      if (n_probes < n_lists) {
+        std::nth_element(
+          labels.begin(), labels.begin() + n_probes, labels.end(), [&](uint32_t a, uint32_t b) {
+            return query_scores[a] < query_scores[b];
+          });
+      }
+      std::copy(labels.begin(),
+                labels.begin() + n_probes,
+                probes + size_t(tile_begin + t) * n_probes);
+    }
+  }
+}
+
+/**
+ * Scan the probed lists group by group and collect the candidates in per-thread top-k heaps.
+ *
+ * Every task scans a range of the interleaved groups of one list for all the queries of the batch
+ * that probe the list, so that a group is loaded into the cache once per batch rather than once
+ * per query. The queries of a task are expanded once into the lane layout of the groups (see
+ * `host_expand_query`), so that the inner loop runs over contiguous memory on both sides.
+ * The heaps are filled on top of their current contents, so that the lists of a batch can be
+ * scanned in several calls. Must be called from within an OpenMP parallel region.
+ *
+ * @param lists the list of a label, `(uint32_t label) -> const host_list_data<T, IdxT>&`
+ */
+template <uint32_t Veclen,
+          typename DistT,
+          typename T,
+          typename IdxT,
+          typename ListsT,
+          typename IvfSampleFilterT>
+void host_scan_lists(ListsT lists,
+                     uint32_t dim,
+                     const T* queries,
+                     uint32_t n_queries,
+                     uint32_t queries_offset,
+                     uint32_t k,
+                     const std::vector<host_scan_task>& tasks,
+                     const std::vector<uint32_t>& list_offsets,
+                     const std::vector<uint32_t>& list_queries,
+                     float* heap_scores,
+                     IdxT* heap_ids,
+                     uint32_t* heap_sizes,
+                     IvfSampleFilterT sample_filter)
+{
+  const size_t query_lanes_len = size_t(dim / Veclen) * kHostScanLanes<Veclen>;
+  const size_t tid             = omp_get_thread_num();
+  heap_scores += tid * n_queries * k;
+  heap_ids += tid * n_queries * k;
+  heap_sizes += tid * n_queries;
+
+  std::vector<T> query_lanes;
+  float scores[kIndexGroupSize];
+#pragma omp for schedule(dynamic, 1)
+  for (size_t task_ix = 0; task_ix < tasks.size(); task_ix++) {
+    const auto& task            = tasks[task_ix];
+    const auto& list            = lists(task.label);
+    const uint32_t* task_queries = list_queries.data() + list_offsets[task.label];
+    uint32_t n_task_queries     = list_offsets[task.label + 1] - list_offsets[task.label];
+
+    query_lanes.resize(n_task_queries * query_lanes_len);
+    for (uint32_t i = 0; i < n_task_queries; i++) {
+      host_expand_query<Veclen>(queries + size_t(task_queries[i]) * dim,
+                                dim,
+                                query_lanes.data() + i * query_lanes_len);
+    }
+    for (uint32_t group_ix = task.group_begin; group_ix < task.group_end; group_ix++) {
+      const T* group      = list.data.data_handle() + size_t(group_ix) * kIndexGroupSize * dim;
+      uint32_t row_offset = group_ix * kIndexGroupSize;
+      uint32_t n_rows     = std::min(kIndexGroupSize, list.size - row_offset);
+      for (uint32_t i = 0; i < n_task_queries; i++) {
+        uint32_t query_ix = task_queries[i];
+        host_group_scores<Veclen, DistT>(
+          group, query_lanes.data() + i * query_lanes_len, dim, scores);
+
+        float* query_heap_scores = heap_scores + size_t(query_ix) * k;
+        IdxT* query_heap_ids     = heap_ids + size_t(query_ix) * k;
+        uint32_t& heap_size      = heap_sizes[query_ix];
+        float threshold =
+          heap_size < k ? std::numeric_limits<float>::infinity() : query_heap_scores[0];
+        for (uint32_t r = 0; r < n_rows; r++) {
+          if (!(scores[r] < threshold)) { continue; }
+          if (!sample_filter(queries_offset + query_ix, task.label, row_offset + r)) { continue; }
+          host_topk_push(query_heap_scores,
+                         query_heap_ids,
+                         heap_size,
+                         k,
+                         scores[r],
+                         list.indices(row_offset + r));
+          if (heap_size == k) { threshold = query_heap_scores[0]; }
+        }
+      }
+    }
+  }
+}
+
+template <uint32_t Veclen, typename DistT, typename T, typename IdxT, typename IvfSampleFilterT>
+void search_impl(const host_index<T, IdxT>& index,
+                 const T* queries,
+                 uint32_t n_queries,
+                 uint32_t k,
+                 uint32_t n_probes,
+                 int n_threads,
+                 uint32_t max_batch_size,
+                 IdxT* neighbors,
+                 float* distances,
+                 IvfSampleFilterT sample_filter)
+{
+  // The groups scanned by one task: about a million distance component evaluations
+  constexpr size_t kTaskSize = 1 << 20;
+
+  // A batch size heuristic: keep the per-thread heaps and the probes within the workspace size
+  uint64_t ws_size_per_query =
+    uint64_t(n_threads) * (k * (sizeof(float) + sizeof(IdxT)) + sizeof(uint32_t)) +
+    2 * sizeof(uint32_t) * n_probes;
+  const uint32_t max_queries =
+    ivf::detail::host_batch_size(n_queries, max_batch_size, ws_size_per_query);
+
+  std::vector<uint32_t> probes(size_t(max_queries) * n_probes);
+  std::vector<float> heap_scores(size_t(n_threads) * max_queries * k);
+  std::vector<IdxT> heap_ids(size_t(n_threads) * max_queries * k);
+  std::vector<uint32_t> heap_sizes(size_t(n_threads) * max_queries);
+  std::vector<uint32_t> list_offsets(index.n_lists() + 1);
+  std::vector<uint32_t> list_queries(size_t(max_queries) * n_probes);
+  std::vector<host_scan_task> tasks;
+
+  const auto metric        = index.metric();
+  const bool inner_product = metric == raft::distance::DistanceType::InnerProduct;
+  const bool take_sqrt     = metric == raft::distance::DistanceType::L2SqrtExpanded ||
+                         metric == raft::distance::DistanceType::L2SqrtUnexpanded;
+
+  for (uint32_t offset_q = 0; offset_q < n_queries; offset_q += max_queries) {
+    uint32_t queries_batch = std::min(max_queries, n_queries - offset_q);
+    const T* batch_queries = queries + size_t(offset_q) * index.dim();
+    uint32_t n_heaps       = 0;
+    std::fill(heap_sizes.begin(), heap_sizes.end(), 0);
+
+#pragma omp parallel num_threads(n_threads)
+    {
+      host_select_clusters(index, batch_queries, queries_batch, n_probes, probes.data());
+
+#pragma omp single
+      {
+        n_heaps = omp_get_num_threads();
+
+        ivf::detail::host_group_by_list(
+          probes.data(), queries_batch, n_probes, list_offsets, list_queries);
+        ivf::detail::host_make_scan_tasks(
+          index.list_sizes(),
+          index.n_lists(),
+          kIndexGroupSize,
+          list_offsets,
+          [&](uint32_t n_list_queries) {
+            return kTaskSize / (size_t(kIndexGroupSize) * index.dim() * n_list_queries);
+          },
+          tasks);
+      }
+
+      host_scan_lists<Veclen, DistT>(
+        [&index](uint32_t label) -> const host_list_data<T, IdxT>& {
+          return *index.lists()[label];
+        },
+        index.dim(),
+        batch_queries,
+        queries_batch,
+        offset_q,
+        k,
+        tasks,
+        list_offsets,
+        list_queries,
+        heap_scores.data(),
+        heap_ids.data(),
+        heap_sizes.data(),
+        sample_filter);
+
+      ivf::detail::host_merge_topk(
+        queries_batch,
+        k,
+        n_heaps,
+        heap_scores.data(),
+        heap_ids.data(),
+        heap_sizes.data(),
+        neighbors + size_t(offset_q) * k,
+        distances + size_t(offset_q) * k,
+        inner_product ? std::numeric_limits<float>::lowest() : std::numeric_limits<float>::max(),
+        [inner_product, take_sqrt](float score) {
+          return inner_product ? -score : (take_sqrt ? std::sqrt(score) : score);
+        });
+    }
+  }
+}
+
+/** See raft::neighbors::ivf_flat::search (host_index) docs */
+template <typename T,
+          typename IdxT,
+          typename IvfSampleFilterT = raft::neighbors::filtering::none_ivf_sample_filter>
+inline void search(const host_search_params& params,
+                   const host_index<T, IdxT>& index,
+                   const T* queries,
+                   uint32_t n_queries,
+                   uint32_t k,
+                   IdxT* neighbors,
+                   float* distances,
+                   IvfSampleFilterT sample_filter = IvfSampleFilterT())
+{
+  common::nvtx::range<common::nvtx::domain::raft> fun_scope(
+    "ivf_flat::search_host(k = %u, n_queries = %u, dim = %u)", k, n_queries, index.dim());
+
+  RAFT_EXPECTS(params.n_probes > 0,
+               "n_probes (number of clusters to probe in the search) must be positive.");
+  if (n_queries == 0 || k == 0) { return; }
+  auto n_probes = std::min<uint32_t>(params.n_probes, index.n_lists());
+  int n_threads = params.num_threads > 0 ? params.num_threads : omp_get_max_threads();
+
+  // The filters taking the source index of a sample see it through the list indices
+  auto filter = raft::neighbors::filtering::ivf_to_sample_filter(
+    index.inds_ptrs().data_handle(), sample_filter);
+
+  // Lift the `veclen` of the index to the template level (see `index::calculate_veclen`)
+  constexpr uint32_t kMaxVeclen = std::max<uint32_t>(1, 16 / sizeof(T));
+  auto search_with_dist         = [&](auto dist) {
+    using dist_t = decltype(dist);
+    if (index.veclen() == kMaxVeclen) {
+      search_impl<kMaxVeclen, dist_t>(index,
+                                      queries,
+                                      n_queries,
+                                      k,
+                                      n_probes,
+                                      n_threads,
+                                      params.max_queries,
+                                      neighbors,
+                                      distances,
+                                      filter);
+    } else {
+      RAFT_EXPECTS(index.veclen() == 1, "Unexpected veclen (%u)", index.veclen());
+      search_impl<1, dist_t>(index,
+                             queries,
+                             n_queries,
+                             k,
+                             n_probes,
+                             n_threads,
+                             params.max_queries,
+                             neighbors,
+                             distances,
+                             filter);
+    }
+  };
+  switch (index.metric()) {
+    case raft::distance::DistanceType::L2Expanded:
+    case raft::distance::DistanceType::L2Unexpanded:
+    case raft::distance::DistanceType::L2SqrtExpanded:
+    case raft::distance::DistanceType::L2SqrtUnexpanded:
+      return search_with_dist(host_euclidean_dist{});
+    case raft::distance::DistanceType::InnerProduct:
+      return search_with_dist(host_inner_prod_dist{});
+    default: RAFT_FAIL("The chosen distance metric is not supported (%d)", int(index.metric()));
+  }
+}
+
+}  // namespace raft::neighbors::ivf_flat::detail
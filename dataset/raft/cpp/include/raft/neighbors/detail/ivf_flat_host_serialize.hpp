@@ -0,0 +1,299 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <raft/core/detail/mdspan_numpy_serializer.hpp>
+#include <raft/core/error.hpp>
+#include <raft/core/host_mdarray.hpp>
+#include <raft/core/host_mdspan.hpp>
+#include <raft/core/logger.hpp>
+#include <raft/core/resources.hpp>
+#include <raft/core/serialize.hpp>
+#include <raft/neighbors/detail/ivf_container.hpp>
+#include <raft/neighbors/ivf_container_types.hpp>
+#include <raft/neighbors/ivf_flat_host_types.hpp>
+#include <raft/util/integer_utils.hpp>
+
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace raft::neighbors::ivf_flat::detail {
+
+// Serialization version
+// No backward compatibility yet; that is, can't add additional fields without breaking
+// backward compatibility. The host indexes are saved in the extensible index container instead
+// (see `serialize_host` and `detail/ivf_container.hpp`).
+constexpr int serialization_version = 4;
+
+/** Compute the squared norms of the centers; the device index computes them on demand. */
+template <typename T, typename IdxT>
+void compute_center_norms(host_index<T, IdxT>& index)
+{
+  auto centers = index.centers();
+  auto norms   = index.center_norms().value();
+  for (uint32_t label = 0; label < index.n_lists(); label++) {
+    float norm = 0;
+    for (uint32_t j = 0; j < index.dim(); j++) {
+      norm += centers(label, j) * centers(label, j);
+    }
+    norms(label) = norm;
+  }
+}
+
+/**
+ * Load an index written by `ivf_flat::serialize` into host memory.
+ *
+ * The stream layout is the one of `detail::deserialize` in `ivf_flat_serialize.cuh`; the lists
+ * are kept in their serialized interleaved layout.
+ *
+ * @param[in] handle the raft handle
+ * @param[in] is input stream
+ */
+template <typename T, typename IdxT>
+auto deserialize_host(raft::resources const& handle, std::istream& is) -> host_index<T, IdxT>
+{
+  char dtype_string[4];
+  is.read(dtype_string, 4);
+  std::string expected_dtype = raft::detail::numpy_serializer::get_numpy_dtype<T>().to_string();
+  expected_dtype.resize(4);
+  RAFT_EXPECTS(std::memcmp(dtype_string, expected_dtype.data(), 4) == 0,
+               "The index was serialized with a different data type");
+
+  auto ver = deserialize_scalar<int>(handle, is);
+  if (ver != serialization_version) {
+    RAFT_FAIL("serialization version mismatch, expected %d, got %d ", serialization_version, ver);
+  }
+  auto n_rows           = deserialize_scalar<IdxT>(handle, is);
+  auto dim              = deserialize_scalar<std::uint32_t>(handle, is);
+  auto n_lists          = deserialize_scalar<std::uint32_t>(handle, is);
+  auto metric           = deserialize_scalar<raft::distance::DistanceType>(handle, is);
+  bool adaptive_centers = deserialize_scalar<bool>(handle, is);
+  bool cma              = deserialize_scalar<bool>(handle, is);
+
+  host_index<T, IdxT> index_(metric, n_lists, adaptive_centers, cma, dim);
+
+  deserialize_mdspan(handle, is, index_.centers());
+  bool has_norms = deserialize_scalar<bool>(handle, is);
+  index_.allocate_center_norms();
+  if (has_norms) {
+    if (!index_.center_norms()) {
+      RAFT_FAIL("Error inconsistent center norms");
+    } else {
+      deserialize_mdspan(handle, is, index_.center_norms().value());
+    }
+  } else if (index_.center_norms()) {
+    compute_center_norms(index_);
+  }
+  auto list_sizes = make_host_vector<uint32_t, uint32_t>(n_lists);
+  deserialize_mdspan(handle, is, list_sizes.view());
+
+  for (uint32_t label = 0; label < n_lists; label++) {
+    // The lists are stored padded to the interleaved group size
+    auto size = deserialize_scalar<uint32_t>(handle, is);
+    if (size == 0) { continue; }
+    RAFT_EXPECTS(size == round_up_safe<uint32_t>(list_sizes(label), kIndexGroupSize),
+                 "Error inconsistent list size");
+    auto& list = index_.lists()[label].emplace(dim, list_sizes(label));
+    deserialize_mdspan(handle, is, list.data);
+    deserialize_mdspan(handle, is, list.indices);
+  }
+  index_.recompute_internal_state();
+  RAFT_EXPECTS(index_.size() == n_rows, "Error inconsistent index size");
+
+  RAFT_LOG_DEBUG("Loaded IVF-Flat index into host memory, size %zu, dim %u",
+                 static_cast<size_t>(index_.size()),
+                 index_.dim());
+  return index_;
+}
+
+/**
+ * Save a host index into an index container (see `detail/ivf_container.hpp`); the lists are
+ * written in parallel.
+ */
+template <typename T, typename IdxT>
+void serialize_host(raft::resources const& handle,
+                    const std::string& filename,
+                    const host_index<T, IdxT>& index,
+                    int num_threads)
+{
+  using ivf::detail::container_param;
+  using ivf::detail::container_section;
+  ivf::detail::container_params params;
+  params.set(container_param::kIndexKind, std::string("ivf_flat"));
+  params.set(container_param::kDtype,
+             raft::detail::numpy_serializer::get_numpy_dtype<T>().to_string());
+  params.set(container_param::kIndexDtype,
+             raft::detail::numpy_serializer::get_numpy_dtype<IdxT>().to_string());
+  params.set(container_param::kSize, static_cast<uint64_t>(index.size()));
+  params.set(container_param::kDim, index.dim());
+  params.set(container_param::kNLists, index.n_lists());
+  params.set(container_param::kMetric, static_cast<uint32_t>(index.metric()));
+  params.set(container_param::kAdaptiveCenters, static_cast<uint8_t>(index.adaptive_centers()));
+  params.set(container_param::kConservativeMemoryAllocation,
+             static_cast<uint8_t>(index.conservative_memory_allocation()));
+
+  std::vector<ivf::detail::container_array> arrays{
+    {container_section::kCenters,
+     index.centers().data_handle(),
+     index.centers().size() * sizeof(float)}};
+  if (index.center_norms()) {
+    arrays.push_back({container_section::kCenterNorms,
+                      index.center_norms()->data_handle(),
+                      index.center_norms()->size() * sizeof(float)});
+  }
+  std::vector<ivf::detail::container_list> lists(index.n_lists());
+  for (uint32_t label = 0; label < index.n_lists(); label++) {
+    const auto& list = index.lists()[label];
+    if (!list.has_value() || list->size == 0) { continue; }
+    lists[label] = {list->data.data_handle(),
+                    list->data.size() * sizeof(T),
+                    list->indices.data_handle(),
+                    list->indices.size() * sizeof(IdxT),
+                    list->size};
+  }
+  ivf::detail::write_container(filename, params, arrays, lists, num_threads);
+}
+
+/**
+ * Load the parameters and the centers of a host index from an index container and check the
+ * list directory; the lists are left empty.
+ */
+template <typename T, typename IdxT>
+auto deserialize_container_centers(const ivf::detail::container_reader& reader,
+                                   const std::string& filename) -> host_index<T, IdxT>
+{
+  using ivf::detail::container_param;
+  using ivf::detail::container_section;
+  const auto& params = reader.params();
+  RAFT_EXPECTS(params.get_string(container_param::kIndexKind) == "ivf_flat",
+               "File %s doesn't contain an IVF-Flat index",
+               filename.c_str());
+  RAFT_EXPECTS(params.get_string(container_param::kDtype) ==
+                 raft::detail::numpy_serializer::get_numpy_dtype<T>().to_string(),
+               "The index was serialized with a different data type");
+  RAFT_EXPECTS(params.get_string(container_param::kIndexDtype) ==
+                 raft::detail::numpy_serializer::get_numpy_dtype<IdxT>().to_string(),
+               "The index was serialized with a different index type");
+  auto dim     = params.get<uint32_t>(container_param::kDim);
+  auto n_lists = params.get<uint32_t>(container_param::kNLists);
+  auto metric =
+    static_cast<raft::distance::DistanceType>(params.get<uint32_t>(container_param::kMetric));
+  bool adaptive_centers = params.get<uint8_t>(container_param::kAdaptiveCenters, 0) != 0;
+  bool cma = params.get<uint8_t>(container_param::kConservativeMemoryAllocation, 0) != 0;
+  RAFT_EXPECTS(reader.n_lists() == n_lists, "Error inconsistent list directory");
+
+  host_index<T, IdxT> index_(metric, n_lists, adaptive_centers, cma, dim);
+  reader.read_section(container_section::kCenters,
+                      index_.centers().data_handle(),
+                      index_.centers().size() * sizeof(float));
+  index_.allocate_center_norms();
+  if (index_.center_norms()) {
+    auto norms = index_.center_norms().value();
+    if (reader.section_size(container_section::kCenterNorms).has_value()) {
+      reader.read_section(
+        container_section::kCenterNorms, norms.data_handle(), norms.size() * sizeof(float));
+    } else {
+      compute_center_norms(index_);
+    }
+  }
+
+  for (uint32_t label = 0; label < n_lists; label++) {
+    const auto& entry = reader.list(label);
+    auto capacity     = round_up_safe<uint64_t>(entry.size, kIndexGroupSize);
+    RAFT_EXPECTS(entry.size == 0 || (entry.data_size == capacity * dim * sizeof(T) &&
+                                     entry.indices_size == capacity * sizeof(IdxT)),
+                 "Error inconsistent list size");
+  }
+  return index_;
+}
+
+/**
+ * Load a host index from an index container, either reading the lists in parallel or mapping
+ * them into memory (see `ivf::container_load_params`).
+ */
+template <typename T, typename IdxT>
+auto deserialize_container(raft::resources const& handle,
+                           const std::string& filename,
+                           const ivf::container_load_params& load_params) -> host_index<T, IdxT>
+{
+  ivf::detail::container_reader reader(filename);
+  auto index_        = deserialize_container_centers<T, IdxT>(reader, filename);
+  auto n_rows        = reader.params().get<uint64_t>(ivf::detail::container_param::kSize);
+  const auto dim     = index_.dim();
+  const auto n_lists = index_.n_lists();
+
+  std::shared_ptr<ivf::detail::container_mapping> mapping;
+  if (load_params.mmap_lists) { mapping = reader.map(); }
+  ivf::detail::container_for_each_list(n_lists, load_params.num_threads, [&](uint32_t label) {
+    const auto& entry = reader.list(label);
+    if (entry.size == 0) { return; }
+    auto& list = index_.lists()[label];
+    if (mapping) {
+      auto capacity = round_up_safe<uint32_t>(entry.size, kIndexGroupSize);
+      list.emplace(make_host_matrix_view<T, uint32_t>(
+                     reinterpret_cast<T*>(mapping->data() + entry.data_offset), capacity, dim),
+                   make_host_vector_view<IdxT, uint32_t>(
+                     reinterpret_cast<IdxT*>(mapping->data() + entry.indices_offset), capacity),
+                   entry.size,
+                   mapping);
+    } else {
+      list.emplace(dim, entry.size);
+      reader.read_list(label, list->data.data_handle(), list->indices.data_handle());
+    }
+  });
+  index_.recompute_internal_state();
+  RAFT_EXPECTS(index_.size() == IdxT(n_rows), "Error inconsistent index size");
+
+  RAFT_LOG_DEBUG("Loaded IVF-Flat index container into host memory, size %zu, dim %u",
+                 static_cast<size_t>(index_.size()),
+                 index_.dim());
+  return index_;
+}
+
+template <typename T, typename IdxT>
+auto deserialize_host(raft::resources const& handle,
+                      const std::string& filename,
+                      const ivf::container_load_params& load_params) -> host_index<T, IdxT>
+{
+  if (ivf::detail::is_container(filename)) {
+    return deserialize_container<T, IdxT>(handle, filename, load_params);
+  }
+  RAFT_EXPECTS(!load_params.mmap_lists,
+               "Only the indexes saved with `serialize_host` can be mapped into memory");
+
+  std::ifstream is(filename, std::ios::in | std::ios::binary);
+
+  if (!is) { RAFT_FAIL("Cannot open file %s", filename.c_str()); }
+
+  auto index = detail::deserialize_host<T, IdxT>(handle, is);
+
+  is.close();
+
+  return index;
+}
+
+template <typename T, typename IdxT>
+auto deserialize_host(raft::resources const& handle, const std::string& filename)
+  -> host_index<T, IdxT>
+{
+  return detail::deserialize_host<T, IdxT>(handle, filename, ivf::container_load_params{});
+}
+
+}  // namespace raft::neighbors::ivf_flat::detail
@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+/*
+ * The parts of the host IVF searches shared by all index types: the per-thread top-k heaps, the
+ * grouping of the queries by the probed lists and the merge of the results.
+ */
+namespace raft::neighbors::ivf::detail {
+
+/** The neighbor index of the missing results, the same as `ivf::detail::kOutOfBoundsRecord`. */
+template <typename IdxT>
+constexpr static IdxT kHostOutOfBoundsRecord = std::numeric_limits<IdxT>::max();
+
+/**
+ * The number of queries searched at a time: `max_queries` if positive, otherwise as many as keep
+ * the per-query workspace of the search within 256 MiB.
+ */
+inline auto host_batch_size(uint32_t n_queries, uint32_t max_queries, uint64_t ws_size_per_query)
+  -> uint32_t
+{
+  constexpr uint64_t kExpectedWsSize = 256 * 1024 * 1024;
+  uint64_t batch_size =
+    max_queries > 0 ? uint64_t(max_queries) : kExpectedWsSize / ws_size_per_query;
+  return static_cast<uint32_t>(std::max<uint64_t>(1, std::min<uint64_t>(n_queries, batch_size)));
+}
+
+/** Push a candidate into a bounded max-heap of the `k` best scores. */
+template <typename IdxT>
+inline void host_topk_push(
+  float* heap_scores, IdxT* heap_ids, uint32_t& heap_size, uint32_t k, float score, IdxT id)
+{
+  uint32_t i;
+  if (heap_size < k) {
+    // sift up
+    i = heap_size++;
+    while (i > 0) {
+      uint32_t parent = (i - 1) / 2;
+      if (heap_scores[parent] >= score) { break; }
+      heap_scores[i] = heap_scores[parent];
+      heap_ids[i]    = heap_ids[parent];
+      i              = parent;
+    }
+  } else {
+    // replace the root and sift down
+    i = 0;
+    while (true) {
+      uint32_t child = 2 * i + 1;
+      if (child >= k) { break; }
+      if (child + 1 < k && heap_scores[child + 1] > heap_scores[child]) { child++; }
+      if (heap_scores[child] <= score) { break; }
+      heap_scores[i] = heap_scores[child];
+      heap_ids[i]    = heap_ids[child];
+      i              = child;
+    }
+  }
+  heap_scores[i] = score;
+  heap_ids[i]    = id;
+}
+
+/** A range of interleaved groups of one list, scanned for all the queries probing the list. */
+struct host_scan_task {
+  uint32_t label;
+  uint32_t group_begin;
+  uint32_t group_end;
+};
+
+/**
+ * Group the queries of a batch by the probed lists (a counting sort of the probes).
+ *
+ * @param[in] probes the probed lists of every query [n_queries, n_probes]
+ * @param[out] list_offsets the offsets of the lists in `list_queries` [n_lists + 1]
+ * @param[out] list_queries the queries probing every list [n_queries * n_probes]
+ */
+inline void host_group_by_list(const uint32_t* probes,
+                               uint32_t n_queries,
+                               uint32_t n_probes,
+                               std::vector<uint32_t>& list_offsets,
+                               std::vector<uint32_t>& list_queries)
+{
+  std::fill(list_offsets.begin(), list_offsets.end(), 0);
+  for (size_t i = 0; i < size_t(n_queries) * n_probes; i++) {
+    list_offsets[probes[i] + 1]++;
+  }
+  std::partial_sum(list_offsets.begin(), list_offsets.end(), list_offsets.begin());
+  std::vector<uint32_t> positions(list_offsets.begin(), list_offsets.end() - 1);
+  for (uint32_t query_ix = 0; query_ix < n_queries; query_ix++) {
+    for (uint32_t probe_ix = 0; probe_ix < n_probes; probe_ix++) {
+      list_queries[positions[probes[size_t(query_ix) * n_probes + probe_ix]]++] = query_ix;
+    }
+  }
+}
+
+/**
+ * Split the probed lists into tasks of at most `groups_per_task(n_list_queries)`
+ * interleaved groups of `group_size` records.
+ */
+template <typename ListSizesT, typename GroupsPerTaskT>
+void host_make_scan_tasks(ListSizesT list_sizes,
+                          uint32_t n_lists,
+                          uint32_t group_size,
+                          const std::vector<uint32_t>& list_offsets,
+                          GroupsPerTaskT groups_per_task,
+                          std::vector<host_scan_task>& tasks)
+{
+  tasks.clear();
+  for (uint32_t label = 0; label < n_lists; label++) {
+    uint32_t n_list_queries = list_offsets[label + 1] - list_offsets[label];
+    uint32_t list_size      = list_sizes(label);
+    if (n_list_queries == 0 || list_size == 0) { continue; }
+    uint32_t n_groups  = (list_size + group_size - 1) / group_size;
+    uint32_t task_size = std::max<uint32_t>(1, groups_per_task(n_list_queries));
+    for (uint32_t group_ix = 0; group_ix < n_groups; group_ix += task_size) {
+      tasks.push_back({label, group_ix, std::min(n_groups, group_ix + task_size)});
+    }
+  }
+}
+
+/**
+ * Merge the per-thread heaps of every query into the sorted output.
+ * Must be called from within an OpenMP parallel region.
+ *
+ * @param dummy_distance the distance of the missing results
+ * @param postprocess converts a score (the smaller the better) into the output distance
+ */
+template <typename IdxT, typename PostprocessT>
+void host_merge_topk(uint32_t n_queries,
+                     uint32_t k,
+                     uint32_t n_heaps,
+                     const float* heap_scores,
+                     const IdxT* heap_ids,
+                     const uint32_t* heap_sizes,
+                     IdxT* neighbors,
+                     float* distances,
+                     float dummy_distance,
+                     PostprocessT postprocess)
+{
+  std::vector<std::pair<float, IdxT>> candidates;
+
+#pragma omp for
+  for (uint32_t query_ix = 0; query_ix < n_queries; query_ix++) {
+    candidates.clear();
+    for (uint32_t heap_ix = 0; heap_ix < n_heaps; heap_ix++) {
+      size_t heap_offset = (size_t(heap_ix) * n_queries + query_ix) * k;
+      for (uint32_t i = 0; i < heap_sizes[size_t(heap_ix) * n_queries + query_ix]; i++) {
+        candidates.emplace_back(heap_scores[heap_offset + i], heap_ids[heap_offset + i]);
+      }
+    }
+    uint32_t n_found = std::min<size_t>(k, candidates.size());
+    std::partial_sort(candidates.begin(), candidates.begin() + n_found, candidates.end());
+    for (uint32_t j = 0; j < k; j++) {
+      size_t out_ix = size_t(query_ix) * k + j;
+      if (j < n_found) {
+        neighbors[out_ix] = candidates[j].second;
+        distances[out_ix] = postprocess(candidates[j].first);
+      } else {
+        neighbors[out_ix] = kHostOutOfBoundsRecord<IdxT>;
+        distances[out_ix] = dummy_distance;
+      }
+    }
+  }
+}
+
+}  // namespace raft::neighbors::ivf::detail
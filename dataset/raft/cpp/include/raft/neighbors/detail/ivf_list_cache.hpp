@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <raft/neighbors/ivf_container_types.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace raft::neighbors::ivf::detail {
+
+/**
+ * A bounded cache of the lists of a disk-resident index.
+ *
+ * The lists are split into shards by the label, every shard an LRU list with its own lock, so that
+ * the threads of a search rarely contend. The shards share one budget of `capacity` bytes: a list
+ * added to a full cache evicts the least recently used lists of any shard (approximately, by
+ * comparing the oldest list of every shard). The lists are held by shared pointers: an evicted list
+ * stays alive as long as a search uses it.
+ */
+template <typename ListT>
+class host_list_cache {
+ public:
+  using list_ptr = std::shared_ptr<const ListT>;
+
+  host_list_cache(uint64_t capacity_bytes, uint32_t n_shards)
+    : n_shards_{std::max<uint32_t>(1, n_shards)},
+      capacity_{capacity_bytes},
+      shards_{std::make_unique<shard[]>(n_shards_)}
+  {
+  }
+
+  /** The list of a label if it's in the cache (and mark it as recently used), or `nullptr`. */
+  auto get(uint32_t label) -> list_ptr
+  {
+    auto& s = shards_[label % n_shards_];
+    std::lock_guard<std::mutex> guard(s.mutex);
+    auto it = s.index.find(label);
+    if (it == s.index.end()) {
+      misses_.fetch_add(1, std::memory_order_relaxed);
+      return nullptr;
+    }
+    hits_.fetch_add(1, std::memory_order_relaxed);
+    it->second->last_use = clock_.fetch_add(1, std::memory_order_relaxed);
+    s.lru.splice(s.lru.begin(), s.lru, it->second);
+    return it->second->list;
+  }
+
+  /** Whether the list of a label is in the cache; doesn't change the LRU order or the counters. */
+  auto contains(uint32_t label) const -> bool
+  {
+    auto& s = shards_[label % n_shards_];
+    std::lock_guard<std::mutex> guard(s.mutex);
+    return s.index.count(label) > 0;
+  }
+
+  /**
+   * Add a list of `bytes` size, evicting the least recently used lists to make room. A list larger
+   * than the cache is not added. `readahead` marks the lists read ahead of the search in the
+   * counters.
+   */
+  void insert(uint32_t label, list_ptr list, uint64_t bytes, bool readahead = false)
+  {
+    if (bytes > capacity_) { return; }
+    {
+      auto& s = shards_[label % n_shards_];
+      std::lock_guard<std::mutex> guard(s.mutex);
+      if (s.index.count(label) > 0) { return; }
+      if (readahead) { readahead_.fetch_add(1, std::memory_order_relaxed); }
+      auto now = clock_.fetch_add(1, std::memory_order_relaxed);
+      s.lru.push_front({label, std::move(list), bytes, now});
+      s.index.emplace(label, s.lru.begin());
+      s.bytes += bytes;
+      bytes_.fetch_add(bytes, std::memory_order_relaxed);
+    }
+    // The new list is the most recently used one, evicted last
+    while (bytes_.load(std::memory_order_relaxed) > capacity_ && evict_oldest()) {}
+  }
+
+  [[nodiscard]] auto stats() const -> list_cache_stats
+  {
+    list_cache_stats stats;
+    stats.hits      = hits_.load(std::memory_order_relaxed);
+    stats.misses    = misses_.load(std::memory_order_relaxed);
+    stats.readahead = readahead_.load(std::memory_order_relaxed);
+    stats.evictions = evictions_.load(std::memory_order_relaxed);
+    for (uint32_t i = 0; i < n_shards_; i++) {
+      std::lock_guard<std::mutex> guard(shards_[i].mutex);
+      stats.resident_bytes += shards_[i].bytes;
+    }
+    return stats;
+  }
+
+ private:
+  struct entry {
+    uint32_t label;
+    list_ptr list;
+    uint64_t bytes;
+    uint64_t last_use;
+  };
+  struct shard {
+    mutable std::mutex mutex;
+    std::list<entry> lru;
+    std::unordered_map<uint32_t, typename std::list<entry>::iterator> index;
+    uint64_t bytes = 0;
+  };
+
+  /**
+   * Evict the least recently used list of all the shards; false if the cache is empty. Only one
+   * shard is locked at a time, so the oldest list may change before its shard is locked: retry.
+   */
+  auto evict_oldest() -> bool
+  {
+    while (true) {
+      uint32_t victim   = n_shards_;
+      uint64_t last_use = 0;
+      for (uint32_t i = 0; i < n_shards_; i++) {
+        std::lock_guard<std::mutex> guard(shards_[i].mutex);
+        if (shards_[i].lru.empty()) { continue; }
+        if (victim == n_shards_ || shards_[i].lru.back().last_use < last_use) {
+          victim   = i;
+          last_use = shards_[i].lru.back().last_use;
+        }
+      }
+      if (victim == n_shards_) { return false; }
+      auto& s = shards_[victim];
+      std::lock_guard<std::mutex> guard(s.mutex);
+      if (s.lru.empty() || s.lru.back().last_use != last_use) { continue; }
+      s.bytes -= s.lru.back().bytes;
+      bytes_.fetch_sub(s.lru.back().bytes, std::memory_order_relaxed);
+      s.index.erase(s.lru.back().label);
+      s.lru.pop_back();
+      evictions_.fetch_add(1, std::memory_order_relaxed);
+      return true;
+    }
+  }
+
+  uint32_t n_shards_;
+  uint64_t capacity_;
+  std::unique_ptr<shard[]> shards_;
+  /** Total size of the lists of all the shards. */
+  std::atomic<uint64_t> bytes_{0};
+  /** The order of the uses of the lists, for the eviction across the shards. */
+  std::atomic<uint64_t> clock_{0};
+  std::atomic<uint64_t> hits_{0};
+  std::atomic<uint64_t> misses_{0};
+  std::atomic<uint64_t> readahead_{0};
+  std::atomic<uint64_t> evictions_{0};
+};
+
+}  // namespace raft::neighbors::ivf::detail
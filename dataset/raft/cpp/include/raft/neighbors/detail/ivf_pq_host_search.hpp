@@ -0,0 +1,678 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <raft/core/error.hpp>
+#include <raft/core/nvtx.hpp>
+#include <raft/distance/distance_types.hpp>
+#include <raft/neighbors/detail/ivf_host_common.hpp>
+#include <raft/neighbors/ivf_pq_host_types.hpp>
+#include <raft/neighbors/sample_filter_types.hpp>  // none_ivf_sample_filter
+#include <raft/util/integer_utils.hpp>
+
+#include <omp.h>
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+// The fast scan uses the SIMD instructions enabled by the compiler flags, unless
+// `RAFT_DISABLE_HOST_SIMD` is defined
+#if !defined(RAFT_DISABLE_HOST_SIMD)
+#if defined(__AVX2__) || defined(__SSSE3__)
+#define RAFT_HOST_SIMD_X86
+#include <immintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#define RAFT_HOST_SIMD_NEON
+#include <arm_neon.h>
+#endif
+#endif
+
+namespace raft::neighbors::ivf_pq::detail {
+
+using raft::neighbors::ivf::detail::host_scan_task;
+using raft::neighbors::ivf::detail::host_topk_push;
+
+/**
+ * The scale of the integer data converted to float before the training, i.e. the scale of the
+ * queries compared to the cluster and PQ centers (see `utils::mapping<float>`).
+ */
+template <typename T>
+constexpr auto host_query_scale() -> float
+{
+  if constexpr (std::is_same_v<T, uint8_t>) {
+    return 1.0f / 256.0f;
+  } else if constexpr (std::is_same_v<T, int8_t>) {
+    return 1.0f / 128.0f;
+  } else {
+    return 1.0f;
+  }
+}
+
+/** The number of the PQ codes in one chunk of `kIndexGroupVecLen` bytes (see `list_spec`). */
+constexpr auto host_chunk_size(uint32_t pq_bits) -> uint32_t
+{
+  return kIndexGroupVecLen * 8u / pq_bits;
+}
+
+/** Size in bytes of one interleaved group of `kIndexGroupSize` records. */
+constexpr auto host_group_bytes(uint32_t pq_bits, uint32_t pq_dim) -> size_t
+{
+  return size_t(raft::div_rounding_up_safe(pq_dim, host_chunk_size(pq_bits))) * kIndexGroupSize *
+         kIndexGroupVecLen;
+}
+
+/**
+ * Unpack the codes of one interleaved group into the code-major layout [pq_dim, kIndexGroupSize],
+ * so that the scores of all records of the group are accumulated one subspace at a time.
+ */
+inline void host_decode_group(const uint8_t* group,
+                              uint32_t pq_bits,
+                              uint32_t pq_dim,
+                              uint8_t* codes)
+{
+  const uint32_t chunk_size = host_chunk_size(pq_bits);
+  const uint32_t mask       = (1u << pq_bits) - 1u;
+  for (uint32_t r = 0; r < kIndexGroupSize; r++) {
+    for (uint32_t j = 0, i = 0; j < pq_dim; i++) {
+      const uint8_t* chunk = group + (size_t(i) * kIndexGroupSize + r) * kIndexGroupVecLen;
+      for (uint32_t l = 0; l < chunk_size && j < pq_dim; l++, j++) {
+        // A code may span two bytes; the chunks are little-endian bit streams
+        uint32_t bit_offset = l * pq_bits;
+        uint32_t byte_ix    = bit_offset / 8;
+        uint32_t bits       = chunk[byte_ix];
+        if ((bit_offset % 8) + pq_bits > 8) { bits |= uint32_t(chunk[byte_ix + 1]) << 8; }
+        codes[size_t(j) * kIndexGroupSize + r] = (bits >> (bit_offset % 8)) & mask;
+      }
+    }
+  }
+}
+
+/**
+ * Transpose the chunks of a 4-bit group to [n_chunks, kIndexGroupVecLen, kIndexGroupSize]: the
+ * byte `b` of all records of a chunk becomes contiguous and holds the codes of the subspaces
+ * `2b` (low nibble) and `2b + 1` (high nibble) of 32 records, i.e. one SIMD register of indices
+ * into the look up tables of these two subspaces.
+ */
+inline void host_transpose_group(const uint8_t* group, uint32_t n_chunks, uint8_t* packed)
+{
+  constexpr size_t kChunkBytes = size_t(kIndexGroupSize) * kIndexGroupVecLen;
+  for (uint32_t i = 0; i < n_chunks; i++, group += kChunkBytes, packed += kChunkBytes) {
+    for (uint32_t r = 0; r < kIndexGroupSize; r++) {
+      for (uint32_t b = 0; b < kIndexGroupVecLen; b++) {
+        packed[b * kIndexGroupSize + r] = group[r * kIndexGroupVecLen + b];
+      }
+    }
+  }
+}
+
+/**
+ * Compute the look up table of a query for the records of one cluster [pq_dim, pq_book_size]:
+ * the score of a record is the sum of the table entries selected by its codes, the smaller the
+ * better (the same as `compute_similarity_kernel`).
+ */
+template <typename IdxT>
+[[gnu::optimize(3), gnu::optimize("tree-vectorize")]] void host_compute_lut(
+  const host_index<IdxT>& index,
+  const float* rot_query,
+  uint32_t label,
+  bool inner_product,
+  float* lut)
+{
+  const uint32_t pq_dim    = index.pq_dim();
+  const uint32_t pq_len    = index.pq_len();
+  const uint32_t book_size = index.pq_book_size();
+  const bool per_cluster   = index.codebook_kind() == codebook_gen::PER_CLUSTER;
+  const float* center      = index.centers_rot().data_handle() + size_t(label) * index.rot_dim();
+
+  for (uint32_t j = 0; j < pq_dim; j++, lut += book_size) {
+    const float* codebook =
+      index.pq_centers().data_handle() + size_t(per_cluster ? label : j) * pq_len * book_size;
+    const float* query = rot_query + j * pq_len;
+    const float* c     = center + j * pq_len;
+    if (inner_product) {
+      float qc = 0;
+      for (uint32_t l = 0; l < pq_len; l++) {
+        qc += query[l] * c[l];
+      }
+      std::fill(lut, lut + book_size, -qc);
+      for (uint32_t l = 0; l < pq_len; l++, codebook += book_size) {
+        const float q = query[l];
+        for (uint32_t code = 0; code < book_size; code++) {
+          lut[code] -= q * codebook[code];
+        }
+      }
+    } else {
+      std::fill(lut, lut + book_size, 0.0f);
+      for (uint32_t l = 0; l < pq_len; l++, codebook += book_size) {
+        const float q = query[l] - c[l];
+        for (uint32_t code = 0; code < book_size; code++) {
+          const float diff = q - codebook[code];
+          lut[code] += diff * diff;
+        }
+      }
+    }
+  }
+}
+
+/** The score of a record is bounded from below by `bias + step * (quantized score) - margin`. */
+struct host_lut_bounds {
+  float bias;
+  float step;
+  float margin;
+};
+
+/**
+ * Quantize a 4-bit look up table [pq_dim, 16] to 8 bits for the fast scan
+ * [n_chunks * chunk_size, 16]; the padding subspaces are zero.
+ *
+ * Every row is shifted by its minimum and all rows share one step, so that the sum of the
+ * quantized entries is proportional to a lower bound of the score. The entries are rounded down,
+ * and the margin covers the rounding of the float arithmetic on both sides of the comparison.
+ */
+inline auto host_quantize_lut(const float* lut, uint32_t pq_dim, uint32_t n_chunks, uint8_t* qlut)
+  -> host_lut_bounds
+{
+  constexpr uint32_t kBookSize = 16;
+  float bias                   = 0;
+  float max_range              = 0;
+  float abs_sum                = 0;
+  for (uint32_t j = 0; j < pq_dim; j++) {
+    const auto [lo, hi] = std::minmax_element(lut + j * kBookSize, lut + (j + 1) * kBookSize);
+    bias += *lo;
+    max_range = std::max(max_range, *hi - *lo);
+    abs_sum += std::max(std::abs(*lo), std::abs(*hi));
+  }
+  const float step     = max_range > 0 ? max_range / 255.0f : 1.0f;
+  const float inv_step = 1.0f / step;
+  for (uint32_t j = 0; j < pq_dim; j++) {
+    const float lo = *std::min_element(lut + j * kBookSize, lut + (j + 1) * kBookSize);
+    for (uint32_t code = 0; code < kBookSize; code++) {
+      float q = std::floor((lut[j * kBookSize + code] - lo) * inv_step);
+      qlut[j * kBookSize + code] = static_cast<uint8_t>(std::clamp(q, 0.0f, 255.0f));
+    }
+  }
+  std::fill(qlut + pq_dim * kBookSize,
+            qlut + size_t(n_chunks) * host_chunk_size(4) * kBookSize,
+            uint8_t{0});
+  return {bias, step, step + 2.0f * FLT_EPSILON * float(pq_dim) * abs_sum};
+}
+
+/**
+ * Sum the quantized 4-bit look up table entries of the 32 records of a transposed group
+ * (see `host_transpose_group`).
+ *
+ * The entries are looked up with in-register byte shuffles (PSHUFB / TBL), 16 entries of a
+ * subspace per register. A chunk sums at most 32 entries of 255, so the partial sums are kept
+ * in 16 bits and widened once per chunk.
+ */
+inline void host_fast_scan_group(const uint8_t* packed,
+                                 const uint8_t* qlut,
+                                 uint32_t n_chunks,
+                                 uint32_t* acc)
+{
+  // A chunk holds the codes of 32 subspaces, so its table also takes 32 x 16 bytes
+  constexpr uint32_t kChunkBytes = kIndexGroupSize * kIndexGroupVecLen;
+  std::fill(acc, acc + kIndexGroupSize, 0u);
+  for (uint32_t i = 0; i < n_chunks; i++, packed += kChunkBytes, qlut += kChunkBytes) {
+    alignas(32) uint16_t sums[kIndexGroupSize];
+#if defined(RAFT_HOST_SIMD_X86) && defined(__AVX2__)
+    // rows [0, 8) and [16, 24) in `lo`, [8, 16) and [24, 32) in `hi`
+    const __m256i mask = _mm256_set1_epi8(0x0F);
+    const __m256i zero = _mm256_setzero_si256();
+    __m256i lo         = zero;
+    __m256i hi         = zero;
+    for (uint32_t b = 0; b < kIndexGroupVecLen; b++) {
+      __m256i codes =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(packed + b * kIndexGroupSize));
+      __m256i lut0 = _mm256_broadcastsi128_si256(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(qlut + (2 * b) * 16)));
+      __m256i lut1 = _mm256_broadcastsi128_si256(
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(qlut + (2 * b + 1) * 16)));
+      __m256i v0 = _mm256_shuffle_epi8(lut0, _mm256_and_si256(codes, mask));
+      __m256i v1 = _mm256_shuffle_epi8(lut1, _mm256_and_si256(_mm256_srli_epi16(codes, 4), mask));
+      lo = _mm256_add_epi16(lo, _mm256_unpacklo_epi8(v0, zero));
+      lo = _mm256_add_epi16(lo, _mm256_unpacklo_epi8(v1, zero));
+      hi = _mm256_add_epi16(hi, _mm256_unpackhi_epi8(v0, zero));
+      hi = _mm256_add_epi16(hi, _mm256_unpackhi_epi8(v1, zero));
+    }
+    _mm256_store_si256(reinterpret_cast<__m256i*>(sums),
+                       _mm256_permute2x128_si256(lo, hi, 0x20));
+    _mm256_store_si256(reinterpret_cast<__m256i*>(sums + 16),
+                       _mm256_permute2x128_si256(lo, hi, 0x31));
+#elif defined(RAFT_HOST_SIMD_X86)
+    const __m128i mask = _mm_set1_epi8(0x0F);
+    const __m128i zero = _mm_setzero_si128();
+    __m128i acc16[4]   = {zero, zero, zero, zero};
+    for (uint32_t b = 0; b < kIndexGroupVecLen; b++) {
+      __m128i lut0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(qlut + (2 * b) * 16));
+      __m128i lut1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(qlut + (2 * b + 1) * 16));
+      for (uint32_t h = 0; h < 2; h++) {
+        __m128i codes =
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(packed + b * kIndexGroupSize + h * 16));
+        __m128i v0   = _mm_shuffle_epi8(lut0, _mm_and_si128(codes, mask));
+        __m128i v1   = _mm_shuffle_epi8(lut1, _mm_and_si128(_mm_srli_epi16(codes, 4), mask));
+        acc16[2 * h] = _mm_add_epi16(acc16[2 * h], _mm_unpacklo_epi8(v0, zero));
+        acc16[2 * h] = _mm_add_epi16(acc16[2 * h], _mm_unpacklo_epi8(v1, zero));
+        acc16[2 * h + 1] = _mm_add_epi16(acc16[2 * h + 1], _mm_unpackhi_epi8(v0, zero));
+        acc16[2 * h + 1] = _mm_add_epi16(acc16[2 * h + 1], _mm_unpackhi_epi8(v1, zero));
+      }
+    }
+    for (uint32_t h = 0; h < 4; h++) {
+      _mm_store_si128(reinterpret_cast<__m128i*>(sums + 8 * h), acc16[h]);
+    }
+#elif defined(RAFT_HOST_SIMD_NEON)
+    const uint8x16_t mask = vdupq_n_u8(0x0F);
+    uint16x8_t acc16[4]   = {vdupq_n_u16(0), vdupq_n_u16(0), vdupq_n_u16(0), vdupq_n_u16(0)};
+    for (uint32_t b = 0; b < kIndexGroupVecLen; b++) {
+      uint8x16_t lut0 = vld1q_u8(qlut + (2 * b) * 16);
+      uint8x16_t lut1 = vld1q_u8(qlut + (2 * b + 1) * 16);
+      for (uint32_t h = 0; h < 2; h++) {
+        uint8x16_t codes = vld1q_u8(packed + b * kIndexGroupSize + h * 16);
+        uint8x16_t v0    = vqtbl1q_u8(lut0, vandq_u8(codes, mask));
+        uint8x16_t v1    = vqtbl1q_u8(lut1, vshrq_n_u8(codes, 4));
+        acc16[2 * h]     = vaddw_u8(vaddw_u8(acc16[2 * h], vget_low_u8(v0)), vget_low_u8(v1));
+        acc16[2 * h + 1] =
+          vaddw_u8(vaddw_u8(acc16[2 * h + 1], vget_high_u8(v0)), vget_high_u8(v1));
+      }
+    }
+    for (uint32_t h = 0; h < 4; h++) {
+      vst1q_u16(sums + 8 * h, acc16[h]);
+    }
+#else
+    std::fill(sums, sums + kIndexGroupSize, uint16_t{0});
+    for (uint32_t b = 0; b < kIndexGroupVecLen; b++) {
+      for (uint32_t r = 0; r < kIndexGroupSize; r++) {
+        uint8_t codes = packed[b * kIndexGroupSize + r];
+        sums[r] += qlut[(2 * b) * 16 + (codes & 0x0F)] + qlut[(2 * b + 1) * 16 + (codes >> 4)];
+      }
+    }
+#endif
+    for (uint32_t r = 0; r < kIndexGroupSize; r++) {
+      acc[r] += sums[r];
+    }
+  }
+}
+
+/** The exact score of the record `r` of a transposed 4-bit group (see `host_transpose_group`). */
+inline auto host_packed_score(const uint8_t* packed, const float* lut, uint32_t pq_dim, uint32_t r)
+  -> float
+{
+  // `pq_bits * pq_dim` is a multiple of 8, hence every byte holds two codes
+  float score = 0;
+  for (uint32_t j = 0; j < pq_dim; j += 2) {
+    uint32_t i    = j / host_chunk_size(4);
+    uint32_t b    = (j % host_chunk_size(4)) / 2;
+    uint8_t codes = packed[(i * kIndexGroupVecLen + b) * kIndexGroupSize + r];
+    score += lut[j * 16 + (codes & 0x0F)];
+    score += lut[(j + 1) * 16 + (codes >> 4)];
+  }
+  return score;
+}
+
+/**
+ * Sum the look up table entries of the 32 records of a decoded group (see `host_decode_group`).
+ * The subspaces are summed in the same order as `host_packed_score`.
+ */
+[[gnu::optimize(3), gnu::optimize("tree-vectorize")]] inline void host_gather_scores(
+  const uint8_t* codes, const float* lut, uint32_t pq_dim, uint32_t book_size, float* scores)
+{
+  std::fill(scores, scores + kIndexGroupSize, 0.0f);
+  for (uint32_t j = 0; j < pq_dim; j++, codes += kIndexGroupSize, lut += book_size) {
+    for (uint32_t r = 0; r < kIndexGroupSize; r++) {
+      scores[r] += lut[codes[r]];
+    }
+  }
+}
+
+/**
+ * Select the `n_probes` closest clusters of every query and rotate the queries.
+ *
+ * The centers are compared with a tile of queries at a time, so that every center is read once
+ * per tile. Must be called from within an OpenMP parallel region.
+ */
+template <typename T, typename IdxT>
+void host_select_clusters(const host_index<IdxT>& index,
+                          const T* queries,
+                          uint32_t n_queries,
+                          uint32_t n_probes,
+                          uint32_t* probes,
+                          float* rot_queries)
+{
+  constexpr uint32_t kQueryTile = 4;
+
+  const uint32_t dim       = index.dim();
+  const uint32_t dim_ext   = index.dim_ext();
+  const uint32_t rot_dim   = index.rot_dim();
+  const uint32_t n_lists   = index.n_lists();
+  const float* centers     = index.centers().data_handle();
+  const float* rotation    = index.rotation_matrix().data_handle();
+  const bool inner_product = index.metric() == raft::distance::DistanceType::InnerProduct;
+  const uint32_t n_tiles   = raft::div_rounding_up_safe(n_queries, kQueryTile);
+
+  std::vector<float> tile_queries(kQueryTile * dim);
+  std::vector<float> scores(kQueryTile * n_lists);
+  std::vector<uint32_t> labels(n_lists);
+
+#pragma omp for schedule(dynamic)
+  for (uint32_t tile = 0; tile < n_tiles; tile++) {
+    uint32_t tile_begin = tile * kQueryTile;
+    uint32_t tile_size  = std::min(kQueryTile, n_queries - tile_begin);
+    for (uint32_t i = 0; i < tile_size * dim; i++) {
+      tile_queries[i] =
+        static_cast<float>(queries[size_t(tile_begin) * dim + i]) * host_query_scale<T>();
+    }
+    for (uint32_t label = 0; label < n_lists; label++) {
+      const float* center = centers + size_t(label) * dim_ext;
+      for (uint32_t t = 0; t < tile_size; t++) {
+        const float* query = tile_queries.data() + t * dim;
+        float dot          = 0;
+#pragma omp simd reduction(+ : dot)
+        for (uint32_t j = 0; j < dim; j++) {
+          dot += query[j] * center[j];
+        }
+        // The extended component of a center holds its squared norm
+        scores[t * n_lists + label] = inner_product ? -dot : center[dim] - 2.0f * dot;
+      }
+    }
+    for (uint32_t t = 0; t < tile_size; t++) {
+      const float* query_scores = scores.data() + t * n_lists;
+      std::iota(labels.begin(), labels.end(), 0);
+      if (n_probes < n_lists) {
+        std::nth_element(
+          labels.begin(), labels.begin() + n_probes, labels.end(), [&](uint32_t a, uint32_t b) {
+            return query_scores[a] < query_scores[b];
+          });
+      }
+      std::copy(labels.begin(),
+                labels.begin() + n_probes,
+                probes + size_t(tile_begin + t) * n_probes);
+
+      const float* query = tile_queries.data() + t * dim;
+      float* rot_query   = rot_queries + size_t(tile_begin + t) * rot_dim;
+      for (uint32_t i = 0; i < rot_dim; i++) {
+        const float* row = rotation + size_t(i) * dim;
+        float dot        = 0;
+#pragma omp simd reduction(+ : dot)
+        for (uint32_t j = 0; j < dim; j++) {
+          dot += row[j] * query[j];
+        }
+        rot_query[i] = dot;
+      }
+    }
+  }
+}
+
+/**
+ * Scan the probed lists group by group and collect the candidates in per-thread top-k heaps.
+ *
+ * Every task unpacks a range of the interleaved groups of one list once, then scans it for all
+ * the queries of the batch that probe the list, with a look up table computed per query:
+ *
+ *   - `pq_bits == 4` (fast scan): the table is quantized to 8 bits and the lower bounds of the
+ *     scores of a group are computed with in-register shuffles (`host_fast_scan_group`). Only
+ *     the records whose bound passes the current top-k threshold are scored exactly, so that the
+ *     results are the same as with the float table.
+ *   - otherwise: the codes are unpacked into bytes and the float table entries are gathered.
+ *
+ * Must be called from within an OpenMP parallel region.
+ */
+template <typename IdxT, typename IvfSampleFilterT>
+void host_scan_lists(const host_index<IdxT>& index,
+                     const float* rot_queries,
+                     uint32_t n_queries,
+                     uint32_t queries_offset,
+                     uint32_t k,
+                     const std::vector<host_scan_task>& tasks,
+                     const std::vector<uint32_t>& list_offsets,
+                     const std::vector<uint32_t>& list_queries,
+                     float* heap_scores,
+                     IdxT* heap_ids,
+                     uint32_t* heap_sizes,
+                     IvfSampleFilterT sample_filter)
+{
+  const uint32_t pq_bits     = index.pq_bits();
+  const uint32_t pq_dim      = index.pq_dim();
+  const uint32_t book_size   = index.pq_book_size();
+  const uint32_t n_chunks    = raft::div_rounding_up_safe(pq_dim, host_chunk_size(pq_bits));
+  const bool fast_scan       = pq_bits == 4;
+  const bool inner_product   = index.metric() == raft::distance::DistanceType::InnerProduct;
+  const size_t group_bytes   = host_group_bytes(pq_bits, pq_dim);
+  const size_t decoded_bytes = fast_scan ? group_bytes : size_t(pq_dim) * kIndexGroupSize;
+  const size_t tid           = omp_get_thread_num();
+  heap_scores += tid * n_queries * k;
+  heap_ids += tid * n_queries * k;
+  heap_sizes += tid * n_queries;
+  std::fill(heap_sizes, heap_sizes + n_queries, 0);
+
+  std::vector<uint8_t> decoded;
+  std::vector<float> lut(size_t(pq_dim) * book_size);
+  std::vector<uint8_t> qlut(fast_scan ? size_t(n_chunks) * host_chunk_size(4) * 16 : 0);
+  float scores[kIndexGroupSize];
+  uint32_t acc[kIndexGroupSize];
+#pragma omp for schedule(dynamic, 1)
+  for (size_t task_ix = 0; task_ix < tasks.size(); task_ix++) {
+    const auto& task             = tasks[task_ix];
+    const auto& list             = *index.lists()[task.label];
+    const uint32_t* task_queries = list_queries.data() + list_offsets[task.label];
+    uint32_t n_task_queries      = list_offsets[task.label + 1] - list_offsets[task.label];
+
+    decoded.resize(size_t(task.group_end - task.group_begin) * decoded_bytes);
+    for (uint32_t group_ix = task.group_begin; group_ix < task.group_end; group_ix++) {
+      const uint8_t* group = list.data.data_handle() + size_t(group_ix) * group_bytes;
+      uint8_t* out         = decoded.data() + size_t(group_ix - task.group_begin) * decoded_bytes;
+      if (fast_scan) {
+        host_transpose_group(group, n_chunks, out);
+      } else {
+        host_decode_group(group, pq_bits, pq_dim, out);
+      }
+    }
+
+    for (uint32_t i = 0; i < n_task_queries; i++) {
+      uint32_t query_ix = task_queries[i];
+      host_compute_lut(index,
+                       rot_queries + size_t(query_ix) * index.rot_dim(),
+                       task.label,
+                       inner_product,
+                       lut.data());
+      host_lut_bounds bounds{};
+      if (fast_scan) { bounds = host_quantize_lut(lut.data(), pq_dim, n_chunks, qlut.data()); }
+
+      float* query_heap_scores = heap_scores + size_t(query_ix) * k;
+      IdxT* query_heap_ids     = heap_ids + size_t(query_ix) * k;
+      uint32_t& heap_size      = heap_sizes[query_ix];
+      float threshold =
+        heap_size < k ? std::numeric_limits<float>::infinity() : query_heap_scores[0];
+      for (uint32_t group_ix = task.group_begin; group_ix < task.group_end; group_ix++) {
+        const uint8_t* group = decoded.data() + size_t(group_ix - task.group_begin) * decoded_bytes;
+        uint32_t row_offset  = group_ix * kIndexGroupSize;
+        uint32_t n_rows      = std::min(kIndexGroupSize, list.size - row_offset);
+        if (fast_scan) {
+          host_fast_scan_group(group, qlut.data(), n_chunks, acc);
+        } else {
+          host_gather_scores(group, lut.data(), pq_dim, book_size, scores);
+        }
+        for (uint32_t r = 0; r < n_rows; r++) {
+          float score;
+          if (fast_scan) {
+            float lower_bound = bounds.bias + bounds.step * float(acc[r]) - bounds.margin;
+            if (!(lower_bound < threshold)) { continue; }
+            score = host_packed_score(group, lut.data(), pq_dim, r);
+          } else {
+            score = scores[r];
+          }
+          if (!(score < threshold)) { continue; }
+          if (!sample_filter(queries_offset + query_ix, task.label, row_offset + r)) { continue; }
+          host_topk_push(
+            query_heap_scores, query_heap_ids, heap_size, k, score, list.indices(row_offset + r));
+          if (heap_size == k) { threshold = query_heap_scores[0]; }
+        }
+      }
+    }
+  }
+}
+
+template <typename T, typename IdxT, typename IvfSampleFilterT>
+void search_impl(const host_index<IdxT>& index,
+                 const T* queries,
+                 uint32_t n_queries,
+                 uint32_t k,
+                 uint32_t n_probes,
+                 int n_threads,
+                 uint32_t max_batch_size,
+                 IdxT* neighbors,
+                 float* distances,
+                 IvfSampleFilterT sample_filter)
+{
+  // The groups unpacked by one task: about the size of the L2 cache
+  constexpr size_t kTaskBytes = 256 * 1024;
+
+  // A batch size heuristic: keep the per-thread heaps, the probes and the rotated queries within
+  // the workspace size
+  uint64_t ws_size_per_query =
+    uint64_t(n_threads) * (k * (sizeof(float) + sizeof(IdxT)) + sizeof(uint32_t)) +
+    2 * sizeof(uint32_t) * n_probes + sizeof(float) * index.rot_dim();
+  const uint32_t max_queries =
+    ivf::detail::host_batch_size(n_queries, max_batch_size, ws_size_per_query);
+
+  std::vector<uint32_t> probes(size_t(max_queries) * n_probes);
+  std::vector<float> rot_queries(size_t(max_queries) * index.rot_dim());
+  std::vector<float> heap_scores(size_t(n_threads) * max_queries * k);
+  std::vector<IdxT> heap_ids(size_t(n_threads) * max_queries * k);
+  std::vector<uint32_t> heap_sizes(size_t(n_threads) * max_queries);
+  std::vector<uint32_t> list_offsets(index.n_lists() + 1);
+  std::vector<uint32_t> list_queries(size_t(max_queries) * n_probes);
+  std::vector<host_scan_task> tasks;
+
+  const size_t decoded_bytes = index.pq_bits() == 4
+                                 ? host_group_bytes(index.pq_bits(), index.pq_dim())
+                                 : size_t(index.pq_dim()) * kIndexGroupSize;
+
+  // The scores are computed in the scale of the training data (see `host_query_scale`)
+  const auto metric        = index.metric();
+  const bool inner_product = metric == raft::distance::DistanceType::InnerProduct;
+  const bool take_sqrt     = metric == raft::distance::DistanceType::L2SqrtExpanded;
+  const float scale        = 1.0f / host_query_scale<T>();
+
+  for (uint32_t offset_q = 0; offset_q < n_queries; offset_q += max_queries) {
+    uint32_t queries_batch = std::min(max_queries, n_queries - offset_q);
+    const T* batch_queries = queries + size_t(offset_q) * index.dim();
+    uint32_t n_heaps       = 0;
+
+#pragma omp parallel num_threads(n_threads)
+    {
+      host_select_clusters(
+        index, batch_queries, queries_batch, n_probes, probes.data(), rot_queries.data());
+
+#pragma omp single
+      {
+        n_heaps = omp_get_num_threads();
+
+        ivf::detail::host_group_by_list(
+          probes.data(), queries_batch, n_probes, list_offsets, list_queries);
+        ivf::detail::host_make_scan_tasks(
+          index.list_sizes(),
+          index.n_lists(),
+          kIndexGroupSize,
+          list_offsets,
+          [&](uint32_t) { return kTaskBytes / decoded_bytes; },
+          tasks);
+      }
+
+      host_scan_lists(index,
+                      rot_queries.data(),
+                      queries_batch,
+                      offset_q,
+                      k,
+                      tasks,
+                      list_offsets,
+                      list_queries,
+                      heap_scores.data(),
+                      heap_ids.data(),
+                      heap_sizes.data(),
+                      sample_filter);
+
+      ivf::detail::host_merge_topk(
+        queries_batch,
+        k,
+        n_heaps,
+        heap_scores.data(),
+        heap_ids.data(),
+        heap_sizes.data(),
+        neighbors + size_t(offset_q) * k,
+        distances + size_t(offset_q) * k,
+        inner_product ? std::numeric_limits<float>::lowest() : std::numeric_limits<float>::max(),
+        [inner_product, take_sqrt, scale](float score) {
+          if (inner_product) { return -score * scale * scale; }
+          return take_sqrt ? std::sqrt(score) * scale : score * scale * scale;
+        });
+    }
+  }
+}
+
+/** See raft::neighbors::ivf_pq::search (host_index) docs */
+template <typename T,
+          typename IdxT,
+          typename IvfSampleFilterT = raft::neighbors::filtering::none_ivf_sample_filter>
+inline void search(const host_search_params& params,
+                   const host_index<IdxT>& index,
+                   const T* queries,
+                   uint32_t n_queries,
+                   uint32_t k,
+                   IdxT* neighbors,
+                   float* distances,
+                   IvfSampleFilterT sample_filter = IvfSampleFilterT())
+{
+  static_assert(std::is_same_v<T, float> || std::is_same_v<T, uint8_t> || std::is_same_v<T, int8_t>,
+                "Unsupported element type.");
+  common::nvtx::range<common::nvtx::domain::raft> fun_scope(
+    "ivf_pq::search_host(k = %u, n_queries = %u, dim = %u)", k, n_queries, index.dim());
+
+  RAFT_EXPECTS(params.n_probes > 0,
+               "n_probes (number of clusters to probe in the search) must be positive.");
+  switch (index.metric()) {
+    case raft::distance::DistanceType::L2Expanded:
+    case raft::distance::DistanceType::L2SqrtExpanded:
+    case raft::distance::DistanceType::InnerProduct: break;
+    default: RAFT_FAIL("Unsupported distance type %d.", int(index.metric()));
+  }
+  if (n_queries == 0 || k == 0) { return; }
+  auto n_probes = std::min<uint32_t>(params.n_probes, index.n_lists());
+  int n_threads = params.num_threads > 0 ? params.num_threads : omp_get_max_threads();
+
+  // The filters taking the source index of a sample see it through the list indices
+  auto filter = raft::neighbors::filtering::ivf_to_sample_filter(
+    index.inds_ptrs().data_handle(), sample_filter);
+
+  search_impl(index,
+              queries,
+              n_queries,
+              k,
+              n_probes,
+              n_threads,
+              params.max_queries,
+              neighbors,
+              distances,
+              filter);
+}
+
+}  // namespace raft::neighbors::ivf_pq::detail
@@ -0,0 +1,264 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <raft/core/detail/mdspan_numpy_serializer.hpp>
+#include <raft/core/error.hpp>
+#include <raft/core/host_mdarray.hpp>
+#include <raft/core/host_mdspan.hpp>
+#include <raft/core/logger.hpp>
+#include <raft/core/resources.hpp>
+#include <raft/core/serialize.hpp>
+#include <raft/neighbors/detail/ivf_container.hpp>
+#include <raft/neighbors/ivf_container_types.hpp>
+#include <raft/neighbors/ivf_pq_host_types.hpp>
+
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace raft::neighbors::ivf_pq::detail {
+
+// Serialization version
+// No backward compatibility yet; that is, can't add additional fields without breaking
+// backward compatibility. The host indexes are saved in the extensible index container instead
+// (see `serialize_host` and `detail/ivf_container.hpp`).
+constexpr int kSerializationVersion = 3;
+
+/**
+ * Load an index written by `ivf_pq::serialize` into host memory.
+ *
+ * The stream layout is the one of `detail::deserialize` in `ivf_pq_serialize.cuh`; the lists
+ * are kept in their serialized interleaved layout.
+ *
+ * @param[in] handle the raft handle
+ * @param[in] is input stream
+ */
+template <typename IdxT>
+auto deserialize_host(raft::resources const& handle, std::istream& is) -> host_index<IdxT>
+{
+  auto ver = deserialize_scalar<int>(handle, is);
+  if (ver != kSerializationVersion) {
+    RAFT_FAIL("serialization version mismatch %d vs. %d", ver, kSerializationVersion);
+  }
+  auto n_rows  = deserialize_scalar<IdxT>(handle, is);
+  auto dim     = deserialize_scalar<std::uint32_t>(handle, is);
+  auto pq_bits = deserialize_scalar<std::uint32_t>(handle, is);
+  auto pq_dim  = deserialize_scalar<std::uint32_t>(handle, is);
+  auto cma     = deserialize_scalar<bool>(handle, is);
+
+  auto metric        = deserialize_scalar<raft::distance::DistanceType>(handle, is);
+  auto codebook_kind = deserialize_scalar<raft::neighbors::ivf_pq::codebook_gen>(handle, is);
+  auto n_lists       = deserialize_scalar<std::uint32_t>(handle, is);
+
+  RAFT_LOG_DEBUG("n_rows %zu, dim %d, pq_dim %d, pq_bits %d, n_lists %d",
+                 static_cast<std::size_t>(n_rows),
+                 static_cast<int>(dim),
+                 static_cast<int>(pq_dim),
+                 static_cast<int>(pq_bits),
+                 static_cast<int>(n_lists));
+  RAFT_EXPECTS(pq_bits >= 4 && pq_bits <= 8 && pq_dim > 0, "Error inconsistent PQ parameters");
+
+  host_index<IdxT> index_(metric, codebook_kind, n_lists, dim, pq_bits, pq_dim, cma);
+
+  deserialize_mdspan(handle, is, index_.pq_centers());
+  deserialize_mdspan(handle, is, index_.centers());
+  deserialize_mdspan(handle, is, index_.centers_rot());
+  deserialize_mdspan(handle, is, index_.rotation_matrix());
+  auto list_sizes = make_host_vector<uint32_t, uint32_t>(n_lists);
+  deserialize_mdspan(handle, is, list_sizes.view());
+
+  auto list_store_spec = list_spec<uint32_t, IdxT>{pq_bits, pq_dim, true};
+  for (uint32_t label = 0; label < n_lists; label++) {
+    auto size = deserialize_scalar<uint32_t>(handle, is);
+    if (size == 0) { continue; }
+    RAFT_EXPECTS(size == list_sizes(label), "Error inconsistent list size");
+    auto& list = index_.lists()[label].emplace(list_store_spec, size);
+    deserialize_mdspan(handle, is, list.data);
+    deserialize_mdspan(handle, is, list.indices);
+  }
+  index_.recompute_internal_state();
+  RAFT_EXPECTS(index_.size() == n_rows, "Error inconsistent index size");
+
+  return index_;
+}
+
+/**
+ * Save a host index into an index container (see `detail/ivf_container.hpp`); the lists are
+ * written in parallel.
+ */
+template <typename IdxT>
+void serialize_host(raft::resources const& handle,
+                    const std::string& filename,
+                    const host_index<IdxT>& index,
+                    int num_threads)
+{
+  using ivf::detail::container_param;
+  using ivf::detail::container_section;
+  ivf::detail::container_params params;
+  params.set(container_param::kIndexKind, std::string("ivf_pq"));
+  params.set(container_param::kIndexDtype,
+             raft::detail::numpy_serializer::get_numpy_dtype<IdxT>().to_string());
+  params.set(container_param::kSize, static_cast<uint64_t>(index.size()));
+  params.set(container_param::kDim, index.dim());
+  params.set(container_param::kNLists, index.n_lists());
+  params.set(container_param::kMetric, static_cast<uint32_t>(index.metric()));
+  params.set(container_param::kConservativeMemoryAllocation,
+             static_cast<uint8_t>(index.conservative_memory_allocation()));
+  params.set(container_param::kPqBits, index.pq_bits());
+  params.set(container_param::kPqDim, index.pq_dim());
+  params.set(container_param::kCodebookKind, static_cast<uint32_t>(index.codebook_kind()));
+
+  std::vector<ivf::detail::container_array> arrays{
+    {container_section::kPqCenters,
+     index.pq_centers().data_handle(),
+     index.pq_centers().size() * sizeof(float)},
+    {container_section::kCenters,
+     index.centers().data_handle(),
+     index.centers().size() * sizeof(float)},
+    {container_section::kCentersRot,
+     index.centers_rot().data_handle(),
+     index.centers_rot().size() * sizeof(float)},
+    {container_section::kRotationMatrix,
+     index.rotation_matrix().data_handle(),
+     index.rotation_matrix().size() * sizeof(float)}};
+  std::vector<ivf::detail::container_list> lists(index.n_lists());
+  for (uint32_t label = 0; label < index.n_lists(); label++) {
+    const auto& list = index.lists()[label];
+    if (!list.has_value() || list->size == 0) { continue; }
+    lists[label] = {list->data.data_handle(),
+                    list->data.size(),
+                    list->indices.data_handle(),
+                    list->indices.size() * sizeof(IdxT),
+                    list->size};
+  }
+  ivf::detail::write_container(filename, params, arrays, lists, num_threads);
+}
+
+/**
+ * Load a host index from an index container, either reading the lists in parallel or mapping
+ * them into memory (see `ivf::container_load_params`).
+ */
+template <typename IdxT>
+auto deserialize_container(raft::resources const& handle,
+                           const std::string& filename,
+                           const ivf::container_load_params& load_params) -> host_index<IdxT>
+{
+  using ivf::detail::container_param;
+  using ivf::detail::container_section;
+  ivf::detail::container_reader reader(filename);
+  const auto& params = reader.params();
+  RAFT_EXPECTS(params.get_string(container_param::kIndexKind) == "ivf_pq",
+               "File %s doesn't contain an IVF-PQ index",
+               filename.c_str());
+  RAFT_EXPECTS(params.get_string(container_param::kIndexDtype) ==
+                 raft::detail::numpy_serializer::get_numpy_dtype<IdxT>().to_string(),
+               "The index was serialized with a different index type");
+  auto n_rows  = params.get<uint64_t>(container_param::kSize);
+  auto dim     = params.get<uint32_t>(container_param::kDim);
+  auto n_lists = params.get<uint32_t>(container_param::kNLists);
+  auto metric =
+    static_cast<raft::distance::DistanceType>(params.get<uint32_t>(container_param::kMetric));
+  bool cma     = params.get<uint8_t>(container_param::kConservativeMemoryAllocation, 0) != 0;
+  auto pq_bits = params.get<uint32_t>(container_param::kPqBits);
+  auto pq_dim  = params.get<uint32_t>(container_param::kPqDim);
+  auto codebook_kind =
+    static_cast<codebook_gen>(params.get<uint32_t>(container_param::kCodebookKind));
+  RAFT_EXPECTS(pq_bits >= 4 && pq_bits <= 8 && pq_dim > 0, "Error inconsistent PQ parameters");
+  RAFT_EXPECTS(reader.n_lists() == n_lists, "Error inconsistent list directory");
+
+  host_index<IdxT> index_(metric, codebook_kind, n_lists, dim, pq_bits, pq_dim, cma);
+  reader.read_section(container_section::kPqCenters,
+                      index_.pq_centers().data_handle(),
+                      index_.pq_centers().size() * sizeof(float));
+  reader.read_section(container_section::kCenters,
+                      index_.centers().data_handle(),
+                      index_.centers().size() * sizeof(float));
+  reader.read_section(container_section::kCentersRot,
+                      index_.centers_rot().data_handle(),
+                      index_.centers_rot().size() * sizeof(float));
+  reader.read_section(container_section::kRotationMatrix,
+                      index_.rotation_matrix().data_handle(),
+                      index_.rotation_matrix().size() * sizeof(float));
+
+  auto list_store_spec = list_spec<uint32_t, IdxT>{pq_bits, pq_dim, true};
+  for (uint32_t label = 0; label < n_lists; label++) {
+    const auto& entry = reader.list(label);
+    auto extents      = list_store_spec.make_list_extents(entry.size);
+    uint64_t data_size =
+      uint64_t(extents.extent(0)) * extents.extent(1) * extents.extent(2) * extents.extent(3);
+    RAFT_EXPECTS(entry.size == 0 || (entry.data_size == data_size &&
+                                     entry.indices_size == uint64_t(entry.size) * sizeof(IdxT)),
+                 "Error inconsistent list size");
+  }
+  std::shared_ptr<ivf::detail::container_mapping> mapping;
+  if (load_params.mmap_lists) { mapping = reader.map(); }
+  ivf::detail::container_for_each_list(n_lists, load_params.num_threads, [&](uint32_t label) {
+    const auto& entry = reader.list(label);
+    if (entry.size == 0) { return; }
+    auto& list = index_.lists()[label];
+    if (mapping) {
+      using list_extents = typename host_list_data<IdxT>::list_extents;
+      list.emplace(host_mdspan<uint8_t, list_extents, row_major>{
+                     mapping->data() + entry.data_offset,
+                     list_store_spec.make_list_extents(entry.size)},
+                   make_host_vector_view<IdxT, uint32_t>(
+                     reinterpret_cast<IdxT*>(mapping->data() + entry.indices_offset), entry.size),
+                   entry.size,
+                   mapping);
+    } else {
+      list.emplace(list_store_spec, entry.size);
+      reader.read_list(label, list->data.data_handle(), list->indices.data_handle());
+    }
+  });
+  index_.recompute_internal_state();
+  RAFT_EXPECTS(index_.size() == IdxT(n_rows), "Error inconsistent index size");
+
+  return index_;
+}
+
+template <typename IdxT>
+auto deserialize_host(raft::resources const& handle,
+                      const std::string& filename,
+                      const ivf::container_load_params& load_params) -> host_index<IdxT>
+{
+  if (ivf::detail::is_container(filename)) {
+    return deserialize_container<IdxT>(handle, filename, load_params);
+  }
+  RAFT_EXPECTS(!load_params.mmap_lists,
+               "Only the indexes saved with `serialize_host` can be mapped into memory");
+
+  std::ifstream infile(filename, std::ios::in | std::ios::binary);
+
+  if (!infile) { RAFT_FAIL("Cannot open file %s", filename.c_str()); }
+
+  auto index = detail::deserialize_host<IdxT>(handle, infile);
+
+  infile.close();
+
+  return index;
+}
+
+template <typename IdxT>
+auto deserialize_host(raft::resources const& handle, const std::string& filename)
+  -> host_index<IdxT>
+{
+  return detail::deserialize_host<IdxT>(handle, filename, ivf::container_load_params{});
+}
+
+}  // namespace raft::neighbors::ivf_pq::detail
@@ -22,6 +22,7 @@
 #include <raft/core/resources.hpp>
 #include <raft/core/serialize.hpp>
 #include <raft/neighbors/detail/ivf_pq_build.cuh>
+#include <raft/neighbors/detail/ivf_pq_host_serialize.hpp>  // kSerializationVersion
 #include <raft/neighbors/ivf_list.hpp>
 #include <raft/neighbors/ivf_pq_types.hpp>
 
@@ -30,13 +31,6 @@
 
 namespace raft::neighbors::ivf_pq::detail {
 
-// Serialization version
-// No backward compatibility yet; that is, can't add additional fields without breaking
-// backward compatibility.
-// TODO(hcho3) Implement next-gen serializer for IVF that allows for expansion in a backward
-//             compatible fashion.
-constexpr int kSerializationVersion = 3;
-
 /**
  * Write the index to an output stream
  *
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+
+namespace raft::neighbors::ivf {
+
+/**
+ * @brief Parameters of loading a host IVF index from an index container file.
+ *
+ * The container (written by `ivf_flat::serialize_host` / `ivf_pq::serialize_host`) stores every
+ * list at its own page-aligned offset, so that the lists can be read in parallel or mapped into
+ * memory without reading them.
+ */
+struct container_load_params {
+  /**
+   * Map the lists into memory instead of reading them. The pages of a list are read from the disk
+   * when the list is first probed, so that a search only loads the lists it probes and the memory
+   * of the unused lists is never allocated. The mapping is copy-on-write: changing a list doesn't
+   * change the file.
+   */
+  bool mmap_lists = false;
+  /**
+   * Number of host threads reading the lists (unless they are mapped). Value of 0 uses the OpenMP
+   * default (`omp_get_max_threads()`).
+   */
+  int num_threads = 0;
+};
+
+static_assert(std::is_aggregate_v<container_load_params>);
+
+/**
+ * @brief Parameters of the list cache of a disk-resident index.
+ *
+ * A disk-resident index (see `ivf_flat::deserialize_disk`) keeps only the centers and the list
+ * directory of an index container in memory; the search reads the probed lists from the file
+ * into a bounded cache.
+ */
+struct list_cache_params {
+  /**
+   * The maximum total size of the lists held in the cache, in bytes. The search processes the
+   * probed lists of a batch of queries in chunks that fit into the cache.
+   */
+  uint64_t capacity_bytes = uint64_t(1) << 30;
+  /**
+   * Number of the shards of the cache. Every shard is an LRU list with its own lock, holding the
+   * lists with `label % n_shards` equal to the shard index; the shards share the `capacity_bytes`
+   * budget. A list larger than the whole cache isn't cached, but read by every search probing it.
+   */
+  uint32_t n_shards = 16;
+  /**
+   * Read the lists of the next chunk (possibly of the next batch of queries) in the background
+   * while scanning the current one. Half of the cache is then reserved for the readahead.
+   */
+  bool readahead = true;
+};
+
+static_assert(std::is_aggregate_v<list_cache_params>);
+
+/** @brief Counters of the list cache of a disk-resident index. */
+struct list_cache_stats {
+  /** Number of the probed lists found in the cache. */
+  uint64_t hits = 0;
+  /** Number of the probed lists not found in the cache. */
+  uint64_t misses = 0;
+  /** Number of the lists added to the cache ahead of the search. */
+  uint64_t readahead = 0;
+  /** Number of the lists evicted from the cache. */
+  uint64_t evictions = 0;
+  /** Total size of the lists held in the cache, in bytes. */
+  uint64_t resident_bytes = 0;
+};
+
+}  // namespace raft::neighbors::ivf
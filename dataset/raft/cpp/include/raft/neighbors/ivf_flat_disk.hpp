@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "detail/ivf_flat_disk.hpp"
+#include "ivf_container_types.hpp"
+#include "ivf_flat_disk_types.hpp"
+
+#include <raft/core/host_mdspan.hpp>
+#include <raft/core/resources.hpp>
+#include <raft/neighbors/sample_filter_types.hpp>
+
+#include <cstdint>
+#include <string>
+
+namespace raft::neighbors::ivf_flat {
+
+/**
+ * @ingroup ivf_flat
+ * @{
+ */
+
+/**
+ * Open an index container file for the search from the disk.
+ *
+ * Only the parameters, the cluster centers and the list directory are read; the lists stay on the
+ * disk and are read by the search into a list cache of `cache_params.capacity_bytes`.
+ *
+ * @code{.cpp}
+ * #include <raft/core/resources.hpp>
+ *
+ * raft::resources handle;
+ *
+ * raft::neighbors::ivf::list_cache_params cache_params;
+ * cache_params.capacity_bytes = size_t(4) << 30;
+ * using T    = float; // data element type
+ * using IdxT = int64_t; // type of the index
+ * // the index saved with `ivf_flat::serialize_host(handle, "host_index.bin", index)`
+ * auto index = raft::neighbors::ivf_flat::deserialize_disk<T, IdxT>(
+ *   handle, "host_index.bin", cache_params);
+ * @endcode
+ *
+ * @tparam T data element type
+ * @tparam IdxT type of the indices
+ *
+ * @param[in] handle the raft handle
+ * @param[in] filename the name of the index container file
+ * @param[in] cache_params configure the list cache
+ *
+ * @return raft::neighbors::ivf_flat::disk_index<T, IdxT>
+ */
+template <typename T, typename IdxT>
+disk_index<T, IdxT> deserialize_disk(raft::resources const& handle,
+                                     const std::string& filename,
+                                     const ivf::list_cache_params& cache_params = {})
+{
+  return detail::deserialize_disk<T, IdxT>(handle, filename, cache_params);
+}
+
+/**
+ * @brief Search ANN on the CPU using an index on the disk, with the given filter.
+ *
+ * The search is the one of the in-memory `host_index`, with the lists read from the index
+ * container on demand. The probes of a batch of queries are sorted by the list, so that every
+ * probed list is read once per batch, in the order of the lists in the file. The probed lists are
+ * scanned in chunks fitting into the list cache; with `cache_params.readahead`, the lists of the
+ * next chunk (or of the next batch of queries) are read while the current chunk is scanned. The
+ * lists stay in the cache across the searches, up to its capacity, least recently used first out.
+ *
+ * The results are the same as the search of the index loaded into memory.
+ *
+ * Usage example:
+ * @code{.cpp}
+ *   using namespace raft::neighbors;
+ *   auto index = ivf_flat::deserialize_disk<float, int64_t>(handle, "host_index.bin");
+ *   ivf_flat::host_search_params search_params;
+ *   search_params.n_probes = 50;
+ *   auto neighbors = raft::make_host_matrix<int64_t, int64_t>(n_queries, k);
+ *   auto distances = raft::make_host_matrix<float, int64_t>(n_queries, k);
+ *   ivf_flat::search_with_filtering(handle, search_params, index, queries,
+ *                                   neighbors.view(), distances.view(), filter);
+ *   auto stats = index.cache_stats();  // the hits and misses of the list cache
+ * @endcode
+ *
+ * @tparam T data element type
+ * @tparam IdxT type of the indices
+ * @tparam IvfSampleFilterT Host filter function, with the signature
+ *         `(uint32_t query_ix, uint32 cluster_ix, uint32_t sample_ix) -> bool` or
+ *         `(uint32_t query_ix, uint32 sample_ix) -> bool`
+ *
+ * @param[in] handle
+ * @param[in] params configure the search
+ * @param[in] index ivf-flat index on the disk
+ * @param[in] queries a host matrix view to a row-major matrix [n_queries, index->dim()]
+ * @param[out] neighbors a host matrix view to the indices of the neighbors in the source dataset
+ * [n_queries, k]
+ * @param[out] distances a host matrix view to the distances to the selected neighbors
+ * [n_queries, k]
+ * @param[in] sample_filter a host filter function that greenlights samples for a given query
+ */
+template <typename T, typename IdxT, typename IvfSampleFilterT>
+void search_with_filtering(raft::resources const& handle,
+                           const host_search_params& params,
+                           const disk_index<T, IdxT>& index,
+                           raft::host_matrix_view<const T, IdxT, row_major> queries,
+                           raft::host_matrix_view<IdxT, IdxT, row_major> neighbors,
+                           raft::host_matrix_view<float, IdxT, row_major> distances,
+                           IvfSampleFilterT sample_filter = IvfSampleFilterT())
+{
+  RAFT_EXPECTS(
+    queries.extent(0) == neighbors.extent(0) && queries.extent(0) == distances.extent(0),
+    "Number of rows in output neighbors and distances matrices must equal the number of queries.");
+
+  RAFT_EXPECTS(neighbors.extent(1) == distances.extent(1),
+               "Number of columns in output neighbors and distances matrices must be equal");
+
+  RAFT_EXPECTS(queries.extent(1) == index.dim(),
+               "Number of query dimensions should equal number of dimensions in the index.");
+
+  detail::search(params,
+                 index,
+                 queries.data_handle(),
+                 static_cast<std::uint32_t>(queries.extent(0)),
+                 static_cast<std::uint32_t>(neighbors.extent(1)),
+                 neighbors.data_handle(),
+                 distances.data_handle(),
+                 sample_filter);
+}
+
+/**
+ * @brief Search ANN on the CPU using an index on the disk.
+ *
+ * See `search_with_filtering` for the description and a usage example.
+ *
+ * @tparam T data element type
+ * @tparam IdxT type of the indices
+ *
+ * @param[in] handle
+ * @param[in] params configure the search
+ * @param[in] index ivf-flat index on the disk
+ * @param[in] queries a host matrix view to a row-major matrix [n_queries, index->dim()]
+ * @param[out] neighbors a host matrix view to the indices of the neighbors in the source dataset
+ * [n_queries, k]
+ * @param[out] distances a host matrix view to the distances to the selected neighbors
+ * [n_queries, k]
+ */
+template <typename T, typename IdxT>
+void search(raft::resources const& handle,
+            const host_search_params& params,
+            const disk_index<T, IdxT>& index,
+            raft::host_matrix_view<const T, IdxT, row_major> queries,
+            raft::host_matrix_view<IdxT, IdxT, row_major> neighbors,
+            raft::host_matrix_view<float, IdxT, row_major> distances)
+{
+  search_with_filtering(handle,
+                        params,
+                        index,
+                        queries,
+                        neighbors,
+                        distances,
+                        raft::neighbors::filtering::none_ivf_sample_filter());
+}
+
+/** @} */
+
+}  // namespace raft::neighbors::ivf_flat
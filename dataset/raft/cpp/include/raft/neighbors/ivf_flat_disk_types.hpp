@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <raft/core/host_mdarray.hpp>
+#include <raft/core/host_mdspan.hpp>
+#include <raft/distance/distance_types.hpp>
+#include <raft/neighbors/detail/ivf_container.hpp>
+#include <raft/neighbors/detail/ivf_list_cache.hpp>
+#include <raft/neighbors/ivf_container_types.hpp>
+#include <raft/neighbors/ivf_flat_host_types.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+namespace raft::neighbors::ivf_flat {
+/**
+ * @addtogroup ivf_flat
+ * @{
+ */
+
+/**
+ * @brief IVF-flat index searched on the CPU without loading its lists into memory.
+ *
+ * The index keeps the index container file (see `ivf_flat::serialize_host`) open; only the
+ * cluster centers and the list directory are held in memory. The search (see `ivf_flat::search`
+ * in `raft/neighbors/ivf_flat_disk.hpp`) reads the probed lists from the file into a bounded list
+ * cache (see `ivf::list_cache_params`), so that the index may be much larger than the host memory.
+ *
+ * @tparam T data element type
+ * @tparam IdxT type of the indices in the source dataset
+ */
+template <typename T, typename IdxT>
+struct disk_index {
+ public:
+  using list_type = host_list_data<T, IdxT>;
+
+  /** Size of the interleaved data chunks, the same as `index::veclen()`. */
+  [[nodiscard]] constexpr inline auto veclen() const noexcept -> uint32_t
+  {
+    return centers_.veclen();
+  }
+  /** Distance metric used for clustering. */
+  [[nodiscard]] constexpr inline auto metric() const noexcept -> raft::distance::DistanceType
+  {
+    return centers_.metric();
+  }
+  /** Total length of the index. */
+  [[nodiscard]] constexpr inline auto size() const noexcept -> IdxT { return size_; }
+  /** Dimensionality of the data. */
+  [[nodiscard]] constexpr inline auto dim() const noexcept -> uint32_t { return centers_.dim(); }
+  /** Number of clusters/inverted lists. */
+  [[nodiscard]] constexpr inline auto n_lists() const noexcept -> uint32_t
+  {
+    return centers_.n_lists();
+  }
+  /** k-means cluster centers corresponding to the lists [n_lists, dim] */
+  [[nodiscard]] inline auto centers() const noexcept
+    -> host_matrix_view<const float, uint32_t, row_major>
+  {
+    return centers_.centers();
+  }
+  /** Sizes of the lists (clusters) [n_lists]. */
+  [[nodiscard]] inline auto list_sizes() const noexcept
+    -> host_vector_view<const uint32_t, uint32_t>
+  {
+    return list_sizes_.view();
+  }
+  /** The in-memory part of the index: the parameters and the centers, without the lists. */
+  [[nodiscard]] inline auto resident() const noexcept -> const host_index<T, IdxT>&
+  {
+    return centers_;
+  }
+  /** Parameters of the list cache. */
+  [[nodiscard]] inline auto cache_params() const noexcept -> const ivf::list_cache_params&
+  {
+    return cache_params_;
+  }
+  /** Counters of the list cache, accumulated over all searches. */
+  [[nodiscard]] inline auto cache_stats() const -> ivf::list_cache_stats
+  {
+    return cache_->stats();
+  }
+
+  /** The size of a list in the file (data and indices), in bytes. */
+  [[nodiscard]] inline auto list_bytes(uint32_t label) const -> uint64_t
+  {
+    const auto& entry = reader_->list(label);
+    return entry.data_size + entry.indices_size;
+  }
+  /** Read a list from the file, bypassing the cache. Thread-safe. */
+  [[nodiscard]] auto read_list(uint32_t label) const -> std::shared_ptr<const list_type>
+  {
+    auto list = std::make_shared<list_type>(dim(), list_sizes_(label));
+    reader_->read_list(label, list->data.data_handle(), list->indices.data_handle());
+    return list;
+  }
+  /** The list cache; shared by all searches of the index. */
+  [[nodiscard]] inline auto cache() const noexcept -> ivf::detail::host_list_cache<list_type>&
+  {
+    return *cache_;
+  }
+
+  // Don't allow copying the index for performance reasons (try avoiding copying data)
+  disk_index(const disk_index&)                    = delete;
+  disk_index(disk_index&&)                         = default;
+  auto operator=(const disk_index&) -> disk_index& = delete;
+  auto operator=(disk_index&&) -> disk_index&      = default;
+  ~disk_index()                                    = default;
+
+  /**
+   * Construct a disk-resident index from the in-memory part of an index and the reader of its
+   * index container (see `ivf_flat::deserialize_disk`).
+   */
+  disk_index(host_index<T, IdxT>&& centers,
+             std::unique_ptr<ivf::detail::container_reader> reader,
+             const ivf::list_cache_params& cache_params)
+    : centers_{std::move(centers)},
+      reader_{std::move(reader)},
+      cache_params_{cache_params},
+      cache_{std::make_unique<ivf::detail::host_list_cache<list_type>>(cache_params.capacity_bytes,
+                                                                        cache_params.n_shards)},
+      list_sizes_{make_host_vector<uint32_t, uint32_t>(centers_.n_lists())},
+      size_{0}
+  {
+    for (uint32_t label = 0; label < n_lists(); label++) {
+      list_sizes_(label) = reader_->list(label).size;
+      size_ += list_sizes_(label);
+    }
+  }
+
+ private:
+  host_index<T, IdxT> centers_;
+  std::unique_ptr<ivf::detail::container_reader> reader_;
+  ivf::list_cache_params cache_params_;
+  std::unique_ptr<ivf::detail::host_list_cache<list_type>> cache_;
+  host_vector<uint32_t, uint32_t> list_sizes_;
+  IdxT size_;
+};
+
+/** @} */
+
+}  // namespace raft::neighbors::ivf_flat
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "detail/ivf_flat_host_search.hpp"
+#include "ivf_flat_host_serialize.hpp"
+#include "ivf_flat_host_types.hpp"
+
+#include <raft/core/host_mdspan.hpp>
+#include <raft/core/resources.hpp>
+#include <raft/neighbors/sample_filter_types.hpp>
+
+#include <cstdint>
+
+namespace raft::neighbors::ivf_flat {
+
+/**
+ * @ingroup ivf_flat
+ * @{
+ */
+
+/**
+ * @brief Search ANN on the CPU using an index loaded into host memory, with the given filter.
+ *
+ * The search probes the closest clusters of every query and scans the interleaved groups of the
+ * probed lists directly, without unpacking the records. The queries are processed in batches:
+ * every group of a probed list is scanned for all the queries of the batch that probe the list,
+ * and every thread keeps its own top-k heaps, merged at the end of the batch.
+ *
+ * The results match the device `ivf_flat::search` on the same index, up to the order of the
+ * neighbors at equal distances.
+ *
+ * Usage example:
+ * @code{.cpp}
+ *   using namespace raft::neighbors;
+ *   // load the index saved with `ivf_flat::serialize(handle, "my_index.bin", index)`
+ *   auto index = ivf_flat::deserialize_host<float, int64_t>(handle, "my_index.bin");
+ *   ivf_flat::host_search_params search_params;
+ *   search_params.n_probes    = 50;
+ *   search_params.num_threads = 8;
+ *   auto neighbors = raft::make_host_matrix<int64_t, int64_t>(n_queries, k);
+ *   auto distances = raft::make_host_matrix<float, int64_t>(n_queries, k);
+ *   ivf_flat::search_with_filtering(handle, search_params, index, queries,
+ *                                   neighbors.view(), distances.view(), filter);
+ * @endcode
+ *
+ * @tparam T data element type
+ * @tparam IdxT type of the indices
+ * @tparam IvfSampleFilterT Host filter function, with the signature
+ *         `(uint32_t query_ix, uint32 cluster_ix, uint32_t sample_ix) -> bool` or
+ *         `(uint32_t query_ix, uint32 sample_ix) -> bool`
+ *
+ * @param[in] handle
+ * @param[in] params configure the search
+ * @param[in] index ivf-flat index in host memory
+ * @param[in] queries a host matrix view to a row-major matrix [n_queries, index->dim()]
+ * @param[out] neighbors a host matrix view to the indices of the neighbors in the source dataset
+ * [n_queries, k]
+ * @param[out] distances a host matrix view to the distances to the selected neighbors
+ * [n_queries, k]
+ * @param[in] sample_filter a host filter function that greenlights samples for a given query
+ */
+template <typename T, typename IdxT, typename IvfSampleFilterT>
+void search_with_filtering(raft::resources const& handle,
+                           const host_search_params& params,
+                           const host_index<T, IdxT>& index,
+                           raft::host_matrix_view<const T, IdxT, row_major> queries,
+                           raft::host_matrix_view<IdxT, IdxT, row_major> neighbors,
+                           raft::host_matrix_view<float, IdxT, row_major> distances,
+                           IvfSampleFilterT sample_filter = IvfSampleFilterT())
+{
+  RAFT_EXPECTS(
+    queries.extent(0) == neighbors.extent(0) && queries.extent(0) == distances.extent(0),
+    "Number of rows in output neighbors and distances matrices must equal the number of queries.");
+
+  RAFT_EXPECTS(neighbors.extent(1) == distances.extent(1),
+               "Number of columns in output neighbors and distances matrices must be equal");
+
+  RAFT_EXPECTS(queries.extent(1) == index.dim(),
+               "Number of query dimensions should equal number of dimensions in the index.");
+
+  detail::search(params,
+                 index,
+                 queries.data_handle(),
+                 static_cast<std::uint32_t>(queries.extent(0)),
+                 static_cast<std::uint32_t>(neighbors.extent(1)),
+                 neighbors.data_handle(),
+                 distances.data_handle(),
+                 sample_filter);
+}
+
+/**
+ * @brief Search ANN on the CPU using an index loaded into host memory.
+ *
+ * See `search_with_filtering` for the description and a usage example.
+ *
+ * @tparam T data element type
+ * @tparam IdxT type of the indices
+ *
+ * @param[in] handle
+ * @param[in] params configure the search
+ * @param[in] index ivf-flat index in host memory
+ * @param[in] queries a host matrix view to a row-major matrix [n_queries, index->dim()]
+ * @param[out] neighbors a host matrix view to the indices of the neighbors in the source dataset
+ * [n_queries, k]
+ * @param[out] distances a host matrix view to the distances to the selected neighbors
+ * [n_queries, k]
+ */
+template <typename T, typename IdxT>
+void search(raft::resources const& handle,
+            const host_search_params& params,
+            const host_index<T, IdxT>& index,
+            raft::host_matrix_view<const T, IdxT, row_major> queries,
+            raft::host_matrix_view<IdxT, IdxT, row_major> neighbors,
+            raft::host_matrix_view<float, IdxT, row_major> distances)
+{
+  search_with_filtering(handle,
+                        params,
+                        index,
+                        queries,
+                        neighbors,
+                        distances,
+                        raft::neighbors::filtering::none_ivf_sample_filter());
+}
+
+/** @} */
+
+}  // namespace raft::neighbors::ivf_flat
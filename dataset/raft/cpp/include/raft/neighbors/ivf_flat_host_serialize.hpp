@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "detail/ivf_flat_host_serialize.hpp"
+
+namespace raft::neighbors::ivf_flat {
+
+/**
+ * \defgroup ivf_flat_host_serialize IVF-Flat Host Serialize
+ * @{
+ */
+
+/**
+ * Load an index written by `ivf_flat::serialize` into host memory, for searching on the CPU.
+ *
+ * Experimental, both the API and the serialization format are subject to change.
+ *
+ * @code{.cpp}
+ * #include <raft/core/resources.hpp>
+ *
+ * raft::resources handle;
+ *
+ * // create an input stream
+ * std::istream is(std::cin.rdbuf());
+ * using T    = float; // data element type
+ * using IdxT = int64_t; // type of the index
+ * auto index = raft::neighbors::ivf_flat::deserialize_host<T, IdxT>(handle, is);
+ * @endcode
+ *
+ * @tparam T data element type
+ * @tparam IdxT type of the indices
+ *
+ * @param[in] handle the raft handle
+ * @param[in] is input stream
+ *
+ * @return raft::neighbors::ivf_flat::host_index<T, IdxT>
+ */
+template <typename T, typename IdxT>
+host_index<T, IdxT> deserialize_host(raft::resources const& handle, std::istream& is)
+{
+  return detail::deserialize_host<T, IdxT>(handle, is);
+}
+
+/**
+ * Load an index file written by `ivf_flat::serialize` or `ivf_flat::serialize_host` into host
+ * memory, for searching on the CPU.
+ *
+ * The format of the file is detected from its header. Experimental, both the API and the
+ * serialization format are subject to change.
+ *
+ * @code{.cpp}
+ * #include <raft/core/resources.hpp>
+ *
+ * raft::resources handle;
+ *
+ * // create a string with a filepath
+ * std::string filename("/path/to/index");
+ * using T    = float; // data element type
+ * using IdxT = int64_t; // type of the index
+ * auto index = raft::neighbors::ivf_flat::deserialize_host<T, IdxT>(handle, filename);
+ * @endcode
+ *
+ * @tparam T data element type
+ * @tparam IdxT type of the indices
+ *
+ * @param[in] handle the raft handle
+ * @param[in] filename the name of the file that stores the index
+ *
+ * @return raft::neighbors::ivf_flat::host_index<T, IdxT>
+ */
+template <typename T, typename IdxT>
+host_index<T, IdxT> deserialize_host(raft::resources const& handle, const std::string& filename)
+{
+  return detail::deserialize_host<T, IdxT>(handle, filename);
+}
+
+/**
+ * Save a host index into an index container file.
+ *
+ * The container stores the index parameters and arrays as typed sections listed in a table of
+ * contents, and every list at its own page-aligned offset. The lists are written in parallel, and
+ * can be read in parallel or mapped into memory when loading the index (see the
+ * `ivf::container_load_params` overload of `deserialize_host`). New sections and parameters can
+ * be added to the format without breaking the existing readers.
+ *
+ * A device index is saved in a container by loading it into host memory first:
+ * @code{.cpp}
+ * #include <raft/core/resources.hpp>
+ *
+ * raft::resources handle;
+ *
+ * using T    = float; // data element type
+ * using IdxT = int64_t; // type of the index
+ * raft::neighbors::ivf_flat::serialize(handle, "device_index.bin", index);
+ * auto host_index =
+ *   raft::neighbors::ivf_flat::deserialize_host<T, IdxT>(handle, "device_index.bin");
+ * raft::neighbors::ivf_flat::serialize_host(handle, "host_index.bin", host_index);
+ * @endcode
+ *
+ * @tparam T data element type
+ * @tparam IdxT type of the indices
+ *
+ * @param[in] handle the raft handle
+ * @param[in] filename the name of the file to write
+ * @param[in] index IVF-Flat index in host memory
+ * @param[in] num_threads number of host threads writing the lists; 0 uses the OpenMP default
+ */
+template <typename T, typename IdxT>
+void serialize_host(raft::resources const& handle,
+                    const std::string& filename,
+                    const host_index<T, IdxT>& index,
+                    int num_threads = 0)
+{
+  detail::serialize_host(handle, filename, index, num_threads);
+}
+
+/**
+ * Load an index file into host memory, with the given loading parameters.
+ *
+ * With `load_params.mmap_lists`, the lists of an index container are mapped into memory rather
+ * than read: loading only reads the centers, and the search reads the pages of the lists it
+ * probes on demand. Otherwise, the lists are read by `load_params.num_threads` threads. The files
+ * written by `ivf_flat::serialize` are read as a stream and can't be mapped.
+ *
+ * @code{.cpp}
+ * #include <raft/core/resources.hpp>
+ *
+ * raft::resources handle;
+ *
+ * raft::neighbors::ivf::container_load_params load_params;
+ * load_params.mmap_lists = true;
+ * using T    = float; // data element type
+ * using IdxT = int64_t; // type of the index
+ * auto index = raft::neighbors::ivf_flat::deserialize_host<T, IdxT>(
+ *   handle, "host_index.bin", load_params);
+ * @endcode
+ *
+ * @tparam T data element type
+ * @tparam IdxT type of the indices
+ *
+ * @param[in] handle the raft handle
+ * @param[in] filename the name of the file that stores the index
+ * @param[in] load_params configure loading the index
+ *
+ * @return raft::neighbors::ivf_flat::host_index<T, IdxT>
+ */
+template <typename T, typename IdxT>
+host_index<T, IdxT> deserialize_host(raft::resources const& handle,
+                                     const std::string& filename,
+                                     const ivf::container_load_params& load_params)
+{
+  return detail::deserialize_host<T, IdxT>(handle, filename, load_params);
+}
+
+/**@}*/
+
+}  // namespace raft::neighbors::ivf_flat
@@ -0,0 +1,274 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <raft/core/error.hpp>
+#include <raft/core/host_mdarray.hpp>
+#include <raft/core/host_mdspan.hpp>
+#include <raft/core/mdspan_types.hpp>
+#include <raft/distance/distance_types.hpp>
+#include <raft/neighbors/ivf_flat_types.hpp>
+#include <raft/util/integer_utils.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace raft::neighbors::ivf_flat {
+/**
+ * @addtogroup ivf_flat
+ * @{
+ */
+
+struct host_search_params : search_params {
+  /**
+   * Number of host threads used by the search. Value of 0 uses the OpenMP default
+   * (`omp_get_max_threads()`).
+   */
+  int num_threads = 0;
+  /** Maximum number of queries to search at the same time (batch size). Auto select when 0. */
+  uint32_t max_queries = 0;
+};
+
+static_assert(std::is_aggregate_v<host_search_params>);
+
+/**
+ * @brief One inverted list of a `host_index`.
+ *
+ * The data has the same interleaved layout as the device `list_data` (see `index` for the
+ * description), padded to a multiple of `kIndexGroupSize` rows. The list either owns its arrays
+ * or views a file mapped into memory (see `ivf::container_load_params`); in both cases `storage`
+ * keeps the memory alive.
+ */
+template <typename T, typename IdxT>
+struct host_list_data {
+  /** Interleaved list data [round_up(size, kIndexGroupSize), dim]. */
+  host_matrix_view<T, uint32_t, row_major> data;
+  /** Source indices of the records [round_up(size, kIndexGroupSize)]. */
+  host_vector_view<IdxT, uint32_t> indices;
+  /** The number of records in the list. */
+  uint32_t size;
+  /** The owner of the memory behind `data` and `indices`. */
+  std::shared_ptr<void> storage;
+
+  /** Allocate the arrays of a list of `n_rows` records. */
+  host_list_data(uint32_t dim, uint32_t n_rows) : size{n_rows}
+  {
+    using arrays_type = std::pair<host_matrix<T, uint32_t>, host_vector<IdxT, uint32_t>>;
+    auto capacity     = round_up_safe<uint32_t>(n_rows, kIndexGroupSize);
+    auto arrays       = std::make_shared<arrays_type>(make_host_matrix<T, uint32_t>(capacity, dim),
+                                                make_host_vector<IdxT, uint32_t>(capacity));
+    data    = arrays->first.view();
+    indices = arrays->second.view();
+    storage = std::move(arrays);
+  }
+
+  /** View the arrays of a list held by `storage`. */
+  host_list_data(host_matrix_view<T, uint32_t, row_major> data,
+                 host_vector_view<IdxT, uint32_t> indices,
+                 uint32_t n_rows,
+                 std::shared_ptr<void> storage)
+    : data{data}, indices{indices}, size{n_rows}, storage{std::move(storage)}
+  {
+  }
+};
+
+/**
+ * @brief IVF-flat index held in host memory, for searching on the CPU.
+ *
+ * The index is loaded from the files written by `ivf_flat::serialize` (see
+ * `raft/neighbors/ivf_flat_host_serialize.hpp`) and searched with `ivf_flat::search` from
+ * `raft/neighbors/ivf_flat_host.hpp`. The lists keep the interleaved layout of the device index,
+ * so that the host search scans them group by group without unpacking the records.
+ *
+ * @tparam T data element type
+ * @tparam IdxT type of the indices in the source dataset
+ */
+template <typename T, typename IdxT>
+struct host_index {
+  static_assert(!raft::is_narrowing_v<uint32_t, IdxT>,
+                "IdxT must be able to represent all values of uint32_t");
+
+ public:
+  /** Size of the interleaved data chunks, the same as `index::veclen()`. */
+  [[nodiscard]] constexpr inline auto veclen() const noexcept -> uint32_t { return veclen_; }
+  /** Distance metric used for clustering. */
+  [[nodiscard]] constexpr inline auto metric() const noexcept -> raft::distance::DistanceType
+  {
+    return metric_;
+  }
+  /** Whether `centers()` change upon extending the index (see `index_params`). */
+  [[nodiscard]] constexpr inline auto adaptive_centers() const noexcept -> bool
+  {
+    return adaptive_centers_;
+  }
+  /** Whether the device index was built with the conservative memory allocation. */
+  [[nodiscard]] constexpr inline auto conservative_memory_allocation() const noexcept -> bool
+  {
+    return conservative_memory_allocation_;
+  }
+  /** Total length of the index. */
+  [[nodiscard]] constexpr inline auto size() const noexcept -> IdxT { return size_; }
+  /** Dimensionality of the data. */
+  [[nodiscard]] constexpr inline auto dim() const noexcept -> uint32_t
+  {
+    return centers_.extent(1);
+  }
+  /** Number of clusters/inverted lists. */
+  [[nodiscard]] constexpr inline auto n_lists() const noexcept -> uint32_t
+  {
+    return centers_.extent(0);
+  }
+
+  /** k-means cluster centers corresponding to the lists [n_lists, dim] */
+  inline auto centers() noexcept -> host_matrix_view<float, uint32_t, row_major>
+  {
+    return centers_.view();
+  }
+  [[nodiscard]] inline auto centers() const noexcept
+    -> host_matrix_view<const float, uint32_t, row_major>
+  {
+    return centers_.view();
+  }
+
+  /** (Optional) Precomputed norms of the `centers` w.r.t. the chosen distance metric [n_lists]. */
+  inline auto center_norms() noexcept -> std::optional<host_vector_view<float, uint32_t>>
+  {
+    if (center_norms_.has_value()) {
+      return std::make_optional<host_vector_view<float, uint32_t>>(center_norms_->view());
+    } else {
+      return std::nullopt;
+    }
+  }
+  [[nodiscard]] inline auto center_norms() const noexcept
+    -> std::optional<host_vector_view<const float, uint32_t>>
+  {
+    if (center_norms_.has_value()) {
+      return std::make_optional<host_vector_view<const float, uint32_t>>(center_norms_->view());
+    } else {
+      return std::nullopt;
+    }
+  }
+
+  /** Lists' data and indices; an empty list may be `std::nullopt`. */
+  inline auto lists() noexcept -> std::vector<std::optional<host_list_data<T, IdxT>>>&
+  {
+    return lists_;
+  }
+  [[nodiscard]] inline auto lists() const noexcept
+    -> const std::vector<std::optional<host_list_data<T, IdxT>>>&
+  {
+    return lists_;
+  }
+
+  /** Sizes of the lists (clusters) [n_lists]. */
+  [[nodiscard]] inline auto list_sizes() const noexcept
+    -> host_vector_view<const uint32_t, uint32_t>
+  {
+    return list_sizes_.view();
+  }
+
+  /**
+   * Pointers to the inverted lists (clusters) indices [n_lists], as expected by
+   * `filtering::ivf_to_sample_filter`.
+   */
+  [[nodiscard]] inline auto inds_ptrs() const noexcept
+    -> host_vector_view<const IdxT* const, uint32_t>
+  {
+    return inds_ptrs_.view();
+  }
+
+  // Don't allow copying the index for performance reasons (try avoiding copying data)
+  host_index(const host_index&)                    = delete;
+  host_index(host_index&&)                         = default;
+  auto operator=(const host_index&) -> host_index& = delete;
+  auto operator=(host_index&&) -> host_index&      = default;
+  ~host_index()                                    = default;
+
+  /** Construct an index with empty lists, to be filled by the deserializer. */
+  host_index(raft::distance::DistanceType metric,
+             uint32_t n_lists,
+             bool adaptive_centers,
+             bool conservative_memory_allocation,
+             uint32_t dim)
+    : veclen_(calculate_veclen(dim)),
+      metric_(metric),
+      adaptive_centers_(adaptive_centers),
+      conservative_memory_allocation_{conservative_memory_allocation},
+      size_{0},
+      lists_(n_lists),
+      list_sizes_{make_host_vector<uint32_t, uint32_t>(n_lists)},
+      centers_{make_host_matrix<float, uint32_t>(n_lists, dim)},
+      center_norms_{std::nullopt},
+      inds_ptrs_{make_host_vector<const IdxT*, uint32_t>(n_lists)}
+  {
+    std::fill(list_sizes_.data_handle(), list_sizes_.data_handle() + n_lists, 0);
+  }
+
+  /** Allocate the center norms, if the metric needs them. */
+  void allocate_center_norms()
+  {
+    switch (metric_) {
+      case raft::distance::DistanceType::L2Expanded:
+      case raft::distance::DistanceType::L2SqrtExpanded:
+      case raft::distance::DistanceType::L2Unexpanded:
+      case raft::distance::DistanceType::L2SqrtUnexpanded:
+        center_norms_ = make_host_vector<float, uint32_t>(n_lists());
+        break;
+      default: center_norms_ = std::nullopt;
+    }
+  }
+
+  /** Update the list sizes, index pointers and the total size after the lists have been set. */
+  void recompute_internal_state()
+  {
+    size_ = 0;
+    for (uint32_t label = 0; label < n_lists(); label++) {
+      auto& list         = lists_[label];
+      list_sizes_(label) = list.has_value() ? list->size : 0;
+      inds_ptrs_(label)  = list.has_value() ? list->indices.data_handle() : nullptr;
+      size_ += list_sizes_(label);
+    }
+  }
+
+ private:
+  uint32_t veclen_;
+  raft::distance::DistanceType metric_;
+  bool adaptive_centers_;
+  bool conservative_memory_allocation_;
+  IdxT size_;
+  std::vector<std::optional<host_list_data<T, IdxT>>> lists_;
+  host_vector<uint32_t, uint32_t> list_sizes_;
+  host_matrix<float, uint32_t, row_major> centers_;
+  std::optional<host_vector<float, uint32_t>> center_norms_;
+  host_vector<const IdxT*, uint32_t> inds_ptrs_;
+
+  // NOTE: keep this consistent with `index::calculate_veclen`
+  static auto calculate_veclen(uint32_t dim) -> uint32_t
+  {
+    uint32_t veclen = std::max<uint32_t>(1, 16 / sizeof(T));
+    if (dim % veclen != 0) { veclen = 1; }
+    return veclen;
+  }
+};
+
+/** @} */
+
+}  // namespace raft::neighbors::ivf_flat
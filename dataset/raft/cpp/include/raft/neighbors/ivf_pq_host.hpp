@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "detail/ivf_pq_host_search.hpp"
+#include "detail/refine_host.hpp"
+#include "ivf_pq_host_serialize.hpp"
+#include "ivf_pq_host_types.hpp"
+
+#include <raft/core/host_mdarray.hpp>
+#include <raft/core/host_mdspan.hpp>
+#include <raft/core/resources.hpp>
+#include <raft/neighbors/sample_filter_types.hpp>
+
+#include <cmath>
+#include <cstdint>
+
+namespace raft::neighbors::ivf_pq {
+
+/**
+ * @ingroup ivf_pq
+ * @{
+ */
+
+/**
+ * @brief Search ANN on the CPU using an index loaded into host memory, with the given filter.
+ *
+ * The search probes the closest clusters of every query and scans the PQ codes of the probed
+ * lists with a look up table of the distances between the query and the PQ centers, computed per
+ * probed cluster. The queries are processed in batches: every probed list is unpacked once per
+ * batch and scanned for all the queries that probe it.
+ *
+ * With `pq_bits = 4`, the lists are scanned with a quantized look up table held in SIMD registers
+ * (the "fast scan"), which bounds the scores from below; only the records passing the top-k
+ * threshold are scored with the float table. The SIMD path is selected at compile time
+ * (AVX2, SSSE3 or AArch64 NEON), with a portable fallback that defining `RAFT_DISABLE_HOST_SIMD`
+ * forces. Other values of `pq_bits` gather the entries of the float table.
+ *
+ * The distances are the same approximations of the distances as the ones of the device search;
+ * see `search_with_refinement` to re-rank the candidates with the exact distances.
+ *
+ * Usage example:
+ * @code{.cpp}
+ *   using namespace raft::neighbors;
+ *   // load the index saved with `ivf_pq::serialize(handle, "my_index.bin", index)`
+ *   auto index = ivf_pq::deserialize_host<int64_t>(handle, "my_index.bin");
+ *   ivf_pq::host_search_params search_params;
+ *   search_params.n_probes    = 50;
+ *   search_params.num_threads = 8;
+ *   auto neighbors = raft::make_host_matrix<int64_t, int64_t>(n_queries, k);
+ *   auto distances = raft::make_host_matrix<float, int64_t>(n_queries, k);
+ *   ivf_pq::search_with_filtering(handle, search_params, index, queries,
+ *                                 neighbors.view(), distances.view(), filter);
+ * @endcode
+ *
+ * @tparam T data element type (float, int8_t or uint8_t)
+ * @tparam IdxT type of the indices
+ * @tparam IvfSampleFilterT Host filter function, with the signature
+ *         `(uint32_t query_ix, uint32 cluster_ix, uint32_t sample_ix) -> bool` or
+ *         `(uint32_t query_ix, uint32 sample_ix) -> bool`
+ *
+ * @param[in] handle
+ * @param[in] params configure the search
+ * @param[in] index ivf-pq index in host memory
+ * @param[in] queries a host matrix view to a row-major matrix [n_queries, index->dim()]
+ * @param[out] neighbors a host matrix view to the indices of the neighbors in the source dataset
+ * [n_queries, k]
+ * @param[out] distances a host matrix view to the distances to the selected neighbors
+ * [n_queries, k]
+ * @param[in] sample_filter a host filter function that greenlights samples for a given query
+ */
+template <typename T, typename IdxT, typename IvfSampleFilterT>
+void search_with_filtering(raft::resources const& handle,
+                           const host_search_params& params,
+                           const host_index<IdxT>& index,
+                           raft::host_matrix_view<const T, IdxT, row_major> queries,
+                           raft::host_matrix_view<IdxT, IdxT, row_major> neighbors,
+                           raft::host_matrix_view<float, IdxT, row_major> distances,
+                           IvfSampleFilterT sample_filter = IvfSampleFilterT())
+{
+  RAFT_EXPECTS(
+    queries.extent(0) == neighbors.extent(0) && queries.extent(0) == distances.extent(0),
+    "Number of rows in output neighbors and distances matrices must equal the number of queries.");
+
+  RAFT_EXPECTS(neighbors.extent(1) == distances.extent(1),
+               "Number of columns in output neighbors and distances matrices must be equal");
+
+  RAFT_EXPECTS(queries.extent(1) == index.dim(),
+               "Number of query dimensions should equal number of dimensions in the index.");
+
+  detail::search(params,
+                 index,
+                 queries.data_handle(),
+                 static_cast<std::uint32_t>(queries.extent(0)),
+                 static_cast<std::uint32_t>(neighbors.extent(1)),
+                 neighbors.data_handle(),
+                 distances.data_handle(),
+                 sample_filter);
+}
+
+/**
+ * @brief Search ANN on the CPU using an index loaded into host memory.
+ *
+ * See `search_with_filtering` for the description and a usage example.
+ *
+ * @tparam T data element type (float, int8_t or uint8_t)
+ * @tparam IdxT type of the indices
+ *
+ * @param[in] handle
+ * @param[in] params configure the search
+ * @param[in] index ivf-pq index in host memory
+ * @param[in] queries a host matrix view to a row-major matrix [n_queries, index->dim()]
+ * @param[out] neighbors a host matrix view to the indices of the neighbors in the source dataset
+ * [n_queries, k]
+ * @param[out] distances a host matrix view to the distances to the selected neighbors
+ * [n_queries, k]
+ */
+template <typename T, typename IdxT>
+void search(raft::resources const& handle,
+            const host_search_params& params,
+            const host_index<IdxT>& index,
+            raft::host_matrix_view<const T, IdxT, row_major> queries,
+            raft::host_matrix_view<IdxT, IdxT, row_major> neighbors,
+            raft::host_matrix_view<float, IdxT, row_major> distances)
+{
+  search_with_filtering(handle,
+                        params,
+                        index,
+                        queries,
+                        neighbors,
+                        distances,
+                        raft::neighbors::filtering::none_ivf_sample_filter());
+}
+
+/**
+ * @brief Search ANN on the CPU and re-rank the candidates with the exact distances.
+ *
+ * The search selects `k * refine_ratio` candidates with `search_with_filtering`, then computes
+ * their distances to the queries on the source dataset with `refine` (see
+ * `raft/neighbors/refine.cuh`) and keeps the `k` closest.
+ *
+ * Usage example:
+ * @code{.cpp}
+ *   using namespace raft::neighbors;
+ *   auto index = ivf_pq::deserialize_host<int64_t>(handle, "my_index.bin");
+ *   ivf_pq::host_search_params search_params;
+ *   search_params.n_probes = 50;
+ *   ivf_pq::search_with_refinement(handle, search_params, index, dataset, queries,
+ *                                  neighbors.view(), distances.view(), 2);
+ * @endcode
+ *
+ * @tparam T data element type (float, int8_t or uint8_t)
+ * @tparam IdxT type of the indices
+ * @tparam IvfSampleFilterT Host filter function, see `search_with_filtering`
+ *
+ * @param[in] handle
+ * @param[in] params configure the search
+ * @param[in] index ivf-pq index in host memory
+ * @param[in] dataset a host matrix view to the source dataset [index.size(), index.dim()]
+ * @param[in] queries a host matrix view to a row-major matrix [n_queries, index->dim()]
+ * @param[out] neighbors a host matrix view to the indices of the neighbors in the source dataset
+ * [n_queries, k]
+ * @param[out] distances a host matrix view to the exact distances to the selected neighbors
+ * [n_queries, k]
+ * @param[in] refine_ratio the number of the candidates per neighbor (at least 1)
+ * @param[in] sample_filter a host filter function that greenlights samples for a given query
+ */
+template <typename T,
+          typename IdxT,
+          typename IvfSampleFilterT = raft::neighbors::filtering::none_ivf_sample_filter>
+void search_with_refinement(raft::resources const& handle,
+                            const host_search_params& params,
+                            const host_index<IdxT>& index,
+                            raft::host_matrix_view<const T, IdxT, row_major> dataset,
+                            raft::host_matrix_view<const T, IdxT, row_major> queries,
+                            raft::host_matrix_view<IdxT, IdxT, row_major> neighbors,
+                            raft::host_matrix_view<float, IdxT, row_major> distances,
+                            uint32_t refine_ratio,
+                            IvfSampleFilterT sample_filter = IvfSampleFilterT())
+{
+  RAFT_EXPECTS(refine_ratio >= 1, "refine_ratio must be at least 1.");
+  RAFT_EXPECTS(dataset.extent(1) == index.dim(),
+               "Number of dataset dimensions should equal number of dimensions in the index.");
+
+  const IdxT n_queries    = queries.extent(0);
+  const IdxT n_candidates = neighbors.extent(1) * refine_ratio;
+  auto candidates         = raft::make_host_matrix<IdxT, IdxT>(n_queries, n_candidates);
+  auto candidate_dist     = raft::make_host_matrix<float, IdxT>(n_queries, n_candidates);
+  search_with_filtering(handle,
+                        params,
+                        index,
+                        queries,
+                        candidates.view(),
+                        candidate_dist.view(),
+                        sample_filter);
+
+  // `refine` computes the squared euclidean distances
+  const bool take_sqrt = index.metric() == raft::distance::DistanceType::L2SqrtExpanded;
+  raft::neighbors::detail::refine_host<IdxT, T, float, IdxT>(
+    dataset,
+    queries,
+    raft::make_const_mdspan(candidates.view()),
+    neighbors,
+    distances,
+    take_sqrt ? raft::distance::DistanceType::L2Expanded : index.metric());
+  if (take_sqrt) {
+    // The missing neighbors keep the dummy distance of the search
+    for (size_t i = 0; i < distances.size(); i++) {
+      if (neighbors.data_handle()[i] == ivf::detail::kHostOutOfBoundsRecord<IdxT>) { continue; }
+      distances.data_handle()[i] = std::sqrt(distances.data_handle()[i]);
+    }
+  }
+}
+
+/** @} */
+
+}  // namespace raft::neighbors::ivf_pq
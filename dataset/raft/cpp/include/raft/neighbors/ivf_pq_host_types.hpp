@@ -0,0 +1,324 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <raft/core/error.hpp>
+#include <raft/core/host_mdarray.hpp>
+#include <raft/core/host_mdspan.hpp>
+#include <raft/core/mdspan_types.hpp>
+#include <raft/distance/distance_types.hpp>
+#include <raft/neighbors/ivf_pq_types.hpp>
+#include <raft/util/integer_utils.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace raft::neighbors::ivf_pq {
+/**
+ * @addtogroup ivf_pq
+ * @{
+ */
+
+/**
+ * Parameters of the host search; the look up table and the internal distance data types of
+ * `search_params` concern the device search only and are ignored.
+ */
+struct host_search_params : search_params {
+  /**
+   * Number of host threads used by the search. Value of 0 uses the OpenMP default
+   * (`omp_get_max_threads()`).
+   */
+  int num_threads = 0;
+  /** Maximum number of queries to search at the same time (batch size). Auto select when 0. */
+  uint32_t max_queries = 0;
+};
+
+static_assert(std::is_aggregate_v<host_search_params>);
+
+/**
+ * @brief One inverted list of a `host_index`.
+ *
+ * The codes have the same interleaved layout as the device `list_data` (see `list_spec`). The
+ * list either owns its arrays or views a file mapped into memory (see
+ * `ivf::container_load_params`); in both cases `storage` keeps the memory alive.
+ */
+template <typename IdxT>
+struct host_list_data {
+  using list_extents = typename list_spec<uint32_t, IdxT>::list_extents;
+
+  /** PQ-encoded data stored in the interleaved format (see `list_spec`). */
+  host_mdspan<uint8_t, list_extents, row_major> data;
+  /** Source indices of the records [size]. */
+  host_vector_view<IdxT, uint32_t> indices;
+  /** The number of records in the list. */
+  uint32_t size;
+  /** The owner of the memory behind `data` and `indices`. */
+  std::shared_ptr<void> storage;
+
+  /** Allocate the arrays of a list of `n_rows` records. */
+  host_list_data(const list_spec<uint32_t, IdxT>& spec, uint32_t n_rows) : size{n_rows}
+  {
+    using arrays_type =
+      std::pair<host_mdarray<uint8_t, list_extents, row_major>, host_vector<IdxT, uint32_t>>;
+    auto arrays = std::make_shared<arrays_type>(
+      make_host_mdarray<uint8_t, uint32_t, row_major>(spec.make_list_extents(n_rows)),
+      make_host_vector<IdxT, uint32_t>(n_rows));
+    data    = arrays->first.view();
+    indices = arrays->second.view();
+    storage = std::move(arrays);
+  }
+
+  /** View the arrays of a list held by `storage`. */
+  host_list_data(host_mdspan<uint8_t, list_extents, row_major> data,
+                 host_vector_view<IdxT, uint32_t> indices,
+                 uint32_t n_rows,
+                 std::shared_ptr<void> storage)
+    : data{data}, indices{indices}, size{n_rows}, storage{std::move(storage)}
+  {
+  }
+};
+
+/**
+ * @brief IVF-PQ index held in host memory, for searching on the CPU.
+ *
+ * The index is loaded from the files written by `ivf_pq::serialize` (see
+ * `raft/neighbors/ivf_pq_host_serialize.hpp`) and searched with `ivf_pq::search` from
+ * `raft/neighbors/ivf_pq_host.hpp`. See `index` for the description of its members.
+ *
+ * @tparam IdxT type of the indices in the source dataset
+ */
+template <typename IdxT>
+struct host_index {
+  static_assert(!raft::is_narrowing_v<uint32_t, IdxT>,
+                "IdxT must be able to represent all values of uint32_t");
+
+ public:
+  using pq_centers_extents = typename index<IdxT>::pq_centers_extents;
+
+  /** Total length of the index. */
+  [[nodiscard]] constexpr inline auto size() const noexcept -> IdxT { return size_; }
+  /** Dimensionality of the input data. */
+  [[nodiscard]] constexpr inline auto dim() const noexcept -> uint32_t { return dim_; }
+  /** Dimensionality of the cluster centers: input data dim extended with vector norms. */
+  [[nodiscard]] constexpr inline auto dim_ext() const noexcept -> uint32_t
+  {
+    return raft::round_up_safe(dim() + 1, 8u);
+  }
+  /** Dimensionality of the data after transforming it for PQ processing. */
+  [[nodiscard]] constexpr inline auto rot_dim() const noexcept -> uint32_t
+  {
+    return pq_len() * pq_dim();
+  }
+  /** The bit length of an encoded vector element after compression by PQ. */
+  [[nodiscard]] constexpr inline auto pq_bits() const noexcept -> uint32_t { return pq_bits_; }
+  /** The dimensionality of an encoded vector after compression by PQ. */
+  [[nodiscard]] constexpr inline auto pq_dim() const noexcept -> uint32_t { return pq_dim_; }
+  /** Dimensionality of a subspaces, i.e. the number of vector components mapped to a subspace */
+  [[nodiscard]] constexpr inline auto pq_len() const noexcept -> uint32_t
+  {
+    return raft::div_rounding_up_unsafe(dim(), pq_dim());
+  }
+  /** The number of vectors in a PQ codebook (`1 << pq_bits`). */
+  [[nodiscard]] constexpr inline auto pq_book_size() const noexcept -> uint32_t
+  {
+    return 1 << pq_bits();
+  }
+  /** Distance metric used for clustering. */
+  [[nodiscard]] constexpr inline auto metric() const noexcept -> raft::distance::DistanceType
+  {
+    return metric_;
+  }
+  /** How PQ codebooks are created. */
+  [[nodiscard]] constexpr inline auto codebook_kind() const noexcept -> codebook_gen
+  {
+    return codebook_kind_;
+  }
+  /** Number of clusters/inverted lists (first level quantization). */
+  [[nodiscard]] constexpr inline auto n_lists() const noexcept -> uint32_t { return lists_.size(); }
+  /** Whether the device index was built with the conservative memory allocation. */
+  [[nodiscard]] constexpr inline auto conservative_memory_allocation() const noexcept -> bool
+  {
+    return conservative_memory_allocation_;
+  }
+
+  /**
+   * PQ cluster centers
+   *
+   *   - codebook_gen::PER_SUBSPACE: [pq_dim , pq_len, pq_book_size]
+   *   - codebook_gen::PER_CLUSTER:  [n_lists, pq_len, pq_book_size]
+   */
+  inline auto pq_centers() noexcept -> host_mdspan<float, pq_centers_extents, row_major>
+  {
+    return pq_centers_.view();
+  }
+  [[nodiscard]] inline auto pq_centers() const noexcept
+    -> host_mdspan<const float, pq_centers_extents, row_major>
+  {
+    return pq_centers_.view();
+  }
+
+  /** Lists' data and indices; an empty list may be `std::nullopt`. */
+  inline auto lists() noexcept -> std::vector<std::optional<host_list_data<IdxT>>>&
+  {
+    return lists_;
+  }
+  [[nodiscard]] inline auto lists() const noexcept
+    -> const std::vector<std::optional<host_list_data<IdxT>>>&
+  {
+    return lists_;
+  }
+
+  /** Sizes of the lists [n_lists]. */
+  [[nodiscard]] inline auto list_sizes() const noexcept
+    -> host_vector_view<const uint32_t, uint32_t>
+  {
+    return list_sizes_.view();
+  }
+
+  /**
+   * Pointers to the inverted lists (clusters) indices [n_lists], as expected by
+   * `filtering::ivf_to_sample_filter`.
+   */
+  [[nodiscard]] inline auto inds_ptrs() const noexcept
+    -> host_vector_view<const IdxT* const, uint32_t>
+  {
+    return inds_ptrs_.view();
+  }
+
+  /** The transform matrix (original space -> rotated padded space) [rot_dim, dim] */
+  inline auto rotation_matrix() noexcept -> host_matrix_view<float, uint32_t, row_major>
+  {
+    return rotation_matrix_.view();
+  }
+  [[nodiscard]] inline auto rotation_matrix() const noexcept
+    -> host_matrix_view<const float, uint32_t, row_major>
+  {
+    return rotation_matrix_.view();
+  }
+
+  /** Cluster centers corresponding to the lists in the original space [n_lists, dim_ext] */
+  inline auto centers() noexcept -> host_matrix_view<float, uint32_t, row_major>
+  {
+    return centers_.view();
+  }
+  [[nodiscard]] inline auto centers() const noexcept
+    -> host_matrix_view<const float, uint32_t, row_major>
+  {
+    return centers_.view();
+  }
+
+  /** Cluster centers corresponding to the lists in the rotated space [n_lists, rot_dim] */
+  inline auto centers_rot() noexcept -> host_matrix_view<float, uint32_t, row_major>
+  {
+    return centers_rot_.view();
+  }
+  [[nodiscard]] inline auto centers_rot() const noexcept
+    -> host_matrix_view<const float, uint32_t, row_major>
+  {
+    return centers_rot_.view();
+  }
+
+  // Don't allow copying the index for performance reasons (try avoiding copying data)
+  host_index(const host_index&)                    = delete;
+  host_index(host_index&&)                         = default;
+  auto operator=(const host_index&) -> host_index& = delete;
+  auto operator=(host_index&&) -> host_index&      = default;
+  ~host_index()                                    = default;
+
+  /** Construct an index with empty lists, to be filled by the deserializer. */
+  host_index(raft::distance::DistanceType metric,
+             codebook_gen codebook_kind,
+             uint32_t n_lists,
+             uint32_t dim,
+             uint32_t pq_bits,
+             uint32_t pq_dim,
+             bool conservative_memory_allocation)
+    : metric_(metric),
+      codebook_kind_(codebook_kind),
+      dim_(dim),
+      pq_bits_(pq_bits),
+      pq_dim_(pq_dim),
+      conservative_memory_allocation_(conservative_memory_allocation),
+      size_{0},
+      lists_(n_lists),
+      list_sizes_{make_host_vector<uint32_t, uint32_t>(n_lists)},
+      pq_centers_{make_host_mdarray<float, uint32_t, row_major>(make_pq_centers_extents())},
+      centers_{make_host_matrix<float, uint32_t>(n_lists, this->dim_ext())},
+      centers_rot_{make_host_matrix<float, uint32_t>(n_lists, this->rot_dim())},
+      rotation_matrix_{make_host_matrix<float, uint32_t>(this->rot_dim(), this->dim())},
+      inds_ptrs_{make_host_vector<const IdxT*, uint32_t>(n_lists)}
+  {
+    RAFT_EXPECTS(pq_bits >= 4 && pq_bits <= 8,
+                 "`pq_bits` must be within closed range [4,8], but got %u.",
+                 pq_bits);
+    RAFT_EXPECTS((pq_bits * pq_dim) % 8 == 0,
+                 "`pq_bits * pq_dim` must be a multiple of 8, but got %u * %u = %u.",
+                 pq_bits,
+                 pq_dim,
+                 pq_bits * pq_dim);
+    std::fill(list_sizes_.data_handle(), list_sizes_.data_handle() + n_lists, 0);
+  }
+
+  /** Update the list sizes, index pointers and the total size after the lists have been set. */
+  void recompute_internal_state()
+  {
+    size_ = 0;
+    for (uint32_t label = 0; label < n_lists(); label++) {
+      auto& list         = lists_[label];
+      list_sizes_(label) = list.has_value() ? list->size : 0;
+      inds_ptrs_(label)  = list.has_value() ? list->indices.data_handle() : nullptr;
+      size_ += list_sizes_(label);
+    }
+  }
+
+ private:
+  raft::distance::DistanceType metric_;
+  codebook_gen codebook_kind_;
+  uint32_t dim_;
+  uint32_t pq_bits_;
+  uint32_t pq_dim_;
+  bool conservative_memory_allocation_;
+  IdxT size_;
+
+  std::vector<std::optional<host_list_data<IdxT>>> lists_;
+  host_vector<uint32_t, uint32_t> list_sizes_;
+  host_mdarray<float, pq_centers_extents, row_major> pq_centers_;
+  host_matrix<float, uint32_t, row_major> centers_;
+  host_matrix<float, uint32_t, row_major> centers_rot_;
+  host_matrix<float, uint32_t, row_major> rotation_matrix_;
+  host_vector<const IdxT*, uint32_t> inds_ptrs_;
+
+  // NOTE: keep this consistent with `index::make_pq_centers_extents`
+  auto make_pq_centers_extents() -> pq_centers_extents
+  {
+    switch (codebook_kind()) {
+      case codebook_gen::PER_SUBSPACE:
+        return make_extents<uint32_t>(pq_dim(), pq_len(), pq_book_size());
+      case codebook_gen::PER_CLUSTER:
+        return make_extents<uint32_t>(n_lists(), pq_len(), pq_book_size());
+      default: RAFT_FAIL("Unreachable code");
+    }
+  }
+};
+
+/** @} */
+
+}  // namespace raft::neighbors::ivf_pq
@@ -0,0 +1,273 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <raft/core/bitmap.hpp>
+#include <raft/core/bitset.hpp>
+#include <raft/core/host_bitmap.hpp>
+#include <raft/core/host_bitset.hpp>
+#include <raft/core/host_csr_matrix.hpp>
+#include <raft/core/resources.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace raft::core {
+
+struct test_spec_host_bitset {
+  uint64_t bitset_len;
+  uint64_t mask_len;
+  uint64_t n_rows;
+};
+
+auto operator<<(std::ostream& os, const test_spec_host_bitset& ss) -> std::ostream&
+{
+  os << "host_bitset{bitset_len: " << ss.bitset_len << ", mask_len: " << ss.mask_len
+     << ", n_rows: " << ss.n_rows << "}";
+  return os;
+}
+
+template <typename bitset_t, typename index_t>
+class HostBitsetTest : public testing::TestWithParam<test_spec_host_bitset> {
+ protected:
+  const test_spec_host_bitset spec;
+  raft::resources res;
+  std::mt19937_64 rng{42};
+
+ public:
+  HostBitsetTest() : spec(testing::TestWithParam<test_spec_host_bitset>::GetParam()) {}
+
+  auto random_mask() -> std::vector<index_t>
+  {
+    std::uniform_int_distribution<uint64_t> dist(0, spec.bitset_len - 1);
+    std::vector<index_t> mask(spec.mask_len);
+    for (auto& ix : mask) {
+      ix = index_t(dist(rng));
+    }
+    return mask;
+  }
+
+  auto make_bitset(std::vector<bool>& ref) -> host_bitset<bitset_t, index_t>
+  {
+    auto mask = random_mask();
+    ref.assign(spec.bitset_len, true);
+    for (auto ix : mask) {
+      ref[ix] = false;
+    }
+    return host_bitset<bitset_t, index_t>(
+      res,
+      raft::make_host_vector_view<const index_t, index_t>(mask.data(), index_t(mask.size())),
+      index_t(spec.bitset_len));
+  }
+
+  template <typename view_t>
+  void expect_bits(const view_t& bitset, const std::vector<bool>& ref)
+  {
+    index_t n_set = 0;
+    for (index_t i = 0; i < index_t(ref.size()); i++) {
+      ASSERT_EQ(bitset.test(i), ref[i]) << "bit " << i;
+      n_set += ref[i];
+    }
+    ASSERT_EQ(bitset.count(), n_set);
+  }
+
+  void run()
+  {
+    std::vector<bool> ref_a;
+    std::vector<bool> ref_b;
+    auto a = make_bitset(ref_a);
+    auto b = make_bitset(ref_b);
+    expect_bits(a.view(), ref_a);
+    ASSERT_EQ(a.count(res), a.view().count());
+
+    // Ranges
+    for (int i = 0; i < 100; i++) {
+      std::uniform_int_distribution<uint64_t> dist(0, spec.bitset_len);
+      auto begin = index_t(dist(rng));
+      auto end   = index_t(dist(rng));
+      if (begin > end) { std::swap(begin, end); }
+      index_t expected = 0;
+      for (index_t j = begin; j < end; j++) {
+        expected += ref_a[j];
+      }
+      ASSERT_EQ(a.view().count(begin, end), expected);
+    }
+
+    // Set operations
+    a.view().bitwise_and(b.view());
+    for (size_t i = 0; i < ref_a.size(); i++) {
+      ref_a[i] = ref_a[i] && ref_b[i];
+    }
+    expect_bits(a.view(), ref_a);
+    b.flip(res);
+    ref_b.flip();
+    expect_bits(b.view(), ref_b);
+    a.view().bitwise_or(b.view());
+    for (size_t i = 0; i < ref_a.size(); i++) {
+      ref_a[i] = ref_a[i] || ref_b[i];
+    }
+    expect_bits(a.view(), ref_a);
+    b.flip(res);
+    ref_b.flip();
+    a.view().bitwise_andnot(b.view());
+    for (size_t i = 0; i < ref_a.size(); i++) {
+      ref_a[i] = ref_a[i] && !ref_b[i];
+    }
+    expect_bits(a.view(), ref_a);
+
+    // Rank and select
+    {
+      auto rs     = host_bitset_rank_select<bitset_t, index_t>(a.view());
+      index_t rnk = 0;
+      for (index_t i = 0; i < index_t(ref_a.size()); i++) {
+        ASSERT_EQ(rs.rank(i), rnk);
+        if (ref_a[i]) {
+          ASSERT_EQ(rs.select(rnk), i);
+          rnk++;
+        }
+      }
+      ASSERT_EQ(rs.rank(index_t(ref_a.size())), rnk);
+      ASSERT_EQ(rs.count(), rnk);
+    }
+
+    // CSR
+    {
+      auto n_rows = int(spec.n_rows);
+      auto csr    = raft::make_host_csr_matrix<float, int, int, int>(res, n_rows, int(a.size()));
+      a.view().to_csr(res, csr);
+      auto structure = csr.structure_view();
+      auto n_set     = int(a.view().count());
+      ASSERT_EQ(structure.get_nnz(), n_set * n_rows);
+      for (int row = 0; row < n_rows; row++) {
+        ASSERT_EQ(structure.get_indptr().data()[row + 1], (row + 1) * n_set);
+        int pos = row * n_set;
+        for (index_t i = 0; i < a.size(); i++) {
+          if (ref_a[i]) {
+            ASSERT_EQ(structure.get_indices().data()[pos], int(i));
+            ASSERT_EQ(csr.get_elements().data()[pos], 1.0f);
+            pos++;
+          }
+        }
+      }
+      b.view().from_csr(res, csr);
+      expect_bits(b.view(), ref_a);
+    }
+
+    // Resize
+    a.resize(res, index_t(spec.bitset_len + 100), true);
+    ref_a.resize(spec.bitset_len + 100, true);
+    expect_bits(a.view(), ref_a);
+    a.resize(res, index_t(spec.bitset_len / 2));
+    ref_a.resize(spec.bitset_len / 2);
+    expect_bits(a.view(), ref_a);
+
+    // The same words as the device views
+    auto device_view = bitset_view<bitset_t, index_t>(a.data(), a.size());
+    auto host_view   = host_bitset_view<bitset_t, index_t>(device_view);
+    ASSERT_EQ(host_view.data(), a.data());
+    ASSERT_EQ(host_view.size(), a.size());
+    ASSERT_EQ(host_view.to_bitset_view().data(), a.data());
+  }
+};
+
+template <typename bitmap_t, typename index_t>
+class HostBitmapTest : public testing::TestWithParam<test_spec_host_bitset> {
+ protected:
+  const test_spec_host_bitset spec;
+  raft::resources res;
+
+ public:
+  HostBitmapTest() : spec(testing::TestWithParam<test_spec_host_bitset>::GetParam()) {}
+
+  void run()
+  {
+    auto n_rows = index_t(spec.n_rows);
+    auto n_cols = index_t(spec.bitset_len);
+    std::mt19937_64 rng{42};
+    std::bernoulli_distribution dist(double(spec.mask_len) / double(spec.bitset_len));
+    std::vector<bool> ref(size_t(n_rows) * n_cols);
+    auto bits = host_bitset<bitmap_t, index_t>(res, n_rows * n_cols, false);
+    auto map  = host_bitmap_view<bitmap_t, index_t>(bits.data(), n_rows, n_cols);
+    for (index_t row = 0; row < n_rows; row++) {
+      for (index_t col = 0; col < n_cols; col++) {
+        if (dist(rng)) {
+          ref[size_t(row) * n_cols + col] = true;
+          map.set(row, col, true);
+        }
+      }
+    }
+
+    auto csr = raft::make_host_csr_matrix<float, int, int, int>(res, int(n_rows), int(n_cols));
+    map.to_csr(res, csr);
+    auto structure = csr.structure_view();
+    ASSERT_EQ(structure.get_nnz(), int(map.count()));
+    int pos = 0;
+    for (index_t row = 0; row < n_rows; row++) {
+      ASSERT_EQ(structure.get_indptr().data()[row], pos);
+      ASSERT_EQ(map.count_row(row), index_t(structure.get_indptr().data()[row + 1] - pos));
+      for (index_t col = 0; col < n_cols; col++) {
+        ASSERT_EQ(map.test(row, col), bool(ref[size_t(row) * n_cols + col]));
+        if (ref[size_t(row) * n_cols + col]) {
+          ASSERT_EQ(structure.get_indices().data()[pos++], int(col));
+        }
+      }
+    }
+
+    map.flip();
+    map.from_csr(res, csr);
+    for (index_t row = 0; row < n_rows; row++) {
+      for (index_t col = 0; col < n_cols; col++) {
+        ASSERT_EQ(map.test(row, col), bool(ref[size_t(row) * n_cols + col]));
+      }
+    }
+
+    auto device_view = bitmap_view<bitmap_t, index_t>(bits.data(), n_rows, n_cols);
+    auto host_view   = host_bitmap_view<bitmap_t, index_t>(device_view);
+    ASSERT_EQ(host_view.data(), bits.data());
+    ASSERT_EQ(host_view.get_n_rows(), n_rows);
+    ASSERT_EQ(host_view.get_n_cols(), n_cols);
+  }
+};
+
+auto inputs_host_bitset = ::testing::Values(test_spec_host_bitset{32, 5, 3},
+                                            test_spec_host_bitset{100, 30, 1},
+                                            test_spec_host_bitset{1024, 55, 4},
+                                            test_spec_host_bitset{10000, 1000, 2},
+                                            test_spec_host_bitset{100003, 40000, 3});
+
+using HostBitsetUint8_32 = HostBitsetTest<uint8_t, uint32_t>;
+TEST_P(HostBitsetUint8_32, Run) { run(); }
+INSTANTIATE_TEST_CASE_P(HostBitsetTest, HostBitsetUint8_32, inputs_host_bitset);
+
+using HostBitsetUint32_32 = HostBitsetTest<uint32_t, uint32_t>;
+TEST_P(HostBitsetUint32_32, Run) { run(); }
+INSTANTIATE_TEST_CASE_P(HostBitsetTest, HostBitsetUint32_32, inputs_host_bitset);
+
+using HostBitsetUint64_64 = HostBitsetTest<uint64_t, uint64_t>;
+TEST_P(HostBitsetUint64_64, Run) { run(); }
+INSTANTIATE_TEST_CASE_P(HostBitsetTest, HostBitsetUint64_64, inputs_host_bitset);
+
+using HostBitmapUint32_32 = HostBitmapTest<uint32_t, uint32_t>;
+TEST_P(HostBitmapUint32_32, Run) { run(); }
+INSTANTIATE_TEST_CASE_P(HostBitmapTest, HostBitmapUint32_32, inputs_host_bitset);
+
+using HostBitmapUint64_64 = HostBitmapTest<uint64_t, uint64_t>;
+TEST_P(HostBitmapUint64_64, Run) { run(); }
+INSTANTIATE_TEST_CASE_P(HostBitmapTest, HostBitmapUint64_64, inputs_host_bitset);
+
+}  // namespace raft::core
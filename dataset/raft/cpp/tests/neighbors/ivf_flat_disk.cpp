@@ -0,0 +1,399 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ivf_host_utils.hpp"
+
+#include <raft/core/host_mdspan.hpp>
+#include <raft/core/resources.hpp>
+#include <raft/neighbors/detail/ivf_list_cache.hpp>
+#include <raft/neighbors/ivf_flat_disk.hpp>
+#include <raft/neighbors/ivf_flat_host.hpp>
+#include <raft/neighbors/ivf_flat_host_serialize.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace raft::neighbors::ivf_flat {
+
+/** The capacity of the list cache, relative to the sizes of the lists of the index. */
+enum class cache_capacity {
+  /** Smaller than every list: nothing is cached, the lists are pinned by the search only. */
+  kBelowList,
+  /** All the probed lists of a batch fit into one chunk. */
+  kOneChunk,
+  /** A few lists per chunk. */
+  kManyChunks,
+};
+
+struct test_spec_ivf_flat_disk {
+  uint32_t n_probes;
+  uint32_t k;
+  uint32_t max_queries;
+  int num_threads;
+  cache_capacity capacity;
+  bool readahead;
+  raft::distance::DistanceType metric;
+  bool filtered;
+};
+
+auto operator<<(std::ostream& os, const test_spec_ivf_flat_disk& ss) -> std::ostream&
+{
+  os << "ivf_flat_disk{n_probes: " << ss.n_probes << ", k: " << ss.k
+     << ", max_queries: " << ss.max_queries << ", num_threads: " << ss.num_threads
+     << ", capacity: " << int(ss.capacity) << ", readahead: " << ss.readahead
+     << ", metric: " << int(ss.metric) << ", filtered: " << ss.filtered << "}";
+  return os;
+}
+
+/** Drops a third of the samples, a different third for every query. */
+struct query_dependent_filter {
+  inline bool operator()(const uint32_t query_ix, const int64_t sample_ix) const
+  {
+    return (sample_ix + query_ix) % 3 != 0;
+  }
+};
+
+/** The total and the extreme sizes of the non-empty lists of an index in its file, in bytes. */
+struct list_bytes_summary {
+  uint32_t n_lists = 0;
+  uint64_t total   = 0;
+  uint64_t min     = std::numeric_limits<uint64_t>::max();
+  uint64_t max     = 0;
+};
+
+template <typename T, typename IdxT>
+auto summarize_lists(const disk_index<T, IdxT>& index) -> list_bytes_summary
+{
+  list_bytes_summary summary;
+  for (uint32_t label = 0; label < index.n_lists(); label++) {
+    if (index.list_sizes()(label) == 0) { continue; }
+    auto bytes = index.list_bytes(label);
+    summary.n_lists++;
+    summary.total += bytes;
+    summary.min = std::min(summary.min, bytes);
+    summary.max = std::max(summary.max, bytes);
+  }
+  return summary;
+}
+
+template <typename T>
+class IvfFlatDiskTest : public testing::TestWithParam<test_spec_ivf_flat_disk> {
+ protected:
+  using IdxT                         = int64_t;
+  static constexpr uint32_t kRows    = 3000;
+  static constexpr uint32_t kQueries = 60;
+  static constexpr uint32_t kDim     = 24;
+  static constexpr uint32_t kLists   = 50;
+  const test_spec_ivf_flat_disk spec;
+  raft::resources res;
+
+ public:
+  IvfFlatDiskTest() : spec(testing::TestWithParam<test_spec_ivf_flat_disk>::GetParam()) {}
+
+  template <typename IndexT, typename FilterT>
+  void search(const IndexT& index,
+              const std::vector<T>& queries,
+              FilterT filter,
+              std::vector<IdxT>& neighbors,
+              std::vector<float>& distances)
+  {
+    host_search_params params;
+    params.n_probes    = spec.n_probes;
+    params.num_threads = spec.num_threads;
+    params.max_queries = spec.max_queries;
+    neighbors.resize(size_t(kQueries) * spec.k);
+    distances.resize(size_t(kQueries) * spec.k);
+    auto queries_view = raft::make_host_matrix_view<const T, IdxT>(queries.data(), kQueries, kDim);
+    auto neighbors_view =
+      raft::make_host_matrix_view<IdxT, IdxT>(neighbors.data(), kQueries, spec.k);
+    auto distances_view =
+      raft::make_host_matrix_view<float, IdxT>(distances.data(), kQueries, spec.k);
+    search_with_filtering(res, params, index, queries_view, neighbors_view, distances_view, filter);
+  }
+
+  template <typename FilterT>
+  void search_and_compare(const host_index<T, IdxT>& index,
+                          const disk_index<T, IdxT>& disk,
+                          const std::vector<T>& queries,
+                          FilterT filter)
+  {
+    std::vector<IdxT> expected_neighbors, neighbors;
+    std::vector<float> expected_distances, distances;
+    search(index, queries, filter, expected_neighbors, expected_distances);
+    // The first search reads the lists, the second one finds (some of) them in the cache
+    for (int pass = 0; pass < 2; pass++) {
+      search(disk, queries, filter, neighbors, distances);
+      ASSERT_EQ(expected_neighbors, neighbors) << "pass " << pass;
+      ASSERT_EQ(expected_distances, distances) << "pass " << pass;
+    }
+  }
+
+  void run()
+  {
+    auto data    = ivf_host_test::make_data<T>(kRows, kDim, 42);
+    auto queries = ivf_host_test::make_data<T>(kQueries, kDim, 7);
+    auto index   = ivf_host_test::make_flat_index<T, IdxT>(spec.metric, data, kDim, kLists, 42);
+    index.lists()[1].reset();
+    index.recompute_internal_state();
+    ivf_host_test::temp_file file;
+    serialize_host(res, file.path(), index);
+
+    // Size the cache by the lists of the file
+    auto summary = summarize_lists(deserialize_disk<T, IdxT>(res, file.path()));
+    ivf::list_cache_params cache_params;
+    cache_params.readahead = spec.readahead;
+    switch (spec.capacity) {
+      case cache_capacity::kBelowList: cache_params.capacity_bytes = summary.min - 1; break;
+      case cache_capacity::kOneChunk: cache_params.capacity_bytes = 2 * summary.total; break;
+      case cache_capacity::kManyChunks: cache_params.capacity_bytes = 8 * summary.max; break;
+    }
+    auto disk = deserialize_disk<T, IdxT>(res, file.path(), cache_params);
+    ASSERT_EQ(disk.size(), index.size());
+
+    if (spec.filtered) {
+      search_and_compare(index, disk, queries, query_dependent_filter{});
+    } else {
+      search_and_compare(index, disk, queries, [](uint32_t, IdxT) { return true; });
+    }
+    auto stats = disk.cache_stats();
+    ASSERT_LE(stats.resident_bytes, cache_params.capacity_bytes);
+    if (spec.capacity == cache_capacity::kBelowList) {
+      ASSERT_EQ(stats.hits, 0);
+      ASSERT_EQ(stats.readahead, 0);
+      ASSERT_EQ(stats.resident_bytes, 0);
+    }
+  }
+};
+
+using raft::distance::DistanceType;
+
+auto inputs_ivf_flat_disk = ::testing::Values(
+  // The capacities of the cache, with and without the readahead
+  test_spec_ivf_flat_disk{
+    5, 10, 0, 0, cache_capacity::kBelowList, false, DistanceType::L2Expanded, false},
+  test_spec_ivf_flat_disk{
+    5, 10, 0, 0, cache_capacity::kBelowList, true, DistanceType::L2Expanded, false},
+  test_spec_ivf_flat_disk{
+    5, 10, 0, 3, cache_capacity::kOneChunk, false, DistanceType::InnerProduct, false},
+  test_spec_ivf_flat_disk{
+    5, 10, 0, 3, cache_capacity::kOneChunk, true, DistanceType::InnerProduct, false},
+  test_spec_ivf_flat_disk{
+    8, 10, 0, 0, cache_capacity::kManyChunks, false, DistanceType::L2SqrtExpanded, false},
+  test_spec_ivf_flat_disk{
+    8, 10, 0, 3, cache_capacity::kManyChunks, true, DistanceType::L2SqrtExpanded, false},
+  // Several batches: the readahead crosses the batches, the lists are pinned chunk by chunk
+  test_spec_ivf_flat_disk{
+    8, 10, 7, 3, cache_capacity::kBelowList, true, DistanceType::L2Expanded, false},
+  test_spec_ivf_flat_disk{
+    8, 10, 7, 3, cache_capacity::kOneChunk, true, DistanceType::L2Expanded, false},
+  test_spec_ivf_flat_disk{
+    8, 10, 7, 3, cache_capacity::kManyChunks, true, DistanceType::InnerProduct, false},
+  test_spec_ivf_flat_disk{
+    8, 10, 7, 0, cache_capacity::kManyChunks, false, DistanceType::InnerProduct, false},
+  test_spec_ivf_flat_disk{
+    50, 20, 1, 2, cache_capacity::kManyChunks, true, DistanceType::L2Expanded, false},
+  // Filters see the indices of the pinned lists
+  test_spec_ivf_flat_disk{
+    8, 20, 7, 3, cache_capacity::kManyChunks, true, DistanceType::L2Expanded, true},
+  test_spec_ivf_flat_disk{
+    8, 20, 0, 3, cache_capacity::kBelowList, false, DistanceType::InnerProduct, true},
+  // Fewer records in the probed lists than k: the results are padded
+  test_spec_ivf_flat_disk{
+    1, 128, 7, 3, cache_capacity::kManyChunks, true, DistanceType::L2Expanded, false});
+
+using IvfFlatDiskF = IvfFlatDiskTest<float>;
+TEST_P(IvfFlatDiskF, Run) { run(); }
+INSTANTIATE_TEST_CASE_P(IvfFlatDiskTest, IvfFlatDiskF, inputs_ivf_flat_disk);
+
+using IvfFlatDiskI8 = IvfFlatDiskTest<int8_t>;
+TEST_P(IvfFlatDiskI8, Run) { run(); }
+INSTANTIATE_TEST_CASE_P(IvfFlatDiskTest, IvfFlatDiskI8, inputs_ivf_flat_disk);
+
+/** The counters of the list cache, probing all the lists so that every search reads all of them. */
+class IvfFlatDiskCacheTest : public testing::Test {
+ protected:
+  using IdxT                         = int64_t;
+  static constexpr uint32_t kRows    = 2000;
+  static constexpr uint32_t kQueries = 50;
+  static constexpr uint32_t kDim     = 16;
+  static constexpr uint32_t kLists   = 20;
+  raft::resources res;
+  std::vector<float> data    = ivf_host_test::make_data<float>(kRows, kDim, 42);
+  std::vector<float> queries = ivf_host_test::make_data<float>(kQueries, kDim, 7);
+  ivf_host_test::temp_file file;
+  list_bytes_summary summary;
+
+  void SetUp() override
+  {
+    auto index = ivf_host_test::make_flat_index<float, IdxT>(
+      raft::distance::DistanceType::L2Expanded, data, kDim, kLists, 42);
+    index.lists()[1].reset();
+    index.recompute_internal_state();
+    serialize_host(res, file.path(), index);
+    summary = summarize_lists(deserialize_disk<float, IdxT>(res, file.path()));
+  }
+
+  auto open(uint64_t capacity_bytes, bool readahead, uint32_t n_shards = 16)
+    -> disk_index<float, IdxT>
+  {
+    ivf::list_cache_params cache_params;
+    cache_params.capacity_bytes = capacity_bytes;
+    cache_params.n_shards       = n_shards;
+    cache_params.readahead      = readahead;
+    return deserialize_disk<float, IdxT>(res, file.path(), cache_params);
+  }
+
+  void search(const disk_index<float, IdxT>& index, uint32_t max_queries = 0)
+  {
+    host_search_params params;
+    params.n_probes    = kLists;
+    params.max_queries = max_queries;
+    auto neighbors     = raft::make_host_matrix<IdxT, IdxT>(kQueries, 10);
+    auto distances     = raft::make_host_matrix<float, IdxT>(kQueries, 10);
+    ivf_flat::search(res,
+                     params,
+                     index,
+                     raft::make_host_matrix_view<const float, IdxT>(queries.data(), kQueries, kDim),
+                     neighbors.view(),
+                     distances.view());
+  }
+};
+
+TEST_F(IvfFlatDiskCacheTest, AllListsCached)
+{
+  const uint64_t n_lists = summary.n_lists;
+  auto index             = open(2 * summary.total, false);
+  search(index);
+  auto stats = index.cache_stats();
+  ASSERT_EQ(stats.misses, n_lists);
+  ASSERT_EQ(stats.hits, 0);
+  ASSERT_EQ(stats.evictions, 0);
+  ASSERT_EQ(stats.resident_bytes, summary.total);
+  search(index);
+  stats = index.cache_stats();
+  ASSERT_EQ(stats.misses, n_lists);
+  ASSERT_EQ(stats.hits, n_lists);
+
+  // Every batch reads every list once: the later batches find them in the cache
+  auto batched = open(2 * summary.total, true);
+  search(batched, 10);
+  stats = batched.cache_stats();
+  ASSERT_EQ(stats.misses, n_lists);
+  ASSERT_EQ(stats.hits, 4 * n_lists);
+  ASSERT_EQ(stats.readahead, 0);
+  ASSERT_EQ(stats.evictions, 0);
+}
+
+TEST_F(IvfFlatDiskCacheTest, Readahead)
+{
+  // The lists of every chunk but the first are read ahead, then found in the cache
+  auto index = open(6 * summary.max, true);
+  search(index);
+  auto stats = index.cache_stats();
+  ASSERT_GT(stats.readahead, 0);
+  ASSERT_EQ(stats.hits, stats.readahead);
+  ASSERT_EQ(stats.hits + stats.misses, summary.n_lists);
+  ASSERT_GT(stats.evictions, 0);
+  ASSERT_LE(stats.resident_bytes, 6 * summary.max);
+
+  auto no_readahead = open(6 * summary.max, false);
+  search(no_readahead);
+  stats = no_readahead.cache_stats();
+  ASSERT_EQ(stats.readahead, 0);
+  ASSERT_EQ(stats.hits, 0);
+  ASSERT_EQ(stats.misses, summary.n_lists);
+  ASSERT_GE(stats.evictions * summary.max, summary.total - 6 * summary.max);
+  ASSERT_LE(stats.resident_bytes, 6 * summary.max);
+}
+
+TEST_F(IvfFlatDiskCacheTest, BelowList)
+{
+  auto index = open(summary.min - 1, true);
+  search(index, 10);
+  search(index, 10);
+  auto stats = index.cache_stats();
+  ASSERT_EQ(stats.misses, 2 * 5 * summary.n_lists);
+  ASSERT_EQ(stats.hits, 0);
+  ASSERT_EQ(stats.readahead, 0);
+  ASSERT_EQ(stats.evictions, 0);
+  ASSERT_EQ(stats.resident_bytes, 0);
+}
+
+TEST_F(IvfFlatDiskCacheTest, SharedBudget)
+{
+  // The shards share the budget: a list larger than `capacity / n_shards` is still cached
+  auto index = open(summary.max, false, 64);
+  search(index);
+  auto stats = index.cache_stats();
+  ASSERT_GT(stats.resident_bytes, 0);
+  ASSERT_LE(stats.resident_bytes, summary.max);
+}
+
+/** A list of the cache test, of `bytes` size. */
+struct fake_list {
+  uint64_t bytes;
+};
+
+TEST(IvfListCacheTest, EvictsAcrossShards)
+{
+  using cache_type = ivf::detail::host_list_cache<fake_list>;
+  cache_type cache(100, 4);
+  auto list = [](uint64_t bytes) { return std::make_shared<const fake_list>(fake_list{bytes}); };
+
+  // Labels 0..3 go to the different shards, the fourth list evicts the oldest one
+  for (uint32_t label = 0; label < 4; label++) {
+    cache.insert(label, list(30), 30);
+  }
+  ASSERT_FALSE(cache.contains(0));
+  ASSERT_TRUE(cache.contains(1) && cache.contains(2) && cache.contains(3));
+  auto stats = cache.stats();
+  ASSERT_EQ(stats.evictions, 1);
+  ASSERT_EQ(stats.resident_bytes, 90);
+
+  // A use makes a list the most recently used one
+  ASSERT_NE(cache.get(1), nullptr);
+  ASSERT_EQ(cache.get(0), nullptr);
+  cache.insert(5, list(30), 30, true);
+  ASSERT_FALSE(cache.contains(2));
+  ASSERT_TRUE(cache.contains(1) && cache.contains(3) && cache.contains(5));
+
+  // A list larger than a shard's share of the capacity evicts the lists of the other shards
+  auto pinned = cache.get(3);
+  cache.insert(4, list(90), 90);
+  ASSERT_TRUE(cache.contains(4));
+  ASSERT_FALSE(cache.contains(1) || cache.contains(3) || cache.contains(5));
+  // An evicted list stays alive while it's used
+  ASSERT_EQ(pinned->bytes, 30);
+
+  // A list larger than the cache isn't added
+  cache.insert(6, list(101), 101);
+  ASSERT_FALSE(cache.contains(6));
+  ASSERT_TRUE(cache.contains(4));
+
+  stats = cache.stats();
+  ASSERT_EQ(stats.hits, 2);
+  ASSERT_EQ(stats.misses, 1);
+  ASSERT_EQ(stats.readahead, 1);
+  ASSERT_EQ(stats.evictions, 5);
+  ASSERT_EQ(stats.resident_bytes, 90);
+}
+
+}  // namespace raft::neighbors::ivf_flat
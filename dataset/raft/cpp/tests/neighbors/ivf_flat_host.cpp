@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ivf_host_utils.hpp"
+
+#include <raft/core/host_mdspan.hpp>
+#include <raft/core/resources.hpp>
+#include <raft/neighbors/ivf_flat_host.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace raft::neighbors::ivf_flat {
+
+struct test_spec_ivf_flat_host {
+  uint32_t n_rows;
+  uint32_t n_queries;
+  uint32_t dim;
+  uint32_t n_lists;
+  uint32_t n_probes;
+  uint32_t k;
+  uint32_t max_queries;
+  int num_threads;
+  raft::distance::DistanceType metric;
+  bool filtered;
+};
+
+auto operator<<(std::ostream& os, const test_spec_ivf_flat_host& ss) -> std::ostream&
+{
+  os << "ivf_flat_host{n_rows: " << ss.n_rows << ", n_queries: " << ss.n_queries
+     << ", dim: " << ss.dim << ", n_lists: " << ss.n_lists << ", n_probes: " << ss.n_probes
+     << ", k: " << ss.k << ", max_queries: " << ss.max_queries
+     << ", num_threads: " << ss.num_threads << ", metric: " << int(ss.metric)
+     << ", filtered: " << ss.filtered << "}";
+  return os;
+}
+
+/** Drops a third of the samples, a different third for every query. */
+struct query_dependent_filter {
+  inline bool operator()(const uint32_t query_ix, const int64_t sample_ix) const
+  {
+    return (sample_ix + query_ix) % 3 != 0;
+  }
+};
+
+template <typename T>
+class IvfFlatHostTest : public testing::TestWithParam<test_spec_ivf_flat_host> {
+ protected:
+  using IdxT = int64_t;
+  const test_spec_ivf_flat_host spec;
+  raft::resources res;
+
+ public:
+  IvfFlatHostTest() : spec(testing::TestWithParam<test_spec_ivf_flat_host>::GetParam()) {}
+
+  template <typename FilterT>
+  void search_and_compare(const host_index<T, IdxT>& index,
+                          const std::vector<T>& data,
+                          const std::vector<T>& queries,
+                          FilterT filter)
+  {
+    std::vector<IdxT> expected_neighbors;
+    std::vector<float> expected_distances;
+    ivf_host_test::naive_ivf_search(
+      spec.metric,
+      data,
+      spec.dim,
+      index.centers().data_handle(),
+      spec.n_lists,
+      [&index](uint32_t label) { return ivf_host_test::list_members(index, label); },
+      queries.data(),
+      spec.n_queries,
+      spec.k,
+      spec.n_probes,
+      filter,
+      expected_neighbors,
+      expected_distances);
+
+    host_search_params params;
+    params.n_probes    = spec.n_probes;
+    params.num_threads = spec.num_threads;
+    params.max_queries = spec.max_queries;
+    std::vector<IdxT> neighbors(size_t(spec.n_queries) * spec.k);
+    std::vector<float> distances(size_t(spec.n_queries) * spec.k);
+    auto queries_view =
+      raft::make_host_matrix_view<const T, IdxT>(queries.data(), spec.n_queries, spec.dim);
+    auto neighbors_view =
+      raft::make_host_matrix_view<IdxT, IdxT>(neighbors.data(), spec.n_queries, spec.k);
+    auto distances_view =
+      raft::make_host_matrix_view<float, IdxT>(distances.data(), spec.n_queries, spec.k);
+    search_with_filtering(res, params, index, queries_view, neighbors_view, distances_view, filter);
+
+    // The integer types are searched exactly, the floats up to the order of the summation
+    double tolerance = std::is_same_v<T, float> ? 1e-4 : 1e-6;
+    ivf_host_test::expect_same_neighbors(spec.metric,
+                                         data,
+                                         spec.dim,
+                                         queries.data(),
+                                         spec.n_queries,
+                                         spec.k,
+                                         expected_neighbors,
+                                         expected_distances,
+                                         neighbors,
+                                         distances,
+                                         tolerance);
+  }
+
+  void run()
+  {
+    auto data    = ivf_host_test::make_data<T>(spec.n_rows, spec.dim, 42);
+    auto queries = ivf_host_test::make_data<T>(spec.n_queries, spec.dim, 7);
+    auto index =
+      ivf_host_test::make_flat_index<T, IdxT>(spec.metric, data, spec.dim, spec.n_lists, 42);
+    ASSERT_EQ(index.size(), IdxT(spec.n_rows));
+    ASSERT_EQ(index.veclen(), spec.dim % (16 / sizeof(T)) == 0 ? 16 / sizeof(T) : 1);
+
+    if (spec.filtered) {
+      search_and_compare(index, data, queries, query_dependent_filter{});
+    } else {
+      search_and_compare(index, data, queries, [](uint32_t, IdxT) { return true; });
+    }
+  }
+};
+
+using raft::distance::DistanceType;
+
+// dim 32 gives the longest vectorized loads of every type, dim 17 the scalar ones (veclen 1)
+auto inputs_ivf_flat_host = ::testing::Values(
+  test_spec_ivf_flat_host{2000, 100, 32, 40, 5, 10, 0, 0, DistanceType::L2Expanded, false},
+  test_spec_ivf_flat_host{2000, 100, 17, 40, 5, 10, 0, 0, DistanceType::L2Expanded, false},
+  test_spec_ivf_flat_host{2000, 100, 32, 40, 5, 10, 0, 3, DistanceType::L2SqrtExpanded, false},
+  test_spec_ivf_flat_host{2000, 100, 17, 40, 5, 10, 0, 3, DistanceType::L2SqrtExpanded, false},
+  test_spec_ivf_flat_host{2000, 100, 32, 40, 5, 10, 0, 0, DistanceType::InnerProduct, false},
+  test_spec_ivf_flat_host{2000, 100, 17, 40, 5, 10, 0, 0, DistanceType::InnerProduct, false},
+  // Probing all the lists, and more than all of them, is the exact search
+  test_spec_ivf_flat_host{1000, 50, 32, 20, 20, 16, 0, 0, DistanceType::L2Expanded, false},
+  test_spec_ivf_flat_host{1000, 50, 17, 20, 64, 16, 0, 0, DistanceType::InnerProduct, false},
+  // Fewer records in the probed lists than k: the results are padded
+  test_spec_ivf_flat_host{500, 50, 32, 50, 1, 64, 0, 0, DistanceType::L2Expanded, false},
+  test_spec_ivf_flat_host{500, 50, 17, 50, 2, 64, 0, 3, DistanceType::InnerProduct, false},
+  test_spec_ivf_flat_host{500, 50, 32, 50, 1, 64, 0, 0, DistanceType::L2SqrtExpanded, true},
+  // Filters see the global index of the query
+  test_spec_ivf_flat_host{2000, 100, 32, 40, 8, 20, 0, 3, DistanceType::L2Expanded, true},
+  test_spec_ivf_flat_host{2000, 100, 17, 40, 8, 20, 7, 3, DistanceType::InnerProduct, true},
+  // Several batches of queries
+  test_spec_ivf_flat_host{2000, 100, 32, 40, 5, 10, 7, 0, DistanceType::L2Expanded, false},
+  test_spec_ivf_flat_host{2000, 100, 17, 40, 5, 10, 7, 3, DistanceType::L2SqrtExpanded, false},
+  test_spec_ivf_flat_host{2000, 100, 32, 40, 40, 10, 1, 2, DistanceType::InnerProduct, false});
+
+using IvfFlatHostF = IvfFlatHostTest<float>;
+TEST_P(IvfFlatHostF, Run) { run(); }
+INSTANTIATE_TEST_CASE_P(IvfFlatHostTest, IvfFlatHostF, inputs_ivf_flat_host);
+
+using IvfFlatHostI8 = IvfFlatHostTest<int8_t>;
+TEST_P(IvfFlatHostI8, Run) { run(); }
+INSTANTIATE_TEST_CASE_P(IvfFlatHostTest, IvfFlatHostI8, inputs_ivf_flat_host);
+
+using IvfFlatHostU8 = IvfFlatHostTest<uint8_t>;
+TEST_P(IvfFlatHostU8, Run) { run(); }
+INSTANTIATE_TEST_CASE_P(IvfFlatHostTest, IvfFlatHostU8, inputs_ivf_flat_host);
+
+}  // namespace raft::neighbors::ivf_flat
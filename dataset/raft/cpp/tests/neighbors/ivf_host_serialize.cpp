@@ -0,0 +1,668 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ivf_host_utils.hpp"
+
+#include <raft/core/error.hpp>
+#include <raft/core/host_mdspan.hpp>
+#include <raft/core/resources.hpp>
+#include <raft/core/serialize.hpp>
+#include <raft/neighbors/detail/ivf_container.hpp>
+#include <raft/neighbors/ivf_flat_host.hpp>
+#include <raft/neighbors/ivf_flat_host_serialize.hpp>
+#include <raft/neighbors/ivf_pq_host.hpp>
+#include <raft/neighbors/ivf_pq_host_serialize.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace raft::neighbors::ivf {
+
+using detail::container_param;
+using detail::container_section;
+
+template <typename T>
+void expect_equal_arrays(const T* a, const T* b, size_t size, const char* what)
+{
+  for (size_t i = 0; i < size; i++) {
+    ASSERT_EQ(a[i], b[i]) << what << " [" << i << "]";
+  }
+}
+
+template <typename T, typename IdxT>
+void expect_equal_indexes(const ivf_flat::host_index<T, IdxT>& a,
+                          const ivf_flat::host_index<T, IdxT>& b)
+{
+  ASSERT_EQ(a.metric(), b.metric());
+  ASSERT_EQ(a.dim(), b.dim());
+  ASSERT_EQ(a.n_lists(), b.n_lists());
+  ASSERT_EQ(a.veclen(), b.veclen());
+  ASSERT_EQ(a.size(), b.size());
+  ASSERT_EQ(a.adaptive_centers(), b.adaptive_centers());
+  ASSERT_EQ(a.conservative_memory_allocation(), b.conservative_memory_allocation());
+  expect_equal_arrays(
+    a.centers().data_handle(), b.centers().data_handle(), a.centers().size(), "centers");
+  ASSERT_EQ(a.center_norms().has_value(), b.center_norms().has_value());
+  if (a.center_norms().has_value()) {
+    expect_equal_arrays(a.center_norms()->data_handle(),
+                        b.center_norms()->data_handle(),
+                        a.center_norms()->size(),
+                        "center norms");
+  }
+  for (uint32_t label = 0; label < a.n_lists(); label++) {
+    ASSERT_EQ(a.list_sizes()(label), b.list_sizes()(label)) << "list " << label;
+    if (a.list_sizes()(label) == 0) { continue; }
+    const auto& la = *a.lists()[label];
+    const auto& lb = *b.lists()[label];
+    ASSERT_EQ(la.data.size(), lb.data.size()) << "list " << label;
+    expect_equal_arrays(la.data.data_handle(), lb.data.data_handle(), la.data.size(), "data");
+    expect_equal_arrays(la.indices.data_handle(), lb.indices.data_handle(), la.size, "indices");
+  }
+}
+
+template <typename IdxT>
+void expect_equal_indexes(const ivf_pq::host_index<IdxT>& a, const ivf_pq::host_index<IdxT>& b)
+{
+  ASSERT_EQ(a.metric(), b.metric());
+  ASSERT_EQ(a.codebook_kind(), b.codebook_kind());
+  ASSERT_EQ(a.dim(), b.dim());
+  ASSERT_EQ(a.pq_bits(), b.pq_bits());
+  ASSERT_EQ(a.pq_dim(), b.pq_dim());
+  ASSERT_EQ(a.n_lists(), b.n_lists());
+  ASSERT_EQ(a.size(), b.size());
+  ASSERT_EQ(a.conservative_memory_allocation(), b.conservative_memory_allocation());
+  expect_equal_arrays(a.pq_centers().data_handle(),
+                      b.pq_centers().data_handle(),
+                      a.pq_centers().size(),
+                      "pq centers");
+  expect_equal_arrays(
+    a.centers().data_handle(), b.centers().data_handle(), a.centers().size(), "centers");
+  expect_equal_arrays(a.centers_rot().data_handle(),
+                      b.centers_rot().data_handle(),
+                      a.centers_rot().size(),
+                      "rotated centers");
+  expect_equal_arrays(a.rotation_matrix().data_handle(),
+                      b.rotation_matrix().data_handle(),
+                      a.rotation_matrix().size(),
+                      "rotation matrix");
+  for (uint32_t label = 0; label < a.n_lists(); label++) {
+    ASSERT_EQ(a.list_sizes()(label), b.list_sizes()(label)) << "list " << label;
+    if (a.list_sizes()(label) == 0) { continue; }
+    const auto& la = *a.lists()[label];
+    const auto& lb = *b.lists()[label];
+    ASSERT_EQ(la.data.size(), lb.data.size()) << "list " << label;
+    expect_equal_arrays(la.data.data_handle(), lb.data.data_handle(), la.data.size(), "codes");
+    expect_equal_arrays(la.indices.data_handle(), lb.indices.data_handle(), la.size, "indices");
+  }
+}
+
+/** Both indexes must return the same neighbors and distances. */
+template <typename T, typename IndexT>
+void expect_equal_search(raft::resources const& res,
+                         const IndexT& a,
+                         const IndexT& b,
+                         const std::vector<T>& queries,
+                         uint32_t n_queries,
+                         uint32_t dim)
+{
+  using IdxT            = int64_t;
+  constexpr uint32_t kK = 10;
+  std::vector<IdxT> neighbors[2];
+  std::vector<float> distances[2];
+  const IndexT* indexes[2] = {&a, &b};
+  for (int i = 0; i < 2; i++) {
+    neighbors[i].resize(size_t(n_queries) * kK);
+    distances[i].resize(size_t(n_queries) * kK);
+    auto queries_view = raft::make_host_matrix_view<const T, IdxT>(queries.data(), n_queries, dim);
+    auto neighbors_view =
+      raft::make_host_matrix_view<IdxT, IdxT>(neighbors[i].data(), n_queries, kK);
+    auto distances_view =
+      raft::make_host_matrix_view<float, IdxT>(distances[i].data(), n_queries, kK);
+    if constexpr (std::is_same_v<IndexT, ivf_pq::host_index<IdxT>>) {
+      ivf_pq::host_search_params params;
+      params.n_probes = 8;
+      ivf_pq::search(res, params, *indexes[i], queries_view, neighbors_view, distances_view);
+    } else {
+      ivf_flat::host_search_params params;
+      params.n_probes = 8;
+      ivf_flat::search(res, params, *indexes[i], queries_view, neighbors_view, distances_view);
+    }
+  }
+  ASSERT_EQ(neighbors[0], neighbors[1]);
+  ASSERT_EQ(distances[0], distances[1]);
+}
+
+/** Write an IVF-Flat index in the stream format of the device `ivf_flat::serialize`. */
+template <typename T, typename IdxT>
+void serialize_legacy(raft::resources const& res,
+                      const std::string& filename,
+                      const ivf_flat::host_index<T, IdxT>& index)
+{
+  std::ofstream os(filename, std::ios::out | std::ios::binary);
+  std::string dtype = raft::detail::numpy_serializer::get_numpy_dtype<T>().to_string();
+  dtype.resize(4);
+  os.write(dtype.data(), 4);
+  serialize_scalar(res, os, ivf_flat::detail::serialization_version);
+  serialize_scalar(res, os, index.size());
+  serialize_scalar(res, os, index.dim());
+  serialize_scalar(res, os, index.n_lists());
+  serialize_scalar(res, os, index.metric());
+  serialize_scalar(res, os, index.adaptive_centers());
+  serialize_scalar(res, os, index.conservative_memory_allocation());
+  serialize_mdspan(res, os, index.centers());
+  serialize_scalar(res, os, index.center_norms().has_value());
+  if (index.center_norms().has_value()) { serialize_mdspan(res, os, *index.center_norms()); }
+  serialize_mdspan(res, os, index.list_sizes());
+  for (uint32_t label = 0; label < index.n_lists(); label++) {
+    const auto& list = index.lists()[label];
+    serialize_scalar(res, os, list.has_value() ? list->data.extent(0) : uint32_t{0});
+    if (!list.has_value()) { continue; }
+    serialize_mdspan(res, os, raft::make_const_mdspan(list->data));
+    serialize_mdspan(res, os, raft::make_const_mdspan(list->indices));
+  }
+}
+
+/** Write an IVF-PQ index in the stream format of the device `ivf_pq::serialize`. */
+template <typename IdxT>
+void serialize_legacy(raft::resources const& res,
+                      const std::string& filename,
+                      const ivf_pq::host_index<IdxT>& index)
+{
+  std::ofstream os(filename, std::ios::out | std::ios::binary);
+  serialize_scalar(res, os, ivf_pq::detail::kSerializationVersion);
+  serialize_scalar(res, os, index.size());
+  serialize_scalar(res, os, index.dim());
+  serialize_scalar(res, os, index.pq_bits());
+  serialize_scalar(res, os, index.pq_dim());
+  serialize_scalar(res, os, index.conservative_memory_allocation());
+  serialize_scalar(res, os, index.metric());
+  serialize_scalar(res, os, index.codebook_kind());
+  serialize_scalar(res, os, index.n_lists());
+  serialize_mdspan(res, os, index.pq_centers());
+  serialize_mdspan(res, os, index.centers());
+  serialize_mdspan(res, os, index.centers_rot());
+  serialize_mdspan(res, os, index.rotation_matrix());
+  serialize_mdspan(res, os, index.list_sizes());
+  for (uint32_t label = 0; label < index.n_lists(); label++) {
+    const auto& list = index.lists()[label];
+    serialize_scalar(res, os, list.has_value() ? list->size : uint32_t{0});
+    if (!list.has_value()) { continue; }
+    serialize_mdspan(res, os, raft::make_const_mdspan(list->data));
+    serialize_mdspan(res, os, raft::make_const_mdspan(list->indices));
+  }
+}
+
+/**
+ * Rewrite an index container the way a newer or an older writer could: without the parameters
+ * `dropped_params` and the section `dropped_section`, with the parameter records `extra_params`
+ * appended (overriding the known ones) and an unknown section in front of the known ones.
+ */
+void rewrite_container(const std::string& src,
+                       const std::string& dst,
+                       const std::vector<container_param>& dropped_params,
+                       std::optional<container_section> dropped_section,
+                       const std::map<uint32_t, std::vector<uint8_t>>& extra_params)
+{
+  detail::container_reader reader(src);
+
+  // The records of the params section: [uint32_t key, uint32_t size, value]...
+  auto records = reader.params().encode();
+  std::vector<uint8_t> kept;
+  for (size_t pos = 0; pos < records.size();) {
+    uint32_t header[2];
+    std::memcpy(header, records.data() + pos, sizeof(header));
+    size_t record_size = sizeof(header) + header[1];
+    if (std::find(dropped_params.begin(),
+                  dropped_params.end(),
+                  static_cast<container_param>(header[0])) == dropped_params.end()) {
+      kept.insert(kept.end(), records.begin() + pos, records.begin() + pos + record_size);
+    }
+    pos += record_size;
+  }
+  for (const auto& [key, value] : extra_params) {
+    uint32_t header[2] = {key, uint32_t(value.size())};
+    auto* p            = reinterpret_cast<const uint8_t*>(header);
+    kept.insert(kept.end(), p, p + sizeof(header));
+    kept.insert(kept.end(), value.begin(), value.end());
+  }
+  auto params = detail::container_params::decode(kept);
+
+  std::vector<std::vector<uint8_t>> storage;
+  storage.reserve(16 + 2 * reader.n_lists());
+  std::vector<detail::container_array> arrays;
+  storage.emplace_back(100, uint8_t{0xAB});
+  arrays.push_back({static_cast<container_section>(1000), storage.back().data(), 100});
+  for (auto id : {container_section::kCenters,
+                  container_section::kCenterNorms,
+                  container_section::kPqCenters,
+                  container_section::kCentersRot,
+                  container_section::kRotationMatrix}) {
+    if (id == dropped_section || !reader.section_size(id).has_value()) { continue; }
+    storage.push_back(reader.read_section(id));
+    arrays.push_back({id, storage.back().data(), storage.back().size()});
+  }
+  std::vector<detail::container_list> lists(reader.n_lists());
+  for (uint32_t label = 0; label < reader.n_lists(); label++) {
+    const auto& entry = reader.list(label);
+    if (entry.size == 0) { continue; }
+    auto& data    = storage.emplace_back(entry.data_size);
+    auto& indices = storage.emplace_back(entry.indices_size);
+    reader.read_list(label, data.data(), indices.data());
+    lists[label] = {data.data(), data.size(), indices.data(), indices.size(), entry.size};
+  }
+  detail::write_container(dst, params, arrays, lists, 0);
+}
+
+/** The table of contents entry of a section of an index container. */
+auto find_section(const std::vector<uint8_t>& file, container_section id)
+  -> detail::container_toc_entry
+{
+  detail::container_header header;
+  std::memcpy(&header, file.data(), sizeof(header));
+  for (uint32_t i = 0; i < header.n_sections; i++) {
+    detail::container_toc_entry entry;
+    std::memcpy(&entry,
+                file.data() + header.toc_offset + uint64_t(i) * header.toc_entry_size,
+                sizeof(entry));
+    if (entry.id == static_cast<uint32_t>(id)) { return entry; }
+  }
+  ADD_FAILURE() << "missing section " << static_cast<uint32_t>(id);
+  return {};
+}
+
+template <typename T>
+void patch(std::vector<uint8_t>& file, uint64_t offset, const T& value)
+{
+  std::memcpy(file.data() + offset, &value, sizeof(T));
+}
+
+/** The number of the open file descriptors of the process, to check for leaks. */
+auto count_open_files() -> size_t
+{
+  if (!std::filesystem::exists("/proc/self/fd")) { return 0; }
+  auto it = std::filesystem::directory_iterator("/proc/self/fd");
+  return std::distance(std::filesystem::begin(it), std::filesystem::end(it));
+}
+
+struct test_spec_ivf_host_serialize {
+  int num_threads;
+  bool mmap_lists;
+};
+
+auto operator<<(std::ostream& os, const test_spec_ivf_host_serialize& ss) -> std::ostream&
+{
+  os << "ivf_host_serialize{num_threads: " << ss.num_threads << ", mmap_lists: " << ss.mmap_lists
+     << "}";
+  return os;
+}
+
+class IvfHostSerializeTest : public testing::TestWithParam<test_spec_ivf_host_serialize> {
+ protected:
+  using IdxT                  = int64_t;
+  static constexpr uint32_t kRows    = 3000;
+  static constexpr uint32_t kQueries = 50;
+  const test_spec_ivf_host_serialize spec;
+  raft::resources res;
+
+ public:
+  IvfHostSerializeTest() : spec(testing::TestWithParam<test_spec_ivf_host_serialize>::GetParam())
+  {
+  }
+
+  auto load_params() const -> container_load_params
+  {
+    container_load_params params;
+    params.num_threads = spec.num_threads;
+    params.mmap_lists  = spec.mmap_lists;
+    return params;
+  }
+
+  template <typename T>
+  void run_flat(uint32_t dim, raft::distance::DistanceType metric)
+  {
+    auto data    = ivf_host_test::make_data<T>(kRows, dim, 42);
+    auto queries = ivf_host_test::make_data<T>(kQueries, dim, 7);
+    // More lists than records in some of them, and empty lists
+    auto index = ivf_host_test::make_flat_index<T, IdxT>(metric, data, dim, 200, 42);
+    index.lists()[3].reset();
+    index.recompute_internal_state();
+
+    ivf_host_test::temp_file file;
+    ivf_flat::serialize_host(res, file.path(), index, spec.num_threads);
+    auto loaded = ivf_flat::deserialize_host<T, IdxT>(res, file.path(), load_params());
+    expect_equal_indexes(index, loaded);
+    expect_equal_search(res, index, loaded, queries, kQueries, dim);
+  }
+
+  template <typename T>
+  void run_pq(uint32_t dim, uint32_t pq_bits, uint32_t pq_dim, ivf_pq::codebook_gen kind)
+  {
+    auto data    = ivf_host_test::make_data<T>(kRows, dim, 42);
+    auto queries = ivf_host_test::make_data<T>(kQueries, dim, 7);
+    auto index   = ivf_host_test::make_pq_index<T, IdxT>(
+      raft::distance::DistanceType::L2Expanded, kind, data, dim, 200, pq_bits, pq_dim, 42);
+    index.lists()[3].reset();
+    index.recompute_internal_state();
+
+    ivf_host_test::temp_file file;
+    ivf_pq::serialize_host(res, file.path(), index, spec.num_threads);
+    auto loaded = ivf_pq::deserialize_host<IdxT>(res, file.path(), load_params());
+    expect_equal_indexes(index, loaded);
+    expect_equal_search(res, index, loaded, queries, kQueries, dim);
+  }
+};
+
+using raft::distance::DistanceType;
+
+TEST_P(IvfHostSerializeTest, FlatFloat) { run_flat<float>(32, DistanceType::L2Expanded); }
+TEST_P(IvfHostSerializeTest, FlatInt8) { run_flat<int8_t>(17, DistanceType::InnerProduct); }
+TEST_P(IvfHostSerializeTest, PqSubspace)
+{
+  run_pq<float>(32, 4, 32, ivf_pq::codebook_gen::PER_SUBSPACE);
+}
+TEST_P(IvfHostSerializeTest, PqCluster)
+{
+  run_pq<uint8_t>(24, 6, 12, ivf_pq::codebook_gen::PER_CLUSTER);
+}
+
+INSTANTIATE_TEST_CASE_P(IvfHostSerializeTest,
+                        IvfHostSerializeTest,
+                        ::testing::Values(test_spec_ivf_host_serialize{1, false},
+                                          test_spec_ivf_host_serialize{4, false},
+                                          test_spec_ivf_host_serialize{0, true}));
+
+class IvfHostContainerTest : public testing::Test {
+ protected:
+  using IdxT                      = int64_t;
+  static constexpr uint32_t kDim  = 16;
+  static constexpr uint32_t kRows = 1000;
+  raft::resources res;
+  std::vector<float> data = ivf_host_test::make_data<float>(kRows, kDim, 42);
+  ivf_flat::host_index<float, IdxT> flat_index = ivf_host_test::make_flat_index<float, IdxT>(
+    raft::distance::DistanceType::L2Expanded, data, kDim, 20, 42);
+  ivf_pq::host_index<IdxT> pq_index =
+    ivf_host_test::make_pq_index<float, IdxT>(raft::distance::DistanceType::InnerProduct,
+                                              ivf_pq::codebook_gen::PER_SUBSPACE,
+                                              data,
+                                              kDim,
+                                              20,
+                                              8,
+                                              8,
+                                              42);
+
+  auto load_flat(const std::string& filename) -> ivf_flat::host_index<float, IdxT>
+  {
+    return ivf_flat::deserialize_host<float, IdxT>(res, filename);
+  }
+};
+
+TEST_F(IvfHostContainerTest, LegacyStream)
+{
+  ivf_host_test::temp_file flat_file;
+  serialize_legacy(res, flat_file.path(), flat_index);
+  ASSERT_FALSE(detail::is_container(flat_file.path()));
+  expect_equal_indexes(flat_index, load_flat(flat_file.path()));
+  // A stream can't be mapped
+  container_load_params mmap_params{true, 0};
+  EXPECT_THROW((ivf_flat::deserialize_host<float, IdxT>(res, flat_file.path(), mmap_params)),
+               raft::exception);
+  // The data type is checked
+  EXPECT_THROW((ivf_flat::deserialize_host<uint8_t, IdxT>(res, flat_file.path())),
+               raft::exception);
+
+  ivf_host_test::temp_file pq_file;
+  serialize_legacy(res, pq_file.path(), pq_index);
+  expect_equal_indexes(pq_index, ivf_pq::deserialize_host<IdxT>(res, pq_file.path()));
+}
+
+TEST_F(IvfHostContainerTest, MappedListsCopyOnWrite)
+{
+  ivf_host_test::temp_file file;
+  ivf_flat::serialize_host(res, file.path(), flat_index);
+  container_load_params mmap_params{true, 0};
+  {
+    auto mapped = ivf_flat::deserialize_host<float, IdxT>(res, file.path(), mmap_params);
+    for (auto& list : mapped.lists()) {
+      if (!list.has_value()) { continue; }
+      std::fill(list->data.data_handle(), list->data.data_handle() + list->data.size(), 0.0f);
+      std::fill(list->indices.data_handle(), list->indices.data_handle() + list->size, IdxT{-1});
+    }
+  }
+  expect_equal_indexes(flat_index, load_flat(file.path()));
+}
+
+TEST_F(IvfHostContainerTest, UnknownSectionsAndKeys)
+{
+  // A newer writer may add sections and parameters; the readers skip them
+  std::map<uint32_t, std::vector<uint8_t>> unknown{{1000, {1, 2, 3, 4, 5}}, {1001, {}}};
+  ivf_host_test::temp_file flat_file, flat_rewritten;
+  ivf_flat::serialize_host(res, flat_file.path(), flat_index);
+  rewrite_container(flat_file.path(), flat_rewritten.path(), {}, std::nullopt, unknown);
+  expect_equal_indexes(flat_index, load_flat(flat_rewritten.path()));
+
+  ivf_host_test::temp_file pq_file, pq_rewritten;
+  ivf_pq::serialize_host(res, pq_file.path(), pq_index);
+  rewrite_container(pq_file.path(), pq_rewritten.path(), {}, std::nullopt, unknown);
+  expect_equal_indexes(pq_index, ivf_pq::deserialize_host<IdxT>(res, pq_rewritten.path()));
+}
+
+TEST_F(IvfHostContainerTest, MissingOptionalKeys)
+{
+  ivf_host_test::temp_file file, rewritten;
+  ivf_flat::serialize_host(res, file.path(), flat_index);
+
+  // The parameters are read: override them with the values not used by the index
+  rewrite_container(file.path(),
+                    rewritten.path(),
+                    {},
+                    std::nullopt,
+                    {{uint32_t(container_param::kAdaptiveCenters), {1}},
+                     {uint32_t(container_param::kConservativeMemoryAllocation), {1}}});
+  auto overridden = load_flat(rewritten.path());
+  ASSERT_TRUE(overridden.adaptive_centers());
+  ASSERT_TRUE(overridden.conservative_memory_allocation());
+
+  // An older writer may miss the optional parameters and the center norms: the defaults
+  rewrite_container(file.path(),
+                    rewritten.path(),
+                    {container_param::kAdaptiveCenters,
+                     container_param::kConservativeMemoryAllocation},
+                    container_section::kCenterNorms,
+                    {});
+  auto loaded = load_flat(rewritten.path());
+  ASSERT_FALSE(loaded.adaptive_centers());
+  ASSERT_FALSE(loaded.conservative_memory_allocation());
+  ASSERT_TRUE(loaded.center_norms().has_value());
+  for (uint32_t label = 0; label < loaded.n_lists(); label++) {
+    ASSERT_NEAR((*loaded.center_norms())(label), (*flat_index.center_norms())(label), 1e-4)
+      << "list " << label;
+  }
+
+  // The required parameters and sections can't be missing, nor have an unexpected size
+  rewrite_container(file.path(), rewritten.path(), {container_param::kDim}, std::nullopt, {});
+  EXPECT_THROW(load_flat(rewritten.path()), raft::exception);
+  rewrite_container(file.path(), rewritten.path(), {}, container_section::kCenters, {});
+  EXPECT_THROW(load_flat(rewritten.path()), raft::exception);
+  rewrite_container(file.path(),
+                    rewritten.path(),
+                    {},
+                    std::nullopt,
+                    {{uint32_t(container_param::kDim), {16, 0, 0, 0, 0, 0, 0, 0}}});
+  EXPECT_THROW(load_flat(rewritten.path()), raft::exception);
+  // An IVF-Flat container isn't an IVF-PQ index
+  EXPECT_THROW(ivf_pq::deserialize_host<IdxT>(res, file.path()), raft::exception);
+}
+
+TEST_F(IvfHostContainerTest, CorruptedFiles)
+{
+  ivf_host_test::temp_file file;
+  ivf_flat::serialize_host(res, file.path(), flat_index);
+  const auto valid = file.read();
+  ASSERT_TRUE(detail::is_container(file.path()));
+  expect_equal_indexes(flat_index, load_flat(file.path()));
+
+  const auto n_open_files = count_open_files();
+  auto expect_rejected    = [&](const std::vector<uint8_t>& bytes, const char* what) {
+    file.write(bytes);
+    EXPECT_THROW(load_flat(file.path()), raft::exception) << what;
+    container_load_params mmap_params{true, 0};
+    EXPECT_THROW((ivf_flat::deserialize_host<float, IdxT>(res, file.path(), mmap_params)),
+                 raft::exception)
+      << what;
+  };
+  using header_t = detail::container_header;
+  using toc_t    = detail::container_toc_entry;
+  using list_t   = detail::container_list_entry;
+
+  // The header
+  expect_rejected({valid.begin(), valid.begin() + sizeof(header_t) - 1}, "truncated header");
+  {
+    auto bytes = valid;
+    patch(bytes, offsetof(header_t, version), detail::kContainerVersion + 1);
+    expect_rejected(bytes, "newer version");
+  }
+  {
+    auto bytes = valid;
+    patch(bytes, offsetof(header_t, toc_entry_size), uint32_t(sizeof(toc_t) - 8));
+    expect_rejected(bytes, "small TOC entries");
+  }
+  {
+    auto bytes = valid;
+    patch(bytes, offsetof(header_t, n_sections), uint32_t(1) << 30);
+    expect_rejected(bytes, "TOC out of the file");
+  }
+  {
+    auto bytes = valid;
+    patch(bytes, offsetof(header_t, toc_offset), std::numeric_limits<uint64_t>::max() - 8);
+    expect_rejected(bytes, "TOC offset overflow");
+  }
+
+  // The table of contents
+  header_t header;
+  std::memcpy(&header, valid.data(), sizeof(header));
+  auto toc_entry_offset = [&](container_section id) -> uint64_t {
+    for (uint32_t i = 0; i < header.n_sections; i++) {
+      uint64_t offset = header.toc_offset + uint64_t(i) * header.toc_entry_size;
+      toc_t entry;
+      std::memcpy(&entry, valid.data() + offset, sizeof(entry));
+      if (entry.id == static_cast<uint32_t>(id)) { return offset; }
+    }
+    return 0;
+  };
+  {
+    auto bytes = valid;
+    patch(bytes,
+          toc_entry_offset(container_section::kCenters) + offsetof(toc_t, offset),
+          uint64_t(valid.size()));
+    expect_rejected(bytes, "section out of the file");
+  }
+  {
+    auto bytes = valid;
+    patch(bytes,
+          toc_entry_offset(container_section::kCenters) + offsetof(toc_t, size),
+          std::numeric_limits<uint64_t>::max() - 8);
+    expect_rejected(bytes, "section size overflow");
+  }
+  {
+    auto bytes = valid;
+    patch(bytes,
+          toc_entry_offset(container_section::kCenters) + offsetof(toc_t, size),
+          find_section(valid, container_section::kCenters).size - 4);
+    expect_rejected(bytes, "section size");
+  }
+  {
+    auto bytes = valid;
+    patch(bytes, toc_entry_offset(container_section::kListDirectory) + offsetof(toc_t, id), 999u);
+    expect_rejected(bytes, "missing list directory");
+  }
+  {
+    auto bytes  = valid;
+    auto params = find_section(valid, container_section::kParams);
+    patch(bytes, params.offset + sizeof(uint32_t), uint32_t(1) << 20);
+    expect_rejected(bytes, "truncated params");
+  }
+
+  // The list directory
+  auto directory      = find_section(valid, container_section::kListDirectory);
+  auto list_entry_at  = [&](uint32_t label) {
+    return directory.offset + 2 * sizeof(uint32_t) + uint64_t(label) * sizeof(list_t);
+  };
+  uint32_t full_label = 0;
+  while (flat_index.list_sizes()(full_label) == 0) {
+    full_label++;
+  }
+  {
+    auto bytes = valid;
+    patch(bytes, directory.offset, flat_index.n_lists() + 1000);
+    expect_rejected(bytes, "too many lists");
+  }
+  {
+    auto bytes = valid;
+    patch(bytes, directory.offset, flat_index.n_lists() - 1);
+    expect_rejected(bytes, "too few lists");
+  }
+  {
+    auto bytes = valid;
+    patch(bytes, directory.offset + sizeof(uint32_t), uint32_t(sizeof(list_t) - 8));
+    expect_rejected(bytes, "small list entries");
+  }
+  {
+    auto bytes = valid;
+    patch(bytes,
+          list_entry_at(full_label) + offsetof(list_t, data_offset),
+          std::numeric_limits<uint64_t>::max() - 8);
+    expect_rejected(bytes, "list offset overflow");
+  }
+  {
+    auto bytes = valid;
+    list_t entry;
+    std::memcpy(&entry, valid.data() + list_entry_at(full_label), sizeof(entry));
+    patch(bytes, list_entry_at(full_label) + offsetof(list_t, data_size), entry.data_size - 4);
+    expect_rejected(bytes, "list data size");
+  }
+  {
+    auto bytes = valid;
+    patch(bytes, list_entry_at(full_label) + offsetof(list_t, size), uint32_t(kRows + 1));
+    expect_rejected(bytes, "list size");
+  }
+  {
+    auto lists = find_section(valid, container_section::kListData);
+    expect_rejected({valid.begin(), valid.begin() + lists.offset + 1}, "truncated lists");
+  }
+
+  // The failed readers close their files
+  if (n_open_files > 0) { ASSERT_EQ(count_open_files(), n_open_files); }
+
+  // Not a container: read as a stream
+  {
+    auto bytes = valid;
+    bytes[0]   = 'X';
+    expect_rejected(bytes, "bad magic");
+  }
+}
+
+}  // namespace raft::neighbors::ivf
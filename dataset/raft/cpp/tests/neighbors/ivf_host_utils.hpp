@@ -0,0 +1,577 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <raft/distance/distance_types.hpp>
+#include <raft/neighbors/detail/ivf_flat_host_search.hpp>
+#include <raft/neighbors/detail/ivf_host_common.hpp>
+#include <raft/neighbors/detail/ivf_pq_host_search.hpp>
+#include <raft/neighbors/ivf_flat_host_types.hpp>
+#include <raft/neighbors/ivf_pq_host_types.hpp>
+
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/*
+ * Helpers of the host IVF tests: indexes built on the host without the device k-means, the brute
+ * force search of the probed lists the host searches are compared with, and the temporary files of
+ * the saved indexes.
+ */
+namespace raft::neighbors::ivf_host_test {
+
+/** A file in the temporary directory, removed with the object. */
+class temp_file {
+ public:
+  temp_file()
+  {
+    static std::atomic<int> counter{0};
+    path_ = (std::filesystem::temp_directory_path() /
+             ("raft_ivf_host_" + std::to_string(::getpid()) + "_" + std::to_string(counter++)))
+              .string();
+  }
+  temp_file(const temp_file&)                    = delete;
+  auto operator=(const temp_file&) -> temp_file& = delete;
+  ~temp_file() { std::remove(path_.c_str()); }
+
+  [[nodiscard]] auto path() const -> const std::string& { return path_; }
+
+  [[nodiscard]] auto read() const -> std::vector<uint8_t>
+  {
+    std::ifstream is(path_, std::ios::binary);
+    return std::vector<uint8_t>(std::istreambuf_iterator<char>(is), {});
+  }
+  void write(const std::vector<uint8_t>& bytes) const
+  {
+    std::ofstream os(path_, std::ios::binary | std::ios::trunc);
+    os.write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+  }
+
+ private:
+  std::string path_;
+};
+
+/** Random data: normal floats, or integers covering the whole range of the type. */
+template <typename T>
+auto make_data(size_t n_rows, uint32_t dim, uint64_t seed) -> std::vector<T>
+{
+  std::mt19937_64 rng(seed);
+  std::vector<T> data(n_rows * dim);
+  if constexpr (std::is_same_v<T, float>) {
+    std::normal_distribution<float> dist;
+    for (auto& x : data) {
+      x = dist(rng);
+    }
+  } else {
+    std::uniform_int_distribution<int> dist(std::numeric_limits<T>::min(),
+                                            std::numeric_limits<T>::max());
+    for (auto& x : data) {
+      x = static_cast<T>(dist(rng));
+    }
+  }
+  return data;
+}
+
+/** The exact distance of two records, as the searches of `metric` return it. */
+template <typename T>
+auto exact_distance(raft::distance::DistanceType metric, const T* x, const T* y, uint32_t dim)
+  -> double
+{
+  double acc = 0;
+  for (uint32_t j = 0; j < dim; j++) {
+    if (metric == raft::distance::DistanceType::InnerProduct) {
+      acc += double(x[j]) * double(y[j]);
+    } else {
+      acc += (double(x[j]) - double(y[j])) * (double(x[j]) - double(y[j]));
+    }
+  }
+  return metric == raft::distance::DistanceType::L2SqrtExpanded ? std::sqrt(acc) : acc;
+}
+
+/** Whether the smaller distances of `metric` are the better ones. */
+inline auto smaller_is_better(raft::distance::DistanceType metric) -> bool
+{
+  return metric != raft::distance::DistanceType::InnerProduct;
+}
+
+/**
+ * The labels of the `n_probes` clusters closest to `query` among `centers` [n_lists, dim], in the
+ * scaled space of the centers (see `ivf_flat::detail::host_center_scale`).
+ */
+template <typename T>
+auto probe_clusters(raft::distance::DistanceType metric,
+                    const float* centers,
+                    uint32_t n_lists,
+                    uint32_t dim,
+                    const T* query,
+                    uint32_t n_probes) -> std::vector<uint32_t>
+{
+  const float scale = ivf_flat::detail::host_center_scale<T>();
+  std::vector<std::pair<double, uint32_t>> scores(n_lists);
+  for (uint32_t label = 0; label < n_lists; label++) {
+    double score = 0;
+    for (uint32_t j = 0; j < dim; j++) {
+      double q = double(query[j]) * scale;
+      double c = centers[size_t(label) * dim + j];
+      score += metric == raft::distance::DistanceType::InnerProduct ? -q * c : (q - c) * (q - c);
+    }
+    scores[label] = {score, label};
+  }
+  std::sort(scores.begin(), scores.end());
+  std::vector<uint32_t> labels(std::min(n_probes, n_lists));
+  for (size_t i = 0; i < labels.size(); i++) {
+    labels[i] = scores[i].second;
+  }
+  return labels;
+}
+
+/**
+ * Brute force search of the records of the probed lists: for every query, the `k` best of the
+ * records `list_members(label)` of its `n_probes` closest clusters that pass `filter(query_ix,
+ * source_ix)`, padded with `kHostOutOfBoundsRecord` and the dummy distance of the metric.
+ */
+template <typename T, typename IdxT, typename ListMembersT, typename FilterT>
+void naive_ivf_search(raft::distance::DistanceType metric,
+                      const std::vector<T>& data,
+                      uint32_t dim,
+                      const float* centers,
+                      uint32_t n_lists,
+                      ListMembersT list_members,
+                      const T* queries,
+                      uint32_t n_queries,
+                      uint32_t k,
+                      uint32_t n_probes,
+                      FilterT filter,
+                      std::vector<IdxT>& neighbors,
+                      std::vector<float>& distances)
+{
+  const bool ascending = smaller_is_better(metric);
+  neighbors.assign(size_t(n_queries) * k, ivf::detail::kHostOutOfBoundsRecord<IdxT>);
+  distances.assign(size_t(n_queries) * k,
+                   ascending ? std::numeric_limits<float>::max()
+                             : std::numeric_limits<float>::lowest());
+  std::vector<std::pair<double, IdxT>> candidates;
+  for (uint32_t query_ix = 0; query_ix < n_queries; query_ix++) {
+    const T* query = queries + size_t(query_ix) * dim;
+    candidates.clear();
+    for (auto label : probe_clusters(metric, centers, n_lists, dim, query, n_probes)) {
+      for (IdxT id : list_members(label)) {
+        if (!filter(query_ix, id)) { continue; }
+        double d = exact_distance(metric, query, data.data() + size_t(id) * dim, dim);
+        candidates.emplace_back(ascending ? d : -d, id);
+      }
+    }
+    size_t n_found = std::min<size_t>(k, candidates.size());
+    std::partial_sort(candidates.begin(), candidates.begin() + n_found, candidates.end());
+    for (size_t j = 0; j < n_found; j++) {
+      neighbors[size_t(query_ix) * k + j] = candidates[j].second;
+      distances[size_t(query_ix) * k + j] =
+        static_cast<float>(ascending ? candidates[j].first : -candidates[j].first);
+    }
+  }
+}
+
+/** Brute force search of the whole dataset, padded as `naive_ivf_search`. */
+template <typename T, typename IdxT>
+void naive_knn(raft::distance::DistanceType metric,
+               const std::vector<T>& data,
+               uint32_t dim,
+               const T* queries,
+               uint32_t n_queries,
+               uint32_t k,
+               std::vector<IdxT>& neighbors,
+               std::vector<float>& distances)
+{
+  // All the records in one list of a single center
+  std::vector<IdxT> all_ids(data.size() / dim);
+  std::iota(all_ids.begin(), all_ids.end(), IdxT{0});
+  std::vector<float> center(dim, 0.0f);
+  naive_ivf_search(
+    metric,
+    data,
+    dim,
+    center.data(),
+    1,
+    [&all_ids](uint32_t) { return all_ids; },
+    queries,
+    n_queries,
+    k,
+    1,
+    [](uint32_t, IdxT) { return true; },
+    neighbors,
+    distances);
+}
+
+/**
+ * Check the results of a search against the brute force search: the distances must match position
+ * by position, and a neighbor may differ from the expected one only at equal distances, in which
+ * case its exact distance to the query must still be the reported one.
+ */
+template <typename T, typename IdxT>
+void expect_same_neighbors(raft::distance::DistanceType metric,
+                           const std::vector<T>& data,
+                           uint32_t dim,
+                           const T* queries,
+                           uint32_t n_queries,
+                           uint32_t k,
+                           const std::vector<IdxT>& expected_neighbors,
+                           const std::vector<float>& expected_distances,
+                           const std::vector<IdxT>& neighbors,
+                           const std::vector<float>& distances,
+                           double tolerance)
+{
+  constexpr IdxT kMissing = ivf::detail::kHostOutOfBoundsRecord<IdxT>;
+  for (uint32_t query_ix = 0; query_ix < n_queries; query_ix++) {
+    for (uint32_t j = 0; j < k; j++) {
+      size_t ix         = size_t(query_ix) * k + j;
+      IdxT expected     = expected_neighbors[ix];
+      IdxT actual       = neighbors[ix];
+      double expected_d = expected_distances[ix];
+      double eps        = tolerance * std::max(1.0, std::abs(expected_d));
+      if (expected == kMissing) {
+        ASSERT_EQ(actual, kMissing) << "query " << query_ix << ", position " << j;
+        ASSERT_EQ(distances[ix], expected_distances[ix]) << "query " << query_ix;
+        continue;
+      }
+      ASSERT_NE(actual, kMissing) << "query " << query_ix << ", position " << j;
+      ASSERT_NEAR(distances[ix], expected_d, eps) << "query " << query_ix << ", position " << j;
+      if (actual != expected) {
+        double d = exact_distance(
+          metric, queries + size_t(query_ix) * dim, data.data() + size_t(actual) * dim, dim);
+        ASSERT_NEAR(d, expected_d, eps) << "query " << query_ix << ", position " << j;
+      }
+    }
+    std::vector<IdxT> row(neighbors.begin() + size_t(query_ix) * k,
+                          neighbors.begin() + size_t(query_ix + 1) * k);
+    row.erase(std::remove(row.begin(), row.end(), kMissing), row.end());
+    std::sort(row.begin(), row.end());
+    ASSERT_TRUE(std::adjacent_find(row.begin(), row.end()) == row.end())
+      << "query " << query_ix << " has duplicate neighbors";
+  }
+}
+
+/**
+ * Build an IVF-Flat index in host memory: the centers are `n_lists` records of the data, and every
+ * record goes to the list of its closest center. The lists are written in the interleaved layout
+ * of the device index.
+ */
+template <typename T, typename IdxT>
+auto make_flat_index(raft::distance::DistanceType metric,
+                     const std::vector<T>& data,
+                     uint32_t dim,
+                     uint32_t n_lists,
+                     uint64_t seed) -> ivf_flat::host_index<T, IdxT>
+{
+  const size_t n_rows = data.size() / dim;
+  const float scale   = ivf_flat::detail::host_center_scale<T>();
+  ivf_flat::host_index<T, IdxT> index(metric, n_lists, false, false, dim);
+
+  std::vector<size_t> perm(n_rows);
+  std::iota(perm.begin(), perm.end(), 0);
+  std::shuffle(perm.begin(), perm.end(), std::mt19937_64(seed));
+  auto centers = index.centers().data_handle();
+  for (uint32_t label = 0; label < n_lists; label++) {
+    for (uint32_t j = 0; j < dim; j++) {
+      centers[size_t(label) * dim + j] = float(data[perm[label % n_rows] * dim + j]) * scale;
+    }
+  }
+  index.allocate_center_norms();
+  if (index.center_norms().has_value()) {
+    for (uint32_t label = 0; label < n_lists; label++) {
+      float norm = 0;
+      for (uint32_t j = 0; j < dim; j++) {
+        norm += centers[size_t(label) * dim + j] * centers[size_t(label) * dim + j];
+      }
+      (*index.center_norms())(label) = norm;
+    }
+  }
+
+  std::vector<std::vector<IdxT>> members(n_lists);
+  for (size_t i = 0; i < n_rows; i++) {
+    auto label = probe_clusters(raft::distance::DistanceType::L2Expanded,
+                                centers,
+                                n_lists,
+                                dim,
+                                data.data() + i * dim,
+                                1)[0];
+    members[label].push_back(IdxT(i));
+  }
+
+  constexpr uint32_t kGroupSize = ivf_flat::kIndexGroupSize;
+  const uint32_t veclen         = index.veclen();
+  for (uint32_t label = 0; label < n_lists; label++) {
+    if (members[label].empty()) { continue; }
+    auto& list = index.lists()[label].emplace(dim, uint32_t(members[label].size()));
+    std::fill(list.data.data_handle(), list.data.data_handle() + list.data.size(), T{0});
+    for (uint32_t row = 0; row < list.size; row++) {
+      const T* record = data.data() + size_t(members[label][row]) * dim;
+      T* group        = list.data.data_handle() + size_t(row / kGroupSize) * kGroupSize * dim;
+      for (uint32_t j = 0; j < dim; j++) {
+        group[(j / veclen) * kGroupSize * veclen + (row % kGroupSize) * veclen + j % veclen] =
+          record[j];
+      }
+      list.indices(row) = members[label][row];
+    }
+  }
+  index.recompute_internal_state();
+  return index;
+}
+
+/** The source indices of the records of a list of a host index. */
+template <typename IndexT>
+auto list_members(const IndexT& index, uint32_t label)
+{
+  auto ids = index.inds_ptrs()(label);
+  return std::vector<std::remove_const_t<std::remove_pointer_t<decltype(ids)>>>(
+    ids, ids + index.list_sizes()(label));
+}
+
+/**
+ * Build an IVF-PQ index in host memory: the centers are `n_lists` records of the data, the
+ * rotation is the identity padded with zeros, and the PQ centers are residuals of random records.
+ * Every record goes to the list of its closest center, encoded with its closest PQ centers in the
+ * interleaved layout of the device index (see `ivf_pq::list_spec`).
+ */
+template <typename T, typename IdxT>
+auto make_pq_index(raft::distance::DistanceType metric,
+                   ivf_pq::codebook_gen codebook_kind,
+                   const std::vector<T>& data,
+                   uint32_t dim,
+                   uint32_t n_lists,
+                   uint32_t pq_bits,
+                   uint32_t pq_dim,
+                   uint64_t seed) -> ivf_pq::host_index<IdxT>
+{
+  const size_t n_rows = data.size() / dim;
+  const float scale   = ivf_pq::detail::host_query_scale<T>();
+  ivf_pq::host_index<IdxT> index(metric, codebook_kind, n_lists, dim, pq_bits, pq_dim, false);
+  const uint32_t dim_ext   = index.dim_ext();
+  const uint32_t rot_dim   = index.rot_dim();
+  const uint32_t pq_len    = index.pq_len();
+  const uint32_t book_size = index.pq_book_size();
+  const bool per_cluster   = codebook_kind == ivf_pq::codebook_gen::PER_CLUSTER;
+  std::mt19937_64 rng(seed);
+
+  auto rotation = index.rotation_matrix().data_handle();
+  std::fill(rotation, rotation + size_t(rot_dim) * dim, 0.0f);
+  for (uint32_t j = 0; j < dim; j++) {
+    rotation[size_t(j) * dim + j] = 1.0f;
+  }
+
+  std::vector<size_t> perm(n_rows);
+  std::iota(perm.begin(), perm.end(), 0);
+  std::shuffle(perm.begin(), perm.end(), rng);
+  auto centers     = index.centers().data_handle();
+  auto centers_rot = index.centers_rot().data_handle();
+  std::fill(centers, centers + size_t(n_lists) * dim_ext, 0.0f);
+  std::fill(centers_rot, centers_rot + size_t(n_lists) * rot_dim, 0.0f);
+  for (uint32_t label = 0; label < n_lists; label++) {
+    float* center = centers + size_t(label) * dim_ext;
+    for (uint32_t j = 0; j < dim; j++) {
+      center[j] = float(data[perm[label % n_rows] * dim + j]) * scale;
+      center[dim] += center[j] * center[j];
+      centers_rot[size_t(label) * rot_dim + j] = center[j];
+    }
+  }
+
+  // The labels and the residuals in the rotated space
+  std::vector<uint32_t> labels(n_rows);
+  std::vector<float> residuals(n_rows * rot_dim, 0.0f);
+  for (size_t i = 0; i < n_rows; i++) {
+    double best = std::numeric_limits<double>::max();
+    for (uint32_t label = 0; label < n_lists; label++) {
+      double d = 0;
+      for (uint32_t j = 0; j < dim; j++) {
+        double diff = double(data[i * dim + j]) * scale - centers[size_t(label) * dim_ext + j];
+        d += diff * diff;
+      }
+      if (d < best) {
+        best      = d;
+        labels[i] = label;
+      }
+    }
+    for (uint32_t j = 0; j < dim; j++) {
+      residuals[i * rot_dim + j] =
+        float(data[i * dim + j]) * scale - centers_rot[size_t(labels[i]) * rot_dim + j];
+    }
+  }
+
+  auto pq_centers        = index.pq_centers().data_handle();
+  const uint32_t n_books = per_cluster ? n_lists : pq_dim;
+  std::uniform_int_distribution<size_t> pick(0, n_rows - 1);
+  for (uint32_t book = 0; book < n_books; book++) {
+    for (uint32_t code = 0; code < book_size; code++) {
+      // A PER_CLUSTER codebook serves all the subspaces; take its entries from any of them
+      const float* residual = residuals.data() + pick(rng) * rot_dim +
+                              size_t(per_cluster ? code % pq_dim : book) * pq_len;
+      for (uint32_t l = 0; l < pq_len; l++) {
+        pq_centers[(size_t(book) * pq_len + l) * book_size + code] = residual[l];
+      }
+    }
+  }
+
+  std::vector<std::vector<size_t>> members(n_lists);
+  for (size_t i = 0; i < n_rows; i++) {
+    members[labels[i]].push_back(i);
+  }
+  const uint32_t chunk_size = ivf_pq::detail::host_chunk_size(pq_bits);
+  ivf_pq::list_spec<uint32_t, IdxT> spec(pq_bits, pq_dim, false);
+  for (uint32_t label = 0; label < n_lists; label++) {
+    if (members[label].empty()) { continue; }
+    auto& list = index.lists()[label].emplace(spec, uint32_t(members[label].size()));
+    std::fill(list.data.data_handle(), list.data.data_handle() + list.data.size(), uint8_t{0});
+    for (uint32_t row = 0; row < list.size; row++) {
+      const float* residual = residuals.data() + members[label][row] * rot_dim;
+      for (uint32_t j = 0; j < pq_dim; j++) {
+        const float* book = pq_centers + size_t(per_cluster ? label : j) * pq_len * book_size;
+        uint32_t code = 0;
+        double best   = std::numeric_limits<double>::max();
+        for (uint32_t c = 0; c < book_size; c++) {
+          double d = 0;
+          for (uint32_t l = 0; l < pq_len; l++) {
+            double diff = residual[j * pq_len + l] - book[l * book_size + c];
+            d += diff * diff;
+          }
+          if (d < best) {
+            best = d;
+            code = c;
+          }
+        }
+        // The chunks are little-endian bit streams of `chunk_size` codes
+        uint8_t* chunk = &list.data(row / ivf_pq::kIndexGroupSize,
+                                    j / chunk_size,
+                                    row % ivf_pq::kIndexGroupSize,
+                                    0);
+        uint32_t bit_offset = (j % chunk_size) * pq_bits;
+        uint32_t bits       = code << (bit_offset % 8);
+        chunk[bit_offset / 8] |= uint8_t(bits);
+        if ((bit_offset % 8) + pq_bits > 8) { chunk[bit_offset / 8 + 1] |= uint8_t(bits >> 8); }
+      }
+      list.indices(row) = IdxT(members[label][row]);
+    }
+  }
+  index.recompute_internal_state();
+  return index;
+}
+
+/** The PQ code of the subspace `j` of the record `row` of a list of a host IVF-PQ index. */
+template <typename IdxT>
+auto pq_code(const ivf_pq::host_list_data<IdxT>& list, uint32_t pq_bits, uint32_t row, uint32_t j)
+  -> uint32_t
+{
+  const uint32_t chunk_size = ivf_pq::detail::host_chunk_size(pq_bits);
+  const uint8_t* chunk =
+    &list.data(row / ivf_pq::kIndexGroupSize, j / chunk_size, row % ivf_pq::kIndexGroupSize, 0);
+  uint32_t bit_offset = (j % chunk_size) * pq_bits;
+  uint32_t bits       = chunk[bit_offset / 8];
+  if (bit_offset / 8 + 1 < ivf_pq::kIndexGroupVecLen) {
+    bits |= uint32_t(chunk[bit_offset / 8 + 1]) << 8;
+  }
+  return (bits >> (bit_offset % 8)) & ((1u << pq_bits) - 1u);
+}
+
+/**
+ * Search an IVF-PQ index gathering the entries of the float look up tables for every record of
+ * the probed lists, in the order of the subspaces. The clusters, the rotated queries and the
+ * tables come from the host search (`host_select_clusters`, `host_compute_lut`), so that the
+ * distances are the ones the host search must return bit for bit, whatever its scan method.
+ *
+ * Besides the top-k, returns the distances of all the candidates of every query.
+ */
+template <typename T, typename IdxT, typename FilterT>
+void naive_pq_search(const ivf_pq::host_index<IdxT>& index,
+                     const T* queries,
+                     uint32_t n_queries,
+                     uint32_t k,
+                     uint32_t n_probes,
+                     FilterT filter,
+                     std::vector<IdxT>& neighbors,
+                     std::vector<float>& distances,
+                     std::vector<std::unordered_map<IdxT, float>>& candidate_distances)
+{
+  const auto metric        = index.metric();
+  const bool inner_product = metric == raft::distance::DistanceType::InnerProduct;
+  const bool take_sqrt     = metric == raft::distance::DistanceType::L2SqrtExpanded;
+  const float scale        = 1.0f / ivf_pq::detail::host_query_scale<T>();
+  n_probes                 = std::min(n_probes, index.n_lists());
+
+  std::vector<uint32_t> probes(size_t(n_queries) * n_probes);
+  std::vector<float> rot_queries(size_t(n_queries) * index.rot_dim());
+#pragma omp parallel num_threads(1)
+  ivf_pq::detail::host_select_clusters(
+    index, queries, n_queries, n_probes, probes.data(), rot_queries.data());
+
+  neighbors.assign(size_t(n_queries) * k, ivf::detail::kHostOutOfBoundsRecord<IdxT>);
+  distances.assign(size_t(n_queries) * k,
+                   inner_product ? std::numeric_limits<float>::lowest()
+                                 : std::numeric_limits<float>::max());
+  candidate_distances.assign(n_queries, {});
+  std::vector<float> lut(size_t(index.pq_dim()) * index.pq_book_size());
+  std::vector<std::pair<float, IdxT>> candidates;
+  for (uint32_t query_ix = 0; query_ix < n_queries; query_ix++) {
+    candidates.clear();
+    for (uint32_t p = 0; p < n_probes; p++) {
+      uint32_t label = probes[size_t(query_ix) * n_probes + p];
+      if (!index.lists()[label].has_value()) { continue; }
+      const auto& list = *index.lists()[label];
+      ivf_pq::detail::host_compute_lut(index,
+                                       rot_queries.data() + size_t(query_ix) * index.rot_dim(),
+                                       label,
+                                       inner_product,
+                                       lut.data());
+      for (uint32_t row = 0; row < list.size; row++) {
+        IdxT id = list.indices(row);
+        if (!filter(query_ix, id)) { continue; }
+        float score = 0;
+        for (uint32_t j = 0; j < index.pq_dim(); j++) {
+          score += lut[j * index.pq_book_size() + pq_code(list, index.pq_bits(), row, j)];
+        }
+        candidates.emplace_back(score, id);
+        float distance = inner_product ? -score * scale * scale
+                         : take_sqrt   ? std::sqrt(score) * scale
+                                       : score * scale * scale;
+        candidate_distances[query_ix][id] = distance;
+      }
+    }
+    size_t n_found = std::min<size_t>(k, candidates.size());
+    std::partial_sort(candidates.begin(), candidates.begin() + n_found, candidates.end());
+    for (size_t j = 0; j < n_found; j++) {
+      neighbors[size_t(query_ix) * k + j] = candidates[j].second;
+      distances[size_t(query_ix) * k + j] =
+        candidate_distances[query_ix][candidates[j].second];
+    }
+  }
+}
+
+}  // namespace raft::neighbors::ivf_host_test
@@ -0,0 +1,346 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ivf_host_utils.hpp"
+
+#include <raft/core/host_mdspan.hpp>
+#include <raft/core/resources.hpp>
+#include <raft/neighbors/ivf_pq_host.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace raft::neighbors::ivf_pq {
+
+struct test_spec_ivf_pq_host {
+  uint32_t n_rows;
+  uint32_t n_queries;
+  uint32_t dim;
+  uint32_t n_lists;
+  uint32_t n_probes;
+  uint32_t k;
+  uint32_t pq_bits;
+  uint32_t pq_dim;
+  codebook_gen codebook_kind;
+  uint32_t max_queries;
+  int num_threads;
+  raft::distance::DistanceType metric;
+  bool filtered;
+  uint32_t refine_ratio = 0;
+};
+
+auto operator<<(std::ostream& os, const test_spec_ivf_pq_host& ss) -> std::ostream&
+{
+  os << "ivf_pq_host{n_rows: " << ss.n_rows << ", n_queries: " << ss.n_queries
+     << ", dim: " << ss.dim << ", n_lists: " << ss.n_lists << ", n_probes: " << ss.n_probes
+     << ", k: " << ss.k << ", pq_bits: " << ss.pq_bits << ", pq_dim: " << ss.pq_dim
+     << ", codebook_kind: " << int(ss.codebook_kind) << ", max_queries: " << ss.max_queries
+     << ", num_threads: " << ss.num_threads << ", metric: " << int(ss.metric)
+     << ", filtered: " << ss.filtered << ", refine_ratio: " << ss.refine_ratio << "}";
+  return os;
+}
+
+/** Drops a third of the samples, a different third for every query. */
+struct query_dependent_filter {
+  inline bool operator()(const uint32_t query_ix, const int64_t sample_ix) const
+  {
+    return (sample_ix + query_ix) % 3 != 0;
+  }
+};
+
+template <typename T>
+class IvfPqHostTest : public testing::TestWithParam<test_spec_ivf_pq_host> {
+ protected:
+  using IdxT = int64_t;
+  const test_spec_ivf_pq_host spec;
+  raft::resources res;
+  std::vector<T> data;
+  std::vector<T> queries;
+  std::optional<host_index<IdxT>> index;
+
+ public:
+  IvfPqHostTest() : spec(testing::TestWithParam<test_spec_ivf_pq_host>::GetParam()) {}
+
+  void SetUp() override
+  {
+    data    = ivf_host_test::make_data<T>(spec.n_rows, spec.dim, 42);
+    queries = ivf_host_test::make_data<T>(spec.n_queries, spec.dim, 7);
+    index.emplace(ivf_host_test::make_pq_index<T, IdxT>(spec.metric,
+                                                         spec.codebook_kind,
+                                                         data,
+                                                         spec.dim,
+                                                         spec.n_lists,
+                                                         spec.pq_bits,
+                                                         spec.pq_dim,
+                                                         42));
+  }
+
+  auto search_params() const -> host_search_params
+  {
+    host_search_params params;
+    params.n_probes    = spec.n_probes;
+    params.num_threads = spec.num_threads;
+    params.max_queries = spec.max_queries;
+    return params;
+  }
+
+  template <typename FilterT>
+  void search(uint32_t k,
+              FilterT filter,
+              std::vector<IdxT>& neighbors,
+              std::vector<float>& distances)
+  {
+    neighbors.resize(size_t(spec.n_queries) * k);
+    distances.resize(size_t(spec.n_queries) * k);
+    search_with_filtering(
+      res,
+      search_params(),
+      *index,
+      raft::make_host_matrix_view<const T, IdxT>(queries.data(), spec.n_queries, spec.dim),
+      raft::make_host_matrix_view<IdxT, IdxT>(neighbors.data(), spec.n_queries, k),
+      raft::make_host_matrix_view<float, IdxT>(distances.data(), spec.n_queries, k),
+      filter);
+  }
+
+  /**
+   * The search must return the same distances as gathering the float look up table entries, in
+   * particular with the fast scan of `pq_bits = 4`.
+   */
+  template <typename FilterT>
+  void search_and_compare(FilterT filter)
+  {
+    std::vector<IdxT> expected_neighbors;
+    std::vector<float> expected_distances;
+    std::vector<std::unordered_map<IdxT, float>> candidate_distances;
+    ivf_host_test::naive_pq_search(*index,
+                                   queries.data(),
+                                   spec.n_queries,
+                                   spec.k,
+                                   spec.n_probes,
+                                   filter,
+                                   expected_neighbors,
+                                   expected_distances,
+                                   candidate_distances);
+    std::vector<IdxT> neighbors;
+    std::vector<float> distances;
+    search(spec.k, filter, neighbors, distances);
+
+    constexpr IdxT kMissing = ivf::detail::kHostOutOfBoundsRecord<IdxT>;
+    for (uint32_t query_ix = 0; query_ix < spec.n_queries; query_ix++) {
+      for (uint32_t j = 0; j < spec.k; j++) {
+        size_t ix = size_t(query_ix) * spec.k + j;
+        ASSERT_EQ(distances[ix], expected_distances[ix]) << "query " << query_ix << ", pos " << j;
+        if (expected_neighbors[ix] == kMissing) {
+          ASSERT_EQ(neighbors[ix], kMissing) << "query " << query_ix << ", pos " << j;
+          continue;
+        }
+        // Equal distances may come in any order
+        auto candidate = candidate_distances[query_ix].find(neighbors[ix]);
+        ASSERT_TRUE(candidate != candidate_distances[query_ix].end())
+          << "query " << query_ix << ", pos " << j << ": " << neighbors[ix] << " not a candidate";
+        ASSERT_EQ(candidate->second, distances[ix]) << "query " << query_ix << ", pos " << j;
+      }
+      std::vector<IdxT> row(neighbors.begin() + size_t(query_ix) * spec.k,
+                            neighbors.begin() + size_t(query_ix + 1) * spec.k);
+      row.erase(std::remove(row.begin(), row.end(), kMissing), row.end());
+      std::sort(row.begin(), row.end());
+      ASSERT_TRUE(std::adjacent_find(row.begin(), row.end()) == row.end())
+        << "query " << query_ix << " has duplicate neighbors";
+    }
+  }
+
+  void run()
+  {
+    ASSERT_EQ(index->size(), IdxT(spec.n_rows));
+    if (spec.filtered) {
+      search_and_compare(query_dependent_filter{});
+    } else {
+      search_and_compare([](uint32_t, IdxT) { return true; });
+    }
+  }
+
+  /**
+   * The refined search must return the exact top-k of the candidates of the search; with all the
+   * lists probed and at least as many candidates as records, this is the exact search.
+   */
+  void run_refinement()
+  {
+    const uint32_t n_candidates = spec.k * spec.refine_ratio;
+    std::vector<IdxT> candidates;
+    std::vector<float> candidate_distances;
+    search(n_candidates, [](uint32_t, IdxT) { return true; }, candidates, candidate_distances);
+
+    std::vector<IdxT> neighbors(size_t(spec.n_queries) * spec.k);
+    std::vector<float> distances(size_t(spec.n_queries) * spec.k);
+    search_with_refinement(
+      res,
+      search_params(),
+      *index,
+      raft::make_host_matrix_view<const T, IdxT>(data.data(), spec.n_rows, spec.dim),
+      raft::make_host_matrix_view<const T, IdxT>(queries.data(), spec.n_queries, spec.dim),
+      raft::make_host_matrix_view<IdxT, IdxT>(neighbors.data(), spec.n_queries, spec.k),
+      raft::make_host_matrix_view<float, IdxT>(distances.data(), spec.n_queries, spec.k),
+      spec.refine_ratio);
+
+    std::vector<IdxT> expected_neighbors;
+    std::vector<float> expected_distances;
+    if (spec.n_probes >= spec.n_lists && n_candidates >= spec.n_rows) {
+      ivf_host_test::naive_knn(spec.metric,
+                               data,
+                               spec.dim,
+                               queries.data(),
+                               spec.n_queries,
+                               spec.k,
+                               expected_neighbors,
+                               expected_distances);
+    } else {
+      // Brute force search of the candidates of every query, as a list of its own
+      std::vector<float> center(spec.dim, 0.0f);
+      expected_neighbors.resize(size_t(spec.n_queries) * spec.k);
+      expected_distances.resize(size_t(spec.n_queries) * spec.k);
+      for (uint32_t query_ix = 0; query_ix < spec.n_queries; query_ix++) {
+        std::vector<IdxT> members;
+        for (uint32_t j = 0; j < n_candidates; j++) {
+          IdxT id = candidates[size_t(query_ix) * n_candidates + j];
+          if (id != ivf::detail::kHostOutOfBoundsRecord<IdxT>) { members.push_back(id); }
+        }
+        std::vector<IdxT> query_neighbors;
+        std::vector<float> query_distances;
+        ivf_host_test::naive_ivf_search(
+          spec.metric,
+          data,
+          spec.dim,
+          center.data(),
+          1,
+          [&members](uint32_t) { return members; },
+          queries.data() + size_t(query_ix) * spec.dim,
+          1,
+          spec.k,
+          1,
+          [](uint32_t, IdxT) { return true; },
+          query_neighbors,
+          query_distances);
+        std::copy(query_neighbors.begin(),
+                  query_neighbors.end(),
+                  expected_neighbors.begin() + size_t(query_ix) * spec.k);
+        std::copy(query_distances.begin(),
+                  query_distances.end(),
+                  expected_distances.begin() + size_t(query_ix) * spec.k);
+      }
+    }
+
+    double tolerance = std::is_same_v<T, float> ? 1e-4 : 1e-6;
+    ivf_host_test::expect_same_neighbors(spec.metric,
+                                         data,
+                                         spec.dim,
+                                         queries.data(),
+                                         spec.n_queries,
+                                         spec.k,
+                                         expected_neighbors,
+                                         expected_distances,
+                                         neighbors,
+                                         distances,
+                                         tolerance);
+  }
+};
+
+using raft::distance::DistanceType;
+constexpr auto kSubspace = codebook_gen::PER_SUBSPACE;
+constexpr auto kCluster  = codebook_gen::PER_CLUSTER;
+
+// The chunk of 16 bytes holds 32 codes of 4 bits, 25 of 5, 21 of 6, 18 of 7 and 16 of 8 bits;
+// pq_dim is chosen below, equal to and above one chunk, not necessarily a multiple of it
+auto inputs_ivf_pq_host = ::testing::Values(
+  // The fast scan
+  test_spec_ivf_pq_host{2000, 100, 32, 40, 5, 10, 4, 16, kSubspace, 0, 0, DistanceType::L2Expanded},
+  test_spec_ivf_pq_host{2000, 100, 32, 40, 5, 10, 4, 32, kSubspace, 0, 3, DistanceType::L2Expanded},
+  test_spec_ivf_pq_host{
+    2000, 100, 40, 40, 5, 10, 4, 40, kSubspace, 0, 3, DistanceType::L2SqrtExpanded},
+  test_spec_ivf_pq_host{
+    2000, 100, 64, 40, 5, 10, 4, 64, kCluster, 0, 0, DistanceType::InnerProduct},
+  test_spec_ivf_pq_host{2000, 100, 17, 40, 5, 10, 4, 20, kCluster, 0, 0, DistanceType::L2Expanded},
+  test_spec_ivf_pq_host{
+    2000, 100, 33, 40, 5, 10, 4, 34, kSubspace, 0, 0, DistanceType::InnerProduct},
+  // The gathers
+  test_spec_ivf_pq_host{2000, 100, 32, 40, 5, 10, 5, 16, kSubspace, 0, 0, DistanceType::L2Expanded},
+  test_spec_ivf_pq_host{
+    2000, 100, 40, 40, 5, 10, 5, 40, kCluster, 0, 3, DistanceType::InnerProduct},
+  test_spec_ivf_pq_host{
+    2000, 100, 24, 40, 5, 10, 6, 12, kSubspace, 0, 0, DistanceType::L2SqrtExpanded},
+  test_spec_ivf_pq_host{2000, 100, 28, 40, 5, 10, 6, 28, kCluster, 0, 3, DistanceType::L2Expanded},
+  test_spec_ivf_pq_host{
+    2000, 100, 24, 40, 5, 10, 7, 24, kSubspace, 0, 0, DistanceType::InnerProduct},
+  test_spec_ivf_pq_host{2000, 100, 40, 40, 5, 10, 7, 40, kCluster, 0, 0, DistanceType::L2Expanded},
+  test_spec_ivf_pq_host{2000, 100, 20, 40, 5, 10, 8, 20, kSubspace, 0, 3, DistanceType::L2Expanded},
+  test_spec_ivf_pq_host{
+    2000, 100, 36, 40, 5, 10, 8, 36, kCluster, 0, 0, DistanceType::L2SqrtExpanded},
+  // Probing all the lists, and more than all of them
+  test_spec_ivf_pq_host{1000, 50, 32, 20, 20, 16, 4, 32, kSubspace, 0, 0, DistanceType::L2Expanded},
+  test_spec_ivf_pq_host{
+    1000, 50, 32, 20, 64, 16, 8, 16, kSubspace, 0, 0, DistanceType::InnerProduct},
+  // Fewer records in the probed lists than k: the results are padded
+  test_spec_ivf_pq_host{500, 50, 32, 50, 1, 64, 4, 32, kSubspace, 0, 0, DistanceType::L2Expanded},
+  test_spec_ivf_pq_host{500, 50, 32, 50, 2, 64, 6, 16, kSubspace, 0, 3, DistanceType::InnerProduct},
+  // Filters and several batches of queries
+  test_spec_ivf_pq_host{
+    2000, 100, 32, 40, 8, 20, 4, 32, kSubspace, 7, 3, DistanceType::L2Expanded, true},
+  test_spec_ivf_pq_host{
+    2000, 100, 32, 40, 8, 20, 5, 16, kSubspace, 0, 3, DistanceType::InnerProduct, true},
+  test_spec_ivf_pq_host{
+    2000, 100, 32, 40, 40, 10, 4, 16, kSubspace, 1, 2, DistanceType::L2SqrtExpanded});
+
+using IvfPqHostF = IvfPqHostTest<float>;
+TEST_P(IvfPqHostF, Run) { run(); }
+INSTANTIATE_TEST_CASE_P(IvfPqHostTest, IvfPqHostF, inputs_ivf_pq_host);
+
+using IvfPqHostI8 = IvfPqHostTest<int8_t>;
+TEST_P(IvfPqHostI8, Run) { run(); }
+INSTANTIATE_TEST_CASE_P(IvfPqHostTest, IvfPqHostI8, inputs_ivf_pq_host);
+
+using IvfPqHostU8 = IvfPqHostTest<uint8_t>;
+TEST_P(IvfPqHostU8, Run) { run(); }
+INSTANTIATE_TEST_CASE_P(IvfPqHostTest, IvfPqHostU8, inputs_ivf_pq_host);
+
+auto inputs_ivf_pq_host_refinement = ::testing::Values(
+  // All the records are candidates: the exact search
+  test_spec_ivf_pq_host{
+    500, 50, 32, 10, 10, 10, 4, 16, kSubspace, 0, 0, DistanceType::L2Expanded, false, 50},
+  test_spec_ivf_pq_host{
+    500, 50, 32, 10, 10, 10, 8, 16, kSubspace, 0, 3, DistanceType::L2SqrtExpanded, false, 50},
+  test_spec_ivf_pq_host{
+    500, 50, 32, 10, 10, 10, 5, 16, kCluster, 0, 0, DistanceType::InnerProduct, false, 50},
+  // Re-ranking the candidates of a partial search, some of them missing
+  test_spec_ivf_pq_host{
+    2000, 100, 32, 40, 5, 10, 4, 32, kSubspace, 0, 3, DistanceType::L2Expanded, false, 4},
+  test_spec_ivf_pq_host{
+    2000, 100, 32, 40, 5, 10, 6, 16, kSubspace, 7, 0, DistanceType::InnerProduct, false, 3},
+  test_spec_ivf_pq_host{
+    500, 50, 32, 50, 1, 16, 4, 16, kSubspace, 0, 0, DistanceType::L2SqrtExpanded, false, 4});
+
+using IvfPqHostRefineF = IvfPqHostTest<float>;
+TEST_P(IvfPqHostRefineF, Run) { run_refinement(); }
+INSTANTIATE_TEST_CASE_P(IvfPqHostTest, IvfPqHostRefineF, inputs_ivf_pq_host_refinement);
+
+using IvfPqHostRefineU8 = IvfPqHostTest<uint8_t>;
+TEST_P(IvfPqHostRefineU8, Run) { run_refinement(); }
+INSTANTIATE_TEST_CASE_P(IvfPqHostTest, IvfPqHostRefineU8, inputs_ivf_pq_host_refinement);
+
+}  // namespace raft::neighbors::ivf_pq
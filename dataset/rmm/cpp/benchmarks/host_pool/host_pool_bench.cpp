@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <rmm/mr/host/host_memory_resource.hpp>
+#include <rmm/mr/host/new_delete_resource.hpp>
+#include <rmm/mr/host/numa_pool_memory_resource.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+
+namespace {
+
+constexpr std::size_t page_size{4096};
+
+using MRFactoryFunc = std::function<std::shared_ptr<rmm::mr::host_memory_resource>()>;
+
+inline auto make_new_delete() { return std::make_shared<rmm::mr::new_delete_resource>(); }
+
+inline auto make_numa_pool()
+{
+  return std::make_shared<rmm::mr::numa_pool_memory_resource>(rmm::mr::huge_page_mode::none);
+}
+
+inline auto make_numa_pool_thp()
+{
+  return std::make_shared<rmm::mr::numa_pool_memory_resource>(
+    rmm::mr::huge_page_mode::transparent);
+}
+
+inline auto make_numa_pool_hugetlb()
+{
+  return std::make_shared<rmm::mr::numa_pool_memory_resource>(
+    rmm::mr::huge_page_mode::explicit_huge_tlb);
+}
+
+inline auto make_numa_pool_prefault()
+{
+  return std::make_shared<rmm::mr::numa_pool_memory_resource>(
+    rmm::mr::huge_page_mode::transparent, true);
+}
+
+// Touch one byte of every page, which is what the first write into a staging buffer costs
+void touch_pages(void* ptr, std::size_t bytes)
+{
+  auto* bytes_ptr = static_cast<volatile char*>(ptr);
+  for (std::size_t offset = 0; offset < bytes; offset += page_size) {
+    bytes_ptr[offset] = 1;  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  }
+}
+
+}  // namespace
+
+// Latency of allocating a buffer and touching each of its pages once, as a staging buffer would be
+// on its first use. Pool resources pay the page faults once; `operator new` pays them on every
+// allocation that is large enough to be served by `mmap`.
+static void BM_AllocateFirstTouch(benchmark::State& state, MRFactoryFunc const& factory)
+{
+  auto mr          = factory();
+  auto const bytes = static_cast<std::size_t>(state.range(0));
+
+  for (auto _ : state) {  // NOLINT(clang-analyzer-deadcode.DeadStores)
+    void* ptr = mr->allocate(bytes);
+    touch_pages(ptr, bytes);
+    mr->deallocate(ptr, bytes);
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * bytes));
+}
+
+// Steady-state bandwidth of copying between two buffers owned by each thread. With more than one
+// thread on a multi-socket host this exposes remote-node placement.
+static void BM_CopyBandwidth(benchmark::State& state, MRFactoryFunc const& factory)
+{
+  auto mr          = factory();
+  auto const bytes = static_cast<std::size_t>(state.range(0));
+  void* src        = mr->allocate(bytes);
+  void* dst        = mr->allocate(bytes);
+  std::memset(src, 1, bytes);
+  std::memset(dst, 0, bytes);
+
+  for (auto _ : state) {  // NOLINT(clang-analyzer-deadcode.DeadStores)
+    std::memcpy(dst, src, bytes);
+    benchmark::DoNotOptimize(dst);
+    benchmark::ClobberMemory();
+  }
+
+  mr->deallocate(src, bytes);
+  mr->deallocate(dst, bytes);
+
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * bytes * 2));
+}
+
+static void first_touch_range(benchmark::internal::Benchmark* bench)
+{
+  bench->RangeMultiplier(4)->Range(64 << 10, 256 << 20)->Unit(benchmark::kMicrosecond);
+}
+
+static void bandwidth_range(benchmark::internal::Benchmark* bench)
+{
+  bench->Arg(64 << 20)->ThreadRange(1, 8)->UseRealTime()->Unit(benchmark::kMillisecond);
+}
+
+// NOLINTBEGIN
+BENCHMARK_CAPTURE(BM_AllocateFirstTouch, new_delete, &make_new_delete)->Apply(first_touch_range);
+BENCHMARK_CAPTURE(BM_AllocateFirstTouch, numa_pool, &make_numa_pool)->Apply(first_touch_range);
+BENCHMARK_CAPTURE(BM_AllocateFirstTouch, numa_pool_thp, &make_numa_pool_thp)
+  ->Apply(first_touch_range);
+BENCHMARK_CAPTURE(BM_AllocateFirstTouch, numa_pool_hugetlb, &make_numa_pool_hugetlb)
+  ->Apply(first_touch_range);
+BENCHMARK_CAPTURE(BM_AllocateFirstTouch, numa_pool_prefault, &make_numa_pool_prefault)
+  ->Apply(first_touch_range);
+
+BENCHMARK_CAPTURE(BM_CopyBandwidth, new_delete, &make_new_delete)->Apply(bandwidth_range);
+BENCHMARK_CAPTURE(BM_CopyBandwidth, numa_pool, &make_numa_pool)->Apply(bandwidth_range);
+BENCHMARK_CAPTURE(BM_CopyBandwidth, numa_pool_thp, &make_numa_pool_thp)->Apply(bandwidth_range);
+// NOLINTEND
+
+BENCHMARK_MAIN();
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2024, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2025, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -22,9 +22,11 @@
 #include <rmm/mr/device/device_memory_resource.hpp>
 #include <rmm/mr/device/owning_wrapper.hpp>
 #include <rmm/mr/device/pool_memory_resource.hpp>
+#include <rmm/mr/device/size_class_memory_resource.hpp>
 
 #include <benchmark/benchmark.h>
 #include <benchmarks/utilities/cxxopts.hpp>
+#include <benchmarks/utilities/simulated_memory_resource.hpp>
 
 #include <array>
 #include <cstddef>
@@ -148,6 +150,17 @@ void uniform_random_allocations(
   random_allocation_free(mr, size_distribution, num_allocations, max_usage, stream);
 }
 
+void uniform_small_random_allocations(
+  rmm::mr::device_memory_resource& mr,
+  std::size_t num_allocations,      // NOLINT(bugprone-easily-swappable-parameters)
+  std::size_t max_allocation_size,  // size in bytes
+  std::size_t max_usage,
+  rmm::cuda_stream_view stream = {})
+{
+  std::uniform_int_distribution<std::size_t> size_distribution(1, max_allocation_size);
+  random_allocation_free(mr, size_distribution, num_allocations, max_usage, stream);
+}
+
 // TODO figure out how to map a normal distribution to integers between 1 and max_allocation_size
 /*void normal_random_allocations(rmm::mr::device_memory_resource& mr,
                                 std::size_t num_allocations = 1000,
@@ -188,6 +201,39 @@ inline auto make_binning()
   return mr;
 }
 
+inline auto make_size_class()
+{
+  auto pool = make_pool();
+  // Add a size_class_memory_resource with the same bins as make_binning
+  constexpr auto min_bin_pow2{18};
+  constexpr auto max_bin_pow2{22};
+  return rmm::mr::make_owning_wrapper<rmm::mr::size_class_memory_resource>(
+    pool, min_bin_pow2, max_bin_pow2);
+}
+
+// Factories for the small allocation benchmark. The bins draw from a simulated upstream so that
+// only the cost of dispatching to and managing the bins is measured.
+constexpr std::size_t simulated_size{16UL << 30};
+constexpr auto min_small_bin_pow2{8};   // 256B
+constexpr auto max_small_bin_pow2{16};  // 64KiB
+
+inline auto make_simulated()
+{
+  return std::make_shared<rmm::mr::simulated_memory_resource>(simulated_size);
+}
+
+inline auto make_simulated_binning()
+{
+  return rmm::mr::make_owning_wrapper<rmm::mr::binning_memory_resource>(
+    make_simulated(), min_small_bin_pow2, max_small_bin_pow2);
+}
+
+inline auto make_simulated_size_class()
+{
+  return rmm::mr::make_owning_wrapper<rmm::mr::size_class_memory_resource>(
+    make_simulated(), min_small_bin_pow2, max_small_bin_pow2);
+}
+
 using MRFactoryFunc = std::function<std::shared_ptr<rmm::mr::device_memory_resource>()>;
 
 constexpr std::size_t max_usage = 16000;
@@ -208,6 +254,25 @@ static void BM_RandomAllocations(benchmark::State& state, MRFactoryFunc const& f
   }
 }
 
+static void BM_SmallRandomAllocations(benchmark::State& state, MRFactoryFunc const& factory)
+{
+  auto mr = factory();
+
+  std::size_t num_allocations = state.range(0);
+  std::size_t max_size        = state.range(1);
+
+  try {
+    for (auto _ : state) {  // NOLINT(clang-analyzer-deadcode.DeadStores)
+      uniform_small_random_allocations(*mr, num_allocations, max_size, max_usage);
+    }
+  } catch (std::exception const& e) {
+    std::cout << "Error: " << e.what() << "\n";
+  }
+
+  // each allocation is also freed
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * num_allocations * 2));
+}
+
 static void num_range(benchmark::internal::Benchmark* bench, int size)
 {
   for (int num_allocations : std::vector<int>{1000, 10000, 100000}) {
@@ -249,6 +314,26 @@ void benchmark_range(benchmark::internal::Benchmark* bench)
   }
 }
 
+static void small_size_range(benchmark::internal::Benchmark* bench, int num)
+{
+  for (int max_size : std::vector<int>{256, 1024, 4096, 65536}) {  // in bytes
+    bench->Args({num, max_size})->Unit(benchmark::kMicrosecond);
+  }
+}
+
+void small_benchmark_range(benchmark::internal::Benchmark* bench)
+{
+  if (num_allocations > 0 && max_size > 0) {
+    bench->Args({num_allocations, max_size})->Unit(benchmark::kMicrosecond);
+  } else if (num_allocations > 0) {
+    small_size_range(bench, num_allocations);
+  } else {
+    for (int num : std::vector<int>{1000, 10000, 100000}) {
+      small_size_range(bench, num);
+    }
+  }
+}
+
 void declare_benchmark(std::string const& name)
 {
   if (name == "cuda") {
@@ -261,6 +346,21 @@ void declare_benchmark(std::string const& name)
   } else if (name == "binning") {
     BENCHMARK_CAPTURE(BM_RandomAllocations, binning_mr, &make_binning)  // NOLINT
       ->Apply(benchmark_range);
+  } else if (name == "size_class") {
+    BENCHMARK_CAPTURE(BM_RandomAllocations, size_class_mr, &make_size_class)  // NOLINT
+      ->Apply(benchmark_range);
+  } else if (name == "binning_small") {
+    BENCHMARK_CAPTURE(  // NOLINT
+      BM_SmallRandomAllocations,
+      simulated_binning_mr,
+      &make_simulated_binning)
+      ->Apply(small_benchmark_range);
+  } else if (name == "size_class_small") {
+    BENCHMARK_CAPTURE(  // NOLINT
+      BM_SmallRandomAllocations,
+      simulated_size_class_mr,
+      &make_simulated_size_class)
+      ->Apply(small_benchmark_range);
   } else if (name == "pool") {
     BENCHMARK_CAPTURE(BM_RandomAllocations, pool_mr, &make_pool)  // NOLINT
       ->Apply(benchmark_range);
@@ -274,12 +374,17 @@ void declare_benchmark(std::string const& name)
 
 static void profile_random_allocations(MRFactoryFunc const& factory,
                                        std::size_t num_allocations,
-                                       std::size_t max_size)
+                                       std::size_t max_size,
+                                       bool small)
 {
   auto mr = factory();
 
   try {
-    uniform_random_allocations(*mr, num_allocations, max_size, max_usage);
+    if (small) {
+      uniform_small_random_allocations(*mr, num_allocations, max_size, max_usage);
+    } else {
+      uniform_random_allocations(*mr, num_allocations, max_size, max_usage);
+    }
   } catch (std::exception const& e) {
     std::cout << "Error: " << e.what() << "\n";
   }
@@ -305,7 +410,8 @@ int main(int argc, char** argv)
                           "Number of allocations (default of 0 tests a range)",
                           cxxopts::value<int>()->default_value("1000"));
     options.add_options()("m,maxsize",
-                          "Maximum allocation size (default of 0 tests a range)",
+                          "Maximum allocation size in MiB, or in bytes for the *_small resources "
+                          "(default of 0 tests a range)",
                           cxxopts::value<int>()->default_value("4096"));
 
     auto args       = options.parse(argc, argv);
@@ -315,15 +421,20 @@ int main(int argc, char** argv)
     if (args.count("profile") > 0) {
       std::map<std::string, MRFactoryFunc> const funcs({{"arena", &make_arena},
                                                         {"binning", &make_binning},
+                                                        {"binning_small", &make_simulated_binning},
                                                         {"cuda", &make_cuda},
                                                         {"cuda_async", &make_cuda_async},
-                                                        {"pool", &make_pool}});
-      auto resource = args["resource"].as<std::string>();
+                                                        {"pool", &make_pool},
+                                                        {"size_class", &make_size_class},
+                                                        {"size_class_small",
+                                                         &make_simulated_size_class}});
+      auto resource    = args["resource"].as<std::string>();
+      auto const small = resource.size() > 6 && resource.substr(resource.size() - 6) == "_small";
 
       std::cout << "Profiling " << resource << " with " << num_allocations << " allocations of max "
-                << max_size << "B\n";
+                << max_size << (small ? "B\n" : "MiB\n");
 
-      profile_random_allocations(funcs.at(resource), num_allocations, max_size);
+      profile_random_allocations(funcs.at(resource), num_allocations, max_size, small);
 
       std::cout << "Finished\n";
     } else {
@@ -338,7 +449,14 @@ int main(int argc, char** argv)
         std::string mr_name = args["resource"].as<std::string>();
         declare_benchmark(mr_name);
       } else {
-        std::vector<std::string> mrs{"pool", "binning", "arena", "cuda_async", "cuda"};
+        std::vector<std::string> mrs{"pool",
+                                     "binning",
+                                     "size_class",
+                                     "binning_small",
+                                     "size_class_small",
+                                     "arena",
+                                     "cuda_async",
+                                     "cuda"};
         std::for_each(
           std::cbegin(mrs), std::cend(mrs), [](auto const& mr) { declare_benchmark(mr); });
       }
@@ -31,20 +31,28 @@
 #include <thrust/reduce.h>
 
 #include <benchmark/benchmark.h>
+#include <benchmarks/utilities/address_space_tracker.hpp>
 #include <benchmarks/utilities/cxxopts.hpp>
 #include <benchmarks/utilities/log_parser.hpp>
 #include <benchmarks/utilities/simulated_memory_resource.hpp>
 
+#include <algorithm>
 #include <atomic>
 #include <barrier>
 #include <chrono>
 #include <condition_variable>
 #include <cstddef>
+#include <fstream>
+#include <iomanip>
 #include <iterator>
+#include <map>
 #include <memory>
 #include <numeric>
+#include <optional>
+#include <sstream>
 #include <string>
 #include <thread>
+#include <unordered_map>
 
 /// MR factory functions
 std::shared_ptr<rmm::mr::device_memory_resource> make_cuda(std::size_t = 0)
@@ -80,6 +88,29 @@ inline auto make_arena(std::size_t simulated_size)
   return rmm::mr::make_owning_wrapper<rmm::mr::arena_memory_resource>(make_cuda());
 }
 
+/// Arena that reclaims superblocks at most a quarter allocated from other threads' arenas once
+/// less than 1 / `reclaim_watermark_divisor` of the arena is free
+constexpr std::size_t reclaim_watermark_divisor{8};
+
+inline rmm::mr::arena_reclaim_policy make_reclaim_policy(std::size_t arena_size)
+{
+  rmm::mr::arena_reclaim_policy policy{};
+  policy.low_watermark = arena_size / reclaim_watermark_divisor;
+  return policy;
+}
+
+inline auto make_arena_reclaim(std::size_t simulated_size)
+{
+  if (simulated_size > 0) {
+    return rmm::mr::make_owning_wrapper<rmm::mr::arena_memory_resource>(
+      make_simulated(simulated_size), simulated_size, false, make_reclaim_policy(simulated_size));
+  }
+  // The default arena size is half of the free device memory
+  auto const arena_size = rmm::available_device_memory().first / 2;
+  return rmm::mr::make_owning_wrapper<rmm::mr::arena_memory_resource>(
+    make_cuda(), arena_size, false, make_reclaim_policy(arena_size));
+}
+
 inline auto make_binning(std::size_t simulated_size)
 {
   auto pool = make_pool(simulated_size);
@@ -316,6 +347,402 @@ std::vector<std::vector<rmm::detail::event>> parse_per_thread_events(std::string
   return per_thread_events;
 }
 
+/// Factories for the analysis mode: build a resource limited to `budget` bytes on `upstream`
+using AnalysisFactoryFunc = std::function<std::shared_ptr<rmm::mr::device_memory_resource>(
+  std::shared_ptr<rmm::mr::recording_memory_resource>, std::size_t)>;
+
+inline std::shared_ptr<rmm::mr::device_memory_resource> make_analysis_pool(
+  std::shared_ptr<rmm::mr::recording_memory_resource> upstream, std::size_t budget)
+{
+  // Start empty so that the reserved bytes in the timeline show how the pool grows
+  return rmm::mr::make_owning_wrapper<rmm::mr::pool_memory_resource>(
+    std::move(upstream), 0, rmm::align_down(budget, rmm::CUDA_ALLOCATION_ALIGNMENT));
+}
+
+inline std::shared_ptr<rmm::mr::device_memory_resource> make_analysis_arena(
+  std::shared_ptr<rmm::mr::recording_memory_resource> upstream, std::size_t budget)
+{
+  return rmm::mr::make_owning_wrapper<rmm::mr::arena_memory_resource>(std::move(upstream),
+                                                                       budget);
+}
+
+inline std::shared_ptr<rmm::mr::device_memory_resource> make_analysis_arena_reclaim(
+  std::shared_ptr<rmm::mr::recording_memory_resource> upstream, std::size_t budget)
+{
+  return rmm::mr::make_owning_wrapper<rmm::mr::arena_memory_resource>(
+    std::move(upstream), budget, false, make_reclaim_policy(budget));
+}
+
+inline std::shared_ptr<rmm::mr::device_memory_resource> make_analysis_binning(
+  std::shared_ptr<rmm::mr::recording_memory_resource> upstream, std::size_t budget)
+{
+  auto pool = make_analysis_pool(std::move(upstream), budget);
+  auto mr   = rmm::mr::make_owning_wrapper<rmm::mr::binning_memory_resource>(pool);
+  const auto min_size_exp{18};
+  const auto max_size_exp{22};
+  for (std::size_t i = min_size_exp; i <= max_size_exp; i++) {
+    mr->wrapped().add_bin(1 << i);
+  }
+  return mr;
+}
+
+/**
+ * @brief The outcome of replaying a trace against one resource limited to one budget
+ */
+struct analysis_result {
+  std::size_t budget{};
+  bool survived{true};
+  std::size_t failed_event{};  ///< Index of the allocation that failed, if any
+  std::size_t failed_size{};   ///< Size of the allocation that failed, if any
+  std::string failure{};       ///< Message of the exception thrown by the failed allocation
+  std::size_t peak_reserved_bytes{};
+  double max_external_fragmentation{};
+  std::vector<rmm::mr::fragmentation_sample> timeline{};
+  /// For arena resources, the most free memory held by per-thread and per-stream arenas at once
+  std::size_t peak_arena_free_bytes{};
+  /// For arena resources, the arena statistics at the end of the replay
+  std::optional<rmm::mr::arena_stats> arena_stats{};
+};
+
+using analysis_arena =
+  rmm::mr::owning_wrapper<rmm::mr::arena_memory_resource<rmm::mr::recording_memory_resource>,
+                          rmm::mr::recording_memory_resource>;
+
+/// Returns the free memory held by the per-thread and per-stream arenas
+std::size_t arena_free_bytes(rmm::mr::arena_stats const& stats)
+{
+  std::size_t free{0};
+  for (auto const& usage : stats.thread_arenas) {
+    free += usage.free_bytes;
+  }
+  for (auto const& usage : stats.stream_arenas) {
+    free += usage.free_bytes;
+  }
+  return free;
+}
+
+/**
+ * @brief Returns the largest number of bytes live at once in the trace, which no resource can
+ * serve with less memory.
+ */
+std::size_t peak_live_bytes(std::vector<std::vector<rmm::detail::event>> const& per_thread_events)
+{
+  std::vector<rmm::detail::event> all_events;
+  for (auto const& events : per_thread_events) {
+    all_events.insert(all_events.end(), events.begin(), events.end());
+  }
+  std::sort(all_events.begin(), all_events.end(), [](auto const& lhs, auto const& rhs) {
+    return lhs.index < rhs.index;
+  });
+
+  std::unordered_map<uintptr_t, std::size_t> live;
+  std::size_t current{0};
+  std::size_t peak{0};
+  for (auto const& event : all_events) {
+    if (rmm::detail::action::ALLOCATE == event.act) {
+      auto const size = rmm::align_up(event.size, rmm::CUDA_ALLOCATION_ALIGNMENT);
+      live[event.pointer] = size;
+      current += size;
+      peak = std::max(peak, current);
+    } else if (rmm::detail::action::FREE == event.act) {
+      auto const iter = live.find(event.pointer);
+      if (iter != live.end()) {
+        current -= iter->second;
+        live.erase(iter);
+      }
+    }
+  }
+  return peak;
+}
+
+/**
+ * @brief Replays a trace against a resource limited to `budget` bytes of simulated memory,
+ * recording how the resource uses the memory it reserves.
+ *
+ * Events are replayed with one thread per thread in the log, in the original global order, exactly
+ * as in the benchmark. The replay stops at the first allocation that throws.
+ *
+ * @param factory Factory for the resource under test
+ * @param budget Size of the simulated device memory
+ * @param per_thread_events The trace
+ * @param sample_interval Record a timeline sample every `sample_interval` events; 0 disables the
+ * timeline
+ * @param stream Stream to replay every event on
+ * @return The outcome of the replay
+ */
+analysis_result replay_analysis(
+  AnalysisFactoryFunc const& factory,
+  std::size_t budget,
+  std::vector<std::vector<rmm::detail::event>> const& per_thread_events,
+  std::size_t sample_interval,
+  rmm::cuda_stream_view stream)
+{
+  analysis_result result{budget};
+  rmm::mr::address_space_tracker tracker;
+  analysis_arena const* arena{};
+
+  auto record = [&](std::size_t event_index) {
+    if (arena != nullptr) {
+      result.peak_arena_free_bytes = std::max(result.peak_arena_free_bytes,
+                                              arena_free_bytes(arena->wrapped().get_arena_stats()));
+    }
+    auto const sample          = tracker.sample(event_index);
+    result.peak_reserved_bytes = std::max(result.peak_reserved_bytes, sample.reserved_bytes);
+    result.max_external_fragmentation =
+      std::max(result.max_external_fragmentation, sample.external_fragmentation());
+    if (sample_interval > 0) { result.timeline.push_back(sample); }
+  };
+
+  std::shared_ptr<rmm::mr::device_memory_resource> mr;
+  try {
+    auto upstream =
+      std::make_shared<rmm::mr::recording_memory_resource>(make_simulated(budget), tracker);
+    mr    = factory(std::move(upstream), budget);
+    arena = dynamic_cast<analysis_arena const*>(mr.get());
+  } catch (std::exception const& e) {
+    // e.g. the budget is smaller than the resource's minimum size
+    result.survived = false;
+    result.failure  = e.what();
+    return result;
+  }
+
+  std::unordered_map<uintptr_t, allocation> allocation_map;
+  std::mutex event_mutex;
+  std::condition_variable cv;
+  std::size_t event_index{0};
+  std::size_t num_events{0};
+  for (auto const& events : per_thread_events) {
+    num_events += events.size();
+  }
+
+  auto replay_thread = [&](std::vector<rmm::detail::event> const& events) {
+    for (auto const& event : events) {
+      std::unique_lock<std::mutex> lock{event_mutex};
+      cv.wait(lock, [&]() { return !result.survived || event_index == event.index; });
+      if (!result.survived) { return; }
+
+      if (rmm::detail::action::ALLOCATE == event.act) {
+        try {
+          auto* ptr = mr->allocate(event.size, stream);
+          allocation_map.insert({event.pointer, allocation{ptr, event.size}});
+          tracker.allocate(ptr, event.size);
+        } catch (std::exception const& e) {
+          result.survived     = false;
+          result.failed_event = event.index;
+          result.failed_size  = event.size;
+          result.failure      = e.what();
+          record(event.index);
+          cv.notify_all();
+          return;
+        }
+      } else if (rmm::detail::action::FREE == event.act) {
+        auto const iter = allocation_map.find(event.pointer);
+        if (iter != allocation_map.end()) {
+          tracker.deallocate(iter->second.ptr);
+          mr->deallocate(iter->second.ptr, iter->second.size, stream);
+          allocation_map.erase(iter);
+        }
+      }
+
+      ++event_index;
+      if ((sample_interval > 0 && event_index % sample_interval == 0) ||
+          event_index == num_events) {
+        record(event_index - 1);
+      }
+      cv.notify_all();
+    }
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(per_thread_events.size());
+  for (auto const& events : per_thread_events) {
+    threads.emplace_back(replay_thread, std::cref(events));
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  if (arena != nullptr) { result.arena_stats = arena->wrapped().get_arena_stats(); }
+
+  for (auto const& [ptr, alloc] : allocation_map) {
+    mr->deallocate(alloc.ptr, alloc.size, stream);
+  }
+  return result;
+}
+
+/**
+ * @brief Searches for the smallest budget, to within `granularity` bytes, at which a resource
+ * survives the trace.
+ *
+ * The budget is doubled from `lower` until the resource survives, then bisected. This assumes that
+ * a resource that survives with some budget also survives with any larger one, which holds for
+ * the resources here up to effects of their growth strategies.
+ *
+ * @return The minimum budget, or `std::nullopt` if the resource did not survive with `upper` bytes
+ */
+std::optional<std::size_t> find_minimum_budget(
+  AnalysisFactoryFunc const& factory,
+  std::vector<std::vector<rmm::detail::event>> const& per_thread_events,
+  std::size_t lower,
+  std::size_t upper,
+  std::size_t granularity,
+  rmm::cuda_stream_view stream)
+{
+  auto survives = [&](std::size_t budget) {
+    return replay_analysis(factory, budget, per_thread_events, 0, stream).survived;
+  };
+
+  lower            = rmm::align_up(std::max(lower, granularity), granularity);
+  std::size_t high = lower;
+  while (!survives(high)) {
+    if (high >= upper) { return std::nullopt; }
+    lower = high;
+    high  = std::min(high * 2, upper);
+  }
+  if (high == lower) { return high; }
+
+  // invariant: fails at `lower`, survives at `high`
+  while (high - lower > granularity) {
+    auto const mid = rmm::align_down(lower + (high - lower) / 2, granularity);
+    if (mid <= lower) { break; }
+    if (survives(mid)) {
+      high = mid;
+    } else {
+      lower = mid;
+    }
+  }
+  return high;
+}
+
+std::string json_escape(std::string const& str)
+{
+  std::string escaped;
+  for (char chr : str) {
+    if (chr == '"' || chr == '\\') {
+      escaped += '\\';
+      escaped += chr;
+    } else if (chr == '\n') {
+      escaped += "\\n";
+    } else {
+      escaped += chr;
+    }
+  }
+  return escaped;
+}
+
+/**
+ * @brief Options of the analysis mode
+ */
+struct analysis_options {
+  std::vector<std::string> resources{};
+  std::size_t budget{};       ///< Budget for the timeline; 0 uses each resource's minimum
+  std::size_t granularity{};  ///< Precision of the minimum budget search
+  std::size_t sample_interval{};
+  std::string timeline_file{};
+  std::string summary_file{};
+  /// Stream to replay on. The per-thread default stream gives each thread its own arena.
+  rmm::cuda_stream_view stream{};
+};
+
+/**
+ * @brief Runs the fragmentation / what-if analysis of a trace for each requested resource.
+ *
+ * For each resource: finds the minimum simulated memory size at which it survives the trace, then
+ * replays the trace at the requested budget (or at that minimum) recording a timeline of live
+ * bytes, reserved bytes, largest free block and external fragmentation. Results are printed and
+ * optionally written as a CSV timeline and a JSON summary.
+ */
+void run_analysis(std::vector<std::vector<rmm::detail::event>> const& per_thread_events,
+                  analysis_options const& options)
+{
+  std::map<std::string, AnalysisFactoryFunc> const factories{
+    {"pool", &make_analysis_pool},
+    {"arena", &make_analysis_arena},
+    {"arena_reclaim", &make_analysis_arena_reclaim},
+    {"binning", &make_analysis_binning}};
+
+  auto const peak_live = peak_live_bytes(per_thread_events);
+  // Allow up to 16x the peak live bytes for resources that fragment badly
+  constexpr std::size_t max_overhead_factor{16};
+  auto const upper = std::max(peak_live, options.granularity) * max_overhead_factor;
+
+  std::cout << "Peak live bytes: " << rmm::detail::format_bytes(peak_live) << "\n";
+
+  std::ofstream timeline;
+  if (!options.timeline_file.empty()) {
+    timeline.open(options.timeline_file);
+    timeline << "resource,budget,event,live_bytes,reserved_bytes,free_bytes,largest_free_block,"
+                "external_fragmentation\n";
+  }
+
+  std::ostringstream summary;
+  summary << "{\n  \"peak_live_bytes\": " << peak_live << ",\n  \"resources\": [";
+
+  bool first{true};
+  for (auto const& name : options.resources) {
+    auto const factory = factories.find(name);
+    if (factory == factories.end()) {
+      std::cout << "Error: analysis is not supported for memory_resource " << name << "\n";
+      continue;
+    }
+
+    auto const minimum = find_minimum_budget(
+      factory->second, per_thread_events, peak_live, upper, options.granularity, options.stream);
+    auto const budget = options.budget > 0 ? options.budget : minimum.value_or(upper);
+    auto const result = replay_analysis(
+      factory->second, budget, per_thread_events, options.sample_interval, options.stream);
+
+    auto const minimum_str = minimum ? rmm::detail::format_bytes(*minimum)
+                                     : "> " + rmm::detail::format_bytes(upper);
+    auto const outcome_str =
+      result.survived ? std::string{"survived"}
+                      : "FAILED at event " + std::to_string(result.failed_event);
+    std::cout << std::left << std::setw(14) << name << " minimum budget: " << minimum_str
+              << " | at " << rmm::detail::format_bytes(budget) << ": " << outcome_str
+              << ", peak reserved " << rmm::detail::format_bytes(result.peak_reserved_bytes)
+              << ", max external fragmentation " << result.max_external_fragmentation << "\n";
+    if (result.arena_stats) {
+      std::cout << std::setw(14) << "" << " peak free in per-thread/stream arenas "
+                << rmm::detail::format_bytes(result.peak_arena_free_bytes) << ", "
+                << result.arena_stats->defragmentations << " defragmentations, "
+                << result.arena_stats->reclaim_passes << " reclaim passes ("
+                << rmm::detail::format_bytes(result.arena_stats->reclaimed_bytes)
+                << " reclaimed)\n";
+    }
+
+    if (timeline.is_open()) {
+      for (auto const& sample : result.timeline) {
+        timeline << name << ',' << budget << ',' << sample.event << ',' << sample.live_bytes << ','
+                 << sample.reserved_bytes << ',' << sample.free_bytes() << ','
+                 << sample.largest_free_block << ',' << sample.external_fragmentation() << '\n';
+      }
+    }
+
+    summary << (first ? "" : ",") << "\n    {\"resource\": \"" << name << "\", \"minimum_budget\": "
+            << (minimum ? std::to_string(*minimum) : std::string{"null"})
+            << ", \"budget\": " << budget << ", \"survived\": " << std::boolalpha
+            << result.survived << ", \"peak_reserved_bytes\": " << result.peak_reserved_bytes
+            << ", \"max_external_fragmentation\": " << result.max_external_fragmentation;
+    if (result.arena_stats) {
+      summary << ", \"peak_arena_free_bytes\": " << result.peak_arena_free_bytes
+              << ", \"defragmentations\": " << result.arena_stats->defragmentations
+              << ", \"reclaim_passes\": " << result.arena_stats->reclaim_passes
+              << ", \"reclaimed_bytes\": " << result.arena_stats->reclaimed_bytes;
+    }
+    if (!result.survived) {
+      summary << ", \"failed_event\": " << result.failed_event
+              << ", \"failed_size\": " << result.failed_size << ", \"failure\": \""
+              << json_escape(result.failure) << "\"";
+    }
+    summary << "}";
+    first = false;
+  }
+  summary << "\n  ]\n}\n";
+
+  if (!options.summary_file.empty()) {
+    std::ofstream{options.summary_file} << summary.str();
+  }
+}
+
 void declare_benchmark(std::string const& name,
                        std::size_t simulated_size,
                        std::vector<std::vector<rmm::detail::event>> const& per_thread_events,
@@ -341,6 +768,12 @@ void declare_benchmark(std::string const& name,
                                  replay_benchmark(&make_arena, simulated_size, per_thread_events))
       ->Unit(benchmark::kMillisecond)
       ->Threads(static_cast<int>(num_threads));
+  } else if (name == "arena_reclaim") {
+    benchmark::RegisterBenchmark(
+      "Arena Resource (reclaim)",
+      replay_benchmark(&make_arena_reclaim, simulated_size, per_thread_events))
+      ->Unit(benchmark::kMillisecond)
+      ->Threads(static_cast<int>(num_threads));
   } else if (name == "managed") {
     benchmark::RegisterBenchmark("Managed Resource",
                                  replay_benchmark(&make_managed, simulated_size, per_thread_events))
@@ -352,6 +785,8 @@ void declare_benchmark(std::string const& name,
 }
 
 // Usage: REPLAY_BENCHMARK -f "path/to/log/file"
+//        REPLAY_BENCHMARK -f "path/to/log/file" --analyze [-s GiB] [--timeline t.csv]
+//                         [--summary s.json]
 int main(int argc, char** argv)
 {
   try {
@@ -377,6 +812,27 @@ int main(int argc, char** argv)
       options.add_options()("v,verbose",
                             "Enable verbose printing of log events",
                             cxxopts::value<bool>()->default_value("false"));
+      options.add_options()("a,analyze",
+                            "Instead of benchmarking, replay the log on simulated memory and "
+                            "report fragmentation and the minimum memory size each resource needs.",
+                            cxxopts::value<bool>()->default_value("false"));
+      options.add_options()(
+        "g,granularity",
+        "Analysis: precision in MiB of the search for the minimum simulated memory size.",
+        cxxopts::value<float>()->default_value("1"));
+      options.add_options()("sample-interval",
+                            "Analysis: number of events between timeline samples (default of 0 "
+                            "records about 1000 samples).",
+                            cxxopts::value<std::size_t>()->default_value("0"));
+      options.add_options()("per-thread-stream",
+                            "Analysis: replay each thread on its per-thread default stream, so "
+                            "that the arena resources use one arena per thread.",
+                            cxxopts::value<bool>()->default_value("false"));
+      options.add_options()(
+        "timeline", "Analysis: CSV file to write the timeline to.", cxxopts::value<std::string>());
+      options.add_options()("summary",
+                            "Analysis: JSON file to write the summary to.",
+                            cxxopts::value<std::string>());
 
       auto args = options.parse(argc, argv);
 
@@ -429,6 +885,35 @@ int main(int argc, char** argv)
 
     auto const num_threads = per_thread_events.size();
 
+    if (args["analyze"].as<bool>()) {
+      constexpr std::size_t default_num_samples{1000};
+      analysis_options options{};
+      options.resources = args.count("resource") > 0
+                            ? std::vector<std::string>{args["resource"].as<std::string>()}
+                            : std::vector<std::string>{"pool", "arena", "arena_reclaim", "binning"};
+      options.budget    = simulated_size;
+      options.granularity =
+        rmm::align_up(static_cast<std::size_t>(args["granularity"].as<float>() *
+                                               static_cast<float>(1U << 20U)),
+                      rmm::CUDA_ALLOCATION_ALIGNMENT);
+      auto const num_events = std::accumulate(
+        per_thread_events.begin(),
+        per_thread_events.end(),
+        std::size_t{0},
+        [](std::size_t accum, auto const& events) { return accum + events.size(); });
+      options.sample_interval = args["sample-interval"].as<std::size_t>();
+      if (options.sample_interval == 0) {
+        options.sample_interval = std::max(std::size_t{1}, num_events / default_num_samples);
+      }
+      if (args.count("timeline") > 0) {
+        options.timeline_file = args["timeline"].as<std::string>();
+      }
+      if (args.count("summary") > 0) { options.summary_file = args["summary"].as<std::string>(); }
+      if (args["per-thread-stream"].as<bool>()) { options.stream = rmm::cuda_stream_per_thread; }
+      run_analysis(per_thread_events, options);
+      return 0;
+    }
+
     // Uncomment to enable / change default log level
     // rmm::logger().set_level(rapids_logger::level_enum::trace);
 
@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <rmm/aligned.hpp>
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/mr/device/device_memory_resource.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace rmm::mr {
+
+/**
+ * @brief A point-in-time view of how a memory resource is using the memory it has reserved.
+ */
+struct fragmentation_sample {
+  std::size_t event{};               ///< Index of the last replayed event
+  std::size_t live_bytes{};          ///< Bytes in live allocations
+  std::size_t reserved_bytes{};      ///< Bytes the resource has obtained from its upstream
+  std::size_t largest_free_block{};  ///< Largest contiguous reserved range not in use
+
+  /// Bytes reserved from upstream but not in use
+  [[nodiscard]] std::size_t free_bytes() const { return reserved_bytes - live_bytes; }
+
+  /// `1 - largest_free_block / free_bytes`: 0 when all free memory is one block, approaching 1 as
+  /// it is scattered into many small blocks
+  [[nodiscard]] double external_fragmentation() const
+  {
+    auto const free = free_bytes();
+    if (free == 0) { return 0.0; }
+    return 1.0 - static_cast<double>(largest_free_block) / static_cast<double>(free);
+  }
+};
+
+/**
+ * @brief Tracks the address ranges a memory resource has reserved from its upstream and the
+ * allocations it has handed out within them.
+ *
+ * This is an external, resource-agnostic view: free space is any reserved range not covered by a
+ * live allocation. Ranges reserved by separate upstream allocations are never considered
+ * contiguous, matching the pool resource, which does not coalesce across upstream blocks. For
+ * resources that segregate blocks by size (e.g. `binning_memory_resource`), a free range may only
+ * be usable by some allocation sizes, so `largest_free_block` is an upper bound.
+ *
+ * Live allocation sizes are rounded up to `CUDA_ALLOCATION_ALIGNMENT` as all RMM device resources
+ * do.
+ */
+class address_space_tracker {
+ public:
+  /// Record that `bytes` at `ptr` were obtained from upstream
+  void reserve(void const* ptr, std::size_t bytes)
+  {
+    std::lock_guard<std::mutex> lock(mtx_);
+    reserved_.emplace(address(ptr), bytes);
+    reserved_bytes_ += bytes;
+  }
+
+  /// Record that the upstream range at `ptr` was returned
+  void unreserve(void const* ptr)
+  {
+    std::lock_guard<std::mutex> lock(mtx_);
+    auto const iter = reserved_.find(address(ptr));
+    if (iter == reserved_.end()) { return; }
+    reserved_bytes_ -= iter->second;
+    reserved_.erase(iter);
+  }
+
+  /// Record a live allocation of `bytes` at `ptr`
+  void allocate(void const* ptr, std::size_t bytes)
+  {
+    if (ptr == nullptr) { return; }
+    std::lock_guard<std::mutex> lock(mtx_);
+    auto const size = rmm::align_up(bytes, rmm::CUDA_ALLOCATION_ALIGNMENT);
+    live_.emplace(address(ptr), size);
+    live_bytes_ += size;
+  }
+
+  /// Record that the allocation at `ptr` was freed
+  void deallocate(void const* ptr)
+  {
+    std::lock_guard<std::mutex> lock(mtx_);
+    auto const iter = live_.find(address(ptr));
+    if (iter == live_.end()) { return; }
+    live_bytes_ -= iter->second;
+    live_.erase(iter);
+  }
+
+  [[nodiscard]] std::size_t live_bytes() const
+  {
+    std::lock_guard<std::mutex> lock(mtx_);
+    return live_bytes_;
+  }
+
+  [[nodiscard]] std::size_t reserved_bytes() const
+  {
+    std::lock_guard<std::mutex> lock(mtx_);
+    return reserved_bytes_;
+  }
+
+  /**
+   * @brief Computes the current state of the address space.
+   *
+   * Runs in time linear in the number of live allocations and reserved ranges.
+   *
+   * @param event The event index to tag the sample with
+   * @return The sample
+   */
+  [[nodiscard]] fragmentation_sample sample(std::size_t event) const
+  {
+    std::lock_guard<std::mutex> lock(mtx_);
+    std::size_t largest{0};
+    auto live_iter = live_.begin();
+    for (auto const& [begin, size] : reserved_) {
+      auto const end = begin + size;
+      auto cursor    = begin;
+      while (live_iter != live_.end() && live_iter->first < begin) {
+        ++live_iter;
+      }
+      for (; live_iter != live_.end() && live_iter->first < end; ++live_iter) {
+        if (live_iter->first > cursor) { largest = std::max(largest, live_iter->first - cursor); }
+        cursor = std::max(cursor, live_iter->first + live_iter->second);
+      }
+      if (end > cursor) { largest = std::max(largest, end - cursor); }
+    }
+    return fragmentation_sample{event, live_bytes_, reserved_bytes_, largest};
+  }
+
+ private:
+  static std::uintptr_t address(void const* ptr)
+  {
+    return reinterpret_cast<std::uintptr_t>(ptr);  // NOLINT
+  }
+
+  mutable std::mutex mtx_;
+  std::map<std::uintptr_t, std::size_t> reserved_;
+  std::map<std::uintptr_t, std::size_t> live_;
+  std::size_t reserved_bytes_{};
+  std::size_t live_bytes_{};
+};
+
+/**
+ * @brief A device memory resource that forwards to an upstream and records every upstream
+ * allocation in an `address_space_tracker`.
+ *
+ * Used between a suballocator and a `simulated_memory_resource` to observe how much memory the
+ * suballocator reserves.
+ */
+class recording_memory_resource final : public device_memory_resource {
+ public:
+  /**
+   * @brief Construct a `recording_memory_resource`.
+   *
+   * @param upstream The resource to forward to, which is kept alive by this resource
+   * @param tracker The tracker to record reservations in. Must outlive this resource.
+   */
+  recording_memory_resource(std::shared_ptr<device_memory_resource> upstream,
+                            address_space_tracker& tracker)
+    : upstream_{std::move(upstream)}, tracker_{&tracker}
+  {
+  }
+
+  ~recording_memory_resource() override = default;
+
+  recording_memory_resource(recording_memory_resource const&)            = delete;
+  recording_memory_resource& operator=(recording_memory_resource const&) = delete;
+  recording_memory_resource(recording_memory_resource&&)                 = delete;
+  recording_memory_resource& operator=(recording_memory_resource&&)      = delete;
+
+ private:
+  void* do_allocate(std::size_t bytes, cuda_stream_view stream) override
+  {
+    void* ptr = upstream_->allocate(bytes, stream);
+    tracker_->reserve(ptr, bytes);
+    return ptr;
+  }
+
+  void do_deallocate(void* ptr, std::size_t bytes, cuda_stream_view stream) override
+  {
+    tracker_->unreserve(ptr);
+    upstream_->deallocate(ptr, bytes, stream);
+  }
+
+  std::shared_ptr<device_memory_resource> upstream_;
+  address_space_tracker* tracker_;
+};
+
+}  // namespace rmm::mr
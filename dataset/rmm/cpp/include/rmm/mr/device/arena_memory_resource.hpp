@@ -16,6 +16,7 @@
 #pragma once
 
 #include <rmm/aligned.hpp>
+#include <rmm/cuda_device.hpp>
 #include <rmm/detail/error.hpp>
 #include <rmm/detail/export.hpp>
 #include <rmm/detail/format.hpp>
@@ -27,10 +28,15 @@
 
 #include <cuda_runtime_api.h>
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <cstddef>
 #include <map>
+#include <mutex>
 #include <shared_mutex>
 #include <thread>
+#include <vector>
 
 namespace RMM_NAMESPACE {
 namespace mr {
@@ -40,6 +46,46 @@ namespace mr {
  * @file
  */
 
+/**
+ * @brief Policy for returning superblocks stranded in idle arenas to the global arena.
+ *
+ * Superblocks move from the global arena to per-thread and per-stream arenas on demand, but only
+ * return when they become completely empty or when an allocation fails. Under skewed workloads,
+ * memory can sit in the arenas of threads that no longer allocate while other threads run out. A
+ * reclaim pass releases every superblock that is at most `max_occupancy` allocated from every arena
+ * that has been idle for at least `min_idle_time`. Passes run when the free memory in the global
+ * arena drops below `low_watermark` and, with a watermark set, before an allocation that does not
+ * fit falls back to returning every superblock to the global arena; every `interval` on a
+ * background thread; and whenever `arena_memory_resource::reclaim()` is called.
+ *
+ * The default policy never reclaims automatically.
+ */
+struct arena_reclaim_policy {
+  /// Reclaim superblocks whose allocated fraction is at most this value, in `[0, 1]`.
+  double max_occupancy{0.25};
+  /// Only reclaim from arenas that have not allocated or deallocated for this long.
+  std::chrono::milliseconds min_idle_time{0};
+  /// Reclaim when the free bytes in the global arena drop below this value. 0 disables.
+  std::size_t low_watermark{0};
+  /// Reclaim on a background thread with this period. 0 disables.
+  std::chrono::milliseconds interval{0};
+};
+
+/// Usage of the superblocks held by one arena.
+using arena_usage = detail::arena::arena_usage;
+
+/**
+ * @brief A snapshot of how an `arena_memory_resource` is using its memory.
+ */
+struct arena_stats {
+  arena_usage global{};                      ///< Superblocks held by the global arena
+  std::vector<arena_usage> thread_arenas{};  ///< Superblocks held by each per-thread arena
+  std::vector<arena_usage> stream_arenas{};  ///< Superblocks held by each per-stream arena
+  std::size_t reclaim_passes{};              ///< Number of reclaim passes run so far
+  std::size_t reclaimed_bytes{};             ///< Total size of the superblocks reclaimed so far
+  std::size_t defragmentations{};            ///< Times every arena was cleaned to fit an allocation
+};
+
 /**
  * @brief A suballocator that emphasizes fragmentation avoidance and scalable concurrency support.
  *
@@ -54,6 +100,10 @@ namespace mr {
  * coalesced with neighbouring free blocks if the addresses are contiguous. Free superblocks are
  * returned to the global arena.
  *
+ * Superblocks stranded in idle arenas can be returned to the global arena early according to an
+ * `arena_reclaim_policy`, and `get_arena_stats()` reports the free memory and superblock occupancy
+ * of every arena.
+ *
  * In real-world applications, allocation sizes tend to follow a power law distribution in which
  * large allocations are rare, but small ones quite common. By handling small allocations in the
  * per-thread arena, adequate performance can be achieved without introducing excessive memory
@@ -89,18 +139,28 @@ class arena_memory_resource final : public device_memory_resource {
    * @param arena_size Size in bytes of the global arena. Defaults to half of the available
    * memory on the current device.
    * @param dump_log_on_failure If true, dump memory log when running out of memory.
+   * @param reclaim_policy When to return superblocks from idle arenas to the global arena.
    */
   explicit arena_memory_resource(device_async_resource_ref upstream_mr,
                                  std::optional<std::size_t> arena_size = std::nullopt,
-                                 bool dump_log_on_failure              = false)
-    : global_arena_{upstream_mr, arena_size}, dump_log_on_failure_{dump_log_on_failure}
+                                 bool dump_log_on_failure              = false,
+                                 arena_reclaim_policy reclaim_policy   = {})
+    : global_arena_{upstream_mr, arena_size},
+      dump_log_on_failure_{dump_log_on_failure},
+      reclaim_policy_{reclaim_policy}
   {
+    RMM_EXPECTS(reclaim_policy_.max_occupancy >= 0.0 && reclaim_policy_.max_occupancy <= 1.0,
+                "Reclaim occupancy must be in [0, 1].");
     if (dump_log_on_failure_) {
       logger_ =
         std::make_shared<rapids_logger::logger>("arena_memory_dump", "rmm_arena_memory_dump.log");
       // Set the level to `debug` for more detailed output.
       logger_->set_level(rapids_logger::level_enum::info);
     }
+    if (reclaim_policy_.interval.count() > 0) {
+      auto const device = get_current_cuda_device();
+      reclaimer_        = std::thread{[this, device] { run_reclaimer(device); }};
+    }
   }
 
   /**
@@ -112,16 +172,30 @@ class arena_memory_resource final : public device_memory_resource {
    * @param arena_size Size in bytes of the global arena. Defaults to half of the available memory
    * on the current device.
    * @param dump_log_on_failure If true, dump memory log when running out of memory.
+   * @param reclaim_policy When to return superblocks from idle arenas to the global arena.
    */
   explicit arena_memory_resource(Upstream* upstream_mr,
                                  std::optional<std::size_t> arena_size = std::nullopt,
-                                 bool dump_log_on_failure              = false)
-    : arena_memory_resource{
-        to_device_async_resource_ref_checked(upstream_mr), arena_size, dump_log_on_failure}
+                                 bool dump_log_on_failure              = false,
+                                 arena_reclaim_policy reclaim_policy   = {})
+    : arena_memory_resource{to_device_async_resource_ref_checked(upstream_mr),
+                            arena_size,
+                            dump_log_on_failure,
+                            reclaim_policy}
   {
   }
 
-  ~arena_memory_resource() override = default;
+  ~arena_memory_resource() override
+  {
+    if (reclaimer_.joinable()) {
+      {
+        std::lock_guard lock(reclaimer_mtx_);
+        stop_reclaimer_ = true;
+      }
+      reclaimer_cv_.notify_one();
+      reclaimer_.join();
+    }
+  }
 
   // Disable copy (and move) semantics.
   arena_memory_resource(arena_memory_resource const&)                = delete;
@@ -129,6 +203,43 @@ class arena_memory_resource final : public device_memory_resource {
   arena_memory_resource(arena_memory_resource&&) noexcept            = delete;
   arena_memory_resource& operator=(arena_memory_resource&&) noexcept = delete;
 
+  /**
+   * @brief Return superblocks from idle arenas to the global arena according to the reclaim
+   * policy's `max_occupancy` and `min_idle_time`.
+   *
+   * Synchronizes the device, since memory freed on one stream may be handed to another.
+   *
+   * @return The total size in bytes of the superblocks reclaimed.
+   */
+  std::size_t reclaim()
+  {
+    std::unique_lock lock(mtx_);
+    return reclaim_idle_arenas();
+  }
+
+  /**
+   * @brief Get the free memory and superblock occupancy of the global arena and every per-thread
+   * and per-stream arena.
+   *
+   * @return A snapshot of the arenas.
+   */
+  [[nodiscard]] arena_stats get_arena_stats() const
+  {
+    std::shared_lock lock(mtx_);
+    std::shared_lock map_lock(map_mtx_);
+    arena_stats stats{global_arena_.usage()};
+    for (auto const& thread_arena : thread_arenas_) {
+      stats.thread_arenas.push_back(thread_arena.second->usage());
+    }
+    for (auto const& stream_arena : stream_arenas_) {
+      stats.stream_arenas.push_back(stream_arena.second.usage());
+    }
+    stats.reclaim_passes   = reclaim_passes_;
+    stats.reclaimed_bytes  = reclaimed_bytes_;
+    stats.defragmentations = defragmentations_;
+    return stats;
+  }
+
  private:
   using global_arena = rmm::mr::detail::arena::global_arena;
   using arena        = rmm::mr::detail::arena::arena;
@@ -154,16 +265,24 @@ class arena_memory_resource final : public device_memory_resource {
 #endif
     auto& arena = get_arena(stream);
 
+    void* pointer{};
     {
       std::shared_lock lock(mtx_);
-      void* pointer = arena.allocate(bytes);
-      if (pointer != nullptr) { return pointer; }
+      pointer = arena.allocate(bytes);
+    }
+    if (pointer != nullptr) {
+      if (crossed_low_watermark()) { reclaim(); }
+      return pointer;
     }
 
     {
       std::unique_lock lock(mtx_);
+      if (reclaim_policy_.low_watermark > 0 && reclaim_idle_arenas() > 0) {
+        pointer = arena.allocate(bytes);
+        if (pointer != nullptr) { return pointer; }
+      }
       defragment();
-      void* pointer = arena.allocate(bytes);
+      pointer = arena.allocate(bytes);
       if (pointer == nullptr) {
         if (dump_log_on_failure_) { dump_memory_log(bytes); }
         auto const msg = std::string("Maximum pool size exceeded (failed to allocate ") +
@@ -174,12 +293,84 @@ class arena_memory_resource final : public device_memory_resource {
     }
   }
 
+  /**
+   * @brief Whether the global arena's free memory has just dropped below the reclaim policy's low
+   * watermark.
+   *
+   * Only the first call after the free memory drops returns true, so that a workload that stays
+   * below the watermark does not reclaim on every allocation.
+   *
+   * @return true if a reclaim pass should run.
+   */
+  bool crossed_low_watermark()
+  {
+    if (reclaim_policy_.low_watermark == 0) { return false; }
+    if (global_arena_.free_bytes() >= reclaim_policy_.low_watermark) {
+      if (below_low_watermark_.load(std::memory_order_relaxed)) {
+        below_low_watermark_.store(false, std::memory_order_relaxed);
+      }
+      return false;
+    }
+    return !below_low_watermark_.load(std::memory_order_relaxed) &&
+           !below_low_watermark_.exchange(true, std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Return mostly-free superblocks from idle arenas to the global arena.
+   *
+   * The caller must hold a unique lock on `mtx_`.
+   *
+   * @return The total size in bytes of the superblocks reclaimed.
+   */
+  std::size_t reclaim_idle_arenas()
+  {
+    RMM_CUDA_TRY(cudaDeviceSynchronize());
+    std::shared_lock map_lock(map_mtx_);
+    std::size_t reclaimed{};
+    auto reclaim_from = [&](arena& idle_arena) {
+      if (idle_arena.idle_time() >= reclaim_policy_.min_idle_time) {
+        reclaimed += idle_arena.reclaim(reclaim_policy_.max_occupancy);
+      }
+    };
+    for (auto& thread_arena : thread_arenas_) {
+      reclaim_from(*thread_arena.second);
+    }
+    for (auto& stream_arena : stream_arenas_) {
+      reclaim_from(stream_arena.second);
+    }
+    ++reclaim_passes_;
+    reclaimed_bytes_ += reclaimed;
+    return reclaimed;
+  }
+
+  /**
+   * @brief Body of the background thread that reclaims every `reclaim_policy_.interval`.
+   *
+   * @param device The device of the memory managed by this resource.
+   */
+  void run_reclaimer(cuda_device_id device)
+  {
+    cuda_set_device_raii const set_device{device};
+    std::unique_lock lock(reclaimer_mtx_);
+    while (!reclaimer_cv_.wait_for(
+      lock, reclaim_policy_.interval, [this] { return stop_reclaimer_; })) {
+      lock.unlock();
+      try {
+        reclaim();
+      } catch (std::exception const& e) {
+        RMM_LOG_ERROR("[Arena][Reclaim FAILURE: %s]", e.what());
+      }
+      lock.lock();
+    }
+  }
+
   /**
    * @brief Defragment memory by returning all superblocks to the global arena.
    */
   void defragment()
   {
     RMM_CUDA_TRY(cudaDeviceSynchronize());
+    ++defragmentations_;
     for (auto& thread_arena : thread_arenas_) {
       thread_arena.second->clean();
     }
@@ -330,6 +521,15 @@ class arena_memory_resource final : public device_memory_resource {
     logger_->info("**************************************************");
     logger_->info("Global arena:");
     global_arena_.dump_memory_log(logger_);
+    std::size_t stranded{};
+    for (auto const& thread_arena : thread_arenas_) {
+      stranded += thread_arena.second->usage().free_bytes;
+    }
+    for (auto const& stream_arena : stream_arenas_) {
+      stranded += stream_arena.second.usage().free_bytes;
+    }
+    logger_->info("Free memory in per-thread and per-stream arenas: %s",
+                  rmm::detail::format_bytes(stranded));
     logger_->flush();
   }
 
@@ -356,6 +556,22 @@ class arena_memory_resource final : public device_memory_resource {
   bool dump_log_on_failure_{};
   /// The logger for memory dump.
   std::shared_ptr<rapids_logger::logger> logger_{};
+  /// When to return superblocks from idle arenas to the global arena.
+  arena_reclaim_policy reclaim_policy_{};
+  /// Whether the global arena's free memory is below the reclaim policy's low watermark.
+  std::atomic<bool> below_low_watermark_{};
+  /// Number of reclaim passes, guarded by a unique lock on `mtx_`.
+  std::size_t reclaim_passes_{};
+  /// Total size of the superblocks reclaimed, guarded by a unique lock on `mtx_`.
+  std::size_t reclaimed_bytes_{};
+  /// Number of calls to `defragment()`, guarded by a unique lock on `mtx_`.
+  std::size_t defragmentations_{};
+  /// Background thread that reclaims periodically, if enabled.
+  std::thread reclaimer_;
+  /// Mutex and condition variable used to stop the background thread.
+  std::mutex reclaimer_mtx_;
+  std::condition_variable reclaimer_cv_;
+  bool stop_reclaimer_{};
   /// Mutex for read and write locks on arena maps.
   mutable std::shared_mutex map_mtx_;
   /// Mutex for shared and unique locks on the mr.
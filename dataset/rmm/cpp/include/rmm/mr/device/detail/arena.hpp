@@ -29,6 +29,9 @@
 #include <cuda_runtime_api.h>
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <limits>
 #include <memory>
@@ -461,6 +464,16 @@ class superblock final : public byte_span {
     return std::max_element(free_blocks_.cbegin(), free_blocks_.cend(), block_size_compare)->size();
   }
 
+  /**
+   * @brief Find the fraction of this superblock that is allocated.
+   * @return the occupancy in `[0, 1]`, 0 if the superblock is empty.
+   */
+  [[nodiscard]] double occupancy() const
+  {
+    RMM_LOGGING_ASSERT(is_valid());
+    return 1.0 - static_cast<double>(total_free_size()) / static_cast<double>(size());
+  }
+
  private:
   /// Address-ordered set of free blocks.
   std::set<block> free_blocks_{};
@@ -485,6 +498,55 @@ inline auto max_free_size(std::set<superblock> const& superblocks)
   return size;
 };
 
+/// Number of bins in an occupancy histogram.
+inline constexpr std::size_t occupancy_bins{10};
+
+/**
+ * @brief Histogram of superblock occupancy.
+ *
+ * Bin `i` counts the superblocks whose occupancy is in `[i / occupancy_bins, (i + 1) /
+ * occupancy_bins)`; full superblocks are counted in the last bin.
+ */
+using occupancy_histogram = std::array<std::size_t, occupancy_bins>;
+
+/// Add the occupancy of a set of superblocks to a histogram.
+inline void add_occupancy(std::set<superblock> const& superblocks, occupancy_histogram& histogram)
+{
+  for (auto const& sblk : superblocks) {
+    auto const bin = static_cast<std::size_t>(sblk.occupancy() * occupancy_bins);
+    histogram.at(std::min(bin, occupancy_bins - 1))++;
+  }
+}
+
+/**
+ * @brief A snapshot of the superblocks held by an arena.
+ */
+struct arena_usage {
+  std::size_t superblocks{};       ///< Number of superblocks held
+  std::size_t superblock_bytes{};  ///< Total size of the superblocks held
+  std::size_t free_bytes{};        ///< Bytes in the held superblocks that are not allocated
+  std::size_t max_free_size{};     ///< Largest free block in the held superblocks
+  std::chrono::steady_clock::duration idle_time{};  ///< Time since the last (de)allocation
+  occupancy_histogram occupancy{};                  ///< Occupancy of the held superblocks
+
+  /**
+   * @brief Summarize a set of superblocks.
+   *
+   * @param superblocks The superblocks to summarize.
+   * @return The usage of the superblocks.
+   */
+  static arena_usage of(std::set<superblock> const& superblocks)
+  {
+    arena_usage usage{};
+    usage.superblocks      = superblocks.size();
+    usage.superblock_bytes = total_memory_size(superblocks);
+    usage.free_bytes       = total_free_size(superblocks);
+    usage.max_free_size    = arena::max_free_size(superblocks);
+    add_occupancy(superblocks, usage.occupancy);
+    return usage;
+  }
+};
+
 /**
  * @brief The global arena for allocating memory from the upstream memory resource.
  *
@@ -590,6 +652,7 @@ class global_arena final {
     auto sblk = first_fit(size);
     if (sblk.is_valid()) {
       auto blk = sblk.first_fit(size);
+      free_bytes_ += sblk.total_free_size();
       superblocks_.insert(std::move(sblk));
       return blk.pointer();
     }
@@ -631,15 +694,40 @@ class global_arena final {
     if (iter == superblocks_.cend()) { return false; }
 
     auto sblk = std::move(superblocks_.extract(iter).value());
+    free_bytes_ -= sblk.total_free_size();
     sblk.coalesce(blk);
     if (sblk.empty()) {
       coalesce(std::move(sblk));
     } else {
+      free_bytes_ += sblk.total_free_size();
       superblocks_.insert(std::move(sblk));
     }
     return true;
   }
 
+  /**
+   * @brief Find the number of bytes in the global arena that are not allocated.
+   *
+   * This is maintained incrementally and does not lock the global arena.
+   *
+   * @return the free bytes held by the global arena.
+   */
+  [[nodiscard]] std::size_t free_bytes() const
+  {
+    return free_bytes_.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Summarize the superblocks held by the global arena.
+   *
+   * @return the usage of the global arena.
+   */
+  [[nodiscard]] arena_usage usage() const
+  {
+    std::lock_guard lock(mtx_);
+    return arena_usage::of(superblocks_);
+  }
+
   /**
    * @brief Dump memory to log.
    *
@@ -703,6 +791,7 @@ class global_arena final {
   {
     upstream_block_ = {upstream_mr_.allocate(size), size};
     superblocks_.emplace(upstream_block_.pointer(), size);
+    free_bytes_ = size;
   }
 
   /**
@@ -726,11 +815,13 @@ class global_arena final {
                                    [=](auto const& sblk) { return sblk.fits(size); });
     if (iter == superblocks_.cend()) { return {}; }
 
-    auto sblk           = std::move(superblocks_.extract(iter).value());
+    auto sblk = std::move(superblocks_.extract(iter).value());
+    free_bytes_ -= sblk.total_free_size();
     auto const min_size = std::max(superblock::minimum_size, size);
     if (sblk.empty() && sblk.size() >= min_size + superblock::minimum_size) {
       // Split the superblock and put the remainder back.
       auto [head, tail] = sblk.split(min_size);
+      free_bytes_ += tail.size();
       superblocks_.insert(std::move(tail));
       return std::move(head);
     }
@@ -745,6 +836,8 @@ class global_arena final {
   void coalesce(superblock&& sblk)
   {
     RMM_LOGGING_ASSERT(sblk.is_valid());
+    // Merging empty superblocks does not change the total free size.
+    free_bytes_ += sblk.total_free_size();
 
     // Find the right place (in ascending address order) to insert the block.
     auto const next     = superblocks_.lower_bound(sblk);
@@ -778,6 +871,8 @@ class global_arena final {
   block upstream_block_;
   /// Address-ordered set of superblocks.
   std::set<superblock> superblocks_;
+  /// Free bytes in `superblocks_`, readable without the lock.
+  std::atomic<std::size_t> free_bytes_{};
   /// Mutex for exclusive lock.
   mutable std::mutex mtx_;
 };
@@ -816,6 +911,7 @@ class arena {
    */
   void* allocate(std::size_t size)
   {
+    touch();
     if (global_arena_.handles(size)) { return global_arena_.allocate(size); }
     std::lock_guard lock(mtx_);
     return get_block(size).pointer();
@@ -832,6 +928,7 @@ class arena {
    */
   bool deallocate(void* ptr, std::size_t size, cuda_stream_view stream)
   {
+    touch();
     if (global_arena::handles(size) && global_arena_.deallocate_async(ptr, size, stream)) {
       return true;
     }
@@ -876,7 +973,63 @@ class arena {
     }
   }
 
+  /**
+   * @brief Release superblocks that are at most `max_occupancy` allocated to the global arena.
+   *
+   * Superblocks that still hold allocations are released too; the global arena hands them to
+   * whichever arena next needs space, and their remaining allocations are freed through the
+   * resource's cross-arena deallocation path.
+   *
+   * @param max_occupancy Release superblocks whose occupancy is at most this value.
+   * @return the total size in bytes of the released superblocks.
+   */
+  std::size_t reclaim(double max_occupancy)
+  {
+    std::lock_guard lock(mtx_);
+    std::size_t released{};
+    for (auto iter = superblocks_.cbegin(); iter != superblocks_.cend();) {
+      auto const next = std::next(iter);
+      if (iter->occupancy() <= max_occupancy) {
+        released += iter->size();
+        global_arena_.release(std::move(superblocks_.extract(iter).value()));
+      }
+      iter = next;
+    }
+    return released;
+  }
+
+  /**
+   * @brief Find the time since this arena last allocated or deallocated memory.
+   * @return the idle time.
+   */
+  [[nodiscard]] std::chrono::steady_clock::duration idle_time() const
+  {
+    using clock     = std::chrono::steady_clock;
+    auto const last = clock::duration{last_used_.load(std::memory_order_relaxed)};
+    return clock::now().time_since_epoch() - last;
+  }
+
+  /**
+   * @brief Summarize the superblocks held by this arena.
+   *
+   * @return the usage of this arena.
+   */
+  [[nodiscard]] arena_usage usage() const
+  {
+    std::lock_guard lock(mtx_);
+    auto usage      = arena_usage::of(superblocks_);
+    usage.idle_time = idle_time();
+    return usage;
+  }
+
  private:
+  /// Record that this arena is in use.
+  void touch()
+  {
+    last_used_.store(std::chrono::steady_clock::now().time_since_epoch().count(),
+                     std::memory_order_relaxed);
+  }
+
   /**
    * @brief Get an available memory block of at least `size` bytes.
    *
@@ -961,6 +1114,9 @@ class arena {
   global_arena& global_arena_;
   /// Acquired superblocks.
   std::set<superblock> superblocks_;
+  /// `steady_clock` time of the last allocation or deallocation.
+  std::atomic<std::chrono::steady_clock::rep> last_used_{
+    std::chrono::steady_clock::now().time_since_epoch().count()};
   /// Mutex for exclusive lock.
   mutable std::mutex mtx_;
 };
@@ -0,0 +1,288 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <rmm/detail/error.hpp>
+#include <rmm/detail/export.hpp>
+#include <rmm/detail/format.hpp>
+#include <rmm/detail/logging_assert.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace RMM_NAMESPACE {
+namespace mr::detail {
+
+/**
+ * @brief Returns the number of bits needed to represent `value`, i.e. `floor(log2(value)) + 1`
+ * for `value > 0` and 0 for `value == 0`, in a constant number of steps.
+ */
+constexpr std::size_t bit_length(std::uint64_t value) noexcept
+{
+  std::size_t length{0};
+  // NOLINTBEGIN(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
+  for (std::size_t shift : {32U, 16U, 8U, 4U, 2U, 1U}) {
+    if (value >= (std::uint64_t{1} << shift)) {
+      value >>= shift;
+      length += shift;
+    }
+  }
+  // NOLINTEND(readability-magic-numbers,cppcoreguidelines-avoid-magic-numbers)
+  return length + static_cast<std::size_t>(value);
+}
+
+/**
+ * @brief A bin of fixed-size blocks with lock-free allocation and deallocation.
+ *
+ * Blocks are carved from chunks obtained from an upstream resource and are never returned to it
+ * until the bin is released. Since the blocks are device memory, the free list cannot be threaded
+ * through them; instead each block has a host-side node, and a node is always on exactly one of
+ * two Treiber stacks: the free stack, whose nodes hold the address of a free block, or the spare
+ * stack, whose nodes are unused. Allocation pops a free node and pushes it onto the spare stack;
+ * deallocation pops a spare node, stores the address in it and pushes it onto the free stack. As a
+ * bin has exactly as many nodes as blocks, a spare node is available for every outstanding block.
+ *
+ * Stack heads pack a 32-bit node index with a 32-bit tag that is incremented on every update, to
+ * avoid the ABA problem. Node indices address `max_chunks` chunks of up to `max_blocks_per_chunk`
+ * blocks each. Only growing the bin takes a lock.
+ *
+ * The bin does not order work on CUDA streams; the owning resource is responsible for that.
+ */
+class size_class_bin {
+ public:
+  /// Maximum number of chunks a bin can obtain from upstream
+  static constexpr std::size_t max_chunks{std::size_t{1} << 12U};
+  /// Maximum number of blocks per chunk
+  static constexpr std::size_t max_blocks_per_chunk{(std::size_t{1} << 20U) - 1};
+
+  /**
+   * @brief Construct an empty bin.
+   *
+   * @param block_size The size in bytes of each block
+   * @param chunk_size The size in bytes to request from upstream when the bin is empty, rounded
+   * down to a multiple of `block_size` and to at most `max_blocks_per_chunk` blocks, and up to at
+   * least one block
+   */
+  size_class_bin(std::size_t block_size, std::size_t chunk_size)
+    : block_size_{block_size},
+      blocks_per_chunk_{std::min(std::max(chunk_size / block_size, std::size_t{1}),
+                                 max_blocks_per_chunk)},
+      chunks_(max_chunks),
+      chunk_bases_(max_chunks)
+  {
+    RMM_EXPECTS(block_size > 0, "Block size must be nonzero.");
+  }
+
+  ~size_class_bin() = default;
+
+  size_class_bin(size_class_bin const&)            = delete;
+  size_class_bin(size_class_bin&&)                 = delete;
+  size_class_bin& operator=(size_class_bin const&) = delete;
+  size_class_bin& operator=(size_class_bin&&)      = delete;
+
+  /// Returns the size in bytes of the blocks in this bin
+  [[nodiscard]] std::size_t block_size() const noexcept { return block_size_; }
+
+  /// Returns the size in bytes of each chunk requested from upstream
+  [[nodiscard]] std::size_t chunk_size() const noexcept { return blocks_per_chunk_ * block_size_; }
+
+  /// Returns the number of chunks obtained from upstream so far
+  [[nodiscard]] std::size_t num_chunks() const noexcept
+  {
+    return num_chunks_.load(std::memory_order_acquire);
+  }
+
+  /**
+   * @brief Pops a free block without blocking.
+   *
+   * @return Pointer to a free block, or `nullptr` if the bin has none
+   */
+  void* try_allocate() noexcept
+  {
+    auto const index = pop(free_head_);
+    if (index == empty) { return nullptr; }
+    void* ptr = node_at(index).ptr;
+    push(spare_head_, index, index);
+    return ptr;
+  }
+
+  /**
+   * @brief Allocates a block, obtaining a new chunk with `allocate_chunk` if the bin is empty.
+   *
+   * @throws rmm::out_of_memory if the bin already holds `max_chunks` chunks
+   *
+   * @param allocate_chunk Callable with signature `void*(std::size_t bytes)` that obtains a chunk
+   * from upstream
+   * @return Pointer to the allocated block
+   */
+  template <typename AllocateChunk>
+  void* allocate(AllocateChunk&& allocate_chunk)
+  {
+    void* ptr = try_allocate();
+    if (ptr != nullptr) { return ptr; }
+
+    std::lock_guard<std::mutex> lock(grow_mtx_);
+    // Another thread may have grown the bin while this one waited for the lock.
+    ptr = try_allocate();
+    if (ptr != nullptr) { return ptr; }
+
+    auto const chunk_index = num_chunks_.load(std::memory_order_relaxed);
+    RMM_EXPECTS(chunk_index < max_chunks,
+                "Size class bin of " + rmm::detail::format_bytes(block_size_) +
+                  " blocks exceeded its maximum number of chunks",
+                rmm::out_of_memory);
+
+    auto* const base =
+      static_cast<char*>(std::forward<AllocateChunk>(allocate_chunk)(chunk_size()));
+    auto nodes       = std::make_unique<node[]>(blocks_per_chunk_);  // NOLINT(*-avoid-c-arrays)
+    for (std::size_t slot = 0; slot < blocks_per_chunk_; ++slot) {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      nodes[slot].ptr = base + slot * block_size_;
+      // Link the blocks after the first into a chain for the free stack.
+      auto const next = slot + 1 < blocks_per_chunk_ ? make_index(chunk_index, slot + 1) : empty;
+      nodes[slot].next.store(next, std::memory_order_relaxed);
+    }
+    chunks_[chunk_index]      = std::move(nodes);
+    chunk_bases_[chunk_index] = base;
+    num_chunks_.store(chunk_index + 1, std::memory_order_release);
+
+    // The first block is returned, so its node is spare; the rest are free.
+    push(spare_head_, make_index(chunk_index, 0), make_index(chunk_index, 0));
+    if (blocks_per_chunk_ > 1) {
+      push(free_head_, make_index(chunk_index, 1), make_index(chunk_index, blocks_per_chunk_ - 1));
+    }
+    return base;
+  }
+
+  /**
+   * @brief Returns a block to the bin without blocking.
+   *
+   * @param ptr Pointer to a block previously allocated from this bin
+   */
+  void deallocate(void* ptr) noexcept
+  {
+    auto const index = pop(spare_head_);
+    RMM_LOGGING_ASSERT(index != empty);
+    node_at(index).ptr = ptr;
+    push(free_head_, index, index);
+  }
+
+  /**
+   * @brief Returns every chunk to upstream. The bin must not be used afterwards.
+   *
+   * @param deallocate_chunk Callable with signature `void(void* ptr, std::size_t bytes)`
+   */
+  template <typename DeallocateChunk>
+  void release(DeallocateChunk&& deallocate_chunk)
+  {
+    std::lock_guard<std::mutex> lock(grow_mtx_);
+    auto const chunks = num_chunks_.exchange(0, std::memory_order_acq_rel);
+    for (std::size_t chunk = 0; chunk < chunks; ++chunk) {
+      deallocate_chunk(chunk_bases_[chunk], chunk_size());
+      chunks_[chunk].reset();
+      chunk_bases_[chunk] = nullptr;
+    }
+    free_head_.store(pack(empty, 0), std::memory_order_relaxed);
+    spare_head_.store(pack(empty, 0), std::memory_order_relaxed);
+  }
+
+ private:
+  struct node {
+    std::atomic<std::uint32_t> next{};
+    // Written before the node is pushed and read after it is popped, so the stack's release /
+    // acquire ordering protects it.
+    void* ptr{};
+  };
+
+  static constexpr std::uint32_t empty{~std::uint32_t{0}};
+  static constexpr unsigned slot_bits{20};
+  static constexpr unsigned tag_shift{32};
+
+  static std::uint32_t make_index(std::size_t chunk, std::size_t slot) noexcept
+  {
+    return static_cast<std::uint32_t>((chunk << slot_bits) | slot);
+  }
+
+  static std::uint64_t pack(std::uint32_t index, std::uint64_t tag) noexcept
+  {
+    return (tag << tag_shift) | index;
+  }
+
+  static std::uint32_t index_of(std::uint64_t head) noexcept
+  {
+    return static_cast<std::uint32_t>(head);
+  }
+
+  static std::uint64_t tag_of(std::uint64_t head) noexcept { return head >> tag_shift; }
+
+  node& node_at(std::uint32_t index) const noexcept
+  {
+    return chunks_[index >> slot_bits][index & ((1U << slot_bits) - 1)];
+  }
+
+  /// Pops the top node of `head`, returning its index or `empty`
+  std::uint32_t pop(std::atomic<std::uint64_t>& head) const noexcept
+  {
+    auto current = head.load(std::memory_order_acquire);
+    while (true) {
+      auto const index = index_of(current);
+      if (index == empty) { return empty; }
+      // May read a stale link if another thread pops concurrently; the tag makes the CAS fail.
+      auto const next = node_at(index).next.load(std::memory_order_relaxed);
+      if (head.compare_exchange_weak(current,
+                                     pack(next, tag_of(current) + 1),
+                                     std::memory_order_acq_rel,
+                                     std::memory_order_acquire)) {
+        return index;
+      }
+    }
+  }
+
+  /// Pushes the already-linked chain of nodes `first` ... `last` onto `head`
+  void push(std::atomic<std::uint64_t>& head,
+            std::uint32_t first,
+            std::uint32_t last) const noexcept
+  {
+    auto current = head.load(std::memory_order_relaxed);
+    do {
+      node_at(last).next.store(index_of(current), std::memory_order_relaxed);
+    } while (!head.compare_exchange_weak(current,
+                                         pack(first, tag_of(current) + 1),
+                                         std::memory_order_release,
+                                         std::memory_order_relaxed));
+  }
+
+  std::size_t block_size_;
+  std::size_t blocks_per_chunk_;
+  // Sized once at construction so that readers never see it reallocate
+  std::vector<std::unique_ptr<node[]>> chunks_;  // NOLINT(*-avoid-c-arrays)
+  // The addresses of the chunks, as obtained from upstream. A node's `ptr` can't stand for its
+  // chunk: deallocation stores the freed block in whichever spare node it pops.
+  std::vector<void*> chunk_bases_;
+  std::atomic<std::size_t> num_chunks_{};
+  std::atomic<std::uint64_t> free_head_{pack(empty, 0)};
+  std::atomic<std::uint64_t> spare_head_{pack(empty, 0)};
+  std::mutex grow_mtx_;
+};
+
+}  // namespace mr::detail
+}  // namespace RMM_NAMESPACE
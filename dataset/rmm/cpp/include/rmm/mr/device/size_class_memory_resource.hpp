@@ -0,0 +1,359 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <rmm/aligned.hpp>
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/detail/error.hpp>
+#include <rmm/detail/export.hpp>
+#include <rmm/mr/device/detail/size_class_bin.hpp>
+#include <rmm/mr/device/device_memory_resource.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <cuda_runtime_api.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace RMM_NAMESPACE {
+namespace mr {
+/**
+ * @addtogroup device_memory_resources
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Allocates memory from fixed-size bins with constant-time size dispatch and lock-free
+ * bins.
+ *
+ * Behaves like `binning_memory_resource` with its default `fixed_size_memory_resource` bins, but
+ * is optimized for many small allocations:
+ *
+ * - The bin for a request is found through a table indexed by the base-2 logarithm of the size
+ *   rather than by searching an ordered map. For power-of-two bins this is a single lookup.
+ * - Each bin keeps its free blocks on a lock-free stack (see `detail::size_class_bin`), so
+ *   allocation and deallocation take no lock unless the bin must grow.
+ *
+ * Bins are tied to a single stream, given at construction. Allocations and deallocations on that
+ * stream are lock-free. Those on any other stream are correct but slower: they are ordered
+ * against the bin's stream with an event, under a lock. Requests larger than the largest bin are
+ * forwarded to the upstream resource on the caller's stream.
+ *
+ * Memory held by the bins is returned to the upstream resource only when this resource is
+ * destroyed.
+ *
+ * @tparam Upstream Memory resource to use for bin chunks and for allocations that don't fall
+ * within any bin. Implements rmm::mr::device_memory_resource interface.
+ */
+template <typename Upstream>
+class size_class_memory_resource final : public device_memory_resource {
+ public:
+  /// Default size in bytes of the chunks bins request from upstream
+  static constexpr std::size_t default_chunk_size{std::size_t{2} << 20U};
+
+  /**
+   * @brief Construct a new size class memory resource object.
+   *
+   * Initially has no bins, so simply uses the upstream resource until bins are added with
+   * `add_bin`.
+   *
+   * @param upstream_resource The upstream memory resource used to allocate bin chunks.
+   * @param stream The stream bins are tied to.
+   * @param chunk_size The size in bytes each bin requests from upstream when it runs out of blocks.
+   */
+  explicit size_class_memory_resource(device_async_resource_ref upstream_resource,
+                                      cuda_stream_view stream = cuda_stream_view{},
+                                      std::size_t chunk_size  = default_chunk_size)
+    : upstream_mr_{upstream_resource}, stream_{stream}, chunk_size_{chunk_size}
+  {
+    initialize();
+  }
+
+  /**
+   * @brief Construct a new size class memory resource object.
+   *
+   * Initially has no bins, so simply uses the upstream resource until bins are added with
+   * `add_bin`.
+   *
+   * @throws rmm::logic_error if upstream_resource is nullptr
+   *
+   * @param upstream_resource The upstream memory resource used to allocate bin chunks.
+   * @param stream The stream bins are tied to.
+   * @param chunk_size The size in bytes each bin requests from upstream when it runs out of blocks.
+   */
+  explicit size_class_memory_resource(Upstream* upstream_resource,
+                                      cuda_stream_view stream = cuda_stream_view{},
+                                      std::size_t chunk_size  = default_chunk_size)
+    : upstream_mr_{to_device_async_resource_ref_checked(upstream_resource)},
+      stream_{stream},
+      chunk_size_{chunk_size}
+  {
+    initialize();
+  }
+
+  /**
+   * @brief Construct a new size class memory resource object with a range of initial bins.
+   *
+   * Adds bins of sizes 2^min_size_exponent, ..., 2^max_size_exponent. For example if
+   * `min_size_exponent==8` and `max_size_exponent==12`, creates bins of sizes 256B, 512B, 1KiB,
+   * 2KiB and 4KiB.
+   *
+   * @param upstream_resource The upstream memory resource used to allocate bin chunks.
+   * @param min_size_exponent The minimum base-2 exponent bin size.
+   * @param max_size_exponent The maximum base-2 exponent bin size.
+   * @param stream The stream bins are tied to.
+   * @param chunk_size The size in bytes each bin requests from upstream when it runs out of blocks.
+   */
+  size_class_memory_resource(device_async_resource_ref upstream_resource,
+                             // NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
+                             int8_t min_size_exponent,
+                             int8_t max_size_exponent,
+                             cuda_stream_view stream = cuda_stream_view{},
+                             std::size_t chunk_size  = default_chunk_size)
+    : size_class_memory_resource{upstream_resource, stream, chunk_size}
+  {
+    for (auto i = min_size_exponent; i <= max_size_exponent; i++) {
+      add_bin(std::size_t{1} << i);
+    }
+  }
+
+  /**
+   * @brief Construct a new size class memory resource object with a range of initial bins.
+   *
+   * Adds bins of sizes 2^min_size_exponent, ..., 2^max_size_exponent. For example if
+   * `min_size_exponent==8` and `max_size_exponent==12`, creates bins of sizes 256B, 512B, 1KiB,
+   * 2KiB and 4KiB.
+   *
+   * @throws rmm::logic_error if upstream_resource is nullptr
+   *
+   * @param upstream_resource The upstream memory resource used to allocate bin chunks.
+   * @param min_size_exponent The minimum base-2 exponent bin size.
+   * @param max_size_exponent The maximum base-2 exponent bin size.
+   * @param stream The stream bins are tied to.
+   * @param chunk_size The size in bytes each bin requests from upstream when it runs out of blocks.
+   */
+  size_class_memory_resource(Upstream* upstream_resource,
+                             // NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
+                             int8_t min_size_exponent,
+                             int8_t max_size_exponent,
+                             cuda_stream_view stream = cuda_stream_view{},
+                             std::size_t chunk_size  = default_chunk_size)
+    : size_class_memory_resource{upstream_resource, stream, chunk_size}
+  {
+    for (auto i = min_size_exponent; i <= max_size_exponent; i++) {
+      add_bin(std::size_t{1} << i);
+    }
+  }
+
+  /**
+   * @brief Destroy the size_class_memory_resource and free all memory allocated from the upstream
+   * resource.
+   */
+  ~size_class_memory_resource() override
+  {
+    for (auto& bin : bins_) {
+      bin->release([this](void* ptr, std::size_t bytes) {
+        get_upstream_resource().deallocate_async(ptr, bytes, stream_);
+      });
+    }
+    RMM_ASSERT_CUDA_SUCCESS(cudaEventDestroy(event_));
+  }
+
+  size_class_memory_resource()                                             = delete;
+  size_class_memory_resource(size_class_memory_resource const&)            = delete;
+  size_class_memory_resource(size_class_memory_resource&&)                 = delete;
+  size_class_memory_resource& operator=(size_class_memory_resource const&) = delete;
+  size_class_memory_resource& operator=(size_class_memory_resource&&)      = delete;
+
+  /**
+   * @briefreturn{device_async_resource_ref to the upstream resource}
+   */
+  [[nodiscard]] device_async_resource_ref get_upstream_resource() const noexcept
+  {
+    return upstream_mr_;
+  }
+
+  /**
+   * @briefreturn{The stream the bins are tied to}
+   */
+  [[nodiscard]] cuda_stream_view stream() const noexcept { return stream_; }
+
+  /**
+   * @brief Add a bin to this resource.
+   *
+   * This bin will be used for any allocation smaller than `allocation_size` that is larger than
+   * the next smaller bin's allocation size. `allocation_size` is rounded up to a multiple of
+   * `CUDA_ALLOCATION_ALIGNMENT`.
+   *
+   * If there is already a bin of the specified size nothing is changed.
+   *
+   * This function is not thread safe.
+   *
+   * @param allocation_size The maximum size that this bin allocates
+   */
+  void add_bin(std::size_t allocation_size)
+  {
+    allocation_size = align_up(allocation_size, CUDA_ALLOCATION_ALIGNMENT);
+    auto const iter = std::lower_bound(
+      bins_.begin(), bins_.end(), allocation_size, [](auto const& bin, std::size_t size) {
+        return bin->block_size() < size;
+      });
+    if (iter != bins_.end() && (*iter)->block_size() == allocation_size) { return; }
+    bins_.insert(iter, std::make_unique<detail::size_class_bin>(allocation_size, chunk_size_));
+    build_lookup_table();
+  }
+
+  /**
+   * @brief Returns the sizes of the bins, in increasing order.
+   *
+   * @return The bin sizes in bytes
+   */
+  [[nodiscard]] std::vector<std::size_t> bin_sizes() const
+  {
+    std::vector<std::size_t> sizes;
+    sizes.reserve(bins_.size());
+    for (auto const& bin : bins_) {
+      sizes.push_back(bin->block_size());
+    }
+    return sizes;
+  }
+
+ private:
+  /// One bucket for each possible bit length of a `std::size_t`, plus one for zero
+  static constexpr std::size_t num_buckets{(sizeof(std::size_t) * 8) + 1};
+
+  /// Returns the bucket of `bytes`: the bucket `b` holds the sizes in (2^(b-1), 2^b]
+  static constexpr std::size_t bucket_of(std::size_t bytes) noexcept
+  {
+    return detail::bit_length(bytes - 1);
+  }
+
+  void initialize()
+  {
+    RMM_EXPECTS(chunk_size_ > 0, "Chunk size must be nonzero.");
+    RMM_CUDA_TRY(cudaEventCreateWithFlags(&event_, cudaEventDisableTiming));
+    build_lookup_table();
+  }
+
+  /**
+   * @brief Fills `lookup_table_` so that the entry for each bucket is the first bin that can hold
+   * the smallest size in the bucket.
+   */
+  void build_lookup_table() noexcept
+  {
+    std::size_t bin{0};
+    for (std::size_t bucket = 0; bucket < num_buckets; ++bucket) {
+      auto const smallest = bucket == 0 ? 1 : (std::size_t{1} << (bucket - 1)) + 1;
+      while (bin < bins_.size() && bins_[bin]->block_size() < smallest) {
+        ++bin;
+      }
+      lookup_table_[bucket] = bin;
+    }
+  }
+
+  /**
+   * @brief Get the bin for the requested size.
+   *
+   * Chooses the bin with the smallest blocks at least as large as `bytes`.
+   *
+   * @param bytes Requested allocation size in bytes
+   * @return The bin, or `nullptr` if `bytes` is larger than every bin
+   */
+  detail::size_class_bin* get_bin(std::size_t bytes) const noexcept
+  {
+    auto index = lookup_table_[bucket_of(bytes)];  // NOLINT(*-pro-bounds-constant-array-index)
+    // Only bins that are not powers of two share a bucket with another bin.
+    while (index < bins_.size() && bins_[index]->block_size() < bytes) {
+      ++index;
+    }
+    return index < bins_.size() ? bins_[index].get() : nullptr;
+  }
+
+  /**
+   * @brief Makes `to` wait for the work submitted so far to `from`.
+   */
+  void order_streams(cuda_stream_view from, cuda_stream_view to)
+  {
+    std::lock_guard<std::mutex> lock(event_mtx_);
+    RMM_CUDA_TRY(cudaEventRecord(event_, from.value()));
+    RMM_CUDA_TRY(cudaStreamWaitEvent(to.value(), event_, 0));
+  }
+
+  /**
+   * @brief Allocates memory of size at least \p bytes.
+   *
+   * The returned pointer will have at minimum 256 byte alignment.
+   *
+   * @param bytes The size of the allocation
+   * @param stream Stream on which to perform allocation
+   * @return void* Pointer to the newly allocated memory
+   */
+  void* do_allocate(std::size_t bytes, cuda_stream_view stream) override
+  {
+    if (bytes <= 0) { return nullptr; }
+    auto* bin = get_bin(bytes);
+    if (bin == nullptr) { return get_upstream_resource().allocate_async(bytes, stream); }
+    void* ptr = bin->allocate(
+      [this](std::size_t chunk_bytes) {
+        return get_upstream_resource().allocate_async(chunk_bytes, stream_);
+      });
+    // The block may have been freed by work on the bin's stream that `stream` must not overtake.
+    if (stream != stream_) { order_streams(stream_, stream); }
+    return ptr;
+  }
+
+  /**
+   * @brief Deallocate memory pointed to by \p ptr.
+   *
+   * @param ptr Pointer to be deallocated
+   * @param bytes The size in bytes of the allocation. This must be equal to the
+   * value of `bytes` that was passed to the `allocate` call that returned `ptr`.
+   * @param stream Stream on which to perform deallocation
+   */
+  void do_deallocate(void* ptr, std::size_t bytes, cuda_stream_view stream) override
+  {
+    auto* bin = get_bin(bytes);
+    if (bin == nullptr) {
+      get_upstream_resource().deallocate_async(ptr, bytes, stream);
+      return;
+    }
+    // Work on `stream` may still use the block, so the bin's stream must wait for it before the
+    // block can be reused.
+    if (stream != stream_) { order_streams(stream, stream_); }
+    bin->deallocate(ptr);
+  }
+
+  device_async_resource_ref
+    upstream_mr_;  // The upstream memory_resource from which to allocate blocks.
+  cuda_stream_view stream_;
+  std::size_t chunk_size_;
+
+  std::vector<std::unique_ptr<detail::size_class_bin>> bins_;  // sorted by block size
+  std::array<std::size_t, num_buckets> lookup_table_{};       // first candidate bin per bucket
+
+  cudaEvent_t event_{};
+  std::mutex event_mtx_;
+};
+
+/** @} */  // end of group
+}  // namespace mr
+}  // namespace RMM_NAMESPACE
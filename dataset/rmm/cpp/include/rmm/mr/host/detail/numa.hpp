@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <rmm/detail/export.hpp>
+
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+
+namespace RMM_NAMESPACE {
+namespace mr::detail {
+
+/**
+ * @brief Thin wrappers around the Linux NUMA and virtual memory system calls used by the host
+ * pool resources.
+ *
+ * The raw system calls are used rather than `libnuma` so that RMM does not acquire a link-time
+ * dependency. Every helper degrades gracefully on kernels or containers where NUMA policy is
+ * unavailable: the memory is still usable, it simply is not bound.
+ */
+namespace numa {
+
+/// `MPOL_PREFERRED` from `<linux/mempolicy.h>`
+constexpr int mpol_preferred{1};
+/// `MPOL_BIND` from `<linux/mempolicy.h>`
+constexpr int mpol_bind{2};
+
+/// Size of a transparent / explicit huge page on the platforms RMM supports
+constexpr std::size_t huge_page_size{std::size_t{2} << 20U};
+
+/**
+ * @brief Returns the number of NUMA nodes that are online on this host.
+ *
+ * Parses `/sys/devices/system/node/online` (e.g. "0-3" or "0,2"). Returns 1 if the file cannot be
+ * read, which is the behavior of a non-NUMA system.
+ */
+inline int num_nodes() noexcept
+{
+  try {
+    std::ifstream online{"/sys/devices/system/node/online"};
+    std::string ranges;
+    if (!std::getline(online, ranges) || ranges.empty()) { return 1; }
+    int max_node{0};
+    std::size_t pos{0};
+    while (pos < ranges.size()) {
+      auto const next  = ranges.find(',', pos);
+      auto const token = ranges.substr(pos, next == std::string::npos ? next : next - pos);
+      auto const dash  = token.find('-');
+      auto const last  = std::stoi(dash == std::string::npos ? token : token.substr(dash + 1));
+      max_node         = std::max(max_node, last);
+      if (next == std::string::npos) { break; }
+      pos = next + 1;
+    }
+    return max_node + 1;
+  } catch (...) {
+    return 1;
+  }
+}
+
+/**
+ * @brief Returns the NUMA node of the CPU the calling thread is currently running on, or 0 if it
+ * cannot be determined.
+ */
+inline int current_node() noexcept
+{
+  unsigned cpu{0};
+  unsigned node{0};
+  if (syscall(SYS_getcpu, &cpu, &node, nullptr) != 0) { return 0; }
+  return static_cast<int>(node);
+}
+
+/**
+ * @brief Sets the memory policy of `[ptr, ptr + bytes)` so that pages faulted in later are placed
+ * on `node`.
+ *
+ * @param ptr Page-aligned start of the range
+ * @param bytes Length of the range
+ * @param node Target NUMA node
+ * @param strict If true use `MPOL_BIND`, otherwise `MPOL_PREFERRED` so the kernel may fall back to
+ * another node when `node` is exhausted
+ * @return true if the policy was applied
+ */
+inline bool bind(void* ptr, std::size_t bytes, int node, bool strict) noexcept
+{
+  constexpr auto bits_per_word = sizeof(unsigned long) * 8;
+  if (node < 0 || static_cast<std::size_t>(node) >= bits_per_word) { return false; }
+  unsigned long const nodemask = 1UL << static_cast<unsigned>(node);
+  return syscall(SYS_mbind,
+                 ptr,
+                 bytes,
+                 strict ? mpol_bind : mpol_preferred,
+                 &nodemask,
+                 bits_per_word,
+                 0U) == 0;
+}
+
+/**
+ * @brief Maps `bytes` of anonymous read/write memory at the fixed address `addr`, which must lie
+ * inside a range previously reserved with `reserve`.
+ *
+ * When `huge_tlb` is true an explicit `MAP_HUGETLB` mapping is attempted first; if the huge page
+ * pool cannot satisfy it the range is mapped with regular pages instead. When `transparent_huge`
+ * is true the range is additionally advised with `MADV_HUGEPAGE`. No pages are faulted in, so a
+ * memory policy applied with `bind` afterwards governs where they land.
+ *
+ * @return true on success
+ */
+inline bool commit(void* addr, std::size_t bytes, bool huge_tlb, bool transparent_huge) noexcept
+{
+  constexpr int prot  = PROT_READ | PROT_WRITE;
+  constexpr int flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED;
+#ifdef MAP_HUGETLB
+  if (huge_tlb && mmap(addr, bytes, prot, flags | MAP_HUGETLB, -1, 0) == addr) { return true; }
+#endif
+  if (mmap(addr, bytes, prot, flags, -1, 0) != addr) { return false; }
+#ifdef MADV_HUGEPAGE
+  if (transparent_huge) { madvise(addr, bytes, MADV_HUGEPAGE); }
+#endif
+  return true;
+}
+
+/**
+ * @brief Faults in every page of `[addr, addr + bytes)` so that later first touches are free.
+ */
+inline void populate(void* addr, std::size_t bytes) noexcept
+{
+#ifdef MADV_POPULATE_WRITE
+  if (madvise(addr, bytes, MADV_POPULATE_WRITE) == 0) { return; }
+#endif
+  auto const page_size = static_cast<std::size_t>(getpagesize());
+  auto* const first    = static_cast<volatile char*>(addr);
+  for (std::size_t offset = 0; offset < bytes; offset += page_size) {
+    first[offset] = 0;  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  }
+}
+
+/**
+ * @brief Reserves `bytes` of virtual address space without committing any memory, aligned to
+ * `alignment`.
+ *
+ * @return Pointer to the reservation, or `nullptr` on failure
+ */
+inline void* reserve(std::size_t bytes, std::size_t alignment) noexcept
+{
+  auto const padded = bytes + alignment;
+  void* const raw =
+    mmap(nullptr, padded, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+  if (raw == MAP_FAILED) { return nullptr; }
+  auto const raw_addr     = reinterpret_cast<std::uintptr_t>(raw);  // NOLINT
+  auto const aligned_addr = (raw_addr + alignment - 1) & ~(alignment - 1);
+  // trim the unaligned head and the unused tail
+  if (aligned_addr > raw_addr) { munmap(raw, aligned_addr - raw_addr); }
+  auto const tail = (raw_addr + padded) - (aligned_addr + bytes);
+  if (tail > 0) {
+    munmap(reinterpret_cast<void*>(aligned_addr + bytes), tail);  // NOLINT
+  }
+  return reinterpret_cast<void*>(aligned_addr);  // NOLINT(performance-no-int-to-ptr)
+}
+
+/**
+ * @brief Releases a range obtained from `reserve` back to the operating system.
+ */
+inline void release(void* addr, std::size_t bytes) noexcept { munmap(addr, bytes); }
+
+}  // namespace numa
+}  // namespace mr::detail
+}  // namespace RMM_NAMESPACE
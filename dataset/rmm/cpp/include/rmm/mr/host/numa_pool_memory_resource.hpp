@@ -0,0 +1,480 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <rmm/aligned.hpp>
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/detail/aligned.hpp>
+#include <rmm/detail/error.hpp>
+#include <rmm/detail/export.hpp>
+#include <rmm/mr/host/detail/numa.hpp>
+#include <rmm/mr/host/host_memory_resource.hpp>
+
+#include <sys/mman.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace RMM_NAMESPACE {
+namespace mr {
+/**
+ * @addtogroup host_memory_resources
+ * @{
+ * @file
+ */
+
+/**
+ * @brief How a `numa_pool_memory_resource` asks the kernel for huge pages.
+ */
+enum class huge_page_mode {
+  none,              ///< Regular base pages only
+  transparent,       ///< Regular mappings advised with `MADV_HUGEPAGE` (transparent huge pages)
+  explicit_huge_tlb  ///< `MAP_HUGETLB` mappings, falling back to `transparent` when the
+                     ///< preallocated huge page pool is exhausted
+};
+
+/**
+ * @brief A `host_memory_resource` that pools pageable host memory per NUMA node.
+ *
+ * At construction, a contiguous range of virtual address space of `node_capacity` bytes is
+ * reserved for every online NUMA node. Memory is committed into a node's range in chunks of
+ * `chunk_size` bytes using `mmap`, with the huge page policy given by `huge_page_mode`, and the
+ * chunk is bound to its node with `mbind` before any page is touched. This avoids both the 4 KiB
+ * first-touch faults of `operator new` and the placement of memory on whatever node the
+ * allocating thread happened to run on.
+ *
+ * Allocations up to `max_block_size` bytes are rounded up to one of four size classes per power of
+ * two (bounding internal fragmentation to 25%) and recycled through per-node, per-class free lists,
+ * so a buffer is only ever faulted in once. Larger allocations are mapped and unmapped directly,
+ * still honoring the huge page and NUMA policy.
+ *
+ * `allocate` places memory on the node of the CPU the calling thread is running on;
+ * `allocate_on_node` selects the node explicitly. The owning node of a pooled pointer is recovered
+ * in O(1) from its address, so memory may be deallocated from any thread.
+ *
+ * The resource also provides the `allocate_async` / `deallocate_async` interface (ignoring the
+ * stream), so it may be used wherever a `host_async_resource_ref` is accepted.
+ */
+class numa_pool_memory_resource final : public host_memory_resource {
+ public:
+  /// The smallest size class; all pooled allocations are rounded up to at least this size
+  static constexpr std::size_t min_block_size{256};
+  /// Default largest pooled allocation; larger allocations are mapped directly
+  static constexpr std::size_t default_max_block_size{std::size_t{64} << 20U};
+  /// Default granularity by which a node's pool grows
+  static constexpr std::size_t default_chunk_size{std::size_t{64} << 20U};
+  /// Default amount of virtual address space reserved per node (no memory is committed)
+  static constexpr std::size_t default_node_capacity{std::size_t{256} << 30U};
+
+  /**
+   * @brief Construct a NUMA-aware host pool.
+   *
+   * @throws rmm::logic_error if `max_block_size` exceeds `chunk_size` or `chunk_size` exceeds
+   * `node_capacity`
+   * @throws rmm::bad_alloc if the virtual address space cannot be reserved
+   *
+   * @param mode The huge page policy used when committing memory
+   * @param prefault If true, pages are faulted in when a chunk is committed rather than on first
+   * touch by the caller
+   * @param max_block_size The largest allocation served from the size-classed pool
+   * @param chunk_size The granularity by which a node's pool grows; rounded up to a multiple of the
+   * huge page size
+   * @param node_capacity The maximum size of each node's pool; rounded up to a multiple of
+   * `chunk_size`
+   */
+  explicit numa_pool_memory_resource(huge_page_mode mode        = huge_page_mode::transparent,
+                                     bool prefault              = false,
+                                     std::size_t max_block_size = default_max_block_size,
+                                     std::size_t chunk_size     = default_chunk_size,
+                                     std::size_t node_capacity  = default_node_capacity)
+    : mode_{mode},
+      prefault_{prefault},
+      max_block_size_{size_class_bytes(size_class_index(max_block_size))},
+      chunk_size_{align_up(chunk_size, detail::numa::huge_page_size)},
+      node_capacity_{align_up(node_capacity, chunk_size_)},
+      num_nodes_{detail::numa::num_nodes()}
+  {
+    RMM_EXPECTS(max_block_size_ <= chunk_size_, "Maximum block size must not exceed chunk size");
+    RMM_EXPECTS(chunk_size_ <= node_capacity_, "Chunk size must not exceed node capacity");
+
+    auto const reservation_size = node_capacity_ * static_cast<std::size_t>(num_nodes_);
+    reservation_ = static_cast<char*>(
+      detail::numa::reserve(reservation_size, detail::numa::huge_page_size));
+    RMM_EXPECTS(reservation_ != nullptr,
+                "Failed to reserve " + std::to_string(reservation_size) + " bytes of address space",
+                rmm::bad_alloc);
+
+    auto const num_classes = size_class_index(max_block_size_) + 1;
+    nodes_.reserve(static_cast<std::size_t>(num_nodes_));
+    for (int node = 0; node < num_nodes_; ++node) {
+      auto* const base = reservation_ + node_capacity_ * static_cast<std::size_t>(node);
+      nodes_.emplace_back(std::make_unique<node_pool>(base, base + node_capacity_, num_classes));
+    }
+  }
+
+  /**
+   * @brief Destroy the resource, returning all pooled memory to the operating system.
+   *
+   * Allocations larger than `max_block_size` that have not been deallocated are not reclaimed.
+   */
+  ~numa_pool_memory_resource() override
+  {
+    detail::numa::release(reservation_, node_capacity_ * static_cast<std::size_t>(num_nodes_));
+  }
+
+  numa_pool_memory_resource(numa_pool_memory_resource const&)            = delete;
+  numa_pool_memory_resource(numa_pool_memory_resource&&)                 = delete;
+  numa_pool_memory_resource& operator=(numa_pool_memory_resource const&) = delete;
+  numa_pool_memory_resource& operator=(numa_pool_memory_resource&&)      = delete;
+
+  /**
+   * @brief Allocates memory of size at least `bytes` bytes on NUMA node `node`.
+   *
+   * @throws rmm::logic_error if `node` is not an online node
+   * @throws rmm::out_of_memory if the node's pool is exhausted or the memory cannot be mapped
+   *
+   * @param bytes The size of the allocation
+   * @param node The NUMA node on which to place the allocation
+   * @param alignment Alignment of the allocation
+   * @return Pointer to the newly allocated memory
+   */
+  void* allocate_on_node(std::size_t bytes,
+                         int node,
+                         std::size_t alignment = rmm::RMM_DEFAULT_HOST_ALIGNMENT)
+  {
+    RMM_EXPECTS(node >= 0 && node < num_nodes_, "Invalid NUMA node");
+    return allocate_impl(bytes, alignment, node);
+  }
+
+  /**
+   * @brief Pretend to support the allocate_async interface, falling back to stream 0
+   *
+   * @throws rmm::out_of_memory When the requested `bytes` cannot be allocated
+   *
+   * @param bytes The size of the allocation
+   * @param alignment The expected alignment of the allocation
+   * @return void* Pointer to the newly allocated memory
+   */
+  [[nodiscard]] void* allocate_async(std::size_t bytes, std::size_t alignment, cuda_stream_view)
+  {
+    return do_allocate(bytes, alignment);
+  }
+
+  /**
+   * @brief Pretend to support the allocate_async interface, falling back to stream 0
+   *
+   * @throws rmm::out_of_memory When the requested `bytes` cannot be allocated
+   *
+   * @param bytes The size of the allocation
+   * @return void* Pointer to the newly allocated memory
+   */
+  [[nodiscard]] void* allocate_async(std::size_t bytes, cuda_stream_view)
+  {
+    return do_allocate(bytes);
+  }
+
+  /**
+   * @brief Pretend to support the deallocate_async interface, falling back to stream 0
+   *
+   * @param ptr Pointer to be deallocated
+   * @param bytes The size in bytes of the allocation. This must be equal to the
+   * value of `bytes` that was passed to the `allocate` call that returned `p`.
+   * @param alignment The alignment that was passed to the `allocate` call that returned `p`
+   */
+  void deallocate_async(void* ptr, std::size_t bytes, std::size_t alignment, cuda_stream_view)
+  {
+    do_deallocate(ptr, bytes, alignment);
+  }
+
+  /**
+   * @brief Pretend to support the deallocate_async interface, falling back to stream 0
+   *
+   * @param ptr Pointer to be deallocated
+   * @param bytes The size in bytes of the allocation. This must be equal to the
+   * value of `bytes` that was passed to the `allocate` call that returned `p`.
+   */
+  void deallocate_async(void* ptr, std::size_t bytes, cuda_stream_view)
+  {
+    do_deallocate(ptr, bytes);
+  }
+
+  /**
+   * @briefreturn{The number of NUMA nodes this resource maintains a pool for}
+   */
+  [[nodiscard]] int num_nodes() const noexcept { return num_nodes_; }
+
+  /**
+   * @brief Returns the NUMA node whose pool `ptr` was allocated from, or -1 if `ptr` was not
+   * allocated from any node's pool (e.g. an allocation larger than `max_block_size`).
+   *
+   * @param ptr Pointer returned by this resource
+   * @return The owning NUMA node
+   */
+  [[nodiscard]] int node_of(void const* ptr) const noexcept
+  {
+    auto const addr  = reinterpret_cast<std::uintptr_t>(ptr);           // NOLINT
+    auto const first = reinterpret_cast<std::uintptr_t>(reservation_);  // NOLINT
+    auto const last  = first + node_capacity_ * static_cast<std::size_t>(num_nodes_);
+    if (addr < first || addr >= last) { return -1; }
+    return static_cast<int>((addr - first) / node_capacity_);
+  }
+
+  /**
+   * @brief Returns the number of bytes committed to the pool of `node`.
+   *
+   * @param node The NUMA node
+   * @return Committed bytes, whether free or allocated
+   */
+  [[nodiscard]] std::size_t pool_size(int node) const
+  {
+    RMM_EXPECTS(node >= 0 && node < num_nodes_, "Invalid NUMA node");
+    auto const& pool = *nodes_[static_cast<std::size_t>(node)];
+    std::lock_guard<std::mutex> lock(pool.mtx);
+    return static_cast<std::size_t>(pool.committed_end - pool.base);
+  }
+
+  /**
+   * @briefreturn{The largest allocation size served from the pool}
+   */
+  [[nodiscard]] std::size_t max_block_size() const noexcept { return max_block_size_; }
+
+  /**
+   * @brief Returns the index of the size class serving allocations of `bytes` bytes.
+   *
+   * Classes are `min_block_size * 2^(k/4) * (4 + k%4) / 4`, i.e. four evenly spaced classes per
+   * power of two.
+   *
+   * @param bytes The allocation size
+   * @return The size class index
+   */
+  [[nodiscard]] static constexpr std::size_t size_class_index(std::size_t bytes) noexcept
+  {
+    if (bytes <= min_block_size) { return 0; }
+    std::size_t exponent{0};
+    for (auto value = bytes - 1; value > 1; value >>= 1U) {
+      ++exponent;
+    }
+    // 2^exponent < bytes <= 2^(exponent + 1)
+    auto const base = std::size_t{1} << exponent;
+    auto const step = base >> 2U;
+    auto const sub  = (bytes - base + step - 1) / step;  // in [1, 4]
+    return (exponent - min_block_exponent) * classes_per_pow2 + sub;
+  }
+
+  /**
+   * @brief Returns the size in bytes of the blocks of size class `index`.
+   *
+   * @param index The size class index
+   * @return The size class in bytes
+   */
+  [[nodiscard]] static constexpr std::size_t size_class_bytes(std::size_t index) noexcept
+  {
+    auto const base = min_block_size << (index / classes_per_pow2);
+    return base / classes_per_pow2 * (classes_per_pow2 + index % classes_per_pow2);
+  }
+
+ private:
+  static constexpr std::size_t min_block_exponent{8};  // log2(min_block_size)
+  static constexpr std::size_t classes_per_pow2{4};
+  static constexpr std::size_t max_natural_alignment{4096};
+
+  /**
+   * @brief The pool of a single NUMA node: a bump region of committed memory plus per-size-class
+   * free lists of blocks carved from it.
+   */
+  struct node_pool {
+    node_pool(char* base, char* limit, std::size_t num_classes)
+      : base{base}, bump{base}, committed_end{base}, limit{limit}, free_lists(num_classes)
+    {
+    }
+
+    mutable std::mutex mtx;
+    char* base;           ///< first byte of the node's address range
+    char* bump;           ///< next byte not yet carved into a block
+    char* committed_end;  ///< end of the committed part of the range
+    char* limit;          ///< end of the node's address range
+    std::vector<std::vector<void*>> free_lists;
+  };
+
+  /**
+   * @brief The alignment every block of `size_class` is guaranteed to have without padding.
+   */
+  [[nodiscard]] static constexpr std::size_t natural_alignment(std::size_t size_class) noexcept
+  {
+    auto const bytes = size_class_bytes(size_class);
+    auto const lsb   = bytes & (~bytes + 1);
+    return lsb < max_natural_alignment ? lsb : max_natural_alignment;
+  }
+
+  /**
+   * @brief Whether an allocation must be over-allocated to satisfy `alignment`.
+   */
+  [[nodiscard]] bool needs_padding(std::size_t bytes, std::size_t alignment) const noexcept
+  {
+    if (bytes > max_block_size_) { return alignment > max_natural_alignment; }
+    return alignment > natural_alignment(size_class_index(bytes));
+  }
+
+  void* allocate_impl(std::size_t bytes, std::size_t alignment, int node)
+  {
+    // don't allocate anything if the user requested zero bytes
+    if (0 == bytes) { return nullptr; }
+
+    // If the requested alignment isn't supported, use default
+    alignment =
+      (rmm::is_supported_alignment(alignment)) ? alignment : rmm::RMM_DEFAULT_HOST_ALIGNMENT;
+
+    if (needs_padding(bytes, alignment)) {
+      return rmm::detail::aligned_host_allocate(
+        bytes, alignment, [this, node](std::size_t size) { return allocate_block(size, node); });
+    }
+    return allocate_block(bytes, node);
+  }
+
+  void* allocate_block(std::size_t bytes, int node)
+  {
+    if (bytes > max_block_size_) { return map_large(bytes, node); }
+
+    auto const size_class = size_class_index(bytes);
+    auto& pool            = *nodes_[static_cast<std::size_t>(node)];
+    std::lock_guard<std::mutex> lock(pool.mtx);
+
+    auto& free_list = pool.free_lists[size_class];
+    if (!free_list.empty()) {
+      void* ptr = free_list.back();
+      free_list.pop_back();
+      return ptr;
+    }
+    return carve(pool, size_class, node);
+  }
+
+  /**
+   * @brief Carves a new block of `size_class` from the node's bump region, committing another
+   * chunk if necessary. Must be called with the node's lock held.
+   */
+  void* carve(node_pool& pool, std::size_t size_class, int node)
+  {
+    auto const bytes = size_class_bytes(size_class);
+    auto* const ptr  = pool.base + align_up(static_cast<std::size_t>(pool.bump - pool.base),
+                                           natural_alignment(size_class));
+    if (ptr + bytes > pool.committed_end) {
+      auto const needed = static_cast<std::size_t>(ptr + bytes - pool.committed_end);
+      auto const grow   = align_up(needed, chunk_size_);
+      if (grow > static_cast<std::size_t>(pool.limit - pool.committed_end)) {
+        RMM_FAIL("Maximum pool size exceeded (failed to allocate " + std::to_string(bytes) +
+                   " bytes on NUMA node " + std::to_string(node) + ")",
+                 rmm::out_of_memory);
+      }
+      commit(pool.committed_end, grow, node);
+      pool.committed_end += grow;
+    }
+    pool.bump = ptr + bytes;
+    return ptr;
+  }
+
+  /**
+   * @brief Commits `bytes` at `addr` with the configured huge page policy, bound to `node`.
+   */
+  void commit(void* addr, std::size_t bytes, int node) const
+  {
+    if (!detail::numa::commit(addr,
+                              bytes,
+                              mode_ == huge_page_mode::explicit_huge_tlb,
+                              mode_ != huge_page_mode::none)) {
+      RMM_FAIL("Failed to commit " + std::to_string(bytes) + " bytes of host memory",
+               rmm::out_of_memory);
+    }
+    if (num_nodes_ > 1) { detail::numa::bind(addr, bytes, node, false); }
+    if (prefault_) { detail::numa::populate(addr, bytes); }
+  }
+
+  /**
+   * @brief Maps an allocation too large to be pooled directly, rounding it to whole huge pages.
+   */
+  void* map_large(std::size_t bytes, int node) const
+  {
+    auto const size = align_up(bytes, detail::numa::huge_page_size);
+    void* ptr =
+      mmap(nullptr, size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (ptr == MAP_FAILED) {
+      RMM_FAIL("Failed to map " + std::to_string(bytes) + " bytes of host memory",
+               rmm::out_of_memory);
+    }
+    try {
+      commit(ptr, size, node);
+    } catch (...) {
+      munmap(ptr, size);
+      throw;
+    }
+    return ptr;
+  }
+
+  void* do_allocate(std::size_t bytes,
+                    std::size_t alignment = rmm::RMM_DEFAULT_HOST_ALIGNMENT) override
+  {
+    auto const node = detail::numa::current_node();
+    return allocate_impl(bytes, alignment, node < num_nodes_ ? node : 0);
+  }
+
+  void do_deallocate(void* ptr,
+                     std::size_t bytes,
+                     std::size_t alignment = rmm::RMM_DEFAULT_HOST_ALIGNMENT) override
+  {
+    if (nullptr == ptr) { return; }
+
+    alignment =
+      (rmm::is_supported_alignment(alignment)) ? alignment : rmm::RMM_DEFAULT_HOST_ALIGNMENT;
+
+    auto const free_block = [this](void* block, std::size_t size) {
+      if (size > max_block_size_) {
+        munmap(block, align_up(size, detail::numa::huge_page_size));
+        return;
+      }
+      auto& pool = *nodes_[static_cast<std::size_t>(node_of(block))];
+      std::lock_guard<std::mutex> lock(pool.mtx);
+      pool.free_lists[size_class_index(size)].push_back(block);
+    };
+
+    if (needs_padding(bytes, alignment)) {
+      // aligned_host_deallocate only hands back the original pointer, so recompute the padded
+      // size it was allocated with
+      auto const padded = bytes + alignment + sizeof(std::ptrdiff_t);
+      rmm::detail::aligned_host_deallocate(
+        ptr, bytes, alignment, [&free_block, padded](void* block) { free_block(block, padded); });
+    } else {
+      free_block(ptr, bytes);
+    }
+  }
+
+  huge_page_mode mode_;
+  bool prefault_;
+  std::size_t max_block_size_;
+  std::size_t chunk_size_;
+  std::size_t node_capacity_;
+  int num_nodes_;
+  char* reservation_{nullptr};
+  std::vector<std::unique_ptr<node_pool>> nodes_;
+};
+
+static_assert(cuda::mr::async_resource_with<numa_pool_memory_resource, cuda::mr::host_accessible>);
+
+/** @} */  // end of group
+}  // namespace mr
+}  // namespace RMM_NAMESPACE
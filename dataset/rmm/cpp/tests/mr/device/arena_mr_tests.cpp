@@ -29,6 +29,7 @@
 #include <gtest/gtest.h>
 #include <sys/stat.h>
 
+#include <chrono>
 #include <cstddef>
 #include <limits>
 #include <memory>
@@ -59,6 +60,8 @@ using rmm::mr::detail::arena::superblock;
 using global_arena = rmm::mr::detail::arena::global_arena;
 using arena        = rmm::mr::detail::arena::arena;
 using arena_mr     = rmm::mr::arena_memory_resource<rmm::mr::device_memory_resource>;
+using rmm::mr::arena_reclaim_policy;
+using rmm::mr::detail::arena::occupancy_bins;
 using ::testing::Return;
 
 // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast,performance-no-int-to-ptr)
@@ -303,6 +306,16 @@ TEST_F(ArenaTest, SuperblockMaxFreeSizeWhenFull)  // NOLINT
   EXPECT_EQ(sblk.max_free_size(), 0);
 }
 
+TEST_F(ArenaTest, SuperblockOccupancy)  // NOLINT
+{
+  superblock sblk{fake_address3, superblock::minimum_size};
+  EXPECT_EQ(sblk.occupancy(), 0.0);
+  sblk.first_fit(superblock::minimum_size / 4);
+  EXPECT_DOUBLE_EQ(sblk.occupancy(), 0.25);
+  sblk.first_fit(superblock::minimum_size * 3 / 4);
+  EXPECT_EQ(sblk.occupancy(), 1.0);
+}
+
 /**
  * Test global_arena.
  */
@@ -409,6 +422,23 @@ TEST_F(ArenaTest, GlobalArenaDeallocateFromOtherArena)  // NOLINT
   EXPECT_EQ(global->allocate(arena_size), fake_address3);
 }
 
+TEST_F(ArenaTest, GlobalArenaFreeBytes)  // NOLINT
+{
+  EXPECT_EQ(global->free_bytes(), arena_size);
+  auto sblk = global->acquire(256);
+  EXPECT_EQ(global->free_bytes(), arena_size - superblock::minimum_size);
+  auto const blk = sblk.first_fit(256);
+  global->release(std::move(sblk));
+  EXPECT_EQ(global->free_bytes(), arena_size - 256);
+  global->deallocate(blk.pointer(), blk.size());
+  EXPECT_EQ(global->free_bytes(), arena_size);
+
+  auto* ptr = global->allocate(superblock::minimum_size * 2);
+  EXPECT_EQ(global->free_bytes(), arena_size - superblock::minimum_size * 2);
+  global->deallocate(ptr, superblock::minimum_size * 2);
+  EXPECT_EQ(global->free_bytes(), arena_size);
+}
+
 /**
  * Test arena.
  */
@@ -472,6 +502,39 @@ TEST_F(ArenaTest, ArenaDefragment)  // NOLINT
   EXPECT_EQ(global->allocate(arena_size), fake_address3);
 }
 
+TEST_F(ArenaTest, ArenaUsage)  // NOLINT
+{
+  auto* ptr        = per_thread->allocate(superblock::minimum_size / 2);
+  auto const usage = per_thread->usage();
+  EXPECT_EQ(usage.superblocks, 1);
+  EXPECT_EQ(usage.superblock_bytes, superblock::minimum_size);
+  EXPECT_EQ(usage.free_bytes, superblock::minimum_size / 2);
+  EXPECT_EQ(usage.max_free_size, superblock::minimum_size / 2);
+  EXPECT_EQ(usage.occupancy.at(occupancy_bins / 2), 1);
+  per_thread->deallocate(ptr, superblock::minimum_size / 2, {});
+}
+
+TEST_F(ArenaTest, ArenaIdleTime)  // NOLINT
+{
+  per_thread->allocate(256);
+  auto const idle = per_thread->idle_time();
+  std::this_thread::sleep_for(std::chrono::milliseconds{10});
+  EXPECT_GE(per_thread->idle_time() - idle, std::chrono::milliseconds{10});
+}
+
+TEST_F(ArenaTest, ArenaReclaim)  // NOLINT
+{
+  auto* ptr  = per_thread->allocate(superblock::minimum_size / 2);
+  auto* ptr2 = per_thread->allocate(superblock::minimum_size);
+  EXPECT_EQ(per_thread->reclaim(0.25), 0);
+  EXPECT_EQ(per_thread->reclaim(0.5), superblock::minimum_size);
+  EXPECT_EQ(per_thread->usage().superblocks, 1);
+  // The remaining allocation in the reclaimed superblock is now freed through the global arena.
+  EXPECT_FALSE(per_thread->deallocate(ptr, superblock::minimum_size / 2));
+  EXPECT_TRUE(global->deallocate(ptr, superblock::minimum_size / 2));
+  EXPECT_TRUE(per_thread->deallocate(ptr2, superblock::minimum_size, {}));
+}
+
 /**
  * Test arena_memory_resource.
  */
@@ -567,6 +630,113 @@ TEST_F(ArenaTest, PerThreadToStreamDealloc)  // NOLINT
   mr.deallocate(ptr2, 32_KiB, rmm::cuda_stream_view{});
 }
 
+TEST_F(ArenaTest, ThrowOnInvalidReclaimOccupancy)  // NOLINT
+{
+  auto construct_invalid = []() {
+    arena_mr mr{rmm::mr::get_current_device_resource_ref(),
+                superblock::minimum_size * 2,
+                false,
+                arena_reclaim_policy{1.5}};
+  };
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-goto)
+  EXPECT_THROW(construct_invalid(), rmm::logic_error);
+}
+
+TEST_F(ArenaTest, ArenaStats)  // NOLINT
+{
+  auto const arena_size = superblock::minimum_size * 4;
+  arena_mr mr(rmm::mr::get_current_device_resource_ref(), arena_size);
+  cuda_stream stream{};
+  void* half = mr.allocate(superblock::minimum_size / 2, stream);
+  void* tiny = mr.allocate(256, rmm::cuda_stream_per_thread);
+
+  auto const stats = mr.get_arena_stats();
+  EXPECT_EQ(stats.global.free_bytes, arena_size - superblock::minimum_size * 2);
+  ASSERT_EQ(stats.stream_arenas.size(), 1);
+  EXPECT_EQ(stats.stream_arenas.front().superblocks, 1);
+  EXPECT_EQ(stats.stream_arenas.front().free_bytes, superblock::minimum_size / 2);
+  EXPECT_EQ(stats.stream_arenas.front().occupancy.at(occupancy_bins / 2), 1);
+  ASSERT_EQ(stats.thread_arenas.size(), 1);
+  EXPECT_EQ(stats.thread_arenas.front().free_bytes, superblock::minimum_size - 256);
+  EXPECT_EQ(stats.thread_arenas.front().occupancy.at(0), 1);
+  EXPECT_EQ(stats.reclaim_passes, 0);
+
+  mr.deallocate(half, superblock::minimum_size / 2, stream);
+  mr.deallocate(tiny, 256, rmm::cuda_stream_per_thread);
+}
+
+TEST_F(ArenaTest, ReclaimFromIdleArena)  // NOLINT
+{
+  auto const arena_size = superblock::minimum_size * 2;
+  arena_mr mr(rmm::mr::get_current_device_resource_ref(), arena_size);
+  cuda_stream stream{};
+  // Leaves a superblock that is almost empty in the stream arena
+  void* straggler = mr.allocate(256, stream);
+
+  EXPECT_EQ(mr.reclaim(), superblock::minimum_size);
+  auto const stats = mr.get_arena_stats();
+  EXPECT_EQ(stats.stream_arenas.front().superblocks, 0);
+  EXPECT_EQ(stats.global.free_bytes, arena_size - 256);
+  EXPECT_EQ(stats.reclaim_passes, 1);
+  EXPECT_EQ(stats.reclaimed_bytes, superblock::minimum_size);
+
+  mr.deallocate(straggler, 256, stream);
+  EXPECT_EQ(mr.get_arena_stats().global.free_bytes, arena_size);
+}
+
+TEST_F(ArenaTest, ReclaimSkipsBusyArenas)  // NOLINT
+{
+  arena_reclaim_policy policy{};
+  policy.min_idle_time = std::chrono::hours{1};
+  arena_mr mr(
+    rmm::mr::get_current_device_resource_ref(), superblock::minimum_size * 2, false, policy);
+  cuda_stream stream{};
+  void* ptr = mr.allocate(256, stream);
+  EXPECT_EQ(mr.reclaim(), 0);
+  EXPECT_EQ(mr.get_arena_stats().stream_arenas.front().superblocks, 1);
+  mr.deallocate(ptr, 256, stream);
+}
+
+TEST_F(ArenaTest, ReclaimOnLowWatermark)  // NOLINT
+{
+  arena_reclaim_policy policy{};
+  policy.low_watermark = superblock::minimum_size * 2;
+  arena_mr mr(
+    rmm::mr::get_current_device_resource_ref(), superblock::minimum_size * 4, false, policy);
+  cuda_stream stream{};
+  void* small = mr.allocate(256, stream);
+  EXPECT_EQ(mr.get_arena_stats().reclaim_passes, 0);
+
+  // Drops the free memory in the global arena below the watermark
+  void* large = mr.allocate(superblock::minimum_size * 2, rmm::cuda_stream_per_thread);
+  auto const stats = mr.get_arena_stats();
+  EXPECT_EQ(stats.reclaim_passes, 1);
+  EXPECT_EQ(stats.stream_arenas.front().superblocks, 0);
+
+  // Staying below the watermark does not reclaim again
+  void* small2 = mr.allocate(256, stream);
+  EXPECT_EQ(mr.get_arena_stats().reclaim_passes, 1);
+
+  mr.deallocate(small, 256, stream);
+  mr.deallocate(small2, 256, stream);
+  mr.deallocate(large, superblock::minimum_size * 2, rmm::cuda_stream_per_thread);
+}
+
+TEST_F(ArenaTest, ReclaimInBackground)  // NOLINT
+{
+  arena_reclaim_policy policy{};
+  policy.interval = std::chrono::milliseconds{1};
+  arena_mr mr(
+    rmm::mr::get_current_device_resource_ref(), superblock::minimum_size * 2, false, policy);
+  cuda_stream stream{};
+  void* ptr = mr.allocate(256, stream);
+  while (mr.get_arena_stats().reclaimed_bytes == 0) {
+    std::this_thread::sleep_for(std::chrono::milliseconds{1});
+  }
+  EXPECT_EQ(mr.get_arena_stats().stream_arenas.front().superblocks, 0);
+  mr.deallocate(ptr, 256, stream);
+}
+
 TEST_F(ArenaTest, DumpLogOnFailure)  // NOLINT
 {
   arena_mr mr{rmm::mr::get_current_device_resource_ref(), 1_MiB, true};
@@ -37,7 +37,7 @@ struct mr_ref_test_mt : public mr_ref_test {};
 INSTANTIATE_TEST_SUITE_P(
   MultiThreadResourceTests,
   mr_ref_test_mt,
-  ::testing::Values("CUDA", "CUDA_Async", "Managed", "Pool", "Arena", "Binning"),
+  ::testing::Values("CUDA", "CUDA_Async", "Managed", "Pool", "Arena", "Binning", "Size_Class"),
   [](auto const& info) { return info.param; });
 
 template <typename Task, typename... Arguments>
@@ -32,6 +32,7 @@
 #include <rmm/mr/device/owning_wrapper.hpp>
 #include <rmm/mr/device/per_device_resource.hpp>
 #include <rmm/mr/device/pool_memory_resource.hpp>
+#include <rmm/mr/device/size_class_memory_resource.hpp>
 #include <rmm/mr/device/system_memory_resource.hpp>
 #include <rmm/mr/pinned_host_memory_resource.hpp>
 #include <rmm/resource_ref.hpp>
@@ -398,6 +399,18 @@ inline auto make_binning()
   return mr;
 }
 
+inline auto make_size_class()
+{
+  auto pool = make_pool();
+  // Add a size_class_memory_resource with bins of sizes 256B, 512B, ..., 1MiB
+  // Larger allocations will use the pool resource
+  auto const bin_range_start{8};
+  auto const bin_range_end{20};
+
+  return rmm::mr::make_owning_wrapper<rmm::mr::size_class_memory_resource>(
+    pool, bin_range_start, bin_range_end);
+}
+
 struct mr_factory_base {
   std::string name{};  ///< Name to associate with tests that use this factory
   resource_ref mr{rmm::mr::get_current_device_resource_ref()};
@@ -432,6 +445,7 @@ using pinned_pool_mr = rmm::mr::pool_memory_resource<pinned_mr>;
 using arena_mr       = rmm::mr::arena_memory_resource<cuda_mr>;
 using fixed_mr       = rmm::mr::fixed_size_memory_resource<cuda_mr>;
 using binning_mr     = rmm::mr::binning_memory_resource<pool_mr>;
+using size_class_mr  = rmm::mr::size_class_memory_resource<pool_mr>;
 
 inline std::shared_ptr<mr_factory_base> mr_factory_dispatch(std::string name)
 {
@@ -458,6 +472,9 @@ inline std::shared_ptr<mr_factory_base> mr_factory_dispatch(std::string name)
   } else if (name == "Binning") {
     return std::make_shared<mr_factory<binning_mr, decltype(make_binning)>>("Binning",
                                                                             make_binning);
+  } else if (name == "Size_Class") {
+    return std::make_shared<mr_factory<size_class_mr, decltype(make_size_class)>>(
+      "Size_Class", make_size_class);
   } else if (name == "Fixed_Size") {
     return std::make_shared<mr_factory<fixed_mr, decltype(make_fixed_size)>>("Fixed_Size",
                                                                              make_fixed_size);
@@ -35,6 +35,7 @@ INSTANTIATE_TEST_SUITE_P(ResourceTests,
                                            "HostPinnedPool",
                                            "Arena",
                                            "Binning",
+                                           "Size_Class",
                                            "Fixed_Size"),
                          [](auto const& info) { return info.param; });
 
@@ -48,7 +49,8 @@ INSTANTIATE_TEST_SUITE_P(ResourceAllocationTests,
                                            "Pool",
                                            "HostPinnedPool",
                                            "Arena",
-                                           "Binning"),
+                                           "Binning",
+                                           "Size_Class"),
                          [](auto const& info) { return info.param; });
 
 TEST(DefaultTest, CurrentDeviceResourceIsCUDA)
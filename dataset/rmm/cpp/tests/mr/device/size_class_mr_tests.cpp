@@ -0,0 +1,328 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../byte_literals.hpp"
+
+#include <rmm/cuda_stream.hpp>
+#include <rmm/error.hpp>
+#include <rmm/mr/device/cuda_memory_resource.hpp>
+#include <rmm/mr/device/detail/size_class_bin.hpp>
+#include <rmm/mr/device/device_memory_resource.hpp>
+#include <rmm/mr/device/size_class_memory_resource.hpp>
+#include <rmm/mr/device/statistics_resource_adaptor.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <set>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// explicit instantiation for test coverage purposes
+template class rmm::mr::size_class_memory_resource<rmm::mr::cuda_memory_resource>;
+
+namespace rmm::test {
+namespace {
+
+using cuda_mr       = rmm::mr::cuda_memory_resource;
+using size_class_mr = rmm::mr::size_class_memory_resource<cuda_mr>;
+using statistics_mr = rmm::mr::statistics_resource_adaptor<cuda_mr>;
+using rmm::mr::detail::size_class_bin;
+
+/// An upstream that records the blocks it hands out and takes back, and refuses unknown ones
+class tracking_upstream final : public rmm::mr::device_memory_resource {
+ public:
+  explicit tracking_upstream(rmm::device_async_resource_ref upstream) : upstream_{upstream} {}
+
+  /// The blocks handed out and not yet returned, with their sizes
+  std::map<void*, std::size_t> outstanding;
+  /// Every block handed out
+  std::set<void*> allocated;
+  /// Every block returned
+  std::set<void*> deallocated;
+  /// Number of returned blocks that were not outstanding or not of the size handed out
+  int unknown{0};
+
+ private:
+  void* do_allocate(std::size_t bytes, rmm::cuda_stream_view stream) override
+  {
+    void* ptr = upstream_.allocate_async(bytes, stream);
+    outstanding.emplace(ptr, bytes);
+    allocated.insert(ptr);
+    return ptr;
+  }
+
+  void do_deallocate(void* ptr, std::size_t bytes, rmm::cuda_stream_view stream) override
+  {
+    auto const found = outstanding.find(ptr);
+    if (found == outstanding.end() || found->second != bytes) {
+      // Passing it on would free memory that is still in use
+      ++unknown;
+      return;
+    }
+    outstanding.erase(found);
+    deallocated.insert(ptr);
+    upstream_.deallocate_async(ptr, bytes, stream);
+  }
+
+  [[nodiscard]] bool do_is_equal(
+    rmm::mr::device_memory_resource const& other) const noexcept override
+  {
+    return this == &other;
+  }
+
+  rmm::device_async_resource_ref upstream_;
+};
+
+TEST(SizeClassTest, BitLength)
+{
+  using rmm::mr::detail::bit_length;
+  EXPECT_EQ(bit_length(0), 0);
+  EXPECT_EQ(bit_length(1), 1);
+  EXPECT_EQ(bit_length(2), 2);
+  EXPECT_EQ(bit_length(3), 2);
+  EXPECT_EQ(bit_length(255), 8);
+  EXPECT_EQ(bit_length(256), 9);
+  EXPECT_EQ(bit_length(~std::uint64_t{0}), 64);
+  for (std::size_t bit = 0; bit < 64; ++bit) {
+    EXPECT_EQ(bit_length(std::uint64_t{1} << bit), bit + 1);
+  }
+}
+
+TEST(SizeClassTest, ThrowOnNullUpstream)
+{
+  auto construct_nullptr = []() { size_class_mr mr{nullptr}; };
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-goto)
+  EXPECT_THROW(construct_nullptr(), rmm::logic_error);
+}
+
+TEST(SizeClassTest, ThrowOnZeroChunkSize)
+{
+  cuda_mr cuda{};
+  auto construct_empty_chunks = [&cuda]() { size_class_mr mr{&cuda, rmm::cuda_stream_view{}, 0}; };
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-goto)
+  EXPECT_THROW(construct_empty_chunks(), rmm::logic_error);
+}
+
+TEST(SizeClassTest, BinSizes)
+{
+  cuda_mr cuda{};
+  size_class_mr mr{&cuda, 8, 12};
+  EXPECT_EQ(mr.bin_sizes(), (std::vector<std::size_t>{256, 512, 1_KiB, 2_KiB, 4_KiB}));
+
+  // Sizes are aligned, kept sorted, and duplicates are ignored
+  mr.add_bin(700);
+  mr.add_bin(768);
+  mr.add_bin(64);
+  EXPECT_EQ(mr.bin_sizes(), (std::vector<std::size_t>{256, 512, 768, 1_KiB, 2_KiB, 4_KiB}));
+}
+
+TEST(SizeClassTest, DispatchToSmallestFittingBin)
+{
+  cuda_mr cuda{};
+  statistics_mr upstream{&cuda};
+  size_class_mr mr{&upstream, rmm::cuda_stream_view{}, 64_KiB};
+  mr.add_bin(256);
+  mr.add_bin(768);  // shares a bucket with the 1KiB bin
+  mr.add_bin(1_KiB);
+  mr.add_bin(4_KiB);
+
+  // Each bin obtains one chunk on its first allocation
+  auto expect_chunks = [&](std::size_t bytes, std::int64_t chunks) {
+    void* ptr = mr.allocate(bytes);
+    EXPECT_NE(ptr, nullptr);
+    EXPECT_EQ(upstream.get_allocations_counter().value, chunks) << bytes;
+    mr.deallocate(ptr, bytes);
+  };
+  expect_chunks(1, 1);      // 256
+  expect_chunks(256, 1);    // 256
+  expect_chunks(257, 2);    // 768
+  expect_chunks(768, 2);    // 768
+  expect_chunks(769, 3);    // 1KiB
+  expect_chunks(1_KiB, 3);  // 1KiB
+  expect_chunks(1025, 4);   // 4KiB
+  expect_chunks(4_KiB, 4);  // 4KiB
+
+  // Larger allocations go directly upstream
+  void* large = mr.allocate(4_KiB + 1);
+  EXPECT_EQ(upstream.get_allocations_counter().value, 5);
+  mr.deallocate(large, 4_KiB + 1);
+  EXPECT_EQ(upstream.get_allocations_counter().value, 4);
+}
+
+TEST(SizeClassTest, ReuseFreedBlocks)
+{
+  cuda_mr cuda{};
+  statistics_mr upstream{&cuda};
+  {
+    size_class_mr mr{&upstream, 8, 8, rmm::cuda_stream_view{}, 4_KiB};
+
+    // 16 blocks per chunk: filling one chunk and spilling into a second
+    std::vector<void*> ptrs;
+    for (int i = 0; i < 17; ++i) {
+      ptrs.push_back(mr.allocate(256));
+    }
+    EXPECT_EQ(std::set<void*>(ptrs.begin(), ptrs.end()).size(), ptrs.size());
+    EXPECT_EQ(upstream.get_allocations_counter().value, 2);
+    EXPECT_EQ(upstream.get_bytes_counter().value, 8_KiB);
+
+    for (auto* ptr : ptrs) {
+      mr.deallocate(ptr, 256);
+    }
+    // The most recently freed block is reused first
+    void* ptr = mr.allocate(256);
+    EXPECT_EQ(ptr, ptrs.back());
+    mr.deallocate(ptr, 256);
+    EXPECT_EQ(upstream.get_allocations_counter().value, 2);
+  }
+  // Chunks are returned on destruction
+  EXPECT_EQ(upstream.get_allocations_counter().value, 0);
+}
+
+TEST(SizeClassTest, ReturnChunksFreedOutOfOrder)
+{
+  cuda_mr cuda{};
+  tracking_upstream upstream{cuda};
+  {
+    // Two 256-byte blocks per chunk
+    rmm::mr::size_class_memory_resource<tracking_upstream> mr{
+      &upstream, 8, 8, rmm::cuda_stream_view{}, 512};
+
+    std::vector<void*> ptrs;
+    for (int i = 0; i < 6; ++i) {
+      ptrs.push_back(mr.allocate(256));
+    }
+    EXPECT_EQ(upstream.allocated.size(), 3);
+    // Freeing a chunk's first block before its second one stores the second block's address in
+    // the node of the first
+    for (int i : {0, 1, 3, 2, 4, 5}) {
+      mr.deallocate(ptrs[i], 256);
+    }
+    void* ptr = mr.allocate(256);
+    mr.deallocate(ptr, 256);
+  }
+  // Upstream gets back exactly the chunks it handed out
+  EXPECT_EQ(upstream.unknown, 0);
+  EXPECT_TRUE(upstream.outstanding.empty());
+  EXPECT_EQ(upstream.deallocated, upstream.allocated);
+}
+
+TEST(SizeClassTest, AllocateOnOtherStreams)
+{
+  cuda_mr cuda{};
+  rmm::cuda_stream bin_stream{};
+  rmm::cuda_stream other_stream{};
+  size_class_mr mr{&cuda, 8, 10, bin_stream};
+  EXPECT_EQ(mr.stream(), bin_stream.view());
+
+  void* ptr = mr.allocate(512, other_stream);
+  EXPECT_NE(ptr, nullptr);
+  mr.deallocate(ptr, 512, other_stream);
+  void* again = mr.allocate(512, bin_stream);
+  EXPECT_EQ(again, ptr);
+  mr.deallocate(again, 512, bin_stream);
+}
+
+TEST(SizeClassTest, BinConcurrentAllocation)
+{
+  constexpr std::size_t block_size{256};
+  constexpr std::size_t blocks_per_chunk{8};
+  constexpr std::size_t max_blocks{1024};
+  constexpr int num_threads{8};
+  constexpr int num_rounds{1000};
+  constexpr int blocks_per_round{8};
+
+  // Host memory stands in for device memory: the bin never dereferences its blocks
+  std::vector<char> backing(max_blocks * block_size);
+  std::vector<std::atomic<bool>> in_use(max_blocks);
+  std::atomic<std::size_t> used{0};
+  size_class_bin bin{block_size, blocks_per_chunk * block_size};
+  auto allocate_chunk = [&](std::size_t bytes) {
+    return static_cast<void*>(backing.data() + used.fetch_add(bytes));
+  };
+  auto block_index = [&](void* ptr) {
+    return static_cast<std::size_t>(static_cast<char*>(ptr) - backing.data()) / block_size;
+  };
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < num_threads; ++t) {
+    threads.emplace_back([&]() {
+      std::vector<void*> ptrs(blocks_per_round);
+      for (int round = 0; round < num_rounds; ++round) {
+        for (auto& ptr : ptrs) {
+          ptr = bin.allocate(allocate_chunk);
+          // Every block is handed to one thread at a time
+          EXPECT_FALSE(in_use[block_index(ptr)].exchange(true));
+        }
+        for (auto* ptr : ptrs) {
+          in_use[block_index(ptr)].store(false);
+          bin.deallocate(ptr);
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  // The bin only grows when it is empty, so at most one chunk more than the peak usage is created
+  // by each thread
+  auto const peak_chunks = num_threads * blocks_per_round / blocks_per_chunk;
+  EXPECT_LE(bin.num_chunks(), peak_chunks + num_threads);
+  bin.release([](void*, std::size_t) {});
+  EXPECT_EQ(bin.num_chunks(), 0);
+}
+
+TEST(SizeClassTest, BinReleaseReturnsChunkBases)
+{
+  constexpr std::size_t block_size{256};
+  constexpr std::size_t blocks_per_chunk{2};
+  constexpr std::size_t num_chunks{3};
+
+  std::vector<char> backing(num_chunks * blocks_per_chunk * block_size);
+  std::size_t used{0};
+  std::vector<void*> chunks;
+  size_class_bin bin{block_size, blocks_per_chunk * block_size};
+  auto allocate_chunk = [&](std::size_t bytes) {
+    chunks.push_back(backing.data() + used);
+    used += bytes;
+    return chunks.back();
+  };
+
+  std::vector<void*> ptrs;
+  for (std::size_t i = 0; i < num_chunks * blocks_per_chunk; ++i) {
+    ptrs.push_back(bin.allocate(allocate_chunk));
+  }
+  EXPECT_EQ(chunks.size(), num_chunks);
+  for (auto* ptr : ptrs) {
+    bin.deallocate(ptr);
+  }
+
+  std::vector<void*> released;
+  bin.release([&](void* ptr, std::size_t bytes) {
+    EXPECT_EQ(bytes, blocks_per_chunk * block_size);
+    released.push_back(ptr);
+  });
+  EXPECT_EQ(released, chunks);
+}
+
+}  // namespace
+}  // namespace rmm::test
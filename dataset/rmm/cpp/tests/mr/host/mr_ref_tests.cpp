@@ -19,6 +19,7 @@
 #include <rmm/aligned.hpp>
 #include <rmm/detail/cuda_memory_resource.hpp>
 #include <rmm/mr/host/new_delete_resource.hpp>
+#include <rmm/mr/host/numa_pool_memory_resource.hpp>
 #include <rmm/mr/host/pinned_memory_resource.hpp>
 #include <rmm/resource_ref.hpp>
 
@@ -77,9 +78,13 @@ struct MRRefTest : public ::testing::Test {
   MRRefTest() : mr{}, ref{mr} {}
 };
 
-using resources = ::testing::Types<rmm::mr::new_delete_resource, rmm::mr::pinned_memory_resource>;
+using resources = ::testing::Types<rmm::mr::new_delete_resource,
+                                   rmm::mr::pinned_memory_resource,
+                                   rmm::mr::numa_pool_memory_resource>;
 static_assert(cuda::mr::resource_with<rmm::mr::new_delete_resource, cuda::mr::host_accessible>);
 static_assert(cuda::mr::resource_with<rmm::mr::pinned_memory_resource, cuda::mr::host_accessible>);
+static_assert(
+  cuda::mr::resource_with<rmm::mr::numa_pool_memory_resource, cuda::mr::host_accessible>);
 
 TYPED_TEST_SUITE(MRRefTest, resources);
 
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../byte_literals.hpp"
+
+#include <rmm/aligned.hpp>
+#include <rmm/error.hpp>
+#include <rmm/mr/host/numa_pool_memory_resource.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstring>
+#include <vector>
+
+namespace rmm::test {
+namespace {
+using numa_pool_mr = rmm::mr::numa_pool_memory_resource;
+using rmm::mr::huge_page_mode;
+
+TEST(NumaPoolTest, SizeClasses)
+{
+  EXPECT_EQ(numa_pool_mr::size_class_index(1), 0);
+  EXPECT_EQ(numa_pool_mr::size_class_index(numa_pool_mr::min_block_size), 0);
+  EXPECT_EQ(numa_pool_mr::size_class_bytes(1), 320);
+  EXPECT_EQ(numa_pool_mr::size_class_index(512), 4);
+
+  // every size maps to the smallest class that fits it
+  for (std::size_t bytes = 1; bytes < 4_MiB; bytes += 17) {
+    auto const size_class = numa_pool_mr::size_class_index(bytes);
+    EXPECT_GE(numa_pool_mr::size_class_bytes(size_class), bytes);
+    if (size_class > 0) { EXPECT_LT(numa_pool_mr::size_class_bytes(size_class - 1), bytes); }
+  }
+}
+
+TEST(NumaPoolTest, ThrowChunkSmallerThanMaxBlock)
+{
+  auto construct = []() { numa_pool_mr mr{huge_page_mode::none, false, 64_MiB, 4_MiB}; };
+  EXPECT_THROW(construct(), rmm::logic_error);
+}
+
+TEST(NumaPoolTest, ThrowInvalidNode)
+{
+  numa_pool_mr mr{};
+  EXPECT_THROW(mr.allocate_on_node(1_KiB, -1), rmm::logic_error);
+  EXPECT_THROW(mr.allocate_on_node(1_KiB, mr.num_nodes()), rmm::logic_error);
+}
+
+TEST(NumaPoolTest, ReusesFreedBlocks)
+{
+  numa_pool_mr mr{huge_page_mode::none};
+  void* first = mr.allocate(100_KiB);
+  mr.deallocate(first, 100_KiB);
+  void* second = mr.allocate(100_KiB);
+  EXPECT_EQ(first, second);
+  mr.deallocate(second, 100_KiB);
+}
+
+TEST(NumaPoolTest, AllocateOnEveryNode)
+{
+  numa_pool_mr mr{huge_page_mode::transparent, true};
+  for (int node = 0; node < mr.num_nodes(); ++node) {
+    void* ptr = mr.allocate_on_node(1_MiB, node);
+    EXPECT_EQ(mr.node_of(ptr), node);
+    EXPECT_GE(mr.pool_size(node), 1_MiB);
+    std::memset(ptr, 0xcc, 1_MiB);
+    mr.deallocate(ptr, 1_MiB);
+  }
+}
+
+TEST(NumaPoolTest, LargeAllocationsBypassPool)
+{
+  numa_pool_mr mr{huge_page_mode::explicit_huge_tlb, false, 1_MiB, 2_MiB};
+  auto const size = 5_MiB;
+  void* ptr       = mr.allocate(size, 4_KiB);
+  EXPECT_TRUE(rmm::is_pointer_aligned(ptr, 4_KiB));
+  EXPECT_EQ(mr.node_of(ptr), -1);
+  std::memset(ptr, 0xcc, size);
+  mr.deallocate(ptr, size, 4_KiB);
+}
+
+TEST(NumaPoolTest, OverAlignedAllocations)
+{
+  numa_pool_mr mr{};
+  // 320-byte blocks are only naturally 64-byte aligned
+  void* ptr = mr.allocate(300, 256);
+  EXPECT_TRUE(rmm::is_pointer_aligned(ptr, 256));
+  mr.deallocate(ptr, 300, 256);
+}
+
+TEST(NumaPoolTest, ThrowOutOfMemory)
+{
+  numa_pool_mr mr{huge_page_mode::none, false, 1_MiB, 2_MiB, 4_MiB};
+  std::vector<void*> allocations;
+  for (int i = 0; i < 4; ++i) {
+    allocations.push_back(mr.allocate_on_node(1_MiB, 0));
+  }
+  EXPECT_THROW(mr.allocate_on_node(1_MiB, 0), rmm::out_of_memory);
+  for (auto* ptr : allocations) {
+    mr.deallocate(ptr, 1_MiB);
+  }
+}
+
+TEST(NumaPoolTest, AsyncResourceRef)
+{
+  numa_pool_mr mr{};
+  rmm::host_async_resource_ref ref{mr};
+  void* ptr = ref.allocate_async(1_KiB, rmm::RMM_DEFAULT_HOST_ALIGNMENT, cuda_stream_view{});
+  EXPECT_NE(ptr, nullptr);
+  ref.deallocate_async(ptr, 1_KiB, rmm::RMM_DEFAULT_HOST_ALIGNMENT, cuda_stream_view{});
+}
+
+}  // namespace
+}  // namespace rmm::test